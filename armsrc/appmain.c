@@ -62,6 +62,9 @@
 #include "ticks.h"
 #include "commonutil.h"
 #include "crc16.h"
+#ifdef WITH_BIGBUF_LZ4
+#include "lz4block.h"     // compressed BigBuf download
+#endif
 #include "protocols.h"
 #include "mifareutil.h"
 #include "sam_picopass.h"
@@ -487,6 +490,7 @@ static void SendStatus(uint32_t wait) {
 
 static void SendCapabilities(void) {
     capabilities_t capabilities;
+    memset(&capabilities, 0, sizeof(capabilities));
     capabilities.version = CAPABILITIES_VERSION;
     capabilities.via_fpc = g_reply_via_fpc;
     capabilities.via_usb = g_reply_via_usb;
@@ -611,6 +615,9 @@ static void SendCapabilities(void) {
     capabilities.compiled_with_zx8211 = false;
 #endif
 
+    // tagged commands are understood, and replies to them are tagged too
+    capabilities.has_tagged_frames = true;
+
     reply_ng(CMD_CAPABILITIES, PM3_SUCCESS, (uint8_t *)&capabilities, sizeof(capabilities));
 }
 
@@ -2541,14 +2548,32 @@ static void PacketReceived(PacketCommandNG *packet) {
 
             // arg0 = startindex
             // arg1 = length bytes to transfer
-            // arg2 = BigBuf tracelen
+            // arg2 = flags,  DOWNLOAD_BIGBUF_FLAG_xxx
             //Dbprintf("transfer to client parameters: %" PRIu32 " | %" PRIu32 " | %" PRIu32, startidx, numofbytes, packet->oldarg[2]);
 
-            for (size_t offset = 0; offset < numofbytes; offset += PM3_CMD_DATA_SIZE) {
-                size_t len = MIN((numofbytes - offset), PM3_CMD_DATA_SIZE);
-                int result = reply_old(CMD_DOWNLOADED_BIGBUF, offset, len, BigBuf_get_traceLen(), &mem[startidx + offset], len);
-                if (result != PM3_SUCCESS)
-                    Dbprintf("transfer to client failed ::  | bytes between %d - %d (%d) | result: %d", offset, offset + len, len, result);
+#ifdef WITH_BIGBUF_LZ4
+            if ((packet->oldarg[2] & DOWNLOAD_BIGBUF_FLAG_LZ4) == DOWNLOAD_BIGBUF_FLAG_LZ4) {
+                // LZ4 blocks,  each one as much as fits compressed in a frame
+                uint8_t block[PM3_CMD_DATA_SIZE];
+                size_t offset = 0;
+                while (offset < numofbytes) {
+                    size_t consumed = 0;
+                    size_t len = lz4block_pack(&mem[startidx + offset], numofbytes - offset, offset, block, sizeof(block), &consumed);
+                    int result = reply_ng(CMD_DOWNLOADED_BIGBUF_LZ4, PM3_SUCCESS, block, len);
+                    if (result != PM3_SUCCESS)
+                        Dbprintf("transfer to client failed ::  | bytes between %d - %d (%d) | result: %d", offset, offset + consumed, consumed, result);
+                    offset += consumed;
+                }
+            } else
+#endif
+            {
+                // without WITH_BIGBUF_LZ4 the flag is ignored,  the client takes plain chunks as well
+                for (size_t offset = 0; offset < numofbytes; offset += PM3_CMD_DATA_SIZE) {
+                    size_t len = MIN((numofbytes - offset), PM3_CMD_DATA_SIZE);
+                    int result = reply_old(CMD_DOWNLOADED_BIGBUF, offset, len, BigBuf_get_traceLen(), &mem[startidx + offset], len);
+                    if (result != PM3_SUCCESS)
+                        Dbprintf("transfer to client failed ::  | bytes between %d - %d (%d) | result: %d", offset, offset + len, len, result);
+                }
             }
             // Trigger a finish downloading signal with an ACK frame
             // arg0 = status of download transfer
@@ -3193,7 +3218,9 @@ void  __attribute__((noreturn)) AppMain(void) {
 
         int ret = receive_ng(&rx);
         if (ret == PM3_SUCCESS) {
+            g_reply_seq = rx.seq;
             PacketReceived(&rx);
+            g_reply_seq = 0;
         } else if (ret != PM3_ENODATA) {
 
             Dbprintf("Error in frame reception: %d %s", ret, (ret == PM3_EIO) ? "PM3_EIO" : "");
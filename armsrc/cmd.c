@@ -26,6 +26,7 @@ bool g_reply_with_crc_on_fpc = true;
 // "Session" flag, to tell via which interface next msgs should be sent: USB or FPC USART
 bool g_reply_via_fpc = false;
 bool g_reply_via_usb = false;
+uint16_t g_reply_seq = 0;
 
 int reply_old(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const void *data, size_t len) {
     PacketResponseOLD txcmd = {CMD_UNKNOWN, {0, 0, 0}, {{0}}};
@@ -77,7 +78,7 @@ static int reply_ng_internal(uint16_t cmd, int8_t status, uint8_t reason, const
     size_t txBufferNGLen;
 
     // Compose the outgoing command frame
-    txBufferNG.pre.magic = RESPONSENG_PREAMBLE_MAGIC;
+    txBufferNG.pre.magic = (g_reply_seq) ? RESPONSENG_TAGGED_PREAMBLE_MAGIC : RESPONSENG_PREAMBLE_MAGIC;
     txBufferNG.pre.cmd = cmd;
     txBufferNG.pre.status = status;
     txBufferNG.pre.reason = reason;
@@ -96,17 +97,25 @@ static int reply_ng_internal(uint16_t cmd, int8_t status, uint8_t reason, const
         memcpy(txBufferNG.data, data, len);
     }
 
-    PacketResponseNGPostamble *tx_post = (PacketResponseNGPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketResponseNGPreamble) + len);
+    // tagged frames have the sequence number in front of the crc, and the crc covers it
+    size_t seqlen = 0;
+    if (g_reply_seq) {
+        PacketResponseNGTaggedPostamble *tx_tpost = (PacketResponseNGTaggedPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketResponseNGPreamble) + len);
+        tx_tpost->seq = g_reply_seq;
+        seqlen = sizeof(tx_tpost->seq);
+    }
+
+    PacketResponseNGPostamble *tx_post = (PacketResponseNGPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketResponseNGPreamble) + len + seqlen);
 
     // Note: if we send to both FPC & USB, we'll set CRC for both if any of them require CRC
     if ((g_reply_via_fpc && g_reply_with_crc_on_fpc) || ((g_reply_via_usb) && g_reply_with_crc_on_usb)) {
         uint8_t first, second;
-        compute_crc(CRC_14443_A, (uint8_t *)&txBufferNG, sizeof(PacketResponseNGPreamble) + len, &first, &second);
+        compute_crc(CRC_14443_A, (uint8_t *)&txBufferNG, sizeof(PacketResponseNGPreamble) + len + seqlen, &first, &second);
         tx_post->crc = ((first << 8) | second);
     } else {
         tx_post->crc = RESPONSENG_POSTAMBLE_MAGIC;
     }
-    txBufferNGLen = sizeof(PacketResponseNGPreamble) + len + sizeof(PacketResponseNGPostamble);
+    txBufferNGLen = sizeof(PacketResponseNGPreamble) + len + seqlen + sizeof(PacketResponseNGPostamble);
 
 #ifdef WITH_FPC_USART_HOST
     int resultfpc = PM3_EUNDEF;
@@ -177,10 +186,11 @@ static int receive_ng_internal(PacketCommandNG *rx, uint32_t read_ng(uint8_t *da
     rx->magic = rx_raw.pre.magic;
     rx->ng = rx_raw.pre.ng;
     rx->cmd = rx_raw.pre.cmd;
+    rx->seq = 0;
 
     uint16_t length = rx_raw.pre.length;
 
-    if (rx->magic == COMMANDNG_PREAMBLE_MAGIC) { // New style NG command
+    if (rx->magic == COMMANDNG_PREAMBLE_MAGIC || rx->magic == COMMANDNG_TAGGED_PREAMBLE_MAGIC) { // New style NG command
         if (length > PM3_CMD_DATA_SIZE) {
             return PM3_EOVFLOW;
         }
@@ -208,17 +218,31 @@ static int receive_ng_internal(PacketCommandNG *rx, uint32_t read_ng(uint8_t *da
             rx->length = length - sizeof(arg);
         }
 
-        // Get the postamble
-        bytes = read_ng((uint8_t *)&rx_raw.foopost, sizeof(PacketCommandNGPostamble));
-        if (bytes != sizeof(PacketCommandNGPostamble)) {
-            return PM3_EIO;
+        // Get the postamble, right behind the payload so the crc of tagged frames can cover the sequence number
+        size_t seqlen = 0;
+        PacketCommandNGPostamble *rx_post;
+        if (rx->magic == COMMANDNG_TAGGED_PREAMBLE_MAGIC) {
+            PacketCommandNGTaggedPostamble *rx_tpost = (PacketCommandNGTaggedPostamble *)(rx_raw.data + length);
+            bytes = read_ng((uint8_t *)rx_tpost, sizeof(PacketCommandNGTaggedPostamble));
+            if (bytes != sizeof(PacketCommandNGTaggedPostamble)) {
+                return PM3_EIO;
+            }
+            rx->seq = rx_tpost->seq;
+            seqlen = sizeof(rx_tpost->seq);
+            rx_post = (PacketCommandNGPostamble *)&rx_tpost->crc;
+        } else {
+            rx_post = (PacketCommandNGPostamble *)(rx_raw.data + length);
+            bytes = read_ng((uint8_t *)rx_post, sizeof(PacketCommandNGPostamble));
+            if (bytes != sizeof(PacketCommandNGPostamble)) {
+                return PM3_EIO;
+            }
         }
 
         // Check CRC, accept MAGIC as placeholder
-        rx->crc = rx_raw.foopost.crc;
+        rx->crc = rx_post->crc;
         if (rx->crc != COMMANDNG_POSTAMBLE_MAGIC) {
             uint8_t first, second;
-            compute_crc(CRC_14443_A, (uint8_t *)&rx_raw, sizeof(PacketCommandNGPreamble) + length, &first, &second);
+            compute_crc(CRC_14443_A, (uint8_t *)&rx_raw, sizeof(PacketCommandNGPreamble) + length + seqlen, &first, &second);
             if ((first << 8) + second != rx->crc) {
                 return PM3_EIO;
             }
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""
+PM3 JSON 2 Table
+
+This script takes the JSON lookup resources of the PM3 client and converts them
+to the built-in tables used by restable.c, so the client doesn't need to parse
+them with jansson every time a description is looked up.
+
+Note:
+    This script is used as a helper script to generate the restable_builtin.h file.
+    Run it again whenever one of the resources below is changed. When the file on
+    disk doesn't match the table any more the client falls back to parsing the
+    JSON, so a stale table is slower but never wrong.
+"""
+
+import os
+import json
+import argparse
+
+##############################################################################
+# Script version data: (Please increment when making updates)
+
+APP_NAME = 'PM3JSON2Table'
+
+VERSION_MAJOR = 1
+VERSION_MINOR = 0
+
+##############################################################################
+# Resources to convert
+#   name:   resources/<name>.json
+#   fields: the first one is the lookup key. When the root of the file is an
+#           object instead of an array, the key is the name of each member.
+#           The callers index the cells in this order, keep them in step.
+
+RESOURCES = [
+    {'name': 'aid_desfire', 'fields': ['AID', 'Vendor', 'Country', 'Name', 'Description', 'Type']},
+    {'name': 'aidlist', 'fields': ['AID', 'Vendor', 'Country', 'Name', 'Description', 'Type']},
+    {'name': 'mad', 'fields': ['mad', 'application', 'company', 'service_provider', 'system_integrator']},
+    {'name': 'oids', 'fields': ['oid', 'd', 'c']},
+]
+
+##############################################################################
+# Main Application Code:
+
+
+def fnv1a(data):
+    """32 bit FNV-1a, same as restable_hash() in restable.c"""
+    h = 0x811c9dc5
+    for b in data:
+        h ^= b
+        h = (h * 0x01000193) & 0xffffffff
+    return h
+
+
+def c_string(s):
+    """C string literal, non ASCII bytes escaped so the header stays ASCII"""
+    if s is None:
+        return 'NULL'
+    out = '"'
+    prev_hex = False
+    for b in s.encode('utf-8'):
+        c = chr(b)
+        if c in '"\\':
+            out += '\\' + c
+        elif c == '\n':
+            out += '\\n'
+        elif c == '?' and out.endswith('?'):
+            # no trigraphs
+            out += '\\?'
+        elif 0x20 <= b < 0x7f and not (prev_hex and c in '0123456789abcdefABCDEF'):
+            out += c
+        elif 0x20 <= b < 0x7f:
+            # a hex digit right after a \x escape would extend it
+            out += '""' + c
+        else:
+            out += '\\x%02x' % b
+            prev_hex = True
+            continue
+        prev_hex = False
+    return out + '"'
+
+
+def load_records(raw, fields):
+    """Records in file order, each one a list of strings or None, ordered as fields"""
+    root = json.loads(raw)
+    records = []
+    if isinstance(root, list):
+        items = root
+    else:
+        # object root, member name is the key. Non object members are skipped
+        items = []
+        for key, value in root.items():
+            if isinstance(value, dict):
+                items.append(dict(value, **{fields[0]: key}))
+
+    for item in items:
+        if not isinstance(item, dict):
+            continue
+        records.append([item.get(f) if isinstance(item.get(f), str) else None for f in fields])
+    return records
+
+
+def sort_key(record, idx):
+    """Same order as restable_cmp() in restable.c, ASCII case-insensitive then file order"""
+    key = record[0] or ''
+    return (key.encode('utf-8').lower(), idx)
+
+
+def convert(path, res):
+    name = res['name']
+    fields = res['fields']
+    with open(path, 'rb') as f:
+        raw = f.read()
+    records = load_records(raw, fields)
+    order = sorted(range(len(records)), key=lambda i: sort_key(records[i], i))
+
+    out = []
+    out.append(f'static const char *const restable_{name}_fields[] = {{')
+    out.append('    ' + ', '.join(c_string(f) for f in fields))
+    out.append('};')
+    out.append('')
+    out.append(f'static const char *const restable_{name}_cells[] = {{')
+    for r in records:
+        out.append('    ' + ', '.join(c_string(v) for v in r) + ',')
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint32_t restable_{name}_order[] = {{')
+    for i in range(0, len(order), 16):
+        out.append('    ' + ', '.join(str(x) for x in order[i:i + 16]) + ',')
+    out.append('};')
+    out.append('')
+
+    entry = (f'    {{ "{name}", restable_{name}_fields, {len(fields)}, restable_{name}_cells, '
+             f'restable_{name}_order, {len(records)}, {len(raw)}, 0x{fnv1a(raw):08x} }},')
+    return '\n'.join(out), entry
+
+
+def main():
+    """The main function for the script"""
+    args = build_arg_parser().parse_args()
+
+    tables = []
+    entries = []
+    for res in RESOURCES:
+        table, entry = convert(os.path.join(args.resources, res['name'] + '.json'), res)
+        tables.append(table)
+        entries.append(entry)
+
+    args.output_file.write("""//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// *DO NOT EDIT MANUALLY*
+// Autogenerated with pm3_json2table.py from client/resources
+//-----------------------------------------------------------------------------
+
+#ifndef RESTABLE_BUILTIN_H__
+#define RESTABLE_BUILTIN_H__
+
+#include "restable.h"
+
+""")
+    args.output_file.write('\n'.join(tables))
+    args.output_file.write('static const restable_t restable_builtin[] = {\n')
+    args.output_file.write('\n'.join(entries) + '\n')
+    args.output_file.write('};\n\n#endif\n')
+
+
+def build_arg_parser():
+    """Build and return the argument parser."""
+    parser = argparse.ArgumentParser(
+        description='Convert the PM3 JSON resources to built-in lookup tables.')
+    parser.add_argument('resources', help='Resources directory, client/resources')
+    parser.add_argument('output_file', type=argparse.FileType('w'), help='Destination for the tables, - for stdout.')
+    parser.add_argument('--version', action='version', version=get_version())
+    return parser
+
+
+def get_version():
+    """Return the version string."""
+    return f'{APP_NAME} v{VERSION_MAJOR}.{VERSION_MINOR}'
+
+
+if __name__ == '__main__':
+    main()
@@ -21,99 +21,50 @@
 #include "fileutils.h"
 #include "pm3_cmd.h"
 
-static int openAIDFile(json_t **root, bool verbose) {
-    json_error_t error;
-
-    char *path;
-    int res = searchFile(&path, RESOURCES_SUBDIR, "aidlist", ".json", false);
-    if (res != PM3_SUCCESS) {
-        return PM3_EFILE;
-    }
-
-    int retval = PM3_SUCCESS;
-    *root = json_load_file(path, 0, &error);
-    if (!*root) {
-        PrintAndLogEx(ERR, "json (%s) error on line %d: %s", path, error.line, error.text);
-        retval = PM3_ESOFT;
-        goto out;
-    }
-
-    if (!json_is_array(*root)) {
-        PrintAndLogEx(ERR, "Invalid json (%s) format. root must be an array.", path);
-        retval = PM3_ESOFT;
-        goto out;
-    }
-
-    PrintAndLogEx(DEBUG, "Loaded file " _YELLOW_("%s") " " _GREEN_("%zu") " records ( " _GREEN_("ok") " )"
-                  , path
-                  , json_array_size(*root)
-                 );
-out:
-    free(path);
-    return retval;
-}
-
-static int closeAIDFile(json_t *root) {
-    json_decref(root);
-    return PM3_SUCCESS;
+// cells of the aidlist table, as listed in pm3_json2table.py
+enum {
+    AID_CELL_AID,
+    AID_CELL_VENDOR,
+    AID_CELL_COUNTRY,
+    AID_CELL_NAME,
+    AID_CELL_DESCRIPTION,
+    AID_CELL_TYPE,
+};
+
+// the table is built once, later calls only check the file didn't change
+const restable_t *AIDSearchInit(bool verbose) {
+    return restable_open("aidlist", false);
 }
 
-json_t *AIDSearchInit(bool verbose) {
-    json_t *root = NULL;
-    int res = openAIDFile(&root, verbose);
-    if (res != PM3_SUCCESS)
-        return NULL;
-
-    return root;
-}
-
-json_t *AIDSearchGetElm(json_t *root, size_t elmindx) {
-    json_t *data = json_array_get(root, elmindx);
-    if (!json_is_object(data)) {
-        PrintAndLogEx(ERR, "data [%zu] is not an object\n", elmindx);
-        return NULL;
-    }
-    return data;
-}
-
-int AIDSearchFree(json_t *root) {
-    return closeAIDFile(root);
-}
-
-static const char *jsonStrGet(json_t *data, const char *name) {
-    json_t *jstr;
-
-    jstr = json_object_get(data, name);
-    if (jstr == NULL) {
-        return NULL;
-    }
-
-    if (!json_is_string(jstr)) {
-        PrintAndLogEx(ERR, "`%s` is not a string", name);
-        return NULL;
-    }
-
-    const char *cstr = json_string_value(jstr);
-    if (strlen(cstr) == 0) {
+static const char *aidStrGet(const restable_t *root, size_t elmindx, int cell) {
+    const char *cstr = restable_get(root, elmindx, cell);
+    if (cstr == NULL || strlen(cstr) == 0) {
         return NULL;
     }
     return cstr;
 }
 
-static bool aidCompare(const char *aidlarge, const char *aidsmall) {
-    if (strcmp(aidlarge, aidsmall) == 0)
-        return true;
-
-    if (strlen(aidlarge) > strlen(aidsmall))
-        if (strncmp(aidlarge, aidsmall, strlen(aidsmall)) == 0)
-            return true;
-
-    return false;
+// The longest AID of the list that aid starts with, the first one in the file
+// when there are several. Every prefix of aid is looked up in the sorted index,
+// longest first.
+static int aidLongestPrefix(const restable_t *root, const char *aid) {
+    size_t len = strlen(aid);
+    char prefix[len + 1];
+    memcpy(prefix, aid, len + 1);
+
+    for (size_t n = len; n > 0; n--) {
+        prefix[n] = '\0';
+        int elmindx = restable_find_case(root, prefix);
+        if (elmindx >= 0) {
+            return elmindx;
+        }
+    }
+    return -1;
 }
 
-bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen) {
+bool AIDGetFromElm(const restable_t *root, size_t elmindx, uint8_t *aid, size_t aidmaxlen, int *aidlen) {
     *aidlen = 0;
-    const char *hexaid = jsonStrGet(data, "AID");
+    const char *hexaid = aidStrGet(root, elmindx, AID_CELL_AID);
     if (hexaid == NULL || strlen(hexaid) == 0)
         return false;
 
@@ -124,44 +75,28 @@ bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen) {
     return true;
 }
 
-int PrintAIDDescription(json_t *xroot, char *aid, bool verbose) {
-    int retval = PM3_SUCCESS;
+int PrintAIDDescription(const restable_t *xroot, char *aid, bool verbose) {
 
-    json_t *root = xroot;
+    const restable_t *root = xroot;
     if (root == NULL) {
         root = AIDSearchInit(verbose);
     }
-    if (root == NULL) {
-        goto out;
+    if (root == NULL || aid == NULL) {
+        return PM3_SUCCESS;
     }
 
-    json_t *elm = NULL;
-    size_t maxaidlen = 0;
-    for (size_t elmindx = 0; elmindx < json_array_size(root); elmindx++) {
-        json_t *data = AIDSearchGetElm(root, elmindx);
-        if (data == NULL) {
-            continue;
-        }
-        const char *dictaid = jsonStrGet(data, "AID");
-        if (aidCompare(aid, dictaid)) {  // dictaid may be less length than requested aid
-            if (maxaidlen < strlen(dictaid) && strlen(dictaid) <= strlen(aid)) {
-                maxaidlen = strlen(dictaid);
-                elm = data;
-            }
-        }
-    }
-
-    if (elm == NULL) {
-        goto out;
+    int elmindx = aidLongestPrefix(root, aid);
+    if (elmindx < 0) {
+        return PM3_SUCCESS;
     }
 
     // print here
-    const char *vaid = jsonStrGet(elm, "AID");
-    const char *vendor = jsonStrGet(elm, "Vendor");
-    const char *name = jsonStrGet(elm, "Name");
-    const char *country = jsonStrGet(elm, "Country");
-    const char *description = jsonStrGet(elm, "Description");
-    const char *type = jsonStrGet(elm, "Type");
+    const char *vaid = aidStrGet(root, elmindx, AID_CELL_AID);
+    const char *vendor = aidStrGet(root, elmindx, AID_CELL_VENDOR);
+    const char *name = aidStrGet(root, elmindx, AID_CELL_NAME);
+    const char *country = aidStrGet(root, elmindx, AID_CELL_COUNTRY);
+    const char *description = aidStrGet(root, elmindx, AID_CELL_DESCRIPTION);
+    const char *type = aidStrGet(root, elmindx, AID_CELL_TYPE);
 
     if (verbose == false) {
         PrintAndLogEx(SUCCESS, "AID : " _YELLOW_("%s") " | %s | %s", vaid, vendor, name);
@@ -180,15 +115,10 @@ int PrintAIDDescription(json_t *xroot, char *aid, bool verbose) {
         if (description)
             PrintAndLogEx(SUCCESS, "Description... %s", description);
     }
-
-out:
-    if (xroot == NULL) {
-        AIDSearchFree(root);
-    }
-    return retval;
+    return PM3_SUCCESS;
 }
 
-int PrintAIDDescriptionBuf(json_t *root, uint8_t *aid, size_t aidlen, bool verbose) {
+int PrintAIDDescriptionBuf(const restable_t *root, uint8_t *aid, size_t aidlen, bool verbose) {
     return PrintAIDDescription(root, sprint_hex_inrow(aid, aidlen), verbose);
 }
 
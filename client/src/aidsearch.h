@@ -23,13 +23,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "jansson.h"
+#include "restable.h"
 
-int PrintAIDDescription(json_t *xroot, char *aid, bool verbose);
-int PrintAIDDescriptionBuf(json_t *root, uint8_t *aid, size_t aidlen, bool verbose);
-json_t *AIDSearchInit(bool verbose);
-json_t *AIDSearchGetElm(json_t *root, size_t elmindx);
-bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen);
-int AIDSearchFree(json_t *root);
+int PrintAIDDescription(const restable_t *xroot, char *aid, bool verbose);
+int PrintAIDDescriptionBuf(const restable_t *root, uint8_t *aid, size_t aidlen, bool verbose);
+const restable_t *AIDSearchInit(bool verbose);
+bool AIDGetFromElm(const restable_t *root, size_t elmindx, uint8_t *aid, size_t aidmaxlen, int *aidlen);
 
 #endif
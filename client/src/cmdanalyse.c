@@ -1036,6 +1036,10 @@ static int CmdAnalyseFoo(const char *Cmd) {
 
     ClearGraph(false);
     g_GraphTraceLen = 15000;
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
 
     for (int i = 0; i < 4095; i++) {
         int o = 0;
@@ -1048,7 +1052,7 @@ static int CmdAnalyseFoo(const char *Cmd) {
         if (i & 0x0E00) o |= 0x20;    // corr_i_accum[12] | corr_i_accum[11] | corr_i_accum[9],
         o |= (i & 0x1F0) >> 4;        // corr_i_accum[8:4]
 
-        g_GraphBuffer[i] = o;
+        gb[i] = o;
     }
 
     for (int i = 0; i < 4095; i++) {
@@ -1065,12 +1069,12 @@ static int CmdAnalyseFoo(const char *Cmd) {
                 o |= 0x7f;     //  corr_i_out <= 8'b01111111;
             }
         }
-        g_GraphBuffer[i + 5000] = o;
+        gb[i + 5000] = o;
     }
 
     for (int i = 0; i < 4095; i++) {
         int o = i >> 5;
-        g_GraphBuffer[i + 10000] = o;
+        gb[i + 10000] = o;
     }
 
     RepaintGraphWindow();
@@ -42,6 +42,9 @@
 #include "mbedtls/ctr_drbg.h"    // random generator
 #include "atrs.h"                // ATR lookup
 #include "crypto/libpcrypto.h"   // Cryptography
+#include "fft.h"                 // autocorrelation
+#include "sigfile.h"             // binary trace files
+#include "filterpipe.h"          // fused graph filters
 
 
 uint8_t g_DemodBuffer[MAX_DEMOD_BUF_LEN] = { 0x00 };
@@ -94,6 +97,12 @@ static char *commaprint(size_t n) {
 
 // set the g_DemodBuffer with given array ofq binary (one bit per byte)
 void setDemodBuff(const uint8_t *buff, size_t size, size_t start_idx) {
+    demod_ctx_t dctx;
+    setDemodBuff_ctx(demod_ctx_main_get(&dctx), buff, size, start_idx);
+    demod_ctx_main_put(&dctx);
+}
+
+void setDemodBuff_ctx(demod_ctx_t *dctx, const uint8_t *buff, size_t size, size_t start_idx) {
     if (buff == NULL) {
         return;
     }
@@ -103,20 +112,27 @@ void setDemodBuff(const uint8_t *buff, size_t size, size_t start_idx) {
     }
 
     for (size_t i = 0; i < size; i++) {
-        g_DemodBuffer[i] = buff[start_idx++];
+        dctx->demod[i] = buff[start_idx++];
     }
 
-    g_DemodBufferLen = size;
+    dctx->demod_len = size;
 }
 
 bool getDemodBuff(uint8_t *buff, size_t *size) {
+    demod_ctx_t dctx;
+    bool res = getDemodBuff_ctx(demod_ctx_main_get(&dctx), buff, size);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+bool getDemodBuff_ctx(demod_ctx_t *dctx, uint8_t *buff, size_t *size) {
     if (buff == NULL) return false;
     if (size == NULL) return false;
     if (*size == 0) return false;
 
-    *size = (*size > g_DemodBufferLen) ? g_DemodBufferLen : *size;
+    *size = (*size > dctx->demod_len) ? dctx->demod_len : *size;
 
-    memcpy(buff, g_DemodBuffer, *size);
+    memcpy(buff, dctx->demod, *size);
     return true;
 }
 
@@ -153,51 +169,6 @@ static double median_uint8(uint8_t *src, size_t size) {
     return 0.5 * (src[size / 2] + src[(size - 1) / 2]);
 }
 */
-// function to compute mean for a series
-static double compute_mean(const int *data, size_t n) {
-    double mean = 0.0;
-    for (size_t i = 0; i < n; i++)
-        mean += data[i];
-    mean /= n;
-    return mean;
-}
-
-//  function to compute variance for a series
-static double compute_variance(const int *data, size_t n) {
-    double variance = 0.0;
-    double mean = compute_mean(data, n);
-
-    for (size_t i = 0; i < n; i++)
-        variance += pow((data[i] - mean), 2.0);
-
-    variance /= n;
-    return variance;
-}
-
-// Function to compute autocorrelation for a series
-//  Author: Kenneth J. Christensen
-//  - Corrected divide by n to divide (n - lag) from Tobias Mueller
-/*
-static double compute_autoc(const int *data, size_t n, int lag) {
-    double autocv = 0.0;    // Autocovariance value
-    double ac_value;        // Computed autocorrelation value to be returned
-    double variance;        // Computed variance
-    double mean;
-
-    mean = compute_mean(data, n);
-    variance = compute_variance(data, n);
-
-    for (size_t i=0; i < (n - lag); i++)
-        autocv += (data[i] - mean) * (data[i+lag] - mean);
-
-    autocv = (1.0 / (n - lag)) * autocv;
-
-    // Autocorrelation is autocovariance divided by variance
-    ac_value = autocv / variance;
-    return ac_value;
-}
-*/
-
 static int CmdSetDebugMode(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "data setdebugmode",
@@ -250,7 +221,14 @@ static int CmdSetDebugMode(const char *Cmd) {
 // max output to MAX_DEMODULATION_BITS bits if we have more
 // doesn't take inconsideration where the demod offset or bitlen found.
 int printDemodBuff(uint8_t offset, bool strip_leading, bool invert, bool print_hex) {
-    size_t len = g_DemodBufferLen;
+    demod_ctx_t dctx;
+    int res = printDemodBuff_ctx(demod_ctx_main_get(&dctx), offset, strip_leading, invert, print_hex);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int printDemodBuff_ctx(demod_ctx_t *dctx, uint8_t offset, bool strip_leading, bool invert, bool print_hex) {
+    size_t len = dctx->demod_len;
     if (len == 0) {
         PrintAndLogEx(WARNING, "DemodBuffer is empty");
         return PM3_EINVARG;
@@ -261,15 +239,15 @@ int printDemodBuff(uint8_t offset, bool strip_leading, bool invert, bool print_h
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    memcpy(buf, g_DemodBuffer, len);
+    memcpy(buf, dctx->demod, len);
 
     uint8_t *p = NULL;
 
     if (strip_leading) {
         p = (buf + offset);
 
-        if (len > (g_DemodBufferLen - offset)) {
-            len = (g_DemodBufferLen - offset);
+        if (len > (dctx->demod_len - offset)) {
+            len = (dctx->demod_len - offset);
         }
 
         size_t i;
@@ -281,8 +259,8 @@ int printDemodBuff(uint8_t offset, bool strip_leading, bool invert, bool print_h
         offset += i;
     }
 
-    if (len > (g_DemodBufferLen - offset)) {
-        len = (g_DemodBufferLen - offset);
+    if (len > (dctx->demod_len - offset)) {
+        len = (dctx->demod_len - offset);
     }
 
     if (len > MAX_DEMODULATION_BITS)  {
@@ -371,8 +349,12 @@ int CmdGetBitStream(const char *Cmd) {
     CLIParserFree(ctx);
 
     CmdHpf("");
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
     for (uint32_t i = 0; i < g_GraphTraceLen; i++) {
-        g_GraphBuffer[i] = (g_GraphBuffer[i] >= 1) ? 1 : 0;
+        gb[i] = (gb[i] >= 1) ? 1 : 0;
     }
     RepaintGraphWindow();
     return PM3_SUCCESS;
@@ -407,6 +389,13 @@ static int CmdConvertBitStream(const char *Cmd) {
 // emSearch will auto search for EM410x format in bitstream
 // askType switches decode: ask/raw = 0, ask/manchester = 1
 int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType, bool *stCheck) {
+    demod_ctx_t dctx;
+    int res = ASKDemod_ext_ctx(demod_ctx_main_get(&dctx), clk, invert, maxErr, maxlen, amplify, verbose, emSearch, askType, stCheck);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int ASKDemod_ext_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType, bool *stCheck) {
     PrintAndLogEx(DEBUG, "DEBUG: (ASKDemod_ext) clk %i invert %i maxErr %i maxLen %zu amplify %i verbose %i emSearch %i askType %i "
                   , clk
                   , invert
@@ -428,7 +417,7 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBuffer_ctx(dctx, bits);
 
     PrintAndLogEx(DEBUG, "DEBUG: (ASKDemod_ext) #samples from graphbuff: %zu", bitlen);
 
@@ -459,8 +448,10 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
 
     if (st) {
         *stCheck = st;
-        g_MarkerC.pos = ststart;
-        g_MarkerD.pos = stend;
+        if (dctx->is_main) {
+            g_MarkerC.pos = ststart;
+            g_MarkerD.pos = stend;
+        }
         if (verbose)
             PrintAndLogEx(DEBUG, "Found Sequence Terminator - First one is shown by orange / blue graph markers");
     }
@@ -504,8 +495,8 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
     }
 
     //output
-    setDemodBuff(bits, bitlen, 0);
-    setClockGrid(clk, start_idx);
+    setDemodBuff_ctx(dctx, bits, bitlen, 0);
+    setClockGrid_ctx(dctx, clk, start_idx);
 
     if (verbose) {
         if (errCnt > 0)
@@ -519,20 +510,27 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
             PrintAndLogEx(INFO, "----------------------------------------");
         }
 
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
     uint64_t lo = 0;
     uint32_t hi = 0;
     if (emSearch)
-        AskEm410xDecode(true, &hi, &lo);
+        AskEm410xDecode_ctx(dctx, true, &hi, &lo);
 
     free(bits);
     return PM3_SUCCESS;
 }
 
 int ASKDemod(int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType) {
+    demod_ctx_t dctx;
+    int res = ASKDemod_ctx(demod_ctx_main_get(&dctx), clk, invert, maxErr, maxlen, amplify, verbose, emSearch, askType);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int ASKDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType) {
     bool st = false;
-    return ASKDemod_ext(clk, invert, maxErr, maxlen, amplify, verbose, emSearch, askType, &st);
+    return ASKDemod_ext_ctx(dctx, clk, invert, maxErr, maxlen, amplify, verbose, emSearch, askType, &st);
 }
 
 // takes 5 arguments - clock, invert, maxErr, maxLen as integers and amplify as char == 'a'
@@ -733,6 +731,13 @@ static int CmdBiphaseDecodeRaw(const char *Cmd) {
 
 // ASK Demod then Biphase decode g_GraphBuffer samples
 int ASKbiphaseDemod(int offset, int clk, int invert, int maxErr, bool verbose) {
+    demod_ctx_t dctx;
+    int res = ASKbiphaseDemod_ctx(demod_ctx_main_get(&dctx), offset, clk, invert, maxErr, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int ASKbiphaseDemod_ctx(demod_ctx_t *dctx, int offset, int clk, int invert, int maxErr, bool verbose) {
     //ask raw demod g_GraphBuffer first
 
     uint8_t *bs = calloc(MAX_DEMOD_BUF_LEN, sizeof(uint8_t));
@@ -741,7 +746,7 @@ int ASKbiphaseDemod(int offset, int clk, int invert, int maxErr, bool verbose) {
         return PM3_EMALLOC;
     }
 
-    size_t size = getFromGraphBufferEx(bs, MAX_DEMOD_BUF_LEN);
+    size_t size = getFromGraphBufferEx_ctx(dctx, bs, MAX_DEMOD_BUF_LEN);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: no data in graphbuf");
         free(bs);
@@ -772,12 +777,12 @@ int ASKbiphaseDemod(int offset, int clk, int invert, int maxErr, bool verbose) {
     if (offset >= 1) {
         offset -= 1;
     }
-    //success set g_DemodBuffer and return
-    setDemodBuff(bs, size, 0);
-    setClockGrid(clk, startIdx + clk * offset / 2);
+    //success set dctx->demod and return
+    setDemodBuff_ctx(dctx, bs, size, 0);
+    setClockGrid_ctx(dctx, clk, startIdx + clk * offset / 2);
     if (g_debugMode || verbose) {
         PrintAndLogEx(DEBUG, "Biphase Decoded using offset %d | clock %d | #errors %d | start index %d\ndata\n", offset, clk, errCnt, (startIdx + clk * offset / 2));
-        printDemodBuff(offset, false, false, false);
+        printDemodBuff_ctx(dctx, offset, false, false, false);
     }
     free(bs);
     return PM3_SUCCESS;
@@ -848,67 +853,71 @@ static int Cmdaskrawdemod(const char *Cmd) {
     return ASKDemod_ext(clk, invert, max_err, max_len, amplify, true, false, 0, &st);
 }
 
-int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose) {
+// lags correlating above this are considered repeats of the signal
+#define AUTOCORR_THRESHOLD 0.95
+
+// Autocorrelation over lags 0 .. len - window,  computed with a FFT.
+// Every run of lags correlating above the threshold is a peak (at its highest lag),
+// the shortest distance between two peaks of at least 128 samples is returned.
+int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool hann, bool SaveGrph, bool verbose) {
     // sanity check
     if (window > len) {
         window = len;
     }
 
-    //test
-    double autocv = 0.0;    // Autocovariance value
-    size_t correlation = 0;
-    int lastmax = 0;
-
-    // in, len, 4000
-    double mean = compute_mean(in, len);
-    // Computed variance
-    double variance = compute_variance(in, len);
+    size_t maxlag = len - window;
+    double *acov = calloc(maxlag + 1, sizeof(double));
+    double *acorr = calloc(maxlag + 1, sizeof(double));
+    if (acov == NULL || acorr == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(acov);
+        free(acorr);
+        return -1;
+    }
 
-    int *correl_buf = calloc(MAX_GRAPH_TRACE_LEN, sizeof(int));
+    if (maxlag < 2 || autocorrelate_fft(in, len, maxlag, hann, acov, acorr) != PM3_SUCCESS) {
+        maxlag = 0;
+    }
 
     uint8_t peak_cnt = 0;
     size_t peaks[10] = {0};
+    size_t lastpeak = 0;
 
-    for (size_t i = 0; i < len - window; ++i) {
-
-        for (size_t j = 0; j < (len - i); j++) {
-            autocv += (in[j] - mean) * (in[j + i] - mean);
-        }
-        autocv = (1.0 / (len - i)) * autocv;
-
-        correl_buf[i] = autocv;
+    // skip the run around lag 0
+    size_t i = 0;
+    while (i < maxlag && acorr[i] > AUTOCORR_THRESHOLD) {
+        i++;
+    }
 
-        // Computed autocorrelation value to be returned
-        // Autocorrelation is autocovariance divided by variance
-        double ac_value = autocv / variance;
+    while (i < maxlag && peak_cnt < ARRAYLEN(peaks)) {
 
-        // keep track of which distance is repeating.
-        // A value near 1.0 or more indicates a correlation in the signal
-        if (ac_value > 0.95f) {
-            correlation = i - lastmax;
-            lastmax = i;
+        if (acorr[i] <= AUTOCORR_THRESHOLD) {
+            i++;
+            continue;
+        }
 
-            if ((correlation > 1) && peak_cnt < ARRAYLEN(peaks)) {
-                peaks[peak_cnt++] = correlation;
+        size_t best = i;
+        for (; i < maxlag && acorr[i] > AUTOCORR_THRESHOLD; i++) {
+            if (acorr[i] > acorr[best]) {
+                best = i;
             }
         }
+
+        // keep track of which distance is repeating.
+        peaks[peak_cnt++] = best - lastpeak;
+        lastpeak = best;
     }
 
     // Find shorts distance between peaks
     int distance = -1;
-    for (size_t i = 0; i < ARRAYLEN(peaks); ++i) {
+    for (i = 0; i < peak_cnt; ++i) {
 
         PrintAndLogEx(DEBUG, "%zu | %zu", i, peaks[i]);
         if (peaks[i] < 128) {
             continue;
         }
 
-        if (distance == -1) {
-            distance = peaks[i];
-            continue;
-        }
-
-        if (peaks[i] < distance) {
+        if (distance == -1 || peaks[i] < distance) {
             distance = peaks[i];
         }
     }
@@ -919,18 +928,22 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
         }
     } else {
         PrintAndLogEx(HINT, "Hint: No repeating pattern found, try increasing window size");
+        free(acov);
+        free(acorr);
         // return value -1, indication to increase window size
         return -1;
     }
 
     if (SaveGrph) {
-        //g_GraphTraceLen = g_GraphTraceLen - window;
-        memcpy(out, correl_buf, len * sizeof(int));
+        for (i = 0; i < len; i++) {
+            out[i] = (i < maxlag) ? (int)acov[i] : 0;
+        }
         setClockGrid(distance, 0);
         g_DemodBufferLen = 0;
         RepaintGraphWindow();
     }
-    free(correl_buf);
+    free(acov);
+    free(acorr);
     return distance;
 }
 
@@ -940,17 +953,20 @@ static int CmdAutoCorr(const char *Cmd) {
                   "Autocorrelate over window is used to detect repeating sequences.\n"
                   "We use it as detection of how long in bits a message inside the signal is",
                   "data autocorr -w 4000\n"
-                  "data autocorr -w 4000 -g"
+                  "data autocorr -w 4000 -g\n"
+                  "data autocorr -w 4000 --hann"
                  );
     void *argtable[] = {
         arg_param_begin,
         arg_lit0("g", NULL, "save back to GraphBuffer (overwrite)"),
         arg_u64_0("w", "win", "<dec>", "window length for correlation. def 4000"),
+        arg_lit0(NULL, "hann", "taper samples with a Hann window (less leakage on short or noisy traces)"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     bool updateGrph = arg_get_lit(ctx, 1);
     uint32_t window = arg_get_u32_def(ctx, 2, 4000);
+    bool hann = arg_get_lit(ctx, 3);
     CLIParserFree(ctx);
 
     PrintAndLogEx(INFO, "Using window size " _YELLOW_("%u"), window);
@@ -966,7 +982,11 @@ static int CmdAutoCorr(const char *Cmd) {
         return PM3_EINVARG;
     }
 
-    AutoCorrelate(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, window, updateGrph, true);
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+    AutoCorrelate(gb, gb, g_GraphTraceLen, window, hann, updateGrph, true);
     return PM3_SUCCESS;
 }
 
@@ -992,12 +1012,17 @@ static int CmdBitsamples(const char *Cmd) {
         return PM3_ETIMEOUT;
     }
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t j = 0; j < ARRAYLEN(got); j++) {
         for (uint8_t k = 0; k < 8; k++) {
             if (got[j] & (1 << (7 - k)))
-                g_GraphBuffer[cnt++] = 1;
+                gb[cnt++] = 1;
             else
-                g_GraphBuffer[cnt++] = 0;
+                gb[cnt++] = 0;
         }
     }
     g_GraphTraceLen = cnt;
@@ -1043,8 +1068,13 @@ static int CmdDecimate(const char *Cmd) {
     int n = arg_get_int_def(ctx, 1, 2);
     CLIParserFree(ctx);
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t i = 0; i < (g_GraphTraceLen / n); ++i)
-        g_GraphBuffer[i] = g_GraphBuffer[i * n];
+        gb[i] = gb[i * n];
 
     g_GraphTraceLen /= n;
     PrintAndLogEx(SUCCESS, "decimated by " _GREEN_("%u"), n);
@@ -1075,6 +1105,11 @@ static int CmdUndecimate(const char *Cmd) {
     int factor = arg_get_int_def(ctx, 1, 2);
     CLIParserFree(ctx);
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     //We have memory, don't we?
     int *swap = calloc(MAX_GRAPH_TRACE_LEN, sizeof(int));
     if (swap == NULL) {
@@ -1086,15 +1121,15 @@ static int CmdUndecimate(const char *Cmd) {
         int count = 0;
         for (count = 0; count < factor && s_index + count < MAX_GRAPH_TRACE_LEN; count++) {
             swap[s_index + count] = (
-                                        (double)(factor - count) / (factor - 1)) * g_GraphBuffer[g_index] +
-                                    ((double)count / factor) * g_GraphBuffer[g_index + 1]
+                                        (double)(factor - count) / (factor - 1)) * gb[g_index] +
+                                    ((double)count / factor) * gb[g_index + 1]
                                     ;
         }
         s_index += count;
         g_index++;
     }
 
-    memcpy(g_GraphBuffer, swap, s_index * sizeof(int));
+    memcpy(gb, swap, s_index * sizeof(int));
     g_GraphTraceLen = s_index;
     RepaintGraphWindow();
     free(swap);
@@ -1119,14 +1154,19 @@ static int CmdGraphShiftZero(const char *Cmd) {
     int shift = arg_get_int_def(ctx, 1, 0);
     CLIParserFree(ctx);
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t i = 0; i < g_GraphTraceLen; i++) {
-        int shiftedVal = g_GraphBuffer[i] + shift;
+        int shiftedVal = gb[i] + shift;
 
         if (shiftedVal > 127)
             shiftedVal = 127;
         else if (shiftedVal < -127)
             shiftedVal = -127;
-        g_GraphBuffer[i] = shiftedVal;
+        gb[i] = shiftedVal;
     }
     CmdNorm("");
     return PM3_SUCCESS;
@@ -1165,7 +1205,11 @@ static int CmdAskEdgeDetect(const char *Cmd) {
     CLIParserFree(ctx);
 
     PrintAndLogEx(INFO, "using threshold " _YELLOW_("%i"), threshold);
-    int res = AskEdgeDetect(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, threshold);
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+    int res = AskEdgeDetect(gb, gb, g_GraphTraceLen, threshold);
     RepaintGraphWindow();
     return res;
 }
@@ -1265,6 +1309,13 @@ static char *GetFSKType(uint8_t fchigh, uint8_t fclow, uint8_t invert) {
 // takes 4 arguments - Clock, invert, fchigh, fclow
 // defaults: clock = 50, invert=1, fchigh=10, fclow=8 (RF/10 RF/8 (fsk2a))
 int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bool verbose) {
+    demod_ctx_t dctx;
+    int res = FSKrawDemod_ctx(demod_ctx_main_get(&dctx), rfLen, invert, fchigh, fclow, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int FSKrawDemod_ctx(demod_ctx_t *dctx, uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bool verbose) {
     //raw fsk demod  no manchester decoding no start bit finding just get binary from wave
     if (getSignalProperties()->isnoise) {
         if (verbose) {
@@ -1279,7 +1330,7 @@ int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bo
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBuffer_ctx(dctx, bits);
     if (bitlen == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: no data in graphbuf");
         free(bits);
@@ -1307,8 +1358,8 @@ int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bo
     int start_idx = 0;
     int size = fskdemod(bits, bitlen, rfLen, invert, fchigh, fclow, &start_idx);
     if (size > 0) {
-        setDemodBuff(bits, size, 0);
-        setClockGrid(rfLen, start_idx);
+        setDemodBuff_ctx(dctx, bits, size, 0);
+        setClockGrid_ctx(dctx, rfLen, start_idx);
 
         // Now output the bitstream to the scrollback by line of 16 bits
         if (verbose || g_debugMode) {
@@ -1321,7 +1372,7 @@ int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bo
             PrintAndLogEx(NORMAL, "");
             PrintAndLogEx(SUCCESS, _YELLOW_("%s") " decoded bitstream", GetFSKType(fchigh, fclow, invert));
             PrintAndLogEx(INFO, "-----------------------");
-            printDemodBuff(0, false, false, false);
+            printDemodBuff_ctx(dctx, 0, false, false, false);
         }
         goto out;
     } else {
@@ -1369,6 +1420,13 @@ static int CmdFSKrawdemod(const char *Cmd) {
 
 // attempt to psk1 demod graph buffer
 int PSKDemod(int clk, int invert, int maxErr, bool verbose) {
+    demod_ctx_t dctx;
+    int res = PSKDemod_ctx(demod_ctx_main_get(&dctx), clk, invert, maxErr, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int PSKDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, bool verbose) {
     if (getSignalProperties()->isnoise) {
         if (verbose) {
             PrintAndLogEx(INFO, "signal looks like noise");
@@ -1381,7 +1439,7 @@ int PSKDemod(int clk, int invert, int maxErr, bool verbose) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBuffer_ctx(dctx, bits);
     if (bitlen == 0) {
         free(bits);
         return PM3_ESOFT;
@@ -1405,9 +1463,9 @@ int PSKDemod(int clk, int invert, int maxErr, bool verbose) {
             PrintAndLogEx(DEBUG, "DEBUG: (PSKdemod) errors during Demoding (shown as 7 in bit stream): %d", errCnt);
         }
     }
-    //prime g_DemodBuffer for output
-    setDemodBuff(bits, bitlen, 0);
-    setClockGrid(clk, startIdx);
+    //prime dctx->demod for output
+    setDemodBuff_ctx(dctx, bits, bitlen, 0);
+    setClockGrid_ctx(dctx, clk, startIdx);
     free(bits);
     return PM3_SUCCESS;
 }
@@ -1416,6 +1474,13 @@ int PSKDemod(int clk, int invert, int maxErr, bool verbose) {
 // attempts to demodulate nrz only
 // prints binary found and saves in g_DemodBuffer for further commands
 int NRZrawDemod(int clk, int invert, int maxErr, bool verbose) {
+    demod_ctx_t dctx;
+    int res = NRZrawDemod_ctx(demod_ctx_main_get(&dctx), clk, invert, maxErr, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int NRZrawDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, bool verbose) {
 
     int errCnt = 0, clkStartIdx = 0;
 
@@ -1432,7 +1497,7 @@ int NRZrawDemod(int clk, int invert, int maxErr, bool verbose) {
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBuffer_ctx(dctx, bits);
 
     if (bitlen == 0) {
         free(bits);
@@ -1452,9 +1517,9 @@ int NRZrawDemod(int clk, int invert, int maxErr, bool verbose) {
     }
 
     if (verbose || g_debugMode) PrintAndLogEx(DEBUG, "DEBUG: (NRZrawDemod) Tried NRZ Demod using Clock: %d - invert: %d - Bits Found: %zu", clk, invert, bitlen);
-    //prime g_DemodBuffer for output
-    setDemodBuff(bits, bitlen, 0);
-    setClockGrid(clk, clkStartIdx);
+    //prime dctx->demod for output
+    setDemodBuff_ctx(dctx, bits, bitlen, 0);
+    setClockGrid_ctx(dctx, clk, clkStartIdx);
 
 
     if (errCnt > 0 && (verbose || g_debugMode)) PrintAndLogEx(DEBUG, "DEBUG: (NRZrawDemod) Errors during Demoding (shown as 7 in bit stream): %d", errCnt);
@@ -1462,7 +1527,7 @@ int NRZrawDemod(int clk, int invert, int maxErr, bool verbose) {
         PrintAndLogEx(SUCCESS, "NRZ demoded bitstream");
         PrintAndLogEx(INFO, "---------------------");
         // Now output the bitstream to the scrollback by line of 16 bits
-        printDemodBuff(0, false, invert, false);
+        printDemodBuff_ctx(dctx, 0, false, invert, false);
     }
 
     free(bits);
@@ -1648,13 +1713,28 @@ static int CmdRawDemod(const char *Cmd) {
 }
 
 void setClockGrid(uint32_t clk, int offset) {
-    g_DemodStartIdx = offset;
-    g_DemodClock = clk;
+    demod_ctx_t dctx;
+    setClockGrid_ctx(demod_ctx_main_get(&dctx), clk, offset);
+    demod_ctx_main_put(&dctx);
+}
+
+void setClockGrid_ctx(demod_ctx_t *dctx, uint32_t clk, int offset) {
+    dctx->demod_start_idx = offset;
+    dctx->demod_clock = clk;
     if (clk == 0 && offset == 0)
         PrintAndLogEx(DEBUG, "DEBUG: (setClockGrid) clear settings");
     else
         PrintAndLogEx(DEBUG, "DEBUG: (setClockGrid) demodoffset %d, clk %d", offset, clk);
 
+    // a private demod context isn't plotted
+    if (dctx->is_main == false) return;
+
+    setPlotGrid(clk, offset);
+}
+
+// lock the plot grid to a demodulated clock,  clk 0 unlocks it
+void setPlotGrid(uint32_t clk, int offset) {
+    if (clk == 0) offset = 0;
     if (offset > clk) offset %= clk;
     if (offset < 0) offset += clk;
 
@@ -1809,21 +1889,10 @@ int CmdHpf(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-    size_t size = getFromGraphBuffer(bits);
-    removeSignalOffset(bits, size);
-    // push it back to graph
-    setGraphBuffer(bits, size);
-    // set signal properties low/high/mean/amplitude and is_noise detection
-    computeSignalProperties(bits, size);
-
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_HPF, 0, 0);
+    return filterpipe_run_graph(&fp);
 }
 
 static bool _headBit(BitstreamOut_t *stream) {
@@ -1887,6 +1956,9 @@ int getSamplesEx(uint32_t start, uint32_t end, bool verbose, bool ignore_lf_conf
             PrintAndLogEx(INFO, "Samples @ " _YELLOW_("%d") " bits/smpl, decimation 1:%d ", sc.bits_per_sample, sc.decimation);
         }
         bits_per_sample = sc.bits_per_sample;
+        sigfile_set_capture(&sc, "device lf");
+    } else {
+        sigfile_set_capture(NULL, "device");
     }
 
     return getSamplesFromBufEx(got, n, bits_per_sample, verbose);;
@@ -1894,7 +1966,13 @@ int getSamplesEx(uint32_t start, uint32_t end, bool verbose, bool ignore_lf_conf
 
 int getSamplesFromBufEx(uint8_t *data, size_t sample_num, uint8_t bits_per_sample, bool verbose) {
 
-    size_t max_num = MIN(sample_num, MAX_GRAPH_TRACE_LEN);
+    size_t max_num = MIN(sample_num, GRAPH_TRACE_LEN_LIMIT);
+
+    // raw 8 bit samples,  kept one byte per sample in the graph
+    uint8_t *samples = graph_reset_u8(max_num, 127);
+    if (samples == NULL) {
+        return PM3_EMALLOC;
+    }
 
     if (bits_per_sample < 8) {
 
@@ -1903,18 +1981,13 @@ int getSamplesFromBufEx(uint8_t *data, size_t sample_num, uint8_t bits_per_sampl
         BitstreamOut_t bout = {data, bits_per_sample * sample_num,  0};
         size_t j = 0;
         for (j = 0; j < max_num; j++) {
-            uint8_t sample = getByte(bits_per_sample, &bout);
-            g_GraphBuffer[j] = ((int) sample) - 127;
+            samples[j] = getByte(bits_per_sample, &bout);
         }
-        g_GraphTraceLen = j;
 
         if (verbose) PrintAndLogEx(INFO, "Unpacked %zu samples", j);
 
     } else {
-        for (size_t j = 0; j < max_num; j++) {
-            g_GraphBuffer[j] = ((int)data[j]) - 127;
-        }
-        g_GraphTraceLen = max_num;
+        memcpy(samples, data, max_num);
     }
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
@@ -1961,8 +2034,13 @@ static int CmdLoad(const char *Cmd) {
 
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "data load",
-                  "This command loads the contents of a pm3 file into graph window\n",
-                  "data load -f myfilename"
+                  "This command loads the contents of a pm3 file into graph window\n"
+                  "Binary trace files (" SIGFILE_EXT ") are recognized and loaded as they are.\n"
+                  "Unless `--no-fix` is given the signal offset is removed, which takes a pass\n"
+                  "over all samples and a private copy of them. With `--no-fix` an uncompressed\n"
+                  "8 bit " SIGFILE_EXT " file is used straight from the file instead",
+                  "data load -f myfilename\n"
+                  "data load -f myfilename.pm3b"
                  );
 
     void *argtable[] = {
@@ -1988,6 +2066,15 @@ static int CmdLoad(const char *Cmd) {
         }
     }
 
+    if (sigfile_is_sigfile(path)) {
+        int res = sigfile_load(path);
+        free(path);
+        if (res != PM3_SUCCESS) {
+            return res;
+        }
+        goto loaded;
+    }
+
     FILE *f;
     if (is_bin)
         f = fopen(path, "rb");
@@ -1999,32 +2086,49 @@ static int CmdLoad(const char *Cmd) {
         free(path);
         return PM3_EFILE;
     }
+    sigfile_set_capture(NULL, filename);
     free(path);
 
     g_GraphTraceLen = 0;
 
     if (is_bin) {
-        uint8_t val[2];
-        while (fread(val, 1, 1, f)) {
-            g_GraphBuffer[g_GraphTraceLen] = val[0] - 127;
-            g_GraphTraceLen++;
-
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN) {
-                break;
-            }
+        // raw 8 bit samples,  kept one byte per sample
+        fseek(f, 0, SEEK_END);
+        long fsize = ftell(f);
+        fseek(f, 0, SEEK_SET);
+
+        size_t n = (fsize > 0) ? MIN((size_t)fsize, GRAPH_TRACE_LEN_LIMIT) : 0;
+        uint8_t *samples = graph_reset_u8(n, 127);
+        if (samples == NULL) {
+            fclose(f);
+            return PM3_EMALLOC;
         }
+        g_GraphTraceLen = fread(samples, 1, n, f);
     } else {
         char line[80];
-        while (fgets(line, sizeof(line), f)) {
-            g_GraphBuffer[g_GraphTraceLen] = atoi(line);
-            g_GraphTraceLen++;
+        size_t cap = MAX_GRAPH_TRACE_LEN;
+        int32_t *gb = graph_reserve(cap);
+        while (gb && fgets(line, sizeof(line), f)) {
 
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN)
-                break;
+            if (g_GraphTraceLen >= cap) {
+                if (cap >= GRAPH_TRACE_LEN_LIMIT) {
+                    break;
+                }
+                cap = MIN(cap * 2, GRAPH_TRACE_LEN_LIMIT);
+                gb = graph_reserve(cap);
+                if (gb == NULL) {
+                    break;
+                }
+            }
+
+            gb[g_GraphTraceLen] = atoi(line);
+            g_GraphTraceLen++;
         }
+        graph_compact();
     }
     fclose(f);
 
+loaded:
     PrintAndLogEx(SUCCESS, "loaded " _YELLOW_("%s") " samples", commaprint(g_GraphTraceLen));
 
     if (nofix == false) {
@@ -2033,7 +2137,7 @@ static int CmdLoad(const char *Cmd) {
             PrintAndLogEx(WARNING, "Failed to allocate memory");
             return PM3_EMALLOC;
         }
-        size_t size = getFromGraphBuffer(bits);
+        size_t size = getFromGraphBufferEx(bits, g_GraphTraceLen);
 
         removeSignalOffset(bits, size);
         setGraphBuffer(bits, size);
@@ -2063,18 +2167,32 @@ int CmdLtrim(const char *Cmd) {
     uint32_t ds = arg_get_u32(ctx, 1);
     CLIParserFree(ctx);
 
+    demod_ctx_t dctx;
+    int res = ltrim_ctx(demod_ctx_main_get(&dctx), ds);
+    demod_ctx_main_put(&dctx);
+    if (res == PM3_SUCCESS) {
+        RepaintGraphWindow();
+    }
+    return res;
+}
+
+int ltrim_ctx(demod_ctx_t *dctx, uint32_t ds) {
     // sanitycheck
-    if (g_GraphTraceLen <= ds) {
+    if (dctx->graph_len <= ds) {
         PrintAndLogEx(WARNING, "index out of bounds");
         return PM3_EINVARG;
     }
 
-    for (size_t i = ds; i < g_GraphTraceLen; ++i) {
-        g_GraphBuffer[i - ds] = g_GraphBuffer[i];
+    int32_t *gb = graph_write_ctx(dctx);
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    for (size_t i = ds; i < dctx->graph_len; ++i) {
+        gb[i - ds] = gb[i];
     }
-    g_GraphTraceLen -= ds;
-    g_DemodStartIdx -= ds;
-    RepaintGraphWindow();
+    dctx->graph_len -= ds;
+    dctx->demod_start_idx -= ds;
     return PM3_SUCCESS;
 }
 
@@ -2136,9 +2254,14 @@ static int CmdMtrim(const char *Cmd) {
     // leave start position sample
     start++;
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     g_GraphTraceLen = stop - start;
     for (uint32_t i = 0; i < g_GraphTraceLen; i++) {
-        g_GraphBuffer[i] = g_GraphBuffer[start + i];
+        gb[i] = gb[start + i];
     }
 
     g_DemodStartIdx = 0;
@@ -2160,33 +2283,11 @@ int CmdNorm(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    int max = INT_MIN, min = INT_MAX;
-
-    // Find local min, max
-    for (uint32_t i = 10; i < g_GraphTraceLen; ++i) {
-        if (g_GraphBuffer[i] > max) max = g_GraphBuffer[i];
-        if (g_GraphBuffer[i] < min) min = g_GraphBuffer[i];
-    }
-
-    if ((g_GraphTraceLen > 10) && (max != min)) {
-        for (uint32_t i = 0; i < g_GraphTraceLen; ++i) {
-            g_GraphBuffer[i] = ((long)(g_GraphBuffer[i] - ((max + min) / 2)) * 256) / (max - min);
-            //marshmelow: adjusted *1000 to *256 to make +/- 128 so demod commands still work
-        }
-    }
-
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-    size_t size = getFromGraphBuffer(bits);
-    // set signal properties low/high/mean/amplitude and is_noise detection
-    computeSignalProperties(bits, size);
-
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
+    // scaled by 256 / (max - min) to make +/- 128 so demod commands still work
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_NORM, 0, 0);
+    return filterpipe_run_graph(&fp);
 }
 
 int CmdPlot(const char *Cmd) {
@@ -2212,15 +2313,19 @@ int CmdSave(const char *Cmd) {
     CLIParserInit(&ctx, "data save",
                   "Save signal trace from graph window , i.e. the GraphBuffer\n"
                   "This is a text file with number -127 to 127.  With the option `w` you can save it as wave file\n"
+                  "With the option `b` it is saved as binary trace file (" SIGFILE_EXT "), optionally LZ4 compressed\n"
                   "Filename should be without file extension",
                   "data save -f myfilename         -> save graph buffer to file\n"
-                  "data save --wave -f myfilename  -> save graph buffer to wave file"
+                  "data save --wave -f myfilename  -> save graph buffer to wave file\n"
+                  "data save --bin -z -f myfilename -> save graph buffer to compressed binary trace file"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_lit0("w", "wave", "save as wave format (.wav)"),
         arg_str1("f", "file", "<fn w/o ext>", "save file name"),
+        arg_lit0("b", "bin", "save as binary trace file (" SIGFILE_EXT ")"),
+        arg_lit0("z", "lz4", "LZ4 compress the binary trace file"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -2231,17 +2336,36 @@ int CmdSave(const char *Cmd) {
     char filename[FILE_PATH_SIZE] = {0};
     // CLIGetStrWithReturn(ctx, 2, (uint8_t *)filename, &fnlen);
     CLIParamStrToBuf(arg_get_str(ctx, 2), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    bool as_bin = arg_get_lit(ctx, 3);
+    bool compress = arg_get_lit(ctx, 4);
     CLIParserFree(ctx);
 
+    if (as_wave && as_bin) {
+        PrintAndLogEx(WARNING, "select either wave or binary format");
+        return PM3_EINVARG;
+    }
+
+    if (compress && as_bin == false) {
+        PrintAndLogEx(WARNING, "compression needs the binary format");
+        return PM3_EINVARG;
+    }
+
     if (g_GraphTraceLen == 0) {
         PrintAndLogEx(WARNING, "Graphbuffer is empty, nothing to save");
         return PM3_SUCCESS;
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     if (as_wave)
-        return saveFileWAVE(filename, g_GraphBuffer, g_GraphTraceLen);
+        return saveFileWAVE(filename, gb, g_GraphTraceLen);
+    else if (as_bin)
+        return sigfile_save(filename, gb, g_GraphTraceLen, compress);
     else
-        return saveFilePM3(filename, g_GraphBuffer, g_GraphTraceLen);
+        return saveFilePM3(filename, gb, g_GraphTraceLen);
 }
 
 static int CmdTimeScale(const char *Cmd) {
@@ -2323,21 +2447,10 @@ static int CmdDirectionalThreshold(const char *Cmd) {
 
     PrintAndLogEx(INFO, "Applying up threshold: " _YELLOW_("%i") ", down threshold: " _YELLOW_("%i") "\n", up, down);
 
-    directionalThreshold(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, up, down);
-
-    // set signal properties low/high/mean/amplitude and isnoice detection
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-    size_t size = getFromGraphBuffer(bits);
-    // set signal properties low/high/mean/amplitude and is_noice detection
-    computeSignalProperties(bits, size);
-
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_DIRTHRESHOLD, up, down);
+    return filterpipe_run_graph(&fp);
 }
 
 static int CmdZerocrossings(const char *Cmd) {
@@ -2356,17 +2469,22 @@ static int CmdZerocrossings(const char *Cmd) {
     // Zero-crossings aren't meaningful unless the signal is zero-mean.
     CmdHpf("");
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     int sign = 1, zc = 0, lastZc = 0;
 
     for (uint32_t i = 0; i < g_GraphTraceLen; ++i) {
-        if (g_GraphBuffer[i] * sign >= 0) {
+        if (gb[i] * sign >= 0) {
             // No change in sign, reproduce the previous sample count.
             zc++;
-            g_GraphBuffer[i] = lastZc;
+            gb[i] = lastZc;
         } else {
             // Change in sign, reset the sample count.
             sign = -sign;
-            g_GraphBuffer[i] = lastZc;
+            gb[i] = lastZc;
             if (sign > 0) {
                 lastZc = zc;
                 zc = 0;
@@ -2564,9 +2682,14 @@ static int CmdFSKToNRZ(const char *Cmd) {
     int fc_high = arg_get_int_def(ctx, 3, 0);
     CLIParserFree(ctx);
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     setClockGrid(0, 0);
     g_DemodBufferLen = 0;
-    int ans = FSKToNRZ(g_GraphBuffer, &g_GraphTraceLen, clk, fc_low, fc_high);
+    int ans = FSKToNRZ(gb, &g_GraphTraceLen, clk, fc_low, fc_high);
     CmdNorm("");
     RepaintGraphWindow();
     return ans;
@@ -2624,23 +2747,6 @@ void iceIIR_Butterworth(int *data, const size_t len) {
 }
 */
 
-static void iceSimple_Filter(int *data, const size_t len, uint8_t k) {
-// ref: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
-// parameter K
-#define FILTER_SHIFT 4
-
-    int32_t filter_reg = 0;
-    int8_t shift = (k <= 8) ? k : FILTER_SHIFT;
-
-    for (size_t i = 0; i < len; ++i) {
-        // Update filter with current sample
-        filter_reg = filter_reg - (filter_reg >> shift) + data[i];
-
-        // Scale output for unity gain
-        data[i] = filter_reg >> shift;
-    }
-}
-
 static int CmdDataIIR(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -2657,20 +2763,11 @@ static int CmdDataIIR(const char *Cmd) {
     uint8_t k = (arg_get_u32_def(ctx, 1, 0) & 0xFF);
     CLIParserFree(ctx);
 
-    iceSimple_Filter(g_GraphBuffer, g_GraphTraceLen, k);
-
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-
-    size_t size = getFromGraphBuffer(bits);
-    // set signal properties low/high/mean/amplitude and is_noise detection
-    computeSignalProperties(bits, size);
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
+    // ref: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_IIR, k, 0);
+    return filterpipe_run_graph(&fp);
 }
 
 typedef struct {
@@ -2787,7 +2884,7 @@ static int try_detect_modulation(void) {
         clk = GetPskClock("", false);
         if (clk > 0) {
             // allow undo
-            buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+            buffer_savestate_t saveState = save_graph_buffer();
             saveState.offset = g_GridOffset;
             // skip first 160 samples to allow antenna to settle in (psk gets inverted occasionally otherwise)
             CmdLtrim("-i 160");
@@ -2800,7 +2897,7 @@ static int try_detect_modulation(void) {
                 tests[hits].carrier = GetPskCarrier(false);
             }
             //undo trim samples
-            restore_bufferS32(saveState, g_GraphBuffer);
+            restore_graph_buffer(&saveState);
             g_GridOffset = saveState.offset;
         }
     }
@@ -3420,42 +3517,10 @@ static int CmdCenterThreshold(const char *Cmd) {
 
     PrintAndLogEx(INFO, "Applying up threshold: " _YELLOW_("%i") ", down threshold: " _YELLOW_("%i") "\n", up, down);
 
-    centerThreshold(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, up, down);
-
-    // set signal properties low/high/mean/amplitude and isnoice detection
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
-    }
-    size_t size = getFromGraphBuffer(bits);
-    // set signal properties low/high/mean/amplitude and is_noice detection
-    computeSignalProperties(bits, size);
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
-}
-
-static int envelope_square(const int *in, int *out, size_t len) {
-    if (len < 10) {
-        return PM3_EINVARG;
-    }
-
-
-    size_t i = 0;
-    while (i < len - 8) {
-
-        if (in[i] == 0 && in[i + 1] == 0 && in[i + 2] == 0 && in[i + 3] == 0 &&
-                in[i + 4] == 0 && in[i + 5] == 0 && in[i + 6] == 0 && in[i + 7] == 0) {
-
-            i += 8;
-            continue;
-        }
-
-        out[i] = 255;
-        i++;
-    }
-    return PM3_SUCCESS;
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_CTHRESHOLD, up, down);
+    return filterpipe_run_graph(&fp);
 }
 
 static int CmdEnvelope(const char *Cmd) {
@@ -3471,19 +3536,44 @@ static int CmdEnvelope(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    envelope_square(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen);
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_ENVELOPE, 0, 0);
+    return filterpipe_run_graph(&fp);
+}
 
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
-    if (bits == NULL) {
-        PrintAndLogEx(WARNING, "Failed to allocate memory");
-        return PM3_EMALLOC;
+static int CmdPipeline(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "data pipeline",
+                  "Run a chain of graph filters in one go, same result as running the single commands one after the other.\n"
+                  "Filters are separated by `,` and take their arguments after `:`\n"
+                  "  norm                       - same as `data norm`\n"
+                  "  hpf                        - same as `data hpf`\n"
+                  "  iir:<n>                    - same as `data iir -n <n>`\n"
+                  "  dirthreshold:<up>:<down>   - same as `data dirthreshold -u <up> -d <down>`\n"
+                  "  cthreshold:<up>:<down>     - same as `data cthreshold -u <up> -d <down>`\n"
+                  "  envelope                   - same as `data envelope`",
+                  "data pipeline -p norm,cthreshold:50:-20,envelope\n"
+                  "data pipeline -p hpf,iir:2,norm"
+                 );
+    void *argtable[] = {
+        arg_param_begin,
+        arg_str1("p", "pipe", "<str>", "filter chain"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, false);
+    int plen = 0;
+    char pipe[256] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)pipe, sizeof(pipe), &plen);
+    CLIParserFree(ctx);
+
+    filterpipe_t fp;
+    int res = filterpipe_parse(&fp, pipe);
+    if (res != PM3_SUCCESS) {
+        return res;
     }
-    size_t size = getFromGraphBuffer(bits);
-    // set signal properties low/high/mean/amplitude and is_noice detection
-    computeSignalProperties(bits, size);
-    RepaintGraphWindow();
-    free(bits);
-    return PM3_SUCCESS;
+    filterpipe_print(&fp);
+    return filterpipe_run_graph(&fp);
 }
 
 static int CmdAtrLookup(const char *Cmd) {
@@ -3986,6 +4076,7 @@ static command_t CommandTable[] = {
     {"ltrim",            CmdLtrim,                AlwaysAvailable,  "Trim samples from left of trace"},
     {"mtrim",            CmdMtrim,                AlwaysAvailable,  "Trim out samples from the specified start to the specified stop"},
     {"norm",             CmdNorm,                 AlwaysAvailable,  "Normalize max/min to +/-128"},
+    {"pipeline",         CmdPipeline,             AlwaysAvailable,  "Run a chain of graph filters in one pass"},
     {"rtrim",            CmdRtrim,                AlwaysAvailable,  "Trim samples from right of trace"},
     {"setgraphmarkers",  CmdSetGraphMarkers,      AlwaysAvailable,  "Set the markers in the graph window"},
     {"shiftgraphzero",   CmdGraphShiftZero,       AlwaysAvailable,  "Shift 0 for Graphed wave + or - shift value"},
@@ -20,6 +20,7 @@
 #define CMDDATA_H__
 
 #include "common.h"
+#include "graph.h"
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -63,7 +64,8 @@ int CmdPSK1rawDemod(const char *Cmd);
 int CmdGetBitStream(const char *Cmd);                                                           // used by cmd lf
 int CmdGrid(const char *Cmd);                                                                   // used by cmd lf cotag
 int CmdHpf(const char *Cmd);                                                                    // used by cmd lf data (!)
-int CmdLtrim(const char *Cmd);                                                                  // used by cmd lf em4x, lf t55xx
+int CmdLtrim(const char *Cmd);                                                                  // used by cmd lf em4x
+int ltrim_ctx(demod_ctx_t *dctx, uint32_t ds);                                                  // used by cmd lf t55xx
 int CmdNorm(const char *Cmd);                                                                   // used by cmd lf data (!)
 int CmdPlot(const char *Cmd);                                                                   // used by cmd lf cotag
 int CmdSave(const char *Cmd);                                                                   // used by cmd auto
@@ -76,18 +78,31 @@ int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bo
 int PSKDemod(int clk, int invert, int maxErr, bool verbose);                                    // used by cmd lf em4x, lf indala, lf keri, lf nexwatch, lf t55xx
 int NRZrawDemod(int clk, int invert, int maxErr, bool verbose);                                 // used by cmd lf pac, lf t55xx
 
+// same, on a demod context,  see graph.h
+int ASKbiphaseDemod_ctx(demod_ctx_t *dctx, int offset, int clk, int invert, int maxErr, bool verbose);
+int ASKDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType);
+int ASKDemod_ext_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxlen, bool amplify, bool verbose, bool emSearch, uint8_t askType, bool *stCheck);
+int FSKrawDemod_ctx(demod_ctx_t *dctx, uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bool verbose);
+int PSKDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, bool verbose);
+int NRZrawDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, bool verbose);
+
 
 int printDemodBuff(uint8_t offset, bool strip_leading, bool invert, bool print_hex);
+int printDemodBuff_ctx(demod_ctx_t *dctx, uint8_t offset, bool strip_leading, bool invert, bool print_hex);
 
 void setDemodBuff(const uint8_t *buff, size_t size, size_t start_idx);
 bool getDemodBuff(uint8_t *buff, size_t *size);
-int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveGrph, bool verbose);
+void setDemodBuff_ctx(demod_ctx_t *dctx, const uint8_t *buff, size_t size, size_t start_idx);
+bool getDemodBuff_ctx(demod_ctx_t *dctx, uint8_t *buff, size_t *size);
+int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool hann, bool SaveGrph, bool verbose);
 
 int getSamples(uint32_t n, bool verbose);
 int getSamplesEx(uint32_t start, uint32_t end, bool verbose, bool ignore_lf_config);
 int getSamplesFromBufEx(uint8_t *data, size_t sample_num, uint8_t bits_per_sample, bool verbose);
 
 void setClockGrid(uint32_t clk, int offset);
+void setClockGrid_ctx(demod_ctx_t *dctx, uint32_t clk, int offset);
+void setPlotGrid(uint32_t clk, int offset);
 int directionalThreshold(const int *in, int *out, size_t len, int8_t up, int8_t down);
 int centerThreshold(const int *in, int *out, size_t len, int8_t up, int8_t down);
 int AskEdgeDetect(const int *in, int *out, int len, int threshold);
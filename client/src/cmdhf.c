@@ -58,6 +58,7 @@
 #include "proxgui.h"
 #include "cmddata.h"
 #include "graph.h"
+#include "filterpipe.h"   // hpf
 #include "fpga.h"
 
 static int CmdHelp(const char *Cmd);
@@ -530,8 +531,13 @@ int handle_hf_plot(bool show_plot) {
         return PM3_ETIMEOUT;
     }
 
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t i = 0; i < FPGA_TRACE_SIZE; i++) {
-        g_GraphBuffer[i] = ((int)buf[i]) - 128;
+        gb[i] = ((int)buf[i]) - 128;
     }
 
     g_GraphTraceLen = FPGA_TRACE_SIZE;
@@ -541,7 +547,10 @@ int handle_hf_plot(bool show_plot) {
     }
 
     // remove signal offset
-    CmdHpf("");
+    filterpipe_t fp;
+    filterpipe_init(&fp);
+    filterpipe_add(&fp, FILTERPIPE_HPF, 0, 0);
+    filterpipe_run_graph(&fp);
 
     setClockGrid(0, 0);
     g_DemodBufferLen = 0;
@@ -3018,20 +3018,19 @@ int infoHF14A(bool verbose, bool do_nack_test, bool do_aid_search) {
 
             PrintAndLogEx(INFO, "-------------------- " _CYAN_("AID Search") " --------------------");
 
-            json_t *root = AIDSearchInit(verbose);
+            const restable_t *root = AIDSearchInit(verbose);
             if (root != NULL) {
                 bool found = false;
                 bool ActivateField = true;
-                for (size_t elmindx = 0; elmindx < json_array_size(root); elmindx++) {
+                for (size_t elmindx = 0; elmindx < root->count; elmindx++) {
 
                     if (kbd_enter_pressed()) {
                         break;
                     }
 
-                    json_t *data = AIDSearchGetElm(root, elmindx);
                     uint8_t vaid[200] = {0};
                     int vaidlen = 0;
-                    if (!AIDGetFromElm(data, vaid, sizeof(vaid), &vaidlen) || !vaidlen)
+                    if (!AIDGetFromElm(root, elmindx, vaid, sizeof(vaid), &vaidlen) || !vaidlen)
                         continue;
 
                     uint16_t sw = 0;
@@ -96,7 +96,7 @@ static int clear_trace_14b(void) {
 
 static void hf14b_aid_search(bool verbose) {
 
-    json_t *root = AIDSearchInit(verbose);
+    const restable_t *root = AIDSearchInit(verbose);
     if (root == NULL)  {
         switch_off_field_14b();
         return;
@@ -107,17 +107,16 @@ static void hf14b_aid_search(bool verbose) {
     bool found = false;
     bool leave_signal_on = true;
     bool activate_field = true;
-    for (size_t elmindx = 0; elmindx < json_array_size(root); elmindx++) {
+    for (size_t elmindx = 0; elmindx < root->count; elmindx++) {
 
         if (kbd_enter_pressed()) {
             break;
         }
 
-        json_t *data = AIDSearchGetElm(root, elmindx);
         uint8_t vaid[200] = {0};
         int vaidlen = 0;
 
-        if ((AIDGetFromElm(data, vaid, sizeof(vaid), &vaidlen) == false) || (vaidlen == 0)) {
+        if ((AIDGetFromElm(root, elmindx, vaid, sizeof(vaid), &vaidlen) == false) || (vaidlen == 0)) {
             continue;
         }
 
@@ -1974,6 +1973,7 @@ static int CmdHF14BRestore(const char *Cmd) {
         uint8_t out[ST25TB_SR_BLOCK_SIZE] = {0};
         status = read_sr_block(blockno, out, sizeof(out));
         if (status == PM3_SUCCESS) {
+            PrintAndLogFlush();
             if (memcmp(data + blockno * ST25TB_SR_BLOCK_SIZE, out, ST25TB_SR_BLOCK_SIZE) == 0) {
                 printf("\33[2K\r");
                 PrintAndLogEx(INFO, "SRx write block %d/%d ( " _GREEN_("ok") " )" NOLF, blockno, block_cnt - 1);
@@ -1982,6 +1982,7 @@ static int CmdHF14BRestore(const char *Cmd) {
                 PrintAndLogEx(INFO, "SRx write block %d/%d ( " _RED_("different") " )", blockno, block_cnt - 1);
             }
         } else {
+            PrintAndLogFlush();
             printf("\n");
             PrintAndLogEx(INFO, "Verifying block %d/%d ( " _RED_("failed") " )", blockno, block_cnt - 1);
         }
@@ -533,11 +533,16 @@ static int CmdHF15Demod(const char *Cmd) {
         return PM3_ESOFT;
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     // First, correlate for SOF
     for (i = 0; i < 1000; i++) {
         int corr = 0;
         for (j = 0; j < ARRAYLEN(FrameSOF); j += skip) {
-            corr += FrameSOF[j] * g_GraphBuffer[i + (j / skip)];
+            corr += FrameSOF[j] * gb[i + (j / skip)];
         }
         if (corr > max) {
             max = corr;
@@ -558,15 +563,15 @@ static int CmdHF15Demod(const char *Cmd) {
 
         int corr0 = 0, corr1 = 0, corrEOF = 0;
         for (j = 0; j < ARRAYLEN(Logic0); j += skip) {
-            corr0 += Logic0[j] * g_GraphBuffer[i + (j / skip)];
+            corr0 += Logic0[j] * gb[i + (j / skip)];
         }
 
         for (j = 0; j < ARRAYLEN(Logic1); j += skip) {
-            corr1 += Logic1[j] * g_GraphBuffer[i + (j / skip)];
+            corr1 += Logic1[j] * gb[i + (j / skip)];
         }
 
         for (j = 0; j < ARRAYLEN(FrameEOF); j += skip) {
-            corrEOF += FrameEOF[j] * g_GraphBuffer[i + (j / skip)];
+            corrEOF += FrameEOF[j] * gb[i + (j / skip)];
         }
         // Even things out by the length of the target waveform.
         corr0 *= 4;
@@ -1787,6 +1792,66 @@ static int CmdHF15WriteDsfid(const char *Cmd) {
 
 // Reads all memory pages
 // need to write to file
+typedef enum {
+    HF15_DUMP_OK,
+    HF15_DUMP_RETRY,
+    HF15_DUMP_STOP,
+} hf15_dump_res_t;
+
+typedef struct {
+    PacketResponseNG *replies;
+    int *res;
+    int received;
+} hf15_dump_ctx_t;
+
+// checks a read block reply and copies the block into the tag memory
+static hf15_dump_res_t hf15_dump_block(const PacketResponseNG *resp, iso15_tag_t *tag, int blocknum) {
+
+    if (resp->length < 2) {
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(FAILED, "iso15693 command failed");
+        return HF15_DUMP_RETRY;
+    }
+
+    const uint8_t *d = resp->data.asBytes;
+
+    if (CheckCrc15(d, resp->length) == false) {
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(FAILED, "crc ( " _RED_("fail") " )");
+        return HF15_DUMP_RETRY;
+    }
+
+    if ((d[0] & ISO15_RES_ERROR) == ISO15_RES_ERROR) {
+
+        // heuristic determine end of available memory
+        if (d[1] != 0x0F && d[1] != 0x10) {
+            PrintAndLogEx(NORMAL, "");
+            PrintAndLogEx(FAILED, "Tag returned Error %i: %s", d[1], TagErrorStr(d[1]));
+        }
+        return HF15_DUMP_STOP;
+    }
+
+    tag->locks[blocknum] = d[1];
+
+    // copy read data
+    memcpy(&tag->data[blocknum * tag->bytesPerPage], d + 2, tag->bytesPerPage);
+    return HF15_DUMP_OK;
+}
+
+static bool hf15_dump_reply(size_t idx, int res, const PacketResponseNG *resp, void *ctx) {
+    hf15_dump_ctx_t *dctx = (hf15_dump_ctx_t *)ctx;
+    dctx->res[idx] = res;
+    if (resp) {
+        memcpy(&dctx->replies[idx], resp, sizeof(PacketResponseNG));
+    }
+    dctx->received = idx + 1;
+
+    // no need to read past the end of the tag memory
+    const uint8_t *d = (resp) ? resp->data.asBytes : NULL;
+    bool tag_error = (d && resp->length >= 2 && CheckCrc15(d, resp->length) && (d[0] & ISO15_RES_ERROR) == ISO15_RES_ERROR);
+    return (tag_error == false);
+}
+
 static int CmdHF15Dump(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "hf 15 dump",
@@ -1956,60 +2021,70 @@ static int CmdHF15Dump(const char *Cmd) {
 
     PrintAndLogEx(SUCCESS, "Reading memory");
 
-    int blocknum = 0;
+    // one read request per block, several of them in flight at once
+    size_t pktlen = ISO15_RAW_LEN(packet->rawlen);
+    uint8_t *pkts = calloc(tag->pagesCount, pktlen);
+    pipeline_cmd_t *cmds = calloc(tag->pagesCount, sizeof(pipeline_cmd_t));
+    hf15_dump_ctx_t dctx = {
+        .replies = calloc(tag->pagesCount, sizeof(PacketResponseNG)),
+        .res = calloc(tag->pagesCount, sizeof(int)),
+        .received = 0,
+    };
+    if (pkts == NULL || cmds == NULL || dctx.replies == NULL || dctx.res == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(pkts);
+        free(cmds);
+        free(dctx.replies);
+        free(dctx.res);
+        free(packet);
+        free(tag);
+        return PM3_EMALLOC;
+    }
 
-    for (int retry = 0; (retry < 2 && blocknum < tag->pagesCount); retry++) {
+    for (int i = 0; i < tag->pagesCount; i++) {
         if (used_uid) {
-            packet->raw[10] = (uint8_t)blocknum & 0xFF;
+            packet->raw[10] = (uint8_t)i & 0xFF;
             AddCrc15(packet->raw, 11);
         } else {
-            packet->raw[2] = (uint8_t)blocknum & 0xFF;
+            packet->raw[2] = (uint8_t)i & 0xFF;
             AddCrc15(packet->raw, 3);
         }
+        memcpy(pkts + (i * pktlen), packet, pktlen);
+        cmds[i].cmd = CMD_HF_ISO15693_COMMAND;
+        cmds[i].data = pkts + (i * pktlen);
+        cmds[i].len = pktlen;
+    }
 
-        clearCommandBuffer();
-        SendCommandNG(CMD_HF_ISO15693_COMMAND, (uint8_t *)packet, ISO15_RAW_LEN(packet->rawlen));
-
-        if (WaitForResponseTimeout(CMD_HF_ISO15693_COMMAND, &resp, 2000)) {
-
-            if (resp.length < 2) {
-                PrintAndLogEx(NORMAL, "");
-                PrintAndLogEx(FAILED, "iso15693 command failed");
-                continue;
-            }
-
-            d = resp.data.asBytes;
-
-            if (CheckCrc15(d, resp.length) == false) {
-                PrintAndLogEx(NORMAL, "");
-                PrintAndLogEx(FAILED, "crc ( " _RED_("fail") " )");
-                continue;
-            }
+    SendCommandPipelined(cmds, tag->pagesCount, 0, 2000, hf15_dump_reply, &dctx);
 
-            if ((d[0] & ISO15_RES_ERROR) == ISO15_RES_ERROR) {
+    int blocknum = 0;
+    for (; blocknum < dctx.received; blocknum++) {
 
-                // heuristic determine end of available memory
-                if (d[1] == 0x0F || d[1] == 0x10) {
-                    break;
-                }
+        int bres = HF15_DUMP_RETRY;
+        if (dctx.res[blocknum] == PM3_SUCCESS) {
+            bres = hf15_dump_block(&dctx.replies[blocknum], tag, blocknum);
+        }
 
-                PrintAndLogEx(NORMAL, "");
-                PrintAndLogEx(FAILED, "Tag returned Error %i: %s", d[1], TagErrorStr(d[1]));
-                break;
+        if (bres == HF15_DUMP_RETRY) {
+            // second and last try, on its own
+            clearCommandBuffer();
+            SendCommandNG(CMD_HF_ISO15693_COMMAND, pkts + (blocknum * pktlen), pktlen);
+            if (WaitForResponseTimeout(CMD_HF_ISO15693_COMMAND, &resp, 2000)) {
+                bres = hf15_dump_block(&resp, tag, blocknum);
             }
+        }
 
-            tag->locks[blocknum] = d[1];
-
-            // copy read data
-            memcpy(&tag->data[blocknum * tag->bytesPerPage], d + 2, tag->bytesPerPage);
-
-            retry = 0;
-            blocknum++;
-
-            PrintAndLogEx(INPLACE, "blk %3d", blocknum);
+        if (bres != HF15_DUMP_OK) {
+            break;
         }
+
+        PrintAndLogEx(INPLACE, "blk %3d", blocknum + 1);
     }
 
+    free(pkts);
+    free(cmds);
+    free(dctx.replies);
+    free(dctx.res);
     free(packet);
     DropField();
 
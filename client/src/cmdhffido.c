@@ -502,6 +502,7 @@ static int CmdHFFidoAuthenticate(const char *cmd) {
         return PM3_EINVARG;
     }
 
+    PrintAndLogFlush();
     printf("-- hlen=%d\n", hdatalen);
     if (hdatalen) {
         keyHandleLen = hdatalen;
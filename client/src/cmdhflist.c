@@ -43,8 +43,11 @@ enum MifareAuthSeq {
     masData,
     masError,
 };
-static enum MifareAuthSeq MifareAuthState;
-static AuthData_t AuthData;
+// annotation state is per thread, so trace list can annotate card sessions in parallel
+static __thread enum MifareAuthSeq MifareAuthState;
+static __thread AuthData_t AuthData;
+static __thread struct Crypto1State *traceCrypto1;
+static __thread uint64_t mfLastKey;
 
 void ClearAuthData(void) {
     AuthData.uid = 0;
@@ -55,10 +58,25 @@ void ClearAuthData(void) {
 }
 
 
-static int gs_ntag_i2c_state = 0;
-static int gs_mfuc_state = 0;
-static uint8_t gs_mfuc_authdata[3][16] = {{0}};
-static uint8_t *gs_mfuc_key = NULL;
+static __thread int gs_ntag_i2c_state = 0;
+static __thread int gs_mfuc_state = 0;
+static __thread uint8_t gs_mfuc_authdata[3][16] = {{0}};
+static __thread uint8_t *gs_mfuc_key = NULL;
+
+// back to the state before anything was annotated, on the calling thread
+void ResetTraceAnnotation(void) {
+    MifareAuthState = masNone;
+    ClearAuthData();
+    if (traceCrypto1) {
+        crypto1_destroy(traceCrypto1);
+        traceCrypto1 = NULL;
+    }
+    mfLastKey = 0;
+    gs_ntag_i2c_state = 0;
+    gs_mfuc_state = 0;
+    memset(gs_mfuc_authdata, 0, sizeof(gs_mfuc_authdata));
+    gs_mfuc_key = NULL;
+}
 
 /**
  * @brief iso14443A_CRC_check Checks CRC in command or response
@@ -2245,7 +2263,6 @@ static void mf_get_paritybinstr(char *s, uint32_t val, uint8_t par) {
 }
 
 bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isResponse, uint8_t *mfData, size_t *mfDataLen, const uint64_t *dicKeys, uint32_t dicKeysCount) {
-    static struct Crypto1State *traceCrypto1;
 
     *mfDataLen = 0;
 
@@ -2263,20 +2280,18 @@ bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isRes
         return false;
 
     if (MifareAuthState == masFirstData) {
-        static uint64_t mfLastKey;
         if (AuthData.first_auth) {
             AuthData.ks2 = AuthData.ar_enc ^ prng_successor(AuthData.nt, 64);
             AuthData.ks3 = AuthData.at_enc ^ prng_successor(AuthData.nt, 96);
 
-            mfLastKey = GetCrypto1ProbableKey(&AuthData);
+            traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
+            mfLastKey = GetCrypto1ProbableKeyFromState(&AuthData, traceCrypto1);
             PrintAndLogEx(NORMAL, "            |            |  *  |%49s " _GREEN_("%012" PRIX64) " prng %s |     |",
                           "key",
                           mfLastKey,
                           validate_prng_nonce(AuthData.nt) ? _GREEN_("WEAK") : _YELLOW_("HARD"));
 
             AuthData.first_auth = false;
-
-            traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
         } else {
             if (traceCrypto1) {
                 crypto1_destroy(traceCrypto1);
@@ -2314,23 +2329,28 @@ bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isRes
                         uint32_t ks2 = AuthData.ar_enc ^ prng_successor(ntx, 64);
                         uint32_t ks3 = AuthData.at_enc ^ prng_successor(ntx, 96);
                         struct Crypto1State *pcs = lfsr_recovery64(ks2, ks3);
+                        if (pcs == NULL) {
+                            continue;
+                        }
+                        // decrypt on a copy, the recovered state is kept when it is the right one
+                        struct Crypto1State tmp = *pcs;
                         memcpy(mfData, cmd, cmdsize);
-                        mf_crypto1_decrypt(pcs, mfData, cmdsize, 0);
-                        crypto1_destroy(pcs);
+                        mf_crypto1_decrypt(&tmp, mfData, cmdsize, 0);
 
                         if (CheckCrypto1Parity(cmd, cmdsize, mfData, parity) && check_crc(CRC_14443_A, mfData, cmdsize)) {
                             AuthData.ks2 = ks2;
                             AuthData.ks3 = ks3;
                             AuthData.nt = ntx;
-                            mfLastKey = GetCrypto1ProbableKey(&AuthData);
+                            mfLastKey = GetCrypto1ProbableKeyFromState(&AuthData, pcs);
                             PrintAndLogEx(NORMAL, "            |            |  *  | nested probable key: " _GREEN_("%012" PRIX64) "     ks2:%08x ks3:%08x |     |",
                                           mfLastKey,
                                           AuthData.ks2,
                                           AuthData.ks3);
 
-                            traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
+                            traceCrypto1 = pcs;
                             break;
                         }
+                        crypto1_destroy(pcs);
                     }
                 }
             }
@@ -2476,16 +2496,23 @@ bool CheckCrypto1Parity(const uint8_t *cmd_enc, uint8_t cmdsize, uint8_t *cmd, c
 //
 uint64_t GetCrypto1ProbableKey(AuthData_t *ad) {
     struct Crypto1State *revstate = lfsr_recovery64(ad->ks2, ad->ks3);
-    lfsr_rollback_word(revstate, 0, 0);
-    lfsr_rollback_word(revstate, 0, 0);
-    lfsr_rollback_word(revstate, ad->nr_enc, 1);
-    lfsr_rollback_word(revstate, ad->uid ^ ad->nt, 0);
-    uint64_t key = 0;
-    crypto1_get_lfsr(revstate, &key);
+    uint64_t key = GetCrypto1ProbableKeyFromState(ad, revstate);
     crypto1_destroy(revstate);
     return key;
 }
 
+// same, from a state lfsr_recovery64() already gave for ad->ks2 / ad->ks3. The state is left as it is
+uint64_t GetCrypto1ProbableKeyFromState(const AuthData_t *ad, const struct Crypto1State *state) {
+    struct Crypto1State revstate = *state;
+    lfsr_rollback_word(&revstate, 0, 0);
+    lfsr_rollback_word(&revstate, 0, 0);
+    lfsr_rollback_word(&revstate, ad->nr_enc, 1);
+    lfsr_rollback_word(&revstate, ad->uid ^ ad->nt, 0);
+    uint64_t key = 0;
+    crypto1_get_lfsr(&revstate, &key);
+    return key;
+}
+
 // FMCOS 2.0
 void annotateFMCOS20(char *exp, size_t size, uint8_t *cmd, uint8_t cmdsize) {
 
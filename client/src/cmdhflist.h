@@ -20,6 +20,7 @@
 
 #include "common.h"
 #include "mifare/mifaredefault.h"  // mifare consts
+#include "crapto1/crapto1.h"
 
 typedef struct {
     uint32_t uid;       // UID
@@ -39,6 +40,7 @@ typedef struct {
 } AuthData_t;
 
 void ClearAuthData(void);
+void ResetTraceAnnotation(void);
 
 uint8_t iso14443A_CRC_check(bool isResponse, uint8_t *d, uint8_t n);
 uint8_t iso14443B_CRC_check(uint8_t *d, uint8_t n);
@@ -76,6 +78,7 @@ bool NTParityChk(AuthData_t *ad, uint32_t ntx);
 bool NestedCheckKey(uint64_t key, AuthData_t *ad, uint8_t *cmd, uint8_t cmdsize, uint8_t *parity);
 bool CheckCrypto1Parity(const uint8_t *cmd_enc, uint8_t cmdsize, uint8_t *cmd, const uint8_t *parity_enc);
 uint64_t GetCrypto1ProbableKey(AuthData_t *ad);
+uint64_t GetCrypto1ProbableKeyFromState(const AuthData_t *ad, const struct Crypto1State *state);
 
 void annotateFMCOS20(char *exp, size_t size, uint8_t *cmd, uint8_t cmdsize);
 
@@ -889,6 +889,81 @@ static int mf_analyse_st_block(uint8_t blockno, uint8_t *block, bool force) {
     return PM3_SUCCESS;
 }
 
+// first try of the block reads in mfc_read_tag(), sent pipelined
+typedef struct {
+    PacketResponseNG *replies;
+    int *res;
+    size_t count;
+} mf_prefetch_t;
+
+static bool mf_prefetch_reply(size_t idx, int res, const PacketResponseNG *resp, void *ctx) {
+    mf_prefetch_t *pre = (mf_prefetch_t *)ctx;
+    pre->res[idx] = res;
+    if (resp) {
+        memcpy(&pre->replies[idx], resp, sizeof(PacketResponseNG));
+    }
+    return true;
+}
+
+// sends all reads of payloads at once. Without memory nothing is prefetched and the reads go out one by one, as before
+static void mf_prefetch_blocks(const mf_readblock_t *payloads, size_t count, mf_prefetch_t *pre) {
+    pre->count = 0;
+    pre->replies = calloc(count, sizeof(PacketResponseNG));
+    pre->res = calloc(count, sizeof(int));
+    pipeline_cmd_t *cmds = calloc(count, sizeof(pipeline_cmd_t));
+    if (pre->replies == NULL || pre->res == NULL || cmds == NULL) {
+        free(pre->replies);
+        free(pre->res);
+        free(cmds);
+        pre->replies = NULL;
+        pre->res = NULL;
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        pre->res[i] = PM3_ETIMEOUT;
+        cmds[i].cmd = CMD_HF_MIFARE_READBL;
+        cmds[i].data = (const uint8_t *)&payloads[i];
+        cmds[i].len = sizeof(mf_readblock_t);
+    }
+    pre->count = count;
+
+    SendCommandPipelined(cmds, count, 0, 1500, mf_prefetch_reply, pre);
+    free(cmds);
+}
+
+static void mf_prefetch_free(mf_prefetch_t *pre) {
+    free(pre->replies);
+    free(pre->res);
+    pre->replies = NULL;
+    pre->res = NULL;
+    pre->count = 0;
+}
+
+// reads a block, the first try comes from the prefetch when that got a reply
+static bool mf_read_block_try(const mf_prefetch_t *pre, size_t idx, uint8_t tries, mf_readblock_t *payload, PacketResponseNG *resp) {
+    if (tries == 0 && idx < pre->count && pre->res[idx] == PM3_SUCCESS) {
+        memcpy(resp, &pre->replies[idx], sizeof(PacketResponseNG));
+        return true;
+    }
+    clearCommandBuffer();
+    SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)payload, sizeof(mf_readblock_t));
+    return WaitForResponseTimeout(CMD_HF_MIFARE_READBL, resp, 1500);
+}
+
+// key to read a block with, current_key unless the access rights only allow key B
+static void mf_dump_payload(uint8_t sectorNo, uint8_t blockNo, uint8_t current_key, const uint8_t *rights, const uint8_t *keyA, const uint8_t *keyB, mf_readblock_t *payload) {
+    uint8_t data_area = (sectorNo < 32) ? blockNo : blockNo / 5;
+    payload->blockno = mfFirstBlockOfSector(sectorNo) + blockNo;
+    // at least the Access Conditions of a sector trailer can always be read with key A.
+    // For data blocks check if only key B would work
+    if (mfIsSectorTrailerBasedOnBlocks(sectorNo, blockNo) == false && ((rights[data_area] == 0x03) || (rights[data_area] == 0x05))) {
+        current_key = MF_KEY_B;
+    }
+    payload->keytype = current_key;
+    memcpy(payload->key, (current_key == MF_KEY_A) ? keyA + (sectorNo * MIFARE_KEY_SIZE) : keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
+}
+
 /* Reads data from tag
  * @param card: (output) card info
  * @param carddata: (output) card data
@@ -946,6 +1021,24 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
     mf_readblock_t payload;
     uint8_t current_key;
 
+    // the blocks are read one by one on the device, but the next read can be queued there
+    // while the client handles the reply of the previous one. Retries go one by one
+    mf_readblock_t *payloads = calloc(MIFARE_4K_MAXBLOCK, sizeof(mf_readblock_t));
+    if (payloads == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(keyA);
+        free(keyB);
+        return PM3_EMALLOC;
+    }
+    mf_prefetch_t pre = {0};
+
+    for (uint8_t sectorNo = 0; sectorNo < numSectors; sectorNo++) {
+        payloads[sectorNo].blockno = mfFirstBlockOfSector(sectorNo) + mfNumBlocksPerSector(sectorNo) - 1;
+        payloads[sectorNo].keytype = MF_KEY_A;
+        memcpy(payloads[sectorNo].key, keyA + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
+    }
+    mf_prefetch_blocks(payloads, numSectors, &pre);
+
     for (uint8_t sectorNo = 0; sectorNo < numSectors; sectorNo++) {
 
         current_key = MF_KEY_A;
@@ -956,6 +1049,8 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
 
             if (kbd_enter_pressed()) {
                 PrintAndLogEx(WARNING, "\naborted via keyboard!\n");
+                mf_prefetch_free(&pre);
+                free(payloads);
                 free(keyA);
                 free(keyB);
                 return PM3_EOPABORTED;
@@ -966,10 +1061,7 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
 
             memcpy(payload.key, (current_key == MF_KEY_A) ? keyA + (sectorNo * MIFARE_KEY_SIZE) : keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
 
-            clearCommandBuffer();
-            SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)&payload, sizeof(mf_readblock_t));
-
-            if (WaitForResponseTimeout(CMD_HF_MIFARE_READBL, &resp, 1500)) {
+            if (mf_read_block_try(&pre, sectorNo, tries, &payload, &resp)) {
 
                 uint8_t *data = resp.data.asBytes;
                 if (resp.status == PM3_SUCCESS) {
@@ -995,10 +1087,26 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
         }
     }
 
+    mf_prefetch_free(&pre);
+
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(SUCCESS, "Finished reading sector access bits");
     PrintAndLogEx(INFO, "Dumping all blocks from card...");
 
+    // first try of every readable block, in the order of the loop below
+    size_t count = 0;
+    for (uint8_t sectorNo = 0; sectorNo < numSectors; sectorNo++) {
+        for (uint8_t blockNo = 0; blockNo < mfNumBlocksPerSector(sectorNo); blockNo++) {
+            uint8_t data_area = (sectorNo < 32) ? blockNo : blockNo / 5;
+            if (rights[sectorNo][data_area] == 0x07) {
+                continue;
+            }
+            mf_dump_payload(sectorNo, blockNo, MF_KEY_A, rights[sectorNo], keyA, keyB, &payloads[count++]);
+        }
+    }
+    mf_prefetch_blocks(payloads, count, &pre);
+
+    size_t idx = 0;
     for (uint8_t sectorNo = 0; sectorNo < numSectors; sectorNo++) {
 
         for (uint8_t blockNo = 0; blockNo < mfNumBlocksPerSector(sectorNo); blockNo++) {
@@ -1013,40 +1121,8 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
 
             for (uint8_t tries = 0; tries < MIFARE_SECTOR_RETRY; tries++) {
 
-                if (mfIsSectorTrailerBasedOnBlocks(sectorNo, blockNo)) {
-
-                    // sector trailer. At least the Access Conditions can always be read with key A.
-                    payload.blockno = mfFirstBlockOfSector(sectorNo) + blockNo;
-                    payload.keytype = current_key;
-                    memcpy(payload.key, (current_key == MF_KEY_A) ? keyA + (sectorNo * MIFARE_KEY_SIZE) : keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
-
-                    clearCommandBuffer();
-                    SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)&payload, sizeof(mf_readblock_t));
-                    received = WaitForResponseTimeout(CMD_HF_MIFARE_READBL, &resp, 1500);
-
-                } else {
-                    // data block. Check if it can be read with key A or key B
-                    if ((rights[sectorNo][data_area] == 0x03) || (rights[sectorNo][data_area] == 0x05)) {
-                        // only key B would work
-                        payload.blockno = mfFirstBlockOfSector(sectorNo) + blockNo;
-                        payload.keytype = MF_KEY_B;
-                        memcpy(payload.key, keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
-
-                        clearCommandBuffer();
-                        SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)&payload, sizeof(mf_readblock_t));
-                        received = WaitForResponseTimeout(CMD_HF_MIFARE_READBL, &resp, 1500);
-
-                    } else {
-                        // key A would work
-                        payload.blockno = mfFirstBlockOfSector(sectorNo) + blockNo;
-                        payload.keytype = current_key;
-                        memcpy(payload.key, (current_key == MF_KEY_A) ? keyA + (sectorNo * MIFARE_KEY_SIZE) : keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
-
-                        clearCommandBuffer();
-                        SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)&payload, sizeof(mf_readblock_t));
-                        received = WaitForResponseTimeout(CMD_HF_MIFARE_READBL, &resp, 1500);
-                    }
-                }
+                mf_dump_payload(sectorNo, blockNo, current_key, rights[sectorNo], keyA, keyB, &payload);
+                received = mf_read_block_try(&pre, idx, tries, &payload, &resp);
 
                 if (received) {
                     if (resp.status == PM3_SUCCESS) {
@@ -1062,6 +1138,7 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
                     }
                 }
             }
+            idx++;
 
             if (received) {
 
@@ -1086,7 +1163,8 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
         }
     }
 
-
+    mf_prefetch_free(&pre);
+    free(payloads);
     free(keyA);
     free(keyB);
 
@@ -31,33 +31,33 @@
 
 #define TEXKOM_NOISE_THRESHOLD (10)
 
-static inline uint32_t GetGraphBuffer(uint32_t indx) {
-    if (g_GraphBuffer[indx] < -128)
+static inline uint32_t GetGraphBuffer(const int32_t *gb, uint32_t indx) {
+    if (gb[indx] < -128)
         return 0;
     else
-        return g_GraphBuffer[indx] + 128;
+        return gb[indx] + 128;
 }
 
-static uint32_t TexkomAVGField(void) {
+static uint32_t TexkomAVGField(const int32_t *gb) {
     if (g_GraphTraceLen == 0)
         return 0;
 
     uint64_t vsum = 0;
     for (uint32_t i = 0; i < g_GraphTraceLen; i++)
-        vsum += GetGraphBuffer(i);
+        vsum += GetGraphBuffer(gb, i);
 
     return vsum / g_GraphTraceLen;
 }
 
-static uint32_t TexkomSearchStart(uint32_t indx, uint32_t threshold) {
+static uint32_t TexkomSearchStart(const int32_t *gb, uint32_t indx, uint32_t threshold) {
     // one bit length = 27, minimal noise = 60
     uint32_t lownoisectr = 0;
     for (uint32_t i = indx; i < g_GraphTraceLen; i++) {
         if (lownoisectr > 60) {
-            if (GetGraphBuffer(i) > threshold)
+            if (GetGraphBuffer(gb, i) > threshold)
                 return i;
         } else {
-            if (GetGraphBuffer(i) > threshold)
+            if (GetGraphBuffer(gb, i) > threshold)
                 lownoisectr = 0;
             else
                 lownoisectr++;
@@ -67,7 +67,7 @@ static uint32_t TexkomSearchStart(uint32_t indx, uint32_t threshold) {
     return 0;
 }
 
-static uint32_t TexkomSearchLength(uint32_t indx, uint32_t threshold) {
+static uint32_t TexkomSearchLength(const int32_t *gb, uint32_t indx, uint32_t threshold) {
     // one bit length = 27, minimal noise = 60
     uint32_t lownoisectr = 0;
     uint32_t datalen = 0;
@@ -75,7 +75,7 @@ static uint32_t TexkomSearchLength(uint32_t indx, uint32_t threshold) {
         if (lownoisectr > 60) {
             break;
         } else {
-            if (GetGraphBuffer(i) > threshold) {
+            if (GetGraphBuffer(gb, i) > threshold) {
                 lownoisectr = 0;
                 datalen = i - indx + 27;
             } else {
@@ -87,29 +87,29 @@ static uint32_t TexkomSearchLength(uint32_t indx, uint32_t threshold) {
     return datalen;
 }
 
-static uint32_t TexkomSearchMax(uint32_t indx, uint32_t len) {
+static uint32_t TexkomSearchMax(const int32_t *gb, uint32_t indx, uint32_t len) {
     uint32_t res = 0;
 
     for (uint32_t i = 0; i < len; i++) {
         if (i + indx > g_GraphTraceLen)
             break;
 
-        if (GetGraphBuffer(indx + i) > res)
-            res = GetGraphBuffer(indx + i);
+        if (GetGraphBuffer(gb, indx + i) > res)
+            res = GetGraphBuffer(gb, indx + i);
     }
 
     return res;
 }
 
-static bool TexkomCorrelate(uint32_t indx, uint32_t threshold) {
+static bool TexkomCorrelate(const int32_t *gb, uint32_t indx, uint32_t threshold) {
     if (indx < 2 || indx + 2 > g_GraphTraceLen)
         return false;
 
-    uint32_t g1 = GetGraphBuffer(indx - 2);
-    uint32_t g2 = GetGraphBuffer(indx - 1);
-    uint32_t g3 = GetGraphBuffer(indx);
-    uint32_t g4 = GetGraphBuffer(indx + 1);
-    uint32_t g5 = GetGraphBuffer(indx + 2);
+    uint32_t g1 = GetGraphBuffer(gb, indx - 2);
+    uint32_t g2 = GetGraphBuffer(gb, indx - 1);
+    uint32_t g3 = GetGraphBuffer(gb, indx);
+    uint32_t g4 = GetGraphBuffer(gb, indx + 1);
+    uint32_t g5 = GetGraphBuffer(gb, indx + 2);
 
     return (
                (g3 > threshold) &&
@@ -460,6 +460,11 @@ static int texkom_get_type(texkom_card_select_t *card, bool verbose) {
         };
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_EFAILED;
+    }
+
     // decode samples to 8 bytes
     char bitstring[256] = {0};
     char cbitstring[128] = {0};
@@ -469,20 +474,20 @@ static int texkom_get_type(texkom_card_select_t *card, bool verbose) {
 
     while (sindx < samplesCount - 5) {
 
-        sindx = TexkomSearchStart(sindx, TEXKOM_NOISE_THRESHOLD);
+        sindx = TexkomSearchStart(gb, sindx, TEXKOM_NOISE_THRESHOLD);
         if (sindx == 0 || sindx > samplesCount - 5) {
-            if (TexkomAVGField() > 30 && verbose) {
+            if (TexkomAVGField(gb) > 30 && verbose) {
                 PrintAndLogEx(WARNING, "Too noisy environment. Try to move the tag from the antenna a bit.");
             }
             break;
         }
 
-        uint32_t slen = TexkomSearchLength(sindx, TEXKOM_NOISE_THRESHOLD);
+        uint32_t slen = TexkomSearchLength(gb, sindx, TEXKOM_NOISE_THRESHOLD);
         if (slen == 0) {
             continue;
         }
 
-        uint32_t maxlvl = TexkomSearchMax(sindx, 1760);
+        uint32_t maxlvl = TexkomSearchMax(gb, sindx, 1760);
         if (maxlvl < TEXKOM_NOISE_THRESHOLD) {
             sindx += 1700;
             continue;
@@ -498,7 +503,7 @@ static int texkom_get_type(texkom_card_select_t *card, bool verbose) {
         uint32_t impulseindx = 0;
         uint32_t impulsecnt = 0;
         for (uint32_t i = 0; i < slen; i++) {
-            if (TexkomCorrelate(sindx + i, noiselvl)) {
+            if (TexkomCorrelate(gb, sindx + i, noiselvl)) {
                 impulsecnt++;
 
                 if (impulseindx != 0) {
@@ -678,24 +683,30 @@ static int CmdHFTexkomReader(const char *Cmd) {
         }
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        PrintAndLogEx(WARNING, "No data available, try reading something first");
+        return PM3_ESOFT;
+    }
+
     char bitstring[256] = {0};
     char cbitstring[128] = {0};
     char genbitstring[256] = {0};
     int codefound = TexkomModError;
     uint32_t sindx = 0;
     while (sindx < samplesCount - 5) {
-        sindx = TexkomSearchStart(sindx, TEXKOM_NOISE_THRESHOLD);
+        sindx = TexkomSearchStart(gb, sindx, TEXKOM_NOISE_THRESHOLD);
         if (sindx == 0 || sindx > samplesCount - 5) {
-            if (TexkomAVGField() > 30)
+            if (TexkomAVGField(gb) > 30)
                 PrintAndLogEx(WARNING, "Too noisy environment. Try to move the tag from the antenna a bit.");
             break;
         }
 
-        uint32_t slen = TexkomSearchLength(sindx, TEXKOM_NOISE_THRESHOLD);
+        uint32_t slen = TexkomSearchLength(gb, sindx, TEXKOM_NOISE_THRESHOLD);
         if (slen == 0)
             continue;
 
-        uint32_t maxlvl = TexkomSearchMax(sindx, 1760);
+        uint32_t maxlvl = TexkomSearchMax(gb, sindx, 1760);
         if (maxlvl < TEXKOM_NOISE_THRESHOLD) {
             sindx += 1700;
             continue;
@@ -712,7 +723,7 @@ static int CmdHFTexkomReader(const char *Cmd) {
         uint32_t impulseindx = 0;
         uint32_t impulsecnt = 0;
         for (uint32_t i = 0; i < slen; i++) {
-            if (TexkomCorrelate(sindx + i, noiselvl)) {
+            if (TexkomCorrelate(gb, sindx + i, noiselvl)) {
                 impulsecnt++;
 
                 if (impulseindx != 0) {
@@ -43,6 +43,8 @@
 #include "util_posix.h"
 #include "flash.h"          // reboot to bootloader mode
 #include "proxgui.h"
+#include "commstats.h"
+#include "fileutils.h"      // saveFileJSONrootEx
 #include "graph.h"          // for graph data
 
 #include "lua.h"
@@ -1075,9 +1077,14 @@ static int CmdTune(const char *Cmd) {
 
     // graph LF measurements
     // even here, these values has 3% error.
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
     uint16_t test1 = 0;
     for (int i = 0; i < 256; i++) {
-        g_GraphBuffer[i] = package->results[i] - 128;
+        gb[i] = package->results[i] - 128;
         test1 += package->results[i];
     }
 
@@ -1255,6 +1262,69 @@ static int CmdTia(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int CmdCommStats(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "hw commstats",
+                  "Show the client side communication counters.\n"
+                  "Frames and bytes each way, round trip times, WTX, timeouts and download rates per command,\n"
+                  "the time spent waiting for the device and the reply buffer counters",
+                  "hw commstats\n"
+                  "hw commstats --reset          -> print and clear the counters\n"
+                  "hw commstats -j               -> print as JSON\n"
+                  "hw commstats -f mystats       -> save as JSON to mystats.json\n"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_lit0("j", "json", "print as JSON"),
+        arg_str0("f", "file", "<fn>", "save as JSON to file"),
+        arg_lit0(NULL, "reset", "clear the counters"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    bool print_json = arg_get_lit(ctx, 1);
+    int fnlen = 0;
+    char filename[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 2), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    bool reset = arg_get_lit(ctx, 3);
+    CLIParserFree(ctx);
+
+    int res = PM3_SUCCESS;
+    if (print_json || fnlen > 0) {
+        json_t *root = commstats_json();
+        if (root == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return PM3_EMALLOC;
+        }
+
+        if (print_json) {
+            char *s = json_dumps(root, JSON_INDENT(2));
+            if (s != NULL) {
+                // line by line, the whole document is longer than a print buffer
+                char *line = strtok(s, "\n");
+                while (line != NULL) {
+                    PrintAndLogEx(NORMAL, "%s", line);
+                    line = strtok(NULL, "\n");
+                }
+                free(s);
+            }
+        }
+
+        if (fnlen > 0) {
+            res = saveFileJSONrootEx(filename, root, JSON_INDENT(2), true, false, spDefault);
+        }
+        json_decref(root);
+    } else {
+        commstats_print();
+    }
+
+    if (reset) {
+        commstats_reset();
+        PrintAndLogEx(INFO, "Communication counters cleared");
+    }
+    return res;
+}
+
 static int CmdTimeout(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -1460,6 +1530,7 @@ int set_fpga_mode(uint8_t mode) {
 static command_t CommandTable[] = {
     {"help",          CmdHelp,         AlwaysAvailable,  "This help"},
     {"-------------", CmdHelp,         AlwaysAvailable,  "----------------------- " _CYAN_("Operation") " -----------------------"},
+    {"commstats",     CmdCommStats,    AlwaysAvailable,  "Show client side communication counters"},
     {"detectreader",  CmdDetectReader, IfPm3Present,     "Detect external reader field"},
     {"status",        CmdStatus,       IfPm3Present,     "Show runtime status information about the connected Proxmark3"},
     {"tearoff",       CmdTearoff,      IfPm3Present,     "Program a tearoff hook for the next command supporting tearoff"},
@@ -70,6 +70,9 @@
 #include "crc.h"
 #include "pm3_cmd.h"        // for LF_CMDREAD_MAX_EXTRA_SYMBOLS
 #include "fpga.h"           // for set_fpga_mode
+#include "lfstream.h"       // streaming demod for realtime read / sniff
+#include "util.h"           // num_CPUs
+#include "sigfile.h"          // capture info for binary trace files
 
 static int CmdHelp(const char *Cmd);
 
@@ -474,12 +477,17 @@ int CmdFlexdemod(const char *Cmd) {
 #endif
     int i, j, start, bit, sum;
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_ESOFT;
+    }
+
     int *data = calloc(g_GraphTraceLen, sizeof(int));
     if (data == NULL) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    memcpy(data, g_GraphBuffer, g_GraphTraceLen);
+    memcpy(data, gb, g_GraphTraceLen);
 
     size_t size = g_GraphTraceLen;
 
@@ -531,6 +539,11 @@ int CmdFlexdemod(const char *Cmd) {
 
     // iceman,  use g_DemodBuffer?  blue line?
     // HACK writing back to graphbuffer.
+    int32_t *out = graph_write();
+    if (out == NULL) {
+        free(data);
+        return PM3_EMALLOC;
+    }
     g_GraphTraceLen = 32 * 64;
     i = 0;
     for (bit = 0; bit < 64; bit++) {
@@ -538,7 +551,7 @@ int CmdFlexdemod(const char *Cmd) {
         int phase = (bits[bit] == 0) ? 0 : 1;
 
         for (j = 0; j < 32; j++) {
-            g_GraphBuffer[i++] = phase;
+            out[i++] = phase;
             phase = !phase;
         }
     }
@@ -742,6 +755,23 @@ int CmdLFConfig(const char *Cmd) {
     return lf_setconfig(&config);
 }
 
+// parses the optional --decode <ask|fsk> modulation
+static int lf_get_decode_mod(CLIParserContext *ctx, int paramnum, bool *decode, lfstream_mod_t *mod) {
+    char modstr[8] = {0};
+    int slen = 0;
+    CLIParamStrToBuf(arg_get_str(ctx, paramnum), (uint8_t *)modstr, sizeof(modstr) - 1, &slen);
+    *decode = (slen > 0);
+    if (*decode == false) {
+        return PM3_SUCCESS;
+    }
+    str_lower(modstr);
+    if (lfstream_mod_from_str(modstr, mod) != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "Unknown modulation `" _YELLOW_("%s") "`, use ask or fsk", modstr);
+        return PM3_EINVARG;
+    }
+    return PM3_SUCCESS;
+}
+
 static int lf_read_internal(bool realtime, bool verbose, uint64_t samples) {
     if (!g_session.pm3_present) return PM3_ENOTTY;
 
@@ -792,6 +822,7 @@ static int lf_read_internal(bool realtime, bool verbose, uint64_t samples) {
         PrintAndLogEx(INFO, "Done: %" PRIu64 " samples (%zu bytes)", samples, sample_bytes);
         if (samples != 0) {
             getSamplesFromBufEx(realtimeBuf, samples, bits_per_sample, verbose);
+            sigfile_set_capture(&current_config, "device lf realtime");
         }
 
         free(realtimeBuf);
@@ -821,6 +852,121 @@ int lf_read(bool verbose, uint64_t samples) {
     return lf_read_internal(false, verbose, samples);
 }
 
+typedef struct {
+    lfstream_t stream;
+    uint8_t *capture;       // raw samples, loaded into the graph afterwards
+    size_t capture_len;
+    size_t capture_size;    // allocated
+    size_t capture_max;     // what the graph can hold
+} lf_stream_ctx_t;
+
+static void lf_stream_print_frame(const lfstream_frame_t *frame, void *ctx) {
+    (void)ctx;
+    char id[64] = {0};
+    if (frame->hi2) {
+        snprintf(id, sizeof(id), "%x%08x%08x", frame->hi2, frame->hi, (uint32_t)frame->lo);
+    } else if (strcmp(frame->protocol, "HID") == 0) {
+        snprintf(id, sizeof(id), "%x%08x", frame->hi, (uint32_t)frame->lo);
+    } else if (frame->hi) {
+        snprintf(id, sizeof(id), "%x%016" PRIx64, frame->hi, frame->lo);
+    } else if (strcmp(frame->protocol, "EM410x") == 0) {
+        snprintf(id, sizeof(id), "%010" PRIX64, frame->lo);
+    } else {
+        snprintf(id, sizeof(id), "%016" PRIx64, frame->lo);
+    }
+    PrintAndLogEx(SUCCESS, "%12" PRIu64 " | " _GREEN_("%-6s") " | RF/%-3d | " _YELLOW_("%s"), frame->sample_pos, frame->protocol, frame->clock, id);
+}
+
+static void lf_stream_data(const uint8_t *data, size_t len, void *ctx) {
+    lf_stream_ctx_t *sctx = (lf_stream_ctx_t *)ctx;
+
+    size_t n = MIN(len, sctx->capture_max - sctx->capture_len);
+    if (sctx->capture_len + n > sctx->capture_size) {
+        size_t size = MIN(MAX(sctx->capture_size * 2, sctx->capture_len + n), sctx->capture_max);
+        uint8_t *tmp = realloc(sctx->capture, size);
+        if (tmp) {
+            sctx->capture = tmp;
+            sctx->capture_size = size;
+        }
+        n = MIN(n, sctx->capture_size - sctx->capture_len);
+    }
+    if (n) {
+        memcpy(sctx->capture + sctx->capture_len, data, n);
+        sctx->capture_len += n;
+    }
+    lfstream_feed(&sctx->stream, data, len);
+}
+
+// Realtime read / sniff which demodulates while the samples arrive instead of afterwards.
+// samples == 0 keeps going until <Enter> is pressed or the device stops sending.
+static int lf_stream_decode(bool sniff, bool verbose, uint64_t samples, lfstream_mod_t mod) {
+    if (!g_session.pm3_present) return PM3_ENOTTY;
+
+    lf_sample_payload_t payload = {0};
+    payload.realtime = true;
+    payload.verbose = verbose;
+
+    sample_config current_config;
+    int res = lf_getconfig(&current_config);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(ERR, "failed to get current device config");
+        return res;
+    }
+    clearCommandBuffer();
+    const uint8_t bits_per_sample = current_config.bits_per_sample;
+    const bool is_trigger_threshold_set = (current_config.trigger_threshold > 0);
+
+    lf_stream_ctx_t sctx = {0};
+    res = lfstream_init(&sctx.stream, mod, bits_per_sample, lf_stream_print_frame, NULL);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return res;
+    }
+
+    // grows while receiving,  long sniffs are kept up to what the graph can hold
+    sctx.capture_max = (GRAPH_TRACE_LEN_LIMIT * bits_per_sample) / 8;
+    sctx.capture_size = ((size_t)MAX_GRAPH_TRACE_LEN * bits_per_sample) / 8;
+    sctx.capture = calloc(sctx.capture_size, sizeof(uint8_t));
+    if (sctx.capture == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        lfstream_free(&sctx.stream);
+        return PM3_EMALLOC;
+    }
+
+    size_t sample_bytes = samples * bits_per_sample;
+    sample_bytes = (sample_bytes / 8) + (sample_bytes % 8 != 0);
+
+    // In real-time mode, the LF bitstream should be loaded before receiving raw data.
+    res = set_fpga_mode(FPGA_BITSTREAM_LF);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "failed to load LF bitstream to FPGA");
+        free(sctx.capture);
+        lfstream_free(&sctx.stream);
+        return res;
+    }
+
+    PrintAndLogEx(INFO, "Decoding " _YELLOW_("%s") " frames while receiving, press " _GREEN_("<Enter>") " to stop", lfstream_mod_to_str(mod));
+    PrintAndLogEx(INFO, "      sample | proto  | clock  | id");
+    PrintAndLogEx(INFO, "-------------+--------+--------+-----------------");
+
+    SendCommandNG(sniff ? CMD_LF_SNIFF_RAW_ADC : CMD_LF_ACQ_RAW_ADC, (uint8_t *)&payload, sizeof(payload));
+    // with a trigger set, nothing arrives until it fires
+    size_t got = WaitForRawDataStream(sample_bytes, is_trigger_threshold_set ? (size_t) - 1 : 1000, verbose, lf_stream_data, &sctx);
+    lfstream_flush(&sctx.stream);
+
+    PrintAndLogEx(INFO, "Done: %" PRIu64 " samples (%zu bytes), " _YELLOW_("%u") " frames, %u repeats",
+                  sctx.stream.samples_total, got, sctx.stream.frames, sctx.stream.repeats);
+
+    if (sctx.capture_len) {
+        size_t captured = (sctx.capture_len * 8) / bits_per_sample;
+        getSamplesFromBufEx(sctx.capture, captured, bits_per_sample, verbose);
+    }
+
+    free(sctx.capture);
+    lfstream_free(&sctx.stream);
+    return PM3_SUCCESS;
+}
+
 int CmdLFRead(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "lf read",
@@ -831,6 +977,7 @@ int CmdLFRead(const char *Cmd) {
                   _CYAN_("it will try to use the real-time sampling mode."),
                   "lf read -v -s 12000   --> collect 12000 samples\n"
                   "lf read -s 3000 -@    --> oscilloscope style \n"
+                  "lf read --decode ask  --> decode EM410x frames while reading, until <Enter>\n"
                  );
 
     void *argtable[] = {
@@ -838,21 +985,32 @@ int CmdLFRead(const char *Cmd) {
         arg_u64_0("s", "samples", "<dec>", "number of samples to collect"),
         arg_lit0("v", "verbose", "verbose output"),
         arg_lit0("@", NULL, "continuous reading mode"),
+        arg_str0(NULL, "decode", "<ask|fsk>", "real-time mode, decode frames while samples arrive"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     uint64_t samples = arg_get_u64_def(ctx, 1, 0);
     bool verbose = arg_get_lit(ctx, 2);
     bool cm = arg_get_lit(ctx, 3);
+    lfstream_mod_t mod = LFSTREAM_ASK;
+    bool decode = false;
+    if (lf_get_decode_mod(ctx, 4, &decode, &mod) != PM3_SUCCESS) {
+        CLIParserFree(ctx);
+        return PM3_EINVARG;
+    }
     CLIParserFree(ctx);
 
+    if (g_session.pm3_present == false)
+        return PM3_ENOTTY;
+
+    if (decode) {
+        return lf_stream_decode(false, verbose, samples, mod);
+    }
+
     // the 40000 there should be the result of BigBuf_max_traceLen(),
     // but IDK how to get it.
     bool realtime = samples > 40000;
 
-    if (g_session.pm3_present == false)
-        return PM3_ENOTTY;
-
     if (cm || realtime) {
         PrintAndLogEx(INFO, "Press " _GREEN_("<Enter>") " to exit");
     }
@@ -921,6 +1079,7 @@ int lf_sniff(bool realtime, bool verbose, uint64_t samples) {
         PrintAndLogEx(INFO, "Done: %" PRIu64 " samples (%zu bytes)", samples, sample_bytes);
         if (samples != 0) {
             getSamplesFromBufEx(realtimeBuf, samples, bits_per_sample, verbose);
+            sigfile_set_capture(&current_config, "device lf realtime");
         }
 
         free(realtimeBuf);
@@ -957,6 +1116,7 @@ int CmdLFSniff(const char *Cmd) {
                   _CYAN_("it will try to use the real-time sampling mode."),
                   "lf sniff -v\n"
                   "lf sniff -s 3000 -@    --> oscilloscope style \n"
+                  "lf sniff --decode fsk  --> decode HID / AWID / ioProx frames while sniffing, until <Enter>\n"
                  );
 
     void *argtable[] = {
@@ -964,21 +1124,32 @@ int CmdLFSniff(const char *Cmd) {
         arg_u64_0("s", "samples", "<dec>", "number of samples to collect"),
         arg_lit0("v", "verbose", "verbose output"),
         arg_lit0("@", NULL, "continuous sniffing mode"),
+        arg_str0(NULL, "decode", "<ask|fsk>", "real-time mode, decode frames while samples arrive"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     uint64_t samples = arg_get_u64_def(ctx, 1, 0);
     bool verbose = arg_get_lit(ctx, 2);
     bool cm = arg_get_lit(ctx, 3);
+    lfstream_mod_t mod = LFSTREAM_ASK;
+    bool decode = false;
+    if (lf_get_decode_mod(ctx, 4, &decode, &mod) != PM3_SUCCESS) {
+        CLIParserFree(ctx);
+        return PM3_EINVARG;
+    }
     CLIParserFree(ctx);
 
+    if (g_session.pm3_present == false)
+        return PM3_ENOTTY;
+
+    if (decode) {
+        return lf_stream_decode(true, verbose, samples, mod);
+    }
+
     // the 40000 there should be the result of BigBuf_max_traceLen(),
     // but IDK how to get it.
     bool realtime = samples > 40000;
 
-    if (g_session.pm3_present == false)
-        return PM3_ENOTTY;
-
     if (cm || realtime) {
         PrintAndLogEx(INFO, "Press " _GREEN_("<Enter>") " to exit");
     }
@@ -990,9 +1161,14 @@ int CmdLFSniff(const char *Cmd) {
 }
 
 static void lf_chk_bitstream(void) {
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return;
+    }
+
     // convert to bitstream if necessary
     for (int i = 0; i < (int)(g_GraphTraceLen / 2); i++) {
-        if (g_GraphBuffer[i] > 1 || g_GraphBuffer[i] < 0) {
+        if (gb[i] > 1 || gb[i] < 0) {
             CmdGetBitStream("");
             PrintAndLogEx(INFO, "converted Graphbuffer to bitstream values (0|1)");
             break;
@@ -1004,6 +1180,11 @@ static void lf_chk_bitstream(void) {
 int lfsim_upload_gb(void) {
     PrintAndLogEx(DEBUG, "DEBUG: Uploading %zu bytes", g_GraphTraceLen);
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_ENODATA;
+    }
+
     struct pupload {
         uint8_t flag;
         uint16_t offset;
@@ -1029,7 +1210,7 @@ int lfsim_upload_gb(void) {
         payload_up.offset = i;
 
         for (size_t j = 0; j < len; j++)
-            payload_up.data[j] = g_GraphBuffer[i + j];
+            payload_up.data[j] = gb[i + j];
 
         SendCommandNG(CMD_LF_UPLOAD_SIM_SAMPLES, (uint8_t *)&payload_up, sizeof(struct pupload));
         WaitForResponse(CMD_LF_UPLOAD_SIM_SAMPLES, &resp);
@@ -1566,7 +1747,7 @@ static bool check_chiptype(bool getDeviceData) {
     }
 
     //Save the state of the Graph and Demod Buffers
-    buffer_savestate_t saveState_gb = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    buffer_savestate_t saveState_gb = save_graph_buffer();
     saveState_gb.offset = g_GridOffset;
     buffer_savestate_t saveState_db = save_buffer8(g_DemodBuffer, g_DemodBufferLen);
     saveState_db.clock = g_DemodClock;
@@ -1642,18 +1823,256 @@ out:
     g_DemodClock = saveState_db.clock;
     g_DemodStartIdx = saveState_db.offset;
 
-    restore_bufferS32(saveState_gb, g_GraphBuffer);
+    restore_graph_buffer(&saveState_gb);
     g_GridOffset = saveState_gb.offset;
 
     return retval;
 }
 
+static int lf_search_paradox(demod_ctx_t *dctx, bool verbose) {
+    return demodParadox(dctx, verbose, false);
+}
+
+static int lf_search_idteck(demod_ctx_t *dctx, bool verbose) {
+    return demodIdteck(dctx, NULL, verbose);
+}
+
+typedef struct {
+    demod_fn_t demod;
+    const char *name;
+} lf_search_demod_t;
+
+// known tag demodulators tried by `lf search`, in the order they are reported
+static const lf_search_demod_t lf_search_demods[] = {
+    // ask / man
+    {demodEM410x,       "EM410x ID"},
+    {demodDestron,      "FDX-A FECAVA Destron ID"},  // to do before HID
+    {demodGallagher,    "GALLAGHER ID"},
+    {demodNoralsy,      "Noralsy ID"},
+    {demodPresco,       "Presco ID"},
+    {demodSecurakey,    "Securakey ID"},
+    {demodViking,       "Viking ID"},
+    {demodVisa2k,       "Visa2000 ID"},
+    // ask / bi
+    {demodFDXB,         "FDX-B ID"},
+    {demodJablotron,    "Jablotron ID"},
+    {demodGuard,        "Guardall G-Prox II ID"},
+    {demodNedap,        "NEDAP ID"},
+    // nrz
+    {demodPac,          "PAC/Stanley ID"},
+    // fsk
+    {demodHID,          "HID Prox ID"},
+    {demodAWID,         "AWID ID"},
+    {demodIOProx,       "IO Prox ID"},
+    {demodPyramid,      "Pyramid ID"},
+    {lf_search_paradox, "Paradox ID"},
+    // psk
+    {lf_search_idteck,  "Idteck ID"},
+    {demodKeri,         "KERI ID"},
+    {demodNexWatch,     "NexWatch ID"},
+    {demodIndala,       "Indala ID"},
+    // {demodTI,        "Texas Instrument ID"},
+    // {demodFermax,    "Fermax ID"},
+};
+
+typedef struct {
+    bool ran;
+    int res;
+    log_capture_t log;      // output,  printed when the job is reported
+    bool demod_changed;
+    bool graph_changed;
+    demod_ctx_t result;     // demod state left behind,  sized to what is used,  and the samples
+} lf_search_job_t;
+
+typedef struct {
+    lf_search_job_t *jobs;
+    size_t count;
+    size_t next;            // next job to run
+    size_t stop;            // first match when not continuing,  later jobs are skipped
+    bool search_cont;
+    const demod_ctx_t *src; // samples and demod state all demodulators start from
+    signal_t signal;
+} lf_search_queue_t;
+
+// keep what a demodulator changed so it can be taken over in report order
+static void lf_search_keep(lf_search_job_t *job, demod_ctx_t *dctx, const demod_ctx_t *src) {
+
+    job->demod_changed = (dctx->demod_len != src->demod_len)
+                         || (dctx->demod_clock != src->demod_clock)
+                         || (dctx->demod_start_idx != src->demod_start_idx)
+                         || (memcmp(dctx->demod, src->demod, dctx->demod_len) != 0);
+
+    job->graph_changed = (demod_ctx_graph_equal(dctx, src) == false);
+
+    if (job->demod_changed) {
+        job->result.demod = malloc(dctx->demod_len + 1);
+        if (job->result.demod == NULL) {
+            job->demod_changed = false;
+        } else {
+            memcpy(job->result.demod, dctx->demod, dctx->demod_len);
+            job->result.demod_len = dctx->demod_len;
+            job->result.demod_clock = dctx->demod_clock;
+            job->result.demod_start_idx = dctx->demod_start_idx;
+        }
+    }
+
+    if (job->graph_changed) {
+        demod_ctx_share_graph(&job->result, dctx);
+    }
+}
+
+static void lf_search_adopt(lf_search_job_t *job) {
+
+    if (job->graph_changed) {
+        demod_ctx_t dctx;
+        demod_ctx_share_graph(demod_ctx_main_get(&dctx), &job->result);
+        RepaintGraphWindow();
+    }
+
+    if (job->demod_changed) {
+        memcpy(g_DemodBuffer, job->result.demod, job->result.demod_len);
+        g_DemodBufferLen = job->result.demod_len;
+        g_DemodClock = job->result.demod_clock;
+        g_DemodStartIdx = job->result.demod_start_idx;
+        setPlotGrid(g_DemodClock, g_DemodStartIdx);
+    }
+}
+
+static void *lf_search_worker(void *arg) {
+    lf_search_queue_t *q = (lf_search_queue_t *)arg;
+
+    demod_ctx_t dctx;
+    if (demod_ctx_init(&dctx) != PM3_SUCCESS) {
+        return NULL;
+    }
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&q->next, 1, __ATOMIC_SEQ_CST);
+        if (i >= q->count || i > __atomic_load_n(&q->stop, __ATOMIC_SEQ_CST)) {
+            break;
+        }
+
+        lf_search_job_t *job = &q->jobs[i];
+        demod_ctx_copy(&dctx, q->src);
+        *getSignalProperties() = q->signal;
+
+        PrintAndLogCaptureStart(&job->log);
+        job->res = lf_search_demods[i].demod(&dctx, true);
+        PrintAndLogCaptureStop();
+
+        lf_search_keep(job, &dctx, q->src);
+        job->ran = true;
+
+        if (job->res == PM3_SUCCESS && q->search_cont == false) {
+            size_t stop = __atomic_load_n(&q->stop, __ATOMIC_SEQ_CST);
+            while (i < stop) {
+                if (__atomic_compare_exchange_n(&q->stop, &stop, i, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+                    break;
+                }
+            }
+        }
+    }
+
+    demod_ctx_free(&dctx);
+    return NULL;
+}
+
+// Run all known tag demodulators over the graph buffer.
+// Each worker thread demodulates on a private context,  a copy of the samples,  the output
+// and the demod state of every demodulator are then taken over in table order, so the result
+// is the same as running them one after the other.  Jobs no worker ran (single core) run
+// here,  on the main context.
+// returns true when a tag was found and searching should stop
+static bool lf_search_known(bool search_cont, int *found) {
+
+    size_t count = ARRAYLEN(lf_search_demods);
+    lf_search_job_t *jobs = calloc(count, sizeof(lf_search_job_t));
+    if (jobs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return false;
+    }
+
+    // what the workers start from,  the main context stays untouched until they are done
+    demod_ctx_t src, dmain;
+    if (demod_ctx_init(&src) != PM3_SUCCESS) {
+        free(jobs);
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return false;
+    }
+    demod_ctx_copy(&src, demod_ctx_main_get(&dmain));
+
+    lf_search_queue_t q = {
+        .jobs = jobs,
+        .count = count,
+        .next = 0,
+        .stop = count,
+        .search_cont = search_cont,
+        .src = &src,
+        .signal = *getSignalProperties(),
+    };
+
+    int thread_count = MIN(num_CPUs(), (int)count);
+    if (thread_count > 1) {
+
+        pthread_t threads[thread_count];
+        int started = 0;
+        for (int i = 0; i < thread_count; i++) {
+            if (pthread_create(&threads[started], NULL, lf_search_worker, &q) == 0) {
+                started++;
+            }
+        }
+
+        for (int i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    bool stop = false;
+    for (size_t i = 0; i < count && stop == false; i++) {
+
+        lf_search_job_t *job = &jobs[i];
+
+        int res;
+        if (job->ran) {
+            PrintAndLogCaptureReplay(&job->log);
+            lf_search_adopt(job);
+            res = job->res;
+        } else {
+            res = demod_ctx_run_main(lf_search_demods[i].demod, true);
+        }
+
+        if (res == PM3_SUCCESS) {
+            PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("%s") " found!", lf_search_demods[i].name);
+            if (search_cont) {
+                (*found)++;
+            } else {
+                stop = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        PrintAndLogCaptureFree(&jobs[i].log);
+        demod_ctx_drop_graph(&jobs[i].result);
+        free(jobs[i].result.demod);
+    }
+    free(jobs);
+    demod_ctx_free(&src);
+    return stop;
+}
+
 static int check_autocorrelate(const char *prefix, int clock) {
 
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(INFO, _CYAN_("%s - auto correlations"), prefix);
+
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_ESOFT;
+    }
+
     for (int win = 2000; win < 30000; win += 2000) {
-        int samples = AutoCorrelate(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, win, false, false);
+        int samples = AutoCorrelate(gb, NULL, g_GraphTraceLen, win, false, false, false);
         if (samples == -1) {
             continue;
         }
@@ -1795,209 +2214,11 @@ int CmdLFfind(const char *Cmd) {
         }
     }
 
-    // ask / man
-    if (demodEM410x(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("EM410x ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodDestron(true) == PM3_SUCCESS) { // to do before HID
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-A FECAVA Destron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGallagher(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("GALLAGHER ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNoralsy(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Noralsy ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPresco(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Presco ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodSecurakey(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Securakey ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodViking(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Viking ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodVisa2k(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Visa2000 ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // ask / bi
-    if (demodFDXB(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-B ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodJablotron(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Jablotron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGuard(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Guardall G-Prox II ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNedap(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NEDAP ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // nrz
-    if (demodPac(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("PAC/Stanley ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // fsk
-    if (demodHID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("HID Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodAWID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("AWID ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIOProx(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("IO Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPyramid(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Pyramid ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodParadox(true, false) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Paradox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
+    // known tags,  the demodulators run in parallel and are reported in table order
+    if (lf_search_known(search_cont, &found)) {
+        goto out;
     }
 
-    // psk
-    if (demodIdteck(NULL, true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Idteck ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodKeri(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("KERI ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNexWatch(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NexWatch ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIndala(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Indala ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    /*
-    if (demodTI() == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Texas Instrument ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodFermax() == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Fermax ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    */
     if (found == 0) {
         PrintAndLogEx(FAILED, _RED_("No known 125/134 kHz tags found!"));
     }
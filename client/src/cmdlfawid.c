@@ -147,7 +147,7 @@ static int CmdAWIDWatch(const char *Cmd) {
 //by marshmellow
 //AWID Prox demod - FSK2a RF/50 with preamble of 00000001  (always a 96 bit data stream)
 //print full AWID Prox ID and some bit format details if found
-int demodAWID(bool verbose) {
+int demodAWID(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     uint8_t *bits = calloc(MAX_GRAPH_TRACE_LEN, sizeof(uint8_t));
     if (bits == NULL) {
@@ -155,7 +155,7 @@ int demodAWID(bool verbose) {
         return PM3_EMALLOC;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - AWID not enough samples");
         free(bits);
@@ -183,8 +183,8 @@ int demodAWID(bool verbose) {
         return PM3_ESOFT;
     }
 
-    setDemodBuff(bits, size, idx);
-    setClockGrid(50, waveIdx + (idx * 50));
+    setDemodBuff_ctx(dctx, bits, size, idx);
+    setClockGrid_ctx(dctx, 50, waveIdx + (idx * 50));
 
 
     // Index map
@@ -300,8 +300,8 @@ int demodAWID(bool verbose) {
     PrintAndLogEx(DEBUG, "DEBUG: AWID idx: %d, Len: %zu", idx, size);
     PrintAndLogEx(DEBUG, "DEBUG: Printing DemodBuffer:");
     if (g_debugMode) {
-        printDemodBuff(0, false, false, true);
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, true);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
 
     return PM3_SUCCESS;
@@ -322,7 +322,7 @@ static int CmdAWIDDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodAWID(true);
+    return demod_ctx_run_main(demodAWID, true);
 }
 
 // this read is the "normal" read,  which download lf signal and tries to demod here.
@@ -348,7 +348,7 @@ static int CmdAWIDReader(const char *Cmd) {
 
     do {
         lf_read(false, 12000);
-        demodAWID(!cm);
+        demod_ctx_run_main(demodAWID, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -20,10 +20,11 @@
 #define CMDLFAWID_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFAWID(const char *Cmd);
 
-int demodAWID(bool verbose);
+int demodAWID(demod_ctx_t *dctx, bool verbose);
 int getAWIDBits(uint8_t fmtlen, uint32_t fc, uint32_t cn, uint8_t *bits);
 
 #endif
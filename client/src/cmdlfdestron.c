@@ -38,16 +38,16 @@
 
 static int CmdHelp(const char *Cmd);
 
-int demodDestron(bool verbose) {
+int demodDestron(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     //PSK1
-    if (FSKrawDemod(0, 0, 0, 0, false) != PM3_SUCCESS) {
+    if (FSKrawDemod_ctx(dctx, 0, 0, 0, 0, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Destron: FSK Demod failed");
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
-    int ans = detectDestron(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectDestron(dctx->demod, &size);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - Destron: too few bits found");
@@ -61,12 +61,12 @@ int demodDestron(bool verbose) {
         return PM3_ESOFT;
     }
 
-    setDemodBuff(g_DemodBuffer, DESTRON_FRAME_SIZE, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, DESTRON_FRAME_SIZE, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     uint8_t bits[DESTRON_FRAME_SIZE - DESTRON_PREAMBLE_SIZE] = {0};
     size_t bitlen = DESTRON_FRAME_SIZE - DESTRON_PREAMBLE_SIZE;
-    memcpy(bits, g_DemodBuffer + DESTRON_PREAMBLE_SIZE, DESTRON_FRAME_SIZE - DESTRON_PREAMBLE_SIZE);
+    memcpy(bits, dctx->demod + DESTRON_PREAMBLE_SIZE, DESTRON_FRAME_SIZE - DESTRON_PREAMBLE_SIZE);
 
     uint8_t alignPos = 0;
     uint16_t errCnt = manrawdecode(bits, &bitlen, 0, &alignPos);
@@ -103,7 +103,7 @@ static int CmdDestronDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodDestron(true);
+    return demod_ctx_run_main(demodDestron, true);
 }
 
 static int CmdDestronReader(const char *Cmd) {
@@ -128,7 +128,7 @@ static int CmdDestronReader(const char *Cmd) {
 
     do {
         lf_read(false, 16000);
-        demodDestron(!cm);
+        demod_ctx_run_main(demodDestron, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
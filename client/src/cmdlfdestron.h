@@ -19,10 +19,11 @@
 #define CMDLFDESTRON_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFDestron(const char *Cmd);
 int detectDestron(uint8_t *dest, size_t *size);
-int demodDestron(bool verbose);
+int demodDestron(demod_ctx_t *dctx, bool verbose);
 int readDestronUid(void);
 #endif
 
@@ -106,7 +106,7 @@ static void em410x_construct_emul_graph(uint8_t *uid, uint8_t clock, uint8_t gap
 }
 
 // print 64 bit EM410x ID in multiple formats
-void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type) {
+void printEM410x_ctx(const demod_ctx_t *dctx, uint32_t hi, uint64_t id, bool verbose, int type) {
 
     if (!id && !hi) return;
 
@@ -132,7 +132,7 @@ void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type) {
 
     if (type & 0x2) { // Long ID
         //output 88 bit em id
-        PrintAndLogEx(SUCCESS, "EM 410x XL ID "_GREEN_("%06X%016" PRIX64)" ( RF/%d )", hi, id, g_DemodClock);
+        PrintAndLogEx(SUCCESS, "EM 410x XL ID "_GREEN_("%06X%016" PRIX64)" ( RF/%d )", hi, id, dctx->demod_clock);
     }
     if (type & 0x4) { // Short Extended ID
         PrintAndLogEx(SUCCESS, "EM 410x Short ID found on a 128b frame");
@@ -156,7 +156,7 @@ void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type) {
             }
         }
         PrintAndLogEx(SUCCESS, "EM 410x ID "_GREEN_("%010" PRIX64), id);
-        PrintAndLogEx(SUCCESS, "EM410x ( RF/%d )", g_DemodClock);
+        PrintAndLogEx(SUCCESS, "EM410x ( RF/%d )", dctx->demod_clock);
         PrintAndLogEx(INFO, "-------- " _CYAN_("Possible de-scramble patterns") " ---------");
         PrintAndLogEx(SUCCESS, "Unique TAG ID      : %010" PRIX64, id2lo);
         PrintAndLogEx(INFO, "HoneyWell IdentKey");
@@ -237,8 +237,13 @@ void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type) {
     }
 }
 
+void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type) {
+    demod_ctx_t dctx;
+    printEM410x_ctx(demod_ctx_main_get(&dctx), hi, id, verbose, type);
+}
+
 // takes 1s and 0s and searches for EM410x format - output EM ID
-static int ask_em410x_binary_decode(bool verbose, uint32_t *hi, uint64_t *lo, uint8_t *bits, size_t *size, size_t *idx) {
+static int ask_em410x_binary_decode(demod_ctx_t *dctx, bool verbose, uint32_t *hi, uint64_t *lo, uint8_t *bits, size_t *size, size_t *idx) {
 
     int ans = Em410xDecode(bits, size, idx, hi, lo);
     if (ans < 0) {
@@ -261,10 +266,10 @@ static int ask_em410x_binary_decode(bool verbose, uint32_t *hi, uint64_t *lo, ui
 
     PrintAndLogEx(DEBUG, "DEBUG: Em410x idx: %zu, Len: %zu, Printing DemodBuffer:", *idx, *size);
     if (g_debugMode) {
-        printDemodBuff(0, false, false, true);
+        printDemodBuff_ctx(dctx, 0, false, false, true);
     }
 
-    printEM410x(*hi, *lo, verbose, ans);
+    printEM410x_ctx(dctx, *hi, *lo, verbose, ans);
     gs_em410xid = *lo;
     return PM3_SUCCESS;
 }
@@ -278,35 +283,49 @@ static int ask_em410x_binary_decode(bool verbose, uint32_t *hi, uint64_t *lo, ui
  *   0                     <-- stop bit, end of tag
  */
 int AskEm410xDecode(bool verbose, uint32_t *hi, uint64_t *lo) {
+    demod_ctx_t dctx;
+    int res = AskEm410xDecode_ctx(demod_ctx_main_get(&dctx), verbose, hi, lo);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int AskEm410xDecode_ctx(demod_ctx_t *dctx, bool verbose, uint32_t *hi, uint64_t *lo) {
     size_t idx = 0;
     uint8_t bits[512] = {0};
     size_t size = sizeof(bits);
-    if (getDemodBuff(bits, &size) == false) {
+    if (getDemodBuff_ctx(dctx, bits, &size) == false) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Em410x problem during copy from ASK demod");
         return PM3_ESOFT;
     }
 
-    int ret = ask_em410x_binary_decode(verbose, hi, lo, bits, &size, &idx);
+    int ret = ask_em410x_binary_decode(dctx, verbose, hi, lo, bits, &size, &idx);
 
     if (ret == PM3_SUCCESS) {
         // set g_GraphBuffer for clone or sim command
-        setDemodBuff(g_DemodBuffer, (size == 40) ? 64 : 128, idx + 1);
-        setClockGrid(g_DemodClock, g_DemodStartIdx + ((idx + 1)*g_DemodClock));
+        setDemodBuff_ctx(dctx, dctx->demod, (size == 40) ? 64 : 128, idx + 1);
+        setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + ((idx + 1)*dctx->demod_clock));
     }
     return ret;
 }
 
 int AskEm410xDemod(int clk, int invert, int maxErr, size_t maxLen, bool amplify, uint32_t *hi, uint64_t *lo, bool verbose) {
+    demod_ctx_t dctx;
+    int res = AskEm410xDemod_ctx(demod_ctx_main_get(&dctx), clk, invert, maxErr, maxLen, amplify, hi, lo, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int AskEm410xDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxLen, bool amplify, uint32_t *hi, uint64_t *lo, bool verbose) {
     bool st = true;
 
     // em410x simulation etc uses 0/1 as signal data. This must be converted in order to demod it back again
-    if (isGraphBitstream()) {
-        convertGraphFromBitstream();
+    if (isGraphBitstream_ctx(dctx)) {
+        convertGraphFromBitstream_ctx(dctx);
     }
-    if (ASKDemod_ext(clk, invert, maxErr, maxLen, amplify, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, clk, invert, maxErr, maxLen, amplify, false, false, 1, &st) != PM3_SUCCESS) {
         return PM3_ESOFT;
     }
-    return AskEm410xDecode(verbose, hi, lo);
+    return AskEm410xDecode_ctx(dctx, verbose, hi, lo);
 }
 
 // this read loops on device side.
@@ -336,11 +355,11 @@ static int CmdEM410xWatch(const char *Cmd) {
 //takes 3 arguments - clock, invert and maxErr as integers
 //attempts to demodulate ask while decoding manchester
 //prints binary found and saves in graphbuffer for further commands
-int demodEM410x(bool verbose) {
+int demodEM410x(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     uint32_t hi = 0;
     uint64_t lo = 0;
-    return AskEm410xDemod(0, 0, 100, 0, false, &hi, &lo, true);
+    return AskEm410xDemod_ctx(dctx, 0, 0, 100, 0, false, &hi, &lo, true);
 }
 
 static int CmdEM410xDemod(const char *Cmd) {
@@ -385,7 +404,8 @@ static int CmdEM410xDemod(const char *Cmd) {
         size_t start_idx = 0;
         uint8_t arr[258];
         binstr_2_binarray(arr, (char *)bin, bin_len);
-        return ask_em410x_binary_decode(true, &hi, &lo, arr, &demodlen, &start_idx);
+        demod_ctx_t dctx;
+        return ask_em410x_binary_decode(demod_ctx_main_get(&dctx), true, &hi, &lo, arr, &demodlen, &start_idx);
     }
 
     if (AskEm410xDemod(clk, invert, max_err, max_len, amplify, &hi, &lo, true) != PM3_SUCCESS) {
@@ -20,13 +20,17 @@
 #define CMDLFEM410X_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFEM410X(const char *Cmd);
 
-int demodEM410x(bool verbose);
+int demodEM410x(demod_ctx_t *dctx, bool verbose);
 void printEM410x(uint32_t hi, uint64_t id, bool verbose, int type);
+void printEM410x_ctx(const demod_ctx_t *dctx, uint32_t hi, uint64_t id, bool verbose, int type);
 
 int AskEm410xDecode(bool verbose, uint32_t *hi, uint64_t *lo);
 int AskEm410xDemod(int clk, int invert, int maxErr, size_t maxLen, bool amplify, uint32_t *hi, uint64_t *lo, bool verbose);
+int AskEm410xDecode_ctx(demod_ctx_t *dctx, bool verbose, uint32_t *hi, uint64_t *lo);
+int AskEm410xDemod_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, size_t maxLen, bool amplify, uint32_t *hi, uint64_t *lo, bool verbose);
 
 #endif
@@ -2383,6 +2383,11 @@ int CmdEM4x05Sniff(const char *Cmd) {
         CmdLFSniff("");
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_ENODATA;
+    }
+
     // Headings
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(INFO, _CYAN_("EM4x05 command detection"));
@@ -2399,13 +2404,13 @@ int CmdEM4x05Sniff(const char *Cmd) {
         bool haveData = false;
         bool pwd = false;
 
-        idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, g_GraphBuffer, &pulseSamples);
+        idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, gb, &pulseSamples);
         size_t pktOffset = idx;
         if (pulseSamples >= 10)  { // Should be 18 so a bit less to allow for processing
 
             // Use first bit to get "0" bit samples as a reference
             ZeroWidth = idx;
-            idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, g_GraphBuffer, &pulseSamples);
+            idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, gb, &pulseSamples);
             ZeroWidth = idx - ZeroWidth;
 
             if (ZeroWidth <= 50) {
@@ -2416,7 +2421,7 @@ int CmdEM4x05Sniff(const char *Cmd) {
                 bool eop = false;
                 while ((idx < g_GraphTraceLen) && !eop) {
                     CycleWidth = idx;
-                    idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, g_GraphBuffer, &pulseSamples);
+                    idx = em4x05_Sniff_GetNextBitStart(idx, g_GraphTraceLen, gb, &pulseSamples);
 
                     CycleWidth = idx - CycleWidth;
                     if ((CycleWidth > 300) || (CycleWidth < (ZeroWidth - 5))) { // to long or too short
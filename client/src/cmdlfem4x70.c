@@ -994,6 +994,7 @@ static int CmdEM4x70Recover(const char *Cmd) {
                       alt_grn.grn[2]
                      );
     }
+    PrintAndLogFlush();
     printf("\n");
 
     // which of those keys actually validates?
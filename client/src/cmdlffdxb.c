@@ -490,16 +490,16 @@ static const char *mapFDBX(uint16_t countryCode) {
 
 //see ASKDemod for what args are accepted
 //almost the same demod as cmddata.c/CmdFDXBdemodBI
-int demodFDXB(bool verbose) {
+int demodFDXB(demod_ctx_t *dctx, bool verbose) {
     // Differential Biphase / di-phase (inverted biphase)
     // get binary from ask wave
-    if (ASKbiphaseDemod(0, 32, 1, 100, false) != PM3_SUCCESS) {
+    if (ASKbiphaseDemod_ctx(dctx, 0, 32, 1, 100, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - FDX-B ASKbiphaseDemod failed");
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
-    int preambleIndex = detectFDXB(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int preambleIndex = detectFDXB(dctx->demod, &size);
     if (preambleIndex < 0) {
 
         if (preambleIndex == -1)
@@ -513,12 +513,12 @@ int demodFDXB(bool verbose) {
         return PM3_ESOFT;
     }
 
-    // set and leave g_DemodBuffer intact
-    setDemodBuff(g_DemodBuffer, 128, preambleIndex);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (preambleIndex * g_DemodClock));
+    // set and leave dctx->demod intact
+    setDemodBuff_ctx(dctx, dctx->demod, 128, preambleIndex);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (preambleIndex * dctx->demod_clock));
 
     // remove marker bits (1's every 9th digit after preamble) (pType = 2)
-    size = removeParity(g_DemodBuffer, 11, 9, 2, 117);
+    size = removeParity(dctx->demod, 11, 9, 2, 117);
     if (size != 104) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - FDX-B error removeParity: %zu", size);
         return PM3_ESOFT;
@@ -527,44 +527,44 @@ int demodFDXB(bool verbose) {
     // got a good demod
     uint8_t offset;
     // ISO: bits 27..64
-    uint64_t NationalCode = ((uint64_t)(bytebits_to_byteLSBF(g_DemodBuffer + 32, 6)) << 32) | bytebits_to_byteLSBF(g_DemodBuffer, 32);
+    uint64_t NationalCode = ((uint64_t)(bytebits_to_byteLSBF(dctx->demod + 32, 6)) << 32) | bytebits_to_byteLSBF(dctx->demod, 32);
 
     offset = 38;
     // ISO: bits 17..26
-    uint16_t countryCode = bytebits_to_byteLSBF(g_DemodBuffer + offset, 10);
+    uint16_t countryCode = bytebits_to_byteLSBF(dctx->demod + offset, 10);
 
     offset += 10;
     // ISO: bits 16
-    uint8_t dataBlockBit = g_DemodBuffer[offset];
+    uint8_t dataBlockBit = dctx->demod[offset];
 
     offset++;
     // ISO: bits 15
-    uint8_t rudiBit = g_DemodBuffer[offset];
+    uint8_t rudiBit = dctx->demod[offset];
 
     offset++;
     // ISO: bits 10..14
-    uint32_t reservedCode = bytebits_to_byteLSBF(g_DemodBuffer + offset, 5);
+    uint32_t reservedCode = bytebits_to_byteLSBF(dctx->demod + offset, 5);
 
     offset += 5;
     // ISO: bits 5..9
-    uint32_t userInfo = bytebits_to_byteLSBF(g_DemodBuffer + offset, 5);
+    uint32_t userInfo = bytebits_to_byteLSBF(dctx->demod + offset, 5);
 
     offset += 5;
     // ISO: bits 2..4
-    uint32_t replacementNr = bytebits_to_byteLSBF(g_DemodBuffer + offset, 3);
+    uint32_t replacementNr = bytebits_to_byteLSBF(dctx->demod + offset, 3);
 
     offset += 3;
-    uint8_t animalBit = g_DemodBuffer[offset];
+    uint8_t animalBit = dctx->demod[offset];
 
     offset++;
-    uint16_t crc = bytebits_to_byteLSBF(g_DemodBuffer + offset, 16);
+    uint16_t crc = bytebits_to_byteLSBF(dctx->demod + offset, 16);
 
     offset += 16;
-    uint32_t extended = bytebits_to_byteLSBF(g_DemodBuffer + offset, 24);
+    uint32_t extended = bytebits_to_byteLSBF(dctx->demod + offset, 24);
 
     uint8_t raw[13] = {0};
     for (int i = 0; i < sizeof(raw); i++) {
-        raw[i] = bytebits_to_byte(g_DemodBuffer + (i * 8), 8);
+        raw[i] = bytebits_to_byte(dctx->demod + (i * 8), 8);
     }
 
     if (verbose == false) {
@@ -594,7 +594,7 @@ int demodFDXB(bool verbose) {
 
     if (g_debugMode) {
         PrintAndLogEx(DEBUG, "Start marker %d;   Size %zu", preambleIndex, size);
-        char *bin = sprint_bytebits_bin_break(g_DemodBuffer, size, 16);
+        char *bin = sprint_bytebits_bin_break(dctx->demod, size, 16);
         PrintAndLogEx(DEBUG, "DEBUG bin stream:\n%s", bin);
     }
 
@@ -631,7 +631,7 @@ static int CmdFdxBDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodFDXB(true);
+    return demod_ctx_run_main(demodFDXB, true);
 }
 
 static int CmdFdxBReader(const char *Cmd) {
@@ -690,7 +690,7 @@ static int CmdFdxBReader(const char *Cmd) {
         curr_div = config.divisor;
 
         lf_read(false, 10000);
-        ret = demodFDXB(!cm); // be verbose only if not in continuous mode
+        ret = demod_ctx_run_main(demodFDXB, !cm); // be verbose only if not in continuous mode
 
     } while (cm && !kbd_enter_pressed());
 
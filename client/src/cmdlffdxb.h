@@ -19,6 +19,7 @@
 #define CMDLFFDXB_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 typedef struct {
     uint16_t code;
@@ -27,7 +28,7 @@ typedef struct {
 
 int CmdLFFdxB(const char *Cmd);
 int detectFDXB(uint8_t *dest, size_t *size);
-int demodFDXB(bool verbose);
+int demodFDXB(demod_ctx_t *dctx, bool verbose);
 //int getFDXBBits(uint64_t national_code, uint16_t country_code, uint8_t is_animal, uint8_t is_extended, uint16_t extended, uint8_t *bits);
 
 #endif
@@ -40,16 +40,16 @@
 static int CmdHelp(const char *Cmd);
 
 //see ASK/MAN Demod for what args are accepted
-int demodGallagher(bool verbose) {
+int demodGallagher(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     bool st = true;
-    if (ASKDemod_ext(32, 0, 100, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 32, 0, 100, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - GALLAGHER: ASKDemod failed");
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
-    int ans = detectGallagher(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectGallagher(dctx->demod, &size);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - GALLAGHER: too few bits found");
@@ -62,24 +62,24 @@ int demodGallagher(bool verbose) {
 
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, 96, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 96, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     // got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
 
     // bytes
     uint8_t arr[8] = {0};
     for (int i = 0, pos = 0; i < ARRAYLEN(arr); i++) {
         // first 16 bits are the 7FEA prefix, then every 9th bit is a checksum-bit for the preceding byte
         pos = 16 + (9 * i);
-        arr[i] = bytebits_to_byte(g_DemodBuffer + pos, 8);
+        arr[i] = bytebits_to_byte(dctx->demod + pos, 8);
     }
 
     // crc
-    uint8_t crc = bytebits_to_byte(g_DemodBuffer + 16 + (9 * 8), 8);
+    uint8_t crc = bytebits_to_byte(dctx->demod + 16 + (9 * 8), 8);
     uint8_t calc_crc =  CRC8Cardx(arr, ARRAYLEN(arr));
 
     GallagherCredentials_t creds = {0};
@@ -106,7 +106,7 @@ static int CmdGallagherDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodGallagher(true);
+    return demod_ctx_run_main(demodGallagher, true);
 }
 
 static int CmdGallagherReader(const char *Cmd) {
@@ -131,7 +131,7 @@ static int CmdGallagherReader(const char *Cmd) {
 
     do {
         lf_read(false, 4096 * 2 + 20);
-        demodGallagher(!cm);
+        demod_ctx_run_main(demodGallagher, !cm);
     } while (cm && !kbd_enter_pressed());
     return PM3_SUCCESS;
 }
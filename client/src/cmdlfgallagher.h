@@ -19,10 +19,11 @@
 #define CMDLFGALLAGHER_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFGallagher(const char *Cmd);
 
-int demodGallagher(bool verbose);
+int demodGallagher(demod_ctx_t *dctx, bool verbose);
 int detectGallagher(uint8_t *dest, size_t *size);
 #endif
 
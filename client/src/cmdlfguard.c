@@ -97,18 +97,18 @@ static int demod_guard_raw(uint8_t *raw, uint8_t rlen) {
 // WARNING: if it fails during some points it will destroy the g_DemodBuffer data
 // but will leave the g_GraphBuffer intact.
 // if successful it will push askraw data back to g_DemodBuffer ready for emulation
-int demodGuard(bool verbose) {
+int demodGuard(demod_ctx_t *dctx, bool verbose) {
     (void) verbose;
     //Differential Biphase
     //get binary from ask wave
-    if (ASKbiphaseDemod(0, 64, 0, 0, false) != PM3_SUCCESS) {
+    if (ASKbiphaseDemod_ctx(dctx, 0, 64, 0, 0, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - gProxII ASKbiphaseDemod failed");
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
+    size_t size = dctx->demod_len;
 
-    int preambleIndex = detectGProxII(g_DemodBuffer, &size);
+    int preambleIndex = detectGProxII(dctx->demod, &size);
     if (preambleIndex < 0) {
 
         if (preambleIndex == -1)
@@ -130,8 +130,8 @@ int demodGuard(bool verbose) {
     size_t startIdx = preambleIndex + 6; //start after 6 bit preamble
     uint8_t bits_no_spacer[90];
 
-    // not mess with raw g_DemodBuffer copy to a new sample array
-    memcpy(bits_no_spacer, g_DemodBuffer + startIdx, 90);
+    // not mess with raw dctx->demod copy to a new sample array
+    memcpy(bits_no_spacer, dctx->demod + startIdx, 90);
 
     // remove the 18 (90/5=18) parity bits (down to 72 bits (96-6-18=72))
     size_t len = removeParity(bits_no_spacer, 0, 5, 3, 90); // source, startloc, paritylen, ptype, length_to_run
@@ -149,17 +149,17 @@ int demodGuard(bool verbose) {
         PrintAndLogEx(DEBUG, "DEBUG: gProxII byte %zu after xor: %02x (%02x before xor)", idx, plain[idx], bytebits_to_byteLSBF(bits_no_spacer + 8 + (idx * 8), 8));
     }
 
-    setDemodBuff(g_DemodBuffer, 96, preambleIndex);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (preambleIndex * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 96, preambleIndex);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (preambleIndex * dctx->demod_clock));
 
     //plain contains 8 Bytes (64 bits) of decrypted raw tag data
     uint8_t fmtLen = plain[0] >> 2;
     uint32_t FC = 0;
     uint32_t Card = 0;
     //get raw 96 bits to print
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
     bool unknown = false;
     switch (fmtLen) {
         case 36:
@@ -215,7 +215,7 @@ static int CmdGuardDemod(const char *Cmd) {
     }
 
     if (raw_len == 0)
-        return demodGuard(true);
+        return demod_ctx_run_main(demodGuard, true);
     else
         return demod_guard_raw(raw, raw_len);
 }
@@ -242,7 +242,7 @@ static int CmdGuardReader(const char *Cmd) {
 
     do {
         lf_read(false, 10000);
-        demodGuard(!cm);
+        demod_ctx_run_main(demodGuard, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
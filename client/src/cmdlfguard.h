@@ -19,9 +19,10 @@
 #define CMDLFGUARD_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFGuard(const char *Cmd);
 int detectGProxII(uint8_t *bits, size_t *size);
-int demodGuard(bool verbose);
+int demodGuard(demod_ctx_t *dctx, bool verbose);
 int getGuardBits(uint8_t xorKey, uint8_t fmtlen, uint32_t fc, uint32_t cn, uint8_t *guardBits);
 #endif
@@ -107,23 +107,23 @@ static int sendTry(uint8_t format_idx, wiegand_card_t *card, uint32_t delay, boo
 //by marshmellow (based on existing demod + holiman's refactor)
 //HID Prox demod - FSK RF/50 with preamble of 00011101 (then manchester encoded)
 //print full HID Prox ID and some bit format details if found
-int demodHID(bool verbose) {
+int demodHID(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
 
     // HID simulation etc uses 0/1 as signal data. This must be converted in order to demod it back again
-    if (isGraphBitstream()) {
-        convertGraphFromBitstream();
+    if (isGraphBitstream_ctx(dctx)) {
+        convertGraphFromBitstream_ctx(dctx);
     }
 
     //raw fsk demod no manchester decoding no start bit finding just get binary from wave
     uint32_t hi2 = 0, hi = 0, lo = 0;
 
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    uint8_t *bits = calloc(dctx->graph_len, sizeof(uint8_t));
     if (bits == NULL) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - " _RED_("HID not enough samples"));
         free(bits);
@@ -151,8 +151,8 @@ int demodHID(bool verbose) {
         return PM3_ESOFT;
     }
 
-    setDemodBuff(bits, size, idx);
-    setClockGrid(50, waveIdx + (idx * 50));
+    setDemodBuff_ctx(dctx, bits, size, idx);
+    setClockGrid_ctx(dctx, 50, waveIdx + (idx * 50));
     free(bits);
 
     if (hi2 == 0 && hi == 0 && lo == 0) {
@@ -161,7 +161,7 @@ int demodHID(bool verbose) {
     }
 
     if (!decode_wiegand(hi2, hi, lo, 0)) { // if failed to unpack wiegand
-        printDemodBuff(0, false, false, true);
+        printDemodBuff_ctx(dctx, 0, false, false, true);
     }
     PrintAndLogEx(INFO, "raw: " _GREEN_("%08x%08x%08x"), hi2, hi, lo);
 
@@ -169,7 +169,7 @@ int demodHID(bool verbose) {
     if (g_debugMode) {
         PrintAndLogEx(DEBUG, "raw: " _GREEN_("%08x%08x%08x"), hi2, hi, lo);
 
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
 
     return PM3_SUCCESS;
@@ -188,7 +188,7 @@ static int CmdHIDDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodHID(true);
+    return demod_ctx_run_main(demodHID, true);
 }
 
 // this read is the "normal" read,  which download lf signal and tries to demod here.
@@ -214,7 +214,7 @@ static int CmdHIDReader(const char *Cmd) {
 
     do {
         lf_read(false, 16000);
-        demodHID(!cm);
+        demod_ctx_run_main(demodHID, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -20,9 +20,10 @@
 #define CMDLFHID_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFHID(const char *Cmd);
 
-int demodHID(bool verbose);
+int demodHID(demod_ctx_t *dctx, bool verbose);
 
 #endif
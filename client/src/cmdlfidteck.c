@@ -37,15 +37,15 @@
 
 static int CmdHelp(const char *Cmd);
 
-static int demod_idteck_signal(void) {
-    if (PSKDemod(0, 0, 100, false) != PM3_SUCCESS) {
+static int demod_idteck_signal(demod_ctx_t *dctx) {
+    if (PSKDemod_ctx(dctx, 0, 0, 100, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Idteck PSKDemod failed");
         return PM3_ESOFT;
     }
-    size_t size = g_DemodBufferLen;
+    size_t size = dctx->demod_len;
 
     // get binary from PSK1 wave
-    int idx = detectIdteck(g_DemodBuffer, &size);
+    int idx = detectIdteck(dctx->demod, &size);
     if (idx < 0) {
 
         if (idx == -1)
@@ -60,11 +60,11 @@ static int demod_idteck_signal(void) {
             PrintAndLogEx(DEBUG, "DEBUG: Error - Idteck: idx: %d", idx);
 
         // if didn't find preamble try again inverting
-        if (PSKDemod(0, 1, 100, false) != PM3_SUCCESS) {
+        if (PSKDemod_ctx(dctx, 0, 1, 100, false) != PM3_SUCCESS) {
             PrintAndLogEx(DEBUG, "DEBUG: Error - Idteck PSKDemod failed");
             return PM3_ESOFT;
         }
-        idx = detectIdteck(g_DemodBuffer, &size);
+        idx = detectIdteck(dctx->demod, &size);
         if (idx < 0) {
 
             if (idx == -1)
@@ -81,11 +81,11 @@ static int demod_idteck_signal(void) {
             return PM3_ESOFT;
         }
     }
-    setDemodBuff(g_DemodBuffer, 64, idx);
+    setDemodBuff_ctx(dctx, dctx->demod, 64, idx);
     return PM3_SUCCESS;
 }
 
-int demodIdteck(uint8_t *raw, bool verbose) {
+int demodIdteck(demod_ctx_t *dctx, uint8_t *raw, bool verbose) {
     (void) verbose; // unused so far
 
     uint32_t raw1 = 0;
@@ -93,12 +93,12 @@ int demodIdteck(uint8_t *raw, bool verbose) {
 
     if (raw == NULL) {
         // get binary from PSK1 wave
-        int ret = demod_idteck_signal();
+        int ret = demod_idteck_signal(dctx);
         if (ret != PM3_SUCCESS) {
             return ret;
         }
-        raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-        raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
+        raw1 = bytebits_to_byte(dctx->demod, 32);
+        raw2 = bytebits_to_byte(dctx->demod + 32, 32);
     } else {
         raw1 = bytes_to_num(raw, 4);
         raw2 = bytes_to_num(raw + 4, 4);
@@ -163,7 +163,11 @@ static int CmdIdteckDemod(const char *Cmd) {
     uint8_t raw[8] = {0};
     CLIGetHexWithReturn(ctx, 1, raw, &raw_len);
     CLIParserFree(ctx);
-    return demodIdteck(raw, true);
+
+    demod_ctx_t dctx;
+    int res = demodIdteck(demod_ctx_main_get(&dctx), raw, true);
+    demod_ctx_main_put(&dctx);
+    return res;
 }
 
 static int CmdIdteckClone(const char *Cmd) {
@@ -314,7 +318,9 @@ static int CmdIdteckReader(const char *Cmd) {
 
     do {
         lf_read(false, 5000);
-        demodIdteck(NULL, !cm);
+        demod_ctx_t dctx;
+        demodIdteck(demod_ctx_main_get(&dctx), NULL, !cm);
+        demod_ctx_main_put(&dctx);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -19,10 +19,11 @@
 #define CMDLFIDTECK_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFIdteck(const char *Cmd);
 
-int demodIdteck(uint8_t *raw, bool verbose);
+int demodIdteck(demod_ctx_t *dctx, uint8_t *raw, bool verbose);
 int detectIdteck(uint8_t *dest, size_t *size);
 
 #endif
@@ -20,6 +20,7 @@
 #define CMDLFINDALA_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFINDALA(const char *Cmd);
 
@@ -28,7 +29,8 @@ int detectIndala(uint8_t *dest, size_t *size, uint8_t *invert);
 //int detectIndala64(uint8_t *bitStream, size_t *size, uint8_t *invert);
 //int detectIndala224(uint8_t *bitStream, size_t *size, uint8_t *invert);
 int demodIndalaEx(int clk, int invert, int maxErr, bool verbose);
-int demodIndala(bool verbose);
+int demodIndalaEx_ctx(demod_ctx_t *dctx, int clk, int invert, int maxErr, bool verbose);
+int demodIndala(demod_ctx_t *dctx, bool verbose);
 int getIndalaBits(uint8_t fc, uint16_t cn, uint8_t *bits);
 int getIndalaBits4041x(uint8_t fc, uint16_t cn, uint8_t *bits);
 bool parityOdd(uint16_t x);
@@ -63,7 +63,7 @@ static int CmdIOProxWatch(const char *Cmd) {
 
 //IO-Prox demod - FSK RF/64 with preamble of 000000001
 //print ioProx ID and some format details
-int demodIOProx(bool verbose) {
+int demodIOProx(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     int idx = 0, retval = PM3_SUCCESS;
     uint8_t *bits = calloc(MAX_GRAPH_TRACE_LEN, sizeof(uint8_t));
@@ -71,7 +71,7 @@ int demodIOProx(bool verbose) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size < 65) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - IO prox not enough samples in GraphBuffer");
         free(bits);
@@ -101,8 +101,8 @@ int demodIOProx(bool verbose) {
         free(bits);
         return PM3_ESOFT;
     }
-    setDemodBuff(bits, size, idx);
-    setClockGrid(64, waveIdx + (idx * 64));
+    setDemodBuff_ctx(dctx, bits, size, idx);
+    setClockGrid_ctx(dctx, 64, waveIdx + (idx * 64));
 
     if (idx == 0) {
         if (g_debugMode) {
@@ -160,8 +160,8 @@ int demodIOProx(bool verbose) {
             PrintAndLogEx(DEBUG, "DEBUG: Error - IO prox crc failed");
 
         PrintAndLogEx(DEBUG, "DEBUG: IO prox idx: %d, Len: %zu, Printing DemodBuffer:", idx, size);
-        printDemodBuff(0, false, false, true);
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, true);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
     free(bits);
     return retval;
@@ -180,7 +180,7 @@ static int CmdIOProxDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodIOProx(true);
+    return demod_ctx_run_main(demodIOProx, true);
 }
 // this read is the "normal" read,  which download lf signal and tries to demod here.
 static int CmdIOProxReader(const char *Cmd) {
@@ -201,7 +201,7 @@ static int CmdIOProxReader(const char *Cmd) {
 
     do {
         lf_read(false, 12000);
-        demodIOProx(!cm);
+        demod_ctx_run_main(demodIOProx, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
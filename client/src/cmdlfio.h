@@ -20,10 +20,11 @@
 #define CMDLFIO_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFIO(const char *Cmd);
 
-int demodIOProx(bool verbose);
+int demodIOProx(demod_ctx_t *dctx, bool verbose);
 int getIOProxBits(uint8_t version, uint8_t fc, uint16_t cn, uint8_t *bits);
 
 #endif
@@ -58,16 +58,16 @@ static uint64_t getJablontronCardId(uint64_t rawcode) {
     return id;
 }
 
-int demodJablotron(bool verbose) {
+int demodJablotron(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     //Differential Biphase / di-phase (inverted biphase)
     //get binary from ask wave
-    if (ASKbiphaseDemod(0, 64, 1, 0, false) != PM3_SUCCESS) {
+    if (ASKbiphaseDemod_ctx(dctx, 0, 64, 1, 0, false) != PM3_SUCCESS) {
         if (g_debugMode) PrintAndLogEx(DEBUG, "DEBUG: Error - Jablotron ASKbiphaseDemod failed");
         return PM3_ESOFT;
     }
-    size_t size = g_DemodBufferLen;
-    int ans = detectJablotron(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectJablotron(dctx->demod, &size);
     if (ans < 0) {
         if (g_debugMode) {
             if (ans == -1)
@@ -84,21 +84,21 @@ int demodJablotron(bool verbose) {
         return PM3_ESOFT;
     }
 
-    setDemodBuff(g_DemodBuffer, JABLOTRON_ARR_LEN, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, JABLOTRON_ARR_LEN, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
 
     // bytebits_to_byte - uint32_t
-    uint64_t rawid = ((uint64_t)(bytebits_to_byte(g_DemodBuffer + 16, 8) & 0xff) << 32) | bytebits_to_byte(g_DemodBuffer + 24, 32);
+    uint64_t rawid = ((uint64_t)(bytebits_to_byte(dctx->demod + 16, 8) & 0xff) << 32) | bytebits_to_byte(dctx->demod + 24, 32);
     uint64_t id = getJablontronCardId(rawid);
 
     PrintAndLogEx(SUCCESS, "Jablotron - Card: " _GREEN_("%"PRIx64) ", Raw: %08X%08X", id, raw1, raw2);
 
     uint8_t chksum = raw2 & 0xFF;
-    bool isok = (chksum == jablontron_chksum(g_DemodBuffer));
+    bool isok = (chksum == jablontron_chksum(dctx->demod));
 
     PrintAndLogEx(DEBUG, "Checksum: %02X ( %s )", chksum, isok ? _GREEN_("ok") : _RED_("Fail"));
 
@@ -126,7 +126,7 @@ static int CmdJablotronDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodJablotron(true);
+    return demod_ctx_run_main(demodJablotron, true);
 }
 
 static int CmdJablotronReader(const char *Cmd) {
@@ -151,7 +151,7 @@ static int CmdJablotronReader(const char *Cmd) {
 
     do {
         lf_read(false, 16000);
-        demodJablotron(!cm);
+        demod_ctx_run_main(demodJablotron, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
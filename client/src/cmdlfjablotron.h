@@ -19,10 +19,11 @@
 #define CMDLFJABLOTRON_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFJablotron(const char *Cmd);
 
-int demodJablotron(bool verbose);
+int demodJablotron(demod_ctx_t *dctx, bool verbose);
 int detectJablotron(uint8_t *bits, size_t *size);
 int getJablotronBits(uint64_t fullcode, uint8_t *bits);
 
@@ -105,17 +105,17 @@ static int CmdKeriMSScramble(KeriMSScramble_t Action, uint32_t *FC, uint32_t *ID
     return PM3_SUCCESS;
 }
 
-int demodKeri(bool verbose) {
+int demodKeri(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
 
-    if (PSKDemod(0, 0, 100, false) != PM3_SUCCESS) {
+    if (PSKDemod_ctx(dctx, 0, 0, 100, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - KERI: PSK1 Demod failed");
         return PM3_ESOFT;
     }
 
     bool invert = false;
-    size_t size = g_DemodBufferLen;
-    int idx = detectKeri(g_DemodBuffer, &size, &invert);
+    size_t size = dctx->demod_len;
+    int idx = detectKeri(dctx->demod, &size, &invert);
     if (idx < 0) {
         if (idx == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - KERI: too few bits found");
@@ -128,8 +128,8 @@ int demodKeri(bool verbose) {
 
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, size, idx);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (idx * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, size, idx);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (idx * dctx->demod_clock));
 
     /*
         000000000000000000000000000001XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX111
@@ -152,22 +152,22 @@ int demodKeri(bool verbose) {
     uint32_t fc = 0;
     uint32_t cardid = 0;
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
 
     if (invert) {
         PrintAndLogEx(INFO, "Had to Invert - probably KERI");
         for (size_t i = 0; i < size; i++)
-            g_DemodBuffer[i] ^= 1;
+            dctx->demod[i] ^= 1;
 
-        raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-        raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
+        raw1 = bytebits_to_byte(dctx->demod, 32);
+        raw2 = bytebits_to_byte(dctx->demod + 32, 32);
 
-        CmdPrintDemodBuff("-x");
+        printDemodBuff_ctx(dctx, 0, false, false, true);
     }
 
     //get internal id
-    // uint32_t ID = bytebits_to_byte(g_DemodBuffer + 29, 32);
+    // uint32_t ID = bytebits_to_byte(dctx->demod + 29, 32);
     // Due to the 3 sync bits being at the start of the capture
     // We can take the last 32bits as the internal ID.
     uint32_t ID = raw2;
@@ -195,7 +195,7 @@ static int CmdKeriDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodKeri(true);
+    return demod_ctx_run_main(demodKeri, true);
 }
 
 static int CmdKeriReader(const char *Cmd) {
@@ -220,7 +220,7 @@ static int CmdKeriReader(const char *Cmd) {
 
     do {
         lf_read(false, 10000);
-        demodKeri(!cm);
+        demod_ctx_run_main(demodKeri, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
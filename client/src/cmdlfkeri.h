@@ -19,10 +19,11 @@
 #define CMDLFKERI_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFKeri(const char *Cmd);
 
-int demodKeri(bool verbose);
+int demodKeri(demod_ctx_t *dctx, bool verbose);
 int detectKeri(uint8_t *dest, size_t *size, bool *invert);
 
 #endif
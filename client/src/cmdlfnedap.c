@@ -53,27 +53,27 @@ static uint8_t isEven_64_63(const uint8_t *data) { // 8
 }
 
 //NEDAP demod - ASK/Biphase (or Diphase),  RF/64 with preamble of 1111111110  (always a 128 bit data stream)
-int demodNedap(bool verbose) {
+int demodNedap(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     uint8_t data[16], buffer[7], subtype; // 4 bits
     size_t size, offset = 0;
     uint16_t checksum, customerCode; // 12 bits
     uint32_t badgeId; // max 99999
 
-    if (ASKbiphaseDemod(0, 64, 1, 0, false) != PM3_SUCCESS) {
+    if (ASKbiphaseDemod_ctx(dctx, 0, 64, 1, 0, false) != PM3_SUCCESS) {
         if (g_debugMode) PrintAndLogEx(DEBUG, "DEBUG: Error - NEDAP: ASK/Biphase Demod failed");
         return PM3_ESOFT;
     }
 
-    size = g_DemodBufferLen;
-    if (!preambleSearch(g_DemodBuffer, (uint8_t *) preamble, sizeof(preamble), &size, &offset)) {
+    size = dctx->demod_len;
+    if (!preambleSearch(dctx->demod, (uint8_t *) preamble, sizeof(preamble), &size, &offset)) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - NEDAP: preamble not found");
         return PM3_ESOFT;
     }
 
     // set plot
-    setDemodBuff(g_DemodBuffer, size, offset);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (g_DemodClock * offset));
+    setDemodBuff_ctx(dctx, dctx->demod, size, offset);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (dctx->demod_clock * offset));
 
     // sanity checks
     if ((size != 128) && (size != 64)) {
@@ -81,7 +81,7 @@ int demodNedap(bool verbose) {
         return PM3_ESOFT;
     }
 
-    if (bits_to_array(g_DemodBuffer, size, data) != PM3_SUCCESS) {
+    if (bits_to_array(dctx->demod, size, data) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - NEDAP: bits_to_array error\n");
         return PM3_ESOFT;
     }
@@ -227,7 +227,7 @@ static int CmdLFNedapDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodNedap(true);
+    return demod_ctx_run_main(demodNedap, true);
 }
 /* Index map                                                      E                                                                              E
  preamble    enc tag type         encrypted uid                   P d    33    d    90    d    04    d    71    d    40    d    45    d    E7    P
@@ -295,7 +295,7 @@ static int CmdLFNedapReader(const char *Cmd) {
 
     do {
         lf_read(false, 16000);
-        demodNedap(!cm);
+        demod_ctx_run_main(demodNedap, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -19,10 +19,11 @@
 #define CMDLFNEDAP_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFNedap(const char *Cmd);
 
-int demodNedap(bool verbose);
+int demodNedap(demod_ctx_t *dctx, bool verbose);
 int detectNedap(uint8_t *dest, size_t *size);
 int getNedapBits(uint32_t cn, uint8_t *nedapBits);
 
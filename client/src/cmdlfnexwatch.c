@@ -133,15 +133,15 @@ static int nexwatch_magic_bruteforce(uint32_t cn, uint8_t calc_parity, uint8_t c
 }
 
 
-int demodNexWatch(bool verbose) {
+int demodNexWatch(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
-    if (PSKDemod(0, 0, 100, false) != PM3_SUCCESS) {
+    if (PSKDemod_ctx(dctx, 0, 0, 100, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - NexWatch can't demod signal");
         return PM3_ESOFT;
     }
     bool invert = false;
-    size_t size = g_DemodBufferLen;
-    int idx = detectNexWatch(g_DemodBuffer, &size, &invert);
+    size_t size = dctx->demod_len;
+    int idx = detectNexWatch(dctx->demod, &size, &invert);
     if (idx < 0) {
         if (idx == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - NexWatch not enough samples");
@@ -162,42 +162,42 @@ int demodNexWatch(bool verbose) {
     // skip the 4 first bits from the nexwatch preamble identification (we use 4 extra zeros..)
     idx += 4;
 
-    setDemodBuff(g_DemodBuffer, size, idx);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (idx * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, size, idx);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (idx * dctx->demod_clock));
 
     if (invert) {
         PrintAndLogEx(INFO, "Inverted the demodulated data");
         for (size_t i = 0; i < size; i++)
-            g_DemodBuffer[i] ^= 1;
+            dctx->demod[i] ^= 1;
     }
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 32 + 32, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 32 + 32, 32);
 
     // get rawid
     uint32_t rawid = 0;
     for (uint8_t k = 0; k < 4; k++) {
         for (uint8_t m = 0; m < 8; m++) {
-            rawid = (rawid << 1) | g_DemodBuffer[m + k + (m * 4)];
+            rawid = (rawid << 1) | dctx->demod[m + k + (m * 4)];
         }
     }
 
     // descrambled id
     uint32_t cn = 0;
-    uint32_t scambled = bytebits_to_byte(g_DemodBuffer + 8 + 32, 32);
+    uint32_t scambled = bytebits_to_byte(dctx->demod + 8 + 32, 32);
     nexwatch_scamble(DESCRAMBLE, &cn, &scambled);
 
-    uint8_t mode = bytebits_to_byte(g_DemodBuffer + 72, 4);
-    uint8_t parity = bytebits_to_byte(g_DemodBuffer + 76, 4);
-    uint8_t chk = bytebits_to_byte(g_DemodBuffer + 80, 8);
+    uint8_t mode = bytebits_to_byte(dctx->demod + 72, 4);
+    uint8_t parity = bytebits_to_byte(dctx->demod + 76, 4);
+    uint8_t chk = bytebits_to_byte(dctx->demod + 80, 8);
 
     // parity check
     // from 32b hex id, 4b mode
     uint8_t hex[5] = {0};
     for (uint8_t i = 0; i < 5; i++) {
-        hex[i] = bytebits_to_byte(g_DemodBuffer + 8 + 32 + (i * 8), 8);
+        hex[i] = bytebits_to_byte(dctx->demod + 8 + 32 + (i * 8), 8);
     }
     // mode is only 4 bits.
     hex[4] &= 0xf0;
@@ -261,7 +261,7 @@ static int CmdNexWatchDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodNexWatch(true);
+    return demod_ctx_run_main(demodNexWatch, true);
 }
 
 static int CmdNexWatchReader(const char *Cmd) {
@@ -286,7 +286,7 @@ static int CmdNexWatchReader(const char *Cmd) {
 
     do {
         lf_read(false, 20000);
-        demodNexWatch(!cm);
+        demod_ctx_run_main(demodNexWatch, !cm);
     } while (cm && !kbd_enter_pressed());
     return PM3_SUCCESS;
 }
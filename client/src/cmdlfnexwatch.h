@@ -19,9 +19,10 @@
 #define CMDLFNEXWATCH_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFNEXWATCH(const char *Cmd);
 
-int demodNexWatch(bool verbose);
+int demodNexWatch(demod_ctx_t *dctx, bool verbose);
 int detectNexWatch(uint8_t *dest, size_t *size, bool *invert);
 #endif
@@ -42,11 +42,11 @@ static uint8_t noralsy_chksum(uint8_t *bits, uint8_t len) {
 }
 
 //see ASKDemod for what args are accepted
-int demodNoralsy(bool verbose) {
+int demodNoralsy(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     //ASK / Manchester
     bool st = true;
-    if (ASKDemod_ext(32, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 32, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         if (g_debugMode) PrintAndLogEx(DEBUG, "DEBUG: Error - Noralsy: ASK/Manchester Demod failed");
         return PM3_ESOFT;
     }
@@ -55,8 +55,8 @@ int demodNoralsy(bool verbose) {
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
-    int ans = detectNoralsy(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectNoralsy(dctx->demod, &size);
     if (ans < 0) {
         if (g_debugMode) {
             if (ans == -1)
@@ -70,13 +70,13 @@ int demodNoralsy(bool verbose) {
         }
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, 96, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 96, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
 
     uint32_t cardid = ((raw2 & 0xFFF00000) >> 20) << 16;
     cardid |= (raw2 & 0xFF) << 8;
@@ -88,11 +88,11 @@ int demodNoralsy(bool verbose) {
     year += (year > 60) ? 1900 : 2000;
 
     // calc checksums
-    uint8_t calc1 = noralsy_chksum(g_DemodBuffer + 32, 40);
-    uint8_t calc2 = noralsy_chksum(g_DemodBuffer, 76);
+    uint8_t calc1 = noralsy_chksum(dctx->demod + 32, 40);
+    uint8_t calc2 = noralsy_chksum(dctx->demod, 76);
     uint8_t chk1 = 0, chk2 = 0;
-    chk1 = bytebits_to_byte(g_DemodBuffer + 72, 4);
-    chk2 = bytebits_to_byte(g_DemodBuffer + 76, 4);
+    chk1 = bytebits_to_byte(dctx->demod + 72, 4);
+    chk2 = bytebits_to_byte(dctx->demod + 76, 4);
     // test checksums
     if (chk1 != calc1) {
         if (g_debugMode) PrintAndLogEx(DEBUG, "DEBUG: Error - Noralsy: checksum 1 failed %x - %x\n", chk1, calc1);
@@ -124,7 +124,7 @@ static int CmdNoralsyDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodNoralsy(true);
+    return demod_ctx_run_main(demodNoralsy, true);
 }
 
 static int CmdNoralsyReader(const char *Cmd) {
@@ -149,7 +149,7 @@ static int CmdNoralsyReader(const char *Cmd) {
 
     do {
         lf_read(false, 8000);
-        demodNoralsy(!cm);
+        demod_ctx_run_main(demodNoralsy, !cm);
     } while (cm && !kbd_enter_pressed());
     return PM3_SUCCESS;
 }
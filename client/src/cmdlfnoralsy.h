@@ -19,10 +19,11 @@
 #define CMDLFNORALSY_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFNoralsy(const char *Cmd);
 
-int demodNoralsy(bool verbose);
+int demodNoralsy(demod_ctx_t *dctx, bool verbose);
 int detectNoralsy(uint8_t *dest, size_t *size);
 int getnoralsyBits(uint32_t id, uint16_t year, uint8_t *bits);
 
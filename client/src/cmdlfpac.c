@@ -126,16 +126,16 @@ static void pac_cardid_to_raw(const char *src, uint8_t *dst) {
 }
 
 //see NRZDemod for what args are accepted
-int demodPac(bool verbose) {
+int demodPac(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     //NRZ
-    if (NRZrawDemod(0, 0, 100, false) != PM3_SUCCESS) {
+    if (NRZrawDemod_ctx(dctx, 0, 0, 100, false) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - PAC: NRZ Demod failed");
         return PM3_ESOFT;
     }
     bool invert = false;
-    size_t size = g_DemodBufferLen;
-    int ans = detectPac(g_DemodBuffer, &size, &invert);
+    size_t size = dctx->demod_len;
+    int ans = detectPac(dctx->demod, &size, &invert);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - PAC: too few bits found");
@@ -151,21 +151,21 @@ int demodPac(bool verbose) {
 
     if (invert) {
         for (size_t i = ans; i < ans + 128; i++) {
-            g_DemodBuffer[i] ^= 1;
+            dctx->demod[i] ^= 1;
         }
     }
-    setDemodBuff(g_DemodBuffer, 128, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 128, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
-    uint32_t raw4 = bytebits_to_byte(g_DemodBuffer + 96, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
+    uint32_t raw4 = bytebits_to_byte(dctx->demod + 96, 32);
 
     // 8 bytes + null terminator
     uint8_t cardid[PAC_ID_LEN];
-    int retval = pac_buf_to_cardid(g_DemodBuffer, g_DemodBufferLen, cardid, sizeof(cardid));
+    int retval = pac_buf_to_cardid(dctx->demod, dctx->demod_len, cardid, sizeof(cardid));
 
     if (retval == PM3_SUCCESS) {
         PrintAndLogEx(SUCCESS, "PAC/Stanley - Card: " _GREEN_("%s") ", Raw: %08X%08X%08X%08X", cardid, raw1, raw2, raw3, raw4);
@@ -187,7 +187,7 @@ static int CmdPacDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodPac(true);
+    return demod_ctx_run_main(demodPac, true);
 }
 
 static int CmdPacReader(const char *Cmd) {
@@ -213,7 +213,7 @@ static int CmdPacReader(const char *Cmd) {
 
     do {
         lf_read(false, 4096 * 2 + 20);
-        demodPac(!cm);
+        demod_ctx_run_main(demodPac, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -19,10 +19,11 @@
 #define CMDLFPAC_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFPac(const char *Cmd);
 
-int demodPac(bool verbose);
+int demodPac(demod_ctx_t *dctx, bool verbose);
 int detectPac(uint8_t *dest, size_t *size, bool *invert);
 #endif
 
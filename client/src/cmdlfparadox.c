@@ -100,7 +100,7 @@ static uint8_t GetParadoxBits(const uint32_t fc, const uint32_t cn, unsigned int
     return crc;
 }
 
-int demodParadox(bool verbose, bool oldChksum) {
+int demodParadox(demod_ctx_t *dctx, bool verbose, bool oldChksum) {
     (void) verbose; // unused so far
     //raw fsk demod no manchester decoding no start bit finding just get binary from wave
     uint8_t *bits = calloc(MAX_GRAPH_TRACE_LEN, sizeof(uint8_t));
@@ -108,7 +108,7 @@ int demodParadox(bool verbose, bool oldChksum) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Paradox not enough samples");
         free(bits);
@@ -176,8 +176,8 @@ int demodParadox(bool verbose, bool oldChksum) {
         PrintAndLogEx(DEBUG, "Total Manchester Errors... %u", errors);
     }
 
-    setDemodBuff(bits, size, idx);
-    setClockGrid(50, wave_idx + (idx * 50));
+    setDemodBuff_ctx(dctx, bits, size, idx);
+    setClockGrid_ctx(dctx, 50, wave_idx + (idx * 50));
 
     if (hi2 == 0 && hi == 0 && lo == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Paradox no value found");
@@ -234,7 +234,7 @@ int demodParadox(bool verbose, bool oldChksum) {
 
     PrintAndLogEx(DEBUG, "DEBUG: Paradox idx: %d, len: %zu, Printing DemodBuffer:", idx, size);
     if (g_debugMode) {
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
 
     free(bits);
@@ -256,7 +256,11 @@ static int CmdParadoxDemod(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     bool old = arg_get_lit(ctx, 1);
     CLIParserFree(ctx);
-    return demodParadox(true, old);
+
+    demod_ctx_t dctx;
+    int res = demodParadox(demod_ctx_main_get(&dctx), true, old);
+    demod_ctx_main_put(&dctx);
+    return res;
 }
 
 static int CmdParadoxReader(const char *Cmd) {
@@ -284,7 +288,9 @@ static int CmdParadoxReader(const char *Cmd) {
 
     do {
         lf_read(false, 10000);
-        demodParadox(!cm, old);
+        demod_ctx_t dctx;
+        demodParadox(demod_ctx_main_get(&dctx), !cm, old);
+        demod_ctx_main_put(&dctx);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -19,9 +19,10 @@
 #define CMDLFPARADOX_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFParadox(const char *Cmd);
 
-int demodParadox(bool verbose, bool oldChksum);
+int demodParadox(demod_ctx_t *dctx, bool verbose, bool oldChksum);
 int detectParadox(uint8_t *dest, size_t *size, int *wave_start_idx);
 #endif
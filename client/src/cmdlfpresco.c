@@ -79,15 +79,15 @@ static int getPrescoBits(uint32_t fullcode, uint8_t *prescoBits) {
 }
 
 //see ASKDemod for what args are accepted
-int demodPresco(bool verbose) {
+int demodPresco(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     bool st = true;
-    if (ASKDemod_ext(32, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 32, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error Presco ASKDemod failed");
         return PM3_ESOFT;
     }
-    size_t size = g_DemodBufferLen;
-    int ans = detectPresco(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectPresco(dctx->demod, &size);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - Presco: too few bits found");
@@ -99,14 +99,14 @@ int demodPresco(bool verbose) {
             PrintAndLogEx(DEBUG, "DEBUG: Error - Presco: ans: %d", ans);
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, 128, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 128, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
-    uint32_t raw4 = bytebits_to_byte(g_DemodBuffer + 96, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
+    uint32_t raw4 = bytebits_to_byte(dctx->demod + 96, 32);
     uint32_t fullcode = raw4;
     uint32_t usercode = fullcode & 0x0000FFFF;
     uint32_t sitecode = (fullcode >> 24) & 0x000000FF;
@@ -133,7 +133,7 @@ static int CmdPrescoDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodPresco(true);
+    return demod_ctx_run_main(demodPresco, true);
 }
 
 //see ASKDemod for what args are accepted
@@ -159,7 +159,7 @@ static int CmdPrescoReader(const char *Cmd) {
 
     do {
         lf_read(false, 12000);
-        demodPresco(!cm);
+        demod_ctx_run_main(demodPresco, !cm);
     } while (cm && !kbd_enter_pressed());
     return PM3_SUCCESS;
 }
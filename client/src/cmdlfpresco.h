@@ -19,8 +19,9 @@
 #define CMDLFPRESCO_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFPresco(const char *Cmd);
-int demodPresco(bool verbose);
+int demodPresco(demod_ctx_t *dctx, bool verbose);
 #endif
 
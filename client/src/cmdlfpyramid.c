@@ -40,7 +40,7 @@ static int CmdHelp(const char *Cmd);
 
 //Pyramid Prox demod - FSK RF/50 with preamble of 0000000000000001  (always a 128 bit data stream)
 //print full Farpointe Data/Pyramid Prox ID and some bit format details if found
-int demodPyramid(bool verbose) {
+int demodPyramid(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
     //raw fsk demod no manchester decoding no start bit finding just get binary from wave
     uint8_t *bits = calloc(MAX_GRAPH_TRACE_LEN, sizeof(uint8_t));
@@ -48,7 +48,7 @@ int demodPyramid(bool verbose) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Pyramid not enough samples");
         free(bits);
@@ -73,8 +73,8 @@ int demodPyramid(bool verbose) {
         free(bits);
         return PM3_ESOFT;
     }
-    setDemodBuff(bits, size, idx);
-    setClockGrid(50, waveIdx + (idx * 50));
+    setDemodBuff_ctx(dctx, bits, size, idx);
+    setClockGrid_ctx(dctx, 50, waveIdx + (idx * 50));
 
     // Index map
     // 0           10          20          30            40          50          60
@@ -185,7 +185,7 @@ int demodPyramid(bool verbose) {
 
     PrintAndLogEx(DEBUG, "DEBUG: Pyramid: idx: %d, Len: %d, Printing DemodBuffer:", idx, 128);
     if (g_debugMode) {
-        printDemodBuff(0, false, false, false);
+        printDemodBuff_ctx(dctx, 0, false, false, false);
     }
 
     free(bits);
@@ -205,7 +205,7 @@ static int CmdPyramidDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodPyramid(true);
+    return demod_ctx_run_main(demodPyramid, true);
 }
 
 static int CmdPyramidReader(const char *Cmd) {
@@ -230,7 +230,7 @@ static int CmdPyramidReader(const char *Cmd) {
 
     do {
         lf_read(false, 15000);
-        demodPyramid(true);
+        demod_ctx_run_main(demodPyramid, true);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
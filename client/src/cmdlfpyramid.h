@@ -19,10 +19,11 @@
 #define CMDLFPYRAMID_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFPyramid(const char *Cmd);
 
-int demodPyramid(bool verbose);
+int demodPyramid(demod_ctx_t *dctx, bool verbose);
 int detectPyramid(uint8_t *dest, size_t *size, int *waveStartIdx);
 int getPyramidBits(uint32_t fc, uint32_t cn, uint8_t *pyramidBits);
 #endif
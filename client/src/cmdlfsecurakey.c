@@ -35,20 +35,20 @@
 static int CmdHelp(const char *Cmd);
 
 //see ASKDemod for what args are accepted
-int demodSecurakey(bool verbose) {
+int demodSecurakey(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
 
     //ASK / Manchester
     bool st = false;
-    if (ASKDemod_ext(40, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 40, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Securakey: ASK/Manchester Demod failed");
         return PM3_ESOFT;
     }
     if (st)
         return PM3_ESOFT;
 
-    size_t size = g_DemodBufferLen;
-    int ans = detectSecurakey(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectSecurakey(dctx->demod, &size);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - Securakey: too few bits found");
@@ -60,13 +60,13 @@ int demodSecurakey(bool verbose) {
             PrintAndLogEx(DEBUG, "DEBUG: Error - Securakey: ans: %d", ans);
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, 96, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 96, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
 
     // 26 bit format
     // preamble     ??bitlen   reserved        EPx   xxxxxxxy   yyyyyyyy   yyyyyyyOP  CS?        CS2?
@@ -81,7 +81,7 @@ int demodSecurakey(bool verbose) {
     // standard wiegand parities.
     // unknown checksum 11 bits? at the end
     uint8_t bits_no_spacer[85];
-    memcpy(bits_no_spacer, g_DemodBuffer + 11, 85);
+    memcpy(bits_no_spacer, dctx->demod + 11, 85);
 
     // remove marker bits (0's every 9th digit after preamble) (pType = 3 (always 0s))
     size = removeParity(bits_no_spacer, 0, 9, 3, 85);
@@ -135,7 +135,7 @@ static int CmdSecurakeyDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodSecurakey(true);
+    return demod_ctx_run_main(demodSecurakey, true);
 }
 
 static int CmdSecurakeyReader(const char *Cmd) {
@@ -160,7 +160,7 @@ static int CmdSecurakeyReader(const char *Cmd) {
 
     do {
         lf_read(false, 8000);
-        demodSecurakey(!cm);
+        demod_ctx_run_main(demodSecurakey, !cm);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
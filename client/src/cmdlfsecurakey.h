@@ -19,10 +19,11 @@
 #define CMDLFSECURAKEY_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFSecurakey(const char *Cmd);
 
-int demodSecurakey(bool verbose);
+int demodSecurakey(demod_ctx_t *dctx, bool verbose);
 int detectSecurakey(uint8_t *dest, size_t *size);
 
 #endif
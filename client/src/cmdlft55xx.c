@@ -24,6 +24,7 @@
 #include "cmdlft55xx.h"
 #include <ctype.h>
 #include <time.h>         // MingW
+#include <pthread.h>
 #include "cmdparser.h"    // command_t
 #include "comms.h"
 #include "commonutil.h"
@@ -38,6 +39,7 @@
 #include "cmdlf.h"        // for lf sniff
 #include "generator.h"
 #include "cliparser.h"    // cliparsing
+#include "util.h"         // num_CPUs
 
 // Some defines for readability
 #define T55XX_DLMODE_FIXED         0 // Default Mode
@@ -1310,6 +1312,266 @@ static int CmdT55xxDetect(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+// Offline modulation detection.
+// Every candidate demodulation is a job run on a private demod context,  so they
+// can be spread over threads.  The clock detections the candidates depend on run
+// first,  then the candidates,  and at the end the output and the demod state of
+// every step are taken over in the original order,  the result is the same as
+// trying them one after the other on the main context.
+typedef enum {
+    T55XX_STEP_ASK_CLOCK,
+    T55XX_STEP_NRZ_CLOCK,
+    T55XX_STEP_PSK_CLOCK,
+    T55XX_STEP_PSK_TRIM,    // skip the first samples to let the antenna settle in
+    T55XX_STEP_PSK_RESTORE, // undo the trim
+    T55XX_STEP_DEMOD,
+} t55xx_step_kind_t;
+
+// demod clock of a step context nothing set the clock grid of yet
+#define T55XX_STEP_NO_CLOCK     -1
+
+typedef struct {
+    t55xx_step_kind_t kind;
+    uint8_t mode;           // DEMOD_*,  the modulation test() looks for
+    bool invert;
+    int clk;
+    demod_ctx_t *src;       // samples the step starts from
+    bool ran;
+    bool hit;
+    int res;
+    t55xx_conf_block_t conf;
+    log_capture_t log;      // output,  printed when the step is taken over
+    bool wrote_demod;       // demod buffer left behind in result
+    bool wrote_clock;       // clock grid left behind in result
+    bool wrote_graph;       // samples changed,  demodulators trim them in place
+    demod_ctx_t result;
+} t55xx_detect_step_t;
+
+typedef struct {
+    t55xx_detect_step_t *steps;
+    size_t count;
+    size_t next;
+    uint8_t fc1;
+    uint8_t fc2;
+    uint8_t downlink_mode;
+    signal_t signal;
+    const demod_ctx_t *main_src;    // copy of the main context samples
+} t55xx_detect_queue_t;
+
+static bool t55xx_detect_demod(t55xx_detect_step_t *step, demod_ctx_t *dctx, uint8_t fc1, uint8_t fc2) {
+    t55xx_conf_block_t *c = &step->conf;
+    int bitRate = 0;
+
+    switch (step->mode) {
+        case DEMOD_FSK:
+            if ((FSKrawDemod_ctx(dctx, 0, step->invert, 0, 0, false) != PM3_SUCCESS) || (test(dctx, DEMOD_FSK, &c->offset, &bitRate, step->clk, &c->Q5) == false)) {
+                return false;
+            }
+            c->modulation = DEMOD_FSK;
+            if (fc1 == 8 && fc2 == 5)
+                c->modulation = (step->invert) ? DEMOD_FSK1 : DEMOD_FSK1a;
+            else if (fc1 == 10 && fc2 == 8)
+                c->modulation = (step->invert) ? DEMOD_FSK2a : DEMOD_FSK2;
+            c->ST = false;
+            break;
+        case DEMOD_ASK:
+            // "0 0 1 " == clock auto, invert,  maxError 1.
+            // false = no verbose
+            // false = no emSearch
+            // 1 = Ask/Man
+            // st = true
+            c->ST = true;
+            if ((ASKDemod_ext_ctx(dctx, 0, step->invert, 1, 0, false, false, false, 1, &c->ST) != PM3_SUCCESS) || (test(dctx, DEMOD_ASK, &c->offset, &bitRate, step->clk, &c->Q5) == false)) {
+                return false;
+            }
+            c->modulation = DEMOD_ASK;
+            break;
+        case DEMOD_BI:
+        case DEMOD_BIa:
+            if ((ASKbiphaseDemod_ctx(dctx, 0, 0, step->invert, 2, false) != PM3_SUCCESS) || (test(dctx, step->mode, &c->offset, &bitRate, step->clk, &c->Q5) == false)) {
+                return false;
+            }
+            c->modulation = step->mode;
+            c->ST = false;
+            break;
+        case DEMOD_NRZ:
+            if ((NRZrawDemod_ctx(dctx, 0, step->invert, 1, false) != PM3_SUCCESS) || (test(dctx, DEMOD_NRZ, &c->offset, &bitRate, step->clk, &c->Q5) == false)) {
+                return false;
+            }
+            c->modulation = DEMOD_NRZ;
+            c->ST = false;
+            break;
+        case DEMOD_PSK1:
+            if ((PSKDemod_ctx(dctx, 0, step->invert, 6, false) != PM3_SUCCESS) || (test(dctx, DEMOD_PSK1, &c->offset, &bitRate, step->clk, &c->Q5) == false)) {
+                return false;
+            }
+            c->modulation = DEMOD_PSK1;
+            c->ST = false;
+            break;
+        case DEMOD_PSK2:
+        case DEMOD_PSK3:
+            // needs a call to psk1TOpsk2,  inverse waves does not affect this demod
+            if (PSKDemod_ctx(dctx, 0, 0, 6, false) != PM3_SUCCESS) {
+                return false;
+            }
+            psk1TOpsk2(dctx->demod, dctx->demod_len);
+            if (test(dctx, step->mode, &c->offset, &bitRate, step->clk, &c->Q5) == false) {
+                return false;
+            }
+            c->modulation = step->mode;
+            c->ST = false;
+            break;
+        default:
+            return false;
+    }
+
+    c->bitrate = bitRate;
+    c->inverted = step->invert;
+    c->block0 = PackBits(c->offset, 32, dctx->demod);
+    return true;
+}
+
+// run a step on the private context dctx
+static void t55xx_detect_run(t55xx_detect_step_t *step, demod_ctx_t *dctx, t55xx_detect_queue_t *q) {
+
+    // none of the steps read the demod state,  start it out empty to see what they set
+    demod_ctx_share_graph(dctx, step->src);
+    dctx->demod_len = 0;
+    dctx->demod_clock = T55XX_STEP_NO_CLOCK;
+    dctx->demod_start_idx = 0;
+    *getSignalProperties() = q->signal;
+
+    PrintAndLogCaptureStart(&step->log);
+    switch (step->kind) {
+        case T55XX_STEP_ASK_CLOCK:
+            step->res = GetAskClock_ctx(dctx, "", false);
+            break;
+        case T55XX_STEP_NRZ_CLOCK:
+            step->res = GetNrzClock_ctx(dctx, "", false);
+            break;
+        case T55XX_STEP_PSK_CLOCK:
+            step->res = GetPskClock_ctx(dctx, "", false);
+            break;
+        case T55XX_STEP_PSK_TRIM:
+            step->res = ltrim_ctx(dctx, 160);
+            break;
+        case T55XX_STEP_PSK_RESTORE:
+            break;
+        case T55XX_STEP_DEMOD:
+            step->conf.downlink_mode = q->downlink_mode;
+            step->hit = t55xx_detect_demod(step, dctx, q->fc1, q->fc2);
+            break;
+    }
+    PrintAndLogCaptureStop();
+
+    step->wrote_clock = (dctx->demod_clock != T55XX_STEP_NO_CLOCK);
+    step->result.demod_clock = dctx->demod_clock;
+    step->result.demod_start_idx = dctx->demod_start_idx;
+
+    // the PSK steps work on trimmed samples,  those are thrown away again
+    step->wrote_graph = (step->src == q->main_src) && (demod_ctx_graph_equal(dctx, step->src) == false);
+    if (step->wrote_graph) {
+        demod_ctx_share_graph(&step->result, dctx);
+    }
+
+    step->wrote_demod = (dctx->demod_len != 0);
+    if (step->wrote_demod) {
+        step->result.demod = malloc(dctx->demod_len);
+        if (step->result.demod == NULL) {
+            step->wrote_demod = false;
+        } else {
+            memcpy(step->result.demod, dctx->demod, dctx->demod_len);
+            step->result.demod_len = dctx->demod_len;
+        }
+    }
+    step->ran = true;
+}
+
+static void *t55xx_detect_worker(void *arg) {
+    t55xx_detect_queue_t *q = (t55xx_detect_queue_t *)arg;
+
+    demod_ctx_t dctx;
+    if (demod_ctx_init(&dctx) != PM3_SUCCESS) {
+        return NULL;
+    }
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&q->next, 1, __ATOMIC_SEQ_CST);
+        if (i >= q->count) {
+            break;
+        }
+        if (q->steps[i].kind == T55XX_STEP_DEMOD) {
+            t55xx_detect_run(&q->steps[i], &dctx, q);
+        }
+    }
+
+    demod_ctx_free(&dctx);
+    return NULL;
+}
+
+static t55xx_detect_step_t *t55xx_detect_add(t55xx_detect_queue_t *q, t55xx_step_kind_t kind, uint8_t mode, bool invert, int clk, demod_ctx_t *src) {
+    t55xx_detect_step_t *step = &q->steps[q->count++];
+    step->kind = kind;
+    step->mode = mode;
+    step->invert = invert;
+    step->clk = clk;
+    step->src = src;
+    return step;
+}
+
+// runs a clock detection / trim step right away,  the later steps depend on it
+static int t55xx_detect_now(t55xx_detect_queue_t *q, t55xx_step_kind_t kind, demod_ctx_t *src, demod_ctx_t *dst) {
+    t55xx_detect_step_t *step = t55xx_detect_add(q, kind, 0, false, 0, src);
+
+    demod_ctx_t dctx;
+    if (demod_ctx_init(&dctx) != PM3_SUCCESS) {
+        return 0;
+    }
+    t55xx_detect_run(step, &dctx, q);
+
+    if (dst) {
+        demod_ctx_share_graph(dst, &dctx);
+    }
+    demod_ctx_free(&dctx);
+    return step->res;
+}
+
+// take over the output and demod state of a step on the main context
+static void t55xx_detect_adopt(t55xx_detect_step_t *step, double *grid_offset) {
+
+    PrintAndLogCaptureReplay(&step->log);
+
+    if (step->kind == T55XX_STEP_PSK_TRIM) {
+        *grid_offset = g_GridOffset;
+        if (step->res == PM3_SUCCESS) {
+            g_DemodStartIdx -= 160;
+        }
+        return;
+    }
+
+    if (step->kind == T55XX_STEP_PSK_RESTORE) {
+        g_GridOffset = *grid_offset;
+        return;
+    }
+
+    if (step->wrote_graph) {
+        demod_ctx_t dctx;
+        demod_ctx_share_graph(demod_ctx_main_get(&dctx), &step->result);
+        RepaintGraphWindow();
+    }
+
+    if (step->wrote_demod) {
+        memcpy(g_DemodBuffer, step->result.demod, step->result.demod_len);
+        g_DemodBufferLen = step->result.demod_len;
+    }
+
+    if (step->wrote_clock) {
+        g_DemodClock = step->result.demod_clock;
+        g_DemodStartIdx = step->result.demod_start_idx;
+        setPlotGrid(g_DemodClock, g_DemodStartIdx);
+    }
+}
+
 // detect configuration?
 bool t55xxTryDetectModulation(uint8_t downlink_mode, bool print_config) {
     return t55xxTryDetectModulationEx(downlink_mode, print_config, 0, -1);
@@ -1318,170 +1580,103 @@ bool t55xxTryDetectModulation(uint8_t downlink_mode, bool print_config) {
 bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32_t wanted_conf, uint64_t pwd) {
 
     t55xx_conf_block_t tests[15];
-    int bitRate = 0, clk = 0, firstClockEdge = 0;
+    int clk = 0, firstClockEdge = 0;
     uint8_t hits = 0, fc1 = 0, fc2 = 0, ans = 0;
 
     ans = fskClocks(&fc1, &fc2, (uint8_t *)&clk, &firstClockEdge);
 
+    t55xx_detect_step_t steps[20];
+    memset(steps, 0, sizeof(steps));
+
+    t55xx_detect_queue_t q = {
+        .steps = steps,
+        .count = 0,
+        .next = 0,
+        .fc1 = fc1,
+        .fc2 = fc2,
+        .downlink_mode = downlink_mode,
+        .signal = *getSignalProperties(),
+    };
+
+    // the samples the steps start from,  the main context stays untouched until they are taken over
+    demod_ctx_t msrc, psk_src, dm;
+    memset(&psk_src, 0, sizeof(psk_src));
+    if (demod_ctx_init(&msrc) != PM3_SUCCESS) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return false;
+    }
+    demod_ctx_share_graph(&msrc, demod_ctx_main_get(&dm));
+    demod_ctx_t *dmain = &msrc;
+    q.main_src = dmain;
+
     if (ans && ((fc1 == 10 && fc2 == 8) || (fc1 == 8 && fc2 == 5))) {
-        if ((FSKrawDemod(0, 0, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-            tests[hits].modulation = DEMOD_FSK;
-            if (fc1 == 8 && fc2 == 5)
-                tests[hits].modulation = DEMOD_FSK1a;
-            else if (fc1 == 10 && fc2 == 8)
-                tests[hits].modulation = DEMOD_FSK2;
-            tests[hits].bitrate = bitRate;
-            tests[hits].inverted = false;
-            tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-            tests[hits].ST = false;
-            tests[hits].downlink_mode = downlink_mode;
-            ++hits;
-        }
-        if ((FSKrawDemod(0, 1, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-            tests[hits].modulation = DEMOD_FSK;
-            if (fc1 == 8 && fc2 == 5)
-                tests[hits].modulation = DEMOD_FSK1;
-            else if (fc1 == 10 && fc2 == 8)
-                tests[hits].modulation = DEMOD_FSK2a;
-            tests[hits].bitrate = bitRate;
-            tests[hits].inverted = true;
-            tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-            tests[hits].ST = false;
-            tests[hits].downlink_mode = downlink_mode;
-            ++hits;
-        }
+        t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_FSK, false, clk, dmain);
+        t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_FSK, true, clk, dmain);
     } else {
-        clk = GetAskClock("", false);
+        clk = t55xx_detect_now(&q, T55XX_STEP_ASK_CLOCK, dmain, NULL);
         if (clk > 0) {
-            tests[hits].ST = true;
-            // "0 0 1 " == clock auto, invert false, maxError 1.
-            // false = no verbose
-            // false = no emSearch
-            // 1 = Ask/Man
-            // st = true
-            if ((ASKDemod_ext(0, 0, 1, 0, false, false, false, 1, &tests[hits].ST) == PM3_SUCCESS) && test(DEMOD_ASK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_ASK;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
-            tests[hits].ST = true;
-            // "0 0 1 " == clock auto, invert true, maxError 1.
-            // false = no verbose
-            // false = no emSearch
-            // 1 = Ask/Man
-            // st = true
-            if ((ASKDemod_ext(0, 1, 1, 0, false, false, false, 1, &tests[hits].ST) == PM3_SUCCESS) && test(DEMOD_ASK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_ASK;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
-            if ((ASKbiphaseDemod(0, 0, 0, 2, false) == PM3_SUCCESS) && test(DEMOD_BI, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_BI;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
-            if ((ASKbiphaseDemod(0, 0, 1, 2, false) == PM3_SUCCESS) && test(DEMOD_BIa, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_BIa;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_ASK, false, clk, dmain);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_ASK, true, clk, dmain);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_BI, false, clk, dmain);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_BIa, true, clk, dmain);
         }
-        clk = GetNrzClock("", false);
+        clk = t55xx_detect_now(&q, T55XX_STEP_NRZ_CLOCK, dmain, NULL);
         if (clk > 8) { //clock of rf/8 is likely a false positive, so don't use it.
-            if ((NRZrawDemod(0, 0, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_NRZ;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_NRZ, false, clk, dmain);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_NRZ, true, clk, dmain);
+        }
+        clk = t55xx_detect_now(&q, T55XX_STEP_PSK_CLOCK, dmain, NULL);
+        if (clk > 0 && demod_ctx_init(&psk_src) == PM3_SUCCESS) {
+            // skip first 160 samples to allow antenna to settle in (psk gets inverted occasionally otherwise)
+            t55xx_detect_now(&q, T55XX_STEP_PSK_TRIM, dmain, &psk_src);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_PSK1, false, clk, &psk_src);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_PSK1, true, clk, &psk_src);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_PSK2, false, clk, &psk_src);
+            t55xx_detect_add(&q, T55XX_STEP_DEMOD, DEMOD_PSK3, false, clk, &psk_src);
+            t55xx_detect_add(&q, T55XX_STEP_PSK_RESTORE, 0, false, 0, dmain)->ran = true;
+            // t55xx_search_config_psk(g_GraphBuffer, 1);
+            // t55xx_search_config_psk(g_GraphBuffer, 2);
+        }
+    }
 
-            if ((NRZrawDemod(0, 1, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_NRZ;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+    int thread_count = MIN(num_CPUs(), (int)q.count);
+    if (thread_count > 1) {
+        pthread_t threads[thread_count];
+        int started = 0;
+        for (int i = 0; i < thread_count; i++) {
+            if (pthread_create(&threads[started], NULL, t55xx_detect_worker, &q) == 0) {
+                started++;
             }
         }
+        for (int i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
 
-        clk = GetPskClock("", false);
-        if (clk > 0) {
-            // allow undo
-            buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
-            saveState.offset = g_GridOffset;
-            // skip first 160 samples to allow antenna to settle in (psk gets inverted occasionally otherwise)
-            CmdLtrim("-i 160");
-            if ((PSKDemod(0, 0, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_PSK1;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
-            }
-            if ((PSKDemod(0, 1, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_PSK1;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+    // whatever no worker got to
+    demod_ctx_t dctx;
+    if (demod_ctx_init(&dctx) == PM3_SUCCESS) {
+        for (size_t i = 0; i < q.count; i++) {
+            if (steps[i].ran == false) {
+                t55xx_detect_run(&steps[i], &dctx, &q);
             }
-            //ICEMAN: are these PSKDemod calls needed?
-            // PSK2 - needs a call to psk1TOpsk2.
-            if (PSKDemod(0, 0, 6, false) == PM3_SUCCESS) {
-                psk1TOpsk2(g_DemodBuffer, g_DemodBufferLen);
-                if (test(DEMOD_PSK2, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                    tests[hits].modulation = DEMOD_PSK2;
-                    tests[hits].bitrate = bitRate;
-                    tests[hits].inverted = false;
-                    tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                    tests[hits].ST = false;
-                    tests[hits].downlink_mode = downlink_mode;
-                    ++hits;
-                }
-            } // inverse waves does not affect this demod
-            // PSK3 - needs a call to psk1TOpsk2.
-            if (PSKDemod(0, 0, 6, false) == PM3_SUCCESS) {
-                psk1TOpsk2(g_DemodBuffer, g_DemodBufferLen);
-                if (test(DEMOD_PSK3, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                    tests[hits].modulation = DEMOD_PSK3;
-                    tests[hits].bitrate = bitRate;
-                    tests[hits].inverted = false;
-                    tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                    tests[hits].ST = false;
-                    tests[hits].downlink_mode = downlink_mode;
-                    ++hits;
-                }
-            } // inverse waves does not affect this demod
-            //undo trim samples
-            restore_bufferS32(saveState, g_GraphBuffer);
-            g_GridOffset = saveState.offset;
-            // t55xx_search_config_psk(g_GraphBuffer, 1);
-            // t55xx_search_config_psk(g_GraphBuffer, 2);
         }
+        demod_ctx_free(&dctx);
+    }
+
+    double grid_offset = g_GridOffset;
+    for (size_t i = 0; i < q.count; i++) {
+        t55xx_detect_adopt(&steps[i], &grid_offset);
+        if (steps[i].hit) {
+            tests[hits++] = steps[i].conf;
+        }
+        PrintAndLogCaptureFree(&steps[i].log);
+        free(steps[i].result.demod);
+        demod_ctx_drop_graph(&steps[i].result);
     }
+    demod_ctx_free(&psk_src);
+    demod_ctx_free(&msrc);
+
     if (hits == 1) {
         config.modulation = tests[0].modulation;
         config.bitrate = tests[0].bitrate;
@@ -1673,38 +1868,38 @@ static int convertQ5bitRate(uint8_t bitRateRead) {
     return -1;
 }
 
-static bool testQ5(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk) {
+static bool testQ5(demod_ctx_t *dctx, uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk) {
 
-    if (g_DemodBufferLen < 64) return false;
+    if (dctx->demod_len < 64) return false;
 
     for (uint8_t idx = 28; idx < 64; idx++) {
         uint8_t si = idx;
-        if (PackBits(si, 28, g_DemodBuffer) == 0x00) continue;
+        if (PackBits(si, 28, dctx->demod) == 0x00) continue;
 
-        uint8_t safer     = PackBits(si, 4, g_DemodBuffer);
+        uint8_t safer     = PackBits(si, 4, dctx->demod);
         si += 4;     //master key
-        uint8_t resv      = PackBits(si, 8, g_DemodBuffer);
+        uint8_t resv      = PackBits(si, 8, dctx->demod);
         si += 8;
         // 2nibble must be zeroed.
         if (safer != 0x6 && safer != 0x9) continue;
         if (resv > 0x00) continue;
-        //uint8_t pageSel   = PackBits(si, 1, g_DemodBuffer); si += 1;
-        //uint8_t fastWrite = PackBits(si, 1, g_DemodBuffer); si += 1;
+        //uint8_t pageSel   = PackBits(si, 1, dctx->demod); si += 1;
+        //uint8_t fastWrite = PackBits(si, 1, dctx->demod); si += 1;
         si += 1 + 1;
-        int bitRate       = PackBits(si, 6, g_DemodBuffer) * 2 + 2;
+        int bitRate       = PackBits(si, 6, dctx->demod) * 2 + 2;
         si += 6;     //bit rate
         if (bitRate > 128 || bitRate < 8) continue;
 
-        //uint8_t AOR       = PackBits(si, 1, g_DemodBuffer); si += 1;
-        //uint8_t PWD       = PackBits(si, 1, g_DemodBuffer); si += 1;
-        //uint8_t pskcr     = PackBits(si, 2, g_DemodBuffer); si += 2;  //could check psk cr
-        //uint8_t inverse   = PackBits(si, 1, g_DemodBuffer); si += 1;
+        //uint8_t AOR       = PackBits(si, 1, dctx->demod); si += 1;
+        //uint8_t PWD       = PackBits(si, 1, dctx->demod); si += 1;
+        //uint8_t pskcr     = PackBits(si, 2, dctx->demod); si += 2;  //could check psk cr
+        //uint8_t inverse   = PackBits(si, 1, dctx->demod); si += 1;
         si += 1 + 1 + 2 + 1;
-        uint8_t modread   = PackBits(si, 3, g_DemodBuffer);
+        uint8_t modread   = PackBits(si, 3, dctx->demod);
         si += 3;
-        uint8_t maxBlk    = PackBits(si, 3, g_DemodBuffer);
+        uint8_t maxBlk    = PackBits(si, 3, dctx->demod);
         si += 3;
-        //uint8_t ST        = PackBits(si, 1, g_DemodBuffer); si += 1;
+        //uint8_t ST        = PackBits(si, 1, dctx->demod); si += 1;
         if (maxBlk == 0) continue;
 
         //test modulation
@@ -1729,9 +1924,9 @@ static bool testBitRate(uint8_t readRate, uint8_t clk) {
     return false;
 }
 
-bool test(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5) {
+bool test(demod_ctx_t *dctx, uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5) {
 
-    if (g_DemodBufferLen < 64) {
+    if (dctx->demod_len < 64) {
         return false;
     }
 
@@ -1739,13 +1934,13 @@ bool test(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5)
 
         uint8_t si = idx;
 
-        if (PackBits(si, 28, g_DemodBuffer) == 0x00) {
+        if (PackBits(si, 28, dctx->demod) == 0x00) {
             continue;
         }
 
-        uint8_t safer    = PackBits(si, 4, g_DemodBuffer);
+        uint8_t safer    = PackBits(si, 4, dctx->demod);
         si += 4;     //master key
-        uint8_t resv     = PackBits(si, 4, g_DemodBuffer);
+        uint8_t resv     = PackBits(si, 4, dctx->demod);
         si += 4;     //was 7 & +=7+3 //should be only 4 bits if extended mode
         // 2nibble must be zeroed.
         // moved test to here, since this gets most faults first.
@@ -1754,15 +1949,15 @@ bool test(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5)
             continue;
         }
 
-        int bitRate      = PackBits(si, 6, g_DemodBuffer);
+        int bitRate      = PackBits(si, 6, dctx->demod);
         si += 6;     //bit rate (includes extended mode part of rate)
-        uint8_t extend   = PackBits(si, 1, g_DemodBuffer);
+        uint8_t extend   = PackBits(si, 1, dctx->demod);
         si += 1;     //bit 15 extended mode
-        uint8_t modread  = PackBits(si, 5, g_DemodBuffer);
+        uint8_t modread  = PackBits(si, 5, dctx->demod);
         si += 5 + 2 + 1;
-        //uint8_t pskcr   = PackBits(si, 2, g_DemodBuffer); si += 2+1;  //could check psk cr
-        //uint8_t nml01    = PackBits(si, 1, g_DemodBuffer); si += 1+5;   //bit 24, 30, 31 could be tested for 0 if not extended mode
-        //uint8_t nml02    = PackBits(si, 2, g_DemodBuffer); si += 2;
+        //uint8_t pskcr   = PackBits(si, 2, dctx->demod); si += 2+1;  //could check psk cr
+        //uint8_t nml01    = PackBits(si, 1, dctx->demod); si += 1+5;   //bit 24, 30, 31 could be tested for 0 if not extended mode
+        //uint8_t nml02    = PackBits(si, 2, dctx->demod); si += 2;
 
         //if extended mode
         bool extMode = ((safer == 0x6 || safer == 0x9) && extend) ? true : false;
@@ -1794,7 +1989,7 @@ bool test(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5)
         return true;
     }
 
-    if (testQ5(mode, offset, fndBitRate, clk)) {
+    if (testQ5(dctx, mode, offset, fndBitRate, clk)) {
         *Q5 = true;
         return true;
     }
@@ -4426,6 +4621,11 @@ static int CmdT55xxSniff(const char *Cmd) {
 
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return PM3_ENODATA;
+    }
+
     // Headings
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(INFO, _CYAN_("T55xx command detection"));
@@ -4449,13 +4649,13 @@ static int CmdT55xxSniff(const char *Cmd) {
         }
 
         // find high
-        while ((idx < g_GraphTraceLen) && (g_GraphBuffer[idx] < 0)) {
+        while ((idx < g_GraphTraceLen) && (gb[idx] < 0)) {
             idx++;
         }
 
         // count high samples
         pulseSamples = 0;
-        while ((idx < g_GraphTraceLen) && (g_GraphBuffer[idx] > 0)) { // last bit seems to be high to zero, but can vary in width..
+        while ((idx < g_GraphTraceLen) && (gb[idx] > 0)) { // last bit seems to be high to zero, but can vary in width..
             pulseSamples++;
             idx++;
         }
@@ -20,6 +20,7 @@
 #define CMDLFT55XX_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 #define T55x7_CONFIGURATION_BLOCK       0x00
 #define T55x7_PWD_BLOCK                 0x07
@@ -210,7 +211,7 @@ bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32
 bool testKnownConfigBlock(uint32_t block0);
 
 bool tryDetectP1(bool getData);
-bool test(uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5);
+bool test(demod_ctx_t *dctx, uint8_t mode, uint8_t *offset, int *fndBitRate, uint8_t clk, bool *Q5);
 int  CmdT55xxSpecial(const char *Cmd);
 bool AcquireData(uint8_t page, uint8_t block, bool pwdmode, uint32_t password, uint8_t downlink_mode);
 uint8_t t55xx_try_one_password(uint32_t password, uint8_t downlink_mode, bool try_all_dl_modes);
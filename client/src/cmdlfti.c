@@ -89,7 +89,7 @@ int demodTI(bool verbose) {
         1, 1, 1, 1, 1, 1, 1, 1
     };
 
-    buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    buffer_savestate_t saveState = save_graph_buffer();
     saveState.offset = g_GridOffset;
 
     int lowLen = ARRAYLEN(LowTone);
@@ -101,24 +101,33 @@ int demodTI(bool verbose) {
     int retval = PM3_ESOFT;
 
     if (g_GraphTraceLen < convLen) {
+        free_graph_buffer(&saveState);
         return retval;
     }
+
+    // written in place,  the snapshot keeps the samples as they were
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        free_graph_buffer(&saveState);
+        return PM3_EMALLOC;
+    }
+
     for (i = 0; i < g_GraphTraceLen - convLen; i++) {
         lowSum = 0;
         highSum = 0;
 
         for (j = 0; j < lowLen; j++) {
-            lowSum += LowTone[j] * g_GraphBuffer[i + j];
+            lowSum += LowTone[j] * gb[i + j];
         }
         for (j = 0; j < highLen; j++) {
-            highSum += HighTone[j] * g_GraphBuffer[i + j];
+            highSum += HighTone[j] * gb[i + j];
         }
         lowSum = abs((100 * lowSum) / lowLen);
         highSum = abs((100 * highSum) / highLen);
         lowSum = (lowSum < 0) ? -lowSum : lowSum;
         highSum = (highSum < 0) ? -highSum : highSum;
 
-        g_GraphBuffer[i] = (highSum << 16) | lowSum;
+        gb[i] = (highSum << 16) | lowSum;
     }
 
     for (i = 0; i < g_GraphTraceLen - convLen - 16; i++) {
@@ -126,12 +135,12 @@ int demodTI(bool verbose) {
         highTot = 0;
         // 16 and 15 are f_s divided by f_l and f_h, rounded
         for (j = 0; j < 16; j++) {
-            lowTot += (g_GraphBuffer[i + j] & 0xffff);
+            lowTot += (gb[i + j] & 0xffff);
         }
         for (j = 0; j < 15; j++) {
-            highTot += (g_GraphBuffer[i + j] >> 16);
+            highTot += (gb[i + j] >> 16);
         }
-        g_GraphBuffer[i] = lowTot - highTot;
+        gb[i] = lowTot - highTot;
     }
 
     g_GraphTraceLen -= (convLen + 16);
@@ -156,11 +165,11 @@ int demodTI(bool verbose) {
         int dec = 0;
         // searching 17 consecutive lows
         for (j = 0; j < 17 * lowLen; j++) {
-            dec -= g_GraphBuffer[i + j];
+            dec -= gb[i + j];
         }
         // searching 7 consecutive highs
         for (; j < 17 * lowLen + 6 * highLen; j++) {
-            dec += g_GraphBuffer[i + j];
+            dec += gb[i + j];
         }
         if (dec > max) {
             max = dec;
@@ -193,10 +202,10 @@ int demodTI(bool verbose) {
     for (i = 0; i < ARRAYLEN(bits) - 1; i++) {
         int high = 0, low = 0;
         for (j = 0; j < lowLen; j++) {
-            low -= g_GraphBuffer[maxPos + j];
+            low -= gb[maxPos + j];
         }
         for (j = 0; j < highLen; j++) {
-            high += g_GraphBuffer[maxPos + j];
+            high += gb[maxPos + j];
         }
 
         if (high > low) {
@@ -278,8 +287,10 @@ int demodTI(bool verbose) {
 
 out:
     if (retval != PM3_SUCCESS) {
-        restore_bufferS32(saveState, g_GraphBuffer);
+        restore_graph_buffer(&saveState);
         g_GridOffset = saveState.offset;
+    } else {
+        free_graph_buffer(&saveState);
     }
 
     return retval;
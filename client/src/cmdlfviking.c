@@ -33,31 +33,31 @@
 static int CmdHelp(const char *Cmd);
 
 //see ASKDemod for what args are accepted
-int demodViking(bool verbose) {
+int demodViking(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
 
     bool st = false;
-    if (ASKDemod_ext(0, 0, 100, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 0, 0, 100, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Viking ASKDemod failed");
         return PM3_ESOFT;
     }
 
-    size_t size = g_DemodBufferLen;
-    int ans = detectViking(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectViking(dctx->demod, &size);
     if (ans < 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Viking Demod %d %s", ans, (ans == -5) ? _RED_("[chksum error]") : "");
         return PM3_ESOFT;
     }
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer + ans, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + ans + 32, 32);
-    uint32_t cardid = bytebits_to_byte(g_DemodBuffer + ans + 24, 32);
-    uint8_t  checksum = bytebits_to_byte(g_DemodBuffer + ans + 32 + 24, 8);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod + ans, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + ans + 32, 32);
+    uint32_t cardid = bytebits_to_byte(dctx->demod + ans + 24, 32);
+    uint8_t  checksum = bytebits_to_byte(dctx->demod + ans + 32 + 24, 8);
     PrintAndLogEx(SUCCESS, "Viking - Card " _GREEN_("%08X") ", Raw: %08X%08X", cardid, raw1, raw2);
     PrintAndLogEx(DEBUG, "Checksum: %02X", checksum);
-    setDemodBuff(g_DemodBuffer, 64, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 64, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
     return PM3_SUCCESS;
 }
 
@@ -74,7 +74,7 @@ static int CmdVikingDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodViking(true);
+    return demod_ctx_run_main(demodViking, true);
 }
 
 //see ASKDemod for what args are accepted
@@ -101,7 +101,7 @@ static int CmdVikingReader(const char *Cmd) {
 
     do {
         lf_read(false, 10000);
-        demodViking(true);
+        demod_ctx_run_main(demodViking, true);
     } while (cm && !kbd_enter_pressed());
 
     return PM3_SUCCESS;
@@ -19,10 +19,11 @@
 #define CMDLFVIKING_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFViking(const char *Cmd);
 
-int demodViking(bool verbose);
+int demodViking(demod_ctx_t *dctx, bool verbose);
 int detectViking(uint8_t *src, size_t *size);
 uint64_t getVikingBits(uint32_t id);
 
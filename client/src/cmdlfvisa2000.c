@@ -82,23 +82,32 @@ static uint8_t visa_parity(uint32_t id) {
 *
 **/
 //see ASKDemod for what args are accepted
-int demodVisa2k(bool verbose) {
+// only the main context moves the plot grid
+static void visa2k_restore(demod_ctx_t *dctx, buffer_savestate_t *saveState) {
+    restore_graph_buffer_ctx(dctx, saveState);
+    if (dctx->is_main) {
+        g_GridOffset = saveState->offset;
+    }
+}
+
+int demodVisa2k(demod_ctx_t *dctx, bool verbose) {
     (void) verbose; // unused so far
-    buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
-    saveState.offset = g_GridOffset;
+    buffer_savestate_t saveState = save_graph_buffer_ctx(dctx);
+    if (dctx->is_main) {
+        saveState.offset = g_GridOffset;
+    }
 
     //CmdAskEdgeDetect("");
 
     //ASK / Manchester
     bool st = true;
-    if (ASKDemod_ext(64, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
+    if (ASKDemod_ext_ctx(dctx, 64, 0, 0, 0, false, false, false, 1, &st) != PM3_SUCCESS) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Visa2k: ASK/Manchester Demod failed");
-        restore_bufferS32(saveState, g_GraphBuffer);
-        g_GridOffset = saveState.offset;
+        visa2k_restore(dctx, &saveState);
         return PM3_ESOFT;
     }
-    size_t size = g_DemodBufferLen;
-    int ans = detectVisa2k(g_DemodBuffer, &size);
+    size_t size = dctx->demod_len;
+    int ans = detectVisa2k(dctx->demod, &size);
     if (ans < 0) {
         if (ans == -1)
             PrintAndLogEx(DEBUG, "DEBUG: Error - Visa2k: too few bits found");
@@ -109,17 +118,16 @@ int demodVisa2k(bool verbose) {
         else
             PrintAndLogEx(DEBUG, "DEBUG: Error - Visa2k: ans: %d", ans);
 
-        restore_bufferS32(saveState, g_GraphBuffer);
-        g_GridOffset = saveState.offset;
+        visa2k_restore(dctx, &saveState);
         return PM3_ESOFT;
     }
-    setDemodBuff(g_DemodBuffer, 96, ans);
-    setClockGrid(g_DemodClock, g_DemodStartIdx + (ans * g_DemodClock));
+    setDemodBuff_ctx(dctx, dctx->demod, 96, ans);
+    setClockGrid_ctx(dctx, dctx->demod_clock, dctx->demod_start_idx + (ans * dctx->demod_clock));
 
     //got a good demod
-    uint32_t raw1 = bytebits_to_byte(g_DemodBuffer, 32);
-    uint32_t raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
-    uint32_t raw3 = bytebits_to_byte(g_DemodBuffer + 64, 32);
+    uint32_t raw1 = bytebits_to_byte(dctx->demod, 32);
+    uint32_t raw2 = bytebits_to_byte(dctx->demod + 32, 32);
+    uint32_t raw3 = bytebits_to_byte(dctx->demod + 64, 32);
 
     // chksum
     uint8_t calc = visa_chksum(raw2);
@@ -128,8 +136,7 @@ int demodVisa2k(bool verbose) {
     // test checksums
     if (chk != calc) {
         PrintAndLogEx(DEBUG, "DEBUG: error: Visa2000 checksum (%s) %x - %x\n", _RED_("fail"), chk, calc);
-        restore_bufferS32(saveState, g_GraphBuffer);
-        g_GridOffset = saveState.offset;
+        visa2k_restore(dctx, &saveState);
         return PM3_ESOFT;
     }
     // parity
@@ -137,10 +144,10 @@ int demodVisa2k(bool verbose) {
     uint8_t chk_par = (raw3 & 0xFF0) >> 4;
     if (calc_par != chk_par) {
         PrintAndLogEx(DEBUG, "DEBUG: error: Visa2000 parity (%s) %x - %x\n", _RED_("fail"), chk_par, calc_par);
-        restore_bufferS32(saveState, g_GraphBuffer);
-        g_GridOffset = saveState.offset;
+        visa2k_restore(dctx, &saveState);
         return PM3_ESOFT;
     }
+    free_graph_buffer(&saveState);
     PrintAndLogEx(SUCCESS, "Visa2000 - Card " _GREEN_("%u") ", Raw: %08X%08X%08X", raw2,  raw1, raw2, raw3);
     return PM3_SUCCESS;
 }
@@ -158,7 +165,7 @@ static int CmdVisa2kDemod(const char *Cmd) {
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
-    return demodVisa2k(true);
+    return demod_ctx_run_main(demodVisa2k, true);
 }
 
 // 64*96*2=12288 samples just in case we just missed the first preamble we can still catch 2 of them
@@ -184,7 +191,7 @@ static int CmdVisa2kReader(const char *Cmd) {
 
     do {
         lf_read(false, 20000);
-        demodVisa2k(!cm);
+        demod_ctx_run_main(demodVisa2k, !cm);
     } while (cm && !kbd_enter_pressed());
     return PM3_SUCCESS;
 }
@@ -19,11 +19,12 @@
 #define CMDLFVISA2000_H__
 
 #include "common.h"
+#include "graph.h"   // demod_ctx_t
 
 int CmdLFVisa2k(const char *Cmd);
 
 int getvisa2kBits(uint64_t fullcode, uint8_t *bits);
-int demodVisa2k(bool verbose);
+int demodVisa2k(demod_ctx_t *dctx, bool verbose);
 int detectVisa2k(uint8_t *dest, size_t *size);
 
 #endif
@@ -368,7 +368,12 @@ static int CmdHelp(const char *Cmd) {
 // then presses Enter, which the full command line that they typed.
 //-----------------------------------------------------------------------------
 int CommandReceived(const char *Cmd) {
-    return CmdsParse(CommandTable, Cmd);
+    // files may have come and gone since the last command
+    searchFileCacheInvalidate();
+    int res = CmdsParse(CommandTable, Cmd);
+    // the output of a command is on screen and in the log once it returns
+    PrintAndLogFlush();
+    return res;
 }
 
 command_t *getTopLevelCommandTable(void) {
@@ -367,8 +367,15 @@ static int CmdScriptRun(const char *Cmd) {
             lua_pushstring(lua_state, arguments);
             lua_setglobal(lua_state, "args");
 
+            // print() in the script writes to stdout itself, keep the client output in step with it
+            bool old_flush = GetFlushAfterWrite();
+            SetFlushAfterWrite(true);
+            PrintAndLogFlush();
+
             //Call it with 0 arguments
             error = lua_pcall(lua_state, 0, LUA_MULTRET, 0); // once again, returns non-0 on error,
+
+            SetFlushAfterWrite(old_flush);
         }
         if (error) { // if non-0, then an error
             // the top of the stack should be the error string
@@ -515,7 +522,12 @@ static int CmdScriptRun(const char *Cmd) {
             free(script_path);
             return PM3_ESOFT;
         }
+        // print() in the script writes to stdout itself, keep the client output in step with it
+        bool old_flush = GetFlushAfterWrite();
+        SetFlushAfterWrite(true);
+        PrintAndLogFlush();
         int ret = Pm3PyRun_SimpleFileNoExit(f, filename);
+        SetFlushAfterWrite(old_flush);
 #if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION < 10
         // Py_DecodeLocale() allocates memory that needs to be free'd
         for (int i = 0; i < argc + 1; i++) {
@@ -18,6 +18,7 @@
 #include "cmdtrace.h"
 
 #include <ctype.h>
+#include <pthread.h>
 
 #include "cmdparser.h"    // command_t
 #include "protocols.h"
@@ -32,23 +33,152 @@
 #include "cmdlfhitagu.h"        // annotate hitagu
 #include "pm3_cmd.h"            // tracelog_hdr_t
 #include "cliparser.h"          // args..
+#include "util.h"               // num_CPUs
+#include "pcapng.h"             // trace save --pcapng
 
 static int CmdHelp(const char *Cmd);
 
 // trace pointer
 static uint8_t *gs_trace;
-static uint16_t gs_traceLen = 0;
+static uint64_t gs_traceLen = 0;
+// large trace files are not read into gs_trace, they are streamed from disk each time
+static char *gs_trace_path = NULL;
+
+// trace files up to this size are loaded into memory
+#define TRACE_MEM_MAX       (16 * 1024 * 1024)
+
+// window over a streamed trace. When less than the lookahead is left it slides on,
+// the lookahead holds several of the largest records so the annotators looking
+// a few records ahead never run off the window.
+#define TRACE_WINDOW        (1024 * 1024)
+#define TRACE_LOOKAHEAD     (TRACE_WINDOW / 2)
+
+typedef struct {
+    FILE *f;                    // NULL when reading gs_trace
+    uint8_t *buf;               // window over the trace
+    uint32_t len;               // bytes in the window
+    uint64_t base;              // trace offset of buf[0]
+    uint64_t total;             // bytes of trace to read
+    uint32_t first_timestamp;   // of the first record in the trace
+} trace_cursor_t;
+
+static void trace_free(void) {
+    free(gs_trace);
+    gs_trace = NULL;
+    free(gs_trace_path);
+    gs_trace_path = NULL;
+    gs_traceLen = 0;
+}
+
+// Slides the window on so *tracepos and the lookahead after it are in it.
+// Returns false when the trace has been read to the end
+static bool trace_cursor_fill(trace_cursor_t *tc, uint32_t *tracepos) {
+
+    if (*tracepos > tc->len) {
+        *tracepos = tc->len;
+    }
+
+    uint64_t end = tc->base + tc->len;
+    if (tc->f && end < tc->total && tc->len - *tracepos < TRACE_LOOKAHEAD) {
+        uint32_t keep = tc->len - *tracepos;
+        memmove(tc->buf, tc->buf + *tracepos, keep);
+        tc->base += *tracepos;
+        tc->len = keep;
+        *tracepos = 0;
+
+        size_t want = TRACE_WINDOW - keep;
+        if (tc->total - end < want) {
+            want = tc->total - end;
+        }
+
+        size_t got = fread(tc->buf + keep, 1, want, tc->f);
+        tc->len += got;
+        if (got < want) {
+            // file ends early, don't try again
+            tc->total = tc->base + tc->len;
+        }
+    }
+    return (*tracepos < tc->len);
+}
+
+// Moves the cursor to a trace offset, *tracepos is set to where it is in the window
+static int trace_cursor_seek(trace_cursor_t *tc, uint64_t offset, uint32_t *tracepos) {
+
+    if (offset >= tc->base && offset <= tc->base + tc->len) {
+        *tracepos = offset - tc->base;
+        return PM3_SUCCESS;
+    }
+
+    if (tc->f == NULL || offset > tc->total || fseeko(tc->f, offset, SEEK_SET) != 0) {
+        return PM3_EINVARG;
+    }
+
+    tc->base = offset;
+    tc->len = 0;
+    *tracepos = 0;
+    return PM3_SUCCESS;
+}
+
+static void trace_cursor_close(trace_cursor_t *tc) {
+    if (tc->f) {
+        fclose(tc->f);
+        free(tc->buf);
+    }
+    memset(tc, 0, sizeof(trace_cursor_t));
+}
+
+static int trace_cursor_open_file(trace_cursor_t *tc, const char *path, uint64_t total) {
+    memset(tc, 0, sizeof(trace_cursor_t));
+
+    tc->f = fopen(path, "rb");
+    if (tc->f == NULL) {
+        PrintAndLogEx(WARNING, "file not found or locked `" _YELLOW_("%s") "`", path);
+        return PM3_EFILE;
+    }
+
+    tc->buf = calloc(TRACE_WINDOW, sizeof(uint8_t));
+    if (tc->buf == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        fclose(tc->f);
+        tc->f = NULL;
+        return PM3_EMALLOC;
+    }
+
+    tc->total = total;
+    uint32_t tracepos = 0;
+    trace_cursor_fill(tc, &tracepos);
+    if (tc->len >= TRACELOG_HDR_LEN) {
+        tc->first_timestamp = ((tracelog_hdr_t *)tc->buf)->timestamp;
+    }
+    return PM3_SUCCESS;
+}
+
+// cursor over the current trace, from memory or streamed from its file
+static int trace_cursor_open(trace_cursor_t *tc) {
+    if (gs_trace_path) {
+        return trace_cursor_open_file(tc, gs_trace_path, gs_traceLen);
+    }
+
+    memset(tc, 0, sizeof(trace_cursor_t));
+    tc->buf = gs_trace;
+    tc->len = gs_traceLen;
+    tc->total = gs_traceLen;
+    if (gs_trace && tc->len >= TRACELOG_HDR_LEN) {
+        tc->first_timestamp = ((tracelog_hdr_t *)gs_trace)->timestamp;
+    }
+    return PM3_SUCCESS;
+}
 
-static bool is_last_record(uint16_t tracepos, uint16_t traceLen) {
+static bool is_last_record(uint32_t tracepos, uint32_t traceLen) {
     return ((tracepos + TRACELOG_HDR_LEN) >= traceLen);
 }
 
-static bool next_record_is_response(uint16_t tracepos, uint8_t *trace) {
+static bool next_record_is_response(uint32_t tracepos, uint8_t *trace) {
     const tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
     return (hdr->isResponse);
 }
 
-static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint16_t *tracepos, uint16_t traceLen,
+static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint32_t *tracepos, uint32_t traceLen,
                                       uint8_t *trace, const uint8_t *frame, uint8_t *topaz_reader_command, uint16_t *data_len) {
 
 #define MAX_TOPAZ_READER_CMD_LEN 16
@@ -95,12 +225,9 @@ static uint8_t calc_pos(const uint8_t *d) {
 
 // Copy an existing buffer into client trace buffer
 // I think this is cleaner than further globalizing gs_trace, and may lend itself to more modularity later?
-bool ImportTraceBuffer(const uint8_t *trace_src, uint16_t trace_len) {
+bool ImportTraceBuffer(const uint8_t *trace_src, uint32_t trace_len) {
     if (trace_len == 0 || trace_src == NULL) return (false);
-    if (gs_trace) {
-        free(gs_trace);
-        gs_traceLen = 0;
-    }
+    trace_free();
     gs_trace = calloc(trace_len, sizeof(uint8_t));
     if (gs_trace == NULL) {
         return (false);
@@ -116,7 +243,7 @@ static uint8_t extract_epurse[8] = {0};
 
 #define SKIP_TO_NEXT(a)  (TRACELOG_HDR_LEN + (a)->data_len + TRACELOG_PARITY_LEN((a)))
 
-static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
+static uint32_t extractChall_ev2(uint32_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
     tracelog_hdr_t *next_hdr = (tracelog_hdr_t *)(trace + tracepos);
     if (next_hdr->data_len != 21) {
         return 0;
@@ -137,7 +264,7 @@ static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdp
     return tracepos;
 }
 
-static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t *trace) {
+static uint32_t extractChallenges(uint32_t tracepos, uint32_t traceLen, uint8_t *trace) {
 
     // sanity check
     if (is_last_record(tracepos, traceLen)) {
@@ -411,7 +538,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2F: {
                 PrintAndLogEx(INFO, "Found a MFDES Auth EV2 First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -420,7 +547,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2NF: {
                 PrintAndLogEx(INFO, "Found a MFDES Auth EV2 Non First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -432,13 +559,13 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
     return tracepos;
 }
 
-static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol) {
+static uint32_t printHexLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint8_t protocol) {
     // sanity check
     if (is_last_record(tracepos, traceLen)) return traceLen;
 
     tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
 
-    if (TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
+    if (tracepos + TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
         return traceLen;
     }
 
@@ -450,7 +577,7 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
         return tracepos;
     }
 
-    uint16_t ret;
+    uint32_t ret;
 
     switch (protocol) {
         case ISO_14443A: {
@@ -498,7 +625,7 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
     return ret;
 }
 
-static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
+static uint32_t printTraceLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint32_t first_timestamp, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
                                const uint64_t *mfDicKeys, uint32_t mfDicKeysCount) {
     // sanity check
     if (is_last_record(tracepos, traceLen)) {
@@ -509,7 +636,6 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
     uint32_t end_of_transmission_timestamp = 0;
     uint8_t topaz_reader_command[9];
     char explanation[60] = {0};
-    tracelog_hdr_t *first_hdr = (tracelog_hdr_t *)(trace);
     tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
 
     uint32_t duration = hdr->duration;
@@ -873,8 +999,8 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
         if (j == 0) {
 
 
-            uint32_t time1 = hdr->timestamp - first_hdr->timestamp;
-            uint32_t time2 = end_of_transmission_timestamp - first_hdr->timestamp;
+            uint32_t time1 = hdr->timestamp - first_timestamp;
+            uint32_t time2 = end_of_transmission_timestamp - first_timestamp;
             if (prev_eot) {
                 time1 = hdr->timestamp - previous_end_of_transmission_timestamp;
                 time2 = duration;
@@ -1062,8 +1188,8 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
 
         const tracelog_hdr_t *next_hdr = (tracelog_hdr_t *)(trace + tracepos);
 
-        uint32_t time1 = end_of_transmission_timestamp - first_hdr->timestamp;
-        uint32_t time2 = next_hdr->timestamp - first_hdr->timestamp;
+        uint32_t time1 = end_of_transmission_timestamp - first_timestamp;
+        uint32_t time2 = next_hdr->timestamp - first_timestamp;
         if (prev_eot) {
             time1 = 0;
             time2 = next_hdr->timestamp - end_of_transmission_timestamp;
@@ -1095,11 +1221,7 @@ static int download_trace(void) {
     }
 
     // reserve some space.
-    if (gs_trace) {
-        free(gs_trace);
-    }
-
-    gs_traceLen = 0;
+    trace_free();
 
     gs_trace = calloc(PM3_CMD_DATA_SIZE, sizeof(uint8_t));
     if (gs_trace == NULL) {
@@ -1178,20 +1300,67 @@ static int CmdTraceExtract(const char *Cmd) {
         return PM3_EINVARG;
     }
 
-    PrintAndLogEx(SUCCESS, "Recorded activity ( " _YELLOW_("%u") " bytes )", gs_traceLen);
+    PrintAndLogEx(SUCCESS, "Recorded activity ( " _YELLOW_("%" PRIu64) " bytes )", gs_traceLen);
     if (gs_traceLen == 0) {
         return PM3_SUCCESS;
     }
 
-    uint16_t tracepos = 0;
+    trace_cursor_t tc;
+    int res = trace_cursor_open(&tc);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    uint32_t tracepos = 0;
 
-    while (tracepos < gs_traceLen) {
-        tracepos = extractChallenges(tracepos, gs_traceLen, gs_trace);
+    while (trace_cursor_fill(&tc, &tracepos)) {
+        tracepos = extractChallenges(tracepos, tc.len, tc.buf);
 
         if (kbd_enter_pressed()) {
             break;
         }
     }
+    trace_cursor_close(&tc);
+    return PM3_SUCCESS;
+}
+
+// Returns the record at *tracepos and steps over it, NULL when no complete record is left in the window
+static const tracelog_hdr_t *trace_next_record(const trace_cursor_t *tc, uint32_t *tracepos) {
+
+    if (tc->len - *tracepos < TRACELOG_HDR_LEN) {
+        return NULL;
+    }
+
+    const tracelog_hdr_t *hdr = (tracelog_hdr_t *)(tc->buf + *tracepos);
+    if (*tracepos + SKIP_TO_NEXT(hdr) > tc->len) {
+        return NULL;
+    }
+
+    *tracepos += SKIP_TO_NEXT(hdr);
+    return hdr;
+}
+
+// Walks the records of a trace file, returns the bytes up to the end of the last complete record
+static int trace_file_scan(const char *path, uint64_t *valid, uint64_t *filelen, uint64_t *records) {
+
+    trace_cursor_t tc;
+    int res = trace_cursor_open_file(&tc, path, UINT64_MAX);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    *records = 0;
+    uint32_t tracepos = 0;
+    while (trace_cursor_fill(&tc, &tracepos)) {
+        if (trace_next_record(&tc, &tracepos) == NULL) {
+            break;
+        }
+        (*records)++;
+    }
+
+    *valid = tc.base + tracepos;
+    *filelen = tc.base + tc.len;
+    trace_cursor_close(&tc);
     return PM3_SUCCESS;
 }
 
@@ -1216,37 +1385,267 @@ static int CmdTraceLoad(const char *Cmd) {
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
     CLIParserFree(ctx);
 
-    if (gs_trace) {
-        free(gs_trace); // maybe better to not clobber this until we have successful load?
-        gs_trace = NULL;
-        gs_traceLen = 0;
-    }
-
-    size_t len = 0;
-    if (loadFile_safe(filename, ".trace", (void **)&gs_trace, &len) != PM3_SUCCESS) {
+    char *path = NULL;
+    if (searchFile(&path, RESOURCES_SUBDIR, filename, ".trace", false) != PM3_SUCCESS) {
         PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
         return PM3_EIO;
     }
 
-    gs_traceLen = (long)len;
+    uint64_t len = 0, filelen = 0, records = 0;
+    int res = trace_file_scan(path, &len, &filelen, &records);
+    if (res != PM3_SUCCESS) {
+        free(path);
+        return res;
+    }
+
+    if (len == 0) {
+        PrintAndLogEx(FAILED, "No trace records in file " _YELLOW_("%s"), path);
+        free(path);
+        return PM3_EFILE;
+    }
+
+    if (len < filelen) {
+        PrintAndLogEx(WARNING, "Trace ends in a truncated record, ignoring last " _YELLOW_("%" PRIu64) " bytes", filelen - len);
+    }
+
+    trace_free();
+
+    if (len > TRACE_MEM_MAX) {
+        // keep it on disk, list / extract / save stream it from there
+        gs_trace_path = path;
+        gs_traceLen = len;
+        PrintAndLogEx(INFO, "Large trace, it will be streamed from file");
+    } else {
+        FILE *f = fopen(path, "rb");
+        if (f == NULL) {
+            PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
+            free(path);
+            return PM3_EIO;
+        }
+
+        gs_trace = calloc(len, sizeof(uint8_t));
+        if (gs_trace == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            fclose(f);
+            free(path);
+            return PM3_EMALLOC;
+        }
+
+        if (fread(gs_trace, 1, len, f) != len) {
+            PrintAndLogEx(FAILED, "error, bytes read mismatch file size");
+            fclose(f);
+            free(path);
+            trace_free();
+            return PM3_EFILE;
+        }
+        fclose(f);
+        gs_traceLen = len;
 
-    PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%u") " bytes)", gs_traceLen);
+        PrintAndLogEx(SUCCESS, "Loaded " _YELLOW_("%" PRIu64) " bytes from binary file `" _YELLOW_("%s") "`", len, path);
+        free(path);
+    }
+
+    PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%" PRIu64) " bytes, " _YELLOW_("%" PRIu64) " records)", gs_traceLen, records);
     PrintAndLogEx(HINT, "Hint: Try `" _YELLOW_("trace list -1 -t ...") "` to view trace.  Remember the " _YELLOW_("`-1`") " param");
     return PM3_SUCCESS;
 }
 
+// Protocol of a `-t` parameter, -1 for raw (no crc, no annotations)
+static int trace_protocol_from_str(const char *type, uint8_t *protocol) {
+
+    *protocol = -1;
+
+    if (strcmp(type, "14a") == 0)      *protocol = ISO_14443A;
+    else if (strcmp(type, "14b") == 0)      *protocol = ISO_14443B;
+    else if (strcmp(type, "15") == 0)       *protocol = ISO_15693;
+    else if (strcmp(type, "7816") == 0)     *protocol = ISO_7816_4;
+    else if (strcmp(type, "cryptorf") == 0) *protocol = PROTO_CRYPTORF;
+    else if (strcmp(type, "des") == 0)      *protocol = MFDES;
+    else if (strcmp(type, "felica") == 0)   *protocol = FELICA;
+    else if (strcmp(type, "ht1") == 0)   *protocol = PROTO_HITAG1;
+    else if (strcmp(type, "ht2") == 0)   *protocol = PROTO_HITAG2;
+    else if (strcmp(type, "hts") == 0)   *protocol = PROTO_HITAGS;
+    else if (strcmp(type, "htu") == 0)   *protocol = PROTO_HITAGU;
+    else if (strcmp(type, "iclass") == 0)   *protocol = ICLASS;
+    else if (strcmp(type, "legic") == 0)    *protocol = LEGIC;
+    else if (strcmp(type, "lto") == 0)      *protocol = LTO;
+    else if (strcmp(type, "mf") == 0)       *protocol = PROTO_MIFARE;
+    else if (strcmp(type, "raw") == 0)      *protocol = -1;
+    else if (strcmp(type, "seos") == 0)     *protocol = SEOS;
+    else if (strcmp(type, "thinfilm") == 0) *protocol = THINFILM;
+    else if (strcmp(type, "topaz") == 0)    *protocol = TOPAZ;
+    else if (strcmp(type, "mfp") == 0)      *protocol = PROTO_MFPLUS;
+    else if (strcmp(type, "fmcos20") == 0)  *protocol = PROTO_FMCOS20;
+    else if (strcmp(type, "") == 0)         *protocol = -1;
+    else {
+        PrintAndLogEx(FAILED, "Unknown protocol \"%s\"", type);
+        return PM3_EINVARG;
+    }
+    return PM3_SUCCESS;
+}
+
+// pcapng link type, interface name and tick rate of the trace timestamps for a protocol
+typedef struct {
+    uint16_t linktype;
+    const char *ifname;
+    uint32_t clock_hz;
+} trace_pcapng_proto_t;
+
+static void trace_pcapng_proto(uint8_t protocol, trace_pcapng_proto_t *pp) {
+
+    pp->linktype = PCAPNG_LINKTYPE_USER0;
+    pp->ifname = "proxmark3";
+    pp->clock_hz = 13560000;
+
+    switch (protocol) {
+        case ISO_14443A:
+        case PROTO_MIFARE:
+        case PROTO_MFPLUS:
+        case MFDES:
+        case TOPAZ:
+        case THINFILM:
+        case LTO:
+        case SEOS:
+        case PROTO_FMCOS20:
+            pp->linktype = PCAPNG_LINKTYPE_ISO_14443;
+            pp->ifname = "ISO14443A";
+            break;
+        case ISO_14443B:
+        case PROTO_CRYPTORF:
+            pp->linktype = PCAPNG_LINKTYPE_ISO_14443;
+            pp->ifname = "ISO14443B";
+            break;
+        case ISO_15693:
+            pp->ifname = "ISO15693";
+            break;
+        case ICLASS:
+            pp->ifname = "iCLASS";
+            break;
+        case FELICA:
+            pp->ifname = "FeliCa";
+            break;
+        case ISO_7816_4:
+            pp->ifname = "ISO7816";
+            break;
+        case LEGIC:
+            // reader mode ticks
+            pp->ifname = "LEGIC";
+            pp->clock_hz = 1500000;
+            break;
+        case PROTO_HITAG1:
+        case PROTO_HITAG2:
+        case PROTO_HITAGS:
+        case PROTO_HITAGU:
+            // ETU of 8us
+            pp->ifname = "Hitag";
+            pp->clock_hz = 125000;
+            break;
+        default:
+            break;
+    }
+}
+
+// Writes the trace as pcapng, one packet per record, straight from the trace buffer or file.
+// The 32 bit tracelog timestamps are extended over their wraps and turned into nanoseconds
+// from the start of the trace. ISO 14443 frames get the pseudo header Wireshark decodes
+// (https://www.kaiser.cx/pcap-iso14443.html), others go out as they are on USER0.
+static int trace_save_pcapng(const char *filename, uint8_t protocol) {
+
+    char *fn = newfilenamemcopyEx(filename, ".pcapng", spDefault);
+    if (fn == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    trace_pcapng_proto_t pp;
+    trace_pcapng_proto(protocol, &pp);
+
+    trace_cursor_t tc;
+    int res = trace_cursor_open(&tc);
+    if (res != PM3_SUCCESS) {
+        free(fn);
+        return res;
+    }
+
+    pcapng_t pcap;
+    res = pcapng_open(&pcap, fn, pp.linktype, pp.ifname);
+    if (res != PM3_SUCCESS) {
+        trace_cursor_close(&tc);
+        free(fn);
+        return res;
+    }
+
+    uint64_t ticks = 0;
+    uint32_t prev_ts = tc.first_timestamp;
+    uint32_t tracepos = 0;
+    while (trace_cursor_fill(&tc, &tracepos)) {
+
+        const tracelog_hdr_t *hdr = trace_next_record(&tc, &tracepos);
+        if (hdr == NULL) {
+            break;
+        }
+
+        // records are in time order, a big step back is the counter wrapping
+        uint32_t delta = hdr->timestamp - prev_ts;
+        if (delta < 0x80000000) {
+            ticks += delta;
+        } else {
+            ticks -= MIN(ticks, (uint32_t)(prev_ts - hdr->timestamp));
+        }
+        prev_ts = hdr->timestamp;
+
+        uint64_t ts_ns = (ticks / pp.clock_hz) * 1000000000ULL + ((ticks % pp.clock_hz) * 1000000000ULL) / pp.clock_hz;
+        uint32_t flags = (hdr->isResponse) ? PCAPNG_DIR_INBOUND : PCAPNG_DIR_OUTBOUND;
+
+        if (pp.linktype == PCAPNG_LINKTYPE_ISO_14443) {
+            uint8_t pseudo[4] = {
+                0x00,
+                (hdr->isResponse) ? 0xFF : 0xFE,
+                (hdr->data_len >> 8) & 0xFF,
+                hdr->data_len & 0xFF
+            };
+            res = pcapng_write(&pcap, ts_ns, pseudo, sizeof(pseudo), hdr->frame, hdr->data_len, flags);
+        } else {
+            res = pcapng_write(&pcap, ts_ns, NULL, 0, hdr->frame, hdr->data_len, flags);
+        }
+
+        if (res != PM3_SUCCESS) {
+            break;
+        }
+    }
+    trace_cursor_close(&tc);
+
+    if (pcapng_close(&pcap) != PM3_SUCCESS) {
+        res = PM3_EFILE;
+    }
+
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "error, failed to write pcapng file `" _YELLOW_("%s") "`", fn);
+        free(fn);
+        return res;
+    }
+
+    PrintAndLogEx(SUCCESS, "Saved " _YELLOW_("%" PRIu64) " packets ( " _YELLOW_("%" PRIu64) " bytes ) to pcapng file `" _YELLOW_("%s") "`", pcap.packets, pcap.bytes, fn);
+    PrintAndLogEx(HINT, "Hint: Try `" _YELLOW_("wireshark %s") "` to view it", fn);
+    free(fn);
+    return PM3_SUCCESS;
+}
+
 static int CmdTraceSave(const char *Cmd) {
 
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "trace save",
                   "Save protocol data from trace buffer to binary file\n"
-                  "File extension is <.trace>",
-                  "trace save -f mytracefile    -> w/o file extension"
+                  "File extension is <.trace>, or <.pcapng> when saving as pcapng for Wireshark",
+                  "trace save -f mytracefile                -> w/o file extension\n"
+                  "trace save -f mytracefile --pcapng       -> save as pcapng, ISO 14443A\n"
+                  "trace save -f mytracefile --pcapng -t 15 -> save as pcapng, ISO 15693"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_str1("f", "file", "<fn>", "Specify trace file to save"),
+        arg_lit0(NULL, "pcapng", "save as pcapng"),
+        arg_str0("t", "type", "<str>", "protocol of the trace, see `trace list` (def: 14a)"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -1254,8 +1653,20 @@ static int CmdTraceSave(const char *Cmd) {
     int fnlen = 0;
     char filename[FILE_PATH_SIZE] = {0};
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+
+    bool use_pcapng = arg_get_lit(ctx, 2);
+
+    int tlen = 0;
+    char type[10] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 3), (uint8_t *)type, sizeof(type), &tlen);
+    str_lower(type);
     CLIParserFree(ctx);
 
+    uint8_t protocol = ISO_14443A;
+    if (tlen && trace_protocol_from_str(type, &protocol) != PM3_SUCCESS) {
+        return PM3_EINVARG;
+    }
+
     if (gs_traceLen == 0) {
         download_trace();
         if (gs_traceLen == 0) {
@@ -1264,10 +1675,436 @@ static int CmdTraceSave(const char *Cmd) {
         }
     }
 
-    saveFile(filename, ".trace", gs_trace, gs_traceLen);
+    if (use_pcapng) {
+        return trace_save_pcapng(filename, protocol);
+    }
+
+    if (gs_trace_path == NULL) {
+        saveFile(filename, ".trace", gs_trace, gs_traceLen);
+        return PM3_SUCCESS;
+    }
+
+    // streamed trace, copy it over window by window
+    char *fn = newfilenamemcopyEx(filename, ".trace", spDefault);
+    if (fn == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    trace_cursor_t tc;
+    int res = trace_cursor_open(&tc);
+    if (res != PM3_SUCCESS) {
+        free(fn);
+        return res;
+    }
+
+    FILE *f = fopen(fn, "wb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "file not found or locked `" _YELLOW_("%s") "`", fn);
+        trace_cursor_close(&tc);
+        free(fn);
+        return PM3_EFILE;
+    }
+
+    uint64_t saved = 0;
+    uint32_t tracepos = 0;
+    while (trace_cursor_fill(&tc, &tracepos)) {
+        if (fwrite(tc.buf + tracepos, 1, tc.len - tracepos, f) != tc.len - tracepos) {
+            break;
+        }
+        saved += tc.len - tracepos;
+        tracepos = tc.len;
+    }
+    fclose(f);
+    trace_cursor_close(&tc);
+
+    if (saved != gs_traceLen) {
+        PrintAndLogEx(FAILED, "error, only saved " _YELLOW_("%" PRIu64) " of %" PRIu64 " bytes to `" _YELLOW_("%s") "`", saved, gs_traceLen, fn);
+        free(fn);
+        return PM3_EFILE;
+    }
+
+    PrintAndLogEx(SUCCESS, "Saved " _YELLOW_("%" PRIu64) " bytes to binary file `" _YELLOW_("%s") "`", saved, fn);
+    free(fn);
+    return PM3_SUCCESS;
+}
+
+// Record index, one entry per record, built in one pass before listing.
+// Lets trace list start at any record and cut the trace in card sessions.
+typedef struct {
+    uint64_t offset : 48;       // of the record, from the start of the trace
+    uint64_t data_len : 15;
+    uint64_t isResponse : 1;
+    uint32_t timestamp;
+    uint16_t duration;
+    uint16_t flags;
+} trace_rec_t;
+
+#define TRACE_REC_SESSION   0x0001      // a new card session starts here, see trace_index_build()
+
+// reader REQA / WUPA
+static bool trace_rec_is_wakeup(const tracelog_hdr_t *hdr) {
+    return (hdr->isResponse == false && hdr->data_len == 1 &&
+            (hdr->frame[0] == ISO14443A_CMD_REQA || hdr->frame[0] == ISO14443A_CMD_WUPA));
+}
+
+// reader SELECT of any cascade level
+static bool trace_rec_is_select(const tracelog_hdr_t *hdr) {
+    return (hdr->isResponse == false && hdr->data_len == 9 && hdr->frame[1] == 0x70 &&
+            hdr->frame[0] >= ISO14443A_CMD_ANTICOLL_OR_SELECT && hdr->frame[0] <= ISO14443A_CMD_ANTICOLL_OR_SELECT_3);
+}
+
+// card answers and reader ANTICOLL, what comes between a wakeup and the SELECT
+static bool trace_rec_is_anticoll(const tracelog_hdr_t *hdr) {
+    return (hdr->isResponse || (hdr->data_len >= 2 && hdr->data_len < 9 &&
+                                hdr->frame[0] >= ISO14443A_CMD_ANTICOLL_OR_SELECT && hdr->frame[0] <= ISO14443A_CMD_ANTICOLL_OR_SELECT_3));
+}
+
+// protocols whose annotation state starts over with each card session
+static bool trace_list_parallel_ok(uint8_t protocol) {
+    switch (protocol) {
+        case ISO_14443A:
+        case PROTO_MIFARE:
+        case PROTO_MFPLUS:
+        case MFDES:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The annotation starts over at each SELECT, in the single pass and in the parallel jobs
+// alike, so where the trace is cut in jobs doesn't show in the output
+static void trace_list_session_start(const uint8_t *trace, uint32_t traceLen, uint32_t tracepos, uint8_t protocol) {
+    if (trace_list_parallel_ok(protocol) == false || traceLen - tracepos < TRACELOG_HDR_LEN + 9) {
+        return;
+    }
+    if (trace_rec_is_select((const tracelog_hdr_t *)(trace + tracepos))) {
+        ResetTraceAnnotation();
+    }
+}
+
+typedef struct {
+    trace_rec_t *recs;
+    size_t count;
+    uint64_t end;               // end of the last record
+} trace_index_t;
+
+static void trace_index_free(trace_index_t *idx) {
+    free(idx->recs);
+    memset(idx, 0, sizeof(trace_index_t));
+}
+
+static int trace_index_build(trace_index_t *idx) {
+    memset(idx, 0, sizeof(trace_index_t));
+
+    trace_cursor_t tc;
+    int res = trace_cursor_open(&tc);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    size_t size = 0;
+    size_t wakeup = SIZE_MAX;
+    uint32_t tracepos = 0;
+    while (trace_cursor_fill(&tc, &tracepos)) {
+
+        uint64_t offset = tc.base + tracepos;
+        const tracelog_hdr_t *hdr = trace_next_record(&tc, &tracepos);
+        if (hdr == NULL) {
+            break;
+        }
+
+        if (idx->count == size) {
+            size = (size) ? size * 2 : 4096;
+            trace_rec_t *tmp = realloc(idx->recs, size * sizeof(trace_rec_t));
+            if (tmp == NULL) {
+                PrintAndLogEx(WARNING, "Failed to allocate memory");
+                trace_index_free(idx);
+                trace_cursor_close(&tc);
+                return PM3_EMALLOC;
+            }
+            idx->recs = tmp;
+        }
+
+        trace_rec_t *rec = &idx->recs[idx->count++];
+        rec->offset = offset;
+        rec->data_len = hdr->data_len;
+        rec->isResponse = hdr->isResponse;
+        rec->timestamp = hdr->timestamp;
+        rec->duration = hdr->duration;
+        rec->flags = 0;
+
+        // A session starts at a REQA / WUPA followed by the anticollision up to a SELECT.
+        // When the anticollision wasn't caught the annotation carries on from the session
+        // before, with its UID, so the trace isn't cut there
+        if (trace_rec_is_wakeup(hdr)) {
+            wakeup = idx->count - 1;
+        } else if (wakeup != SIZE_MAX && trace_rec_is_select(hdr)) {
+            idx->recs[wakeup].flags |= TRACE_REC_SESSION;
+            wakeup = SIZE_MAX;
+        } else if (trace_rec_is_anticoll(hdr) == false) {
+            wakeup = SIZE_MAX;
+        }
+    }
+
+    idx->end = tc.base + tracepos;
+    trace_cursor_close(&tc);
     return PM3_SUCCESS;
 }
 
+static uint64_t trace_index_rec_end(const trace_index_t *idx, size_t i) {
+    return (i + 1 < idx->count) ? idx->recs[i + 1].offset : idx->end;
+}
+
+// end of transmission of the record before record i, as printTraceLine() keeps it for relative times
+static uint32_t trace_index_prev_eot(const trace_index_t *idx, size_t i, uint8_t protocol) {
+    if (i == 0) {
+        return 0;
+    }
+    const trace_rec_t *rec = &idx->recs[i - 1];
+    uint32_t duration = rec->duration;
+    if (protocol == ICLASS || protocol == ISO_15693) {
+        duration *= 32;
+    }
+    return rec->timestamp + duration;
+}
+
+typedef struct {
+    uint8_t protocol;
+    bool show_wait_cycles;
+    bool mark_crc;
+    bool use_relative;
+    bool use_us;
+    uint32_t first_timestamp;
+    const uint64_t *dicKeys;
+    uint32_t dicKeysCount;
+} trace_list_opt_t;
+
+// Lists the trace from offset start up to offset end, reading it through the cursor.
+// prev_eot is the end of transmission of the record before start, 0 if none.
+// returns false when the user aborted
+static bool trace_list_span(trace_cursor_t *tc, uint64_t start, uint64_t end, const trace_list_opt_t *opt, uint32_t prev_eot) {
+
+    uint32_t previous_EOT = prev_eot;
+    uint32_t *prev_EOT = NULL;
+    if (opt->use_relative) {
+        prev_EOT = &previous_EOT;
+    }
+
+    uint32_t tracepos = 0;
+    if (trace_cursor_seek(tc, start, &tracepos) != PM3_SUCCESS) {
+        return true;
+    }
+
+    while (trace_cursor_fill(tc, &tracepos) && tc->base + tracepos < end) {
+        trace_list_session_start(tc->buf, tc->len, tracepos, opt->protocol);
+        tracepos = printTraceLine(tracepos, tc->len, tc->buf, opt->first_timestamp, opt->protocol, opt->show_wait_cycles, opt->mark_crc,
+                                  prev_EOT, opt->use_us, opt->dicKeys, opt->dicKeysCount);
+
+        if (kbd_enter_pressed()) {
+            PrintAndLogEx(INFO, "User interrupted detected. Aborting");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Parallel listing. Records are cut in jobs at card sessions, each job is annotated
+// from a fresh annotation state on a worker thread with its output held back, then
+// the output is printed in trace order. Jobs go in batches so the held back output
+// and, for streamed traces, the trace bytes in memory stay bounded.
+
+// card sessions are grouped into jobs of at least this many records
+#define TRACE_JOB_MIN_RECORDS   64
+// jobs per worker thread in one batch
+#define TRACE_JOBS_PER_THREAD   4
+// most bytes of a streamed trace read in for one batch
+#define TRACE_BATCH_BYTES       (16 * 1024 * 1024)
+
+typedef struct {
+    size_t first;               // records [first, last) of the index
+    size_t last;
+    bool ran;
+    log_capture_t log;
+} trace_list_job_t;
+
+typedef struct {
+    trace_list_job_t *jobs;
+    size_t count;
+    size_t next;                // next job to run
+    const trace_index_t *idx;
+    uint8_t *buf;               // trace bytes of the batch
+    uint64_t buf_base;          // trace offset of buf[0]
+    uint32_t buf_len;
+    const trace_list_opt_t *opt;
+} trace_list_queue_t;
+
+static void trace_list_job(const trace_list_queue_t *q, const trace_list_job_t *job) {
+    const trace_index_t *idx = q->idx;
+    const trace_list_opt_t *opt = q->opt;
+
+    ResetTraceAnnotation();
+
+    uint32_t previous_EOT = trace_index_prev_eot(idx, job->first, opt->protocol);
+    uint32_t *prev_EOT = NULL;
+    if (opt->use_relative) {
+        prev_EOT = &previous_EOT;
+    }
+
+    uint32_t tracepos = idx->recs[job->first].offset - q->buf_base;
+    uint32_t end = trace_index_rec_end(idx, job->last - 1) - q->buf_base;
+
+    while (tracepos < end) {
+        trace_list_session_start(q->buf, q->buf_len, tracepos, opt->protocol);
+        tracepos = printTraceLine(tracepos, q->buf_len, q->buf, opt->first_timestamp, opt->protocol, opt->show_wait_cycles, opt->mark_crc,
+                                  prev_EOT, opt->use_us, opt->dicKeys, opt->dicKeysCount);
+    }
+}
+
+static void *trace_list_worker(void *arg) {
+    trace_list_queue_t *q = (trace_list_queue_t *)arg;
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&q->next, 1, __ATOMIC_SEQ_CST);
+        if (i >= q->count) {
+            break;
+        }
+
+        trace_list_job_t *job = &q->jobs[i];
+        PrintAndLogCaptureStart(&job->log);
+        trace_list_job(q, job);
+        PrintAndLogCaptureStop();
+        job->ran = true;
+    }
+
+    // drop what this thread holds on to
+    ResetTraceAnnotation();
+    return NULL;
+}
+
+// Lists records [from, to) of the index with thread_count workers.
+// returns false when the user aborted
+static bool trace_list_parallel(trace_cursor_t *tc, const trace_index_t *idx, size_t from, size_t to, const trace_list_opt_t *opt, int thread_count) {
+
+    // cut in jobs at card sessions
+    size_t njobs = 0;
+    trace_list_job_t *jobs = calloc((to - from) / TRACE_JOB_MIN_RECORDS + 1, sizeof(trace_list_job_t));
+    if (jobs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return trace_list_span(tc, idx->recs[from].offset, trace_index_rec_end(idx, to - 1), opt, trace_index_prev_eot(idx, from, opt->protocol));
+    }
+
+    size_t first = from;
+    for (size_t i = from + 1; i < to; i++) {
+        if ((idx->recs[i].flags & TRACE_REC_SESSION) && i - first >= TRACE_JOB_MIN_RECORDS) {
+            jobs[njobs].first = first;
+            jobs[njobs].last = i;
+            njobs++;
+            first = i;
+        }
+    }
+    jobs[njobs].first = first;
+    jobs[njobs].last = to;
+    njobs++;
+
+    uint8_t *batchbuf = NULL;
+    bool ok = true;
+
+    for (size_t j = 0; j < njobs && ok;) {
+
+        trace_list_queue_t q = {
+            .jobs = &jobs[j],
+            .count = 1,
+            .next = 0,
+            .idx = idx,
+            .buf = tc->buf,
+            .buf_base = tc->base,
+            .buf_len = tc->len,
+            .opt = opt,
+        };
+
+        uint64_t start = idx->recs[jobs[j].first].offset;
+        size_t max_jobs = (size_t)thread_count * TRACE_JOBS_PER_THREAD;
+
+        if (tc->f == NULL) {
+            // whole trace is in memory
+            while (j + q.count < njobs && q.count < max_jobs) {
+                q.count++;
+            }
+        } else {
+            while (j + q.count < njobs && q.count < max_jobs &&
+                    trace_index_rec_end(idx, jobs[j + q.count].last - 1) - start <= TRACE_BATCH_BYTES) {
+                q.count++;
+            }
+
+            uint64_t end = trace_index_rec_end(idx, jobs[j + q.count - 1].last - 1);
+            if (end - start > TRACE_BATCH_BYTES) {
+                // one card session too long to hold, stream it on this thread
+                ResetTraceAnnotation();
+                ok = trace_list_span(tc, start, end, opt, trace_index_prev_eot(idx, jobs[j].first, opt->protocol));
+                j++;
+                continue;
+            }
+
+            // the records after the batch are read too, annotators look a few records ahead
+            uint64_t stop = MIN(end + TRACE_LOOKAHEAD, idx->end);
+            if (batchbuf == NULL) {
+                batchbuf = calloc(TRACE_BATCH_BYTES + TRACE_LOOKAHEAD, sizeof(uint8_t));
+                if (batchbuf == NULL) {
+                    PrintAndLogEx(WARNING, "Failed to allocate memory");
+                    break;
+                }
+            }
+
+            if (fseeko(tc->f, start, SEEK_SET) != 0 || fread(batchbuf, 1, stop - start, tc->f) != stop - start) {
+                PrintAndLogEx(FAILED, "error, reading trace file");
+                break;
+            }
+            // file position moved, the cursor window starts over from there
+            tc->base = stop;
+            tc->len = 0;
+
+            q.buf = batchbuf;
+            q.buf_base = start;
+            q.buf_len = stop - start;
+        }
+
+        int nthreads = MIN(thread_count, (int)q.count);
+        pthread_t threads[nthreads];
+        int started = 0;
+        for (int i = 0; i < nthreads; i++) {
+            if (pthread_create(&threads[started], NULL, trace_list_worker, &q) == 0) {
+                started++;
+            }
+        }
+
+        for (int i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+
+        // print in trace order, jobs no worker ran are done here
+        for (size_t i = 0; i < q.count; i++) {
+            trace_list_job_t *job = &q.jobs[i];
+            if (job->ran) {
+                PrintAndLogCaptureReplay(&job->log);
+                PrintAndLogCaptureFree(&job->log);
+            } else {
+                trace_list_job(&q, job);
+            }
+        }
+        j += q.count;
+
+        if (kbd_enter_pressed()) {
+            PrintAndLogEx(INFO, "User interrupted detected. Aborting");
+            ok = false;
+        }
+    }
+
+    free(batchbuf);
+    free(jobs);
+    return ok;
+}
+
 int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol) {
     CLIParserContext *ctx;
     char desc[500] = {0};
@@ -1293,8 +2130,11 @@ int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol)
         arg_lit0("r", NULL, "show relative times (gap and duration)"),
         arg_lit0("u", NULL, "display times in microseconds instead of clock cycles"),
         arg_lit0("x", NULL, "show hexdump to convert to pcap(ng)\n"
-                 "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
+                 "                                   or to import into Wireshark using encapsulation type \"ISO 14443\"\n"
+                 "                                   (`trace save --pcapng` writes the pcapng directly)"),
         arg_str0("f", "file", "<fn>", "filename of dictionary"),
+        arg_u64_0(NULL, "from", "<dec>", "first record to list, counting from 0"),
+        arg_u64_0(NULL, "to", "<dec>", "last record to list"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
@@ -1336,7 +2176,8 @@ int CmdTraceList(const char *Cmd) {
                   "\n"
                   "trace list -t mf -f mfc_default_keys.dic     -> use default dictionary file\n"
                   "trace list -t 14a --frame                    -> show frame delay times\n"
-                  "trace list -t 14a -1                         -> use trace buffer "
+                  "trace list -t 14a -1                         -> use trace buffer\n"
+                  "trace list -t mf -1 --from 1000 --to 1999    -> list records 1000 to 1999 "
                  );
 
     void *argtable[] = {
@@ -1350,6 +2191,8 @@ int CmdTraceList(const char *Cmd) {
                  "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
         arg_str0("t", "type", "<str>", "protocol to annotate the trace"),
         arg_str0("f", "file", "<fn>", "filename of dictionary"),
+        arg_u64_0(NULL, "from", "<dec>", "first record to list, counting from 0"),
+        arg_u64_0(NULL, "to", "<dec>", "last record to list"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
@@ -1373,6 +2216,10 @@ int CmdTraceList(const char *Cmd) {
         diclen = 0;
     }
 
+    bool use_range = (arg_get_u64_count(ctx, 9) || arg_get_u64_count(ctx, 10));
+    uint64_t from = arg_get_u64_def(ctx, 9, 0);
+    uint64_t to = arg_get_u64_def(ctx, 10, UINT64_MAX);
+
     CLIParserFree(ctx);
 
     clearCommandBuffer();
@@ -1381,36 +2228,13 @@ int CmdTraceList(const char *Cmd) {
     uint8_t protocol = -1;
 
     // validate type of output
-    if (strcmp(type, "14a") == 0)      protocol = ISO_14443A;
-    else if (strcmp(type, "14b") == 0)      protocol = ISO_14443B;
-    else if (strcmp(type, "15") == 0)       protocol = ISO_15693;
-    else if (strcmp(type, "7816") == 0)     protocol = ISO_7816_4;
-    else if (strcmp(type, "cryptorf") == 0) protocol = PROTO_CRYPTORF;
-    else if (strcmp(type, "des") == 0)      protocol = MFDES;
-    else if (strcmp(type, "felica") == 0)   protocol = FELICA;
-    else if (strcmp(type, "ht1") == 0)   protocol = PROTO_HITAG1;
-    else if (strcmp(type, "ht2") == 0)   protocol = PROTO_HITAG2;
-    else if (strcmp(type, "hts") == 0)   protocol = PROTO_HITAGS;
-    else if (strcmp(type, "htu") == 0)   protocol = PROTO_HITAGU;
-    else if (strcmp(type, "iclass") == 0)   protocol = ICLASS;
-    else if (strcmp(type, "legic") == 0)    protocol = LEGIC;
-    else if (strcmp(type, "lto") == 0)      protocol = LTO;
-    else if (strcmp(type, "mf") == 0)       protocol = PROTO_MIFARE;
-    else if (strcmp(type, "raw") == 0)      protocol = -1;
-    else if (strcmp(type, "seos") == 0)     protocol = SEOS;
-    else if (strcmp(type, "thinfilm") == 0) protocol = THINFILM;
-    else if (strcmp(type, "topaz") == 0)    protocol = TOPAZ;
-    else if (strcmp(type, "mfp") == 0)      protocol = PROTO_MFPLUS;
-    else if (strcmp(type, "fmcos20") == 0)  protocol = PROTO_FMCOS20;
-    else if (strcmp(type, "") == 0)         protocol = -1;
-    else {
-        PrintAndLogEx(FAILED, "Unknown protocol \"%s\"", type);
+    if (trace_protocol_from_str(type, &protocol) != PM3_SUCCESS) {
         return PM3_EINVARG;
     }
 
     if (use_buffer == false) {
         download_trace();
-    } else if (gs_traceLen == 0 || gs_trace == NULL) {
+    } else if (gs_traceLen == 0 || (gs_trace == NULL && gs_trace_path == NULL)) {
 
         if (IfPm3Present() == false) {
             PrintAndLogEx(FAILED, "You requested a trace list in offline mode but there is no trace.");
@@ -1422,12 +2246,53 @@ int CmdTraceList(const char *Cmd) {
         return PM3_EINVARG;
     }
 
-    PrintAndLogEx(SUCCESS,  "Recorded activity ( " _YELLOW_("%u") " bytes )", gs_traceLen);
+    PrintAndLogEx(SUCCESS,  "Recorded activity ( " _YELLOW_("%" PRIu64) " bytes )", gs_traceLen);
     if (gs_traceLen == 0) {
         return PM3_SUCCESS;
     }
 
-    uint16_t tracepos = 0;
+    trace_cursor_t tc;
+    if (trace_cursor_open(&tc) != PM3_SUCCESS) {
+        return PM3_EFILE;
+    }
+
+    // the record index is needed to start part way and to list in parallel
+    int thread_count = num_CPUs();
+    bool parallel = (show_hex == false && thread_count > 1 && trace_list_parallel_ok(protocol));
+
+    trace_index_t idx = {0};
+    size_t rec_from = 0, rec_to = 0;
+    uint64_t start = 0, end = gs_traceLen;
+
+    if (use_range || parallel) {
+        if (trace_index_build(&idx) != PM3_SUCCESS) {
+            trace_cursor_close(&tc);
+            return PM3_EMALLOC;
+        }
+
+        rec_from = MIN(from, idx.count);
+        rec_to = (to < idx.count) ? to + 1 : idx.count;
+        if (rec_from >= rec_to) {
+            PrintAndLogEx(FAILED, "No records in range, trace has " _YELLOW_("%zu") " records", idx.count);
+            trace_index_free(&idx);
+            trace_cursor_close(&tc);
+            return PM3_EINVARG;
+        }
+
+        start = idx.recs[rec_from].offset;
+        end = trace_index_rec_end(&idx, rec_to - 1);
+
+        if (use_range) {
+            PrintAndLogEx(INFO, "Records " _YELLOW_("%zu") " to " _YELLOW_("%zu") " of " _YELLOW_("%zu"), rec_from, rec_to - 1, idx.count);
+        }
+
+        // not worth the threads
+        if (rec_to - rec_from < 2 * TRACE_JOB_MIN_RECORDS) {
+            parallel = false;
+        }
+    }
+
+    uint32_t tracepos = 0;
 
     /*
     if (protocol == FELICA) {
@@ -1435,8 +2300,9 @@ int CmdTraceList(const char *Cmd) {
     } */
 
     if (show_hex) {
-        while (tracepos < gs_traceLen) {
-            tracepos = printHexLine(tracepos, gs_traceLen, gs_trace, protocol);
+        trace_cursor_seek(&tc, start, &tracepos);
+        while (trace_cursor_fill(&tc, &tracepos) && tc.base + tracepos < end) {
+            tracepos = printHexLine(tracepos, tc.len, tc.buf, protocol);
         }
     } else {
 
@@ -1559,7 +2425,7 @@ int CmdTraceList(const char *Cmd) {
 
         // clean authentication data used with the mifare classic decrypt fct
         if (protocol == ISO_14443A || protocol == PROTO_MIFARE || protocol == PROTO_MFPLUS) {
-            ClearAuthData();
+            ResetTraceAnnotation();
         }
 
         // reset hitag state  machine
@@ -1567,19 +2433,21 @@ int CmdTraceList(const char *Cmd) {
             annotateHitag2_init();
         }
 
-        uint32_t previous_EOT = 0;
-        uint32_t *prev_EOT = NULL;
-        if (use_relative) {
-            prev_EOT = &previous_EOT;
-        }
-
-        while (tracepos < gs_traceLen) {
-            tracepos = printTraceLine(tracepos, gs_traceLen, gs_trace, protocol, show_wait_cycles, mark_crc, prev_EOT, use_us, dicKeys, dicKeysCount);
-
-            if (kbd_enter_pressed()) {
-                PrintAndLogEx(INFO, "User interrupted detected. Aborting");
-                break;
-            }
+        trace_list_opt_t opt = {
+            .protocol = protocol,
+            .show_wait_cycles = show_wait_cycles,
+            .mark_crc = mark_crc,
+            .use_relative = use_relative,
+            .use_us = use_us,
+            .first_timestamp = tc.first_timestamp,
+            .dicKeys = dicKeys,
+            .dicKeysCount = dicKeysCount,
+        };
+
+        if (parallel) {
+            trace_list_parallel(&tc, &idx, rec_from, rec_to, &opt, thread_count);
+        } else {
+            trace_list_span(&tc, start, end, &opt, (idx.recs) ? trace_index_prev_eot(&idx, rec_from, protocol) : 0);
         }
 
         if (dictionaryLoad)  {
@@ -1587,8 +2455,12 @@ int CmdTraceList(const char *Cmd) {
         }
     }
 
+    trace_index_free(&idx);
+    trace_cursor_close(&tc);
+
     if (show_hex) {
         PrintAndLogEx(HINT, "Hint: Syntax to use: `" _YELLOW_("text2pcap -t \"%%S.\" -l 264 -n <input-text-file> <output-pcapng-file>") "`");
+        PrintAndLogEx(HINT, "Hint: or save it directly with `" _YELLOW_("trace save -f <fn> --pcapng -t ...") "`");
     }
 
     return PM3_SUCCESS;
@@ -20,6 +20,8 @@
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
 #include "cmdparser.h"          // command_t
 #include "cliparser.h"
 #include "comms.h"
@@ -30,6 +32,9 @@
 #include "wiegand_formats.h"
 #include "wiegand_formatutils.h"
 #include "util.h"
+#include "fileutils.h"
+#include "util_posix.h"     // msclock
+#include "commonutil.h"     // ARRAYLEN
 
 static int CmdHelp(const char *Cmd);
 
@@ -73,6 +78,391 @@ static int wiegand_new_pacs(uint8_t *padded_pacs, uint8_t plen) {
     free(binstr);
     return PM3_SUCCESS;
 }
+// Bulk decoding of a file with one credential per line.  The lines are split
+// between threads,  each decodes and formats its share into its own buffer and
+// the buffers are written out in input order.
+#define WIEGAND_BULK_MIN_PER_THREAD     4096
+
+typedef struct {
+    const char *s;
+    uint32_t line;
+} wiegand_bulk_rec_t;
+
+typedef struct {
+    const wiegand_bulk_rec_t *recs;
+    size_t start;
+    size_t end;
+    bool json;
+    char *out;
+    size_t out_len;
+    size_t out_size;
+    size_t matched;
+    size_t invalid;
+    uint32_t first_invalid;
+    int res;
+    bool threaded;
+} wiegand_bulk_ctx_t;
+
+static void bulk_printf(wiegand_bulk_ctx_t *ctx, const char *fmt, ...) {
+    if (ctx->res != PM3_SUCCESS) {
+        return;
+    }
+
+    for (;;) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(ctx->out + ctx->out_len, ctx->out_size - ctx->out_len, fmt, args);
+        va_end(args);
+
+        if (n < 0) {
+            ctx->res = PM3_ESOFT;
+            return;
+        }
+
+        if (ctx->out_len + n < ctx->out_size) {
+            ctx->out_len += n;
+            return;
+        }
+
+        size_t size = MAX(ctx->out_size * 2, ctx->out_len + n + 1);
+        char *tmp = realloc(ctx->out, size);
+        if (tmp == NULL) {
+            ctx->res = PM3_EMALLOC;
+            return;
+        }
+        ctx->out = tmp;
+        ctx->out_size = size;
+    }
+}
+
+// one credential,  hex (optional 0x) or binary with a 0b prefix.
+// Hex gets its length from the leading one bit like `wiegand decode --raw`
+static bool bulk_parse(const char *s, wiegand_message_t *packed, bool *fixed_len) {
+    uint32_t top = 0, mid = 0, bot = 0;
+    int n = 0;
+
+    if (s[0] == '0' && (s[1] == 'b' || s[1] == 'B')) {
+        for (s += 2; *s == '0' || *s == '1'; s++, n++) {
+            top = (top << 1) | (mid >> 31);
+            mid = (mid << 1) | (bot >> 31);
+            bot = (bot << 1) | (*s - '0');
+        }
+        if (n == 0 || n > WIEGAND_MAX_BITS) {
+            return false;
+        }
+        *fixed_len = true;
+    } else {
+        if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+            s += 2;
+        }
+        for (; isxdigit((unsigned char)*s); s++, n++) {
+            top = (top << 4) | (mid >> 28);
+            mid = (mid << 4) | (bot >> 28);
+            bot = (bot << 4) | ((isdigit((unsigned char)*s)) ? *s - '0' : (tolower((unsigned char)*s) - 'a' + 10));
+        }
+        if (n == 0 || n > (WIEGAND_MAX_BITS / 4)) {
+            return false;
+        }
+        *fixed_len = false;
+    }
+
+    // trailing junk
+    if (*s != '\0' && *s != ',' && *s != ';' && isspace((unsigned char)*s) == 0) {
+        return false;
+    }
+
+    *packed = initialize_message_object(top, mid, bot, (*fixed_len) ? n : 0);
+    return true;
+}
+
+static void bulk_print_match(wiegand_bulk_ctx_t *ctx, const wiegand_match_t *m, uint8_t bits, bool first) {
+    cardformat_t fmt = HIDGetCardFormat(m->format_idx);
+
+    if (ctx->json) {
+        bulk_printf(ctx, "%s{\"format\": \"%s\", \"bits\": %u", (first) ? "" : ", ", fmt.Name, bits);
+        if (fmt.Fields.hasFacilityCode)
+            bulk_printf(ctx, ", \"fc\": %u", m->card.FacilityCode);
+        if (fmt.Fields.hasCardNumber)
+            bulk_printf(ctx, ", \"cn\": %" PRIu64, m->card.CardNumber);
+        if (fmt.Fields.hasIssueLevel)
+            bulk_printf(ctx, ", \"issue\": %u", m->card.IssueLevel);
+        if (fmt.Fields.hasOEMCode)
+            bulk_printf(ctx, ", \"oem\": %u", m->card.OEM);
+        if (fmt.Fields.hasParity)
+            bulk_printf(ctx, ", \"parity\": %s", m->card.ParityValid ? "true" : "false");
+        bulk_printf(ctx, "}");
+        return;
+    }
+
+    bulk_printf(ctx, "%u,%s,", bits, fmt.Name);
+    if (fmt.Fields.hasFacilityCode)
+        bulk_printf(ctx, "%u", m->card.FacilityCode);
+    bulk_printf(ctx, ",");
+    if (fmt.Fields.hasCardNumber)
+        bulk_printf(ctx, "%" PRIu64, m->card.CardNumber);
+    bulk_printf(ctx, ",");
+    if (fmt.Fields.hasIssueLevel)
+        bulk_printf(ctx, "%u", m->card.IssueLevel);
+    bulk_printf(ctx, ",");
+    if (fmt.Fields.hasOEMCode)
+        bulk_printf(ctx, "%u", m->card.OEM);
+    bulk_printf(ctx, ",%s\n", (fmt.Fields.hasParity) ? (m->card.ParityValid ? "ok" : "fail") : "");
+}
+
+static void *bulk_thread(void *arg) {
+    wiegand_bulk_ctx_t *ctx = (wiegand_bulk_ctx_t *)arg;
+
+    for (size_t r = ctx->start; r < ctx->end && ctx->res == PM3_SUCCESS; r++) {
+        const wiegand_bulk_rec_t *rec = &ctx->recs[r];
+
+        wiegand_message_t packed;
+        bool fixed_len;
+        if (bulk_parse(rec->s, &packed, &fixed_len) == false) {
+            if (ctx->invalid++ == 0) {
+                ctx->first_invalid = rec->line;
+            }
+            continue;
+        }
+
+        // same as decode_wiegand,  unknown length tries with a preamble bit too
+        wiegand_match_t m[WIEGAND_MAX_MATCHES * 2];
+        uint8_t bits[ARRAYLEN(m)];
+        int n = 0;
+        if (packed.Top || packed.Mid || packed.Bot) {
+            n = HIDUnpackMatches(&packed, m, WIEGAND_MAX_MATCHES);
+            memset(bits, packed.Length, n);
+            if (fixed_len == false) {
+                packed.Length++;
+                int k = HIDUnpackMatches(&packed, m + n, WIEGAND_MAX_MATCHES);
+                memset(bits + n, packed.Length, k);
+                packed.Length--;
+                n += k;
+            }
+        }
+
+        if (n) {
+            ctx->matched++;
+        }
+
+        char raw[32];
+        if (packed.Top) {
+            snprintf(raw, sizeof(raw), "%X%08X%08X", packed.Top, packed.Mid, packed.Bot);
+        } else {
+            snprintf(raw, sizeof(raw), "%X%08X", packed.Mid, packed.Bot);
+        }
+
+        if (ctx->json) {
+            bulk_printf(ctx, "%s  {\"line\": %u, \"raw\": \"%s\", \"bits\": %u, \"matches\": ["
+                        , (ctx->out_len) ? ",\n" : ""
+                        , rec->line
+                        , raw
+                        , packed.Length
+                       );
+            for (int i = 0; i < n; i++) {
+                bulk_print_match(ctx, &m[i], bits[i], (i == 0));
+            }
+            bulk_printf(ctx, "]}");
+            continue;
+        }
+
+        // csv,  one row per matching format
+        if (n == 0) {
+            bulk_printf(ctx, "%u,%s,%u,,,,,,\n", rec->line, raw, packed.Length);
+        }
+        for (int i = 0; i < n; i++) {
+            bulk_printf(ctx, "%u,%s,", rec->line, raw);
+            bulk_print_match(ctx, &m[i], bits[i], (i == 0));
+        }
+    }
+    return NULL;
+}
+
+static int wiegand_decode_file(const char *infile, const char *outfile, bool json) {
+
+    char *data = NULL;
+    size_t datalen = 0;
+    int res = loadFile_safe(infile, "", (void **)&data, &datalen);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    char *tmp = realloc(data, datalen + 1);
+    if (tmp == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(data);
+        return PM3_EMALLOC;
+    }
+    data = tmp;
+    data[datalen] = '\0';
+
+    // split into lines,  skipping empty ones and # comments
+    size_t cnt = 0;
+    for (size_t i = 0; i < datalen; i++) {
+        cnt += (data[i] == '\n');
+    }
+    cnt++;
+
+    wiegand_bulk_rec_t *recs = calloc(cnt, sizeof(wiegand_bulk_rec_t));
+    if (recs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(data);
+        return PM3_EMALLOC;
+    }
+
+    size_t nrecs = 0;
+    uint32_t line = 0;
+    for (char *p = data; p != NULL;) {
+        char *nl = strchr(p, '\n');
+        if (nl) {
+            *nl = '\0';
+        }
+        line++;
+
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p != '\0' && *p != '#') {
+            recs[nrecs].s = p;
+            recs[nrecs].line = line;
+            nrecs++;
+        }
+        p = (nl) ? nl + 1 : NULL;
+    }
+
+    int threads = num_CPUs();
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (nrecs / WIEGAND_BULK_MIN_PER_THREAD < (size_t)threads) {
+        threads = MAX(1, nrecs / WIEGAND_BULK_MIN_PER_THREAD);
+    }
+
+    wiegand_bulk_ctx_t *ctx = calloc(threads, sizeof(wiegand_bulk_ctx_t));
+    pthread_t *tids = calloc(threads, sizeof(pthread_t));
+    if (ctx == NULL || tids == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(ctx);
+        free(tids);
+        free(recs);
+        free(data);
+        return PM3_EMALLOC;
+    }
+
+    PrintAndLogEx(INFO, "Decoding " _YELLOW_("%zu") " credentials using " _YELLOW_("%d") " thread%s", nrecs, threads, (threads > 1) ? "s" : "");
+
+    uint64_t t1 = msclock();
+
+    size_t per_thread = (nrecs + threads - 1) / threads;
+    for (int i = 0; i < threads; i++) {
+        ctx[i].recs = recs;
+        ctx[i].start = MIN(nrecs, i * per_thread);
+        ctx[i].end = MIN(nrecs, (i + 1) * per_thread);
+        ctx[i].json = json;
+        ctx[i].res = PM3_SUCCESS;
+        ctx[i].threaded = (pthread_create(&tids[i], NULL, bulk_thread, &ctx[i]) == 0);
+    }
+
+    // whatever slice did not get a thread is decoded here
+    for (int i = 0; i < threads; i++) {
+        if (ctx[i].threaded == false) {
+            bulk_thread(&ctx[i]);
+        }
+    }
+
+    size_t matched = 0, invalid = 0;
+    uint32_t first_invalid = 0;
+    res = PM3_SUCCESS;
+    for (int i = 0; i < threads; i++) {
+        if (ctx[i].threaded) {
+            pthread_join(tids[i], NULL);
+        }
+        matched += ctx[i].matched;
+        if (ctx[i].invalid && invalid == 0) {
+            first_invalid = ctx[i].first_invalid;
+        }
+        invalid += ctx[i].invalid;
+        if (ctx[i].res != PM3_SUCCESS) {
+            res = ctx[i].res;
+        }
+    }
+
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        goto out;
+    }
+
+    FILE *f = NULL;
+    if (outfile) {
+        f = fopen(outfile, "wb");
+        if (f == NULL) {
+            PrintAndLogEx(WARNING, "Failed to open file " _YELLOW_("%s"), outfile);
+            res = PM3_EFILE;
+            goto out;
+        }
+    }
+
+    const char *header = (json) ? "[" : "line,raw,bits,format,fc,cn,issue,oem,parity";
+    if (f) {
+        fprintf(f, "%s\n", header);
+    } else {
+        PrintAndLogEx(NORMAL, "%s", header);
+    }
+
+    bool first = true;
+    for (int i = 0; i < threads; i++) {
+        if (ctx[i].out_len == 0) {
+            continue;
+        }
+
+        // json chunks don't end in a separator
+        if (json && first == false) {
+            if (f) {
+                fputs(",\n", f);
+            } else {
+                PrintAndLogEx(NORMAL, ",");
+            }
+        }
+        first = false;
+
+        if (f) {
+            fwrite(ctx[i].out, 1, ctx[i].out_len, f);
+            continue;
+        }
+
+        for (char *p = strtok(ctx[i].out, "\n"); p != NULL; p = strtok(NULL, "\n")) {
+            PrintAndLogEx(NORMAL, "%s", p);
+        }
+    }
+
+    if (json) {
+        if (f) {
+            fprintf(f, "%s]\n", (first) ? "" : "\n");
+        } else {
+            PrintAndLogEx(NORMAL, "]");
+        }
+    }
+
+    if (f) {
+        fclose(f);
+        PrintAndLogEx(SUCCESS, "Saved to " _YELLOW_("%s"), outfile);
+    }
+
+    PrintAndLogEx(SUCCESS, "Decoded " _YELLOW_("%zu") " of " _YELLOW_("%zu") " credentials in " _YELLOW_("%" PRIu64) " ms", matched, nrecs, msclock() - t1);
+    if (invalid) {
+        PrintAndLogEx(WARNING, "Skipped " _YELLOW_("%zu") " invalid lines,  first at line " _YELLOW_("%u"), invalid, first_invalid);
+    }
+
+out:
+    for (int i = 0; i < threads; i++) {
+        free(ctx[i].out);
+    }
+    free(ctx);
+    free(tids);
+    free(recs);
+    free(data);
+    return res;
+}
+
 int CmdWiegandList(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -157,7 +547,9 @@ int CmdWiegandDecode(const char *Cmd) {
     CLIParserInit(&ctx, "wiegand decode",
                   "Decode raw hex or binary to wiegand format",
                   "wiegand decode --raw 2006F623AE\n"
-                  "wiegand decode --new 06BD88EB80   -> 4..8 bytes, new padded format "
+                  "wiegand decode --new 06BD88EB80   -> 4..8 bytes, new padded format\n"
+                  "wiegand decode -f creds.txt --out creds.csv   -> bulk decode, one hex (or 0b binary) credential per line\n"
+                  "wiegand decode -f creds.txt --out creds.json --json"
                  );
 
     void *argtable[] = {
@@ -165,6 +557,9 @@ int CmdWiegandDecode(const char *Cmd) {
         arg_str0("r", "raw", "<hex>", "raw hex to be decoded"),
         arg_str0("b", "bin", "<bin>", "binary string to be decoded"),
         arg_str0("n", "new", "<hex>", "new padded pacs as raw hex to be decoded"),
+        arg_str0("f", "file", "<fn>", "file with one credential per line to be decoded"),
+        arg_str0("o", "out", "<fn>", "bulk decode output file (def: print)"),
+        arg_lit0(NULL, "json", "bulk decode output as JSON instead of CSV"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -180,8 +575,21 @@ int CmdWiegandDecode(const char *Cmd) {
     uint8_t phex[8] = {0};
     res = CLIParamHexToBuf(arg_get_str(ctx, 3), phex, sizeof(phex), &plen);
 
+    int fnlen = 0;
+    char filename[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 4), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+
+    int outlen = 0;
+    char outfile[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 5), (uint8_t *)outfile, FILE_PATH_SIZE, &outlen);
+
+    bool json = arg_get_lit(ctx, 6);
     CLIParserFree(ctx);
 
+    if (fnlen) {
+        return wiegand_decode_file(filename, (outlen) ? outfile : NULL, json);
+    }
+
     if (res) {
         PrintAndLogEx(FAILED, "Error parsing binary string");
         return PM3_EINVARG;
@@ -22,10 +22,13 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "uart/uart.h"
 #include "ui.h"
 #include "crc16.h"
+#include "commstats.h"
+#include "lz4block.h"
 #include "util.h" // g_pendingPrompt
 #include "util_posix.h" // msclock
 #include "util_darwin.h" // en/dis-ableNapp();
@@ -50,6 +53,10 @@ static bool comm_raw_mode = false;
 static uint8_t *comm_raw_data = NULL;
 static size_t comm_raw_len = 0;
 static size_t comm_raw_pos = 0;
+// ring mode: comm_raw_data is reused circularly, comm_raw_pos counts all bytes ever
+// received and comm_raw_consumed how many of them the reader has processed
+static bool comm_raw_ring = false;
+static size_t comm_raw_consumed = 0;
 
 // Transmit buffer.
 static PacketCommandOLD txBuffer;
@@ -58,19 +65,49 @@ static size_t txBufferNGLen;
 static bool txBuffer_pending = false;
 static pthread_mutex_t txBufferMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t txBufferSig = PTHREAD_COND_INITIALIZER;
+// set by the communication thread when sending the queued command failed
+static bool tx_send_failed = false;
+
+static void wakeReplySpace(void);
+static void sendPendingCommand(void);
 
 // Used by PacketResponseReceived as a ring buffer for messages that are yet to be
-// processed by a command handler (WaitForResponse{,Timeout})
+// processed by a command handler (WaitForResponse{,Timeout}).
+// It is a single producer / single consumer ring without locks: only the communication
+// thread stores replies and moves rx_head, only the thread waiting for replies takes them
+// out and moves rx_tail. Both count all replies ever stored / taken, the slot in use is
+// the count modulo CMD_BUFFER_SIZE.
 static PacketResponseNG rxBuffer[CMD_BUFFER_SIZE];
+static size_t rx_head = 0;
+static size_t rx_tail = 0;
 
-// Points to the next empty position to write to
-static int cmd_head = 0;
-
-// Points to the position of the last unread command
-static int cmd_tail = 0;
+// set while the consumer sleeps in waitReply() or the producer in waitReplySpace(),
+// so the other side only has to take the mutex to wake it up
+static uint32_t rx_consumer_waiting = 0;
+static uint32_t rx_producer_waiting = 0;
 
-// to lock rxBuffer operations from different threads
+// only used to sleep and wake up, not to guard the ring
 static pthread_mutex_t rxBufferMutex = PTHREAD_MUTEX_INITIALIZER;
+// signaled when a reply got stored or the communication thread died
+static pthread_cond_t rxBufferSig = PTHREAD_COND_INITIALIZER;
+// signaled when slots got free
+static pthread_cond_t rxSpaceSig = PTHREAD_COND_INITIALIZER;
+// both get set up again for deadlines on the monotonic clock, before the first wait
+// and before the communication thread is started
+static pthread_once_t rxSigOnce = PTHREAD_ONCE_INIT;
+
+static reply_buffer_stats_t rx_stats;
+// producer only, set from the first dropped reply until one fits again.
+// Nobody seems to take replies then, so it doesn't wait for free slots anymore
+static bool rx_dropping = false;
+
+// longest single wait for a reply, so timeouts and warnings are still checked regularly
+#define REPLY_WAIT_MAX_MS  100
+// longest time the communication thread stops reading from the device when the ring is full
+#define REPLY_BACKPRESSURE_MS  1000
+// once held back, the communication thread goes on when this many slots are in use or less,
+// not for every single slot freed
+#define REPLY_RESUME_LEVEL  (CMD_BUFFER_SIZE / 2)
 
 // Global start time for WaitForResponseTimeout & dl_it, so we can reset timeout when we get packets
 // as sending lot of these packets can slow down things wuite a lot on slow links (e.g. hw status or lf read at 9600)
@@ -78,6 +115,9 @@ static uint64_t timeout_start_time;
 
 static uint64_t last_packet_time;
 
+// Tagged frames, see SendCommandPipelined()
+static uint16_t seq_tags_last = 0;
+
 static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, size_t ms_timeout, bool show_warning, uint32_t rec_cmd);
 
 // Simple alias to track usages linked to the Bootloader, these commands must not be migrated.
@@ -131,17 +171,23 @@ void SendCommandOLD(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, c
     }
 
     txBuffer = c;
-    txBuffer_pending = true;
+    // counted before the reply can come in
+    commstats_sent(cmd, sizeof(PacketCommandOLD));
+    __atomic_store_n(&txBuffer_pending, true, __ATOMIC_SEQ_CST);
 
     // tell communication thread that a new command can be send
     pthread_cond_signal(&txBufferSig);
 
     pthread_mutex_unlock(&txBufferMutex);
 
+    // and stop it waiting for data from the device or for reply space
+    uart_wake_receive();
+    wakeReplySpace();
+
 //__atomic_test_and_set(&txcmd_pending, __ATOMIC_SEQ_CST);
 }
 
-static void SendCommandNG_internal(uint16_t cmd, uint8_t *data, size_t len, bool ng) {
+static void SendCommandNG_internal(uint16_t cmd, const uint8_t *data, size_t len, bool ng, uint16_t seq) {
 #ifdef COMMS_DEBUG
     PrintAndLogEx(INFO, "Sending %s", ng ? "NG" : "MIX");
 #endif
@@ -155,7 +201,9 @@ static void SendCommandNG_internal(uint16_t cmd, uint8_t *data, size_t len, bool
         return;
     }
 
-    PacketCommandNGPostamble *tx_post = (PacketCommandNGPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketCommandNGPreamble) + len);
+    // tagged frames have the sequence number in front of the crc, and the crc covers it
+    size_t seqlen = (seq) ? sizeof(seq) : 0;
+    PacketCommandNGPostamble *tx_post = (PacketCommandNGPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketCommandNGPreamble) + len + seqlen);
 
     pthread_mutex_lock(&txBufferMutex);
     /**
@@ -167,23 +215,27 @@ static void SendCommandNG_internal(uint16_t cmd, uint8_t *data, size_t len, bool
         pthread_cond_wait(&txBufferSig, &txBufferMutex);
     }
 
-    txBufferNG.pre.magic = COMMANDNG_PREAMBLE_MAGIC;
+    txBufferNG.pre.magic = (seq) ? COMMANDNG_TAGGED_PREAMBLE_MAGIC : COMMANDNG_PREAMBLE_MAGIC;
     txBufferNG.pre.ng = ng;
     txBufferNG.pre.length = len;
     txBufferNG.pre.cmd = cmd;
     if (len > 0 && data) {
         memcpy(&txBufferNG.data, data, len);
     }
+    if (seq) {
+        PacketCommandNGTaggedPostamble *tx_tpost = (PacketCommandNGTaggedPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketCommandNGPreamble) + len);
+        tx_tpost->seq = seq;
+    }
 
     if ((g_conn.send_via_fpc_usart && g_conn.send_with_crc_on_fpc) || ((!g_conn.send_via_fpc_usart) && g_conn.send_with_crc_on_usb)) {
         uint8_t first = 0, second = 0;
-        compute_crc(CRC_14443_A, (uint8_t *)&txBufferNG, sizeof(PacketCommandNGPreamble) + len, &first, &second);
+        compute_crc(CRC_14443_A, (uint8_t *)&txBufferNG, sizeof(PacketCommandNGPreamble) + len + seqlen, &first, &second);
         tx_post->crc = (first << 8) + second;
     } else {
         tx_post->crc = COMMANDNG_POSTAMBLE_MAGIC;
     }
 
-    txBufferNGLen = sizeof(PacketCommandNGPreamble) + len + sizeof(PacketCommandNGPostamble);
+    txBufferNGLen = sizeof(PacketCommandNGPreamble) + len + seqlen + sizeof(PacketCommandNGPostamble);
 
 #ifdef COMMS_DEBUG_RAW
     print_hex_break((uint8_t *)&txBufferNG.pre, sizeof(PacketCommandNGPreamble), 32);
@@ -193,20 +245,26 @@ static void SendCommandNG_internal(uint16_t cmd, uint8_t *data, size_t len, bool
         print_hex_break((uint8_t *)&txBufferNG.data, 3 * sizeof(uint64_t), 32);
         print_hex_break((uint8_t *)&txBufferNG.data + 3 * sizeof(uint64_t), len - 3 * sizeof(uint64_t), 32);
     }
-    print_hex_break((uint8_t *)tx_post, sizeof(PacketCommandNGPostamble), 32);
+    print_hex_break((uint8_t *)tx_post - seqlen, seqlen + sizeof(PacketCommandNGPostamble), 32);
 #endif
-    txBuffer_pending = true;
+    // counted before the reply can come in
+    commstats_sent(cmd, txBufferNGLen);
+    __atomic_store_n(&txBuffer_pending, true, __ATOMIC_SEQ_CST);
 
     // tell communication thread that a new command can be send
     pthread_cond_signal(&txBufferSig);
 
     pthread_mutex_unlock(&txBufferMutex);
 
+    // and stop it waiting for data from the device or for reply space
+    uart_wake_receive();
+    wakeReplySpace();
+
 //__atomic_test_and_set(&txcmd_pending, __ATOMIC_SEQ_CST);
 }
 
 void SendCommandNG(uint16_t cmd, uint8_t *data, size_t len) {
-    SendCommandNG_internal(cmd, data, len, true);
+    SendCommandNG_internal(cmd, data, len, true, 0);
 }
 
 void SendCommandMIX(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const void *data, size_t len) {
@@ -219,7 +277,7 @@ void SendCommandMIX(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, c
     memcpy(cmddata, arg, sizeof(arg));
     if (len && data)
         memcpy(cmddata + sizeof(arg), data, len);
-    SendCommandNG_internal(cmd, cmddata, len + sizeof(arg), false);
+    SendCommandNG_internal(cmd, cmddata, len + sizeof(arg), false, 0);
 }
 
 
@@ -230,52 +288,199 @@ void SendCommandMIX(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, c
  *  operation. Right now we'll just have to live with this.
  */
 void clearCommandBuffer(void) {
-    //This is a very simple operation
+    // consumer side, everything stored so far counts as taken
+    __atomic_store_n(&rx_tail, __atomic_load_n(&rx_head, __ATOMIC_ACQUIRE), __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&rx_producer_waiting, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&rxBufferMutex);
+        pthread_cond_signal(&rxSpaceSig);
+        pthread_mutex_unlock(&rxBufferMutex);
+    }
+}
+
+static void initReplySigs(void) {
+    cond_init_monotonic(&rxBufferSig);
+    cond_init_monotonic(&rxSpaceSig);
+}
+
+static void deadlineIn(struct timespec *deadline, uint32_t ms) {
+    pthread_once(&rxSigOnce, initReplySigs);
+    cond_deadline(deadline, (uint64_t)ms * 1000000);
+}
+
+// copies the header and the used part of the payload only
+static void copyReply(PacketResponseNG *dst, const PacketResponseNG *src) {
+    memcpy(dst, src, offsetof(PacketResponseNG, data));
+    memcpy(dst->data.asBytes, src->data.asBytes, MIN(src->length, PM3_CMD_DATA_SIZE));
+    dst->ng = src->ng;
+}
+
+/**
+ * @brief Producer side. Blocks until the consumer freed slots down to REPLY_RESUME_LEVEL or REPLY_BACKPRESSURE_MS elapsed.
+ *  Meanwhile the communication thread doesn't read, so the device gets held back by the OS / USB buffers.
+ *  Commands queued in the meantime still go out right away, a CMD_BREAK_LOOP or the next command
+ *  of a sender that didn't clear the buffer doesn't wait for the ring.
+ * @return the consumer position
+ */
+static size_t waitReplySpace(size_t head) {
+    size_t tail;
+
+    __atomic_add_fetch(&rx_stats.stalls, 1, __ATOMIC_RELAXED);
+
+    struct timespec deadline;
+    deadlineIn(&deadline, REPLY_BACKPRESSURE_MS);
+
     pthread_mutex_lock(&rxBufferMutex);
-    cmd_tail = cmd_head;
+    __atomic_store_n(&rx_producer_waiting, 1, __ATOMIC_SEQ_CST);
+    while (true) {
+        tail = __atomic_load_n(&rx_tail, __ATOMIC_SEQ_CST);
+        if (head - tail <= REPLY_RESUME_LEVEL) {
+            break;
+        }
+
+        if (__atomic_load_n(&txBuffer_pending, __ATOMIC_SEQ_CST)) {
+            pthread_mutex_unlock(&rxBufferMutex);
+            pthread_mutex_lock(&txBufferMutex);
+            sendPendingCommand();
+            pthread_mutex_unlock(&txBufferMutex);
+            pthread_mutex_lock(&rxBufferMutex);
+            if (tx_send_failed) {
+                break;
+            }
+            continue;
+        }
+
+        if (pthread_cond_timedwait(&rxSpaceSig, &rxBufferMutex, &deadline) != 0) {
+            tail = __atomic_load_n(&rx_tail, __ATOMIC_SEQ_CST);
+            break;
+        }
+    }
+    __atomic_store_n(&rx_producer_waiting, 0, __ATOMIC_SEQ_CST);
     pthread_mutex_unlock(&rxBufferMutex);
+    return tail;
 }
+
+// wakes the communication thread up when it waits for reply space, so it sends
+static void wakeReplySpace(void) {
+    if (__atomic_load_n(&rx_producer_waiting, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&rxBufferMutex);
+        pthread_cond_signal(&rxSpaceSig);
+        pthread_mutex_unlock(&rxBufferMutex);
+    }
+}
+
 /**
- * @brief storeCommand stores a USB command in a circular buffer
- * @param UC
+ * @brief storeReply stores a reply in the ring buffer, called from the communication thread only.
+ *  When the ring is full, it waits for the consumer to catch up. If that doesn't happen in time,
+ *  new replies get dropped until there is space again, the ones already stored are never overwritten.
  */
 static void storeReply(const PacketResponseNG *packet) {
-    pthread_mutex_lock(&rxBufferMutex);
-    if ((cmd_head + 1) % CMD_BUFFER_SIZE == cmd_tail) {
-        //If these two are equal, we're about to overwrite in the
-        // circular buffer.
-        PrintAndLogEx(FAILED, "WARNING: Command buffer about to overwrite command! This needs to be fixed!");
-        fflush(stdout);
+    size_t head = rx_head;
+    size_t tail = __atomic_load_n(&rx_tail, __ATOMIC_SEQ_CST);
+
+    if (head - tail >= CMD_BUFFER_SIZE && rx_dropping == false) {
+        tail = waitReplySpace(head);
     }
-    //Store the command at the 'head' location
-    PacketResponseNG *destination = &rxBuffer[cmd_head];
-    memcpy(destination, packet, sizeof(PacketResponseNG));
 
-    //increment head and wrap
-    cmd_head = (cmd_head + 1) % CMD_BUFFER_SIZE;
-    pthread_mutex_unlock(&rxBufferMutex);
+    if (head - tail >= CMD_BUFFER_SIZE) {
+        __atomic_add_fetch(&rx_stats.dropped, 1, __ATOMIC_RELAXED);
+        // warn once per overflow, not for every lost reply
+        if (rx_dropping == false) {
+            PrintAndLogEx(WARNING, "Reply buffer full, dropping replies ( cmd " _YELLOW_("0x%04x") " )", packet->cmd);
+            rx_dropping = true;
+        }
+        return;
+    }
+    rx_dropping = false;
+
+    copyReply(&rxBuffer[head % CMD_BUFFER_SIZE], packet);
+    __atomic_store_n(&rx_head, head + 1, __ATOMIC_SEQ_CST);
+
+    __atomic_add_fetch(&rx_stats.stored, 1, __ATOMIC_RELAXED);
+    uint32_t used = head + 1 - tail;
+    if (used > __atomic_load_n(&rx_stats.high_water, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&rx_stats.high_water, used, __ATOMIC_RELAXED);
+    }
+
+    if (__atomic_load_n(&rx_consumer_waiting, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&rxBufferMutex);
+        pthread_cond_broadcast(&rxBufferSig);
+        pthread_mutex_unlock(&rxBufferMutex);
+    }
 }
+
 /**
- * @brief getCommand gets a command from an internal circular buffer.
- * @param response location to write command
- * @return 1 if response was returned, 0 if nothing has been received
+ * @brief peekReply gives the oldest unread reply, without copying it out of the ring buffer.
+ *  It stays valid until releaseReply() or clearCommandBuffer() is called.
+ * @return the reply, or NULL if nothing has been received
  */
-static int getReply(PacketResponseNG *packet) {
-    pthread_mutex_lock(&rxBufferMutex);
-    //If head == tail, there's nothing to read, or if we just got initialized
-    if (cmd_head == cmd_tail)  {
-        pthread_mutex_unlock(&rxBufferMutex);
-        return 0;
+static const PacketResponseNG *peekReply(void) {
+    size_t tail = __atomic_load_n(&rx_tail, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&rx_head, __ATOMIC_ACQUIRE) == tail) {
+        return NULL;
     }
+    return &rxBuffer[tail % CMD_BUFFER_SIZE];
+}
 
-    //Pick out the next unread command
-    memcpy(packet, &rxBuffer[cmd_tail], sizeof(PacketResponseNG));
+// hands the slot of the reply from peekReply() back to the communication thread
+static void releaseReply(void) {
+    size_t tail = __atomic_add_fetch(&rx_tail, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&rx_producer_waiting, __ATOMIC_SEQ_CST)
+            && __atomic_load_n(&rx_head, __ATOMIC_SEQ_CST) - tail <= REPLY_RESUME_LEVEL) {
+        pthread_mutex_lock(&rxBufferMutex);
+        pthread_cond_signal(&rxSpaceSig);
+        pthread_mutex_unlock(&rxBufferMutex);
+    }
+}
 
-    //Increment tail - this is a circular buffer, so modulo buffer size
-    cmd_tail = (cmd_tail + 1) % CMD_BUFFER_SIZE;
+/**
+ * @brief waitReply blocks until a reply is waiting in the circular buffer,
+ *  the communication thread died or ms_wait milliseconds elapsed.
+ */
+static void waitReply(uint32_t ms_wait) {
+    struct timespec deadline;
+    deadlineIn(&deadline, ms_wait);
+    uint64_t start = usclock();
 
+    pthread_mutex_lock(&rxBufferMutex);
+    __atomic_store_n(&rx_consumer_waiting, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&rx_head, __ATOMIC_SEQ_CST) == __atomic_load_n(&rx_tail, __ATOMIC_SEQ_CST)
+            && IsCommunicationThreadDead() == false) {
+        if (pthread_cond_timedwait(&rxBufferSig, &rxBufferMutex, &deadline) != 0) {
+            break;
+        }
+    }
+    __atomic_store_n(&rx_consumer_waiting, 0, __ATOMIC_SEQ_CST);
     pthread_mutex_unlock(&rxBufferMutex);
-    return 1;
+
+    commstats_waited(usclock() - start);
+}
+
+void GetReplyBufferStats(reply_buffer_stats_t *stats) {
+    stats->stored = __atomic_load_n(&rx_stats.stored, __ATOMIC_RELAXED);
+    stats->dropped = __atomic_load_n(&rx_stats.dropped, __ATOMIC_RELAXED);
+    stats->stalls = __atomic_load_n(&rx_stats.stalls, __ATOMIC_RELAXED);
+    stats->high_water = __atomic_load_n(&rx_stats.high_water, __ATOMIC_RELAXED);
+    stats->waiting = __atomic_load_n(&rx_head, __ATOMIC_RELAXED) - __atomic_load_n(&rx_tail, __ATOMIC_RELAXED);
+    stats->size = CMD_BUFFER_SIZE;
+}
+
+void ResetReplyBufferStats(void) {
+    __atomic_store_n(&rx_stats.stored, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&rx_stats.dropped, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&rx_stats.stalls, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&rx_stats.high_water, 0, __ATOMIC_RELAXED);
+}
+
+// how long a waiter may block before it has to look at its timeout again
+static uint32_t replyWaitTime(size_t ms_timeout, uint64_t start_clk) {
+    uint64_t elapsed = msclock() - start_clk;
+    if (ms_timeout == (size_t) - 1 || elapsed + REPLY_WAIT_MAX_MS <= ms_timeout) {
+        return REPLY_WAIT_MAX_MS;
+    }
+    if (elapsed >= ms_timeout) {
+        return 1;
+    }
+    return (uint32_t)(ms_timeout - elapsed) + 1;
 }
 
 //-----------------------------------------------------------------------------
@@ -406,6 +611,240 @@ bool IsReconnectedOk(void) {
     return ret;
 }
 
+// Receive buffer of the communication thread. The port gets read in big chunks and all
+// frames complete by then are taken apart from here, instead of one uart_receive() each
+// for the preamble, the payload and the postamble of every frame.
+#define RX_FRAME_BUF_LEN  (64 * 1024)
+static uint8_t rx_frame_buf[RX_FRAME_BUF_LEN];
+// first byte not taken apart yet
+static size_t rx_frame_start = 0;
+// end of the received data
+static size_t rx_frame_end = 0;
+// when the last bytes came in
+static uint64_t rx_frame_clk = 0;
+
+static size_t rx_frame_avail(void) {
+    return rx_frame_end - rx_frame_start;
+}
+
+// reads whatever the port has, waiting up to the port timeout for the first byte
+static int rx_frame_fill(void) {
+    // at most one partial frame is left, move it to the front
+    if (rx_frame_start > 0) {
+        memmove(rx_frame_buf, rx_frame_buf + rx_frame_start, rx_frame_avail());
+        rx_frame_end -= rx_frame_start;
+        rx_frame_start = 0;
+    }
+
+    uint32_t rxlen = 0;
+    int res = uart_receive_some(sp, rx_frame_buf + rx_frame_end, sizeof(rx_frame_buf) - rx_frame_end, &rxlen);
+    rx_frame_end += rxlen;
+    if (rxlen) {
+        rx_frame_clk = msclock();
+    }
+    return res;
+}
+
+// raw mode first takes what was read ahead for the frames
+static int rx_raw_receive(uint8_t *dest, uint32_t len, uint32_t *rxlen) {
+    size_t n = MIN(len, rx_frame_avail());
+    if (n == 0) {
+        return uart_receive(sp, dest, len, rxlen);
+    }
+    memcpy(dest, rx_frame_buf + rx_frame_start, n);
+    rx_frame_start += n;
+    *rxlen = n;
+    return PM3_SUCCESS;
+}
+
+/**
+ * @brief Takes the next frame out of the receive buffer.
+ * @param rx the frame, if valid
+ * @param valid set if rx holds a frame to hand on
+ * @param ack set if the frame acknowledges the last command sent
+ * @return false if no complete frame is buffered yet
+ */
+static bool rx_frame_next(PacketResponseNG *rx, bool *valid, bool *ack) {
+    const uint8_t *frame = rx_frame_buf + rx_frame_start;
+    size_t avail = rx_frame_avail();
+
+    *valid = false;
+    *ack = false;
+
+    if (avail < sizeof(PacketResponseNGPreamble)) {
+        return false;
+    }
+
+    PacketResponseNGPreamble pre;
+    memcpy(&pre, frame, sizeof(PacketResponseNGPreamble));
+
+    if (pre.magic != RESPONSENG_PREAMBLE_MAGIC && pre.magic != RESPONSENG_TAGGED_PREAMBLE_MAGIC) {
+        // Old style reply
+        if (avail < sizeof(PacketResponseOLD)) {
+            return false;
+        }
+
+        PacketResponseOLD rx_old;
+        memcpy(&rx_old, frame, sizeof(PacketResponseOLD));
+        rx_frame_start += sizeof(PacketResponseOLD);
+#ifdef COMMS_DEBUG
+        PrintAndLogEx(NORMAL, "Receiving OLD:");
+#endif
+#ifdef COMMS_DEBUG_RAW
+        print_hex_break((uint8_t *)&rx_old.cmd, sizeof(rx_old.cmd), 32);
+        print_hex_break((uint8_t *)&rx_old.arg, sizeof(rx_old.arg), 32);
+        print_hex_break((uint8_t *)&rx_old.d, sizeof(rx_old.d), 32);
+#endif
+        rx->ng = false;
+        rx->magic = 0;
+        rx->status = 0;
+        rx->crc = 0;
+        rx->seq = 0;
+        rx->cmd = rx_old.cmd;
+        rx->oldarg[0] = rx_old.arg[0];
+        rx->oldarg[1] = rx_old.arg[1];
+        rx->oldarg[2] = rx_old.arg[2];
+        rx->length = PM3_CMD_DATA_SIZE;
+        memcpy(&rx->data, &rx_old.d, rx->length);
+        *valid = true;
+        *ack = (rx->cmd == CMD_ACK);
+        return true;
+    }
+
+    // New style NG reply
+    uint16_t length = pre.length;
+    if (length > PM3_CMD_DATA_SIZE) {
+        PrintAndLogEx(WARNING, "Received packet frame with incompatible length: 0x%04x", length);
+        rx_frame_start += sizeof(PacketResponseNGPreamble);
+        return true;
+    }
+
+    // the sequence number of tagged frames sits right behind the payload, covered by the crc
+    size_t seqlen = (pre.magic == RESPONSENG_TAGGED_PREAMBLE_MAGIC) ? sizeof(rx->seq) : 0;
+    size_t framelen = sizeof(PacketResponseNGPreamble) + length + seqlen + sizeof(PacketResponseNGPostamble);
+    if (avail < framelen) {
+        return false;
+    }
+    rx_frame_start += framelen;
+
+    const uint8_t *payload = frame + sizeof(PacketResponseNGPreamble);
+    const uint8_t *post = payload + length;
+
+    rx->magic = pre.magic;
+    rx->ng = pre.ng;
+    rx->status = pre.status;
+    rx->reason = pre.reason;
+    rx->cmd = pre.cmd;
+    rx->seq = 0;
+    if (seqlen) {
+        memcpy(&rx->seq, post, sizeof(rx->seq));
+    }
+    memcpy(&rx->crc, post + seqlen, sizeof(rx->crc));
+
+    // Check CRC, accept MAGIC as placeholder
+    if (rx->crc != RESPONSENG_POSTAMBLE_MAGIC) {
+        uint8_t first, second;
+        compute_crc(CRC_14443_A, frame, sizeof(PacketResponseNGPreamble) + length + seqlen, &first, &second);
+        if ((first << 8) + second != rx->crc) {
+            PrintAndLogEx(WARNING, "Received packet frame with invalid CRC %02X%02X <> %04X", first, second, rx->crc);
+            return true;
+        }
+    }
+
+    if (rx->ng) {      // Received a valid NG frame
+        memcpy(&rx->data, payload, length);
+        rx->length = length;
+        *ack = ((rx->cmd == g_conn.last_command) && (rx->status == PM3_SUCCESS));
+    } else {
+        uint64_t arg[3];
+        if (length == 0) { // old frames can't be empty
+            PrintAndLogEx(WARNING, "Received empty MIX packet frame (length: 0x00)");
+            return true;
+        }
+        if (length < sizeof(arg)) {
+            PrintAndLogEx(WARNING, "Received MIX packet frame with incompatible length: 0x%04x", length);
+            return true;
+        }
+        // Received a valid MIX frame
+        memcpy(arg, payload, sizeof(arg));
+        rx->oldarg[0] = arg[0];
+        rx->oldarg[1] = arg[1];
+        rx->oldarg[2] = arg[2];
+        memcpy(&rx->data, payload + sizeof(arg), length - sizeof(arg));
+        rx->length = length - sizeof(arg);
+        *ack = (rx->cmd == CMD_ACK);
+    }
+
+#ifdef COMMS_DEBUG
+    PrintAndLogEx(NORMAL, "Receiving %s:", rx->ng ? "NG" : "MIX");
+#endif
+#ifdef COMMS_DEBUG_RAW
+    print_hex_break(frame, sizeof(PacketResponseNGPreamble), 32);
+    print_hex_break(payload, length, 32);
+    print_hex_break(post, seqlen + sizeof(PacketResponseNGPostamble), 32);
+#endif
+    *valid = true;
+    return true;
+}
+
+/**
+ * @brief Hands on all frames complete in the receive buffer. When the connection blocks
+ *  after an ACK, it stops right behind it so the next command goes out first.
+ * @return true if any frame got taken out of the buffer
+ */
+static bool rx_frame_dispatch(const communication_arg_t *connection, bool *ACK_received) {
+    PacketResponseNG rx;
+    bool valid, ack;
+    bool got = false;
+
+    size_t start = rx_frame_start;
+    while (rx_frame_next(&rx, &valid, &ack)) {
+        got = true;
+        if (valid == false) {
+            commstats_frame_error();
+            start = rx_frame_start;
+            continue;
+        }
+        commstats_received(rx.cmd, rx_frame_start - start);
+        start = rx_frame_start;
+        PacketResponseReceived(&rx);
+        if (ack) {
+            *ACK_received = true;
+            if (connection->block_after_ACK) {
+                break;
+            }
+        }
+    }
+    return got;
+}
+
+// sends the queued command if there is one, communication thread only. Caller holds txBufferMutex
+static void sendPendingCommand(void) {
+    if (txBuffer_pending == false) {
+        return;
+    }
+
+    int res;
+    if (txBufferNGLen) { // NG packet
+        res = uart_send(sp, (uint8_t *) &txBufferNG, txBufferNGLen);
+        g_conn.last_command = txBufferNG.pre.cmd;
+        txBufferNGLen = 0;
+    } else {
+        res = uart_send(sp, (uint8_t *) &txBuffer, sizeof(PacketCommandOLD));
+        g_conn.last_command = txBuffer.cmd;
+    }
+    if (res == PM3_EIO) {
+        tx_send_failed = true;
+    }
+
+    __atomic_store_n(&txBuffer_pending, false, __ATOMIC_SEQ_CST);
+
+    // main thread doesn't know send failed...
+
+    // tell main thread that txBuffer is empty
+    pthread_cond_signal(&txBufferSig);
+}
+
 // The communications thread.
 // signals to main thread when a response is ready to process.
 //
@@ -419,11 +858,15 @@ __attribute__((force_align_arg_pointer))
     const communication_arg_t *connection = (communication_arg_t *)targ;
     uint32_t rxlen;
     bool commfailed = false;
-    PacketResponseNG rx;
-    PacketResponseNGRaw rx_raw;
     // Stash the last state of is_receiving_raw, to detect if state changed
     bool is_receiving_raw_last = false;
 
+    tx_send_failed = false;
+
+    // nothing read ahead from an earlier connection
+    rx_frame_start = 0;
+    rx_frame_end = 0;
+
 #if defined(__MACH__) && defined(__APPLE__)
     disableAppNap("Proxmark3 polling UART");
 #endif
@@ -432,7 +875,6 @@ __attribute__((force_align_arg_pointer))
     while (connection->run) {
         rxlen = 0;
         bool ACK_received = false;
-        bool error = false;
         int res;
 
         // Signal to main thread that communications seems off.
@@ -443,6 +885,10 @@ __attribute__((force_align_arg_pointer))
                 PrintAndLogEx(WARNING, "\nCommunicating with Proxmark3 device " _RED_("failed"));
             }
             __atomic_test_and_set(&comm_thread_dead, __ATOMIC_SEQ_CST);
+            // wake up anyone waiting for a reply
+            pthread_mutex_lock(&rxBufferMutex);
+            pthread_cond_broadcast(&rxBufferSig);
+            pthread_mutex_unlock(&rxBufferMutex);
             break;
         }
 
@@ -452,19 +898,33 @@ __attribute__((force_align_arg_pointer))
             uint8_t *bufferData = __atomic_load_n(&comm_raw_data, __ATOMIC_SEQ_CST); // read only
             size_t bufferLen = __atomic_load_n(&comm_raw_len, __ATOMIC_SEQ_CST); // read only
             size_t bufferPos = __atomic_load_n(&comm_raw_pos, __ATOMIC_SEQ_CST); // read and write
-            if (bufferPos < bufferLen) {
-                size_t rxMaxLen = bufferLen - bufferPos;
+            bool is_ring = __atomic_load_n(&comm_raw_ring, __ATOMIC_SEQ_CST);
+            size_t bufferOffset = bufferPos;
+            size_t rxMaxLen = 0;
+
+            if (is_ring) {
+                // free space up to the end of the ring, never overwrite unconsumed data
+                size_t consumed = __atomic_load_n(&comm_raw_consumed, __ATOMIC_SEQ_CST);
+                bufferOffset = bufferPos % bufferLen;
+                rxMaxLen = MIN(bufferLen - (bufferPos - consumed), bufferLen - bufferOffset);
+            } else if (bufferPos < bufferLen) {
+                rxMaxLen = bufferLen - bufferPos;
+            }
+
+            if (is_ring && rxMaxLen == 0) {
+                // reader is behind, leave the data in the OS / USB buffers for now
+                msleep(1);
+            } else if (rxMaxLen > 0) {
 
                 rxMaxLen = MIN(COMM_RAW_RECEIVE_LEN, rxMaxLen);
 
-                res = uart_receive(sp, bufferData + bufferPos, rxMaxLen, &rxlen);
+                res = rx_raw_receive(bufferData + bufferOffset, rxMaxLen, &rxlen);
                 if (res == PM3_SUCCESS) {
                     uint64_t clk = msclock();
                     __atomic_store_n(&timeout_start_time,  clk, __ATOMIC_SEQ_CST);
                     __atomic_store_n(&comm_raw_pos, bufferPos + rxlen, __ATOMIC_SEQ_CST);
                 } else if (res != PM3_ENODATA) {
                     PrintAndLogEx(WARNING, "Error when reading raw data: %zu/%zu, %d", bufferPos, bufferLen, res);
-                    error = true;
                     if (res == PM3_ENOTTY) {
                         commfailed = true;
                     }
@@ -473,7 +933,7 @@ __attribute__((force_align_arg_pointer))
                 // Ignore data when bufferPos >= bufferLen and is_receiving_raw has not been set to false
                 uint8_t dummyData[64];
                 uint32_t dummyLen;
-                uart_receive(sp, dummyData, sizeof(dummyData), &dummyLen);
+                rx_raw_receive(dummyData, sizeof(dummyData), &dummyLen);
             }
         } else {
             if (is_receiving_raw_last) {
@@ -483,156 +943,36 @@ __attribute__((force_align_arg_pointer))
                 // comm_raw_data == NULL is used in SetCommunicationReceiveMode()
                 __atomic_store_n(&comm_raw_data, NULL, __ATOMIC_SEQ_CST);
             }
-            res = uart_receive(sp, (uint8_t *)&rx_raw.pre, sizeof(PacketResponseNGPreamble), &rxlen);
-
-            if ((res == PM3_SUCCESS) && (rxlen == sizeof(PacketResponseNGPreamble))) {
-
-                rx.magic = rx_raw.pre.magic;
-                uint16_t length = rx_raw.pre.length;
-                rx.ng = rx_raw.pre.ng;
-                rx.status = rx_raw.pre.status;
-                rx.reason = rx_raw.pre.reason;
-                rx.cmd = rx_raw.pre.cmd;
-
-                if (rx.magic == RESPONSENG_PREAMBLE_MAGIC) { // New style NG reply
-
-                    if (length > PM3_CMD_DATA_SIZE) {
-                        PrintAndLogEx(WARNING, "Received packet frame with incompatible length: 0x%04x", length);
-                        error = true;
+            // frames still buffered from the last read go first, the port is only read when none is complete
+            if (rx_frame_dispatch(connection, &ACK_received) == false) {
+                res = rx_frame_fill();
+                if (res == PM3_SUCCESS) {
+                    rx_frame_dispatch(connection, &ACK_received);
+                } else {
+                    // the rest of a frame didn't come in time, drop what we have of it.
+                    // The port may also just have been woken up to send something
+                    size_t partial = rx_frame_avail();
+                    uint32_t rx_timeout = uart_get_timeouts();
+                    if (rx_timeout == 0) {
+                        // not reconfigured, still the initial one
+                        rx_timeout = UART_FPC_CLIENT_RX_TIMEOUT_MS;
                     }
-
-                    if ((!error) && (length > 0)) { // Get the variable length payload
-
-                        res = uart_receive(sp, (uint8_t *)&rx_raw.data, length, &rxlen);
-
-                        if ((res != PM3_SUCCESS) || (rxlen != length)) {
-
-                            PrintAndLogEx(WARNING, "Received packet frame with variable part too short? %d/%d", rxlen, length);
-                            error = true;
-
+                    if (partial > 0 && msclock() - rx_frame_clk >= rx_timeout) {
+                        if (partial < sizeof(PacketResponseNGPreamble)) {
+                            PrintAndLogEx(WARNING, "Received packet frame preamble too short: %zu/%zu", partial, sizeof(PacketResponseNGPreamble));
                         } else {
-
-                            if (rx.ng) {      // Received a valid NG frame
-
-                                memcpy(&rx.data, &rx_raw.data, length);
-                                rx.length = length;
-                                if ((rx.cmd == g_conn.last_command) && (rx.status == PM3_SUCCESS)) {
-                                    ACK_received = true;
-                                }
-
-                            } else {
-                                uint64_t arg[3];
-                                if (length < sizeof(arg)) {
-                                    PrintAndLogEx(WARNING, "Received MIX packet frame with incompatible length: 0x%04x", length);
-                                    error = true;
-                                }
-
-                                if (!error) { // Received a valid MIX frame
-
-                                    memcpy(arg, &rx_raw.data, sizeof(arg));
-                                    rx.oldarg[0] = arg[0];
-                                    rx.oldarg[1] = arg[1];
-                                    rx.oldarg[2] = arg[2];
-                                    memcpy(&rx.data, ((uint8_t *)&rx_raw.data) + sizeof(arg), length - sizeof(arg));
-                                    rx.length = length - sizeof(arg);
-
-                                    if (rx.cmd == CMD_ACK) {
-                                        ACK_received = true;
-                                    }
-                                }
-                            }
-                        }
-                    } else if ((!error) && (length == 0)) { // we received an empty frame
-
-                        if (rx.ng) {
-                            rx.length = 0; // set received length to 0
-                        } else {  // old frames can't be empty
-                            PrintAndLogEx(WARNING, "Received empty MIX packet frame (length: 0x00)");
-                            error = true;
-                        }
-
-                    }
-
-                    if (!error) {                        // Get the postamble
-                        res = uart_receive(sp, (uint8_t *)&rx_raw.foopost, sizeof(PacketResponseNGPostamble), &rxlen);
-                        if ((res != PM3_SUCCESS) || (rxlen != sizeof(PacketResponseNGPostamble))) {
-                            PrintAndLogEx(WARNING, "Received packet frame without postamble");
-                            error = true;
+                            PrintAndLogEx(WARNING, "Received packet frame too short? %zu bytes", partial);
                         }
+                        rx_frame_start = rx_frame_end = 0;
                     }
-
-                    if (!error) {                        // Check CRC, accept MAGIC as placeholder
-                        rx.crc = rx_raw.foopost.crc;
-
-                        if (rx.crc != RESPONSENG_POSTAMBLE_MAGIC) {
-
-                            uint8_t first, second;
-                            compute_crc(CRC_14443_A, (uint8_t *)&rx_raw, sizeof(PacketResponseNGPreamble) + length, &first, &second);
-
-                            if ((first << 8) + second != rx.crc) {
-                                PrintAndLogEx(WARNING, "Received packet frame with invalid CRC %02X%02X <> %04X", first, second, rx.crc);
-                                error = true;
-                            }
-                        }
-                    }
-                    if (!error) {             // Received a valid OLD frame
-#ifdef COMMS_DEBUG
-                        PrintAndLogEx(NORMAL, "Receiving %s:", rx.ng ? "NG" : "MIX");
-#endif
-#ifdef COMMS_DEBUG_RAW
-                        print_hex_break((uint8_t *)&rx_raw.pre, sizeof(PacketResponseNGPreamble), 32);
-                        print_hex_break((uint8_t *)&rx_raw.data, rx_raw.pre.length, 32);
-                        print_hex_break((uint8_t *)&rx_raw.foopost, sizeof(PacketResponseNGPostamble), 32);
-#endif
-                        PacketResponseReceived(&rx);
-                    }
-                } else {                               // Old style reply
-                    PacketResponseOLD rx_old;
-                    memcpy(&rx_old, &rx_raw.pre, sizeof(PacketResponseNGPreamble));
-
-                    res = uart_receive(sp, ((uint8_t *)&rx_old) + sizeof(PacketResponseNGPreamble), sizeof(PacketResponseOLD) - sizeof(PacketResponseNGPreamble), &rxlen);
-                    if ((res != PM3_SUCCESS) || (rxlen != sizeof(PacketResponseOLD) - sizeof(PacketResponseNGPreamble))) {
-                        PrintAndLogEx(WARNING, "Received packet OLD frame with payload too short? %d/%zu", rxlen, sizeof(PacketResponseOLD) - sizeof(PacketResponseNGPreamble));
-                        error = true;
-                    }
-                    if (!error) {
-#ifdef COMMS_DEBUG
-                        PrintAndLogEx(NORMAL, "Receiving OLD:");
-#endif
-#ifdef COMMS_DEBUG_RAW
-                        print_hex_break((uint8_t *)&rx_old.cmd, sizeof(rx_old.cmd), 32);
-                        print_hex_break((uint8_t *)&rx_old.arg, sizeof(rx_old.arg), 32);
-                        print_hex_break((uint8_t *)&rx_old.d, sizeof(rx_old.d), 32);
-#endif
-                        rx.ng = false;
-                        rx.magic = 0;
-                        rx.status = 0;
-                        rx.crc = 0;
-                        rx.cmd = rx_old.cmd;
-                        rx.oldarg[0] = rx_old.arg[0];
-                        rx.oldarg[1] = rx_old.arg[1];
-                        rx.oldarg[2] = rx_old.arg[2];
-                        rx.length = PM3_CMD_DATA_SIZE;
-                        memcpy(&rx.data, &rx_old.d, rx.length);
-                        PacketResponseReceived(&rx);
-                        if (rx.cmd == CMD_ACK) {
-                            ACK_received = true;
-                        }
+                    if (res == PM3_ENOTTY) {
+                        commfailed = true;
                     }
                 }
-            } else {
-                if (rxlen > 0) {
-                    PrintAndLogEx(WARNING, "Received packet frame preamble too short: %d/%zu", rxlen, sizeof(PacketResponseNGPreamble));
-                    error = true;
-                }
-                if (res == PM3_ENOTTY) {
-                    commfailed = true;
-                }
             }
         }
 
         is_receiving_raw_last = is_receiving_raw;
-        // TODO if error, shall we resync ?
 
         pthread_mutex_lock(&txBufferMutex);
 
@@ -649,29 +989,9 @@ __attribute__((force_align_arg_pointer))
             }
         }
 
-        if (txBuffer_pending) {
-
-            if (txBufferNGLen) { // NG packet
-                res = uart_send(sp, (uint8_t *) &txBufferNG, txBufferNGLen);
-                if (res == PM3_EIO) {
-                    commfailed = true;
-                }
-                g_conn.last_command = txBufferNG.pre.cmd;
-                txBufferNGLen = 0;
-            } else {
-                res = uart_send(sp, (uint8_t *) &txBuffer, sizeof(PacketCommandOLD));
-                if (res == PM3_EIO) {
-                    commfailed = true;
-                }
-                g_conn.last_command = txBuffer.cmd;
-            }
-
-            txBuffer_pending = false;
-
-            // main thread doesn't know send failed...
-
-            // tell main thread that txBuffer is empty
-            pthread_cond_signal(&txBufferSig);
+        sendPendingCommand();
+        if (tx_send_failed) {
+            commfailed = true;
         }
 
         pthread_mutex_unlock(&txBufferMutex);
@@ -729,6 +1049,8 @@ void SetCommunicationRawReceiveBuffer(uint8_t *buffer, size_t len) {
     __atomic_store_n(&comm_raw_data,  buffer, __ATOMIC_SEQ_CST);
     __atomic_store_n(&comm_raw_len,  len, __ATOMIC_SEQ_CST);
     __atomic_store_n(&comm_raw_pos,  0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&comm_raw_consumed,  0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&comm_raw_ring,  false, __ATOMIC_SEQ_CST);
 }
 
 size_t GetCommunicationRawReceiveNum(void) {
@@ -761,6 +1083,7 @@ bool OpenProxmarkSilent(pm3_device_t **dev, const char *port, uint32_t speed) {
         // "Session" flag, to tell via which interface next msgs should be sent: USB or FPC USART
         g_conn.send_via_fpc_usart = false;
 
+        pthread_once(&rxSigOnce, initReplySigs);
         pthread_create(&communication_thread, NULL, &uart_communication, &g_conn);
         __atomic_clear(&comm_thread_dead, __ATOMIC_SEQ_CST);
         __atomic_clear(&reconnect_ok, __ATOMIC_SEQ_CST);
@@ -827,6 +1150,7 @@ bool OpenProxmark(pm3_device_t **dev, const char *port, bool wait_for_port, int
         // "Session" flag, to tell via which interface next msgs should be sent: USB or FPC USART
         g_conn.send_via_fpc_usart = false;
 
+        pthread_once(&rxSigOnce, initReplySigs);
         pthread_create(&communication_thread, NULL, &uart_communication, &g_conn);
         __atomic_clear(&comm_thread_dead, __ATOMIC_SEQ_CST);
         g_session.pm3_present = true; // TODO support for multiple devices
@@ -849,6 +1173,9 @@ bool OpenProxmark(pm3_device_t **dev, const char *port, bool wait_for_port, int
 // check if we can communicate with Pm3
 int TestProxmark(pm3_device_t *dev) {
 
+    // might be another firmware than before, no tagged frames until its capabilities say so
+    g_pm3_capabilities.has_tagged_frames = false;
+
     uint16_t len = 32;
     uint8_t data[len];
     for (uint16_t i = 0; i < len; i++) {
@@ -885,13 +1212,19 @@ int TestProxmark(pm3_device_t *dev) {
         return PM3_ETIMEOUT;
     }
 
-    if ((resp.length != sizeof(g_pm3_capabilities)) || (resp.data.asBytes[0] != CAPABILITIES_VERSION)) {
+    uint8_t caps_version = resp.data.asBytes[0];
+    if ((resp.length != sizeof(g_pm3_capabilities)) ||
+            (caps_version != CAPABILITIES_VERSION && caps_version != CAPABILITIES_VERSION_UNTAGGED)) {
         PrintAndLogEx(ERR, _RED_("Capabilities structure version sent by Proxmark3 is not the same as the one used by the client!"));
         PrintAndLogEx(ERR, _RED_("Please flash the Proxmark3 with the same version as the client."));
         return PM3_EDEVNOTSUPP;
     }
 
     memcpy(&g_pm3_capabilities, resp.data.asBytes, sizeof(capabilities_t));
+    if (caps_version == CAPABILITIES_VERSION_UNTAGGED) {
+        // older firmware, commands go one at a time
+        g_pm3_capabilities.has_tagged_frames = false;
+    }
     g_conn.send_via_fpc_usart = g_pm3_capabilities.via_fpc;
     g_conn.uart_speed = g_pm3_capabilities.baudrate;
 
@@ -1041,6 +1374,98 @@ size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, boo
     return pos;
 }
 
+/**
+ * @brief Receives raw data like WaitForRawDataTimeout(), but hands it to a callback in
+ * chunks as it arrives instead of collecting it in one buffer, so captures are not
+ * limited by client memory. Received data goes through an internal ring buffer.
+ *
+ * @param len total number of bytes to receive, 0 to receive until <Enter> is pressed
+ * @param ms_timeout stop when no data arrived for this long, -1 to wait forever
+ * @param show_process print the number of received bytes now and then
+ * @param callback called from the calling thread with each chunk of new data
+ * @param ctx passed to the callback
+ * @return number of bytes received
+ */
+size_t WaitForRawDataStream(size_t len, size_t ms_timeout, bool show_process, raw_data_callback_t callback, void *ctx) {
+    uint8_t *ring = calloc(COMM_RAW_RING_LEN, sizeof(uint8_t));
+    if (ring == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return 0;
+    }
+
+    uint8_t print_counter = 0;
+    size_t last_pos = 0;
+    size_t consumed = 0;
+
+    if (ms_timeout != (size_t) - 1) {
+        ms_timeout += communication_delay();
+    }
+    __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
+
+    SetCommunicationRawReceiveBuffer(ring, COMM_RAW_RING_LEN);
+    __atomic_store_n(&comm_raw_ring, true, __ATOMIC_SEQ_CST);
+    SetCommunicationReceiveMode(true);
+
+    bool stop = false;
+    while (stop == false && (len == 0 || consumed < len)) {
+
+        if (kbd_enter_pressed()) {
+            PrintAndLogEx(INFO, "Stopping");
+            SendCommandNG(CMD_BREAK_LOOP, NULL, 0);
+            stop = true;
+        }
+
+        size_t pos = __atomic_load_n(&comm_raw_pos, __ATOMIC_SEQ_CST);
+        if (len) {
+            pos = MIN(pos, len);
+        }
+
+        // hand over new data, at most two pieces when it wraps around the ring
+        while (consumed < pos) {
+            size_t offset = consumed % COMM_RAW_RING_LEN;
+            size_t n = MIN(pos - consumed, COMM_RAW_RING_LEN - offset);
+            if (callback) {
+                callback(ring + offset, n, ctx);
+            }
+            consumed += n;
+            __atomic_store_n(&comm_raw_consumed, consumed, __ATOMIC_SEQ_CST);
+        }
+
+        if (last_pos == pos) {
+            uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
+            if ((ms_timeout != (size_t) - 1) && (msclock() - tmp_clk > ms_timeout)) {
+                break;
+            }
+            msleep(10);
+        } else if (show_process && (print_counter++ & 0x3F) == 0) {
+            if (len) {
+                PrintAndLogEx(INFO, "[%zu/%zu]", pos, len);
+            } else {
+                PrintAndLogEx(INFO, "[%zu]", pos);
+            }
+        }
+        last_pos = pos;
+    }
+
+    if (stop == false) {
+        // same as WaitForRawDataTimeout(), tell the arm side to stop sampling
+        SendCommandNG(CMD_BREAK_LOOP, NULL, 0);
+    }
+
+    // let the receiving thread discard what is still in flight before going back to packets
+    __atomic_store_n(&comm_raw_ring, false, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&comm_raw_pos, COMM_RAW_RING_LEN, __ATOMIC_SEQ_CST);
+    msleep((ms_timeout != (size_t) - 1) ? ms_timeout : 100);
+    SetCommunicationReceiveMode(false);
+
+    // wait for the receiving thread to let go of the ring before freeing it
+    while (__atomic_load_n(&comm_raw_data, __ATOMIC_SEQ_CST) != NULL && IsCommunicationThreadDead() == false) {
+        msleep(1);
+    }
+    free(ring);
+    return consumed;
+}
+
 /**
  * @brief Waits for a certain response type. This method waits for a maximum of
  * ms_timeout milliseconds for a specified response command.
@@ -1068,6 +1493,8 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
 
     __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
 
+    bool found = false;
+
     // Wait until the command is received
     while (true) {
 
@@ -1076,23 +1503,35 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
             break;
         }
 
-        while (getReply(response)) {
+        // replies of other commands are looked at in place and dropped
+        const PacketResponseNG *reply;
+        while ((reply = peekReply()) != NULL) {
 
-            if (cmd == CMD_UNKNOWN || response->cmd == cmd) {
-                return true;
+            if (cmd == CMD_UNKNOWN || reply->cmd == cmd) {
+                copyReply(response, reply);
+                releaseReply();
+                found = true;
+                break;
             }
 
-            if (response->cmd == CMD_WTX && response->length == sizeof(uint16_t)) {
-                uint16_t wtx = response->data.asDwords[0] & 0xFFFF;
+            if (reply->cmd == CMD_WTX && reply->length == sizeof(uint16_t)) {
+                uint16_t wtx = reply->data.asDwords[0] & 0xFFFF;
                 PrintAndLogEx(DEBUG, "Got Waiting Time eXtension request %i ms", wtx);
+                commstats_wtx(cmd, wtx);
                 if (ms_timeout != (size_t) - 1) {
                     ms_timeout += wtx;
                 }
             }
+            releaseReply();
+        }
+
+        if (found) {
+            break;
         }
 
         uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
         if ((ms_timeout != (size_t) - 1) && (msclock() - tmp_clk > ms_timeout)) {
+            commstats_timeout(cmd);
             break;
         }
 
@@ -1101,10 +1540,10 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
             PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
             show_warning = false;
         }
-        // just to avoid CPU busy loop:
-        msleep(1);
+        // sleep until the next reply comes in instead of polling
+        waitReply(replyWaitTime(ms_timeout, tmp_clk));
     }
-    return false;
+    return found;
 }
 
 bool WaitForResponseTimeout(uint32_t cmd, PacketResponseNG *response, size_t ms_timeout) {
@@ -1115,6 +1554,202 @@ bool WaitForResponse(uint32_t cmd, PacketResponseNG *response) {
     return WaitForResponseTimeoutW(cmd, response, -1, true);
 }
 
+/**
+ * @brief Tells if the device understands tagged frames, as advertised in its capabilities.
+ *  Firmwares from before tagged frames send version 6 capabilities, where the bit doesn't count.
+ */
+bool IsPipelineSupported(void) {
+    return g_session.pm3_present && g_pm3_capabilities.has_tagged_frames;
+}
+
+static uint16_t next_seq_tag(void) {
+    // 0 means untagged
+    if (++seq_tags_last == 0) {
+        seq_tags_last = 1;
+    }
+    return seq_tags_last;
+}
+
+typedef struct {
+    size_t idx;
+    uint16_t seq;
+    size_t ms_timeout;
+} pipeline_slot_t;
+
+/**
+ * @brief Sends NG commands with up to window of them in flight, so the device gets the
+ *  next one while the client is still busy with the reply of the previous one.
+ *  The callback is called for every command sent, in order, from the calling thread. It must
+ *  not talk to the device itself. When it returns false, the commands not yet sent are dropped.
+ *  Devices without tagged frames get the commands one by one, with the same callbacks.
+ *
+ *  Only for commands whose firmware handler runs to its end. A handler stopping early when
+ *  data_available() tells there's another command waiting, e.g. a sniff or a simulation,
+ *  would abort on the next command already queued behind it.
+ *
+ * @param cmds commands to send
+ * @param count number of commands
+ * @param window maximum number of commands in flight, 0 for PIPELINE_DEFAULT_WINDOW
+ * @param ms_timeout timeout per command, counted from when the device could start on it
+ * @param callback called with the reply, or with an error and NULL
+ * @return PM3_SUCCESS if all commands got a reply, otherwise the first error
+ */
+int SendCommandPipelined(const pipeline_cmd_t *cmds, size_t count, size_t window, size_t ms_timeout, pipeline_callback_t callback, void *ctx) {
+
+    if (count == 0) {
+        return PM3_SUCCESS;
+    }
+
+    if (window == 0) {
+        window = PIPELINE_DEFAULT_WINDOW;
+    }
+    // replies of all commands in flight must fit in the reply buffer
+    window = MIN(window, CMD_BUFFER_SIZE / 4);
+
+    int ret = PM3_SUCCESS;
+
+    if (window == 1 || IsPipelineSupported() == false) {
+        for (size_t i = 0; i < count; i++) {
+            PacketResponseNG resp;
+            clearCommandBuffer();
+            SendCommandNG_internal(cmds[i].cmd, cmds[i].data, cmds[i].len, true, 0);
+            bool more;
+            if (WaitForResponseTimeoutW(cmds[i].cmd, &resp, ms_timeout, false)) {
+                more = callback(i, PM3_SUCCESS, &resp, ctx);
+            } else {
+                more = callback(i, PM3_ETIMEOUT, NULL, ctx);
+                ret = PM3_ETIMEOUT;
+            }
+            if (more == false) {
+                break;
+            }
+        }
+        return ret;
+    }
+
+    if (ms_timeout != (size_t) - 1) {
+        ms_timeout += communication_delay();
+    }
+
+    // slots[] is a fifo of the commands in flight, oldest first
+    pipeline_slot_t slots[CMD_BUFFER_SIZE / 4];
+    size_t inflight = 0;
+    size_t next = 0;
+
+    clearCommandBuffer();
+
+    // the device works through the commands one by one, so only the oldest one can time out.
+    // Its clock starts when it got sent or when the one before it was done
+    uint64_t oldest_clk = msclock();
+
+    while (inflight > 0 || next < count) {
+
+        while (inflight < window && next < count) {
+            pipeline_slot_t *slot = &slots[inflight++];
+            slot->idx = next;
+            slot->seq = next_seq_tag();
+            slot->ms_timeout = ms_timeout;
+            SendCommandNG_internal(cmds[next].cmd, cmds[next].data, cmds[next].len, true, slot->seq);
+            if (inflight == 1) {
+                oldest_clk = msclock();
+            }
+            next++;
+        }
+
+        if (IsCommunicationThreadDead()) {
+            break;
+        }
+
+        const PacketResponseNG *resp;
+        while (inflight > 0 && (resp = peekReply()) != NULL) {
+
+            // replies of other or untagged commands are dropped, like WaitForResponse() does
+            size_t s = 0;
+            while (s < inflight && (resp->seq == 0 || slots[s].seq != resp->seq)) {
+                s++;
+            }
+            if (s == inflight) {
+                releaseReply();
+                continue;
+            }
+
+            if (resp->cmd == CMD_WTX && resp->length == sizeof(uint16_t)) {
+                uint16_t wtx = resp->data.asDwords[0] & 0xFFFF;
+                PrintAndLogEx(DEBUG, "Got Waiting Time eXtension request %i ms", wtx);
+                commstats_wtx(cmds[slots[s].idx].cmd, wtx);
+                if (slots[s].ms_timeout != (size_t) - 1) {
+                    slots[s].ms_timeout += wtx;
+                }
+                releaseReply();
+                continue;
+            }
+
+            if (resp->cmd != cmds[slots[s].idx].cmd) {
+                releaseReply();
+                continue;
+            }
+
+            // the device answers in order, anything older than this one won't get a reply anymore
+            bool more = true;
+            for (size_t i = 0; i < s; i++) {
+                more &= callback(slots[i].idx, PM3_ETIMEOUT, NULL, ctx);
+                ret = (ret == PM3_SUCCESS) ? PM3_ETIMEOUT : ret;
+            }
+            // the callback gets the reply in place, it can't talk to the device anyway
+            more &= callback(slots[s].idx, PM3_SUCCESS, resp, ctx);
+            releaseReply();
+            if (more == false) {
+                count = next;
+            }
+
+            inflight -= s + 1;
+            memmove(slots, slots + s + 1, inflight * sizeof(pipeline_slot_t));
+            oldest_clk = msclock();
+        }
+
+        if (inflight == 0) {
+            continue;
+        }
+
+        if ((slots[0].ms_timeout != (size_t) - 1) && (msclock() - oldest_clk > slots[0].ms_timeout)) {
+            PrintAndLogEx(DEBUG, "Pipelined command %zu timed out", slots[0].idx);
+            commstats_timeout(cmds[slots[0].idx].cmd);
+            if (callback(slots[0].idx, PM3_ETIMEOUT, NULL, ctx) == false) {
+                count = next;
+            }
+            ret = (ret == PM3_SUCCESS) ? PM3_ETIMEOUT : ret;
+            inflight--;
+            memmove(slots, slots + 1, inflight * sizeof(pipeline_slot_t));
+            oldest_clk = msclock();
+            continue;
+        }
+
+        waitReply(replyWaitTime(slots[0].ms_timeout, oldest_clk));
+    }
+
+    // the communication thread died, whatever is in flight won't get a reply
+    if (inflight > 0 || next < count) {
+        for (size_t i = 0; i < inflight; i++) {
+            callback(slots[i].idx, PM3_EIO, NULL, ctx);
+        }
+        ret = PM3_EIO;
+    }
+    return ret;
+}
+
+// compressed BigBuf downloads,  by default only on links slower than USB
+static bool download_compressed(void) {
+    switch (g_session.download_compression) {
+        case COMPRESS_ON:
+            return true;
+        case COMPRESS_OFF:
+            return false;
+        case COMPRESS_AUTO:
+        default:
+            return g_conn.send_via_fpc_usart || (g_conn.send_via_ip != PM3_NONE);
+    }
+}
+
 /**
 * Data transfer from Proxmark to client. This method times out after
 * ms_timeout milliseconds.
@@ -1152,7 +1787,8 @@ bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint3
 
     switch (memtype) {
         case BIG_BUF: {
-            SendCommandMIX(CMD_DOWNLOAD_BIGBUF, start_index, bytes, 0, NULL, 0);
+            uint32_t flags = download_compressed() ? DOWNLOAD_BIGBUF_FLAG_LZ4 : 0;
+            SendCommandMIX(CMD_DOWNLOAD_BIGBUF, start_index, bytes, flags, NULL, 0);
             return dl_it(dest, bytes, response, ms_timeout, show_warning, CMD_DOWNLOADED_BIGBUF);
         }
         case BIG_BUF_EML: {
@@ -1189,33 +1825,42 @@ bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint3
 static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, size_t ms_timeout, bool show_warning, uint32_t rec_cmd) {
 
     uint32_t bytes_completed = 0;
+    uint64_t start_us = usclock();
     __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
 
     // Add delay depending on the communication channel & speed
     if (ms_timeout != (size_t) - 1)
         ms_timeout += communication_delay();
 
-    while (true) {
+    bool ret = false;
 
-        if (getReply(response)) {
+    while (true) {
 
-            if (response->cmd == CMD_ACK)
-                return true;
-            if (response->cmd == CMD_SPIFFS_DOWNLOAD && response->status == PM3_EMALLOC)
-                return false;
-            // Spiffs // fpgamem-plot download is converted to NG,
-            if (response->cmd == CMD_SPIFFS_DOWNLOAD || response->cmd == CMD_FPGAMEM_DOWNLOAD)
-                return true;
+        // the chunks are copied straight out of the reply buffer
+        const PacketResponseNG *reply;
+        bool done = false;
+        while ((reply = peekReply()) != NULL) {
+
+            if (reply->cmd == CMD_ACK
+                    || reply->cmd == CMD_SPIFFS_DOWNLOAD
+                    || reply->cmd == CMD_FPGAMEM_DOWNLOAD) {
+                copyReply(response, reply);
+                releaseReply();
+                // Spiffs // fpgamem-plot download is converted to NG,
+                ret = (response->cmd != CMD_SPIFFS_DOWNLOAD || response->status != PM3_EMALLOC);
+                done = true;
+                break;
+            }
 
             // sample_buf is a array pointer, located in data.c
             // arg0 = offset in transfer. Startindex of this chunk
             // arg1 = length bytes to transfer
             // arg2 = bigbuff tracelength (?)
-            if (response->cmd == rec_cmd) {
+            if (reply->cmd == rec_cmd) {
 
-                uint32_t offset = response->oldarg[0];
-                uint32_t copy_bytes = MIN(bytes - bytes_completed, response->oldarg[1]);
-                //uint32_t tracelen = response->oldarg[2];
+                uint32_t offset = reply->oldarg[0];
+                uint32_t copy_bytes = MIN(bytes - bytes_completed, reply->oldarg[1]);
+                //uint32_t tracelen = reply->oldarg[2];
 
                 // extended bounds check1.  upper limit is PM3_CMD_DATA_SIZE
                 // shouldn't happen
@@ -1224,22 +1869,45 @@ static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, siz
                 // extended bounds check2.
                 if (offset + copy_bytes > bytes) {
                     PrintAndLogEx(FAILED, "ERROR: Out of bounds when downloading from device,  offset %u | len %u | total len %u > buf_size %u", offset, copy_bytes,  offset + copy_bytes,  bytes);
+                    copyReply(response, reply);
+                    releaseReply();
+                    done = true;
                     break;
                 }
 
-                memcpy(dest + offset, response->data.asBytes, copy_bytes);
+                memcpy(dest + offset, reply->data.asBytes, copy_bytes);
                 bytes_completed += copy_bytes;
-            } else if (response->cmd == CMD_WTX && response->length == sizeof(uint16_t)) {
-                uint16_t wtx = response->data.asDwords[0] & 0xFFFF;
+            } else if (reply->cmd == CMD_DOWNLOADED_BIGBUF_LZ4 && rec_cmd == CMD_DOWNLOADED_BIGBUF) {
+
+                // firmware knowing DOWNLOAD_BIGBUF_FLAG_LZ4 sends blocks instead of plain chunks
+                uint32_t offset = 0;
+                int res = lz4block_unpack(reply->data.asBytes, reply->length, dest, bytes, &offset);
+                if (res < 0) {
+                    PrintAndLogEx(FAILED, "ERROR: Damaged or out of bounds block when downloading from device,  offset %u | total len %u", offset, bytes);
+                    copyReply(response, reply);
+                    releaseReply();
+                    done = true;
+                    break;
+                }
+                bytes_completed += res;
+            } else if (reply->cmd == CMD_WTX && reply->length == sizeof(uint16_t)) {
+                uint16_t wtx = reply->data.asDwords[0] & 0xFFFF;
                 PrintAndLogEx(DEBUG, "Got Waiting Time eXtension request %i ms", wtx);
+                commstats_wtx(rec_cmd, wtx);
                 if (ms_timeout != (size_t) - 1)
                     ms_timeout += wtx;
             }
+            releaseReply();
+        }
+
+        if (done) {
+            break;
         }
 
         uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
         if (msclock() - tmp_clk > ms_timeout) {
             PrintAndLogEx(FAILED, "Timed out while trying to download data from device");
+            commstats_timeout(rec_cmd);
             break;
         }
 
@@ -1249,6 +1917,12 @@ static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, siz
             PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
             show_warning = false;
         }
+
+        waitReply(replyWaitTime(ms_timeout, tmp_clk));
     }
-    return false;
+
+    if (ret) {
+        commstats_download(rec_cmd, bytes_completed, usclock() - start_us);
+    }
+    return ret;
 }
@@ -46,6 +46,8 @@ extern "C" {
 #endif
 
 #define COMM_RAW_RECEIVE_LEN (1024)
+// ring buffer size used by WaitForRawDataStream()
+#define COMM_RAW_RING_LEN (256 * 1024)
 
 typedef enum {
     BIG_BUF,
@@ -101,6 +103,19 @@ void SendCommandNG(uint16_t cmd, uint8_t *data, size_t len);
 void SendCommandMIX(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const void *data, size_t len);
 void clearCommandBuffer(void);
 
+// reply buffer counters, see storeReply()
+typedef struct {
+    uint64_t stored;        // replies put in the buffer
+    uint64_t dropped;       // replies lost since the buffer was full
+    uint64_t stalls;        // times the communication thread had to wait for a free slot
+    uint32_t high_water;    // most replies waiting at once
+    uint32_t waiting;       // replies waiting right now
+    uint32_t size;
+} reply_buffer_stats_t;
+
+void GetReplyBufferStats(reply_buffer_stats_t *stats);
+void ResetReplyBufferStats(void);
+
 #define FLASHMODE_SPEED 460800
 
 bool IsReconnectedOk(void);
@@ -116,10 +131,26 @@ void CloseProxmark(pm3_device_t *dev);
 void StartReconnectProxmark(void);
 
 size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, bool show_process);
+typedef void (*raw_data_callback_t)(const uint8_t *data, size_t len, void *ctx);
+size_t WaitForRawDataStream(size_t len, size_t ms_timeout, bool show_process, raw_data_callback_t callback, void *ctx);
 bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 bool WaitForResponseTimeout(uint32_t cmd, PacketResponseNG *response, size_t ms_timeout);
 bool WaitForResponse(uint32_t cmd, PacketResponseNG *response);
 
+// Pipelined NG commands, several of them in flight at once with tagged frames.
+// Each one is completed by the first reply with the same cmd and sequence number.
+// Not for commands whose firmware handler stops on data_available(), see SendCommandPipelined().
+#define PIPELINE_DEFAULT_WINDOW 4
+typedef struct {
+    uint16_t cmd;
+    const uint8_t *data;
+    size_t len;
+} pipeline_cmd_t;
+// resp is NULL when res != PM3_SUCCESS. Return false to not send the commands not yet sent
+typedef bool (*pipeline_callback_t)(size_t idx, int res, const PacketResponseNG *resp, void *ctx);
+bool IsPipelineSupported(void);
+int SendCommandPipelined(const pipeline_cmd_t *cmds, size_t count, size_t window, size_t ms_timeout, pipeline_callback_t callback, void *ctx);
+
 //bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, uint8_t *data, uint32_t datalen, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 
@@ -0,0 +1,421 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Communication counters
+//-----------------------------------------------------------------------------
+#include "commstats.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "pm3_cmd.h"
+#include "comms.h"          // GetReplyBufferStats
+#include "ui.h"
+#include "util_posix.h"     // usclock
+
+// open addressing table of the command IDs seen, plenty for a session
+#define COMMSTATS_SLOTS     256
+// pipelined commands of one ID waiting for their reply at once
+#define COMMSTATS_PENDING   8
+
+typedef struct {
+    bool used;
+    uint16_t cmd;
+    uint32_t sent;
+    uint64_t bytes_tx;
+    uint32_t replies;           // frames received with this ID
+    uint64_t bytes_rx;
+    uint32_t timeouts;
+    uint32_t wtx;
+    uint64_t wtx_ms;
+    uint32_t rtt_count;
+    uint64_t rtt_sum_us;
+    uint64_t rtt_min_us;
+    uint64_t rtt_max_us;
+    uint32_t rtt_hist[COMMSTATS_RTT_BUCKETS];
+    uint32_t downloads;
+    uint64_t dl_bytes;
+    uint64_t dl_us;
+    // send times of the commands still waiting for their first reply, oldest first
+    uint64_t pending[COMMSTATS_PENDING];
+    uint8_t pending_start;
+    uint8_t pending_count;
+} commstats_entry_t;
+
+typedef struct {
+    commstats_entry_t entries[COMMSTATS_SLOTS];
+    uint64_t start_us;
+    uint32_t frames_tx;
+    uint64_t bytes_tx;
+    uint32_t frames_rx;
+    uint64_t bytes_rx;
+    uint32_t frame_errors;
+    uint64_t waited_us;
+    uint32_t unlisted;          // events of IDs the table had no room for
+    uint16_t last_sent;         // MIX commands get a CMD_ACK reply
+} commstats_t;
+
+// updated from the main thread when sending and waiting, and from the communication thread when receiving
+static commstats_t stats;
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void stats_start(void) {
+    if (stats.start_us == 0) {
+        stats.start_us = usclock();
+    }
+}
+
+static commstats_entry_t *stats_entry(uint16_t cmd) {
+    uint32_t i = ((cmd * 0x9E37U) >> 8) % COMMSTATS_SLOTS;
+    for (uint32_t n = 0; n < COMMSTATS_SLOTS; n++, i = (i + 1) % COMMSTATS_SLOTS) {
+        commstats_entry_t *e = &stats.entries[i];
+        if (e->used == false) {
+            e->used = true;
+            e->cmd = cmd;
+            e->rtt_min_us = UINT64_MAX;
+            return e;
+        }
+        if (e->cmd == cmd) {
+            return e;
+        }
+    }
+    stats.unlisted++;
+    return NULL;
+}
+
+static uint8_t rtt_bucket(uint64_t us) {
+    uint64_t ms = us / 1000;
+    uint8_t b = 0;
+    while (ms && b < COMMSTATS_RTT_BUCKETS - 1) {
+        ms >>= 1;
+        b++;
+    }
+    return b;
+}
+
+void commstats_sent(uint16_t cmd, size_t len) {
+    pthread_mutex_lock(&stats_lock);
+    stats_start();
+    stats.frames_tx++;
+    stats.bytes_tx += len;
+    stats.last_sent = cmd;
+
+    commstats_entry_t *e = stats_entry(cmd);
+    if (e) {
+        e->sent++;
+        e->bytes_tx += len;
+        // a command never answered is overwritten by the next one
+        if (e->pending_count == COMMSTATS_PENDING) {
+            e->pending_start = (e->pending_start + 1) % COMMSTATS_PENDING;
+            e->pending_count--;
+        }
+        e->pending[(e->pending_start + e->pending_count) % COMMSTATS_PENDING] = usclock();
+        e->pending_count++;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_received(uint16_t cmd, size_t len) {
+    uint64_t now = usclock();
+
+    pthread_mutex_lock(&stats_lock);
+    stats_start();
+    stats.frames_rx++;
+    stats.bytes_rx += len;
+
+    commstats_entry_t *e = stats_entry(cmd);
+    if (e) {
+        e->replies++;
+        e->bytes_rx += len;
+    }
+
+    // the first reply of a command completes its round trip
+    if (cmd != CMD_WTX && cmd != CMD_DEBUG_PRINT_STRING && cmd != CMD_DEBUG_PRINT_INTEGERS) {
+        commstats_entry_t *c = (cmd == CMD_ACK) ? stats_entry(stats.last_sent) : e;
+        if (c && c->pending_count) {
+            uint64_t rtt = now - c->pending[c->pending_start];
+            c->pending_start = (c->pending_start + 1) % COMMSTATS_PENDING;
+            c->pending_count--;
+
+            c->rtt_count++;
+            c->rtt_sum_us += rtt;
+            c->rtt_min_us = MIN(c->rtt_min_us, rtt);
+            c->rtt_max_us = MAX(c->rtt_max_us, rtt);
+            c->rtt_hist[rtt_bucket(rtt)]++;
+        }
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_frame_error(void) {
+    pthread_mutex_lock(&stats_lock);
+    stats.frame_errors++;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_wtx(uint16_t cmd, uint16_t wtx) {
+    pthread_mutex_lock(&stats_lock);
+    commstats_entry_t *e = stats_entry(cmd);
+    if (e) {
+        e->wtx++;
+        e->wtx_ms += wtx;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_timeout(uint16_t cmd) {
+    pthread_mutex_lock(&stats_lock);
+    commstats_entry_t *e = stats_entry(cmd);
+    if (e) {
+        e->timeouts++;
+        // whatever was still waiting won't be answered anymore
+        e->pending_count = 0;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_download(uint16_t cmd, size_t bytes, uint64_t us) {
+    pthread_mutex_lock(&stats_lock);
+    commstats_entry_t *e = stats_entry(cmd);
+    if (e) {
+        e->downloads++;
+        e->dl_bytes += bytes;
+        e->dl_us += us;
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_waited(uint64_t us) {
+    pthread_mutex_lock(&stats_lock);
+    stats.waited_us += us;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void commstats_reset(void) {
+    pthread_mutex_lock(&stats_lock);
+    memset(&stats, 0, sizeof(stats));
+    stats.start_us = usclock();
+    pthread_mutex_unlock(&stats_lock);
+    ResetReplyBufferStats();
+}
+
+// a consistent copy, the printing doesn't hold up the communication thread
+static void stats_snapshot(commstats_t *dst) {
+    pthread_mutex_lock(&stats_lock);
+    stats_start();
+    memcpy(dst, &stats, sizeof(stats));
+    pthread_mutex_unlock(&stats_lock);
+}
+
+// upper bound in ms of the bucket holding the given share of the round trips
+static uint64_t rtt_percentile(const commstats_entry_t *e, uint32_t percent) {
+    uint64_t want = ((uint64_t)e->rtt_count * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (uint8_t b = 0; b < COMMSTATS_RTT_BUCKETS; b++) {
+        seen += e->rtt_hist[b];
+        if (seen >= want) {
+            return 1ULL << b;
+        }
+    }
+    return 1ULL << (COMMSTATS_RTT_BUCKETS - 1);
+}
+
+static int cmp_entry(const void *a, const void *b) {
+    const commstats_entry_t *ea = *(const commstats_entry_t * const *)a;
+    const commstats_entry_t *eb = *(const commstats_entry_t * const *)b;
+    return (int)ea->cmd - (int)eb->cmd;
+}
+
+static size_t sorted_entries(commstats_t *s, commstats_entry_t **out) {
+    size_t n = 0;
+    for (size_t i = 0; i < COMMSTATS_SLOTS; i++) {
+        if (s->entries[i].used) {
+            out[n++] = &s->entries[i];
+        }
+    }
+    qsort(out, n, sizeof(commstats_entry_t *), cmp_entry);
+    return n;
+}
+
+static double rate(uint64_t bytes, uint64_t us) {
+    return (us) ? (double)bytes * 1000000.0 / (double)us : 0.0;
+}
+
+void commstats_print(void) {
+    commstats_t *s = calloc(1, sizeof(commstats_t));
+    if (s == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return;
+    }
+    stats_snapshot(s);
+
+    reply_buffer_stats_t rb;
+    GetReplyBufferStats(&rb);
+
+    commstats_entry_t *e[COMMSTATS_SLOTS];
+    size_t n = sorted_entries(s, e);
+
+    uint64_t session_us = usclock() - s->start_us;
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(INFO, "--- " _CYAN_("Link") " ----------------------------");
+    PrintAndLogEx(INFO, "Counting for............ " _YELLOW_("%.1f") " s", (double)session_us / 1000000.0);
+    PrintAndLogEx(INFO, "Sent.................... %u frames, %" PRIu64 " bytes", s->frames_tx, s->bytes_tx);
+    PrintAndLogEx(INFO, "Received................ %u frames, %" PRIu64 " bytes", s->frames_rx, s->bytes_rx);
+    if (s->frame_errors) {
+        PrintAndLogEx(INFO, "Frame errors............ " _RED_("%u"), s->frame_errors);
+    } else {
+        PrintAndLogEx(INFO, "Frame errors............ 0");
+    }
+    PrintAndLogEx(INFO, "Waiting for device...... %.1f s ( %.0f%% )", (double)s->waited_us / 1000000.0
+                  , (session_us) ? (double)s->waited_us * 100.0 / (double)session_us : 0.0);
+    PrintAndLogEx(INFO, "Reply buffer............ %u / %u slots high water, %" PRIu64 " stalls"
+                  , rb.high_water, rb.size, rb.stalls);
+    if (rb.dropped) {
+        PrintAndLogEx(INFO, "Dropped replies......... " _RED_("%" PRIu64), rb.dropped);
+    } else {
+        PrintAndLogEx(INFO, "Dropped replies......... 0");
+    }
+    if (s->unlisted) {
+        PrintAndLogEx(INFO, "Not listed.............. %u events", s->unlisted);
+    }
+
+    if (n == 0) {
+        free(s);
+        return;
+    }
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(INFO, "--- " _CYAN_("Commands") " ----------------------------");
+    PrintAndLogEx(INFO, "  cmd  |  sent  | replies |  rx bytes | timeouts |  wtx  | rtt min |  avg  |  p50  |  p95  |  max  ( ms )");
+    PrintAndLogEx(INFO, "-------+--------+---------+-----------+----------+-------+---------+-------+-------+-------+-------");
+    for (size_t i = 0; i < n; i++) {
+        const commstats_entry_t *c = e[i];
+        char rtt[80] = "       |       |       |       |";
+        if (c->rtt_count) {
+            snprintf(rtt, sizeof(rtt), " %7.1f | %5.1f | <%4" PRIu64 " | <%4" PRIu64 " | %5.1f"
+                     , (double)c->rtt_min_us / 1000.0
+                     , (double)c->rtt_sum_us / c->rtt_count / 1000.0
+                     , rtt_percentile(c, 50)
+                     , rtt_percentile(c, 95)
+                     , (double)c->rtt_max_us / 1000.0
+                    );
+        }
+        PrintAndLogEx(INFO, "  %04x | %6u | %7u | %9" PRIu64 " | %8u | %5u |%s"
+                      , c->cmd, c->sent, c->replies, c->bytes_rx, c->timeouts, c->wtx, rtt
+                     );
+    }
+
+    bool dl = false;
+    for (size_t i = 0; i < n; i++) {
+        const commstats_entry_t *c = e[i];
+        if (c->downloads == 0) {
+            continue;
+        }
+        if (dl == false) {
+            PrintAndLogEx(NORMAL, "");
+            PrintAndLogEx(INFO, "--- " _CYAN_("Downloads") " ----------------------------");
+            PrintAndLogEx(INFO, "  cmd  | count |     bytes |    time ms |   kB/s");
+            PrintAndLogEx(INFO, "-------+-------+-----------+------------+---------");
+            dl = true;
+        }
+        PrintAndLogEx(INFO, "  %04x | %5u | %9" PRIu64 " | %10.1f | " _GREEN_("%7.1f")
+                      , c->cmd, c->downloads, c->dl_bytes, (double)c->dl_us / 1000.0
+                      , rate(c->dl_bytes, c->dl_us) / 1000.0
+                     );
+    }
+    PrintAndLogEx(NORMAL, "");
+    free(s);
+}
+
+json_t *commstats_json(void) {
+    commstats_t *s = calloc(1, sizeof(commstats_t));
+    if (s == NULL) {
+        return NULL;
+    }
+    stats_snapshot(s);
+
+    reply_buffer_stats_t rb;
+    GetReplyBufferStats(&rb);
+
+    commstats_entry_t *e[COMMSTATS_SLOTS];
+    size_t n = sorted_entries(s, e);
+
+    json_t *root = json_object();
+    json_object_set_new(root, "session_ms", json_real((double)(usclock() - s->start_us) / 1000.0));
+    json_object_set_new(root, "frames_tx", json_integer(s->frames_tx));
+    json_object_set_new(root, "bytes_tx", json_integer(s->bytes_tx));
+    json_object_set_new(root, "frames_rx", json_integer(s->frames_rx));
+    json_object_set_new(root, "bytes_rx", json_integer(s->bytes_rx));
+    json_object_set_new(root, "frame_errors", json_integer(s->frame_errors));
+    json_object_set_new(root, "waited_ms", json_real((double)s->waited_us / 1000.0));
+    json_object_set_new(root, "unlisted", json_integer(s->unlisted));
+
+    json_t *jrb = json_object();
+    json_object_set_new(jrb, "size", json_integer(rb.size));
+    json_object_set_new(jrb, "high_water", json_integer(rb.high_water));
+    json_object_set_new(jrb, "stored", json_integer(rb.stored));
+    json_object_set_new(jrb, "dropped", json_integer(rb.dropped));
+    json_object_set_new(jrb, "stalls", json_integer(rb.stalls));
+    json_object_set_new(root, "reply_buffer", jrb);
+
+    json_t *jcmds = json_array();
+    for (size_t i = 0; i < n; i++) {
+        const commstats_entry_t *c = e[i];
+        char id[7];
+        snprintf(id, sizeof(id), "0x%04x", c->cmd);
+
+        json_t *jc = json_object();
+        json_object_set_new(jc, "cmd", json_string(id));
+        json_object_set_new(jc, "sent", json_integer(c->sent));
+        json_object_set_new(jc, "bytes_tx", json_integer(c->bytes_tx));
+        json_object_set_new(jc, "replies", json_integer(c->replies));
+        json_object_set_new(jc, "bytes_rx", json_integer(c->bytes_rx));
+        json_object_set_new(jc, "timeouts", json_integer(c->timeouts));
+        json_object_set_new(jc, "wtx", json_integer(c->wtx));
+        json_object_set_new(jc, "wtx_ms", json_integer(c->wtx_ms));
+
+        if (c->rtt_count) {
+            json_t *jrtt = json_object();
+            json_object_set_new(jrtt, "count", json_integer(c->rtt_count));
+            json_object_set_new(jrtt, "min_ms", json_real((double)c->rtt_min_us / 1000.0));
+            json_object_set_new(jrtt, "avg_ms", json_real((double)c->rtt_sum_us / c->rtt_count / 1000.0));
+            json_object_set_new(jrtt, "max_ms", json_real((double)c->rtt_max_us / 1000.0));
+            json_t *jh = json_array();
+            for (uint8_t b = 0; b < COMMSTATS_RTT_BUCKETS; b++) {
+                json_array_append_new(jh, json_integer(c->rtt_hist[b]));
+            }
+            json_object_set_new(jrtt, "histogram_log2_ms", jh);
+            json_object_set_new(jc, "rtt", jrtt);
+        }
+
+        if (c->downloads) {
+            json_t *jdl = json_object();
+            json_object_set_new(jdl, "count", json_integer(c->downloads));
+            json_object_set_new(jdl, "bytes", json_integer(c->dl_bytes));
+            json_object_set_new(jdl, "ms", json_real((double)c->dl_us / 1000.0));
+            json_object_set_new(jdl, "bytes_per_s", json_real(rate(c->dl_bytes, c->dl_us)));
+            json_object_set_new(jc, "download", jdl);
+        }
+        json_array_append_new(jcmds, jc);
+    }
+    json_object_set_new(root, "commands", jcmds);
+
+    free(s);
+    return root;
+}
@@ -0,0 +1,54 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Communication counters
+//
+// Kept by the comms layer per command ID: frames and bytes each way, round
+// trip times from sending a command to its first reply, WTX extensions,
+// timeouts and download rates. Together with the time spent waiting for the
+// device and the reply buffer counters they tell if a slow workflow waits on
+// the card / device, the link or the host.
+//-----------------------------------------------------------------------------
+
+#ifndef COMMSTATS_H__
+#define COMMSTATS_H__
+
+#include "common.h"
+#include <jansson.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// round trip histogram, bucket 0 is < 1 ms, bucket n is [2^(n-1), 2^n) ms, the last one everything above
+#define COMMSTATS_RTT_BUCKETS   18
+
+// called by comms.c
+void commstats_sent(uint16_t cmd, size_t len);
+void commstats_received(uint16_t cmd, size_t len);
+void commstats_frame_error(void);
+void commstats_wtx(uint16_t cmd, uint16_t wtx);
+void commstats_timeout(uint16_t cmd);
+void commstats_download(uint16_t cmd, size_t bytes, uint64_t us);
+void commstats_waited(uint64_t us);
+
+void commstats_reset(void);
+void commstats_print(void);
+json_t *commstats_json(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -24,12 +24,11 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
-#include <jansson.h>
+#include "restable.h"
 #include <mbedtls/asn1.h>
 #include "mbedtls/bignum.h"      // big num
 #include <mbedtls/oid.h>
 #include "emv/emv_tags.h"
-#include "emv/emvjson.h"
 #include "util.h"
 #include "proxmark3.h"
 #include "fileutils.h"
@@ -285,47 +284,34 @@ cleanup:
     free(hex);
 }
 
+// cells of the oids table, as listed in pm3_json2table.py
+enum {
+    OID_CELL_OID,
+    OID_CELL_DESC,
+    OID_CELL_GROUP,
+};
+
 static char *asn1_oid_description(const char *oid, bool with_group_desc) {
-    json_error_t error;
-    json_t *root = NULL;
     static char res[300];
     memset(res, 0x00, sizeof(res));
 
-    char *path;
-    if (searchFile(&path, RESOURCES_SUBDIR, "oids", ".json", false) != PM3_SUCCESS) {
+    const restable_t *t = restable_open("oids", false);
+    int rec = restable_find(t, oid);
+    if (rec < 0) {
         return NULL;
     }
 
-    // load `oids.json`
-    root = json_load_file(path, 0, &error);
-    free(path);
-
-    if (!root || !json_is_object(root)) {
-        goto error;
-    }
-
-    json_t *elm = json_object_get(root, oid);
-    if (!elm) {
-        goto error;
+    const char *desc = restable_get(t, rec, OID_CELL_DESC);
+    if (desc == NULL) {
+        return NULL;
     }
+    strncpy(res, desc, sizeof(res) - 1);
 
-    if (JsonLoadStr(elm, "$.d", res))
-        goto error;
-
-    char strext[300] = {0};
-    if (!JsonLoadStr(elm, "$.c", strext)) {
-        strcat(res, " (");
-        strcat(res, strext);
-        strcat(res, ")");
+    const char *group = restable_get(t, rec, OID_CELL_GROUP);
+    if (group) {
+        snprintf(res + strlen(res), sizeof(res) - strlen(res), " (%s)", group);
     }
-
-    json_decref(root);
     return res;
-
-error:
-    if (root)
-        json_decref(root);
-    return NULL;
 }
 
 static void asn1_tag_dump_object_id(const struct tlv *tlv, const struct asn1_tag *tag, int level) {
@@ -43,6 +43,11 @@ int ExecuteCryptoTests(bool verbose, bool ignore_time, bool include_slow_tests)
     int res;
     bool TestFail = false;
 
+    // the mbedtls self tests print to stdout themselves
+    bool old_flush = GetFlushAfterWrite();
+    SetFlushAfterWrite(true);
+    PrintAndLogFlush();
+
     res = mbedtls_mpi_self_test(verbose);
     if (res) TestFail = true;
 
@@ -115,6 +120,7 @@ int ExecuteCryptoTests(bool verbose, bool ignore_time, bool include_slow_tests)
     else
         PrintAndLogEx(SUCCESS, "Tests ( %s )", _GREEN_("ok"));
 
+    SetFlushAfterWrite(old_flush);
     return TestFail;
 }
 
@@ -0,0 +1,193 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// FFT and FFT based autocorrelation of sample buffers
+//-----------------------------------------------------------------------------
+#include "fft.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ui.h"         // M_PI
+
+// smallest power of two >= n
+size_t fft_size(size_t n) {
+    size_t size = 1;
+    while (size < n) {
+        size <<= 1;
+    }
+    return size;
+}
+
+// in place iterative radix-2 FFT,  n must be a power of two.
+// the inverse transform is not scaled by 1/n
+int fft(fft_complex_t *data, size_t n, bool inverse) {
+
+    if (data == NULL || n == 0 || (n & (n - 1)) != 0) {
+        return PM3_EINVARG;
+    }
+
+    // bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j) {
+            fft_complex_t tmp = data[i];
+            data[i] = data[j];
+            data[j] = tmp;
+        }
+    }
+
+    double sign = (inverse) ? 1.0 : -1.0;
+
+    for (size_t len = 2; len <= n; len <<= 1) {
+
+        double angle = sign * 2.0 * M_PI / len;
+        fft_complex_t wlen = { cos(angle), sin(angle) };
+        size_t half = len >> 1;
+
+        for (size_t i = 0; i < n; i += len) {
+
+            fft_complex_t w = { 1.0, 0.0 };
+
+            for (size_t k = 0; k < half; k++) {
+
+                fft_complex_t *a = &data[i + k];
+                fft_complex_t *b = &data[i + k + half];
+
+                fft_complex_t t = {
+                    b->re * w.re - b->im * w.im,
+                    b->re * w.im + b->im * w.re
+                };
+
+                b->re = a->re - t.re;
+                b->im = a->im - t.im;
+                a->re += t.re;
+                a->im += t.im;
+
+                double wre = w.re * wlen.re - w.im * wlen.im;
+                w.im = w.re * wlen.im + w.im * wlen.re;
+                w.re = wre;
+            }
+        }
+    }
+    return PM3_SUCCESS;
+}
+
+// Autocorrelation for lags 0 .. maxlag-1,  via the power spectrum (Wiener-Khinchin).
+// The mean is removed first, the buffer is zero padded so the correlation isn't circular.
+// With hann, the samples are tapered with a Hann window and every lag is divided by the
+// autocorrelation of the window itself, which keeps the estimate unbiased (Boersma 1993).
+// Without it, this is the usual unbiased estimate with a 1 / (len - lag) correction.
+//
+// acov   (optional) autocovariance per lag
+// acorr  (optional) autocorrelation per lag, acov normalized by the variance, acorr[0] = 1
+int autocorrelate_fft(const int *in, size_t len, size_t maxlag, bool hann, double *acov, double *acorr) {
+
+    if (in == NULL || len < 2) {
+        return PM3_EINVARG;
+    }
+
+    if (maxlag > len) {
+        maxlag = len;
+    }
+
+    double mean = 0.0;
+    for (size_t i = 0; i < len; i++) {
+        mean += in[i];
+    }
+    mean /= len;
+
+    size_t n = fft_size(len + maxlag);
+    fft_complex_t *buf = calloc(n, sizeof(fft_complex_t));
+    if (buf == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    // samples in the real part,  the window (if any) in the imaginary part,
+    // so both spectra come out of a single transform
+    for (size_t i = 0; i < len; i++) {
+        double w = 1.0;
+        if (hann) {
+            w = 0.5 - 0.5 * cos(2.0 * M_PI * i / (len - 1));
+            buf[i].im = w;
+        }
+        buf[i].re = (in[i] - mean) * w;
+    }
+
+    fft(buf, n, false);
+
+    if (hann) {
+        // split into the two power spectra, both real
+        for (size_t k = 0; k <= n / 2; k++) {
+            size_t nk = (n - k) & (n - 1);
+            fft_complex_t z = buf[k];
+            fft_complex_t zc = buf[nk];
+
+            double xre = (z.re + zc.re) / 2;
+            double xim = (z.im - zc.im) / 2;
+            double wre = (z.im + zc.im) / 2;
+            double wim = (zc.re - z.re) / 2;
+
+            double pxx = xre * xre + xim * xim;
+            double pww = wre * wre + wim * wim;
+
+            buf[k].re = pxx;
+            buf[k].im = pww;
+            buf[nk].re = pxx;
+            buf[nk].im = pww;
+        }
+    } else {
+        for (size_t k = 0; k < n; k++) {
+            buf[k].re = buf[k].re * buf[k].re + buf[k].im * buf[k].im;
+            buf[k].im = 0;
+        }
+    }
+
+    fft(buf, n, true);
+
+    // the inverse transform isn't scaled,  the window overlap per lag is len - lag without hann
+    double wnorm0 = (hann) ? buf[0].im / n : (double)len;
+    double r0 = (buf[0].re / n) / wnorm0;
+    if (r0 <= 0.0) {
+        free(buf);
+        return PM3_ESOFT;
+    }
+
+    for (size_t k = 0; k < maxlag; k++) {
+
+        double wnorm = (hann) ? buf[k].im / n : (double)(len - k);
+
+        // too little window overlap left to give a meaningful estimate
+        double r = 0.0;
+        if (wnorm > 0.0 && (hann == false || wnorm >= wnorm0 * 0.01)) {
+            r = (buf[k].re / n) / wnorm;
+        }
+
+        if (acov) {
+            acov[k] = r;
+        }
+        if (acorr) {
+            acorr[k] = r / r0;
+        }
+    }
+
+    free(buf);
+    return PM3_SUCCESS;
+}
@@ -0,0 +1,40 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// FFT and FFT based autocorrelation of sample buffers
+//-----------------------------------------------------------------------------
+
+#ifndef FFT_H__
+#define FFT_H__
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double re;
+    double im;
+} fft_complex_t;
+
+size_t fft_size(size_t n);
+int fft(fft_complex_t *data, size_t n, bool inverse);
+int autocorrelate_fft(const int *in, size_t len, size_t maxlag, bool hann, double *acov, double *acorr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
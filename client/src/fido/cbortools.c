@@ -229,6 +229,7 @@ int TinyCborPrintFIDOPackage(uint8_t cmdCode, bool isResponse, uint8_t *data, si
     CborError err = dumprecursive(cmdCode, isResponse, &cb, false, 0);
 
     if (err) {
+        PrintAndLogFlush();
         fprintf(stderr,
                 "CBOR parsing failure at offset %" PRIu32 " : %s\n",
                 (uint32_t)(cb.ptr - data),
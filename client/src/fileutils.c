@@ -154,6 +154,7 @@ bool setDefaultPath(savePaths_t pathIndex, const char *path) {
 
         g_session.defaultPaths[pathIndex] = (char *)realloc(g_session.defaultPaths[pathIndex], len + 1);
         strcpy(g_session.defaultPaths[pathIndex], path);
+        searchFileCacheInvalidate();
         return true;
     }
     return false;
@@ -194,6 +195,9 @@ char *newfilenamemcopyEx(const char *preferredName, const char *suffix, savePath
         return NULL;
     }
 
+    // a file is about to be written, searchFile has to look again
+    searchFileCacheInvalidate();
+
     // 1: null terminator
     // 16: room for filenum to ensure new filename
     // save_path_len + strlen(PATHSEP):  the user preference save paths
@@ -886,7 +890,7 @@ out:
 }
 
 // Signal trace file, PM3
-int saveFilePM3(const char *preferredName, int *data, size_t datalen) {
+int saveFilePM3(const char *preferredName, const int *data, size_t datalen) {
 
     if (data == NULL || datalen == 0) {
         return PM3_EINVARG;
@@ -2848,6 +2852,220 @@ int searchAndList(const char *pm3dir, const char *ext) {
     return PM3_SUCCESS;
 }
 
+// Directory index for searchFile
+//
+// searchFinalFile probes the same few directories for every file it looks for,
+// loading the hardnested tables alone means thousands of probes. A directory that
+// gets probed again and again is listed once into a sorted name table, further
+// lookups are a binary search. The table is checked against the directory mtime
+// again after searchFileCacheInvalidate(), which runs for every command, when a
+// file name is handed out for saving and when a preference path changes.
+// A name found in the table is still confirmed with stat().
+// Names are compared without ASCII case, any file system may fold case (vfat,
+// exFAT and SMB mounts on Linux too) and stat() sorts out the false hits. It
+// folds more than ASCII though, so a name with other bytes that isn't in the
+// table goes to stat() as well.
+typedef struct {
+    char *path;
+    uint32_t generation;    // of the last check against the directory
+    uint32_t probes;        // lookups since, before the directory is listed
+    bool missing;
+    bool listed;
+    time_t mtime;
+    time_t listed_at;
+    char **names;
+    size_t count;
+} dir_index_t;
+
+// probes of a directory answered with stat() before it is worth listing
+#define DIR_INDEX_MIN_PROBES    8
+#define DIR_INDEX_MAX_DIRS      64
+
+static dir_index_t dir_indexes[DIR_INDEX_MAX_DIRS];
+static size_t dir_index_count = 0;
+static uint32_t dir_index_generation = 1;
+static pthread_mutex_t dir_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void searchFileCacheInvalidate(void) {
+    __atomic_add_fetch(&dir_index_generation, 1, __ATOMIC_RELAXED);
+}
+
+static int dir_index_name_cmp(const void *a, const void *b) {
+    return strcasecmp(*(char *const *)a, *(char *const *)b);
+}
+
+static void dir_index_clear(dir_index_t *d) {
+    for (size_t i = 0; i < d->count; i++) {
+        free(d->names[i]);
+    }
+    free(d->names);
+    d->names = NULL;
+    d->count = 0;
+    d->listed = false;
+}
+
+static void dir_index_list(dir_index_t *d, time_t mtime) {
+
+    dir_index_clear(d);
+
+    struct dirent **namelist;
+    int n = scandir(d->path, &namelist, NULL, alphasort);
+    if (n < 0) {
+        return;
+    }
+
+    d->names = calloc(n, sizeof(char *));
+    for (int i = 0; i < n; i++) {
+        if (d->names != NULL) {
+            d->names[d->count] = strdup(namelist[i]->d_name);
+            if (d->names[d->count] != NULL) {
+                d->count++;
+            }
+        }
+        free(namelist[i]);
+    }
+    free(namelist);
+
+    if (d->names == NULL || d->count != (size_t)n) {
+        dir_index_clear(d);
+        return;
+    }
+
+    qsort(d->names, d->count, sizeof(char *), dir_index_name_cmp);
+    d->listed = true;
+    d->mtime = mtime;
+    d->listed_at = time(NULL);
+}
+
+static dir_index_t *dir_index_get(const char *dir) {
+
+    for (size_t i = 0; i < dir_index_count; i++) {
+        if (strcmp(dir_indexes[i].path, dir) == 0) {
+            return &dir_indexes[i];
+        }
+    }
+
+    if (dir_index_count == DIR_INDEX_MAX_DIRS) {
+        for (size_t i = 0; i < dir_index_count; i++) {
+            dir_index_clear(&dir_indexes[i]);
+            free(dir_indexes[i].path);
+        }
+        dir_index_count = 0;
+    }
+
+    dir_index_t *d = &dir_indexes[dir_index_count];
+    memset(d, 0, sizeof(dir_index_t));
+    d->path = strdup(dir);
+    if (d->path == NULL) {
+        return NULL;
+    }
+    dir_index_count++;
+    return d;
+}
+
+// 1 found, 0 not there, -1 when the index can't tell
+static int dir_index_lookup(const char *dir, const char *name) {
+
+    uint32_t generation = __atomic_load_n(&dir_index_generation, __ATOMIC_RELAXED);
+
+    dir_index_t *d = dir_index_get(dir);
+    if (d == NULL) {
+        return -1;
+    }
+
+    if (d->generation != generation) {
+
+        if (d->probes < DIR_INDEX_MIN_PROBES) {
+            d->probes++;
+            return -1;
+        }
+
+#ifdef _WIN32
+        struct _stat st;
+        int res = _stat(dir, &st);
+#else
+        struct stat st;
+        int res = stat(dir, &st);
+#endif
+        if (res != 0) {
+            // no such directory, nothing in it
+            dir_index_clear(d);
+            d->missing = true;
+            d->generation = generation;
+            d->probes = 0;
+            return 0;
+        }
+
+        d->missing = false;
+
+        // a change within the second it was listed in doesn't show in the mtime
+        if (d->listed == false || st.st_mtime != d->mtime || d->mtime >= d->listed_at) {
+            dir_index_list(d, st.st_mtime);
+        }
+        d->generation = generation;
+        d->probes = 0;
+    }
+
+    if (d->missing) {
+        return 0;
+    }
+
+    if (d->listed == false) {
+        return -1;
+    }
+
+    const char *key = name;
+    if (bsearch(&key, d->names, d->count, sizeof(char *), dir_index_name_cmp) != NULL) {
+        return 1;
+    }
+
+    for (const uint8_t *p = (const uint8_t *)name; *p; p++) {
+        if (*p >= 0x80) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// fileExists() for searchFinalFile, through the directory index
+static bool searchFileExists(const char *path) {
+
+    const char *sep = strrchr(path, '/');
+#ifdef _WIN32
+    const char *bsep = strrchr(path, '\\');
+    if (bsep != NULL && (sep == NULL || bsep > sep)) {
+        sep = bsep;
+    }
+#endif
+
+    char dir[strlen(path) + 2];
+    const char *name;
+    if (sep == NULL) {
+        strcpy(dir, ".");
+        name = path;
+    } else if (sep == path) {
+        strcpy(dir, "/");
+        name = sep + 1;
+    } else {
+        memcpy(dir, path, sep - path);
+        dir[sep - path] = '\0';
+        name = sep + 1;
+    }
+
+    if (strlen(name) == 0 || strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+        return fileExists(path);
+    }
+
+    pthread_mutex_lock(&dir_index_lock);
+    int found = dir_index_lookup(dir, name);
+    pthread_mutex_unlock(&dir_index_lock);
+
+    if (found == 0) {
+        return false;
+    }
+    return fileExists(path);
+}
+
 static int searchFinalFile(char **foundpath, const char *pm3dir, const char *searchname, bool silent) {
 
     if ((foundpath == NULL) || (pm3dir == NULL) || (searchname == NULL)) {
@@ -2867,9 +3085,13 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
         PrintAndLogEx(INFO, "Searching... %s", filename);
     }
 
+    // explicit paths are tried as they are
+    bool explicit_path = (((strlen(filename) > 1) && (filename[0] == '/')) ||
+                          ((strlen(filename) > 2) && (filename[0] == '.') && (filename[1] == '/')));
+
     // try implicit relative path
     PrintAndLogEx(DEBUG, "Searching implicit relative paths");
-    if (fileExists(filename)) {
+    if ((explicit_path) ? fileExists(filename) : searchFileExists(filename)) {
         *foundpath = filename;
         if ((g_debugMode == 2) && (!silent)) {
             PrintAndLogEx(INFO, "Found %s", *foundpath);
@@ -2877,8 +3099,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
         return PM3_SUCCESS;
     }
 
-    if (((strlen(filename) > 1) && (filename[0] == '/')) ||
-            ((strlen(filename) > 2) && (filename[0] == '.') && (filename[1] == '/'))) {
+    if (explicit_path) {
         goto out;
     }
 
@@ -2898,7 +3119,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
             PrintAndLogEx(INFO, "Searching %s", default_path);
         }
 
-        if (fileExists(default_path)) {
+        if (searchFileExists(default_path)) {
             free(filename);
             *foundpath = default_path;
             if ((g_debugMode == 2) && (!silent)) {
@@ -2928,7 +3149,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
             PrintAndLogEx(INFO, "Searching %s", path);
         }
 
-        if (fileExists(path)) {
+        if (searchFileExists(path)) {
             free(filename);
             *foundpath = path;
             if ((g_debugMode == 2) && (!silent)) {
@@ -2963,7 +3184,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
             PrintAndLogEx(INFO, "Searching %s", path);
         }
 
-        if (fileExists(path)) {
+        if (searchFileExists(path)) {
             free(filename);
             *foundpath = path;
             if ((g_debugMode == 2) && (!silent)) {
@@ -2996,7 +3217,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
             PrintAndLogEx(INFO, "Searching %s", path);
         }
 
-        if (fileExists(path)) {
+        if (searchFileExists(path)) {
             free(filename);
             *foundpath = path;
             if ((g_debugMode == 2) && (!silent)) {
@@ -3025,7 +3246,7 @@ static int searchFinalFile(char **foundpath, const char *pm3dir, const char *sea
             PrintAndLogEx(INFO, "Searching %s", path);
         }
 
-        if (fileExists(path)) {
+        if (searchFileExists(path)) {
             free(filename);
             *foundpath = path;
             if ((g_debugMode == 2) && (!silent)) {
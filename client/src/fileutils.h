@@ -166,7 +166,7 @@ int saveFileWAVE(const char *preferredName, const int *data, size_t datalen);
  * @param datalen the length of the data
  * @return 0 for ok
  */
-int saveFilePM3(const char *preferredName, int *data, size_t datalen);
+int saveFilePM3(const char *preferredName, const int *data, size_t datalen);
 
 /**
  * @brief Utility function to save a keydump into a binary file.
@@ -323,6 +323,7 @@ int detect_nfc_dump_format(const char *preferredName, nfc_df_e *dump_type, bool
 
 int searchAndList(const char *pm3dir, const char *ext);
 int searchFile(char **foundpath, const char *pm3dir, const char *searchname, const char *suffix, bool silent);
+void searchFileCacheInvalidate(void);
 
 
 /**
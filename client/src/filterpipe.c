@@ -0,0 +1,602 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Fused sample filter pipeline
+//-----------------------------------------------------------------------------
+#include "filterpipe.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
+#include "ui.h"
+#include "graph.h"
+#include "proxgui.h"       // RepaintGraphWindow
+#include "util.h"           // str_dup
+#include "commonutil.h"     // ARRAYLEN
+
+// four int32 lanes,  SSE2 / NEON with the compiler's generic vector support
+typedef int32_t fp_v4_t __attribute__((vector_size(16)));
+#define FP_LANES 4
+
+static const struct {
+    const char *name;
+    uint8_t args;
+    uint8_t lookahead;      // samples past the current one the stage reads
+} filterpipe_ops[] = {
+    [FILTERPIPE_NORM]         = { "norm",         0, 0 },
+    [FILTERPIPE_HPF]          = { "hpf",          0, 0 },
+    [FILTERPIPE_IIR]          = { "iir",          1, 0 },
+    [FILTERPIPE_DIRTHRESHOLD] = { "dirthreshold", 2, 1 },
+    [FILTERPIPE_CTHRESHOLD]   = { "cthreshold",   2, 2 },
+    [FILTERPIPE_ENVELOPE]     = { "envelope",     0, 7 },
+};
+
+// a stage while the pipeline runs
+typedef struct {
+    filterpipe_stage_t st;
+    uint8_t lookahead;
+    bool active;        // false when the single command would leave the samples alone
+    size_t pos;         // next sample to produce
+    size_t tpos;        // cthreshold, thresholded up to here
+
+    // norm,  min / max of the input past the first 10 samples
+    int32_t min;
+    int32_t max;
+    // hpf,  histogram of the input as 8 bit samples and the offset taken out
+    signal_hist_t hist;
+    int32_t off;
+
+    int32_t reg;        // iir filter register
+    int32_t last;       // dirthreshold,  previous input sample
+    int32_t y1;         // previous output (unclamped)
+    int32_t y2;         // output before that
+    size_t skip_end;    // envelope,  end of the zero run being skipped
+} fp_rt_t;
+
+static bool is_barrier(filterpipe_op_t op) {
+    return (op == FILTERPIPE_NORM || op == FILTERPIPE_HPF);
+}
+
+static inline fp_v4_t v_splat(int32_t a) {
+    fp_v4_t v = { a, a, a, a };
+    return v;
+}
+
+static inline fp_v4_t v_load(const int32_t *p) {
+    fp_v4_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void v_store(int32_t *p, fp_v4_t v) {
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline fp_v4_t v_clamp(fp_v4_t x, fp_v4_t lo, fp_v4_t hi) {
+    fp_v4_t m = (x < lo);
+    x = (x & ~m) | (lo & m);
+    m = (x > hi);
+    return (x & ~m) | (hi & m);
+}
+
+static inline int32_t clamp_s(int32_t x, int32_t lo, int32_t hi) {
+    return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+// d[from..to) clamped to lo..hi,  what getFromGraphBuffer does to the graph after a command
+static void k_clamp(int32_t *d, size_t from, size_t to, int32_t lo, int32_t hi) {
+    fp_v4_t vlo = v_splat(lo), vhi = v_splat(hi);
+    size_t i = from;
+    for (; i + FP_LANES <= to; i += FP_LANES) {
+        v_store(d + i, v_clamp(v_load(d + i), vlo, vhi));
+    }
+    for (; i < to; i++) {
+        d[i] = clamp_s(d[i], lo, hi);
+    }
+}
+
+// zero the samples between down and up
+static void k_threshold(int32_t *d, size_t from, size_t to, int32_t up, int32_t down) {
+    fp_v4_t vup = v_splat(up), vdown = v_splat(down);
+    size_t i = from;
+    for (; i + FP_LANES <= to; i += FP_LANES) {
+        fp_v4_t x = v_load(d + i);
+        fp_v4_t m = (x <= vup) & (x >= vdown);
+        v_store(d + i, x & ~m);
+    }
+    for (; i < to; i++) {
+        if (d[i] <= up && d[i] >= down) {
+            d[i] = 0;
+        }
+    }
+}
+
+// removeSignalOffset on 8 bit samples,  taking out off and saturating
+static void k_hpf(int32_t *d, size_t from, size_t to, int32_t off) {
+    fp_v4_t v127 = v_splat(127), vm127 = v_splat(-127), vm128 = v_splat(-128), voff = v_splat(off);
+    size_t i = from;
+    for (; i + FP_LANES <= to; i += FP_LANES) {
+        fp_v4_t x = v_clamp(v_load(d + i), vm127, v127);
+        v_store(d + i, v_clamp(x - voff, vm128, v127));
+    }
+    for (; i < to; i++) {
+        d[i] = clamp_s(clamp_s(d[i], -127, 127) - off, -128, 127);
+    }
+}
+
+static void k_minmax(const int32_t *d, size_t from, size_t to, int32_t *lo, int32_t *hi) {
+    fp_v4_t vlo = v_splat(*lo), vhi = v_splat(*hi);
+    size_t i = from;
+    for (; i + FP_LANES <= to; i += FP_LANES) {
+        fp_v4_t x = v_load(d + i);
+        fp_v4_t m = (x < vlo);
+        vlo = (vlo & ~m) | (x & m);
+        m = (x > vhi);
+        vhi = (vhi & ~m) | (x & m);
+    }
+    for (int l = 0; l < FP_LANES; l++) {
+        if (vlo[l] < *lo) *lo = vlo[l];
+        if (vhi[l] > *hi) *hi = vhi[l];
+    }
+    for (; i < to; i++) {
+        if (d[i] < *lo) *lo = d[i];
+        if (d[i] > *hi) *hi = d[i];
+    }
+}
+
+static bool all_zero8(const int32_t *d) {
+    fp_v4_t x = v_load(d) | v_load(d + 4);
+    return (x[0] | x[1] | x[2] | x[3]) == 0;
+}
+
+// gather what a norm / hpf stage needs to know about its input,  samples from..to of it
+static void collect(fp_rt_t *s, const int32_t *d, size_t len, size_t from, size_t to) {
+    if (s->st.op == FILTERPIPE_NORM) {
+        k_minmax(d, MAX(from, 10), to, &s->min, &s->max);
+        return;
+    }
+
+    // hpf,  works on the samples as data hpf sees them,  clamped 8 bit
+    if (len < SIGNAL_MIN_SAMPLES) {
+        return;
+    }
+    uint8_t buf[FILTERPIPE_BLOCK];
+    for (size_t i = MAX(from, SIGNAL_IGNORE_FIRST_SAMPLES); i < to;) {
+        size_t n = MIN(to - i, sizeof(buf));
+        for (size_t j = 0; j < n; j++) {
+            buf[j] = clamp_s(d[i + j], -127, 127) + 128;
+        }
+        signalHistogramAdd(&s->hist, buf, n);
+        i += n;
+    }
+}
+
+// turn the gathered statistics into the stage parameters
+static void prepare(fp_rt_t *s, size_t len) {
+    if (s->st.op == FILTERPIPE_NORM) {
+        s->active = (len > 10 && s->max != s->min);
+    } else if (s->st.op == FILTERPIPE_HPF) {
+        s->off = (len >= SIGNAL_MIN_SAMPLES) ? signalOffsetHist(&s->hist) : 0;
+    }
+}
+
+// produce the samples s->pos .. end of a stage,  in place
+static void stage_process(fp_rt_t *s, int32_t *d, size_t len, size_t end) {
+
+    size_t i = s->pos;
+    if (i >= end) {
+        return;
+    }
+
+    switch (s->st.op) {
+
+        case FILTERPIPE_NORM: {
+            if (s->active) {
+                int32_t mid = (s->max + s->min) / 2;
+                double range = (double)s->max - s->min;
+                // exact, the quotient truncates like the integer division of data norm
+                for (size_t j = i; j < end; j++) {
+                    double q = ((double)(d[j] - mid) * 256.0) / range;
+                    q = (q > 128.0) ? 128.0 : (q < -128.0) ? -128.0 : q;
+                    d[j] = (int32_t)q;
+                }
+            }
+            k_clamp(d, i, end, -127, 127);
+            break;
+        }
+
+        case FILTERPIPE_HPF:
+            k_hpf(d, i, end, s->off);
+            break;
+
+        case FILTERPIPE_IIR: {
+            int shift = (s->st.arg1 <= 8) ? s->st.arg1 : 4;
+            int32_t reg = s->reg;
+            for (; i < end; i++) {
+                reg = reg - (reg >> shift) + d[i];
+                d[i] = reg >> shift;
+            }
+            s->reg = reg;
+            k_clamp(d, s->pos, end, -127, 127);
+            break;
+        }
+
+        case FILTERPIPE_DIRTHRESHOLD: {
+            int32_t up = s->st.arg1, down = s->st.arg2;
+
+            if (i == 0) {
+                // the first sample ends up as the second one,  computed ahead here
+                int32_t y0 = 0;
+                if (len > 1) {
+                    if (d[1] >= up && d[1] > d[0]) {
+                        y0 = 1;
+                    } else if (d[1] <= down && d[1] < d[0]) {
+                        y0 = -1;
+                    }
+                }
+                s->last = d[0];
+                s->y1 = 0;
+                d[0] = y0;
+                i++;
+            }
+
+            int32_t last = s->last, y = s->y1;
+            for (; i < end; i++) {
+                int32_t x = d[i];
+                // branch free, noisy samples make these hard to predict
+                bool rise = (x >= up) & (x > last);
+                bool fall = (x <= down) & (x < last);
+                y = (rise) ? 1 : (fall) ? -1 : y;
+                last = x;
+                d[i] = y;
+            }
+            s->last = last;
+            s->y1 = y;
+            break;
+        }
+
+        case FILTERPIPE_CTHRESHOLD: {
+            if (s->active == false) {
+                k_clamp(d, i, end, -127, 127);
+                break;
+            }
+
+            size_t tend = MIN(end + 2, len);
+            if (s->tpos < tend) {
+                k_threshold(d, s->tpos, tend, s->st.arg1, s->st.arg2);
+                s->tpos = tend;
+            }
+
+            // clean out spikes,  looking back at the cleaned samples and ahead at the thresholded ones
+            int32_t y1 = s->y1, y2 = s->y2;
+            for (; i < end; i++) {
+                int32_t y = d[i];
+                int32_t ahead = (i + 2 < len) ? d[i + 1] + d[i + 2] : 1;
+                bool spike = (i >= 2) & (y2 + y1 == 0) & (ahead == 0);
+                y = (spike) ? 0 : y;
+                y2 = y1;
+                y1 = y;
+                d[i] = clamp_s(y, -127, 127);
+            }
+            s->y1 = y1;
+            s->y2 = y2;
+            break;
+        }
+
+        case FILTERPIPE_ENVELOPE: {
+            if (s->active) {
+                for (; i < end; i++) {
+                    if (i + 8 >= len || i < s->skip_end) {
+                        continue;
+                    }
+                    if (all_zero8(d + i)) {
+                        s->skip_end = i + 8;
+                    } else {
+                        d[i] = 255;
+                    }
+                }
+            }
+            k_clamp(d, s->pos, end, -127, 127);
+            break;
+        }
+    }
+    s->pos = end;
+}
+
+// the final samples as 8 bit values,  into out8 and the signal histogram
+static void finish(const int32_t *d, size_t from, size_t to, uint8_t *out8, signal_hist_t *hist) {
+    uint8_t buf[FILTERPIPE_BLOCK];
+    for (size_t i = from; i < to;) {
+        size_t n = MIN(to - i, sizeof(buf));
+        uint8_t *dst = (out8) ? out8 + i : buf;
+        for (size_t j = 0; j < n; j++) {
+            dst[j] = clamp_s(d[i + j], -128, 127) + 128;
+        }
+        if (hist && i + n > SIGNAL_IGNORE_FIRST_SAMPLES) {
+            size_t skip = (i < SIGNAL_IGNORE_FIRST_SAMPLES) ? SIGNAL_IGNORE_FIRST_SAMPLES - i : 0;
+            signalHistogramAdd(hist, dst + skip, n - skip);
+        }
+        i += n;
+    }
+}
+
+void filterpipe_init(filterpipe_t *fp) {
+    memset(fp, 0, sizeof(filterpipe_t));
+}
+
+int filterpipe_add(filterpipe_t *fp, filterpipe_op_t op, int32_t arg1, int32_t arg2) {
+    if (fp->count >= FILTERPIPE_MAX_STAGES || (size_t)op >= ARRAYLEN(filterpipe_ops)) {
+        return PM3_EINVARG;
+    }
+    filterpipe_stage_t *st = &fp->stages[fp->count++];
+    st->op = op;
+    st->arg1 = arg1;
+    st->arg2 = arg2;
+    return PM3_SUCCESS;
+}
+
+bool filterpipe_has(const filterpipe_t *fp, filterpipe_op_t op) {
+    for (uint8_t i = 0; i < fp->count; i++) {
+        if (fp->stages[i].op == op) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// parse a chain like "norm, cthreshold:50:-20, envelope"
+int filterpipe_parse(filterpipe_t *fp, const char *str) {
+
+    filterpipe_init(fp);
+
+    char *copy = str_dup(str);
+    if (copy == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    int res = PM3_SUCCESS;
+    char *p = copy;
+    while (res == PM3_SUCCESS && *p) {
+
+        char *tok = p;
+        size_t n = strcspn(p, ",;");
+        p += n;
+        if (*p) {
+            *p++ = '\0';
+        }
+
+        while (isspace((unsigned char)*tok)) tok++;
+        char *e = tok + strlen(tok);
+        while (e > tok && isspace((unsigned char)e[-1])) *--e = '\0';
+        if (*tok == '\0') {
+            continue;
+        }
+
+        char *argstr = strchr(tok, ':');
+        if (argstr) {
+            *argstr++ = '\0';
+        }
+
+        int idx = -1;
+        for (size_t i = 0; i < ARRAYLEN(filterpipe_ops); i++) {
+            if (strcmp(tok, filterpipe_ops[i].name) == 0) {
+                idx = i;
+                break;
+            }
+        }
+        if (idx < 0) {
+            PrintAndLogEx(WARNING, "unknown filter `" _YELLOW_("%s") "`", tok);
+            res = PM3_EINVARG;
+            break;
+        }
+
+        long args[2] = {0};
+        uint8_t nargs = 0;
+        while (argstr && *argstr) {
+            char *endp = NULL;
+            long v = strtol(argstr, &endp, 10);
+            if (endp == argstr || (*endp != '\0' && *endp != ':') || nargs >= ARRAYLEN(args)) {
+                nargs = 0xFF;
+                break;
+            }
+            args[nargs++] = v;
+            argstr = (*endp == ':') ? endp + 1 : endp;
+        }
+
+        if (nargs != filterpipe_ops[idx].args) {
+            PrintAndLogEx(WARNING, "filter `" _YELLOW_("%s") "` takes %u argument(s)", tok, filterpipe_ops[idx].args);
+            res = PM3_EINVARG;
+            break;
+        }
+
+        filterpipe_op_t op = (filterpipe_op_t)idx;
+        if (op == FILTERPIPE_IIR && (args[0] < 0 || args[0] > 255)) {
+            PrintAndLogEx(WARNING, "iir factor out of range");
+            res = PM3_EINVARG;
+            break;
+        }
+        if ((op == FILTERPIPE_DIRTHRESHOLD || op == FILTERPIPE_CTHRESHOLD) &&
+                (args[0] < INT8_MIN || args[0] > INT8_MAX || args[1] < INT8_MIN || args[1] > INT8_MAX)) {
+            PrintAndLogEx(WARNING, "threshold out of range");
+            res = PM3_EINVARG;
+            break;
+        }
+
+        if (filterpipe_add(fp, op, args[0], args[1]) != PM3_SUCCESS) {
+            PrintAndLogEx(WARNING, "too many filters, max %u", FILTERPIPE_MAX_STAGES);
+            res = PM3_EINVARG;
+        }
+    }
+
+    free(copy);
+
+    if (res == PM3_SUCCESS && fp->count == 0) {
+        PrintAndLogEx(WARNING, "no filters given");
+        res = PM3_EINVARG;
+    }
+    return res;
+}
+
+void filterpipe_print(const filterpipe_t *fp) {
+    char line[512] = {0};
+    size_t len = 0;
+    uint8_t passes = 0;
+
+    for (uint8_t i = 0; i < fp->count; i++) {
+        const filterpipe_stage_t *st = &fp->stages[i];
+        int idx = st->op;
+
+        if (i == 0 || is_barrier(st->op)) {
+            passes++;
+        }
+        if (i == 0 && is_barrier(st->op)) {
+            passes++;
+        }
+
+        len += snprintf(line + len, sizeof(line) - len, "%s%s", (i) ? " -> " : "", filterpipe_ops[idx].name);
+        if (filterpipe_ops[idx].args == 1) {
+            len += snprintf(line + len, sizeof(line) - len, " %d", st->arg1);
+        } else if (filterpipe_ops[idx].args == 2) {
+            len += snprintf(line + len, sizeof(line) - len, " %d/%d", st->arg1, st->arg2);
+        }
+    }
+    PrintAndLogEx(INFO, "Pipeline... " _YELLOW_("%s") " ( %u pass%s )", line, passes, (passes == 1) ? "" : "es");
+}
+
+// Run the pipeline over data,  in place.
+// out8  (optional) the resulting samples + 128
+// hist  (optional) histogram of out8 past the first SIGNAL_IGNORE_FIRST_SAMPLES,  for computeSignalPropertiesHist
+int filterpipe_run(const filterpipe_t *fp, int32_t *data, size_t len, uint8_t *out8, signal_hist_t *hist) {
+
+    if (fp == NULL || fp->count == 0 || (data == NULL && len)) {
+        return PM3_EINVARG;
+    }
+
+    fp_rt_t *rt = calloc(fp->count, sizeof(fp_rt_t));
+    if (rt == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    for (uint8_t i = 0; i < fp->count; i++) {
+        fp_rt_t *s = &rt[i];
+        s->st = fp->stages[i];
+        s->lookahead = filterpipe_ops[s->st.op].lookahead;
+        s->min = INT32_MAX;
+        s->max = INT32_MIN;
+        s->hist.min = 255;
+        s->active = true;
+        if (s->st.op == FILTERPIPE_CTHRESHOLD) {
+            s->active = (len >= 5);
+        } else if (s->st.op == FILTERPIPE_ENVELOPE) {
+            s->active = (len >= 10);
+        }
+    }
+
+    if (hist) {
+        memset(hist, 0, sizeof(signal_hist_t));
+        hist->min = 255;
+    }
+
+    // a leading norm / hpf looks at the input first
+    if (is_barrier(rt[0].st.op)) {
+        collect(&rt[0], data, len, 0, len);
+    }
+
+    size_t first = 0;
+    while (first < fp->count) {
+
+        // one pass runs everything up to the next stage needing statistics,  which are gathered on the way
+        size_t last = first + 1;
+        while (last < fp->count && is_barrier(rt[last].st.op) == false) {
+            last++;
+        }
+        fp_rt_t *next = (last < fp->count) ? &rt[last] : NULL;
+
+        prepare(&rt[first], len);
+
+        size_t done = 0, e = 0;
+        do {
+            e = MIN(e + FILTERPIPE_BLOCK, len);
+
+            // each stage stops short of the end of what the one before produced by its look ahead
+            size_t avail = e;
+            for (size_t j = first; j < last; j++) {
+                size_t end = avail;
+                if (avail < len) {
+                    end = (avail > rt[j].lookahead) ? avail - rt[j].lookahead : 0;
+                }
+                stage_process(&rt[j], data, len, MAX(end, rt[j].pos));
+                avail = rt[j].pos;
+            }
+
+            if (next) {
+                collect(next, data, len, done, avail);
+            } else {
+                finish(data, done, avail, out8, hist);
+            }
+            done = avail;
+        } while (e < len);
+
+        first = last;
+    }
+
+    free(rt);
+    return PM3_SUCCESS;
+}
+
+// run the pipeline over the graph buffer and update the signal properties,  like the single commands do
+int filterpipe_run_graph(const filterpipe_t *fp) {
+
+    size_t len = g_GraphTraceLen;
+    int32_t *gb = (len) ? graph_write() : NULL;
+    if (len && gb == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    // data hpf hands the samples back as 8 bit ones,  which also resets the plot
+    bool has_hpf = filterpipe_has(fp, FILTERPIPE_HPF);
+    uint8_t *bits = NULL;
+    if (has_hpf) {
+        bits = calloc(MAX(len, 1), sizeof(uint8_t));
+        if (bits == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return PM3_EMALLOC;
+        }
+    }
+
+    signal_hist_t hist;
+    int res = filterpipe_run(fp, gb, len, bits, &hist);
+    if (res != PM3_SUCCESS) {
+        free(bits);
+        return res;
+    }
+
+    if (has_hpf) {
+        setGraphBuffer(bits, len);
+        free(bits);
+    }
+
+    // set signal properties low/high/mean/amplitude and is_noise detection
+    if (len >= SIGNAL_MIN_SAMPLES) {
+        computeSignalPropertiesHist(&hist);
+    } else {
+        computeSignalProperties(NULL, 0);
+    }
+
+    RepaintGraphWindow();
+    return PM3_SUCCESS;
+}
@@ -0,0 +1,73 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Fused sample filter pipeline
+//
+// A chain of the data norm / hpf / iir / dirthreshold / cthreshold / envelope
+// operations run over a sample buffer in as few passes as possible. The stages
+// work through the buffer block by block, each one trailing the previous one
+// by the samples it looks ahead, so a block is run through all of them while
+// it is still in cache. Only norm and hpf need statistics of their whole input,
+// they start a new pass and their statistics are gathered during the pass
+// before. The result is the same as running the single commands one by one.
+//-----------------------------------------------------------------------------
+
+#ifndef FILTERPIPE_H__
+#define FILTERPIPE_H__
+
+#include "common.h"
+#include "lfdemod.h"    // signal_hist_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FILTERPIPE_MAX_STAGES   16
+// samples per block
+#define FILTERPIPE_BLOCK        4096
+
+typedef enum {
+    FILTERPIPE_NORM = 0,        // norm                        scale max / min to +/-128
+    FILTERPIPE_HPF,             // hpf                         remove DC offset
+    FILTERPIPE_IIR,             // iir:<n>                     simple IIR low pass
+    FILTERPIPE_DIRTHRESHOLD,    // dirthreshold:<up>:<down>    directional threshold
+    FILTERPIPE_CTHRESHOLD,      // cthreshold:<up>:<down>      center threshold
+    FILTERPIPE_ENVELOPE,        // envelope                    square envelope
+} filterpipe_op_t;
+
+typedef struct {
+    filterpipe_op_t op;
+    int32_t arg1;
+    int32_t arg2;
+} filterpipe_stage_t;
+
+typedef struct {
+    filterpipe_stage_t stages[FILTERPIPE_MAX_STAGES];
+    uint8_t count;
+} filterpipe_t;
+
+void filterpipe_init(filterpipe_t *fp);
+int filterpipe_add(filterpipe_t *fp, filterpipe_op_t op, int32_t arg1, int32_t arg2);
+int filterpipe_parse(filterpipe_t *fp, const char *str);
+void filterpipe_print(const filterpipe_t *fp);
+bool filterpipe_has(const filterpipe_t *fp, filterpipe_op_t op);
+
+int filterpipe_run(const filterpipe_t *fp, int32_t *data, size_t len, uint8_t *out8, signal_hist_t *hist);
+int filterpipe_run_graph(const filterpipe_t *fp);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
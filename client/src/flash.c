@@ -693,6 +693,7 @@ int flash_write(flash_file_t *ctx) {
             length -= block_size;
             block++;
 
+            PrintAndLogFlush();
             if (len < ice3len) {
                 fprintf(stdout, "%c", ice3[len++]);
             } else {
@@ -18,6 +18,7 @@
 #include "graph.h"
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "ui.h"
 #include "proxgui.h"
 #include "util.h"           // param_get32ex
@@ -26,16 +27,482 @@
 #include "commonutil.h"     // Uint4bytetomemle
 
 
-int32_t g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-int32_t g_OperationBuffer[MAX_GRAPH_TRACE_LEN];
-int32_t g_OverlayBuffer[MAX_GRAPH_TRACE_LEN];
+struct graph_store_s {
+    uint32_t refcnt;
+    uint8_t width;          // bytes per sample,  1 (raw uint8, sample = raw - bias), 2 (int16) or 4 (int32)
+    int32_t bias;
+    size_t cap;             // samples
+    void *data;
+    // borrowed read-only samples (e.g. a mapped file), handed back with release() instead of freed
+    graph_release_fn release;
+    void *owner;
+    size_t owner_len;
+    // int32 copy of narrow samples handed out by graph_read(),  made on first use.  Narrow samples
+    // are never written in place,  so it stays valid as long as the store
+    int32_t *wide;
+};
+
+size_t g_GraphTraceLen;
+// samples of the main context
+static graph_store_t *graph_store;
+
+// plot window buffers,  the operation buffer starts out as the samples last set with setGraphBuffer
+static int32_t *operation_buffer;
+static size_t operation_cap;
+static graph_store_t *operation_src;
+static size_t operation_src_len;
+static int32_t *overlay_buffer;
+static size_t overlay_cap;
+
 bool    g_useOverlays = false;
-size_t  g_GraphTraceLen;
 buffer_savestate_t g_saveState_gb;
 marker_t g_MarkerA, g_MarkerB, g_MarkerC, g_MarkerD;
 marker_t *g_TempMarkers;
 uint8_t g_TempMarkerSize = 0;
 
+static pthread_mutex_t graph_mutex;
+static pthread_once_t graph_mutex_once = PTHREAD_ONCE_INIT;
+
+static void graph_mutex_init(void) {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&graph_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+// The plot window draws the main context from its own thread.  Sample storage is only
+// swapped or freed with this held,  so it stays valid while drawing.
+void graph_lock(void) {
+    pthread_once(&graph_mutex_once, graph_mutex_init);
+    pthread_mutex_lock(&graph_mutex);
+}
+
+void graph_unlock(void) {
+    pthread_mutex_unlock(&graph_mutex);
+}
+
+static graph_store_t *store_new(uint8_t width, size_t cap, int32_t bias) {
+    graph_store_t *st = calloc(1, sizeof(graph_store_t));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->data = calloc(MAX(cap, 1), width);
+    if (st->data == NULL) {
+        free(st);
+        return NULL;
+    }
+    st->refcnt = 1;
+    st->width = width;
+    st->bias = bias;
+    st->cap = cap;
+    return st;
+}
+
+static graph_store_t *store_ref(graph_store_t *st) {
+    if (st) {
+        __atomic_add_fetch(&st->refcnt, 1, __ATOMIC_SEQ_CST);
+    }
+    return st;
+}
+
+static void store_unref(graph_store_t *st) {
+    if (st && __atomic_sub_fetch(&st->refcnt, 1, __ATOMIC_SEQ_CST) == 0) {
+        if (st->release) {
+            st->release(st->owner, st->owner_len);
+        } else {
+            free(st->data);
+        }
+        free(st->wide);
+        free(st);
+    }
+}
+
+static bool store_shared(const graph_store_t *st) {
+    return __atomic_load_n(&st->refcnt, __ATOMIC_SEQ_CST) > 1;
+}
+
+static inline int32_t store_get(const graph_store_t *st, size_t i) {
+    switch (st->width) {
+        case 1:
+            return (int32_t)((const uint8_t *)st->data)[i] - st->bias;
+        case 2:
+            return ((const int16_t *)st->data)[i];
+        default:
+            return ((const int32_t *)st->data)[i];
+    }
+}
+
+// replace the samples of a context,  takes over the reference
+static void ctx_set_graph(demod_ctx_t *dctx, graph_store_t *st, size_t len) {
+    graph_lock();
+    graph_store_t *old = dctx->store;
+    dctx->store = st;
+    dctx->graph_len = len;
+    if (dctx->is_main) {
+        graph_store = st;
+        g_GraphTraceLen = len;
+    }
+    store_unref(old);
+    graph_unlock();
+}
+
+// Writable int32 samples of a context.  Narrow or shared samples are copied into a private
+// int32 store first,  with room for at least MAX_GRAPH_TRACE_LEN samples.
+int32_t *graph_write_ctx(demod_ctx_t *dctx) {
+    graph_lock();
+    graph_store_t *st = dctx->store;
+    size_t len = dctx->graph_len;
+    size_t cap = MAX(len, (size_t)MAX_GRAPH_TRACE_LEN);
+
+    if (st && st->width == sizeof(int32_t) && st->cap >= cap && store_shared(st) == false && st->release == NULL) {
+        graph_unlock();
+        return st->data;
+    }
+
+    graph_store_t *wide = store_new(sizeof(int32_t), cap, 0);
+    if (wide == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        graph_unlock();
+        return NULL;
+    }
+
+    if (st) {
+        int32_t *d = wide->data;
+        size_t n = MIN(len, st->cap);
+        if (st->wide) {
+            memcpy(d, st->wide, n * sizeof(int32_t));
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                d[i] = store_get(st, i);
+            }
+        }
+    }
+    ctx_set_graph(dctx, wide, len);
+    graph_unlock();
+    return wide->data;
+}
+
+int32_t *graph_write(void) {
+    demod_ctx_t dctx;
+    return graph_write_ctx(demod_ctx_main_get(&dctx));
+}
+
+// Read-only int32 samples of a context,  NULL when it has none.  Nothing is copied for int32
+// samples,  narrow ones get an int32 copy once,  kept with them.  Either way there is room for
+// at least MAX_GRAPH_TRACE_LEN samples.
+const int32_t *graph_read_ctx(const demod_ctx_t *dctx) {
+    graph_lock();
+    graph_store_t *st = dctx->store;
+    if (st == NULL) {
+        graph_unlock();
+        return NULL;
+    }
+
+    if (st->width == sizeof(int32_t) && st->cap >= MAX_GRAPH_TRACE_LEN) {
+        graph_unlock();
+        return st->data;
+    }
+
+    if (st->wide == NULL) {
+        int32_t *wide = calloc(MAX(st->cap, (size_t)MAX_GRAPH_TRACE_LEN), sizeof(int32_t));
+        if (wide == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            graph_unlock();
+            return NULL;
+        }
+        for (size_t i = 0; i < st->cap; i++) {
+            wide[i] = store_get(st, i);
+        }
+        st->wide = wide;
+    }
+    graph_unlock();
+    return st->wide;
+}
+
+const int32_t *graph_read(void) {
+    demod_ctx_t dctx;
+    return graph_read_ctx(demod_ctx_main_get(&dctx));
+}
+
+// make room for len samples,  up to GRAPH_TRACE_LEN_LIMIT.
+// returns the (possibly moved) writable samples or NULL
+int32_t *graph_reserve(size_t len) {
+    if (len > GRAPH_TRACE_LEN_LIMIT) {
+        return NULL;
+    }
+
+    int32_t *gb = graph_write();
+    if (gb == NULL) {
+        return NULL;
+    }
+
+    graph_store_t *st = graph_store;
+    if (len <= st->cap) {
+        return gb;
+    }
+
+    size_t cap = st->cap;
+    while (cap < len) {
+        cap *= 2;
+    }
+    cap = MIN(cap, GRAPH_TRACE_LEN_LIMIT);
+
+    graph_lock();
+    int32_t *d = realloc(st->data, cap * sizeof(int32_t));
+    if (d == NULL) {
+        graph_unlock();
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return NULL;
+    }
+    memset(d + st->cap, 0, (cap - st->cap) * sizeof(int32_t));
+    st->data = d;
+    st->cap = cap;
+    graph_unlock();
+    return d;
+}
+
+// replace the samples with len raw 8 bit ones,  sample = raw - bias.
+// returns them for filling in,  NULL when out of memory
+uint8_t *graph_reset_u8(size_t len, int bias) {
+    if (len > GRAPH_TRACE_LEN_LIMIT) {
+        return NULL;
+    }
+
+    graph_store_t *st = store_new(sizeof(uint8_t), len, bias);
+    if (st == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return NULL;
+    }
+    demod_ctx_t dctx;
+    ctx_set_graph(demod_ctx_main_get(&dctx), st, len);
+    return st->data;
+}
+
+// use len raw 8 bit samples owned by someone else as the graph,  sample = raw - bias.
+// They are never written to,  the first write goes to a private copy.  release(owner, owner_len)
+// is called once the last reference is gone,  or right away if this fails.
+int graph_adopt_u8(const uint8_t *samples, size_t len, int bias, graph_release_fn release, void *owner, size_t owner_len) {
+    if (samples == NULL || release == NULL || len > GRAPH_TRACE_LEN_LIMIT) {
+        if (release) {
+            release(owner, owner_len);
+        }
+        return PM3_EINVARG;
+    }
+
+    graph_store_t *st = calloc(1, sizeof(graph_store_t));
+    if (st == NULL) {
+        release(owner, owner_len);
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+    st->refcnt = 1;
+    st->width = sizeof(uint8_t);
+    st->bias = bias;
+    st->cap = len;
+    st->data = (void *)samples;
+    st->release = release;
+    st->owner = owner;
+    st->owner_len = owner_len;
+
+    demod_ctx_t dctx;
+    ctx_set_graph(demod_ctx_main_get(&dctx), st, len);
+    return PM3_SUCCESS;
+}
+
+// read one sample without making the int32 view
+int32_t graph_sample(size_t idx) {
+    int32_t v = 0;
+    graph_lock();
+    graph_store_t *st = graph_store;
+    if (st && idx < g_GraphTraceLen && idx < st->cap) {
+        v = store_get(st, idx);
+    }
+    graph_unlock();
+    return v;
+}
+
+// keep the samples as narrow as their values allow
+void graph_compact(void) {
+    graph_lock();
+    graph_store_t *st = graph_store;
+    size_t len = g_GraphTraceLen;
+    if (st == NULL || st->width != sizeof(int32_t) || len == 0 || len > st->cap) {
+        graph_unlock();
+        return;
+    }
+
+    const int32_t *d = st->data;
+    int32_t lo = d[0], hi = d[0];
+    for (size_t i = 1; i < len; i++) {
+        if (d[i] < lo) lo = d[i];
+        if (d[i] > hi) hi = d[i];
+    }
+
+    uint8_t width = sizeof(int32_t);
+    if ((int64_t)hi - lo <= 0xFF) {
+        width = sizeof(uint8_t);
+    } else if (lo >= INT16_MIN && hi <= INT16_MAX) {
+        width = sizeof(int16_t);
+    }
+
+    if (width == sizeof(int32_t)) {
+        graph_unlock();
+        return;
+    }
+
+    graph_store_t *c = store_new(width, len, (width == sizeof(uint8_t)) ? -lo : 0);
+    if (c == NULL) {
+        graph_unlock();
+        return;
+    }
+
+    if (width == sizeof(uint8_t)) {
+        uint8_t *out = c->data;
+        for (size_t i = 0; i < len; i++) {
+            out[i] = (uint8_t)(d[i] - lo);
+        }
+    } else {
+        int16_t *out = c->data;
+        for (size_t i = 0; i < len; i++) {
+            out[i] = (int16_t)d[i];
+        }
+    }
+    demod_ctx_t dctx;
+    ctx_set_graph(demod_ctx_main_get(&dctx), c, len);
+    graph_unlock();
+}
+
+// allocate a private demod context, with no samples and an empty demod buffer
+int demod_ctx_init(demod_ctx_t *dctx) {
+    memset(dctx, 0, sizeof(demod_ctx_t));
+    dctx->demod = calloc(MAX_DEMOD_BUF_LEN, sizeof(uint8_t));
+    if (dctx->demod == NULL) {
+        return PM3_EMALLOC;
+    }
+    return PM3_SUCCESS;
+}
+
+void demod_ctx_free(demod_ctx_t *dctx) {
+    if (dctx->is_main) {
+        return;
+    }
+    demod_ctx_drop_graph(dctx);
+    free(dctx->demod);
+    memset(dctx, 0, sizeof(demod_ctx_t));
+}
+
+// dst shares the samples of src,  whichever of them writes first gets its own copy
+void demod_ctx_share_graph(demod_ctx_t *dst, const demod_ctx_t *src) {
+    graph_lock();
+    if (dst->store != src->store) {
+        ctx_set_graph(dst, store_ref(src->store), src->graph_len);
+    } else {
+        dst->graph_len = src->graph_len;
+    }
+    graph_unlock();
+}
+
+void demod_ctx_drop_graph(demod_ctx_t *dctx) {
+    ctx_set_graph(dctx, NULL, 0);
+}
+
+bool demod_ctx_graph_equal(const demod_ctx_t *a, const demod_ctx_t *b) {
+    if (a->graph_len != b->graph_len) {
+        return false;
+    }
+    if (a->store == b->store || a->graph_len == 0) {
+        return true;
+    }
+    if (a->store == NULL || b->store == NULL || a->store->cap < a->graph_len || b->store->cap < b->graph_len) {
+        return false;
+    }
+
+    graph_lock();
+    bool equal = true;
+    for (size_t i = 0; i < a->graph_len && equal; i++) {
+        equal = (store_get(a->store, i) == store_get(b->store, i));
+    }
+    graph_unlock();
+    return equal;
+}
+
+// copy samples and demod state,  the samples are shared until written
+void demod_ctx_copy(demod_ctx_t *dst, const demod_ctx_t *src) {
+    demod_ctx_share_graph(dst, src);
+    memcpy(dst->demod, src->demod, src->demod_len);
+    dst->demod_len = src->demod_len;
+    dst->demod_clock = src->demod_clock;
+    dst->demod_start_idx = src->demod_start_idx;
+}
+
+// Borrow the main context,  the globals,  to call the *_ctx functions on.  The samples are
+// swapped in place,  the demod state is written back with demod_ctx_main_put().
+// Main thread only,  nothing else may touch the globals until then.
+demod_ctx_t *demod_ctx_main_get(demod_ctx_t *dctx) {
+    dctx->store = graph_store;
+    dctx->graph_len = g_GraphTraceLen;
+    dctx->demod = g_DemodBuffer;
+    dctx->demod_len = g_DemodBufferLen;
+    dctx->demod_clock = g_DemodClock;
+    dctx->demod_start_idx = g_DemodStartIdx;
+    dctx->is_main = true;
+    return dctx;
+}
+
+void demod_ctx_main_put(const demod_ctx_t *dctx) {
+    g_GraphTraceLen = dctx->graph_len;
+    g_DemodBufferLen = dctx->demod_len;
+    g_DemodClock = dctx->demod_clock;
+    g_DemodStartIdx = dctx->demod_start_idx;
+}
+
+// run a demodulator on the main context
+int demod_ctx_run_main(demod_fn_t demod, bool verbose) {
+    demod_ctx_t dctx;
+    int res = demod(demod_ctx_main_get(&dctx), verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+// grow a plot window buffer to cover the main context samples
+static int32_t *plot_buffer_fit(int32_t **buf, size_t *cap) {
+    size_t need = MAX(g_GraphTraceLen, (size_t)MAX_GRAPH_TRACE_LEN);
+    if (*cap < need) {
+        int32_t *tmp = realloc(*buf, need * sizeof(int32_t));
+        if (tmp == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return *buf;
+        }
+        memset(tmp + *cap, 0, (need - *cap) * sizeof(int32_t));
+        *buf = tmp;
+        *cap = need;
+    }
+    return *buf;
+}
+
+int32_t *graph_operation_buffer(void) {
+    graph_lock();
+    int32_t *buf = plot_buffer_fit(&operation_buffer, &operation_cap);
+    if (buf && operation_src) {
+        size_t n = MIN(operation_src_len, MIN(operation_src->cap, operation_cap));
+        for (size_t i = 0; i < n; i++) {
+            buf[i] = store_get(operation_src, i);
+        }
+        store_unref(operation_src);
+        operation_src = NULL;
+    }
+    graph_unlock();
+    return buf;
+}
+
+int32_t *graph_overlay_buffer(void) {
+    graph_lock();
+    int32_t *buf = plot_buffer_fit(&overlay_buffer, &overlay_cap);
+    graph_unlock();
+    return buf;
+}
+
 /* write a manchester bit to the graph
 */
 void AppendGraph(bool redraw, uint16_t clock, int bit) {
@@ -45,26 +512,31 @@ void AppendGraph(bool redraw, uint16_t clock, int bit) {
 
     // overflow/underflow safe checks ... Assumptions:
     //     _Assert(g_GraphTraceLen >= 0);
-    //     _Assert(g_GraphTraceLen <= MAX_GRAPH_TRACE_LEN);
+    //     _Assert(g_GraphTraceLen <= GRAPH_TRACE_LEN_LIMIT);
     // If this occurs, allow partial rendering, up to the last sample...
-    if ((MAX_GRAPH_TRACE_LEN - g_GraphTraceLen) < half) {
+    if ((GRAPH_TRACE_LEN_LIMIT - g_GraphTraceLen) < half) {
         PrintAndLogEx(DEBUG, "WARNING: AppendGraph() - Request exceeds max graph length");
-        end = MAX_GRAPH_TRACE_LEN - g_GraphTraceLen;
+        end = GRAPH_TRACE_LEN_LIMIT - g_GraphTraceLen;
         half = end;
     }
-    if ((MAX_GRAPH_TRACE_LEN - g_GraphTraceLen) < end) {
+    if ((GRAPH_TRACE_LEN_LIMIT - g_GraphTraceLen) < end) {
         PrintAndLogEx(DEBUG, "WARNING: AppendGraph() - Request exceeds max graph length");
-        end = MAX_GRAPH_TRACE_LEN - g_GraphTraceLen;
+        end = GRAPH_TRACE_LEN_LIMIT - g_GraphTraceLen;
+    }
+
+    int32_t *gb = graph_reserve(g_GraphTraceLen + end);
+    if (gb == NULL) {
+        return;
     }
 
     //set first half the clock bit (all 1's or 0's for a 0 or 1 bit)
     for (i = 0; i < half; ++i) {
-        g_GraphBuffer[g_GraphTraceLen++] = bit;
+        gb[g_GraphTraceLen++] = bit;
     }
 
     //set second half of the clock bit (all 0's or 1's for a 0 or 1 bit)
     for (; i < end; ++i) {
-        g_GraphBuffer[g_GraphTraceLen++] = bit ^ 1;
+        gb[g_GraphTraceLen++] = bit ^ 1;
     }
 
     if (redraw) {
@@ -76,11 +548,20 @@ void AppendGraph(bool redraw, uint16_t clock, int bit) {
 size_t ClearGraph(bool redraw) {
     size_t gtl = g_GraphTraceLen;
 
-    memset(g_GraphBuffer, 0x00, g_GraphTraceLen);
-    memset(g_OperationBuffer, 0x00, g_GraphTraceLen);
-    memset(g_OverlayBuffer, 0x00, g_GraphTraceLen);
+    demod_ctx_t dctx;
+    demod_ctx_drop_graph(demod_ctx_main_get(&dctx));
+
+    graph_lock();
+    store_unref(operation_src);
+    operation_src = NULL;
+    free(operation_buffer);
+    operation_buffer = NULL;
+    operation_cap = 0;
+    free(overlay_buffer);
+    overlay_buffer = NULL;
+    overlay_cap = 0;
+    graph_unlock();
 
-    g_GraphTraceLen = 0;
     g_GraphStart = 0;
     g_GraphStop = 0;
     g_DemodBufferLen = 0;
@@ -106,48 +587,98 @@ void setGraphBuffer(const uint8_t *src, size_t size) {
 
     ClearGraph(false);
 
-    if (size > MAX_GRAPH_TRACE_LEN) {
-        size = MAX_GRAPH_TRACE_LEN;
+    if (size > GRAPH_TRACE_LEN_LIMIT) {
+        size = GRAPH_TRACE_LEN_LIMIT;
     }
 
-    for (size_t i = 0; i < size; ++i) {
-        g_GraphBuffer[i] = src[i] - 128;
-        g_OperationBuffer[i] = src[i] - 128;
+    uint8_t *samples = graph_reset_u8(size, 128);
+    if (samples == NULL) {
+        return;
     }
+    memcpy(samples, src, size);
+
+    graph_lock();
+    store_unref(operation_src);
+    operation_src = store_ref(graph_store);
+    operation_src_len = size;
+    graph_unlock();
 
     remove_temporary_markers();
-    g_GraphTraceLen = size;
     RepaintGraphWindow();
 }
 
-// This function assumes that the length of dest array >= g_GraphTraceLen.
-// If the length of dest array is less than g_GraphTraceLen, use getFromGraphBufferEx(dest, maxLen) instead.
+// Samples as 8 bit values,  at most MAX_GRAPH_TRACE_LEN of them (what the demodulators look at).
+// This function assumes that the length of dest array >= MIN(g_GraphTraceLen, MAX_GRAPH_TRACE_LEN).
+// If the length of dest array is less than that, use getFromGraphBufferEx(dest, maxLen) instead.
 size_t getFromGraphBuffer(uint8_t *dest) {
-    return getFromGraphBufferEx(dest, g_GraphTraceLen);
+    return getFromGraphBufferEx(dest, MAX_GRAPH_TRACE_LEN);
 }
 
 size_t getFromGraphBufferEx(uint8_t *dest, size_t maxLen) {
+    demod_ctx_t dctx;
+    size_t n = getFromGraphBufferEx_ctx(demod_ctx_main_get(&dctx), dest, maxLen);
+    demod_ctx_main_put(&dctx);
+    return n;
+}
+
+size_t getFromGraphBuffer_ctx(demod_ctx_t *dctx, uint8_t *dest) {
+    return getFromGraphBufferEx_ctx(dctx, dest, MAX_GRAPH_TRACE_LEN);
+}
+
+size_t getFromGraphBufferEx_ctx(demod_ctx_t *dctx, uint8_t *dest, size_t maxLen) {
     if (dest == NULL) {
         return 0;
     }
 
-    if (g_GraphTraceLen == 0) {
+    if (dctx->graph_len == 0) {
+        return 0;
+    }
+
+    maxLen = (maxLen < dctx->graph_len) ? maxLen : dctx->graph_len;
+
+    graph_lock();
+    graph_store_t *st = dctx->store;
+    if (st == NULL || st->cap < maxLen) {
+        graph_write_ctx(dctx);
+        st = dctx->store;
+    }
+
+    if (st == NULL) {
+        graph_unlock();
         return 0;
     }
 
     size_t i;
-    maxLen = (maxLen < g_GraphTraceLen) ? maxLen : g_GraphTraceLen;
-    for (i = 0; i < maxLen; ++i) {
-        //trim
-        if (g_GraphBuffer[i] > 127) {
-            g_GraphBuffer[i] = 127;
+    if (st->width == sizeof(uint8_t)) {
+        // raw samples,  nothing to trim in the graph itself
+        const uint8_t *raw = st->data;
+        int32_t bias = st->bias;
+        for (i = 0; i < maxLen; ++i) {
+            int32_t v = (int32_t)raw[i] - bias;
+            if (v > 127) v = 127;
+            if (v < -127) v = -127;
+            dest[i] = (uint8_t)(v + 128);
         }
-
-        if (g_GraphBuffer[i] < -127) {
-            g_GraphBuffer[i] = -127;
+    } else {
+        int32_t *gb = NULL;
+        for (i = 0; i < maxLen; ++i) {
+            int32_t v = store_get(st, i);
+
+            //trim
+            if (v > 127 || v < -127) {
+                v = (v > 127) ? 127 : -127;
+                if (gb == NULL) {
+                    gb = graph_write_ctx(dctx);
+                    st = dctx->store;
+                }
+                if (gb) {
+                    gb[i] = v;
+                }
+            }
+            dest[i] = (uint8_t)(v + 128);
         }
-        dest[i] = (uint8_t)(g_GraphBuffer[i] + 128);
     }
+    graph_unlock();
     return i;
 }
 
@@ -166,10 +697,15 @@ size_t getGraphBufferChunk(uint8_t *dest, size_t start, size_t end) {
         return 0;
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return 0;
+    }
+
     size_t i, value;
     end = (end < g_GraphTraceLen) ? end : g_GraphTraceLen;
     for (i = 0; i < (end - start); i++) {
-        value = g_GraphBuffer[start + i];
+        value = gb[start + i];
 
         //Trim the data to fit into an uint8_t
         if (value > 127) {
@@ -195,13 +731,26 @@ bool HasGraphData(void) {
 }
 
 bool isGraphBitstream(void) {
+    demod_ctx_t dctx;
+    return isGraphBitstream_ctx(demod_ctx_main_get(&dctx));
+}
+
+bool isGraphBitstream_ctx(demod_ctx_t *dctx) {
+    graph_lock();
+    graph_store_t *st = dctx->store;
+    size_t n = (st) ? MIN(dctx->graph_len, st->cap) : 0;
+
     // convert to bitstream if necessary
-    for (int i = 0; i < g_GraphTraceLen; i++) {
-        if (g_GraphBuffer[i] > 1 || g_GraphBuffer[i] < 0) {
-            return false;
+    bool bitstream = true;
+    for (size_t i = 0; i < n; i++) {
+        int32_t v = store_get(st, i);
+        if (v > 1 || v < 0) {
+            bitstream = false;
+            break;
         }
     }
-    return true;
+    graph_unlock();
+    return bitstream;
 }
 
 void convertGraphFromBitstream(void) {
@@ -209,23 +758,38 @@ void convertGraphFromBitstream(void) {
 }
 
 void convertGraphFromBitstreamEx(int hi, int low) {
-    for (int i = 0; i < g_GraphTraceLen; i++) {
+    demod_ctx_t dctx;
+    convertGraphFromBitstreamEx_ctx(demod_ctx_main_get(&dctx), hi, low);
+    demod_ctx_main_put(&dctx);
+}
 
-        if (g_GraphBuffer[i] == hi)
-            g_GraphBuffer[i] = 127;
-        else if (g_GraphBuffer[i] == low)
-            g_GraphBuffer[i] = -127;
+void convertGraphFromBitstream_ctx(demod_ctx_t *dctx) {
+    convertGraphFromBitstreamEx_ctx(dctx, 1, 0);
+}
+
+void convertGraphFromBitstreamEx_ctx(demod_ctx_t *dctx, int hi, int low) {
+    int32_t *gb = graph_write_ctx(dctx);
+    if (gb == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < dctx->graph_len; i++) {
+
+        if (gb[i] == hi)
+            gb[i] = 127;
+        else if (gb[i] == low)
+            gb[i] = -127;
         else
-            g_GraphBuffer[i] = 0;
+            gb[i] = 0;
     }
 
-    uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
+    uint8_t *bits = calloc(dctx->graph_len, sizeof(uint8_t));
     if (bits == NULL) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -235,11 +799,20 @@ void convertGraphFromBitstreamEx(int hi, int low) {
     // set signal properties low/high/mean/amplitude and is_noise detection
     computeSignalProperties(bits, size);
     free(bits);
-    RepaintGraphWindow();
+    if (dctx->is_main) {
+        RepaintGraphWindow();
+    }
 }
 
 // Get or auto-detect ask clock rate
 int GetAskClock(const char *str, bool verbose) {
+    demod_ctx_t dctx;
+    int res = GetAskClock_ctx(demod_ctx_main_get(&dctx), str, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int GetAskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose) {
     if (getSignalProperties()->isnoise) {
         return -1;
     }
@@ -257,7 +830,7 @@ int GetAskClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -272,7 +845,7 @@ int GetAskClock(const char *str, bool verbose) {
     }
 
     if (clock1 > 0) {
-        setClockGrid(clock1, idx);
+        setClockGrid_ctx(dctx, clock1, idx);
     }
     // Only print this message if we're not looping something
     if (verbose || g_debugMode) {
@@ -284,6 +857,13 @@ int GetAskClock(const char *str, bool verbose) {
 }
 
 int GetPskCarrier(bool verbose) {
+    demod_ctx_t dctx;
+    int res = GetPskCarrier_ctx(demod_ctx_main_get(&dctx), verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int GetPskCarrier_ctx(demod_ctx_t *dctx, bool verbose) {
     if (getSignalProperties()->isnoise) {
         return -1;
     }
@@ -294,7 +874,7 @@ int GetPskCarrier(bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -321,6 +901,13 @@ int GetPskCarrier(bool verbose) {
 }
 
 int GetPskClock(const char *str, bool verbose) {
+    demod_ctx_t dctx;
+    int res = GetPskClock_ctx(demod_ctx_main_get(&dctx), str, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int GetPskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose) {
 
     if (getSignalProperties()->isnoise) {
         return -1;
@@ -338,7 +925,7 @@ int GetPskClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -350,7 +937,7 @@ int GetPskClock(const char *str, bool verbose) {
     clock1 = DetectPSKClock(bits, size, 0, &firstPhaseShiftLoc, &curPhase, &fc);
 
     if (clock1 >= 0) {
-        setClockGrid(clock1, firstPhaseShiftLoc);
+        setClockGrid_ctx(dctx, clock1, firstPhaseShiftLoc);
     }
 
     // Only print this message if we're not looping something
@@ -363,6 +950,13 @@ int GetPskClock(const char *str, bool verbose) {
 }
 
 int GetNrzClock(const char *str, bool verbose) {
+    demod_ctx_t dctx;
+    int res = GetNrzClock_ctx(demod_ctx_main_get(&dctx), str, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int GetNrzClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose) {
 
     if (getSignalProperties()->isnoise) {
         return -1;
@@ -380,7 +974,7 @@ int GetNrzClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -389,7 +983,7 @@ int GetNrzClock(const char *str, bool verbose) {
 
     size_t clkStartIdx = 0;
     clock1 = DetectNRZClock(bits, size, 0, &clkStartIdx);
-    setClockGrid(clock1, clkStartIdx);
+    setClockGrid_ctx(dctx, clock1, clkStartIdx);
     // Only print this message if we're not looping something
     if (verbose) {
         PrintAndLogEx(SUCCESS, "Auto-detected clock rate: %d", clock1);
@@ -402,6 +996,13 @@ int GetNrzClock(const char *str, bool verbose) {
 //by marshmellow
 //attempt to detect the field clock and bit clock for FSK
 int GetFskClock(const char *str, bool verbose) {
+    demod_ctx_t dctx;
+    int res = GetFskClock_ctx(demod_ctx_main_get(&dctx), str, verbose);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+int GetFskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose) {
 
     int clock1 = param_get32ex(str, 0, 0, 10);
     if (clock1 != 0) {
@@ -411,7 +1012,7 @@ int GetFskClock(const char *str, bool verbose) {
     uint8_t fc1 = 0, fc2 = 0, rf1 = 0;
     int firstClockEdge = 0;
 
-    if (fskClocks(&fc1, &fc2, &rf1, &firstClockEdge) == false) {
+    if (fskClocks_ctx(dctx, &fc1, &fc2, &rf1, &firstClockEdge) == false) {
         return 0;
     }
 
@@ -420,7 +1021,7 @@ int GetFskClock(const char *str, bool verbose) {
             PrintAndLogEx(SUCCESS, "Detected Field Clocks: FC/%d, FC/%d - Bit Clock: RF/%d", fc1, fc2, rf1);
         }
 
-        setClockGrid(rf1, firstClockEdge);
+        setClockGrid_ctx(dctx, rf1, firstClockEdge);
         return rf1;
     }
 
@@ -430,6 +1031,13 @@ int GetFskClock(const char *str, bool verbose) {
 }
 
 bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge) {
+    demod_ctx_t dctx;
+    bool res = fskClocks_ctx(demod_ctx_main_get(&dctx), fc1, fc2, rf1, firstClockEdge);
+    demod_ctx_main_put(&dctx);
+    return res;
+}
+
+bool fskClocks_ctx(demod_ctx_t *dctx, uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge) {
 
     if (getSignalProperties()->isnoise) {
         return false;
@@ -441,7 +1049,7 @@ bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge) {
         return false;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBuffer_ctx(dctx, bits);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -648,3 +1256,46 @@ size_t restore_buffer8(buffer_savestate_t saveState, uint8_t *dest) {
 
     return index;
 }
+
+// Snapshot of the samples.  Nothing is copied,  the samples are shared with the snapshot until
+// they are written.  Release it with restore_graph_buffer() or free_graph_buffer().
+buffer_savestate_t save_graph_buffer(void) {
+    demod_ctx_t dctx;
+    return save_graph_buffer_ctx(demod_ctx_main_get(&dctx));
+}
+
+buffer_savestate_t save_graph_buffer_ctx(demod_ctx_t *dctx) {
+    graph_lock();
+    buffer_savestate_t bst = {
+        .type = (sizeof(int32_t) >> 8),
+        .bufferSize = dctx->graph_len,
+        .store = store_ref(dctx->store),
+    };
+    graph_unlock();
+    return bst;
+}
+
+// put the snapshot samples back,  length included,  and release the snapshot
+size_t restore_graph_buffer(buffer_savestate_t *saveState) {
+    demod_ctx_t dctx;
+    return restore_graph_buffer_ctx(demod_ctx_main_get(&dctx), saveState);
+}
+
+size_t restore_graph_buffer_ctx(demod_ctx_t *dctx, buffer_savestate_t *saveState) {
+    if (saveState->type != (sizeof(int32_t) >> 8)) {
+        PrintAndLogEx(WARNING, "Invalid Save State type! Expected int32_t");
+        PrintAndLogEx(WARNING, "Buffer not modified!\n");
+        return 0;
+    }
+
+    ctx_set_graph(dctx, saveState->store, saveState->bufferSize);
+    saveState->store = NULL;
+    return saveState->bufferSize;
+}
+
+void free_graph_buffer(buffer_savestate_t *saveState) {
+    graph_lock();
+    store_unref(saveState->store);
+    saveState->store = NULL;
+    graph_unlock();
+}
@@ -32,6 +32,7 @@ typedef struct {
     const uint8_t  padding;    // The amount of padding at the end of the buffer, if needed
     uint32_t       offset;     // (optional) Any offset the buffer needs after restoring
     uint32_t       clock;      // (optional) Clock data for the buffer
+    struct graph_store_s *store; // graph snapshots only, the shared sample storage
 } buffer_savestate_t;
 
 typedef struct {
@@ -39,16 +40,46 @@ typedef struct {
     char label[30];
 } marker_t;
 
+// Sample storage of the graph.
+// Samples are kept as narrow as they came in, a raw 8 bit capture takes one byte per sample. The storage
+// is reference counted, snapshots (save_graph_buffer) and demod context copies share it and it is only
+// copied when someone writes to it. Code working on int32 samples gets them once per operation, with
+// graph_read() to look at them or graph_write() to change them.
+typedef struct graph_store_s graph_store_t;
+typedef void (*graph_release_fn)(void *owner, size_t owner_len);
+
+// Samples and demodulation results a demodulator works on.
+// The commands and the plot window use the main context, the graph samples, g_GraphTraceLen,
+// g_DemodBuffer, g_DemodBufferLen, g_DemodClock and g_DemodStartIdx.  The demodulators `lf search` and
+// `lf t55xx detect` run in parallel take the context as an argument instead (the *_ctx functions),
+// worker threads pass a private one,  everyone else borrows the main one with demod_ctx_main_get().
+typedef struct {
+    graph_store_t *store;       // samples
+    size_t graph_len;
+    uint8_t *demod;             // demodulated bits, one per byte, MAX_DEMOD_BUF_LEN
+    size_t demod_len;
+    int demod_clock;
+    int32_t demod_start_idx;
+    bool is_main;               // borrowed from the globals, the only one plotted
+} demod_ctx_t;
+
+typedef int (*demod_fn_t)(demod_ctx_t *dctx, bool verbose);
+
 void AppendGraph(bool redraw, uint16_t clock, int bit);
 size_t ClearGraph(bool redraw);
 bool HasGraphData(void);
 void setGraphBuffer(const uint8_t *src, size_t size);
 size_t getFromGraphBuffer(uint8_t *dest);
 size_t getFromGraphBufferEx(uint8_t *dest, size_t maxLen);
+size_t getFromGraphBuffer_ctx(demod_ctx_t *dctx, uint8_t *dest);
+size_t getFromGraphBufferEx_ctx(demod_ctx_t *dctx, uint8_t *dest, size_t maxLen);
 size_t getGraphBufferChunk(uint8_t *dest, size_t start, size_t end);
 void convertGraphFromBitstream(void);
 void convertGraphFromBitstreamEx(int hi, int low);
 bool isGraphBitstream(void);
+void convertGraphFromBitstream_ctx(demod_ctx_t *dctx);
+void convertGraphFromBitstreamEx_ctx(demod_ctx_t *dctx, int hi, int low);
+bool isGraphBitstream_ctx(demod_ctx_t *dctx);
 
 int GetAskClock(const char *str, bool verbose);
 int GetPskClock(const char *str, bool verbose);
@@ -56,6 +87,12 @@ int GetPskCarrier(bool verbose);
 int GetNrzClock(const char *str, bool verbose);
 int GetFskClock(const char *str, bool verbose);
 bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge);
+int GetAskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose);
+int GetPskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose);
+int GetPskCarrier_ctx(demod_ctx_t *dctx, bool verbose);
+int GetNrzClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose);
+int GetFskClock_ctx(demod_ctx_t *dctx, const char *str, bool verbose);
+bool fskClocks_ctx(demod_ctx_t *dctx, uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge);
 
 extern void add_temporary_marker(uint32_t position, const char *label);
 extern void remove_temporary_markers(void);
@@ -67,15 +104,49 @@ size_t restore_buffer32(buffer_savestate_t saveState, uint32_t *dest);
 size_t restore_bufferS32(buffer_savestate_t saveState, int32_t *dest);
 size_t restore_buffer8(buffer_savestate_t saveState, uint8_t *dest);
 
+// samples the demodulators look at,  and what legacy code filling graph_write() in place may write
 #define MAX_GRAPH_TRACE_LEN (40000 * 32)
+// longest capture the graph can hold
+#define GRAPH_TRACE_LEN_LIMIT ((size_t)512 * 1024 * 1024)
 #define GRAPH_SAVE 1
 #define GRAPH_RESTORE 0
 
-extern int32_t g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-extern int32_t g_OperationBuffer[MAX_GRAPH_TRACE_LEN];
-extern int32_t g_OverlayBuffer[MAX_GRAPH_TRACE_LEN];
+extern size_t g_GraphTraceLen;
+
+int demod_ctx_init(demod_ctx_t *dctx);
+void demod_ctx_free(demod_ctx_t *dctx);
+void demod_ctx_copy(demod_ctx_t *dst, const demod_ctx_t *src);
+demod_ctx_t *demod_ctx_main_get(demod_ctx_t *dctx);
+void demod_ctx_main_put(const demod_ctx_t *dctx);
+int demod_ctx_run_main(demod_fn_t demod, bool verbose);
+void demod_ctx_share_graph(demod_ctx_t *dst, const demod_ctx_t *src);
+void demod_ctx_drop_graph(demod_ctx_t *dctx);
+bool demod_ctx_graph_equal(const demod_ctx_t *a, const demod_ctx_t *b);
+
+// The samples as int32,  valid until the samples are replaced or written by someone else.
+// graph_write() makes them private first,  call it after save_graph_buffer(),  not before.
+const int32_t *graph_read(void);
+const int32_t *graph_read_ctx(const demod_ctx_t *dctx);
+int32_t *graph_write(void);
+int32_t *graph_write_ctx(demod_ctx_t *dctx);
+int32_t *graph_reserve(size_t len);
+uint8_t *graph_reset_u8(size_t len, int bias);
+int graph_adopt_u8(const uint8_t *samples, size_t len, int bias, graph_release_fn release, void *owner, size_t owner_len);
+int32_t graph_sample(size_t idx);
+void graph_compact(void);
+void graph_lock(void);
+void graph_unlock(void);
+
+buffer_savestate_t save_graph_buffer(void);
+size_t restore_graph_buffer(buffer_savestate_t *saveState);
+void free_graph_buffer(buffer_savestate_t *saveState);
+buffer_savestate_t save_graph_buffer_ctx(demod_ctx_t *dctx);
+size_t restore_graph_buffer_ctx(demod_ctx_t *dctx, buffer_savestate_t *saveState);
+
+// the plot window's operation and overlay buffers, allocated on first use. Get them once per operation
+int32_t *graph_operation_buffer(void);
+int32_t *graph_overlay_buffer(void);
 extern bool    g_useOverlays;
-extern size_t  g_GraphTraceLen;
 
 extern marker_t g_MarkerA, g_MarkerB, g_MarkerC, g_MarkerD;
 extern marker_t *g_TempMarkers;
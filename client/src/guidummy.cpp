@@ -17,11 +17,13 @@
 //-----------------------------------------------------------------------------
 
 #include <stdio.h>
+#include "ui.h"   // PrintAndLogFlush
 
 extern "C" void ShowGraphWindow(void) {
     static int warned = 0;
 
     if (!warned) {
+        PrintAndLogFlush();
         printf("No GUI in this build!\n");
         warned = 1;
     }
@@ -34,6 +36,7 @@ extern "C" void ShowPictureWindow(char *fn, int len) {
     static int warned = 0;
 
     if (!warned) {
+        PrintAndLogFlush();
         printf("No GUI in this build!\n");
         warned = 1;
     }
@@ -42,6 +45,7 @@ extern "C" void ShowBase64PictureWindow(char *b64) {
     static int warned = 0;
 
     if (!warned) {
+        PrintAndLogFlush();
         printf("No GUI in this build!\n");
         warned = 1;
     }
@@ -0,0 +1,398 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Streaming (incremental) LF demodulation
+//-----------------------------------------------------------------------------
+#include "lfstream.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "ui.h"
+#include "util.h"
+#include "lfdemod.h"
+#include "commonutil.h"
+
+static const char *lfstream_mod_names[] = { "ask", "fsk" };
+
+int lfstream_mod_from_str(const char *str, lfstream_mod_t *mod) {
+    for (size_t i = 0; i < ARRAYLEN(lfstream_mod_names); i++) {
+        if (strcmp(lfstream_mod_names[i], str) == 0) {
+            *mod = (lfstream_mod_t)i;
+            return PM3_SUCCESS;
+        }
+    }
+    return PM3_EINVARG;
+}
+
+const char *lfstream_mod_to_str(lfstream_mod_t mod) {
+    if ((size_t)mod >= ARRAYLEN(lfstream_mod_names)) {
+        return "unknown";
+    }
+    return lfstream_mod_names[mod];
+}
+
+int lfstream_init(lfstream_t *s, lfstream_mod_t mod, uint8_t bits_per_sample, lfstream_frame_cb_t cb, void *ctx) {
+    if (s == NULL || bits_per_sample == 0 || bits_per_sample > 8) {
+        return PM3_EINVARG;
+    }
+
+    memset(s, 0, sizeof(lfstream_t));
+    s->window = calloc(LFSTREAM_WINDOW_SIZE, sizeof(uint8_t));
+    s->scratch = calloc(LFSTREAM_WINDOW_SIZE, sizeof(uint8_t));
+    if (s->window == NULL || s->scratch == NULL) {
+        lfstream_free(s);
+        return PM3_EMALLOC;
+    }
+
+    s->mod = mod;
+    s->bits_per_sample = bits_per_sample;
+    s->cb = cb;
+    s->cb_ctx = ctx;
+    return PM3_SUCCESS;
+}
+
+void lfstream_free(lfstream_t *s) {
+    if (s == NULL) {
+        return;
+    }
+    free(s->window);
+    free(s->scratch);
+    s->window = NULL;
+    s->scratch = NULL;
+}
+
+// Measures the bit clock of an ASK signal from the threshold crossings in the
+// window, in 1/16th samples. Runs are binned in half bit units around the
+// currently locked clock so that slow drift of the tag oscillator is followed.
+static uint32_t lfstream_measure_ask_clock(const uint8_t *samples, size_t len, int clock) {
+    const signal_t *sp = getSignalProperties();
+    int hi_th = sp->mean + (sp->amplitude / 2);
+    int lo_th = sp->mean - (sp->amplitude / 2);
+
+    int state = -1;
+    bool have_edge = false;
+    size_t last_edge = 0;
+    uint64_t sum_len = 0;
+    uint64_t sum_units = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        int next = state;
+        if (samples[i] >= hi_th) {
+            next = 1;
+        } else if (samples[i] <= lo_th) {
+            next = 0;
+        }
+
+        if (next == state) {
+            continue;
+        }
+
+        if (have_edge) {
+            int run = i - last_edge;
+            int units = ((2 * run) + (clock / 2)) / clock;
+            if (units >= 1 && units <= 4 && abs((units * clock) - (2 * run)) <= (clock / 2)) {
+                sum_len += run;
+                sum_units += units;
+            }
+        }
+
+        if (state != -1) {
+            have_edge = true;
+            last_edge = i;
+        }
+        state = next;
+    }
+
+    if (sum_units == 0) {
+        return 0;
+    }
+    // clock = 2 * run / units, scaled by 16
+    return (uint32_t)((32 * sum_len) / sum_units);
+}
+
+static void lfstream_emit(lfstream_t *s, lfstream_frame_t *frame) {
+    // repeats of the last frame are counted, not reported again
+    if (s->last_protocol == frame->protocol &&
+            s->last_hi == frame->hi &&
+            s->last_lo == frame->lo &&
+            frame->sample_pos - s->last_frame_pos < LFSTREAM_REPEAT_GAP) {
+        s->last_frame_pos = frame->sample_pos;
+        s->repeats++;
+        return;
+    }
+
+    s->last_protocol = frame->protocol;
+    s->last_hi = frame->hi;
+    s->last_lo = frame->lo;
+    s->last_frame_pos = frame->sample_pos;
+    s->frames++;
+
+    if (s->cb) {
+        s->cb(frame, s->cb_ctx);
+    }
+}
+
+static void lfstream_ask(lfstream_t *s, size_t len) {
+
+    if (s->clock_locked) {
+        uint32_t fine = lfstream_measure_ask_clock(s->window, len, s->clock);
+        if (fine) {
+            int measured = (fine + 8) / 16;
+            if (abs(measured - s->clock) <= (s->clock / 8)) {
+                s->clock_fine = ((3 * s->clock_fine) + fine) / 4;
+                s->clock = (s->clock_fine + 8) / 16;
+                s->relock_cnt = 0;
+            } else if (++s->relock_cnt >= LFSTREAM_RELOCK_WINDOWS) {
+                PrintAndLogEx(DEBUG, "DEBUG: lfstream ASK clock lost, measured %d, locked %d", measured, s->clock);
+                s->clock_locked = false;
+                s->relock_cnt = 0;
+            }
+        }
+    }
+
+    memcpy(s->scratch, s->window, len);
+    size_t size = len;
+    int clk = (s->clock_locked) ? s->clock : 0;
+    int invert = 0;
+    int start = 0;
+    int errors = askdemod_ext(s->scratch, &size, &clk, &invert, 100, 0, 1, &start);
+    if (errors < 0 || clk == 0 || size < 64) {
+        return;
+    }
+
+    if (s->clock_locked == false) {
+        s->clock_locked = true;
+        s->clock = clk;
+        s->clock_fine = clk * 16;
+        PrintAndLogEx(DEBUG, "DEBUG: lfstream ASK clock locked to RF/%d at sample %" PRIu64, clk, s->window_pos);
+    }
+
+    // try the normal and the inverted bitstream
+    uint8_t *bits = s->scratch + size;
+    for (int inv = 0; inv < 2; inv++) {
+        size_t bitlen = size;
+        memcpy(bits, s->scratch, size);
+        if (inv) {
+            for (size_t i = 0; i < bitlen; i++) {
+                if (bits[i] < 2) {
+                    bits[i] ^= 1;
+                }
+            }
+        }
+
+        size_t idx = 0;
+        uint32_t hi = 0;
+        uint64_t lo = 0;
+        int ans = Em410xDecode(bits, &bitlen, &idx, &hi, &lo);
+        if (ans > 0 && (hi || lo)) {
+            lfstream_frame_t frame = {
+                .protocol = "EM410x",
+                .sample_pos = s->window_pos + MAX(0, start) + (idx * clk),
+                .clock = clk,
+                .hi = hi,
+                .lo = lo,
+                .bits = bits,
+                .bitlen = bitlen,
+            };
+            lfstream_emit(s, &frame);
+            return;
+        }
+    }
+}
+
+static void lfstream_fsk(lfstream_t *s, size_t len) {
+
+    uint16_t fcs = countFC(s->window, len, true);
+    uint8_t fc_high = fcs >> 8;
+    uint8_t fc_low = fcs & 0xFF;
+    if (fc_high == 0 || fc_low == 0) {
+        return;
+    }
+
+    int first_edge = 0;
+    uint8_t clk = detectFSKClk(s->window, len, fc_high, fc_low, &first_edge);
+
+    if (s->clock_locked) {
+        if (fc_high != s->fc_high || fc_low != s->fc_low || (clk && clk != s->clock)) {
+            if (++s->relock_cnt >= LFSTREAM_RELOCK_WINDOWS) {
+                PrintAndLogEx(DEBUG, "DEBUG: lfstream FSK parameters changed, fc %u/%u clk %u", fc_high, fc_low, clk);
+                s->clock_locked = false;
+                s->relock_cnt = 0;
+            }
+        } else {
+            s->relock_cnt = 0;
+        }
+    }
+
+    if (s->clock_locked == false) {
+        if (clk == 0) {
+            return;
+        }
+        s->clock_locked = true;
+        s->clock = clk;
+        s->clock_fine = clk * 16;
+        s->fc_high = fc_high;
+        s->fc_low = fc_low;
+        PrintAndLogEx(DEBUG, "DEBUG: lfstream FSK locked to fc %u/%u RF/%u at sample %" PRIu64, fc_high, fc_low, clk, s->window_pos);
+    }
+
+    // all supported FSK2a formats use fc/10/8
+    if (s->fc_high != 10 || s->fc_low != 8) {
+        return;
+    }
+
+    int wave_idx = 0;
+    size_t size = len;
+
+    if (s->clock == 50) {
+        uint32_t hi2 = 0, hi = 0, lo = 0;
+        memcpy(s->scratch, s->window, len);
+        int idx = HIDdemodFSK(s->scratch, &size, &hi2, &hi, &lo, &wave_idx);
+        if (idx >= 0 && (hi2 || hi || lo)) {
+            lfstream_frame_t frame = {
+                .protocol = "HID",
+                .sample_pos = s->window_pos + wave_idx + (idx * 50),
+                .clock = 50,
+                .hi2 = hi2,
+                .hi = hi,
+                .lo = lo,
+                .bits = s->scratch + idx,
+                .bitlen = size,
+            };
+            lfstream_emit(s, &frame);
+            return;
+        }
+
+        size = len;
+        wave_idx = 0;
+        memcpy(s->scratch, s->window, len);
+        idx = detectAWID(s->scratch, &size, &wave_idx);
+        if (idx > 0) {
+            lfstream_frame_t frame = {
+                .protocol = "AWID",
+                .sample_pos = s->window_pos + wave_idx + (idx * 50),
+                .clock = 50,
+                .hi = bytebits_to_byte(s->scratch + idx, 32),
+                .lo = ((uint64_t)bytebits_to_byte(s->scratch + idx + 32, 32) << 32) | bytebits_to_byte(s->scratch + idx + 64, 32),
+                .bits = s->scratch + idx,
+                .bitlen = 96,
+            };
+            lfstream_emit(s, &frame);
+        }
+    } else if (s->clock == 64) {
+        memcpy(s->scratch, s->window, len);
+        int idx = detectIOProx(s->scratch, &size, &wave_idx);
+        if (idx >= 0) {
+            lfstream_frame_t frame = {
+                .protocol = "ioProx",
+                .sample_pos = s->window_pos + wave_idx + (idx * 64),
+                .clock = 64,
+                .lo = ((uint64_t)bytebits_to_byte(s->scratch + idx, 32) << 32) | bytebits_to_byte(s->scratch + idx + 32, 32),
+                .bits = s->scratch + idx,
+                .bitlen = 64,
+            };
+            lfstream_emit(s, &frame);
+        }
+    }
+}
+
+static void lfstream_process_window(lfstream_t *s) {
+    size_t len = s->window_len;
+    if (len < SIGNAL_MIN_SAMPLES) {
+        return;
+    }
+
+    s->windows++;
+    computeSignalProperties(s->window, len);
+    if (getSignalProperties()->isnoise) {
+        return;
+    }
+
+    switch (s->mod) {
+        case LFSTREAM_ASK:
+            lfstream_ask(s, len);
+            break;
+        case LFSTREAM_FSK:
+            lfstream_fsk(s, len);
+            break;
+    }
+}
+
+// process a full window and slide it, keeping the overlap for frames crossing the boundary
+static void lfstream_slide(lfstream_t *s) {
+    lfstream_process_window(s);
+
+    size_t drop = s->window_len - LFSTREAM_WINDOW_OVERLAP;
+    memmove(s->window, s->window + drop, LFSTREAM_WINDOW_OVERLAP);
+    s->window_len = LFSTREAM_WINDOW_OVERLAP;
+    s->window_pos += drop;
+}
+
+static inline void lfstream_push(lfstream_t *s, uint8_t sample) {
+    s->window[s->window_len++] = sample;
+    s->samples_total++;
+    if (s->window_len == LFSTREAM_WINDOW_SIZE) {
+        lfstream_slide(s);
+    }
+}
+
+// feed raw sample bytes as received from the device, packed when bits_per_sample < 8
+int lfstream_feed(lfstream_t *s, const uint8_t *data, size_t len) {
+    if (s == NULL || s->window == NULL) {
+        return PM3_EINVARG;
+    }
+
+    if (s->bits_per_sample == 8) {
+        while (len) {
+            size_t n = MIN(len, (size_t)(LFSTREAM_WINDOW_SIZE - s->window_len));
+            memcpy(s->window + s->window_len, data, n);
+            s->window_len += n;
+            s->samples_total += n;
+            data += n;
+            len -= n;
+            if (s->window_len == LFSTREAM_WINDOW_SIZE) {
+                lfstream_slide(s);
+            }
+        }
+        return PM3_SUCCESS;
+    }
+
+    // unpack msb first, like getSamplesFromBufEx
+    for (size_t i = 0; i < len; i++) {
+        for (int bit = 7; bit >= 0; bit--) {
+            s->carry = (s->carry << 1) | ((data[i] >> bit) & 1);
+            if (++s->carry_bits == s->bits_per_sample) {
+                lfstream_push(s, s->carry << (8 - s->bits_per_sample));
+                s->carry = 0;
+                s->carry_bits = 0;
+            }
+        }
+    }
+    return PM3_SUCCESS;
+}
+
+// process whatever is left in the window, call at the end of a capture
+int lfstream_flush(lfstream_t *s) {
+    if (s == NULL || s->window == NULL) {
+        return PM3_EINVARG;
+    }
+
+    if (s->window_len > LFSTREAM_WINDOW_OVERLAP || s->windows == 0) {
+        lfstream_process_window(s);
+    }
+    s->window_pos += s->window_len;
+    s->window_len = 0;
+    return PM3_SUCCESS;
+}
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Streaming (incremental) LF demodulation
+//
+// Samples are fed in chunks as they arrive from the device. They are collected
+// in a sliding window, the clock is detected once on the first usable window
+// and then tracked for drift, and every decoded frame is handed to a callback.
+// Consecutive windows overlap by more than one full frame so frames crossing a
+// chunk boundary are not lost, repeats of the same frame are suppressed.
+//-----------------------------------------------------------------------------
+
+#ifndef LFSTREAM_H__
+#define LFSTREAM_H__
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// samples processed per window, and how many of them are carried over into the next one
+#define LFSTREAM_WINDOW_SIZE     16384
+#define LFSTREAM_WINDOW_OVERLAP  6400
+// identical frames seen again within this many samples are reported as repeats
+#define LFSTREAM_REPEAT_GAP      (3 * LFSTREAM_WINDOW_SIZE)
+// number of windows in a row with a measured clock off the locked one before relocking
+#define LFSTREAM_RELOCK_WINDOWS  3
+
+typedef enum {
+    LFSTREAM_ASK = 0,   // ASK / manchester, EM410x frames
+    LFSTREAM_FSK,       // FSK2a, HID / AWID / ioProx frames
+} lfstream_mod_t;
+
+typedef struct {
+    const char *protocol;   // decoder name, "EM410x", "HID", ...
+    uint64_t sample_pos;    // absolute sample index where the frame was found
+    int clock;              // bit clock used to demodulate it
+    uint32_t hi2;
+    uint32_t hi;
+    uint64_t lo;
+    const uint8_t *bits;    // demodulated frame bits (valid during the callback only)
+    size_t bitlen;
+} lfstream_frame_t;
+
+typedef void (*lfstream_frame_cb_t)(const lfstream_frame_t *frame, void *ctx);
+
+typedef struct {
+    lfstream_mod_t mod;
+    uint8_t bits_per_sample;
+
+    // sliding sample window, window[0] is absolute sample window_pos
+    uint8_t *window;
+    uint8_t *scratch;
+    size_t window_len;
+    uint64_t window_pos;
+
+    // partial sample carried over between chunks when bits_per_sample < 8
+    uint8_t carry;
+    uint8_t carry_bits;
+
+    // clock lock and drift tracking
+    bool clock_locked;
+    int clock;              // locked bit clock in samples
+    uint32_t clock_fine;    // tracked bit clock, in 1/16th samples
+    uint8_t fc_high;
+    uint8_t fc_low;
+    uint8_t relock_cnt;
+
+    // repeat suppression
+    const char *last_protocol;
+    uint32_t last_hi;
+    uint64_t last_lo;
+    uint64_t last_frame_pos;
+
+    // statistics
+    uint64_t samples_total;
+    uint32_t windows;
+    uint32_t frames;
+    uint32_t repeats;
+
+    lfstream_frame_cb_t cb;
+    void *cb_ctx;
+} lfstream_t;
+
+int lfstream_init(lfstream_t *s, lfstream_mod_t mod, uint8_t bits_per_sample, lfstream_frame_cb_t cb, void *ctx);
+void lfstream_free(lfstream_t *s);
+int lfstream_feed(lfstream_t *s, const uint8_t *data, size_t len);
+int lfstream_flush(lfstream_t *s);
+int lfstream_mod_from_str(const char *str, lfstream_mod_t *mod);
+const char *lfstream_mod_to_str(lfstream_mod_t mod);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
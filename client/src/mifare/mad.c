@@ -23,12 +23,10 @@
 #include "crc.h"
 #include "util.h"
 #include "fileutils.h"
-#include "jansson.h"
+#include "restable.h"
 #include "mifaredefault.h"
 
 // https://www.nxp.com/docs/en/application-note/AN10787.pdf
-static json_t *mad_known_aids = NULL;
-
 static const char *holder_info_type[] = {
     "Surname",
     "Given name",
@@ -45,97 +43,38 @@ static const char *aid_admin[] = {
     "not applicable"
 };
 
-static int open_mad_file(json_t **root, bool verbose) {
-
-    char *path;
-    int res = searchFile(&path, RESOURCES_SUBDIR, "mad", ".json", true);
-    if (res != PM3_SUCCESS) {
-        return PM3_EFILE;
-    }
-
-    int retval = PM3_SUCCESS;
-    json_error_t error;
-
-    *root = json_load_file(path, 0, &error);
-    if (!*root) {
-        PrintAndLogEx(ERR, "json (%s) error on line %d: %s", path, error.line, error.text);
-        retval = PM3_ESOFT;
-        goto out;
-    }
-
-    if (!json_is_array(*root)) {
-        PrintAndLogEx(ERR, "Invalid json (%s) format. root must be an array.", path);
-        retval = PM3_ESOFT;
-        goto out;
-    }
-
-    if (verbose) {
-        PrintAndLogEx(SUCCESS, "Loaded file `" _YELLOW_("%s") "` " _GREEN_("%zu") " records ( " _GREEN_("ok") " )"
-                      , path
-                      , json_array_size(*root)
-                     );
-    }
-
-out:
-    free(path);
-    return retval;
-}
-
-static int close_mad_file(json_t *root) {
-    json_decref(root);
-    return PM3_SUCCESS;
-}
-
-static const char *mad_json_get_str(json_t *data, const char *name) {
-
-    json_t *jstr = json_object_get(data, name);
-    if (jstr == NULL)
-        return NULL;
-
-    if (!json_is_string(jstr)) {
-        PrintAndLogEx(WARNING, _YELLOW_("`%s`") " is not a string", name);
-        return NULL;
-    }
+// cells of the mad table, as listed in pm3_json2table.py
+enum {
+    MAD_CELL_MAD,
+    MAD_CELL_APPLICATION,
+    MAD_CELL_COMPANY,
+    MAD_CELL_PROVIDER,
+    MAD_CELL_INTEGRATOR,
+};
 
-    const char *cstr = json_string_value(jstr);
-    if (strlen(cstr) == 0)
+static const char *mad_get_str(const restable_t *t, int rec, int cell) {
+    const char *cstr = restable_get(t, rec, cell);
+    if (cstr == NULL || strlen(cstr) == 0)
         return NULL;
 
     return cstr;
 }
 
-static int print_aid_description(json_t *root, uint16_t aid, char *fmt, bool verbose) {
+static int print_aid_description(const restable_t *t, uint16_t aid, char *fmt, bool verbose) {
     char lmad[7] = {0};
-    snprintf(lmad, sizeof(lmad), "0x%04x", aid); // must be lowercase
-
-    json_t *elm = NULL;
-
-    for (uint32_t idx = 0; idx < json_array_size(root); idx++) {
-        json_t *data = json_array_get(root, idx);
-        if (!json_is_object(data)) {
-            PrintAndLogEx(ERR, "data [%d] is not an object\n", idx);
-            continue;
-        }
-        const char *fmad = mad_json_get_str(data, "mad");
-        char lfmad[strlen(fmad) + 1];
-        strcpy(lfmad, fmad);
-        str_lower(lfmad);
-        if (strcmp(lmad, lfmad) == 0) {
-            elm = data;
-            break;
-        }
-    }
+    snprintf(lmad, sizeof(lmad), "0x%04x", aid);
 
-    if (elm == NULL) {
+    int rec = restable_find(t, lmad);
+    if (rec < 0) {
         PrintAndLogEx(INFO, fmt, " (unknown)");
         return PM3_ENODATA;
     }
 
-    const char *vmad = mad_json_get_str(elm, "mad");
-    const char *application = mad_json_get_str(elm, "application");
-    const char *company = mad_json_get_str(elm, "company");
-    const char *provider = mad_json_get_str(elm, "service_provider");
-    const char *integrator = mad_json_get_str(elm, "system_integrator");
+    const char *vmad = mad_get_str(t, rec, MAD_CELL_MAD);
+    const char *application = mad_get_str(t, rec, MAD_CELL_APPLICATION);
+    const char *company = mad_get_str(t, rec, MAD_CELL_COMPANY);
+    const char *provider = mad_get_str(t, rec, MAD_CELL_PROVIDER);
+    const char *integrator = mad_get_str(t, rec, MAD_CELL_INTEGRATOR);
 
     if (application && company) {
         size_t result_len = 6 + strlen(application) + strlen(company);
@@ -321,7 +260,7 @@ void MADPrintHeader(void) {
 }
 
 int MAD1DecodeAndPrint(uint8_t *sector, bool swapmad, bool verbose, bool *haveMAD2) {
-    open_mad_file(&mad_known_aids, verbose);
+    const restable_t *mad_known_aids = restable_open("mad", verbose);
 
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(INFO, "------------ " _CYAN_("MAD v1 details") " -------------");
@@ -373,12 +312,11 @@ int MAD1DecodeAndPrint(uint8_t *sector, bool swapmad, bool verbose, bool *haveMA
             prev_aid = aid;
         }
     }
-    close_mad_file(mad_known_aids);
     return PM3_SUCCESS;
 }
 
 int MAD2DecodeAndPrint(uint8_t *sector, bool swapmad, bool verbose) {
-    open_mad_file(&mad_known_aids, false);
+    const restable_t *mad_known_aids = restable_open("mad", false);
 
     PrintAndLogEx(NORMAL, "");
     PrintAndLogEx(INFO, "------------ " _CYAN_("MAD v2 details") " -------------");
@@ -434,18 +372,16 @@ int MAD2DecodeAndPrint(uint8_t *sector, bool swapmad, bool verbose) {
             prev_aid = aid;
         }
     }
-    close_mad_file(mad_known_aids);
 
     return PM3_SUCCESS;
 }
 
 int MADDFDecodeAndPrint(uint32_t short_aid, bool verbose) {
-    open_mad_file(&mad_known_aids, false);
+    const restable_t *mad_known_aids = restable_open("mad", false);
 
     char fmt[128];
     snprintf(fmt, sizeof(fmt), "   MAD AID Function 0x%04X... " _YELLOW_("%s"), short_aid, "%s");
     print_aid_description(mad_known_aids, short_aid, fmt, verbose);
-    close_mad_file(mad_known_aids);
     return PM3_SUCCESS;
 }
 
@@ -0,0 +1,179 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Minimal pcapng writer
+//-----------------------------------------------------------------------------
+#include "pcapng.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui.h"
+
+// https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-01.html
+#define PCAPNG_BT_SHB           0x0A0D0D0A
+#define PCAPNG_BT_IDB           0x00000001
+#define PCAPNG_BT_EPB           0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+
+#define PCAPNG_OPT_ENDOFOPT     0
+#define PCAPNG_OPT_SHB_USERAPPL 4
+#define PCAPNG_OPT_IF_NAME      2
+#define PCAPNG_OPT_IF_TSRESOL   9
+#define PCAPNG_OPT_EPB_FLAGS    2
+
+// stdio buffer of the output file
+#define PCAPNG_FILE_BUFFER      (1024 * 1024)
+
+#define PAD4(x)                 (((x) + 3) & ~3)
+
+static const uint8_t zeros[4] = {0};
+
+static void put32(uint8_t *buf, size_t *pos, uint32_t v) {
+    memcpy(buf + *pos, &v, sizeof(v));
+    *pos += sizeof(v);
+}
+
+static void put16(uint8_t *buf, size_t *pos, uint16_t v) {
+    memcpy(buf + *pos, &v, sizeof(v));
+    *pos += sizeof(v);
+}
+
+static void put_option(uint8_t *buf, size_t *pos, uint16_t code, const void *value, uint16_t len) {
+    put16(buf, pos, code);
+    put16(buf, pos, len);
+    if (len) {
+        memcpy(buf + *pos, value, len);
+    }
+    memset(buf + *pos + len, 0, PAD4(len) - len);
+    *pos += PAD4(len);
+}
+
+// closes a block started at buf[0], fills in its length at both ends and writes it
+static int put_block(pcapng_t *p, uint8_t *buf, size_t pos) {
+    uint32_t len = pos + sizeof(uint32_t);
+    memcpy(buf + 4, &len, sizeof(len));
+    put32(buf, &pos, len);
+    if (fwrite(buf, 1, pos, p->f) != pos) {
+        p->error = true;
+        return PM3_EFILE;
+    }
+    return PM3_SUCCESS;
+}
+
+int pcapng_open(pcapng_t *p, const char *filename, uint16_t linktype, const char *ifname) {
+    memset(p, 0, sizeof(pcapng_t));
+
+    p->f = fopen(filename, "wb");
+    if (p->f == NULL) {
+        PrintAndLogEx(WARNING, "file not found or locked `" _YELLOW_("%s") "`", filename);
+        return PM3_EFILE;
+    }
+    setvbuf(p->f, NULL, _IOFBF, PCAPNG_FILE_BUFFER);
+
+    uint8_t buf[256];
+    size_t pos = 0;
+
+    // section header
+    put32(buf, &pos, PCAPNG_BT_SHB);
+    put32(buf, &pos, 0);
+    put32(buf, &pos, PCAPNG_BYTE_ORDER_MAGIC);
+    put16(buf, &pos, 1);
+    put16(buf, &pos, 0);
+    put32(buf, &pos, 0xFFFFFFFF);   // section length not given
+    put32(buf, &pos, 0xFFFFFFFF);
+    put_option(buf, &pos, PCAPNG_OPT_SHB_USERAPPL, "proxmark3", strlen("proxmark3"));
+    put_option(buf, &pos, PCAPNG_OPT_ENDOFOPT, NULL, 0);
+    int res = put_block(p, buf, pos);
+
+    // interface, nanosecond timestamps
+    pos = 0;
+    uint8_t tsresol = 9;
+    size_t ifnamelen = MIN(strlen(ifname), 64);
+    put32(buf, &pos, PCAPNG_BT_IDB);
+    put32(buf, &pos, 0);
+    put16(buf, &pos, linktype);
+    put16(buf, &pos, 0);
+    put32(buf, &pos, 0);            // no snap length
+    put_option(buf, &pos, PCAPNG_OPT_IF_NAME, ifname, ifnamelen);
+    put_option(buf, &pos, PCAPNG_OPT_IF_TSRESOL, &tsresol, sizeof(tsresol));
+    put_option(buf, &pos, PCAPNG_OPT_ENDOFOPT, NULL, 0);
+    if (res == PM3_SUCCESS) {
+        res = put_block(p, buf, pos);
+    }
+
+    if (res != PM3_SUCCESS) {
+        fclose(p->f);
+        p->f = NULL;
+    }
+    return res;
+}
+
+// one enhanced packet block, the packet is hdr followed by data
+int pcapng_write(pcapng_t *p, uint64_t ts_ns, const uint8_t *hdr, size_t hdrlen, const uint8_t *data, size_t datalen, uint32_t flags) {
+
+    if (p->f == NULL || p->error) {
+        return PM3_EFILE;
+    }
+
+    uint32_t caplen = hdrlen + datalen;
+    uint32_t pad = PAD4(caplen) - caplen;
+
+    uint8_t head[28];
+    size_t pos = 0;
+    put32(head, &pos, PCAPNG_BT_EPB);
+    put32(head, &pos, 0);
+    put32(head, &pos, 0);           // interface id
+    put32(head, &pos, ts_ns >> 32);
+    put32(head, &pos, ts_ns & 0xFFFFFFFF);
+    put32(head, &pos, caplen);
+    put32(head, &pos, caplen);
+
+    uint8_t tail[16];
+    size_t tpos = 0;
+    if (flags) {
+        put_option(tail, &tpos, PCAPNG_OPT_EPB_FLAGS, &flags, sizeof(flags));
+        put_option(tail, &tpos, PCAPNG_OPT_ENDOFOPT, NULL, 0);
+    }
+
+    uint32_t len = pos + caplen + pad + tpos + sizeof(uint32_t);
+    memcpy(head + 4, &len, sizeof(len));
+    put32(tail, &tpos, len);
+
+    if (fwrite(head, 1, pos, p->f) != pos ||
+            (hdrlen && fwrite(hdr, 1, hdrlen, p->f) != hdrlen) ||
+            (datalen && fwrite(data, 1, datalen, p->f) != datalen) ||
+            (pad && fwrite(zeros, 1, pad, p->f) != pad) ||
+            fwrite(tail, 1, tpos, p->f) != tpos) {
+        p->error = true;
+        return PM3_EFILE;
+    }
+
+    p->packets++;
+    p->bytes += len;
+    return PM3_SUCCESS;
+}
+
+int pcapng_close(pcapng_t *p) {
+    if (p->f == NULL) {
+        return PM3_EFILE;
+    }
+
+    if (fclose(p->f) != 0) {
+        p->error = true;
+    }
+    p->f = NULL;
+    return (p->error) ? PM3_EFILE : PM3_SUCCESS;
+}
@@ -0,0 +1,56 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Minimal pcapng writer
+//
+// One section with one interface, packets are written as they come so a
+// capture of any size goes out without being held in memory. Blocks are in
+// host byte order, readers tell from the byte order magic.
+//-----------------------------------------------------------------------------
+
+#ifndef PCAPNG_H__
+#define PCAPNG_H__
+
+#include "common.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// https://www.tcpdump.org/linktypes.html
+#define PCAPNG_LINKTYPE_USER0       147
+#define PCAPNG_LINKTYPE_ISO_14443   264
+
+// epb_flags direction
+#define PCAPNG_DIR_INBOUND          0x01
+#define PCAPNG_DIR_OUTBOUND         0x02
+
+typedef struct {
+    FILE *f;
+    uint64_t packets;
+    uint64_t bytes;
+    bool error;
+} pcapng_t;
+
+// timestamps given to pcapng_write() are in nanoseconds
+int pcapng_open(pcapng_t *p, const char *filename, uint16_t linktype, const char *ifname);
+int pcapng_write(pcapng_t *p, uint64_t ts_ns, const uint8_t *hdr, size_t hdrlen, const uint8_t *data, size_t datalen, uint32_t flags);
+int pcapng_close(pcapng_t *p);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
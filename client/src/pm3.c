@@ -69,6 +69,8 @@ int pm3_console(pm3_device_t *dev, const char *cmd, bool capture, bool quiet) {
         g_printAndLog &= ~PRINTANDLOG_PRINT;
     }
     int ret = CommandReceived(cmd);
+    // the caller looks at the output as soon as this returns
+    PrintAndLogFlush();
     g_printAndLog = prev_printAndLog;
     return ret;
 }
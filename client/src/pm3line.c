@@ -21,6 +21,11 @@
 #include <stdio.h> // for Mingw readline and for getline
 #include <string.h>
 #include <signal.h>
+#if !defined(_WIN32)
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
 #if defined(HAVE_READLINE)
 #include <readline/readline.h>
 #include <readline/history.h>
@@ -122,13 +127,31 @@ static bool WINAPI terminate_handler(DWORD t) {
 */
 #  else
 static struct sigaction gs_old_sigint_action;
+
+// The handler can't flush the logger itself, that takes locks and allocates.
+// It wakes up sigint_watcher() through a pipe, which flushes and re-raises.
+static int gs_sigint_pipe[2] = { -1, -1 };
+
+static void *sigint_watcher(void *arg) {
+    (void)arg;
+    char c;
+    while (read(gs_sigint_pipe[0], &c, 1) < 0 && errno == EINTR);
+    PrintAndLogFlush();
+    kill(0, SIGINT);
+    return NULL;
+}
+
 static void sigint_handler(int signum) {
 
     switch (signum) {
         case SIGINT: {
             sigaction(SIGINT, &gs_old_sigint_action, NULL);
             pm3line_flush_history();
-            kill(0, SIGINT);
+            int saved_errno = errno;
+            if (gs_sigint_pipe[1] < 0 || write(gs_sigint_pipe[1], "", 1) != 1) {
+                kill(0, SIGINT);
+            }
+            errno = saved_errno;
             break;
         }
         default: {
@@ -137,12 +160,36 @@ static void sigint_handler(int signum) {
     }
 }
 
+static void sigint_watcher_start(void) {
+    if (gs_sigint_pipe[0] >= 0 || pipe(gs_sigint_pipe) != 0) {
+        return;
+    }
+
+    // the watcher itself never takes the signal
+    sigset_t all, prev;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &prev);
+    pthread_t watcher;
+    int res = pthread_create(&watcher, NULL, sigint_watcher, NULL);
+    pthread_sigmask(SIG_SETMASK, &prev, NULL);
+
+    if (res != 0) {
+        close(gs_sigint_pipe[0]);
+        close(gs_sigint_pipe[1]);
+        gs_sigint_pipe[0] = -1;
+        gs_sigint_pipe[1] = -1;
+        return;
+    }
+    pthread_detach(watcher);
+}
+
 #endif
 
 void pm3line_install_signals(void) {
 #  if defined(_WIN32)
 //    SetConsoleCtrlHandler((PHANDLER_ROUTINE)terminate_handler, true);
 #  else
+    sigint_watcher_start();
     struct sigaction action;
     memset(&action, 0, sizeof(action));
     action.sa_handler = &sigint_handler;
@@ -180,6 +227,8 @@ void pm3line_init(void) {
 }
 
 char *pm3line_read(const char *s) {
+    // everything printed so far goes out before the prompt
+    PrintAndLogFlush();
 #if defined(HAVE_READLINE)
     return readline(s);
 #elif defined(HAVE_LINENOISE)
@@ -191,6 +240,7 @@ char *pm3line_read(const char *s) {
     int ret;
     if ((ret = getline(&answer, &anslen, stdin)) < 0) {
         // TODO this happens also when kbd_enter_pressed() is used, with a key pressed or not
+        PrintAndLogFlush();
         printf("DEBUG: getline returned %i", ret);
         free(answer);
         answer = NULL;
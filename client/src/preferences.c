@@ -69,6 +69,7 @@ int preferences_load(void) {
     g_session.dense_output = false;
 
     g_session.bar_mode = STYLE_VALUE;
+    g_session.download_compression = COMPRESS_AUTO;
     setDefaultPath(spDefault, "");
     setDefaultPath(spDump, "");
     setDefaultPath(spTrace, "");
@@ -254,6 +255,17 @@ void preferences_save_callback(json_t *root) {
         default:
             JsonSaveStr(root, "show.bar.mode", "value");
     }
+    switch (g_session.download_compression) {
+        case COMPRESS_ON:
+            JsonSaveStr(root, "client.download.compression", "on");
+            break;
+        case COMPRESS_OFF:
+            JsonSaveStr(root, "client.download.compression", "off");
+            break;
+        case COMPRESS_AUTO:
+        default:
+            JsonSaveStr(root, "client.download.compression", "auto");
+    }
     /*
         switch (g_session.device_debug_level) {
             case ddbOFF:
@@ -362,6 +374,15 @@ void preferences_load_callback(json_t *root) {
         if (strncmp(tempStr, "value", 7) == 0) g_session.bar_mode = STYLE_VALUE;
     }
 
+    // download compression
+    if (json_unpack_ex(root, &up_error, 0, "{s:s}", "client.download.compression", &s1) == 0) {
+        strncpy(tempStr, s1, sizeof(tempStr) - 1);
+        str_lower(tempStr);
+        if (strncmp(tempStr, "auto", 4) == 0) g_session.download_compression = COMPRESS_AUTO;
+        if (strncmp(tempStr, "on", 3) == 0) g_session.download_compression = COMPRESS_ON;
+        if (strncmp(tempStr, "off", 3) == 0) g_session.download_compression = COMPRESS_OFF;
+    }
+
     /*
         // Logging Level
         if (json_unpack_ex(root, &up_error, 0, "{s:s}", "device.debug.level", &s1) == 0) {
@@ -602,6 +623,23 @@ static void showClientTimeoutState(void) {
     PrintAndLogEx(INFO, "    communication timeout... " _GREEN_("%u") " ms", g_session.timeout);
 }
 
+static void showCompressionState(prefShowOpt_t opt) {
+
+    switch (g_session.download_compression) {
+        case COMPRESS_AUTO:
+            PrintAndLogEx(INFO, "   %s download compression.... %s", pref_show_status_msg(opt), pref_show_value(opt, "auto"));
+            break;
+        case COMPRESS_ON:
+            PrintAndLogEx(INFO, "   %s download compression.... %s", pref_show_status_msg(opt), pref_show_value(opt, "on"));
+            break;
+        case COMPRESS_OFF:
+            PrintAndLogEx(INFO, "   %s download compression.... %s", pref_show_status_msg(opt), pref_show_value(opt, "off"));
+            break;
+        default:
+            PrintAndLogEx(INFO, "   %s download compression.... %s", pref_show_status_msg(opt), pref_show_value(prefShowUnknown, "unknown"));
+    }
+}
+
 static int setCmdEmoji(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "prefs set emoji ",
@@ -974,6 +1012,56 @@ static int setClientTimeout(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int setClientCompression(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "prefs set client.compression",
+                  "Set persistent preference of compressing sample downloads from the device.\n"
+                  "Auto compresses on links slower than USB, like Bluetooth, FPC UART and IP.\n"
+                  "Older firmware ignores it and sends the samples as they are",
+                  "prefs set client.compression --auto  --> compress on slow links\n"
+                  "prefs set client.compression --on    --> always compress\n"
+                  "prefs set client.compression --off   --> never compress"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_lit0(NULL, "auto", "compress on links slower than USB"),
+        arg_lit0(NULL, "on", "always compress"),
+        arg_lit0(NULL, "off", "never compress"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    bool use_auto = arg_get_lit(ctx, 1);
+    bool use_on = arg_get_lit(ctx, 2);
+    bool use_off = arg_get_lit(ctx, 3);
+    CLIParserFree(ctx);
+
+    if ((use_auto + use_on + use_off) > 1) {
+        PrintAndLogEx(FAILED, "Can only set one option");
+        return PM3_EINVARG;
+    }
+
+    compressMode_t new_value = g_session.download_compression;
+    if (use_auto) {
+        new_value = COMPRESS_AUTO;
+    }
+    if (use_on) {
+        new_value = COMPRESS_ON;
+    }
+    if (use_off) {
+        new_value = COMPRESS_OFF;
+    }
+
+    if (g_session.download_compression != new_value) {
+        showCompressionState(prefShowOLD);
+        g_session.download_compression = new_value;
+        showCompressionState(prefShowNEW);
+        preferences_save();
+    } else {
+        showCompressionState(prefShowNone);
+    }
+    return PM3_SUCCESS;
+}
 
 static int setCmdHint(const char *Cmd) {
     CLIParserContext *ctx;
@@ -1350,8 +1438,25 @@ static int getClientTimeout(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int getClientCompression(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "prefs get client.compression",
+                  "Get preference of compressing sample downloads from the device",
+                  "prefs get client.compression"
+                 );
+    void *argtable[] = {
+        arg_param_begin,
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    CLIParserFree(ctx);
+    showCompressionState(prefShowNone);
+    return PM3_SUCCESS;
+}
+
 static command_t CommandTableGet[] = {
     {"barmode",          getCmdBarMode,       AlwaysAvailable, "Get bar mode preference"},
+    {"client.compression", getClientCompression, AlwaysAvailable, "Get sample download compression preference"},
     {"client.debug",     getCmdDebug,         AlwaysAvailable, "Get client debug level preference"},
     {"client.delay",     getCmdExeDelay,      AlwaysAvailable, "Get client execution delay preference"},
     {"client.timeout",   getClientTimeout,    AlwaysAvailable, "Get client execution delay preference"},
@@ -1368,6 +1473,7 @@ static command_t CommandTableGet[] = {
 static command_t CommandTableSet[] = {
     {"help",             setCmdHelp,          AlwaysAvailable, "This help"},
     {"barmode",          setCmdBarMode,       AlwaysAvailable, "Set bar mode"},
+    {"client.compression", setClientCompression, AlwaysAvailable, "Set sample download compression"},
     {"client.debug",     setCmdDebug,         AlwaysAvailable, "Set client debug level"},
     {"client.delay",     setCmdExeDelay,      AlwaysAvailable, "Set client execution delay"},
     {"client.timeout",   setClientTimeout,    AlwaysAvailable, "Set client communication timeout"},
@@ -1443,6 +1549,7 @@ static int CmdPrefShow(const char *Cmd) {
     showClientExeDelayState();
     showOutputState(prefShowNone);
     showClientTimeoutState();
+    showCompressionState(prefShowNone);
 
     PrintAndLogEx(NORMAL, "");
     return PM3_SUCCESS;
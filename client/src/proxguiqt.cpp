@@ -338,7 +338,13 @@ void SliderWidget::moveEvent(QMoveEvent *event) {
 void ProxWidget::applyOperation() {
     //printf("ApplyOperation()");
     //g_saveState_gb = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
-    memcpy(g_GraphBuffer, g_OverlayBuffer, sizeof(int) * g_GraphTraceLen);
+    graph_lock();
+    int32_t *gb = graph_write();
+    const int32_t *overlay = graph_overlay_buffer();
+    if (gb && overlay) {
+        memcpy(gb, overlay, sizeof(int) * g_GraphTraceLen);
+    }
+    graph_unlock();
     RepaintGraphWindow();
 }
 void ProxWidget::stickOperation() {
@@ -346,21 +352,47 @@ void ProxWidget::stickOperation() {
     //printf("stickOperation()");
 }
 void ProxWidget::vchange_autocorr(int v) {
-    int ans = AutoCorrelate(g_GraphBuffer, g_OverlayBuffer, g_GraphTraceLen, v, true, false);
-    if (g_debugMode) printf("vchange_autocorr(w:%d): %d\n", v, ans);
+    int ans = -1;
+    graph_lock();
+    const int32_t *gb = graph_read();
+    int32_t *overlay = graph_overlay_buffer();
+    if (gb && overlay) {
+        ans = AutoCorrelate(gb, overlay, g_GraphTraceLen, v, false, true, false);
+    }
+    graph_unlock();
+    if (g_debugMode) {
+        PrintAndLogFlush();
+        printf("vchange_autocorr(w:%d): %d\n", v, ans);
+    }
     g_useOverlays = true;
     RepaintGraphWindow();
 }
 void ProxWidget::vchange_askedge(int v) {
     //extern int AskEdgeDetect(const int *in, int *out, int len, int threshold);
-    int ans = AskEdgeDetect(g_GraphBuffer, g_OverlayBuffer, g_GraphTraceLen, v);
-    if (g_debugMode) printf("vchange_askedge(w:%d)%d\n", v, ans);
+    int ans = PM3_ESOFT;
+    graph_lock();
+    const int32_t *gb = graph_read();
+    int32_t *overlay = graph_overlay_buffer();
+    if (gb && overlay) {
+        ans = AskEdgeDetect(gb, overlay, g_GraphTraceLen, v);
+    }
+    graph_unlock();
+    if (g_debugMode) {
+        PrintAndLogFlush();
+        printf("vchange_askedge(w:%d)%d\n", v, ans);
+    }
     g_useOverlays = true;
     RepaintGraphWindow();
 }
 void ProxWidget::vchange_dthr_up(int v) {
     int down = opsController->horizontalSlider_dirthr_down->value();
-    directionalThreshold(g_GraphBuffer, g_OverlayBuffer, g_GraphTraceLen, v, down);
+    graph_lock();
+    const int32_t *gb = graph_read();
+    int32_t *overlay = graph_overlay_buffer();
+    if (gb && overlay) {
+        directionalThreshold(gb, overlay, g_GraphTraceLen, v, down);
+    }
+    graph_unlock();
     //printf("vchange_dthr_up(%d)", v);
     g_useOverlays = true;
     RepaintGraphWindow();
@@ -368,7 +400,13 @@ void ProxWidget::vchange_dthr_up(int v) {
 void ProxWidget::vchange_dthr_down(int v) {
     //printf("vchange_dthr_down(%d)", v);
     int up = opsController->horizontalSlider_dirthr_up->value();
-    directionalThreshold(g_GraphBuffer, g_OverlayBuffer, g_GraphTraceLen, v, up);
+    graph_lock();
+    const int32_t *gb = graph_read();
+    int32_t *overlay = graph_overlay_buffer();
+    if (gb && overlay) {
+        directionalThreshold(gb, overlay, g_GraphTraceLen, v, up);
+    }
+    graph_unlock();
     g_useOverlays = true;
     RepaintGraphWindow();
 }
@@ -554,7 +592,7 @@ QColor Plot::getColor(int graphNum) {
     }
 }
 
-void Plot::setMaxAndStart(int *buffer, size_t len, QRect plotRect) {
+void Plot::setMaxAndStart(const int *buffer, size_t len, QRect plotRect) {
     if (len == 0) {
         return;
     }
@@ -597,7 +635,7 @@ void Plot::setMaxAndStart(int *buffer, size_t len, QRect plotRect) {
     gs_absVMax = (int)(gs_absVMax * 1.25 + 1);
 }
 
-void Plot::appendMax(int *buffer, size_t len, QRect plotRect) {
+void Plot::appendMax(const int *buffer, size_t len, QRect plotRect) {
     if (len == 0) {
         return;
     }
@@ -679,7 +717,7 @@ void Plot::PlotDemod(uint8_t *buffer, size_t len, QRect plotRect, QRect annotati
     painter->drawPath(penPath);
 }
 
-void Plot::PlotGraph(int *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum) {
+void Plot::PlotGraph(const int *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum) {
 
     if (len == 0) {
         return;
@@ -822,7 +860,14 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
     uint32_t pos = 0, loc = 375;
     painter->setPen(WHITE);
 
-    if (g_MarkerA.pos > 0) {
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        free(annotation);
+        return;
+    }
+
+    const int32_t *ob = (g_MarkerA.pos > 0) ? graph_operation_buffer() : NULL;
+    if (ob) {
         free(annotation);
 
         length = (sizeof(markerText) + (sizeof(uint32_t) * 3) + sizeof(" ") + 1);
@@ -836,17 +881,17 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
         strcat(textA, markerText);
         strcat(textA, " (%s%u)");
 
-        if (g_GraphBuffer[pos] <= g_OperationBuffer[pos]) {
+        if (gb[pos] <= ob[pos]) {
             flag = true;
-            value = (g_OperationBuffer[pos] - g_GraphBuffer[pos]);
+            value = (ob[pos] - gb[pos]);
         } else {
-            value = (g_GraphBuffer[pos] - g_OperationBuffer[pos]);
+            value = (gb[pos] - ob[pos]);
         }
 
         snprintf(annotation, length, textA,
                  "A",
                  pos,
-                 g_GraphBuffer[pos],
+                 gb[pos],
                  flag ? "+" : "-",
                  value
                 );
@@ -867,7 +912,7 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
         snprintf(annotation, length, markerText,
                  "B",
                  pos,
-                 g_GraphBuffer[pos]
+                 gb[pos]
                 );
 
         painter->drawText(loc, annotationRect.bottom() - 36, annotation);
@@ -884,7 +929,7 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
         snprintf(annotation, length, markerText,
                  "C",
                  pos,
-                 g_GraphBuffer[pos]
+                 gb[pos]
                 );
 
         painter->drawText(loc, annotationRect.bottom() - 24, annotation);
@@ -901,7 +946,7 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
         snprintf(annotation, length, markerText,
                  "D",
                  pos,
-                 g_GraphBuffer[pos]
+                 gb[pos]
                 );
 
         painter->drawText(loc, annotationRect.bottom() - 12, annotation);
@@ -950,11 +995,16 @@ void Plot::plotGridLines(QPainter *painter, QRect r) {
     }
 }
 
-void Plot::plotOperations(int *buffer, size_t len, QPainter *painter, QRect plotRect) {
+void Plot::plotOperations(const int *buffer, size_t len, QPainter *painter, QRect plotRect) {
     if (len == 0) {
         return;
     }
 
+    const int32_t *gb = graph_read();
+    if (gb == NULL) {
+        return;
+    }
+
     QPainterPath penPath;
     int32_t x = xCoordOf(g_GraphStart, plotRect), prevX = 0;
     int32_t y = yCoordOf(buffer[g_GraphStart], plotRect, gs_absVMax), prevY = 0;
@@ -973,10 +1023,10 @@ void Plot::plotOperations(int *buffer, size_t len, QPainter *painter, QRect plot
         y = yCoordOf(current, plotRect, gs_absVMax);
 
         //We only want to graph changes between the Graph Buffer and the Operation Buffer
-        if (current == g_GraphBuffer[pos]) {
+        if (current == gb[pos]) {
             //If this point is the same, but the last point is different, we want to plot that line
             //as well
-            if ((pos == 0) || (prev == g_GraphBuffer[pos - 1])) {
+            if ((pos == 0) || (prev == gb[pos - 1])) {
                 continue;
             }
         } else {
@@ -1016,8 +1066,13 @@ void Plot::paintEvent(QPaintEvent *event) {
     //Black foreground
     painter.fillRect(plotRect, BLACK);
 
+    // keep the samples from being swapped out while drawing them
+    graph_lock();
+    const int32_t *gb = graph_read();
+    size_t len = (gb) ? g_GraphTraceLen : 0;
+
     //init graph variables
-    setMaxAndStart(g_GraphBuffer, g_GraphTraceLen, plotRect);
+    setMaxAndStart(gb, len, plotRect);
     //appendMax(g_OperationBuffer, g_GraphTraceLen, plotRect);
 
     // center line
@@ -1028,7 +1083,7 @@ void Plot::paintEvent(QPaintEvent *event) {
     plotGridLines(&painter, plotRect);
 
     //Start painting graph
-    PlotGraph(g_GraphBuffer, g_GraphTraceLen, plotRect, infoRect, &painter, 0);
+    PlotGraph(gb, len, plotRect, infoRect, &painter, 0);
     if (g_DemodBufferLen > 8) {
         PlotDemod(g_DemodBuffer, g_DemodBufferLen, plotRect, infoRect, &painter, 2, g_DemodStartIdx);
     }
@@ -1038,9 +1093,11 @@ void Plot::paintEvent(QPaintEvent *event) {
 
     //Plot the Overlay
     if (g_useOverlays) {
+        const int32_t *overlay = graph_overlay_buffer();
+        size_t overlay_len = (overlay) ? g_GraphTraceLen : 0;
         //init graph variables
-        setMaxAndStart(g_OverlayBuffer, g_GraphTraceLen, plotRect);
-        PlotGraph(g_OverlayBuffer, g_GraphTraceLen, plotRect, infoRect, &painter, 1);
+        setMaxAndStart(overlay, overlay_len, plotRect);
+        PlotGraph(overlay, overlay_len, plotRect, infoRect, &painter, 1);
     }
     // End graph drawing
 
@@ -1059,6 +1116,8 @@ void Plot::paintEvent(QPaintEvent *event) {
     //Draw annotations
     drawAnnotations(infoRect, &painter);
 
+    graph_unlock();
+
     if (startMaxOld != startMax) {
         emit startMaxChanged(startMax);
     }
@@ -1225,9 +1284,14 @@ void Plot::Trim(void) {
     }
     g_DemodStartIdx -= lref;
 
-    for (uint32_t i = lref; i < rref; ++i) {
-        g_GraphBuffer[i - lref] = g_GraphBuffer[i];
+    graph_lock();
+    int32_t *gb = graph_write();
+    if (gb) {
+        for (uint32_t i = lref; i < rref; ++i) {
+            gb[i - lref] = gb[i];
+        }
     }
+    graph_unlock();
 
     g_GraphTraceLen = rref - lref;
     g_GraphStart = 0;
@@ -1450,45 +1514,65 @@ void Plot::keyPressEvent(QKeyEvent *event) {
                 g_GraphStart = startMax;
             break;
 
-        case Qt::Key_Equal:
+        case Qt::Key_Equal: {
+            int32_t *ob = graph_operation_buffer();
+            if (ob == NULL) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
-                g_OperationBuffer[g_MarkerA.pos] += 5;
+                ob[g_MarkerA.pos] += 5;
             } else {
-                g_OperationBuffer[g_MarkerA.pos] += 1;
+                ob[g_MarkerA.pos] += 1;
             }
 
             RepaintGraphWindow();
             break;
+        }
 
-        case Qt::Key_Minus:
+        case Qt::Key_Minus: {
+            int32_t *ob = graph_operation_buffer();
+            if (ob == NULL) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
-                g_OperationBuffer[g_MarkerA.pos] -= 5;
+                ob[g_MarkerA.pos] -= 5;
             } else {
-                g_OperationBuffer[g_MarkerA.pos] -= 1;
+                ob[g_MarkerA.pos] -= 1;
             }
 
             RepaintGraphWindow();
             break;
+        }
 
-        case Qt::Key_Plus:
+        case Qt::Key_Plus: {
+            int32_t *gb = graph_write();
+            if (gb == NULL) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
-                g_GraphBuffer[g_MarkerA.pos] += 5;
+                gb[g_MarkerA.pos] += 5;
             } else {
-                g_GraphBuffer[g_MarkerA.pos] += 1;
+                gb[g_MarkerA.pos] += 1;
             }
 
             RepaintGraphWindow();
             break;
+        }
 
-        case Qt::Key_Underscore:
+        case Qt::Key_Underscore: {
+            int32_t *gb = graph_write();
+            if (gb == NULL) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
-                g_GraphBuffer[g_MarkerA.pos] -= 5;
+                gb[g_MarkerA.pos] -= 5;
             } else {
-                g_GraphBuffer[g_MarkerA.pos] -= 1;
+                gb[g_MarkerA.pos] -= 1;
             }
 
             RepaintGraphWindow();
             break;
+        }
 
         case Qt::Key_BracketLeft: {
             if (event->modifiers() & Qt::ControlModifier) {
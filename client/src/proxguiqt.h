@@ -45,17 +45,17 @@ class Plot: public QWidget {
   private:
     QWidget *master;
     double g_GraphPixelsPerPoint; // How many visual pixels are between each sample point (x axis)
-    void PlotGraph(int *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum);
+    void PlotGraph(const int *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum);
     void PlotDemod(uint8_t *buffer, size_t len, QRect plotRect, QRect annotationRect, QPainter *painter, int graphNum, uint32_t plotOffset);
     void plotGridLines(QPainter *painter, QRect r);
-    void plotOperations(int *buffer, size_t len, QPainter *painter, QRect rect);
+    void plotOperations(const int *buffer, size_t len, QPainter *painter, QRect rect);
     void drawAnnotations(QRect annotationRect, QPainter *painter);
     void draw_marker(marker_t marker, QRect plotRect, QColor color, QPainter *painter);
     int xCoordOf(int i, QRect r);
     int yCoordOf(int v, QRect r, int maxVal);
     int valueOf_yCoord(int y, QRect r, int maxVal);
-    void setMaxAndStart(int *buffer, size_t len, QRect plotRect);
-    void appendMax(int *buffer, size_t len, QRect plotRect);
+    void setMaxAndStart(const int *buffer, size_t len, QRect plotRect);
+    void appendMax(const int *buffer, size_t len, QRect plotRect);
     QColor getColor(int graphNum);
 
   public:
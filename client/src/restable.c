@@ -0,0 +1,329 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Lookup tables of the JSON resources
+//-----------------------------------------------------------------------------
+#include "restable.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "jansson.h"
+#include "commonutil.h"  // ARRAYLEN
+#include "fileutils.h"
+#include "ui.h"
+#include "restable_builtin.h"
+
+typedef struct {
+    const restable_t *table;    // in use, the built-in one or loaded
+    char *path;                 // file it stands for, NULL when none was found
+    int64_t size;
+    int64_t mtime;
+    time_t checked_at;
+    // owned when the table was loaded from the file
+    restable_t loaded;
+    json_t *root;
+    const char **cells;
+    uint32_t *order;
+} restable_cache_t;
+
+static restable_cache_t restable_cache[ARRAYLEN(restable_builtin)];
+
+// 32 bit FNV-1a, same as fnv1a() in pm3_json2table.py
+static uint32_t restable_hash(const uint8_t *d, size_t n) {
+    uint32_t h = 0x811c9dc5;
+    for (size_t i = 0; i < n; i++) {
+        h ^= d[i];
+        h *= 0x01000193;
+    }
+    return h;
+}
+
+// ASCII only, same order as the generator sorts in
+static int restable_strcasecmp(const char *a, const char *b) {
+    const uint8_t *ua = (const uint8_t *)a;
+    const uint8_t *ub = (const uint8_t *)b;
+    for (;; ua++, ub++) {
+        uint8_t ca = (*ua >= 'A' && *ua <= 'Z') ? *ua + 0x20 : *ua;
+        uint8_t cb = (*ub >= 'A' && *ub <= 'Z') ? *ub + 0x20 : *ub;
+        if (ca != cb || ca == 0) {
+            return ca - cb;
+        }
+    }
+}
+
+static const char *restable_key(const restable_t *t, uint32_t rec) {
+    const char *key = t->cells[rec * t->nfields];
+    return (key) ? key : "";
+}
+
+static const restable_t *g_sort_table;
+
+static int restable_cmp(const void *a, const void *b) {
+    uint32_t ra = *(const uint32_t *)a;
+    uint32_t rb = *(const uint32_t *)b;
+    int res = restable_strcasecmp(restable_key(g_sort_table, ra), restable_key(g_sort_table, rb));
+    if (res) {
+        return res;
+    }
+    return (ra > rb) - (ra < rb);
+}
+
+static void restable_unload(restable_cache_t *c) {
+    json_decref(c->root);
+    free(c->cells);
+    free(c->order);
+    c->root = NULL;
+    c->cells = NULL;
+    c->order = NULL;
+    c->table = NULL;
+}
+
+static const char *restable_json_str(json_t *data, const char *name) {
+    json_t *jstr = json_object_get(data, name);
+    if (jstr == NULL) {
+        return NULL;
+    }
+    if (json_is_string(jstr) == false) {
+        PrintAndLogEx(WARNING, _YELLOW_("`%s`") " is not a string", name);
+        return NULL;
+    }
+    return json_string_value(jstr);
+}
+
+// builds the table of a file that differs from the built-in one,
+// with the same cells, strings stay in the json tree
+static int restable_load(restable_cache_t *c, const restable_t *builtin, const char *path, const uint8_t *data, size_t datalen) {
+
+    json_error_t error;
+    json_t *root = json_loadb((const char *)data, datalen, 0, &error);
+    if (root == NULL) {
+        PrintAndLogEx(ERR, "json (%s) error on line %d: %s", path, error.line, error.text);
+        return PM3_ESOFT;
+    }
+
+    if (json_is_array(root) == false && json_is_object(root) == false) {
+        PrintAndLogEx(ERR, "Invalid json (%s) format. root must be an array.", path);
+        json_decref(root);
+        return PM3_ESOFT;
+    }
+
+    // object root, the key is the member name
+    size_t n = json_is_array(root) ? json_array_size(root) : json_object_size(root);
+    const char **cells = calloc(n * builtin->nfields + 1, sizeof(char *));
+    uint32_t *order = calloc(n + 1, sizeof(uint32_t));
+    if (cells == NULL || order == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(cells);
+        free(order);
+        json_decref(root);
+        return PM3_EMALLOC;
+    }
+
+    size_t count = 0;
+    if (json_is_array(root)) {
+        for (size_t i = 0; i < n; i++) {
+            json_t *elm = json_array_get(root, i);
+            if (json_is_object(elm) == false) {
+                PrintAndLogEx(ERR, "data [%zu] is not an object\n", i);
+                continue;
+            }
+            for (size_t f = 0; f < builtin->nfields; f++) {
+                cells[count * builtin->nfields + f] = restable_json_str(elm, builtin->fields[f]);
+            }
+            count++;
+        }
+    } else {
+        const char *key;
+        json_t *elm;
+        json_object_foreach(root, key, elm) {
+            if (json_is_object(elm) == false) {
+                continue;
+            }
+            cells[count * builtin->nfields] = key;
+            for (size_t f = 1; f < builtin->nfields; f++) {
+                cells[count * builtin->nfields + f] = restable_json_str(elm, builtin->fields[f]);
+            }
+            count++;
+        }
+    }
+
+    restable_t *t = &c->loaded;
+    *t = *builtin;
+    t->cells = cells;
+    t->order = order;
+    t->count = count;
+    t->json_size = datalen;
+    t->json_hash = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    g_sort_table = t;
+    qsort(order, count, sizeof(uint32_t), restable_cmp);
+
+    c->root = root;
+    c->cells = cells;
+    c->order = order;
+    c->table = t;
+    return PM3_SUCCESS;
+}
+
+static uint8_t *restable_read(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+
+    uint8_t *data = NULL;
+    if (fseek(f, 0, SEEK_END) == 0) {
+        long size = ftell(f);
+        if (size >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+            data = calloc(size + 1, sizeof(uint8_t));
+            if (data && fread(data, 1, size, f) != (size_t)size) {
+                free(data);
+                data = NULL;
+            }
+            *len = size;
+        }
+    }
+    fclose(f);
+    return data;
+}
+
+const restable_t *restable_open(const char *name, bool verbose) {
+
+    size_t idx = 0;
+    for (; idx < ARRAYLEN(restable_builtin); idx++) {
+        if (strcmp(restable_builtin[idx].name, name) == 0) {
+            break;
+        }
+    }
+    if (idx == ARRAYLEN(restable_builtin)) {
+        return NULL;
+    }
+
+    const restable_t *builtin = &restable_builtin[idx];
+    restable_cache_t *c = &restable_cache[idx];
+
+    char *path = NULL;
+    if (searchFile(&path, RESOURCES_SUBDIR, name, ".json", true) != PM3_SUCCESS) {
+        // nothing on disk, the one compiled in is all there is
+        restable_unload(c);
+        free(c->path);
+        c->path = NULL;
+        c->table = builtin;
+        if (verbose) {
+            PrintAndLogEx(SUCCESS, "Loaded built-in `" _YELLOW_("%s") "` " _GREEN_("%zu") " records ( " _GREEN_("ok") " )", name, builtin->count);
+        }
+        return builtin;
+    }
+
+#ifdef _WIN32
+    struct _stat st;
+    int res = _stat(path, &st);
+#else
+    struct stat st;
+    int res = stat(path, &st);
+#endif
+
+    // same file as last time, and not changed since. A change within the second
+    // it was checked in doesn't show in the mtime
+    if (res == 0 && c->table && c->path && strcmp(c->path, path) == 0 &&
+            st.st_size == c->size && st.st_mtime == c->mtime && c->mtime < c->checked_at) {
+        free(path);
+        return c->table;
+    }
+
+    restable_unload(c);
+    free(c->path);
+    c->path = NULL;
+
+    size_t datalen = 0;
+    uint8_t *data = restable_read(path, &datalen);
+    if (data == NULL) {
+        PrintAndLogEx(ERR, "could not read file " _YELLOW_("%s"), path);
+        free(path);
+        return NULL;
+    }
+
+    if (datalen == builtin->json_size && restable_hash(data, datalen) == builtin->json_hash) {
+        c->table = builtin;
+    } else if (restable_load(c, builtin, path, data, datalen) != PM3_SUCCESS) {
+        free(data);
+        free(path);
+        return NULL;
+    }
+    free(data);
+
+    c->path = path;
+    c->size = (res == 0) ? st.st_size : -1;
+    c->mtime = (res == 0) ? st.st_mtime : -1;
+    c->checked_at = time(NULL);
+
+    if (verbose) {
+        PrintAndLogEx(SUCCESS, "Loaded file `" _YELLOW_("%s") "` " _GREEN_("%zu") " records ( " _GREEN_("ok") " )", path, c->table->count);
+    }
+    return c->table;
+}
+
+const char *restable_get(const restable_t *t, size_t rec, size_t field) {
+    if (t == NULL || rec >= t->count || field >= t->nfields) {
+        return NULL;
+    }
+    return t->cells[rec * t->nfields + field];
+}
+
+size_t restable_lower_bound(const restable_t *t, const char *key) {
+    size_t lo = 0, hi = t->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (restable_strcasecmp(restable_key(t, t->order[mid]), key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+int restable_find(const restable_t *t, const char *key) {
+    if (t == NULL || key == NULL) {
+        return -1;
+    }
+    size_t pos = restable_lower_bound(t, key);
+    if (pos < t->count && restable_strcasecmp(restable_key(t, t->order[pos]), key) == 0) {
+        return t->order[pos];
+    }
+    return -1;
+}
+
+int restable_find_case(const restable_t *t, const char *key) {
+    if (t == NULL || key == NULL) {
+        return -1;
+    }
+    for (size_t pos = restable_lower_bound(t, key); pos < t->count; pos++) {
+        const char *k = restable_key(t, t->order[pos]);
+        if (restable_strcasecmp(k, key) != 0) {
+            break;
+        }
+        if (strcmp(k, key) == 0) {
+            return t->order[pos];
+        }
+    }
+    return -1;
+}
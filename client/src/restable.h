@@ -0,0 +1,64 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Lookup tables of the JSON resources
+//
+// The lookup resources (aidlist, mad, aid_desfire, oids) are turned into flat
+// tables: records in file order, each one a row of string cells, and an index
+// of the records sorted on their key. The shipped resources are compiled in,
+// see restable_builtin.h. A resource file which doesn't match its built-in
+// table, a user copy or one edited after the build, is parsed once instead and
+// the resulting table is kept until the file changes again.
+//-----------------------------------------------------------------------------
+
+#ifndef RESTABLE_H__
+#define RESTABLE_H__
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char *name;            // resources/<name>.json
+    const char *const *fields;   // cell names, the first one is the key
+    size_t nfields;
+    const char *const *cells;    // count * nfields, NULL when the record lacks it
+    const uint32_t *order;       // records sorted on their key, case-insensitive
+    size_t count;
+    size_t json_size;            // of the file the built-in table was made from
+    uint32_t json_hash;
+} restable_t;
+
+// table of resources/<name>.json, NULL when there is none
+const restable_t *restable_open(const char *name, bool verbose);
+
+// cell of a record, NULL when absent
+const char *restable_get(const restable_t *t, size_t rec, size_t field);
+
+// first record in file order whose key equals key, case-insensitive. -1 when none
+int restable_find(const restable_t *t, const char *key);
+
+// same, with the key matching case as well
+int restable_find_case(const restable_t *t, const char *key);
+
+// first position in t->order whose key is not below key, case-insensitive
+size_t restable_lower_bound(const restable_t *t, const char *key);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
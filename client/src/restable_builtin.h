@@ -0,0 +1,5160 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// *DO NOT EDIT MANUALLY*
+// Autogenerated with pm3_json2table.py from client/resources
+//-----------------------------------------------------------------------------
+
+#ifndef RESTABLE_BUILTIN_H__
+#define RESTABLE_BUILTIN_H__
+
+#include "restable.h"
+
+static const char *const restable_aid_desfire_fields[] = {
+    "AID", "Vendor", "Country", "Name", "Description", "Type"
+};
+
+static const char *const restable_aid_desfire_cells[] = {
+    "EEEE10", "NFC Forum", "US", "NDEF Tag \xe2\x80\x94 Type 4 Version 1", "FID 03: Capability Container", "ndef",
+    "000357", "LEGIC", "DE", "LEGIC", "FID 02: EF-CONF", "pacs",
+    "0584DF", "GANTNER ELECTRONIC GMBH via SALTO SYSTEMS S.L", "AT", "Gantner GAT NET.Lock / GAT Eco.Lock / GAT ECO.Side Credential", "Gantner GAT NET.Lock / GAT Eco.Lock / GAT ECO.Side Credential", "pacs",
+    "1023F5", "Integrated Control Technology Limited (ICT)", "NZ", "ICT Access Credential", "Default Secondary Application", "pacs",
+    "2081F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2181F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2281F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2381F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2481F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2581F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2681F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2781F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2881F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2981F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2A81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2B81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2C81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2D81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2E81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application (Alternative Endian)", "pacs",
+    "2F81F4", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Card Application Directory (CAD) (Alternative Endian)", "pacs",
+    "4791DA", "Prima Systems", "SI", "Prima FlexAir Access Control", "FIDs 00: DRM; 01: Access Event Log; 04: Access Permissions", "pacs",
+    "53494F", "HID", "US", "SIO DESFire EV1 - HID Factory", "Access Control", "pacs",
+    "6F706C", "Openpath", "US", "Openpath PACS Application", "Access Control", "pacs",
+    "706000", "RBH Access Technologies, Inc.", "CA", "BlueLINE EV1 PACS Credential", "Access Control", "pacs",
+    "D3494F", "HID", "US", "SIO DESFire EV1 - Field Encoder", "Access Control", "pacs",
+    "D9494F", "HID", "US", "SIO DESFire EV1 - Field Encoder", "Access Control", "pacs",
+    "F47300", "Inner Range Pty Ltd", "AU", "SIFER-P / SIFER-U Credential", "Inner Range Access Control", "pacs",
+    "F473A0", "Securitron via ASSA ABLOY", "US", "Securitron DESFire EV2 Credential", "Securitron DESFire EV2 Credential", "pacs",
+    "F48120", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48121", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48122", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48123", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48124", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48125", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48126", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48127", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48128", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F48129", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F4812A", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F4812B", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Cardax Card Data Application", "pacs",
+    "F4812C", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application", "pacs",
+    "F4812D", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application", "pacs",
+    "F4812E", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Unused Cardax Card Data Application", "pacs",
+    "F4812F", "Gallagher Group Limited via PEC (New Zealand) Limited", "NZ", "Gallagher Security Credential", "Card Application Directory (CAD)", "pacs",
+    "F484D1", "HID", "US", "Unknown DESFire EV1", "Access Control", "pacs",
+    "F484E3", "HID", "US", "SIO DESFire EV3 - Field Encoder", "Access Control", "pacs",
+    "F484E4", "HID", "US", "SIO DESFire EV3 - HID Factory", "Access Control", "pacs",
+    "F48EF1", "Salto Systems", "ES", "Salto Systems", "Access Control", "pacs",
+    "F48EFD", "Salto Systems", "ES", "Salto KS", "Key as a Service // FID 01: Standard Data", "pacs",
+    "F51780", "ASSA ABLOY", "SE", "SMARTair", "SMARTair Credential", "pacs",
+    "F51BC0", "STid Group", "FR", "CCT Card / DTA Tag / PCG Fob", "STid Easyline / Architect Access Credentials", "pacs",
+    "F52310", "Integrated Control Technology Limited (ICT)", "NZ", "ICT Access Credential", "Default Primary Application", "pacs",
+    "F52318", "Integrated Control Technology Limited (ICT)", "NZ", "ICT Access Credential", "Default Custom Application", "pacs",
+    "F5231E", "Integrated Control Technology Limited (ICT)", "NZ", "ICT Access Credential", "Interoperability Application", "pacs",
+    "F5231F", "Integrated Control Technology Limited (ICT)", "NZ", "ICT Access Credential", "Third-Party Locking Application", "pacs",
+    "F53280", "dormakaba", "CH", "mobile access", "Digital Keys Sent To The dormakaba mobile access App", "pacs",
+    "F534F1", "MOBOTIX AG", "DE", "MOBOTIX AG Access Credential", "T26 Outdoor Station and Access Module Credential", "pacs",
+    "F518F0", "Telenot Electronic GmbH", "DE", "Telenot Tag", "", "alarm system",
+    "010010", "ASSA ABLOY", "GB", "Campus Card", "Campus Card", "student",
+    "030020", "Algonquin College of Applied Arts and Technology", "CA", "Campus Card", "Campus Card", "student",
+    "050030", "Algonquin College of Applied Arts and Technology", "CA", "Campus Card", "Campus Card", "student",
+    "05845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "070090", "Algonquin College of Applied Arts and Technology", "CA", "Campus Card", "Campus Card", "student",
+    "15845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "25845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "3086F5", "CNOUS/CROUS via MONECARTE", "FR", "European Student Card (ESC)", "Multiservice Student Card", "student",
+    "35845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "4085F5", "CNOUS/CROUS via MONECARTE", "FR", "European Student Card (ESC)", "Multiservice Student Card", "student",
+    "764970", "Ubiquiti Inc", "N/A", "UniFi Access VID App", "Contains issuer-signed static credential information used for KDF & other authentication operations", "pacs",
+    "84D3FC", "Ubiquiti Inc", "N/A", "UniFi Access FCD App", "Contains static credential information used for KDF & other authentication operations", "pacs",
+    "416343", "Ubiquiti Inc", "N/A", "UniFi Access ACC App", "Application created after enrollment into the system, containins unique authentication info", "pacs",
+    "454955", "Ubiquiti Inc", "N/A", "UniFi Access Touch Pass Apple Wallet Express", "AID value is 'UIE' (UniFi Express) reversed. This app is selectable with or without auth", "pacs",
+    "534955", "Ubiquiti Inc", "N/A", "UniFi Access Touch Pass Apple Wallet Secure", "AID value is 'UIS' (UniFi Secure) reversed. This app is selectable only after manual auth", "pacs",
+    "535501", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535502", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535503", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535504", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535505", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535506", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535507", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535508", "TU Delft", "NL", "Uni Delft", "", "student",
+    "535509", "TU Delft", "NL", "Uni Delft", "", "student",
+    "53550A", "TU Delft", "NL", "Uni Delft", "", "student",
+    "53550B", "TU Delft", "NL", "Uni Delft", "", "student",
+    "554E49", "Slovenian Universities", "SI", "Slovenian University Student ID", "Issued by University of Ljubljana, Maribor and Primorska", "student",
+    "55845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "65845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "7086F5", "CNOUS/CROUS via MONECARTE", "FR", "European Student Card (ESC)", "Multiservice Student Card", "student",
+    "75845F", "InterCard GmbH Kartensysteme", "DE", "InterCard", "Campus Card", "student",
+    "9180F3", "CNOUS/CROUS via MONECARTE", "FR", "European Student Card (ESC)", "Multiservice Student Card", "student",
+    "A086F5", "CNOUS/CROUS via MONECARTE", "FR", "European Student Card (ESC)", "Multiservice Student Card", "student",
+    "BBBBB3", "Transact Campus Inc.", "US", "Transact Campus ID", "Campus Card", "student",
+    "BBBBBB", "Transact Campus Inc.", "US", "Transact Campus ID", "Campus Card", "student",
+    "BBBBDA", "Transact Campus Inc.", "US", "Transact Campus ID", "Campus Card", "student",
+    "BCBCBC", "Transact Campus Inc.", "US", "Transact Campus ID", "Campus Card", "student",
+    "CA1827", "Transact Campus Inc.", "US", "Transact Campus ID (Custom AID)", "Campus Card", "student",
+    "EEE010", "ASSA ABLOY", "GB", "Campus Card", "Campus Card", "student",
+    "F33480", "Besucherausweis", "DE", "Visitor Badge", "Besucherausweis", "student",
+    "F482D0", "Besucherausweis", "DE", "Visitor's Pass", "Besucherausweis", "student",
+    "F48EF1", "TU Delft", "NL", "Uni Delft", "", "student",
+    "F5217D", "TU Delft", "NL", "Uni Delft", "", "student",
+    "F88280", "TU Delft", "NL", "Uni Delft", "", "student",
+    "27E178", "Disney", "US", "Disney MagicBand", "", "payment system",
+    "44434C", "Disney", "US", "Disney MagicBand", "AID found on MagicBand desfire cards", "payment system",
+    "78E127", "Disney", "US", "Disney MagicBand", "", "payment system",
+    "956B19", "Alfa-Zet", "BE", "ping.ping Tag", "ping.ping App 1", "payment system",
+    "DB9800", "Alfa-Zet", "BE", "ping.ping Tag", "ping.ping App 2", "payment system",
+    "DB9801", "Alfa-Zet", "BE", "ping.ping Tag", "ping.ping App 3", "payment system",
+    "DB9802", "Alfa-Zet", "BE", "ping.ping Tag", "ping.ping App 4", "payment system",
+    "F38091", "Microtronic AG", "CH", "Microtronic Tag", "", "payment system",
+    "F380F0", "Air Amsterdam via Microtronic AG", "NL", "Club AIR Amsterdam Card", "AIR Amsterdam Prepaid Card", "payment system",
+    "C26001", "car2go", "DE", "MemberCard", "car2go - Member Card // Multi Functional Badge / Private Application #1", "carsharing",
+    "000005", "Transports Metropolitans de Barcelona (TMB)", "ES", "T-mobilitat (BCN)", "BCN T-mobilitat", "transport",
+    "000001", "Invalid / Reserved", "", "Invalid / Reserved", "Used by ATL Breeze, PHL FREEDOM, and YVR Compass", "transport",
+    "0000F0", "Metropolitan Transportation Authority (MTA) / Bayerische Motoren Werke (BMW) AG", "US / DE", "OMNY (One Metro New York) (JFK) / BMW Digital Key", "JFK OMNY (One Metro New York) Card / BMW Digital Key 5B3611-01", "transport",
+    "002000", "Metrolinx", "CA", "PRESTO Card (YYZ/YHM/YOW)", "FIDs 00,0F: Backup Data; 08-0E,10-14: Standard Data", "transport",
+    "010000", "Consorcio Regional de Transportes Publicos Regulares de Madrid (CRTM)", "ES", "Tarjeta Transporte Publico (MAD)", "MAD Public Transport Card", "transport",
+    "012242", "Belbim", "TR", "Istanbulkart (IST)", "IST Istanbul Card (eBilet App)", "transport",
+    "014D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 1)", "transport",
+    "015342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0183F1", "Wroclaw Urban Transportation System ", "PL", "URBANCARD (WRO)", "WRO URBANCARD (URBANCARD Holder App)", "transport",
+    "024D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 2)", "transport",
+    "025342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0283F1", "Wroclaw Urban Transportation System ", "PL", "URBANCARD (WRO)", "WRO URBANCARD (URBANCARD EP App)", "transport",
+    "034D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 3)", "transport",
+    "035342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0383F1", "Wroclaw Urban Transportation System ", "PL", "URBANCARD (WRO)", "WRO URBANCARD (URBANCARD Term App)", "transport",
+    "042242", "Belbim", "TR", "Istanbulkart (IST)", "IST Istanbul Card (Unknown App)", "transport",
+    "044D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 4)", "transport",
+    "045342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "052242", "Belbim", "TR", "Istanbulkart (IST)", "IST Istanbul Card (ISPARK App)", "transport",
+    "054D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 5)", "transport",
+    "055342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "062242", "Belbim", "TR", "Istanbulkart (IST)", "IST Istanbul Card (App 6)", "transport",
+    "064D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 6)", "transport",
+    "065342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "074D44", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL) (Alternative Endian)", "DEL Delhi Metro (App 7)", "transport",
+    "075342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "085342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "087522", "Umo Mobility via Cubic Transportation Systems", "US / CA", "Umo Mobility Card", "Umo Mobility Card", "transport",
+    "095342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0A5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0B5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0C5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0D5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0E5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "0F5342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "105342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "115342", "Bangkok Expressway and Metro Public Limited Company (BEM)", "TH", "MRT Stored Value Card (BKK)", "Might also be used by BKK MRT Plus and/or BKK Park & Ride Plus Cards", "transport",
+    "2211AF", "National Transport Authority", "IE", "TFI Leap Card (DUB)", "DUB Leap Card // Transport for Ireland // FIDs: 01,1F: Backup Data; 02-0A: Standard Data", "transport",
+    "402301", "Ministry of Transport, Communications and Works of the Republic of Cyprus", "CY", "motion BUS CARD (ECN)", "ECN motion BUS CARD (App 1)", "transport",
+    "415431", "Athens Urban Transport Organization (OASA)", "GR", "ATH.ENA CARD (ATH)", "ATH ATH.ENA CARD", "transport",
+    "444D01", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 1)", "transport",
+    "444D02", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 2)", "transport",
+    "444D03", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 3)", "transport",
+    "444D04", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 4)", "transport",
+    "444D05", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 5)", "transport",
+    "444D06", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 6)", "transport",
+    "444D07", "Delhi Metro Rail Corporation Limited", "IN", "Delhi Metro Travel Card (DEL)", "DEL Delhi Metro (App 7)", "transport",
+    "484000", "Sistema de Tren Eletrico Urbano (SITEUR)", "MX", "Mi Movilidad Card (GDL)", "GDL Mi Movilidad Card", "transport",
+    "4F5931", "Transport for London (TfL)", "UK", "Oyster Card (LHR)", "FIDs: 00-07: Standard Data", "transport",
+    "502301", "Ministry of Transport, Communications and Works of the Republic of Cyprus", "CY", "motion BUS CARD (ECN)", "ECN motion BUS CARD (App 2)", "transport",
+    "534531", "Transport for New South Wales (TfNSW)", "AU", "Opal Card (SYD)", "FIDs 00-06: Standard Data; 07: Card Balance/Number and Trip History", "transport",
+    "554000", "Auckland Transport", "NZ", "AT HOP Card (AKL)", "FIDs: 00: Backup Data; 08/09/0A", "transport",
+    "578000", "Norwegian Public Roads Administration (NPRA)", "NO", "NORTIC (Norway Public Transport Card) (Card Issuer App)", "Norwegian Ticketing Interoperable Concept // FID 0C: Card Issuer Header", "transport",
+    "578001", "Norwegian Public Roads Administration (NPRA)", "NO", "NORTIC (Norway Public Transport Card) (Transport App)", "FIDs 01: Product Retailer; 02: Service Provider; 03: Special Event; 04: Stored Value; 05: General Event Log; 06: SV Reload Log; 0A: Environment; 0C: Card Holder", "transport",
+    "602301", "Ministry of Transport, Communications and Works of the Republic of Cyprus", "CY", "motion BUS CARD (ECN)", "ECN motion BUS CARD (App 3)", "transport",
+    "634000", "Doha Metro and Lusail Tram via Qatar Rail", "QA", "Travel Pass (DOH)", "DOH Standard / goldclub Travel Passes // FIDs 00,04-06: Standard; 01-03,17: Backup; 07-16,18: Value; 19: Cyclic; 1A: Linear", "transport",
+    "677F8E", "Umo Mobility via Cubic Transportation Systems", "US / CA", "Umo Mobility Card", "Umo Mobility Card", "transport",
+    "7A007A", "Regional Transportation Commission of Southern Nevada (RTC) via Masabi Ltd", "US", "RTC TAP & GO (LAS)", "LAS TAP & GO; Masabi Justride Tap and Ride DESFire Smartcard", "transport",
+    "784000", "Roads & Transport Authority (Government of Dubai)", "AE", "nol Card (DXB)", "DXB nol Card", "transport",
+    "992CB5", "Umo Mobility via Cubic Transportation Systems", "US / CA", "Umo Mobility Card", "Umo Mobility Card", "transport",
+    "A00216", "ITSO Ltd", "UK", "GWR touch (BRS) / EMR Smartcard (EMA) / WYTCL MCard (LBA)", "ITSO Public Transport Application // Provision of Citizen Services #0", "transport",
+    "A4237D", "Umo Mobility via Cubic Transportation Systems", "US / CA", "Umo Mobility Card", "Umo Mobility Card", "transport",
+    "C65B80", "Umo Mobility via Cubic Transportation Systems", "US / CA", "Umo Mobility Card", "Umo Mobility Card", "transport",
+    "9034CA", "Urban Mobility Center", "BG", "Sofia City Card (SOF)", "SOF Sofia City Card", "transport",
+    "CC00CC", "Central Ohio Transit Authority (COTA) via Masabi Ltd", "US", "COTA Smartcard (CMH)", "CMH COTA Smartcard; Masabi Justride Tap and Ride DESFire Smartcard", "transport",
+    "D000D0", "Greater Dayton Regional Transit Authority (RTA) via Masabi Ltd", "US", "RTA Tapp Pay Card (DAY)", "DAY RTA Tapp Pay Card; Masabi Justride Tap and Ride DESFire Smartcard", "transport",
+    "DD00DD", "Regional Transporation District (RTD) via Masabi Ltd", "US", "MyRide Card (DEN)", "DEN MyRide Card; Masabi Justride Tap and Ride DESFire Smartcard", "transport",
+    "EF2011", "Helsinki Region Transport (HRT)", "FI", "HSL Card (HEL/TLL/TAY)", "HEL/TLL/TAY HSL Card", "transport",
+    "F001D0", "Arabako Foru Aldundia", "ES", "BAT Card (VIT)", "VIT BAT Card // Used on Euskotren // Interoperable PT Card", "transport",
+    "F206B0", "Adelaide Metro via Affiliated Computer Services (ACS)", "AU", "metroCARD (ADL)", "FIDs 00,02-07,09-0B,10-17,1B-1C: Backup Data; 01,1D: Linear Record File; 08: ABNote/HID Adelaide; 1E: Standard Data; 0C-0F: Card Balance", "transport",
+    "F21030", "Puget Sound Transit Agencies via Vix Technologies", "US", "ORCA (One Regional Card for All) (SEA)", "One Regional Card For All // FIDs 02: Trip History; 04: current balance", "transport",
+    "F21050", "Metro Christchurch via INIT / Arc", "NZ / CA", "Metrocard (CHC) / Arc (YEG)", "CHC FIDs: 00: Backup Data; 01/02: Trip History; 03: Card Balance", "transport",
+    "F210E0", "TriMet", "US", "hop fastpass (PDX)", "PDX hop fastpass Card", "transport",
+    "F210F0", "Public Transport Victoria (PTV) via Conduent (formerly via Keane Australia Pty Ltd)", "AU", "myki (MEL)", "FIDs 01-02: Transaction History; 03: myki money Balance; 00,04-05: Backup Data; 08-0C,0F: Standard Data", "transport",
+    "F21100", "Public Transport Victoria (PTV) via Conduent (formerly via Keane Australia Pty Ltd)", "AU", "myki (MEL)", "FIDs 0F: Standard Data; 00: Backup Data", "transport",
+    "F21150", "Prague Public Transit Company via Haguess a.s.", "CZ", "Litacka Opencard (PRG)", "PRG Litacka Opencard", "transport",
+    "F21190", "Metropolitan Transportation Commission via Cubic", "US", "Clipper Card (SFO)", "FIDs 02: Card Balance; 04: Refill History; 08: Card Information; 0E: Trip History", "transport",
+    "F21191", "Metropolitan Transportation Commission via Cubic", "US", "Clipper Card (Mobile)", "", "transport",
+    "F21201", "Green Bay Metro Transit via Genfare / Winnipeg Transit", "US / CA", "Tap-N-Go Card (GRB) / peggo card (YWG)", "GRB Tap-N-Go Card / YWG peggo card", "transport",
+    "F21202", "Green Bay Metro Transit via Genfare", "US", "Tap-N-Go Card (GRB)", "GRB Tap-N-Go Card", "transport",
+    "F212A0", "CTtransit", "US", "Go CT Card (BDL)", "BDL Go CT Card", "transport",
+    "F21360", "INIT", "US", "HOLO Card (HNL)", "HNL HOLO Card", "transport",
+    "F21381", "Chicago Transit Authority (CTA) via Cubic", "US", "Ventra Card (ORD)", "ORD Ventra Card (Gen 2 Blue) // Multi-Modal Transit #1 // FIDs 00-01: Standard Data", "transport",
+    "F21390", "Multiple NZ Transit Agencies via Otago Regional Council", "NZ", "Bee Card (DUD)", "Multi-Modal Transit #0 // FIDs 00: Backup Data; 01-02: Trip History; 03: Card Balance", "transport",
+    "F213A0", "Rhode Island Public Transport Authority (RIPTA) via INIT", "US", "Wave Smart Card (PVD)", "PVD Wave Smart Card", "transport",
+    "F213F0", "Puget Sound Transit Agencies via Vix Technologies", "US", "ORCA (One Regional Card for All) (SEA)", "One Regional Card for All // FIDs 00: Standard Data; 01: Backup Data", "transport",
+    "F40110", "ITSO Ltd", "UK", "GWR touch (BRS) / EMR Smartcard (EMA)", "UK National Smartcard Project // Provision of Citizen Services #1", "transport",
+    "F40111", "ITSO Ltd", "UK", "GWR touch (BRS) / EMR Smartcard (EMA)", "UK National Smartcard Project // Provision of Citizen Services #2", "transport",
+    "F40112", "ITSO Ltd", "UK", "GWR touch (BRS) / EMR Smartcard (EMA)", "UK National Smartcard Project // Provision of Citizen Services #3", "transport",
+    "F40113", "ITSO Ltd", "UK", "GWR touch (BRS) / EMR Smartcard (EMA)", "UK National Smartcard Project // Provision of Citizen Services #4", "transport",
+    "FF30FF", "Metrolinx", "CA", "PRESTO Card (YYZ/YHM/YOW)", "FID 08: Standard Data", "transport",
+    "FFFFFF", "Reserved for Future Use", "", "Reserved for Future Use", "Used by AKL AT HOP, DXB nol, and SEA ORCA", "transport",
+};
+
+static const uint32_t restable_aid_desfire_order[] = {
+    113, 112, 114, 1, 115, 116, 58, 117, 118, 119, 120, 121, 122, 123, 59, 124,
+    125, 126, 127, 128, 129, 60, 130, 131, 132, 61, 2, 133, 134, 135, 62, 136,
+    137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 3, 147, 148, 63, 4, 5,
+    149, 6, 7, 8, 9, 64, 10, 11, 102, 12, 13, 14, 15, 16, 17, 18,
+    19, 65, 66, 150, 67, 151, 70, 103, 152, 153, 154, 155, 156, 157, 158, 71,
+    20, 159, 160, 161, 162, 21, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 163, 84, 85, 164, 165, 166, 167, 86, 168, 22, 23, 87, 88, 68,
+    170, 104, 169, 69, 175, 89, 105, 171, 172, 90, 173, 91, 92, 93, 94, 111,
+    174, 95, 176, 177, 24, 25, 106, 107, 108, 178, 96, 0, 179, 180, 181, 182,
+    183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 97,
+    109, 110, 198, 199, 200, 201, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 98, 44, 45, 46, 47, 99, 48, 49,
+    57, 50, 100, 51, 52, 53, 54, 55, 56, 101, 202, 203,
+};
+
+static const char *const restable_aidlist_fields[] = {
+    "AID", "Vendor", "Country", "Name", "Description", "Type"
+};
+
+static const char *const restable_aidlist_cells[] = {
+    "315041592E5359532E4444463031", "EMV", "United States", "EMV Payment System Environment - PSE (1PAY.SYS.DDF01)", "", "",
+    "325041592E5359532E4444463031", "EMV", "United States", "EMV Proximity Payment System Environment - PPSE (2PAY.SYS.DDF01)", "Visa payWave for Mobile", "",
+    "44464D46412E44466172653234313031", "DeviceFidelity", "United States", "DeviceFidelity In2Pay DFare applet", "http://www.nfcworld.com/2010/11/24/35207/devicefidelity-adds-nfc-support-for-android-and-mifare/", "",
+    "A00000000101", "PBS Danmnt A/S", "Denmark", "MUSCLE Card Applet", "(Unlicensed use of this RID. Proposal to use A000000323 instead)", "",
+    "A000000003000000", "Visa International", "United States", "(VISA) Card Manager", "Used by most GP2.1.1 cards / Oberthur OP201 cards. Visa Proprietary Card Manager AID for OpenPlatform cards (visa.openplatform).", "GP",
+    "A00000000300037561", "Visa International", "United States", "Bonuscard", "", "",
+    "A00000000305076010", "Visa International", "United States", "VISA ELO Credit", "", "EMV",
+    "A0000000031010", "Visa International", "United States", "VISA Debit/Credit (Classic)", "Standard/Gold VISA credit card", "EMV",
+    "A000000003101001", "Visa International", "United States", "VISA Credit", "", "EMV",
+    "A000000003101002", "Visa International", "United States", "VISA Debit", "", "EMV",
+    "A0000000032010", "Visa International", "United States", "VISA Electron", "VISA Electron (Debit)", "EMV",
+    "A0000000032020", "Visa International", "United States", "VISA", "V PAY", "EMV",
+    "A0000000033010", "Visa International", "United States", "VISA Interlink", "VISA Interlink", "EMV",
+    "A0000000034010", "Visa International", "United States", "VISA Specific", "Visa Specific", "EMV",
+    "A0000000035010", "Visa International", "United States", "VISA Specific", "Visa Specific", "EMV",
+    "A000000003534441", "Visa International", "United States", "Schlumberger Security Domain", "", "GP",
+    "A0000000035350", "Visa International", "United States", "Security Domain", "OCS Oberthur Card System Security Domain Package AID / VGP Card Manager (for ISD and ASD)", "GP",
+    "A000000003535041", "Visa International", "United States", "Security Domain", "OCS Oberthur Card System Security Domain Applet AID / VGP Card Manager (for ISD and ASD)", "GP",
+    "A0000000036010", "Visa International", "United States", "Domestic Visa Cash Stored Value", "", "EMV",
+    "A0000000036020", "Visa International", "United States", "International Visa Cash Stored Value", "", "EMV",
+    "A0000000038002", "Visa International", "United States", "VISA Auth, VisaRemAuthen EMV-CAP (DPA)", "VISA Auth dynamic passcode authentication (DPA). Used by Barclays/HBOS", "EMV",
+    "A0000000038010", "Visa International", "United States", "VISA Plus", "VISA plus", "EMV",
+    "A0000000039010", "Visa International", "United States", "VISA Loyalty", "", "EMV",
+    "A000000003999910", "Visa International", "United States", "VISA Proprietary ATM", "", "EMV",
+    "A0000000040000", "Mastercard International", "United States", "MasterCard Card Manager", "Security Domain", "GP",
+    "A00000000401", "Mastercard International", "United States", "MasterCard PayPass", "AEPM (Association Europenne Payez Mobile)", "EMV",
+    "A0000000041010", "Mastercard International", "United States", "MasterCard Credit/Debit (Global)", "Standard MasterCard", "EMV",
+    "A00000000410101213", "Mastercard International", "United States", "MasterCard Credit", "Standard MasterCard", "EMV",
+    "A00000000410101215", "Mastercard International", "United States", "MasterCard Credit", "Standard MasterCard", "EMV",
+    "A0000000041010BB5449435301", "Mastercard International", "United States", "[UNKNOWN]", "Some co-branded card", "",
+    "A0000000042010", "Mastercard International", "United States", "MasterCard Specific", "MasterCard Specific", "EMV",
+    "A0000000042203", "Mastercard International", "United States", "MasterCard Specific", "MasterCard U.S. Maestro", "",
+    "A0000000043010", "Mastercard International", "United States", "MasterCard Specific", "MasterCard Specific", "EMV",
+    "A0000000043060", "Mastercard International", "United States", "Maestro (Debit)", "Maestro (Debit) Card", "EMV",
+    "A000000004306001", "Mastercard International", "United States", "Maestro (Debit)", "Maestro (Debit) Card", "EMV",
+    "A0000000044010", "Mastercard International", "United States", "MasterCard Specific", "MasterCard Specific", "EMV",
+    "A0000000045010", "Mastercard International", "United States", "MasterCard Specific", "MasterCard Specific", "EMV",
+    "A0000000045555", "Mastercard International", "United States", "APDULogger", "AID on Cirrus Test Card", "",
+    "A0000000046000", "Mastercard International", "United States", "Cirrus", "Mastercard Cirrus (Interbank Network) ATM card only", "EMV",
+    "A0000000048002", "Mastercard International", "United States", "SecureCode Auth EMV-CAP", "Chip Authentication Protocol (CAP). Works with NatWest or SecureCode Aut", "EMV",
+    "A0000000049999", "Mastercard International", "United States", "MasterCard PayPass", "", "EMV",
+    "A0000000050001", "Switch Card Services Ltd.", "United Kingdom", "Maestro UK", "UK Domestic Maestro - Switch (debit card)", "EMV",
+    "A0000000050002", "Switch Card Services Ltd.", "United Kingdom", "Solo", "UK Domestic Maestro - Switch (debit card)", "EMV",
+    "A0000000090001FF44FF1289", "ETSI", "France", "Orange", "Orange UK", "",
+    "A0000000101030", "Europay International", "Belgium", "Maestro-CH", "", "",
+    "A00000001800", "GEMPLUS", "France", "Gemplus ", "", "",
+    "A0000000181001", "GEMPLUS", "France", "com.gemplus.javacard.util packages", "", "",
+    "A000000018434D", "GEMPLUS", "France", "Gemplus card manager", "434D = CM (ascii). Security domain for some GCX/GXP cards (GemXpresso Pro) (Gemalto)", "GP",
+    "A000000018434D00", "GEMPLUS", "France", "Gemplus Security Domain", "(Gemalto)", "GP",
+    "A00000002401", "Midland Bank Plc", "United Kingdom", "Self Service", "", "EMV",
+    "A000000025", "American Express", "United Kingdom", "American Express", "", "EMV",
+    "A0000000250000", "American Express", "United Kingdom", "American Express", "American Express (Credit/Debit)", "EMV",
+    "A00000002501", "American Express", "United Kingdom", "American Express", "AEIPS-compliant (A-E contact EMV) payment application", "EMV",
+    "A000000025010104", "American Express", "United Kingdom", "American Express", "", "",
+    "A000000025010402", "American Express", "United Kingdom", "American Express", "", "EMV",
+    "A000000025010701", "American Express", "United Kingdom", "ExpressPay", "", "EMV",
+    "A000000025010801", "American Express", "United Kingdom", "American Express", "", "EMV",
+    "A0000000291010", "LINK Interchange Network Ltd", "United Kingdom", "Link / American Express", "Link (UK) ATM Network, or AMEX (Portugal)", "EMV",
+    "A00000002945087510100000", "LINK Interchange Network Ltd", "United Kingdom", "CO-OP", "", "",
+    "A00000002949034010100001", "LINK Interchange Network Ltd", "United Kingdom", "HSBC", "", "",
+    "A00000002949282010100000", "LINK Interchange Network Ltd", "United Kingdom", "Barclay", "", "",
+    "A000000029564182", "LINK Interchange Network Ltd", "United Kingdom", "HAFX", "", "",
+    "A00000003029057000AD13100101FF", "Schlumberger Industries Identif d'Encarteur PR050", "France", "BelPIC (Belgian Personal Identity Card) JavaCard Applet", "Schlumberger (Gemalto) RID", "",
+    "A0000000308000000000280101", "Schlumberger Industries Identif d'Encarteur PR050", "France", "Gemalto .NET Card AID", "", "",
+    "A0000000421010", "Groupement des Cartes Bancaires 'CB'", "France", "Cartes Bancaire EMV Card", "Groupement des Cartes Bancaires (France)", "EMV",
+    "A0000000422010", "Groupement des Cartes Bancaires 'CB'", "France", "", "", "EMV",
+    "A0000000423010", "Groupement des Cartes Bancaires 'CB'", "France", "", "", "EMV",
+    "A0000000424010", "Groupement des Cartes Bancaires 'CB'", "France", "", "", "EMV",
+    "A0000000425010", "Groupement des Cartes Bancaires 'CB'", "France", "", "", "EMV",
+    "A0000000426010", "Groupement des Cartes Bancaires 'CB'", "France", "Contactless payment using Apple Pay", "", "EMV",
+    "A00000005945430100", "Zentraler Kreditausschuss (ZKA)", "Germany", "Girocard Electronic Cash", "", "",
+    "A000000063504B43532D3135", "RSA Laboratories", "United States", "PKCS-15", "RSA PKCS-15 PKI application (Predecessor to ISO7816-15) / ID-card in Finland", "",
+    "A0000000635741502D57494D", "RSA Laboratories", "United States", "WAP-WIM", "WAP (Wireless Application Protocol) Identity Module / Wireless Identification Module", "",
+    "A00000006510", "JCB CO., LTD.", "Japan", "JCB", "Japan Credit Bureau", "EMV",
+    "A0000000651010", "JCB CO., LTD.", "Japan", "JCB J Smart Credit", "Japan Credit Bureau", "EMV",
+    "A00000006900", "Socit Europenne de Monnaie Electronique SEME", "France", "Moneo", "", "EMV",
+    "A000000077010000021000000000003B", "Oberthur Technologies", "France", "Visa AEPN", "", "EMV",
+    "A0000000790100", "Activcard Europe S.A.", "France", "CACv2 PKI ID", "Identity Key", "",
+    "A0000000790101", "Activcard Europe S.A.", "France", "CACv2 PKI Sign", "Digital Signature Key", "",
+    "A0000000790102", "Activcard Europe S.A.", "France", "CACv2 PKI Enc", "Key Management Key", "",
+    "A00000007901F0", "Activcard Europe S.A.", "France", "CACv1 PKI Identity Key", "Re-directs to CACv2 PKI Identity key", "",
+    "A00000007901F1", "Activcard Europe S.A.", "France", "CACv1 PKI Digital Signature Key", "Re-directs to CACv2 Digital Signature key", "",
+    "A00000007901F2", "Activcard Europe S.A.", "France", "CACv1 PKI Key Management Key", "Re-directs to CACv2 Key Management key", "",
+    "A0000000790200", "Activcard Europe S.A.", "France", "CACv2 DoD Person", "DoD Demographic", "",
+    "A0000000790201", "Activcard Europe S.A.", "France", "CACv2 DoD Personnel", "DoD Demographic", "",
+    "A00000007902FB", "Activcard Europe S.A.", "France", "CACv1 BC", "General Configuration", "",
+    "A00000007902FD", "Activcard Europe S.A.", "France", "CACv1 BC", "PKI Certificate Attributes", "",
+    "A00000007902FE", "Activcard Europe S.A.", "France", "CACv1 BC", "PKI Cert", "",
+    "A0000000790300", "Activcard Europe S.A.", "France", "CACv2 Access Control Applet", "CAC PIN / ID PIN Management Applet", "",
+    "A0000000791201", "Activcard Europe S.A.", "France", "CAC JDM", "Joint Data Model. BCAdmin", "",
+    "A0000000791202", "Activcard Europe S.A.", "France", "CAC JDM", "Joint Data Model. BCMedical", "",
+    "A0000000871002FF49FF0589", "Third Generation Partnership Project (3GPP)", "France", "Telenor USIM", "", "USIM",
+    "A00000008810200105C100", "Buypass AS", "Norway", "BuyPass BIDA", "Used by norwegian public betting company Norsk-Tipping", "BuyPass",
+    "A000000088102201034221", "Buypass AS", "Norway", "BuyPass BEID (BuyPass Electronic ID)", "", "BuyPass",
+    "A000000088102201034321", "Buypass AS", "Norway", "BuyPass BEID (BuyPass Electronic ID)", "", "BuyPass",
+    "A0000000960200", "Sa Proton World International N.V.", "Belgium", "Proton World International Security Domain", "Proton, which is owned in part by Visa International and American Express Co., is in three other European countries: the original Proton program in Belgium, Chipknip in the Netherlands, and Cash in Switzerland", "GP",
+    "A000000098", "Visa USA", "United States", "Debit Card", "Bank of America Debit Card", "EMV",
+    "A0000000980840", "Visa USA", "United States", "Visa Common Debit", "", "",
+    "A0000000980848", "Visa USA", "United States", "Debit Card", "Schwab Bank Debit Card", "EMV",
+    "A0000001110101", "Die Post Postfinance", "Switzerland", "Postcard", "", "",
+    "A0000001160300", "GSA - TFCS", "United States", "PIV CHUID", "CHUID", "",
+    "A0000001166010", "GSA - TFCS", "United States", "PIV Fingerprints", "Fingerprints", "",
+    "A0000001166030", "GSA - TFCS", "United States", "PIV Facial Image", "Facial Image", "",
+    "A0000001169000", "GSA - TFCS", "United States", "PIV Security Object", "Security Object", "",
+    "A000000116A001", "GSA - TFCS", "United States", "PIV Authentication Key", "PIV Authentication Key", "",
+    "A0000006472F0001", "FIDO authenticator", "global", "U2F/FIDO2 authenticator", "U2F and/or FIDO2 authenticator", "",
+    "A000000116DB00", "GSA - TFCS", "United States", "CCC", "Card Capability Container", "",
+    "A000000118010000", "Austria Card", "Austria", "DF_Verkehr", "Domestic Loyalty Program (Version 1.3)", "",
+    "A000000118020000", "Austria Card", "Austria", "DF_Partner", "Domestic Loyalty Program (Version 1.3)", "",
+    "A000000118030000", "Austria Card", "Austria", "DF_Schlerdaten", "Domestic Loyalty Program (Version 1.3)", "",
+    "A000000118040000", "Austria Card", "Austria", "DF_KEP_SIG", "Domestic Loyalty Program (Version 1.32)", "",
+    "A0000001184543", "Austria Card", "Austria", "Digital Signature (SSCA)", "Digital Signature Application", "",
+    "A000000118454E", "Austria Card", "Austria", "Encryption Application", "Encryption Application (Version 1.10)", "",
+    "A0000001211010", "PBS Danmark A/S", "Denmark", "Dankort (VISA GEM Vision)", "Danish domestic debit card", "EMV",
+    "A0000001320001", "Java Card Forum", "United States", "org.javacardforum.javacard.biometry", "", "",
+    "A0000001408001", "TDS TODOS DATA SYSTEM AB", "Sweden", "eCode", "", "",
+    "A0000001410001", "Associazione Bancaria Italiana", "Italy", "PagoBANCOMAT", "CoGeBan Consorzio BANCOMAT (Italian domestic debit card)", "EMV",
+    "A0000001510000", "GlobalPlatform, Inc.", "United States", "Global Platform Security Domain AID", "GP Card Manager", "GP",
+    "A00000015153504341534400", "GlobalPlatform, Inc.", "United States", "CASD_AID", "SPCASD", "GP",
+    "A0000001523010", "Diners Club International Ltd.", "United States", "Discover, Pulse D Pas", "Discover Card", "EMV",
+    "A0000001524010", "Diners Club International Ltd.", "United States", "Discover", "Discover Debit Common Card", "EMV",
+    "A0000001544442", "Banrisul - Banco do Estado do Rio Grande do SUL - S.A.", "Brazil", "Banricompras Debito", "Banrisul (Brazil)", "EMV",
+    "A0000001570010", "Zhlke Engineering AG", "Switzerland", "AMEX", "", "",
+    "A0000001570020", "Zhlke Engineering AG", "Switzerland", "MasterCard", "", "",
+    "A0000001570021", "Zhlke Engineering AG", "Switzerland", "Maestro", "", "",
+    "A0000001570022", "Zhlke Engineering AG", "Switzerland", "Maestro", "", "",
+    "A0000001570023", "Zhlke Engineering AG", "Switzerland", "CASH", "", "",
+    "A0000001570030", "Zhlke Engineering AG", "Switzerland", "VISA", "", "",
+    "A0000001570031", "Zhlke Engineering AG", "Switzerland", "VISA", "", "",
+    "A0000001570040", "Zhlke Engineering AG", "Switzerland", "JCB", "", "",
+    "A0000001570050", "Zhlke Engineering AG", "Switzerland", "Postcard", "", "",
+    "A0000001570051", "Zhlke Engineering AG", "Switzerland", "Postcard", "", "",
+    "A0000001570100", "Zhlke Engineering AG", "Switzerland", "MCard", "", "",
+    "A0000001570104", "Zhlke Engineering AG", "Switzerland", "MyOne", "", "",
+    "A0000001570109", "Zhlke Engineering AG", "Switzerland", "Mediamarkt Card", "", "",
+    "A000000157010A", "Zhlke Engineering AG", "Switzerland", "Gift Card", "", "",
+    "A000000157010B", "Zhlke Engineering AG", "Switzerland", "Bonuscard", "", "",
+    "A000000157010C", "Zhlke Engineering AG", "Switzerland", "WIRCard", "", "",
+    "A000000157010D", "Zhlke Engineering AG", "Switzerland", "Power Card", "", "",
+    "A0000001574443", "Zhlke Engineering AG", "Switzerland", "DINERS CLUB", "", "",
+    "A0000001574444", "Zhlke Engineering AG", "Switzerland", "Supercard Plus", "", "",
+    "A000000167413000FF", "IBM", "Germany", "JCOP Identify Applet", "identify in JCOP-tools returns eg 27 34 01 2E 00 00 00 00 4E 58 37 35 31 41 00 03 28 62 B3 6A 82", "JCOP",
+    "A000000167413001", "IBM", "Germany", "FIPS 140-2", "", "",
+    "A000000172950001", "Financial Information Service Co. Ltd.", "Taiwan", "BAROC Financial Application Taiwan", "The Bankers Association of the Republic of China", "EMV",
+    "A000000177504B43532D3135", "Ministre de L'Intrieur", "Belgium", "BelPIC (Belgian Personal Identity Card)", "", "",
+    "A0000001850002", "Post Office Limited", "United Kingdom", "UK Post Office Account card", "", "EMV",
+    "A0000001884443", "Diners Club Switzerland Ltd", "Switzerland", "DINERS CLUB", "", "",
+    "A0000002040000", "Association for Payment Clearing Services", "United Kingdom", "", "", "",
+    "A0000002281010", "Saudi Arabian Monetary Agency (SAMA)", "Kingdom of Saudi Arabia", "SPAN (M/Chip)", "SPAN2 (Saudi Payments Network) - Saudi Arabia domestic credit/debit card (Saudi Arabia Monetary Agency)", "EMV",
+    "A0000002282010", "Saudi Arabian Monetary Agency (SAMA)", "Kingdom of Saudi Arabia", "SPAN (VIS)", "SPAN2 (Saudi Payments Network) - Saudi Arabia domestic credit/debit card (Saudi Arabia Monetary Agency)", "EMV",
+    "A00000022820101010", "Saudi Arabian Monetary Agency (SAMA)", "Kingdom of Saudi Arabia", "SPAN", "SPAN2 (Saudi Payments Network) - Saudi Arabia domestic credit/debit card (Saudi Arabia Monetary Agency)", "",
+    "A0000002471001", "ISO JTC1/SC17/WG3", "United Kingdom", "Machine Readable Travel Documents (MRTD)", "Electronic (Biometric) Passport. Issuer stored data application (The last three digits of the PIX shall be used to denote future version levels.)", "MRTD",
+    "A0000002472001", "ISO JTC1/SC17/WG3", "United Kingdom", "Machine Readable Travel Documents (MRTD)", "Electronic (Biometric) Passport. Application for hashes, digital signature, and certificate (The last three digits of the PIX shall be used to denote future version levels.)", "MRTD",
+    "A0000002771010", "Interac Association", "Canada", "INTERAC", "Canadian domestic credit/debit card", "EMV",
+    "A00000030600000000000000", "PS/SC Workgroup", "United States", "PC/SC Initial access data AID", "Possibly not an application...", "",
+    "A000000308000010000100", "National Institute of Standards and Technology", "United States", "Personal Identity Verification (PIV) / ID-ONE PIV BIO", "PIV End Point Applet. Last 2 bytes designate version", "",
+    "A000000308000010000100", "National Institute of Standards and Technology", "United States", "Personal Identity Verification (PIV) / ID-ONE PIV BIO", "PIV End Point Applet. Last 2 bytes designate version", "",
+    "A00000031510100528", "Currence Holding/PIN BV", "The Netherlands", "Currence PuC", "", "EMV",
+    "A0000003156020", "Currence Holding/PIN BV", "The Netherlands", "Chipknip", "", "EMV",
+    "A00000032301", "Identity Alliance", "United States", "MUSCLE Applet Package", "http://osdir.com/ml/lib.muscle/2005-12/msg00066.html", "",
+    "A0000003230101", "Identity Alliance", "United States", "MUSCLE Applet Instance", "http://osdir.com/ml/lib.muscle/2005-12/msg00066.html", "",
+    "A0000003241010", "Discover Financial Services LLC", "United States", "Discover Expresspay (ZIP)", "", "",
+    "A000000333010101", "China Unionpay Co. Ltd", "China", "UnionPay Debit", "", "",
+    "A000000333010102", "China Unionpay Co. Ltd", "China", "UnionPay Credit", "", "",
+    "A000000333010103", "China Unionpay Co. Ltd", "China", "UnionPay Quasi Credit", "", "",
+    "A000000333010106", "China Unionpay Co. Ltd", "China", "UnionPay Electronic Cash", "", "",
+    "A000000333010108", "China Unionpay Co. Ltd", "China", "U.S. UnionPay Common Debit AID", "", "",
+    "A000000337301000", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Retrait", "", "",
+    "A000000337101000", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Standard", "", "",
+    "A000000337102000", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Classic", "", "",
+    "A000000337101001", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Prepaye Online", "", "",
+    "A000000337102001", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Prepaye Possibile Offiline", "", "",
+    "A000000337601001", "Groupment Interbancaire Montique de l' UEMOA", "Senegal", "Porte Monnaie Electronique", "", "",
+    "A0000003591010", "Euro Alliance of Payment Schemes s.c.r.l. - EAPS", "Belgium", "", "Unknown", "",
+    "A0000003591010028001", "Euro Alliance of Payment Schemes s.c.r.l. - EAPS", "Belgium", "Girocard EAPS", "ZKA (Germany)", "EMV",
+    "A00000035910100380", "Euro Alliance of Payment Schemes s.c.r.l. - EAPS", "Belgium", "", "PagoBANCOMAT", "",
+    "A0000003660001", "Poste Italiane S.P.A", "Italy", "Postamat", "", "",
+    "A0000003660002", "Poste Italiane S.P.A", "Italy", "Postamat VISA", "", "",
+    "A0000003710001", "Verve", "Nigeria", "InterSwitch Verve Card", "Nigerian local switch company", "EMV",
+    "A00000038410", "eftpos, Australian Payments Clearing Association Ltd", "Australia", "Savings (debit card)", "", "",
+    "A00000038420", "eftpos, Australian Payments Clearing Association Ltd", "Australia", "Cheque (debit card)", "", "",
+    "A0000003964D66344D0002", "NXP Semiconductors Germany GmbH", "Germany", "MIFARE4MOBILE", "NXP Mf4M", "",
+    "A00000039742544659", "Microsoft Corporation", "United States", "Microsoft IDMP AID", "Identity Device With Microsoft Generic Profile application. 2 bytes can be added at the end. This byte must be set to the IDMP specification revision number which is currently 0x01. The second byte (yy) is reserved for use by the card application.", "",
+    "A0000003974349445F0100", "Microsoft Corporation", "United States", "Microsoft PNP AID", "MS Plug and Play", "",
+    "A0000004271010", "Unibanco (Hipercard)", "Brazil", "Hiperchip", "", "",
+    "A0000004320001", "PRO100", "Russia", "Universal Electronic Card", "", "",
+    "A0000004360100", "Edenred", "Belgium", "Ticket Restaurant", "", "",
+    "A0000004391010", "ACCEL/Exchange", "United States", "Exchange ATM card", "The Exchange Network ATM Network", "",
+    "A0000004540010", "eTranzact", "Nigeria", "Etranzact Genesis Card", "Nigerian local switch company", "EMV",
+    "A0000004540011", "eTranzact", "Nigeria", "Etranzact Genesis Card 2", "Nigerian local switch company", "EMV",
+    "A0000004762010", "Google", "United States", "GOOGLE_CONTROLLER_AID", "GOOGLE_LOCKET_AID", "",
+    "A0000004763030", "Google", "United States", "GOOGLE_MIFARE_MANAGER_AID", "", "",
+    "A0000004766C", "Google", "United States", "GOOGLE_PAYMENT_AID", "", "EMV",
+    "A000000476A010", "Google", "United States", "GSD_MANAGER_AID", "", "GP",
+    "A000000476A110", "Google", "United States", "GSD_MANAGER_AID", "", "GP",
+    "A000000485", "JVL Ventures, LLC (Softcard)", "United States", "Softcard SmartTap", "", "",
+    "A0000005241010", "RuPay", "India", "RuPay", "RuPay (India)", "EMV",
+    "A0000005271002", "Yubico", "Sweden", "Yubikey NEO U2F Demo applet", "Universal 2-Factor Proof-of-concept/Demo", "YKNEO",
+    "A000000527200101", "Yubico", "Sweden", "Yubikey NEO Yubikey2 applet interface", "Javacard Applet AID", "YKNEO",
+    "A000000527210101", "Yubico", "Sweden", "Yubikey NEO OATH Applet", "Javacard Applet AID", "YKNEO",
+    "A0000005591010FFFFFFFF8900000100", "GSMA (GSM Association)", "United Kingdom", "ISD-R Application. Used as TAR.", "", "",
+    "A0000005591010FFFFFFFF8900000200", "GSMA (GSM Association)", "United Kingdom", "ECASD Application. Used as TAR.", "", "",
+    "A0000005591010FFFFFFFF8900000D00", "GSMA (GSM Association)", "United Kingdom", "ISD-P Executable Load File.", "", "",
+    "A0000005591010FFFFFFFF8900000E00", "GSMA (GSM Association)", "United Kingdom", "ISD-P Executable Module.", "", "",
+    "A0000005591010FFFFFFFF8900000F00", "GSMA (GSM Association)", "United Kingdom", "Reserved value for the Profile's ISD-P", "", "",
+    "A0000005591010FFFFFFFF8900001000", "GSMA (GSM Association)", "United Kingdom", "ISD-P Application ('1010FFFFFFFF89000010' to '1010FFFFFFFF8900FFFF'. Used as TAR. The value is allocated during the 'Profile Download and Installation procedure'", "", "",
+    "A00000061700", "Fidesmo", "Sweden", "Fidesmo javacard", "", "",
+    "A0000006200620", "Debit Network Alliance (DNA)", "United States", "Debit Network Alliance (DNA)", "Common U.S. Debit", "",
+    "A0000006581010", "MIR", "Russia", "MIR Credit", "", "",
+    "A0000006581011", "MIR", "Russia", "MIR Credit", "", "",
+    "A0000006582010", "MIR", "Russia", "MIR Debit", "", "",
+    "A0000006723010", "TROY", "Turkey", "TROY chip credit card", "Turkey's Payment Method", "EMV",
+    "A0000006723020", "TROY", "Turkey", "TROY chip debit card", "Turkey's Payment Method", "EMV",
+    "A0000007705850", "Indian Oil Corporation Limited", "India", "XTRAPOWER Fleet Card Program", "Indian Oil's Pre Paid Program", "EMV",
+    "A0000007790000", "Zimswitch", "Zimbabwe", "", "", "",
+    "B012345678", "MasterCard International", "United States", "Maestro TEST", "Used for development", "EMV",
+    "D040000001000002", "Paylife", "Austria", "Paylife Quick (IEP). Preloaded Electronic Purse", "Domestic Payment System (Version 2.1)", "",
+    "D040000002000002", "Austria Card", "Austria", "RFU", "Domestic Payment System (Version 2.1)", "",
+    "D040000003000002", "Austria Card", "Austria", "POS", "Domestic Payment System (Version 2.1)", "",
+    "D040000004000002", "Austria Card", "Austria", "ATM", "Domestic Payment System (Version 2.1)", "",
+    "D04000000B000002", "Austria Card", "Austria", "Retail", "Domestic Loyalty Program (Version 2.1)", "",
+    "D04000000C000002", "Austria Card", "Austria", "Bank_Data", "Domestic Loyalty Program (Version 2.1)", "",
+    "D04000000D000002", "Austria Card", "Austria", "Shopping", "Domestic Loyalty Program (Version 2.1)", "",
+    "D040000013000001", "Austria Card", "Austria", "DF_UNI_Kepler1", "Domestic Loyalty Program (Version 2.0)", "",
+    "D040000013000001", "Austria Card", "Austria", "DF_Schler1", "Domestic Loyalty Program (Version 1.3)", "",
+    "D040000013000002", "Austria Card", "Austria", "DF_UNI_Kepler2", "Domestic Loyalty Program (Version 2.0)", "",
+    "D040000013000002", "Austria Card", "Austria", "DF_Schler2", "Domestic Loyalty Program (Version 1.3)", "",
+    "D040000014000001", "Austria Card", "Austria", "DF_Mensa", "Domestic Loyalty Program (Version 2.0)", "",
+    "D040000015000001", "Austria Card", "Austria", "DF_UNI_Ausweis", "Domestic Loyalty Program (Version 2.0)", "",
+    "D040000015000001", "Austria Card", "Austria", "DF_Ausweis", "Domestic Loyalty Program (Version 1.3)", "",
+    "D0400000190001", "Austria Card", "Austria", "EMV ATM Maestro", "Domestic EMV Application (Version 2.1)", "",
+    "D0400000190002", "Austria Card", "Austria", "EMV POS Maestro", "Domestic EMV Application (Version 2.1)", "",
+    "D0400000190003", "Austria Card", "Austria", "EMV ATM MasterCard", "Domestic EMV Application (Version 2.1)", "",
+    "D0400000190004", "Austria Card", "Austria", "EMV POS MasterCard", "Domestic EMV Application (Version 2.1)", "",
+    "D0400000190010", "Austria Card", "Austria", "Digital ID", "Domestic Payment System (Version 2.1)", "",
+    "D268000001", "Ministry of Finance of Georgia", "Georgia", "Fiscal module application", "Georgia Revenue Service application for fiscal cash registers", "",
+    "D276000005", "Giesecke&Devrient", "Germany", "", "Giesecke & Devrient", "",
+    "D276000005AA040360010410", "Giesecke&Devrient", "Germany", "G D App Nokia 6212", "", "",
+    "D276000005AA0503E00401", "Giesecke&Devrient", "Germany", "G D App Nokia 6212", "", "",
+    "D276000005AA0503E00501", "Giesecke&Devrient", "Germany", "G D App Nokia 6212", "", "",
+    "D276000005AA0503E0050101", "Giesecke&Devrient", "Germany", "G D App Nokia 6212", "", "",
+    "D276000005AB0503E0040101", "Giesecke&Devrient", "Germany", "G D App Nokia 6212", "", "",
+    "D27600002200000001", "IBM Laboratories", "Germany", "SCT LOYALTY", "IBM Test card from the book 'Smart Card Application Development Using Java'", "",
+    "D27600002200000002", "IBM Laboratories", "Germany", "BUSINESS CARD", "IBM Test card from the book 'Smart Card Application Development Using Java'", "",
+    "D27600002200000060", "IBM Laboratories", "Germany", "PKCS#11 Token", "IBM Test card from the book 'Smart Card Application Development Using Java'", "",
+    "D276000025", "ZKA", "Germany", "Girocard", "Girocard (Geldkarte) in Germany", "",
+    "D27600002545410100", "ZKA", "Germany", "", "Unknown", "",
+    "D27600002545500100", "ZKA", "Germany", "Girocard", "ZKA Girocard (Geldkarte) (Germany)", "EMV",
+    "D27600002547410100", "ZKA", "Germany", "Girocard ATM", "", "",
+    "D276000060", "Wolfgang Rankl", "Germany", "", "", "",
+    "D2760000850100", "NXP Semiconductors / NFC Forum", "Germany", "NDEF Tag Application / Mifare DESFire Tag Application", "NFC Forum Type 4 Tag", "",
+    "D2760000850101", "NXP Semiconductors / NFC Forum", "Germany", "NDEF Tag Application", "NFC Tag type 4 tag", "",
+    "D276000118", "Giesecke&Devrient Java Card Telecommunikation", "Germany", "", "", "",
+    "D2760001180101", "Giesecke&Devrient Java Card Telecommunikation", "Germany", "Giesecke &amp", "Devrient Test Applet", "",
+    "D27600012401", "fsfEurope", "Germany", "OpenPGP Card", "For selection when not knowing the exact full AID", "OpenPGP",
+    "D276000124010101FFFF000000010000", "fsfEurope", "Germany", "OpenPGP Card", "Version 1", "OpenPGP",
+    "D2760001240102000000000000010000", "fsfEurope", "Germany", "OpenPGP Card", "Version 2", "OpenPGP",
+    "D27600012402", "fsfEurope", "Germany", "SmartChess", "http://smartchess.de/englisch/SmartChess_1.0.pdf", "SmartChess",
+    "D2760001240200010000000000000000", "fsfEurope", "Germany", "SmartChess", "http://smartchess.de/englisch/SmartChess_1.0.pdf", "SmartChess",
+    "D4100000011010", "", "Republic of Korea", "", "", "",
+    "D5280050218002", "", "The Netherlands", "", "(Netherlands)", "EMV",
+    "D5780000021010", "Bankaxept", "Norway", "Bankaxept", "Norwegian domestic debit card", "EMV",
+    "D7560000010101", "Swiss Travel Fund (Reka)", "Switzerland", "Reka Card", "prepaid functional debit card", "",
+    "D7560000300101", "Migros (FCM, GE Money Bank and MasterCard)", "Switzerland", "M Budget", "", "",
+    "E80704007F00070302", "", "", "nPA", "German eID", "",
+    "E82881C11702", "", "", "AlphaCard application", "", "",
+    "E828BD080F", "", "", "ISO-7816-15 EF.DIR", "Iso adoption of PKCS-15", "",
+    "F0000000030001", "", "", "BRADESCO", "Brazilian Bank Banco Bradesco", "EMV",
+    "7465736C6153746F7265", "Tesla", "", "teslaStore", "Undocumented AID associated with official Tesla Key Cards", "Tesla",
+    "7465736C614C6F6769633", "Tesla", "", "teslaLogic (Original AID)", "Key for Tesla vehicles", "Tesla",
+    "F465736C614C6F6769633", "Tesla", "", "teslaLogic (Alternate AID)", "Key for Tesla vehicles", "Tesla",
+    "5465736c61444150", "Tesla", "", "TeslaDAP", "Undocumented AID associated with official Tesla BTLE Key Fobs", "Tesla",
+    "4144204631", "CIPURSE", "", "Cipurse transport card", "Cipurse transport card", "transport",
+    "A00000084600CC68E88C0101", "VivoKey", "United States", "VivoKey Apex", "vivokey.com/apex", "",
+    "D2760000028002000000000000000310", "CIPURSE", "", "CPM Master SAM", "Application specific master keys", "transport",
+    "D2760000028002000000000000000311", "CIPURSE", "", "CPM Person SAM", "Personalization of end user cards", "transport",
+    "A0000008381010", "SL ", "Sweden", "SL Resekort", "transport card", "transport",
+    "4F53452E5641532E3031", "Apple, Google", "", "Value-Added Services (OSE.VAS.01)", "Used by Apple VAS and Google SmartTap", "loyalty",
+    "A000000476D0000101", "Google", "", "Google SmartTap 1.3 (Deprecated)", "", "loyalty",
+    "A000000476D0000111", "Google", "", "Google SmartTap 2.0", "", "loyalty",
+    "A0000002480400", "ISO/IEC JTC1/SC17", "", "Personal identification (mDL) data transfer", "ISO/IEC 18013-5:2021 compliant Mobile driving licence (mDL) application data transfer.", "identity",
+    "A000000676", "Blackboard", "United States", "Student ID", "Student ID cards", "identity",
+    "D2760000254D010200", "Zentraler Kreditausschuss (ZKA)", "Germany", "Girocard Jugendschutz", "Age verification", "identity",
+    "A000000809434343444B467631", "Car Connectivity Consortium (CCC)", "", "Digital Car Key Framework", "Used during key provisioning and configuration", "",
+    "A000000809434343444B417631", "Car Connectivity Consortium (CCC)", "", "Digital Car Key", "", "access",
+    "A0000008580102", "Apple", "", "Apple Home Key Framework", "Home Key configuration applet. Used for attestation exchange", "",
+    "A0000008580101", "Apple", "", "Apple Home Key", "NFC Home Key for select HomeKit-compatible locks based on Apple UnifiedAccess protocol", "access",
+    "A0000008580202", "Apple", "", "Apple Access Key Framework", "Access Key configuration applet. Used for attestation exchange", "",
+    "A0000008580201", "Apple", "", "Apple Access Key", "NFC Access Key for commercial properties based on Apple UnifiedAccess protocol", "access",
+    "A000000909ACCE5502", "Connectivity Standards Alliance (CSA)", "", "Aliro Framework", "Used during key provisioning, configuration, attestation exchange", "",
+    "A000000909ACCE5501", "Connectivity Standards Alliance (CSA)", "", "Aliro", "", "access",
+    "A000000396564341", "NXP", "", "MIFARE 2GO", "AID prefix used by MIFARE 2GO-based cards", "",
+    "A00000039656434103F1216000000000", "LV Monorail", "United States", "Las Vegas Monorail", "", "transport",
+    "A00000039656434103F8852200000000", "Ubian", "Slovakia", "Ubian digital transit card", "DESFire-based virtual transit card", "transport",
+    "DE5C0D1F1CADA5", "CRTM", "Spain", "Madrid transit card", "DESFire-based transit card", "transport",
+    "A00000F21100", "PTV", "Australia", "Myki transit card", "DESFire-based transit card", "transport",
+    "637001ff4c41", "Cubic", "United States", "LA Tap", "DESFire-based transit card (ASCII cp\\x01\\xffLA)", "transport",
+    "637001ff574d415441", "Cubic", "United States", "Smart Trip", "DESFire-based transit card (ASCII cp\\x01\\xffWMATA)", "transport",
+    "637001ff434c4950504552", "Cubic", "United States", "Clipper", "DESFire-based transit card (ASCII cp\\x01\\xffCLIPPER)", "transport",
+    "A0000002164954534F2D31", "ITSO", "United Kingdom", "ITSO CMD2", "AID used by ITSO for smartcard/phone-based transit cards", "transport",
+    "A000000632010105", "CTTIC", "China", "China T-Union", "Universal transit card used by many big public transit operators", "transport",
+    "A00000000491", "MasterCard International", "", "Mastercard Private Label Transit", "AID prefix used by transit cards that use private label mastercard", "transport",
+    "A0000000049100", "MasterCard International", "United States", "HOP Fastpass", "", "transport",
+    "A0000000049101", "MasterCard International", "United States", "Ventra", "", "transport",
+    "A000000858044F53452E4348", "Apple", "", "AirDrop connection negotiation", "Used by NFC-based AirDrop negotiation added in IOS17", "",
+    "a0000004400001010001", "HID Global", "", "SEOS", "Used by both by physical cards and mobile implementations", "access",
+    "A00000054000060100010000FF", "HID Global", "", "SEOS Mobile", "Declared by some SEOS-compatible applications for HCE", "access",
+    "A000000341000101", "TransitLink Pte Ltd", "Singapore", "CEPAS", "Transit and e-money card used in Singapore", "transport",
+    "A0000004040125", "Ile-de-France Mobilites", "France", "Navigo", "CALYPSO-based transit card", "transport",
+};
+
+static const uint32_t restable_aidlist_order[] = {
+    0, 1, 272, 2, 277, 271, 298, 296, 297, 269, 268, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    301, 302, 303, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+    69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100,
+    101, 102, 103, 104, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+    134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 299, 148,
+    149, 150, 151, 152, 280, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+    164, 165, 166, 168, 170, 169, 171, 167, 172, 307, 173, 174, 175, 176, 177, 178,
+    179, 180, 181, 291, 292, 293, 182, 183, 308, 184, 185, 186, 187, 305, 188, 189,
+    190, 191, 192, 193, 194, 278, 279, 195, 196, 197, 198, 199, 306, 200, 201, 202,
+    203, 204, 205, 206, 207, 300, 105, 208, 209, 210, 211, 212, 281, 213, 214, 284,
+    283, 276, 273, 286, 285, 288, 287, 304, 290, 289, 295, 215, 216, 217, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+    274, 275, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 282,
+    249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 294,
+    264, 265, 266, 267, 270,
+};
+
+static const char *const restable_mad_fields[] = {
+    "mad", "application", "company", "service_provider", "system_integrator"
+};
+
+static const char *const restable_mad_cells[] = {
+    "0x0004", "Card holders personal data", "Rosan Finance", "", "Rosan Finance",
+    "0x0005", "Card ID: ISO No., expiry date and other identification data", "Rosan Finance", "Rosan Finance", "Rosan Finance",
+    "0x0006", "Private Rovalty programs, discount programs for card holders", "Rosan Finance", "Retail Trade and Service Org.", "Rosan Finance",
+    "0x0007", "Card Holder Data/ Card Management Data/ Access Control & Security", "House of Representatives of States General", "House of Representatives of States General", "Paul Sas",
+    "0x0008", "Card Holder Data/ Card Management Data/ Access Control & Security", "House of Representatives of States General", "House of Representatives of States General", "Paul Sas",
+    "0x0009", "Card and Reader Configuration", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann AG", "PBV Kaufmann AG",
+    "0x000A", "Card and Reader Configuration", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann AG", "PBV Kaufmann AG",
+    "0x000B", "Card and Reader Configuration", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann AG", "PBV Kaufmann AG",
+    "0x000C", "Card and Reader Configuration", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann AG", "PBV Kaufmann AG",
+    "0x000F", "Access Control, payment, ID, time registration", "Sagio A/S", "Sagio A/S", "Sagio A/S",
+    "0x0010", "Card administration", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x0011", "Card publisher data", "Haguess s.r.o.", "Haguess", "Haguess",
+    "0x0012", "Card publisher data", "Haguess s.r.o.", "Haguess", "Haguess",
+    "0x0013", "Card publisher data", "Haguess s.r.o.", "Haguess", "Haguess",
+    "0x0014", "Card publisher data", "Haguess s.r.o.", "Haguess", "Haguess",
+    "0x0015", "Card publisher information", "Mikroelektronika spol.s r.o.", "MIKROELEKTRONIKA spol.s.v.o.", "MIKROELEKTRONIKA spol.s.v.o.",
+    "0x0016", "Issuer information", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s.r.o., Kpt. Poplera 55, Vysoke Myto 566 01, Czech Republic", "Mikroelektronika spol.s.r.o., Kpt. Poplera 55, Vysoke Myto 566 01, Czech Republic",
+    "0x0017", "Personal information", "Mikroelektronika spol.s r.o.", "Transmetro Guatemala", "SIEMENS Itron Business services S.A. - Cordoba, Rep. Argentina",
+    "0x0018", "Customer profile - card holder information", "CSAD SVT Praha", "", "Mikroelektronika, EMTEST",
+    "0x0019", "Card information - provider, status, validity", "CSAD SVT Praha", "", "Mikroelektronika, EMTEST",
+    "0x001B", "Access control", "Custom Micro Products Ltd.", "Custom Micro Products", "Custom Micro Products",
+    "0x001D", "Interoperable Contactless Card for multimode transport in the area of Arava Province and the city of Vitoria-Gasteiz", "Eusko Tren", "Idom Ingeniera y Consultoria, S.A.", "Idom Ingeniera y Consultoria, S.A.",
+    "0x001E", "Interoperable Contactless Card for multimode transport in the area of Arava Province and the city of Vitoria-Gasteiz", "Eusko Tren", "Idom Ingeniera y Consultoria, S.A.", "Idom Ingeniera y Consultoria, S.A.",
+    "0x001F", "Interoperable Contactless Card for multimode transport in the area of Arava Province and the city of Vitoria-Gasteiz", "Eusko Tren", "Idom Ingeniera y Consultoria, S.A.", "Idom Ingeniera y Consultoria, S.A.",
+    "0x0020", "Interoperable Contactless Card for multimode transport in the area of Arava Province and the city of Vitoria-Gasteiz", "Eusko Tren", "Idom Ingeniera y Consultoria, S.A.", "Idom Ingeniera y Consultoria, S.A.",
+    "0x0021", "Card certificate", "Tidomat AB", "Tidomat AB", "Tidomat AB",
+    "0x0022", "Card administration", "Emcard a.s.", "Emcard", "Emcard",
+    "0x0023", "Interoperable Contactless Card for multimode transport in the area of Bizkaia Province", "BISCAY TRANSPORT CONSORTIUM - Consorcio de transportes de Bizkaia", "Idom Ingenieria y Consultoria, S.A.", "Idom Ingenieria y Consultoria, S.A.",
+    "0x0024", "Interoperable Contactless Card for multimode transport in the area of Bizkaia Province", "BISCAY TRANSPORT CONSORTIUM - Consorcio de transportes de Bizkaia", "Idom Ingenieria y Consultoria, S.A.", "Idom Ingenieria y Consultoria, S.A.",
+    "0x0025", "Interoperable Contactless Card for multimode transport in the area of Bizkaia Province", "BISCAY TRANSPORT CONSORTIUM - Consorcio de transportes de Bizkaia", "Idom Ingenieria y Consultoria, S.A.", "Idom Ingenieria y Consultoria, S.A.",
+    "0x0026", "Interoperable Contactless Card for multimode transport in the area of Bizkaia Province", "BISCAY TRANSPORT CONSORTIUM - Consorcio de transportes de Bizkaia", "Idom Ingenieria y Consultoria, S.A.", "Idom Ingenieria y Consultoria, S.A.",
+    "0x0027", "Card publisher data, card holder profile", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x0028", "Card administration for municipal chip card - card issuer (information)", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.",
+    "0x0029", "Card information", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x002A", "Card administration", "Sportdata SP. Z.0.0.", "Sportdata SP. 2 0.0.", "Sportdata SP. 2 0.0.",
+    "0x002B", "Card administration; Issuer information", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x002C", "Card administration; Issuer information", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x002D", "Card publisher data, card holder profile", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x002E", "Card publisher data, card holder profile", "\xc3\x9astecky kraj", "", "",
+    "0x00FF", "Parking systems.", "Les parkings de Paris La D\xc3\xa9""fense", "Les parkings de Paris La D\xc3\xa9""fense", "Les parkings de Paris La D\xc3\xa9""fense",
+    "0x0101", "Internal use (Tests, Demos...)", "Ascom Mon\xc3\xa9tel", "Mon\xc3\xa9tel R&D Fare Collection Systems Departement", "Mon\xc3\xa9tel S.A.",
+    "0x0102", "Benefit services", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0103", "Benefit services", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0104", "Benefit services", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0105", "Shipping company", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0106", "Shipping company", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0107", "Shipping company", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0108", "Shipping company", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0109", "Cure management", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x010A", "Cure management", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x010B", "MIFARE Micro Module (MMM) easy test card for antenna calibration", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x010C", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x010D", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x010E", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x010F", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x0110", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x0111", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x0112", "MIFARE Windows Application Demo", "Philips Semiconductors Gratkorn GmbH", "Mikron GmbH", "Mikron GmbH",
+    "0x0113", "Employer identification card", "VFJ Technology Pty Ltd", "VFJ Electronics Pty Ltd.", "VFJ Electronics PTy Ltd.",
+    "0x0114", "City Transport (Metro ticketing, bus ticket)", "VFJ Technology Pty Ltd", "VFJ Electronic Pty Ltd.", "Cubic - VFJ",
+    "0x0115", "Card Administration, cardholder administration, access control & security, company services, miscellaneous applications", "Ministry of Defense", "Ministry of Defence", "",
+    "0x0116", "City transport bus, ferry, administration", "VFJ Technology Pty Ltd", "VFJ Technology", "Cubic - VFJ",
+    "0x0117", "Busticketing System", "VFJ Technology Pty Ltd", "King Man County Public Traffic", "Barouh Electronic Co.",
+    "0x0118", "", "Reserved for MAD", "", "",
+    "0x0119", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011A", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011B", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011C", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011D", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011E", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x011F", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x0130", "Weighbridge for trucks", "VFJ Technology Pty Ltd", "Hardware Systems Sales", "",
+    "0x0131", "Bus services, access control, diverse (service)", "IEM - Intenierie Electronique Mecanique S.A.", "IEM SA", "IEM SA",
+    "0x0140", "Miscellaneous Application", "BOSCH Telecom GmbH", "Bosch Telecom GmbH", "Bosch Telecom GmbH",
+    "0x0141", "Configuration Master Card for MIFARE reader/writers", "Integrated Engineering", "IE Holding", "IE Holding",
+    "0x014B", "Photo copier controll, access controll, time & attendance", "Beka Elektronik", "BEKA Elektronik", "BEKA Elektronik",
+    "0x014C", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0x014D", "E-ticketing", "highQ Computerl\xc3\xb6sungen GmbH", "", "high Q",
+    "0x014E", "E-ticketing", "highQ Computerl\xc3\xb6sungen GmbH", "", "high Q",
+    "0x014F", "E-ticketing", "highQ Computerl\xc3\xb6sungen GmbH", "", "high Q",
+    "0x0150", "E-ticketing", "highQ Computerl\xc3\xb6sungen GmbH", "", "high Q",
+    "0x0151", "E-ticketing", "highQ Computerl\xc3\xb6sungen GmbH", "", "high Q",
+    "0x0153", "Admin profile", "KORID LK, spol. s r.o", "KORID LK, spol.s.r.o.", "KORID LK, spol.s.r.o.",
+    "0x0201", "Details of the card issuer", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0202", "Details of the card issuer", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x0203", "MIFARE Demonstration Software, G&D - F&E Dept.", "*Giesecke & Devrient GmbH", "G&D", "G&D",
+    "0x0204", "MIFARE Demonstration Software, G&D - F&E Dept.", "*Giesecke & Devrient GmbH", "G&D", "G&D",
+    "0x0205", "MIFARE Demonstration Software, G&D - F&E Dept.", "*Giesecke & Devrient GmbH", "G&D", "G&D",
+    "0x0206", "MIFARE Demonstration Software, G&D - F&E Dept.", "*Giesecke & Devrient GmbH", "G&D", "G&D",
+    "0x0207", "Watch service, owner id, electronical service book, messaging system for news", "Junghans Uhren GmbH", "Junghans Uhren GmbH", "",
+    "0x0208", "Card Touch Smart Card Applications", "Touch Technology International Inc.", "Touch Technology International", "Touch Technology International",
+    "0x0209", "Miscellaneous application, city traffic, access controll & security entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0x020A", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0x0301", "Social identification no. of card holder", "Rosan Finance", "Social Protection Org.", "Rosan Finance",
+    "0x0302", "Miscellaneous applications: customer profile, card administration", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x0303", "Miscellaneous applications: customer profile, card administration", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x0401", "Access Control, payment, ID, time registration", "Sagio A/S", "Sagio A/S", "Sagio A/S",
+    "0x054D", "Multifunctional appplications", "Braincon Technologies GmbH", "Braincon", "Braincon",
+    "0x054E", "Miscellaneous application", "\xc3\x9astecky kraj", "", "",
+    "0x054F", "Miscellaneous application", "\xc3\x9astecky kraj", "", "",
+    "0x0550", "Miscellaneous application", "\xc3\x9astecky kraj", "", "",
+    "0x0551", "Miscellaneous application", "\xc3\x9astecky kraj", "", "",
+    "0x0552", "Miscellaneous application", "\xc3\x9astecky kraj", "", "",
+    "0x0601", "Miscellaneous application", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x0602", "Miscellaneous application", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x0701", "Card administration", "MCF RF TECH SRL", "MCF", "MCF",
+    "0x0702", "City traffic, electronic purse, micellaneous applications", "Koordinator ODIS s.r.o.", "Koordinator", "PVT",
+    "0x0703", "Access control, electronic purse, parking, city cards", "ARD", "ARD", "ARD",
+    "0x0704", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x0705", "Application containing card holder information", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Podnik mest Mostu a Litvinova, a.s.", "Mikroelektronika, spol. sr. o., Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 M\xc3\xbdto, CZ",
+    "0x0706", "Service Application containing information about driver and inspector", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Podnik mest Mostu a Litvinova, a.s.", "Mikroelektronika, spol. sr. o., Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 M\xc3\xbdto, CZ",
+    "0x0707", "Bonus counter", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Podnik mest Mostu a Litvinova, a.s.", "Mikroelektronika, spol. sr.o. Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 M\xc3\xbdto, CZ",
+    "0x0708", "Liberec City Card - loyalty check", "Libereck\xc3\xa1 IS, a.s.", "Livereck\xc3\xa1 IS, a.s.", "Accenture Central Europe",
+    "0x0709", "Electronic purse, city traffic, customer profile, service application, check-in/out application", "Mikroelektronika spol.s r.o.", "Mikroelektronika", "Mikroelektronika",
+    "0x070A", "Electronic purse, city traffic, customer profile, service application, check-in/out application", "Mikroelektronika spol.s r.o.", "Mikroelektronika", "Mikroelektronika",
+    "0x070B", "Bonus Counter", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol s.r.o.", "Mikroelektronika spol s.r.o.",
+    "0x070C", "Card Administration", "MCF RF TECH SRL", "MCF RF TECH S.R.L.", "MCF RF TECH S.R.L.",
+    "0x070D", "Loyalty/Gift Card application for Cinemas, Resorts, Retails chains", "VERIFONE ITALIA SRL", "VeriFone Italia", "VeriFone Italia",
+    "0x070E", "Transaction log 3S", "Mikroelektronika spol.s r.o.", "Transmetro Guatemala", "SIEMENS Itron Business services S.A. - Cordoba, Rep. Argentina",
+    "0x070F", "Multifunctional ID card", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH",
+    "0x0710", "Multifunctional ID card", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH",
+    "0x0711", "Multifunctional ID card", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH", "Micros-Fidelio GmbH",
+    "0x0712", "Dedicated to marina users, to improve data consistancy", "MARINAPASS", "MARINAPASS", "Philippe FONTENOY",
+    "0x0713", "Customer profile", "KORID LK, spol. s r.o", "KORID LK, spol.s.r.o.", "KORID LK, spol.s.r.o.",
+    "0x0714", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x0715", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x0716", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x0717", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x0718", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x0719", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x071A", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x071B", "Cashless Payment; access and time control", "EVIS AG", "EVIS AG", "EVIS AG",
+    "0x071C", "Customer profile", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic",
+    "0x071D", "Customer profile", "Mikroelektronika spol.s r.o.", "ZAGREBACKI Holding d.o.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x071E", "Bonus counter", "Mikroelektronika spol.s r.o.", "ZAGREBACKI Holding d.o.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x071F", "Authentication of Casino Staff members", "Atronic Austria GmbH", "ATRONIC Austria GmBH", "ATRONIC Austria GmBH",
+    "0x0720", "Authentication of Casino Staff members", "Atronic Austria GmbH", "ATRONIC Austria GmBH", "ATRONIC Austria GmBH",
+    "0x0721", "Operator Card for Automated-Fare Collection System", "ACS Solutions Switzerland Ltd. a Xerox Company", "ACS Solutions Switzerland Ltd.", "ACS Solutions Switzerland Ltd.",
+    "0x0722", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0723", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0724", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0725", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0726", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0727", "Multi-application Card-Access Control, Ticketing payment", "APPLICAM", "APPLICAM", "APPLICAM",
+    "0x0728", "Bonus Counter", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x0729", "Info-Customer profile", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x072A", "Micropayments, access control and gift control", "METAPAY LTD.", "METAPAY LTD.", "EPAM Systems Ltd.",
+    "0x072B", "Customer profile", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o", "Mikroelektronika spol.s r.o",
+    "0x072C", "Biometric data", "Alphatronics", "", "Alphatronics",
+    "0x072D", "Hotel, Access control, entertainement, NFC, Academic, Comoany Service, Healt service", "USSEN Limited", "Ussen Limited", "Ussen Limited",
+    "0x072E", "Gangway Access Control for ships", "LabelCraft AS", "LabelCraft AS", "LabelCraft AS",
+    "0x072F", "Gangway Access Control for ships", "LabelCraft AS", "LabelCraft AS", "LabelCraft AS",
+    "0x0730", "E-ticketing ID card", "Monet+ a.s.", "Monet+ a.s.", "Monet+ a.s.",
+    "0x0731", "Europe", "Monet+ a.s.", "Monet+ a.s.", "Monet+ a.s.",
+    "0x0732", "Identification card", "Monet+ a.s.", "Monet+ a.s.", "Monet+ a.s.",
+    "0x0733", "Access control with point store systems for facility integration purpose", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x0734", "Configuration, control and initialization", "INID BV", "INID", "INID",
+    "0x0735", "Public transport systems. Parking systems. Catering. Electronic wallet. Reservation system. Access services. Attendance services. Industrial identification. City card.", "Duha syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.",
+    "0x0736", "Public transport systems. Parking systems. Catering. Electronic wallet. Reservation system. Access services. Attendance services. Industrial identification. City card.", "Duha syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.",
+    "0x0737", "Public transport systems. Parking systems. Catering. Electronic wallet. Reservation system. Access services. Attendance services. Industrial identification. City card.", "Duha syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.",
+    "0x0738", "Public transport systems. Parking systems. Catering. Electronic wallet. Reservation system. Access services. Attendance services. Industrial identification. City card.", "Duha syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.", "DUHA syst\xc3\xa9m s.r.o.",
+    "0x0739", "Customer profile", "Mikroelektronika spol.s r.o.", "Jamaica Urban Transit Company Ltd", "Mikroelektronika spol.s r.o.",
+    "0x073A", "Card Holder Information", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x073B", "PAAC transit services", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH",
+    "0x073C", "Customer loyalty", "K-Plus Oy", "K-Plus Oy", "",
+    "0x073D", "Customer loyalty", "K-Plus Oy", "K-Plus Oy", "",
+    "0x073E", "Customer loyalty", "K-Plus Oy", "K-Plus Oy", "",
+    "0x073F", "Bonus counter", "Mikroelektronika spol.s r.o.", "Jamaica Urban Transit Company Ltd", "Mikroelektronika spol.s r.o.",
+    "0x0740", "Transaction log 2S", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.",
+    "0x0741", "JIS", "eko TIP ID s.r.o", "University of West Bohemia in Pilsen", "eko TIP ID s.r.o",
+    "0x0742", "Mobile Ticket/Picticket", "MATRIX Solutions GmbH & Co.KG", "MATRIX Solutions GmbH & Co.KG", "MATRIX Solutions GmbH & Co.KG",
+    "0x0743", "Miscellaneous applications", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x0744", "Miscellaneous applications", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x0745", "Miscellaneous applications", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x0746", "Miscellaneous applications", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x0747", "Miscellaneous applications", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x0748", "Public Library User Identification", "Plasticard-ZFT GmbH", "Plasticard-ZFT GmbH", "Bibliotheca RFID Library Systems GmbH",
+    "0x0749", "Multiapplication", "IMA s.r.o.", "Ima Ltd", "",
+    "0x074A", "Supplementary information for other applications - bonus counters, logs", "TELMAX s.r.o.", "TELMAX s.r.o.", "TELMAX s.r.o.",
+    "0x074B", "Cafeteria services", "Netlock Kft.", "Netlock Kft.", "Netlock Kft.",
+    "0x074C", "Loyalty services", "Netlock Kft.", "Netlock Kft.", "Netlock Kft.",
+    "0x074D", "Access control, miscellaneous applications", "TAGGER SYSTEMS Co Ltd", "TAGGER SYSTEMS Co Ltd", "",
+    "0x074E", "Fuel card for International Diesel Sevice", "Kuwait Petroleum Belgium", "", "",
+    "0x074F", "Fuel card for International Diesel Sevice", "Kuwait Petroleum Belgium", "", "",
+    "0x0750", "Fuel card for International Diesel Sevice", "Kuwait Petroleum Belgium", "", "",
+    "0x0801", "Identification for airline related services", "Lufthansa German Airlines", "Deutsche Lufthansa AG", "Deutsche Lufthansa AG",
+    "0x0803", "Airlines", "KLM-Royal Dutch Airlines", "KLM", "KLM",
+    "0x0901", "Ticketing for ferry trafic", "Pay Vend Solutions", "Payvend Solutions", "Payvend Solutions",
+    "0x1001", "Bus services with extension to rail and taxi", "Questek Marketing", "Questek Marketing", "Questek Marketing",
+    "0x1003", "Railway Transit in Moscow region", "Moscow Railway Federal State Unitary Enterprize", "Moscow railway", "Express Card",
+    "0x1004", "Fare collection", "Tehran Urban & Suburban Railway Co.", "Processing World Corp", "Processing World Corp",
+    "0x1005", "Fare collection", "Ascom", "TUSRC", "Ascom Monetel",
+    "0x1006", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x1007", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1008", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1009", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100A", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100B", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100C", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100D", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100E", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x100F", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1010", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1011", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1012", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1013", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1014", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1015", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1016", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1017", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1018", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1019", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x101A", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x101B", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x101C", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x101D", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x101E", "Railway pass, univers pass, library", "Emcard a.s.", "Emcard", "Emtest",
+    "0x101F", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1020", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1021", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1022", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1023", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1024", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1025", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1026", "Railway services", "Prosoft Zilina", "Zeleznicna Spolocnost", "Prosoft SPDL",
+    "0x1027", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x1028", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x1029", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x102A", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x102B", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x102C", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft SPOL",
+    "0x102D", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x102E", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x102F", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x1030", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x1031", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x1032", "Railway services", "Prosoft Zilina", "Zeleznicna", "Prosoft",
+    "0x1033", "Railway services, fare collection", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x1034", "Railway services, fare collection", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x1035", "Ticketing and reservation for Egyptian Railways", "ENR Egyptian National Railways", "ENR Egyptian National Railways", "TransIT- Transportation Information Technology system, Elsag Datamat",
+    "0x1103", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1104", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1105", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1106", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1107", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1108", "Miscellaneous applications", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1109", "Miscellaneous applications", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x110A", "Miscellaneous applications", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x110B", "Digital registration of attendance of persons", "Simac QUADCORE", "Simac QUADCORE B.V.", "Simac QUADCORE B.V.",
+    "0x1201", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1202", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1203", "Transport ticketing", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x1204", "ACS - Almex Card Scheme", "H\xc3\xb6""ft & Wessel AG", "", "H\xc3\xb6""ft & Wessel AG",
+    "0x1205", "Public transport ticket", "MENNICA POLSKA s.a.", "MPK LODZ", "MENNICA POLSKA s.a.",
+    "0x1206", "Transport ticketing", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x1207", "Transport ticketing", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x1208", "Transport ticketing", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x1209", "Transport ticketing", "\xc3\x9astecky kraj", "", "",
+    "0x120A", "Transport ticketing", "\xc3\x9astecky kraj", "", "",
+    "0x120B", "Transport ticketing", "\xc3\x9astecky kraj", "", "",
+    "0x120C", "Public Transportation System ticketing e-wallet", "Ministry of Justice of Georgia", "Ministry of Justice of Georgia", "",
+    "0x120D", "Electronic tickets for public transpor", "TELMAX s.r.o.", "TELMAX s.r.o.", "TELMAX s.r.o.",
+    "0x120E", "City transportation card for Subway, Bus & Minibus", "AzRy LLC", "Metro service LLC", "AzRy LLC",
+    "0x120F", "Interoperable fare management system for transport in Basque Country", "IDOM INGENIERIA Y CONSULTORIA", "Mugitu", "Mugitu",
+    "0x1801", "City Transport (Metro ticketing, bus ticket)", "VFJ Technology Pty Ltd", "VFJ Electronic Pty Ltd.", "Cubic - VFJ",
+    "0x1802", "Public transport fare collection", "Buscom Oy", "City of Vaasa", "Buscom",
+    "0x1803", "Busticketing System", "VFJ Technology Pty Ltd", "King Man County Public Traffic", "Barouh Electronic Co.",
+    "0x1808", "Payment for transit by metro", "Moscow Metro", "Moscow Metro", "Express Card",
+    "0x1809", "Transit/public transport", "Rosan Finance", "Moscow street public transport org.", "Rosan Finance",
+    "0x180A", "Multiapplication car for industry & trafic, parking, swimming pool", "ASEC S.A.", "ASEC S.A", "ASEC S.A",
+    "0x180B", "Miscellaneous application, city traffic, access control & security, entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0x180C", "Electronic purse, city traffic", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plzenske Mestske", "Plzenske Mestske",
+    "0x180D", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x180E", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x180F", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1810", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1811", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1812", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1813", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1814", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1815", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1816", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1817", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1818", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1819", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x181A", "Subway payment system", "LOT Ltd", "LOT", "LOT",
+    "0x181B", "Subway payment system", "LOT Ltd", "LOT", "LOT",
+    "0x181C", "City traffic, electronic purse, micellaneous applications", "Koordinator ODIS s.r.o.", "Koordinator", "PVT",
+    "0x181D", "City traffic, electronic purse, micellaneous applications", "Koordinator ODIS s.r.o.", "Koordinator", "PVT",
+    "0x181F", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0x1820", "Electronic purse, car-parking system, single use ticket, period pass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x1821", "Electronic purse, car-parking system, single use ticket, period pass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x1822", "Liberec City Card - Public transport application", "Libereck\xc3\xa1 IS, a.s.", "Libereck\xc3\xa1 IS, a.s.", "Accenture Central Europe",
+    "0x1823", "Season ticket", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Pdnik mest Mostu a Litvinova, a.s.", "Mikroelectronika, spol. sr. o., Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 M\xc3\xbdto, CZ",
+    "0x1824", "Check in/out application", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Podnik mest Mostu a Litvinova, a.s.", "Mikroelektronika, spol. sr.o., Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 M\xc3\xbdto, CZ",
+    "0x1825", "Car Parking, Electronic Purse", "Haguess s.r.o.", "Haguess, s.r.o.", "Haguess, s.r.o.",
+    "0x1826", "EFC-single-use ticket", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x1827", "EFC period pass", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x1828", "Liberec City Card - Season Pass Transport Tariffs", "Libereck\xc3\xa1 IS, a.s.", "Libereck\xc3\xa1 IS, a.s.", "Accenture Central Europe",
+    "0x1829", "Liberec City Card - Pre-pay Transport Tariffs", "Libereck\xc3\xa1 IS, a.s.", "Libereck\xc3\xa1 IS, a.s.", "Accenture Central Europe",
+    "0x182A", "Electronic purse, city traffic, customer profile, service applic, check-in/out applic", "Mikroelektronika spol.s r.o.", "Mikroelektronika", "Mikroelektronika",
+    "0x182B", "Prepaid ticket", "Mikroelektronika spol.s r.o.", "S.C. TRANSPORT PUBLICS A., Bacau, Romania", "MIKROELEKTRONIKA spol. s.r.i.",
+    "0x182C", "Credit 2S", "Mikroelektronika spol.s r.o.", "Transmetro Guatemala", "SIEMENS Itron Business Services S.A. - Cordoba, Republica Argentina",
+    "0x182D", "Prepaid coupon 1S", "Mikroelektronika spol.s r.o.", "Transmetro Guatemala", "SIEMENS Itron Business services S.A. - Cordoba, Rep. Argentina",
+    "0x182E", "Prepaid ticket", "Mikroelektronika spol.s r.o.", "Panturist d.d., Croatia", "MIKROELEKTRONIKA spol.s.r.o., Vysoke Myto, Czech Republic",
+    "0x182F", "Prepaid coupon", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.",
+    "0x1830", "City traffic", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.",
+    "0x1831", "City traffic", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.",
+    "0x1832", "Prepaid coupon", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.",
+    "0x1834", "Prepaid coupon", "KORID LK, spol. s r.o", "KORID LK, spol.s.r.o.", "KORID LK, spol.s.r.o.",
+    "0x1835", "Eticket", "KORID LK, spol. s r.o", "KORID LK, spol.s.r.o.", "KORID LK, spol.s.r.o.",
+    "0x1836", "Prepaid coupon 1S", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic",
+    "0x1837", "Prepaid coupon", "Mikroelektronika spol.s r.o.", "ZAGREBACKI Holding d.o.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x1838", "Prepaid coupon", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x1839", "Prepaid coupon", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o", "Mikroelektronika spol.s r.o",
+    "0x183B", "City traffic services - ticket control, city card for Polish municipal services", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x183C", "City traffic services - ticket control, city card for Polish municipal services", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x183D", "City traffic services - ticket control, city card for Polish municipal services", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x183E", "City traffic services - ticket control, city card for Polish municipal services", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x183F", "Public transportation", "OY MATKAHUOLTO AB", "OY MATKAHUOLTO AB", "OY MATKAHUOLTO AB",
+    "0x1840", "Public transportation", "OY MATKAHUOLTO AB", "OY MATKAHUOLTO AB", "OY MATKAHUOLTO AB",
+    "0x1841", "City traffic, prepaid ticket, check in/out", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x1842", "City traffic, prepaid ticket, check in/out", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x1843", "Car authentication for telematics", "NXP Semiconductors", "NXP Semiconductors", "NXP Semiconductors",
+    "0x1844", "Public transport ticketing services", "Netlock Ltd", "Netlock Kft.", "Netlock Kft.",
+    "0x1903", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x1904", "Railway services", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x2001", "Bus fare collection", "Ascom Mon\xc3\xa9tel", "C.T.A.V.", "Mon\xc3\xa9tel S.A.",
+    "0x2002", "Bus fare collection", "Ascom Mon\xc3\xa9tel", "Conseil G\xc3\xa9n\xc3\xa9ral du TARN", "Ascom Mon\xc3\xa9tel",
+    "0x2003", "Bus service, \xc3\x96PNV", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x2004", "Bus service, \xc3\x96PNV", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x2005", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Forbus Intercity", "Ascom Mon\xc3\xa9tel S.A.",
+    "0x2006", "Public transport", "Scan Coin AB", "Scan Coin AB", "",
+    "0x2007", "Ticketing system for public transport in Sweden, used primarily on buses", "CPT Nordic AB", "Country traffic in Sweden", "CPI Nordic AB",
+    "0x2008", "Bus Fare collection", "Ascom Mon\xc3\xa9tel", "Setrans P", "As om Monet\xc3\xa9l SA",
+    "0x2009", "Automatic Fare Collection city and intercity bus traffic electronic purse", "Trgovina in Informatika d.o.o.", "Fourth Way - Alpetour", "Fourth Way",
+    "0x200A", "", "Reserved for MAD", "", "",
+    "0x200B", "Transport Ticketing, E-Purse, Citycard", "CJS Consultancy Ltd", "", "Transmo Citycard Ltd.",
+    "0x200C", "Bus fare collection", "Ascom Mon\xc3\xa9tel", "Maybus", "Ascom Monetel",
+    "0x200D", "Bus services with extension to rail and taxi", "Questek Marketing", "Questek Marketing", "Questek Marketing",
+    "0x200E", "Bus fare colection", "Ascom Mon\xc3\xa9tel", "Oestfold", "Ascom Mon\xc3\xa9tel",
+    "0x200F", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "SATAR", "Ascom Monetel S.A.",
+    "0x2010", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Atam Arezzo", "Ascom Monetel - SA",
+    "0x2011", "Collect fare system for transit authority", "Soprin ADS", "Soprin ADS - Ascom Monetel", "Soprin ADS",
+    "0x2012", "Busticketing System", "VFJ Technology Pty Ltd", "King Man County Public Traffic", "Barouh Electronic Co.",
+    "0x2013", "Bus, Tramway, Underground Services", "Ascom Mon\xc3\xa9tel", "ZTM (Transport Company of Marsaw)", "Ascom Monetel (project leader Mr. Pascal Valette)",
+    "0x2014", "Electronic transportation voucher", "GRUPO VR", "Grupo VR", "",
+    "0x2015", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2016", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2017", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2018", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2019", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201A", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201B", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201C", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201D", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201E", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x201F", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2020", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2021", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2022", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2023", "Electronic fee collection", "EFKON AG", "Efkon", "Efkon",
+    "0x2030", "Bus & tramway fare collection", "Ascom", "SMTU - Montpellier", "Ascom Mon\xc3\xa9tel",
+    "0x2031", "City transport bus, ferry, administration", "VFJ Technology Pty Ltd", "VFJ Technology", "Cubic - VFJ",
+    "0x2032", "Bus fare collection", "Ascom Mon\xc3\xa9tel", "", "Ascom Mon\xc3\xa9tel",
+    "0x2035", "Bus fare collection", "Ascom Mon\xc3\xa9tel", "TCL", "Ascom Mon\xc3\xa9tel",
+    "0x2036", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "TCL", "Ascom Mon\xc3\xa9tel",
+    "0x2037", "Bus fare collection", "Ascom", "Tarragone (Spain)", "Ascom Mon\xc3\xa9tel",
+    "0x2038", "Bus fare collection", "Ascom", "Tarragone (Spain)", "Ascom Mon\xc3\xa9tel",
+    "0x2039", "Bus fare collection", "Ascom", "Tarragone (Spain)", "Ascom Mon\xc3\xa9tel",
+    "0x203A", "Bus fare collection", "Ascom", "Tarragone (Spain)", "Ascom Mon\xc3\xa9tel",
+    "0x203F", "Bus fare collection", "Ascom", "Salineira Ltda", "Ascom Monetel",
+    "0x2040", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Ascom Mon\xc3\xa9tel", "Ascom Mon\xc3\xa9tel",
+    "0x2041", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Ascom Mon\xc3\xa9tel", "Ascom Meon\xc3\xa9tel",
+    "0x2042", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Ascom Mon\xc3\xa9tel", "Ascom Mon\xc3\xa9tel",
+    "0x2043", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Systas", "Ascom Mon\xc3\xa9tel",
+    "0x2044", "Bus Fare Collection", "Ascom Mon\xc3\xa9tel", "Systas", "Ascom Mo\xc3\xa9tel",
+    "0x2045", "Access control, time attendance, bus ticket, hotel room card, VIP card f. club", "Giga-TMS Inc", "Giga TMS", "Giga TMS",
+    "0x2046", "Bus fare collection", "Ascom", "Burulas", "Burulas",
+    "0x2047", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x2048", "Bus fare collection", "Ascom", "Eskisehir", "EAS",
+    "0x2049", "Bus fare collection", "Ascom", "Metro Ciudad Mexico", "Ascom",
+    "0x204D", "Elec ticketing, access control, electronic purse", "Empresa 1 Sistemas de Automacao e Comercio", "Empresa 1", "Empresa 1",
+    "0x204E", "City card, prepaid ticket, cardholder, servicespass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x204F", "Fidelity, student, period pass, single-use ticket", "Emcard a.s.", "emcard", "emtest",
+    "0x2050", "Fidelity, student, period pass, single-use ticket", "Emcard a.s.", "emcard", "emtest",
+    "0x2051", "Fidelity, student, period pass, single-use ticket", "Emcard a.s.", "emcard", "emtest",
+    "0x2052", "Fidelity, student, period pass, single-use ticket", "Emcard a.s.", "emcard", "emtest",
+    "0x2053", "Bus, Underground", "ACS - Affiliated Computer Services", "Tisseo", "ACS",
+    "0x2054", "Bus Fare Collection", "A.C.S. SAS France", "ACS", "MetropolitanTransitAuthority of Harris Country",
+    "0x2055", "Public Transport Fare Collection", "Dublin Bus", "Dublin Bus", "Dublin Bus",
+    "0x2056", "Fidelity pass", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x2057", "Service pass", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x2058", "EFC-single-use ticket", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x2059", "EFC-time ticket", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x205A", "Bus Ticketing", "Krauth Technology", "Prof.A.Krauth Apparatebau", "Prof.A.Krauth Apparatebau",
+    "0x205B", "Transit SmartCard System, City E-purse System", "Intelligent Transaction Systems de Mexico S.A. de C.V.", "St. John's Transportation Commission", "Intelligent Transaction Systems de Mexico",
+    "0x205C", "Bus fare collection system", "PENTA d.o.o.", "PENTA", "PENTA",
+    "0x205D", "Bus fare collection system", "PENTA d.o.o.", "PENTA", "PENTA",
+    "0x205E", "Bus fare collection system", "PENTA d.o.o.", "PENTA", "PENTA",
+    "0x205F", "Bus e-ticketing system for different provinces of Iran", "Processing World Co.", "Processing world co.", "Processing world co.",
+    "0x2060", "Bus", "ACS - Affiliated Computer Services", "ACS", "ACS",
+    "0x2061", "Electronic ticket", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o.",
+    "0x2062", "Electronic tiicket", "Mikroelektronika spol.s r.o.", "ZAGREBACKI Holding d.o.o.", "MIKROELEKTRONIKA spol.s.r.o",
+    "0x2063", "Electronic ticket", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x2064", "BUS", "ACS - Affiliated Computer Services", "ACS", "ACS",
+    "0x2065", "Transit ridership", "FARE Logistics", "", "Fare Logistics",
+    "0x2066", "BUS FARE COLLECTION", "ACS - Affiliated Computer Services", "BRESCIATRASPORTI", "ACS",
+    "0x2067", "Bus", "ACS - Affiliated Computer Services", "ACS", "ACS",
+    "0x2068", "Electronic ticket", "Mikroelektronika spol.s r.o.", "Jamaica Urban Transit Company Ltd", "Mikroelektronika spol.s r.o.",
+    "0x2069", "Electronic couponticket for public transport", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x206A", "Electronic ticket for public transport", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0x206B", "Bus Rail Fare Collection", "ACS - Affiliated Computer Services", "DTEI", "ACS",
+    "0x206C", "Bus", "ACS - Affiliated Computer Services", "STO", "ACS",
+    "0x206D", "Bus services, bus fare collection", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x206E", "Bus services, bus fare collection", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x206F", "Automatic Fare Collection System", "ACS Solution France", "Briansk", "ACS",
+    "0x2070", "Bus fare collection", "ACS - Affiliated Computer Services", "DOT", "ACS",
+    "0x2071", "Bus", "Xerox", "SEMITAN", "TAN",
+    "0x2101", "Card Touch Smart Card Applications", "Touch Technology International Inc.", "Touch Technology International", "Touch Technology International",
+    "0x2102", "Transport Ticketing", "Ascom", "SBME Milano", "A.I.I.",
+    "0x2103", "Multi-Modal Transit (Vix/ERG)", "ERG Transit Systems", "ERG Transit Systems", "ERG Transit Systems",
+    "0x2104", "Multi-Modal Transit", "ERG Transit Systems", "ERG Transit Systems", "ERG Transit Systems",
+    "0x2105", "Transit (Metrocard / Christchurch)", "INIT Transit Systems", "INIT Transit Systems", "INIT Transit Systems",
+    "0x2108", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x2109", "Pre-paid bus card, passanger ID bus card", "Intelligent Transaction Systems de Mexico S.A. de C.V.", "Intelligent Transaction", "Intelligent Transcation",
+    "0x210A", "Pre-paid bus card, passanger ID bus card", "Intelligent Transaction Systems de Mexico S.A. de C.V.", "Intelligent Transaction", "Intelligent Transcation",
+    "0x210B", "Pre-paid bus card, passanger ID bus card", "Intelligent Transaction Systems de Mexico S.A. de C.V.", "Intelligent Transaction", "Intelligent Transcation",
+    "0x210C", "City card, prepaid ticket, cardholder, servicespass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x210D", "City card, prepaid ticket, cardholder, servicespass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x210E", "Integrated multi-modal transport ticketing system", "HOP Fastpass", "HOP Fastpass", "HOP Fastpass",
+    "0x210F", "Integrated multi-modal transport ticketing system", "Keane Australia PTY Limited", "TTA", "KAMCO",
+    "0x2110", "Integrated multi-modal transport ticketing system", "Keane Australia PTY Limited", "TTA", "KAMCO",
+    "0x2111", "Card holder", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x2112", "Prepaid ticket", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x2113", "Electronic purse, city traffic, customer profile, service applic, check-in/out applic", "Mikroelektronika spol.s r.o.", "Mikroelektronika", "Mikroelektronika",
+    "0x2114", "Electronic ticketing for city of Friedrichshafen", "T-Systems GEI GmbH", "T-Systems GEI", "T-Systems GEI",
+    "0x2115", "Transportation ticket (L\xc3\xadta\xc4\x8dka)", "Haguess s.r.o.", "HAGUESS, a.s.", "HAGUESS, a.s",
+    "0x2116", "Bus and rail fare collection", "ACS - Affiliated Computer Services", "GCRTA", "ACS",
+    "0x2117", "Prepaid coupon - prepaid ticket for multimodal transport", "CSAD SVT Praha", "", "Mikroelektronika, EMTEST",
+    "0x2118", "Epurse - electronic purse intended for payment of fare in multimodal public transport", "CSAD SVT Praha", "", "Mikroelektronika, EMTEST",
+    "0x2119", "Automatic fare payment system for multi-modal transit", "Cubic Corporation", "", "Cubic Transportation Systems",
+    "0x211A", "Public transport smartcard integrated ticketing scheme for the Republic of Ireland", "Railway Procurement Agency", "Dublin Bus, Irish Rail, Bus Eireann, private-bus-operators", "RPA",
+    "0x211B", "General Ticketing Solution for Mas Transit", "Parkeon", "PARKEON", "PARKEON",
+    "0x211C", "General Ticketing Solution for Mas Transit", "Parkeon", "PARKEON", "PARKEON",
+    "0x211D", "Multi-modal Transit", "V\xc3\xa4stra G\xc3\xb6talandsregionen", "V\xc3\xa4sttrafik AB", "Vix ERG",
+    "0x211E", "Transport application", "Unicard Limited UK", "Unicard Limited", "Unicard Limited",
+    "0x211F", "Transit fare collection, transit purse, transit ID", "GFI Genfare", "", "GFI Genfare, an SPX Division",
+    "0x2120", "Transit fare collection, transit purse, transit ID", "GFI Genfare", "", "GFI Genfare, an SPX Division",
+    "0x2121", "Transit fare collection, transit purse, transit ID", "GFI Genfare", "", "GFI Genfare, an SPX Division",
+    "0x2122", "Bus and rail fare collection", "ACS - Affiliated Computer Services", "RTD", "ACS",
+    "0x2136", "Bus and rail fare collection (HOLO)", "INIT", "INIT", "INIT",
+    "0x2138", "Bus and rail fare collection (Ventra)", "Cubic", "Cubic", "Cubic",
+    "0x2139", "Bus and rail fare collection (Clipper)", "Cubic", "Cubic", "Cubic",
+    "0x213A", "Bus and rail fare collection (WAVE)", "INIT Rhode Island", "INIT Rhode Island", "INIT Rhode Island",
+    "0x2801", "Bus services with extension to rail and taxi", "Questek Marketing", "Questek Marketing", "Questek Marketing",
+    "0x2803", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x3001", "Tollway system", "VFJ Technology Pty Ltd", "VFJ Technology Pty Ltd", "Chendu Shuguang Optical Fibre Network (Ltd. China)",
+    "0x3002", "Tollway system", "VFJ Technology Pty Ltd", "VFJ Technology Pty Ltd", "Chendu Shuguang Optical Fibre Network (Ltd. China)",
+    "0x3003", "Toll collection", "Philips Projects", "Concepa (Concecionaria da Rodovia Oso Rio - Porto Alegre)", "Philips Projects Brazil",
+    "0x3004", "Toll collection", "Philips Projects", "Concepa (Concecionaria da Rodovia Oso Rio - Porto Alegre)", "Philips Projects Brazil",
+    "0x3005", "Toll collection", "Philips Projects", "Concepa (Concecionaria da Rodovia Oso Rio - Porto Alegre)", "Philips Projects Brazil",
+    "0x3006", "Toll collection", "Philips Projects", "Concepa (Concecionaria da Rodovia Oso Rio - Porto Alegre)", "Philips Projects Brazil",
+    "0x3007", "Toll collection", "Philips Projects", "Concepa (Concecionaria da Rodovia Oso Rio - Porto Alegre)", "Philips Projects Brazil",
+    "0x3008", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3009", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x300A", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x300B", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x300C", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x300D", "Road Tolling Application", "EFKON AG", "Efkon", "Efkon",
+    "0x300E", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x300F", "Tollway", "VFJ Technology Pty Ltd", "VFJ HK", "",
+    "0x3010", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x3011", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x3012", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x3013", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x3014", "Tollway", "VFJ Technology Pty Ltd", "Austream", "Austream",
+    "0x3015", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x3016", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x3017", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x3018", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x3019", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x301A", "Road toll application", "EFKON AG", "efkon", "efkon",
+    "0x301B", "Road Toll Application", "EFKON AG", "Efkon", "Philips Projects",
+    "0x301C", "Road Toll Application", "EFKON AG", "Efkon", "Philips Projects",
+    "0x301D", "Road Toll Application", "EFKON AG", "Efkon", "Philips Projects",
+    "0x301E", "Road Toll Application", "EFKON AG", "Efkon", "Philips Projects",
+    "0x301F", "Road Toll Application", "EFKON AG", "Efkon", "Philips Projects",
+    "0x3020", "Weighbridge for trucks", "VFJ Technology Pty Ltd", "Hardware Systems Sales", "",
+    "0x3021", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3022", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3023", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3024", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3025", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3026", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3027", "Road toll", "EFKON AG", "efkon", "efkon",
+    "0x3028", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x3029", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x302A", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x302B", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x302C", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x302D", "Road toll", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x302E", "Road toll", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x302F", "Road toll", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3030", "Road toll", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3031", "Road toll", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3032", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3033", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3034", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3035", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3036", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3037", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3038", "Road Toll Application", "EFKON AG", "Efkon", "Efkon",
+    "0x3039", "Road Toll Application", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x303A", "Road Toll Application", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x303B", "Road Toll Application", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x303C", "Road Toll Application", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x303E", "Road Toll Application", "Compsis Comp. Sist. Ind. Com. LTDA", "Compsis", "Compsis",
+    "0x303F", "Road Toll Application", "Compsis Comp. Sist. Ind. Com. LTDA", "Compsis", "Compsis",
+    "0x3040", "Road Toll Application", "Compsis Comp. Sist. Ind. Com. LTDA", "Compsis", "Compsis",
+    "0x3041", "Road Toll Application", "Compsis Comp. Sist. Ind. Com. LTDA", "Compsis", "Compsis",
+    "0x3042", "Road Toll Application", "Compsis Comp. Sist. Ind. Com. LTDA", "Compsis", "Compsis",
+    "0x3043", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x3046", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x3047", "Road Toll", "EFKON AG", "Efkon", "Efkon",
+    "0x3048", "Toll payment", "GPS Tecnologia Ltda.", "GPS", "GPS",
+    "0x3049", "Electronic toll collection", "Cetrta Pot d.o.o.", "Dars d.d.", "Cetrta POT d.o.o.",
+    "0x305A", "Road toll", "Diners Club Adriatic d.d.", "Diners Club", "Diners Club",
+    "0x305B", "Road toll", "Diners Club Adriatic d.d.", "Diners Club", "Diners Club",
+    "0x3102", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3103", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3104", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3105", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3106", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3107", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3108", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3109", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x310A", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x310B", "Intelligent Transport Services", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0x3801", "Stored value card payment system", "GiroVend Cashless Systems PLC", "GiroVend", "GiroVend",
+    "0x3802", "Card Administratin, cardholder administration, access control & security, company services, miscellaneous applications", "Ministry of Defense", "Ministry of Defence", "",
+    "0x3803", "Company Payment System, Company Facility Services, Company Identification Services", "Maas Systems B.V.", "Maas Systems B.V.", "Mass Systems B.V.",
+    "0x3804", "Company Payment System, Company Facility Services, Company Identification Services", "Maas Systems B.V.", "Maas Systems B.V.", "Mass Systems B.V.",
+    "0x3805", "Company Payment System, Company Facility Services, Company Identification Services", "Maas Systems B.V.", "Maas Systems B.V.", "Mass Systems B.V.",
+    "0x3807", "Access control, company service", "Automaten Seitz GmbH", "Automaten Seitz", "Automaten Seitz",
+    "0x3808", "Access controll security payment", "Matsushita Communication Industrial", "Matsushita Communication", "Matsushita Communication",
+    "0x3809", "Multi functional badge, private application", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0x380A", "", "InterCard GmbH Kartensysteme", "Inter Card GmbH", "Inter Card GmbH",
+    "0x380B", "", "InterCard GmbH Kartensysteme", "Inter Card GmbH", "Inter Card GmbH",
+    "0x380C", "", "InterCard GmbH Kartensysteme", "Inter Card GmbH", "Inter Card GmbH",
+    "0x380D", "Identification service", "Pink Roccade", "Pink Roccade", "Pink Roccade",
+    "0x380E", "Multiapplication car for industry & trafic, parking, swimming pool", "ASEC S.A.", "ASEC S.A", "ASEC S.A",
+    "0x380F", "Payment and registration system", "Magna Carta B.U.", "Magna Carta", "Magna Carta",
+    "0x3810", "Identification service", "Pink Roccade", "Pink Roccade", "Pink Roccade",
+    "0x3811", "Company Facility Service", "Deister Electronic", "Deister Electronic GmbH", "Deister Electronic GmbH",
+    "0x3812", "Company Facility Service", "Deister Electronic", "Deister Electronic GmbH", "Deister Electronic GmbH",
+    "0x3813", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3814", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3815", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3816", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3817", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3818", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3819", "Multi functional badge for private application", "Microtronic AG", "Microtronic", "Microtronic",
+    "0x3827", "Cashless payment and others", "GPI GmbH", "GPI GmbH", "GPI GmbH",
+    "0x3828", "Company services", "Deutsche Lufthansa AG FFM", "Deutsche Lufthansa AG", "Deutsche Lufthansa AG",
+    "0x3829", "Access control, time management, electronic wallet", "Universitaire Ziekenhuizen Leuven", "", "GET NV",
+    "0x382A", "Company services", "Card3 GmbH", "Card3 GmbH", "Card3 GmbH",
+    "0x382B", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0x382C", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x382D", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x382E", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x382F", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x3830", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x3831", "Road toll", "Diners Club Adriatic d.d.", "Diners Club", "Diners Club",
+    "0x3832", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x3833", "Company services", "Cash Card Automaten GmbH", "Cash Card", "Cash Card",
+    "0x3834", "Access control, computer application, company services", "Volvo Car Corporation", "Volvo Car", "Volvo Car",
+    "0x3835", "Time attendnace, fuel, access control", "Emcard a.s.", "Emtest", "Emtest",
+    "0x3836", "Company services", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x3837", "Multiple Company Services", "Viessmann Werke GmbH & Co KG", "Viessmann Werke", "Viessmann Werke",
+    "0x3839", "E.purse", "GTI", "Mr. Eric Houri", "Mr. Francois Bodard",
+    "0x383A", "Company services", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.", "MENNICA POLSKA S.A.",
+    "0x383B", "Company Services", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH",
+    "0x383C", "", "Reac BV", "", "REAC",
+    "0x383D", "Follow me printing system", "N.V. EPZ", "EPZ", "Xerox Corporation",
+    "0x383E", "Registration of received radiation dose in nuclear power plant", "N.V. EPZ", "EPZ", "Mirion Technologies/MGP",
+    "0x383F", "Access control, identification", "Swedish Social Isurance Agency", "Swedish Social Isurance Agency", "Swedish Social Isurance Agency",
+    "0x3840", "Payment and registration", "PAYCULT GMBH", "PAYCULT", "PAYCULT",
+    "0x3D01", "Access Control (SIO)", "HID Global", "HID Corporation", "HID Corporation",
+    "0x3D02", "Access Control Biometric (SIO)", "HID Global", "HID Corporation", "HID Corporation",
+    "0x3C56", "City transport, prepaid ticket, cardholder, servicespass", "Ridango AS", "Pilet.ee ekaart", "Pilet.ee ekaart",
+    "0x3D56", "City transport, prepaid ticket, cardholder, servicespass", "Ridango AS", "Pilet.ee ekaart", "Pilet.ee ekaart",
+    "0x4001", "City transport bus, ferry, administration", "VFJ Technology Pty Ltd", "VFJ Technology", "Cubic - VFJ",
+    "0x4002", "Transport Ticketing, E-Purse, Citycard", "CJS Consultancy Ltd", "", "Transmo Citycard Ltd.",
+    "0x4003", "Combined application for access control, ferry and rail ticketing for the Island of Langegeoog", "Companion GmbH", "Companion GmbH", "Companion GmbH, Krups Consultants GmbH, Gemplus GmbH",
+    "0x4004", "User needs and preference", "University of Newcastle", "Distinct", "University of Newcastle",
+    "0x4005", "User needs and preference", "University of Newcastle", "Distinct", "University of Newcastle",
+    "0x4006", "User needs and preference", "University of Newcastle", "Distinct", "University of Newcastle",
+    "0x4007", "User needs and preference", "University of Newcastle", "Distinct", "University of Newcastle",
+    "0x4008", "User needs and preference", "University of Newcastle", "Distinct", "University of Newcastle",
+    "0x4009", "City card services", "Rosan Finance", "Retail Trade and Services in Moscow", "Express card",
+    "0x400B", "City card services", "Moscow Government Department For Retail Trade and Services", "Retail Trade and Service", "Express Card",
+    "0x400C", "Identification of cardholder", "Rosan Finance", "Retail Trade and Services", "Rosan Finance",
+    "0x400D", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x400E", "Access control", "Connex Solutions Limited", "Connex", "Connex",
+    "0x400F", "Acess Control, Time and Attendance", "Milenio 3 Systemas Electonicos", "Milenio3", "Milenio3",
+    "0x4010", "City card services", "Axess AG", "Axess", "Axess",
+    "0x4011", "Provision of citizen services", "UK National Smartcard Project", "English Local Authorities", "",
+    "0x4012", "Provision of citizen services", "UK National Smartcard Project", "English Local Authorities", "",
+    "0x4013", "Provision of citizen services", "UK National Smartcard Project", "English Local Authorities", "",
+    "0x4014", "City card, prepaid ticket, cardholder, servicespass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x4015", "Liberec City Car, Card manag center", "Libereck\xc3\xa1 IS, a.s.", "Liberecka", "Accenture Central Europe",
+    "0x4016", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x4017", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x4018", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x4019", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401A", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401B", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401C", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401D", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401E", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x401F", "City Card Services", "Centro Informatico Municipal", "Donostiako Udala/Ayuntamiento de San Sebastian", "Centro Informatico Municipal",
+    "0x4020", "City card", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x4021", "Programa Informatico para Fidelazcion Clientes", "LAI Sistemas Informaticos S.L.", "LAI Sistemas Informaticos S.L.", "Luis Maria Ortiz Gorraiz",
+    "0x4022", "Programa Informatico para Fidelazcion Clientes", "LAI Sistemas Informaticos S.L.", "LAI Sistemas Informaticos S.L.", "Luis Maria Ortiz Gorraiz",
+    "0x4023", "Programa Informatico para Fidelazcion Clientes", "LAI Sistemas Informaticos S.L.", "LAI Sistemas Informaticos S.L.", "Luis Maria Ortiz Gorraiz",
+    "0x4024", "Programa Informatico para Fidelazcion Clientes", "LAI Sistemas Informaticos S.L.", "LAI Sistemas Informaticos S.L.", "Luis Maria Ortiz Gorraiz",
+    "0x4025", "Programa Informatico para Fidelazcion Clientes", "LAI Sistemas Informaticos S.L.", "LAI Sistemas Informaticos S.L.", "Luis Maria Ortiz Gorraiz",
+    "0x4026", "City card services", "Monet+ a.s.", "MONET+, a.s.", "MONET+, a.s.",
+    "0x4027", "Fare collection & access control", "Pusatec Oy", "PUSATEC", "PUSATEC",
+    "0x4028", "Security management; card management; access control", "NISCAYAH B.V.", "NISCAYAH", "NISCAYAH",
+    "0x4029", "Security management; card management; access control", "NISCAYAH B.V.", "NISCAYAH", "NISCAYAH",
+    "0x402A", "City card services", "Gantner Electronic GmbH", "GANTNER Electronic", "GANTNER Electronic",
+    "0x402B", "National ID Card for Bogota City", "Bogota Distrito Capital", "Tarjeta Ciudadana Bogota Capital - TCBC", "SMARTCHIP S.A.",
+    "0x402C", "City card services", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH",
+    "0x4701", "Access control, Time attendanc, job control", "EM Group", "EM Group", "EM Group",
+    "0x4702", "Access control", "One Security PTY Ltd", "One Security", "One Security",
+    "0x4703", "Access control & security, entertainment and sports", "Giga-TMS Inc", "Giga", "Giga",
+    "0x4707", "Various Access Control Applications", "Honeywell Access Systems", "", "HAS - Reston, VA; HAS - Oak Creek; HAS - Austin Texas",
+    "0x4708", "Various Access Control Applications", "Honeywell Access Systems", "", "HAS - Reston, VA; HAS - Oak Creek; HAS - Austin Texas",
+    "0x4709", "Various Access Control Applications", "Honeywell Access Systems", "", "HAS - Reston, VA; HAS - Oak Creek; HAS - Austin Texas",
+    "0x470A", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x470B", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x470C", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x470D", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x470E", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x470F", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4710", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4711", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4712", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4713", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4714", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4715", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4716", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4717", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4718", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4719", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471A", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471B", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471C", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471D", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471E", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x471F", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4720", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4721", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4722", "Access Control", "IOLAN BV", "IOLAN BV", "IOLAN BV",
+    "0x4723", "Application COBALT access control ", "TECHNICOB", "TECHNICOB", "TECHNICOB",
+    "0x4724", "Access control, benefits", "\xc3\x9astecky kraj", "", "",
+    "0x4725", "Access control", "ASCOM", "ASCOM", "ASCOM",
+    "0x4726", "Lockers, access control and switch system integration", "ENKOA System", "Enkoa", "Juan Cruz Iriondo",
+    "0x4727", "Lockers, access control and switch system integration", "ENKOA System", "Enkoa", "Juan Cruz Iriondo",
+    "0x4728", "Lockers, access control and switch system integration", "ENKOA System", "Enkoa", "Juan Cruz Iriondo",
+    "0x4730", "Access control", "Inner Range", "Inner Range", "Inner Range",
+    "0x4801", "Trade fair card Deutsche Messe AG, Hannover", "Systemform GmbH", "Systemform", "Systemform",
+    "0x4802", "Scheidt & Bachmann basis dutes", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x4803", "Scheidt & Bachmann basis dutes", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x4804", "Scheidt & Bachmann basis dutes", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x4805", "Access control & security time management", "Gelma", "Gelma Industrieelektronik GmbH", "",
+    "0x4806", "", "Systemform GmbH", "Systemform", "Systemform",
+    "0x4807", "Zutritt, Zeit- u. Betriebsdatenerfassung", "Interflex Datensysteme GmbH", "", "Interflex Datensysteme GmbH",
+    "0x4808", "Employer identification card", "VFJ Technology Pty Ltd", "VFJ Electronics Pty Ltd.", "VFJ Electronics PTy Ltd.",
+    "0x4809", "City Transport (Metro ticketing, bus ticket)", "VFJ Technology Pty Ltd", "VFJ Electronic Pty Ltd.", "Cubic - VFJ",
+    "0x480A", "Access control & security", "Ing. B\xc3\xbcro Schrick", "B\xc3\xbcro Schrick", "B\xc3\xbcro Schrick",
+    "0x480B", "Michronos Time Attendance System", "MICOS GmbH", "Micos GmbH", "Micos GmbH",
+    "0x480C", "Access control system", "MICOS GmbH", "Micos", "Micos",
+    "0x480D", "Access Controll, Security Electronic Purse, Ski-Ticketing, Ticketing", "*Siemens ANL", "", "Siemens AG",
+    "0x480E", "Card Administration, cardholder administration, access control & security, company services, miscellaneous applications", "Ministry of Defense", "Ministry of Defence", "",
+    "0x480F", "Academic Services, Electronic Purse, Access control & security", "CNA Limited/Rax-Comm Systems Ltd.", "CNA Limited", "CNA Limited",
+    "0x4810", "Time attandence, access control + security, electronic purse, plant data collection", "LNI Ingenieurgesellschaft f\xc3\xbcr Kommunikationstechnik mbH", "LNI GmbH", "LNI GmbH",
+    "0x4811", "Security and Access Control", "PEC (New Zealand) Ltd.", "Cardax / Gallagher", "",
+    "0x4812", "Security and Access Control", "PEC (New Zealand) Ltd.", "Cardax / Gallagher", "",
+    "0x4813", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4814", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4815", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4816", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4817", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4818", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x4819", "University & Staff identification", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "",
+    "0x481A", "", "Reserved for MAD", "", "",
+    "0x481B", "Access control/security", "VFJ Technology Pty Ltd", "Taiwan Microcode Co Ltd.", "Taiwan Microcode Co Ltd.",
+    "0x481C", "Access control/security", "VFJ Technology Pty Ltd", "Taiwan Microcode Co Ltd.", "Taiwan Microcode Co Ltd.",
+    "0x481D", "DEM Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, Betribsdatenerfassung, Kantine, Automaten, Tankdatenerf.", "Phg Peter Hengstler GmbH", "", "",
+    "0x481E", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x481F", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x4820", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x4821", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x4822", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x4823", "Access control, time management, high security, time attendence", "Winkhaus Intras Datensysteme GmbH", "Winkhaus Intras Datensysteme GmbH", "Winkhaus Intras Datensysteme GmbH",
+    "0x4824", "Access control system, time & attendance system", "Custom Micro Products Ltd.", "Custom Micro Products Ltd", "Custom Micro Products Ltd",
+    "0x4825", "Acess Control", "CYNAPS", "Cynaps", "",
+    "0x4826", "Access control and time managemnet", "Primion Technology GmbH", "BEL Computer Systems GmbH", "BEL Computer Systems GmbH",
+    "0x4827", "Access control and time managemnet", "Primion Technology GmbH", "BEL Computer Systems GmbH", "BEL Computer Systems GmbH",
+    "0x4828", "Access control and time managemnet", "Primion Technology GmbH", "BEL Computer Systems GmbH", "BEL Computer Systems GmbH",
+    "0x4829", "Access control and time managemnet", "Primion Technology GmbH", "BEL Computer Systems GmbH", "BEL Computer Systems GmbH",
+    "0x482A", "Access Control, Time and Attendance, Paid parking, cards and tags", "Integrated Engineering", "Intesraten Engineering, IE Keyprocessor", "IE Keyprocessor",
+    "0x482B", "Access Control", "Deister Electronic", "Deister Electronic GmbH", "Deister Electronic GmbH",
+    "0x482C", "Zutrittskontrolle, Zeiterfassung", "ZHS Zeitmanagementsysteme GmbH", "", "ZHS",
+    "0x482D", "Various", "BALTECH AG", "PCS GmbH", "PCS GmbH, Baltech AG",
+    "0x482E", "Access Control", "Deister Electronic", "Deister Electronic GmbH", "Deister Electronic GmbH",
+    "0x482F", "Access Control & Time Attendence", "Gelma", "MBB Gelma Industrieelektronik GmbH", "MBB Gelma",
+    "0x4830", "Building Management System", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "VFJ Hong Kong",
+    "0x4831", "Combined application for access control, ferry and rail ticketing for the Island of Langegeoog", "Companion GmbH", "Companion GmbH", "Companion GmbH, Krups Consultants GmbH, Gemplus GmbH",
+    "0x4832", "Access control & Security", "MADA Marx Datentechnik GmbH", "MADA", "MADA",
+    "0x4833", "Access Control, time attendance", "Saubermacher Dienstleistungs GmbH", "AZS Technology AG", "AZS Technology AG",
+    "0x4834", "Access control", "Deister Electronic", "deister electronic GmbH", "deister electronic GmbH",
+    "0x4835", "Access control", "Deister Electronic", "deister electronic GmbH", "deister electronic GmbH",
+    "0x4836", "Access control", "Deister Electronic", "deister electronic GmbH", "deister electronic GmbH",
+    "0x4837", "Access control, time & attendance systems", "Cotag International", "Bewator Cotag Ltd", "Bewator Cotag Ltd",
+    "0x4838", "XSkey providing secure access in Rottermdam harbour", "Secure Logistics", "Secure Logistics", "Secure Logistics",
+    "0x4839", "Access control, time attendance, bus ticket, hotel room card, VIP card f. club", "Giga-TMS Inc", "Giga TMS", "Giga TMS",
+    "0x4840", "Access contr, time & attendance, multifunc card", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x4841", "Access controll", "GRUPO VR", "Grupo VR", "",
+    "0x4842", "Access control & security", "Tyco Integrated Systems B.V.", "Tyco Integrated Systems", "Tyco Integrated Systems",
+    "0x4843", "Access controll & security", "Hi Sec International A/S", "", "Hi Sec International A/S",
+    "0x4844", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x4845", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x4846", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x4847", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x4848", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x4849", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x484A", "Access control, payment system", "Maas Systems B.V.", "Maas Systems B.V.", "Maas Systems B.V.",
+    "0x484B", "Access control & security", "BOSCH Telecom GmbH", "Bosch Telecom", "Bosch Telecom",
+    "0x484C", "Biometric - access controll & security", "BOSCH Telecom GmbH", "Bosch Telecom", "Bosch Telecom",
+    "0x484D", "Access Control", "HID Global", "HID Corporation", "HID Corporation",
+    "0x484E", "Access Control", "HID Global", "HID Corporation", "HID Corporation",
+    "0x484F", "Access control & security", "AIE Etudes", "AIE - ID", "AIE Etudes",
+    "0x4850", "Access control & security", "AIE Etudes", "AIE - ID", "AIE Etudes",
+    "0x4851", "Access control, company service", "Automaten Seitz GmbH", "Automaten Seitz", "Automaten Seitz",
+    "0x4852", "Access control and securitiy", "Hitachi Information Technology Co. Ltd.", "Hitachi Information", "Hitachi Information",
+    "0x4853", "Access control", "Petroleos Mexicanos", "Intraproc de Mexico", "",
+    "0x4854", "Access controll security payment", "Matsushita Communication Industrial", "Matsushita Communication", "Matsushita Communication",
+    "0x4855", "Storing Resident Info Access Control", "ITE Smartcard Solutions Limited", "ITE Smartcard", "ITE Smartcard",
+    "0x4856", "Storing Resident Info Access Control", "ITE Smartcard Solutions Limited", "ITE Smartcard", "ITE Smartcard",
+    "0x4857", "Access control biometric reader", "Precise Biometrics AB", "Precise Biometrics AB", "Precise Biometrics AB",
+    "0x4858", "Contactless Smartcard Access Controll", "BQT Solutions Limited", "Banque-Tec", "Banque-Tec",
+    "0x4859", "Access control", "OASys GmbH", "Oasys GmbH", "Oasys GmbH",
+    "0x486A", "Access control", "OASys GmbH", "Oasys GmbH", "Oasys GmbH",
+    "0x486B", "Access control & security", "Third Millennium Systems Ltd", "Third Millenium", "Third Millenium",
+    "0x486C", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x486D", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x486E", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x486F", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4870", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4871", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4872", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4873", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4874", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4875", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4876", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4877", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4878", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4879", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x487A", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x487B", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x487C", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x487E", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x487F", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4880", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4881", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4882", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4883", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4884", "Access control", "IoLAN", "Iolan BV", "Iolan BV",
+    "0x4885", "Access control & security", "TechID Engineering bv", "TechID", "TechID",
+    "0x4886", "Access control & security", "N.V. Luchthaven", "N.V. Luchthaven Schiphol", "",
+    "0x4887", "Access control & security", "N.V. Luchthaven", "N.V. Luchthaven Schiphol", "",
+    "0x4888", "Access control & security", "N.V. Luchthaven", "N.V. Luchthaven Schiphol", "",
+    "0x4889", "Multi functional badge, private application", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0x489A", "Fingerprint infos compared to user's fingerprint for authentication", "Biocentric Solutions Inc.", "Biocentric Solutions Inc.", "Biocentric Solutions Inc.",
+    "0x489B", "Access control application", "Lenel Systems International", "Lenel Systems International Inc.", "Lenel Systems International Inc.",
+    "0x489C", "Access control application", "Lenel Systems International", "Lenel Systems International Inc.", "Lenel Systems International Inc.",
+    "0x489D", "Access control", "Interlogix B.V.", "Ge Interlogix", "Ge Interlogix",
+    "0x489E", "Biometrial and specific access control data storage", "Tecisa74", "Tecisa74", "Tecisa74",
+    "0x489F", "Biometrial and specific access control data storage", "Tecisa74", "Tecisa74", "Tecisa74",
+    "0x48A0", "Biometrial and specific access control data storage", "Tecisa74", "Tecisa74", "Tecisa74",
+    "0x48A1", "Card Holder Data/Card Management Data/Access Control & Security", "House of Representatives of States General", "House of Representatives of States General", "Paul Sas",
+    "0x48A2", "Book and pay system, Access control", "ADC Systems AB", "ADC Systems", "ADC Systems",
+    "0x48A3", "Access contr, time & attendance, multifunc card", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x48A4", "Multiapplication car for industry & trafic, parking, swimming pool", "ASEC S.A.", "ASEC S.A", "ASEC S.A",
+    "0x48A5", "Access control", "Miditec Datensysteme GmbH", "Miditec", "Miditec",
+    "0x48A6", "Acess control", "Miditec Datensysteme GmbH", "Miditec", "Miditec",
+    "0x48A7", "Access control, time & attendence, job control", "Captor N.V.", "Captor NV", "Captor NV",
+    "0x48A8", "Access contr, time & attendance, multifunc card", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x48A9", "Access control & security", "DATASEC Electronic GmbH", "Datasec Electronic", "Datasec Electronic",
+    "0x48AA", "Miscellaneous application, city traffic, access controll & security entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0x48AB", "Access control", "Electronic Application Laboratory", "EAL", "EAL",
+    "0x48AC", "Access control, time management, electronic wallet", "Universitaire Ziekenhuizen Leuven", "", "GET NV",
+    "0x48AD", "Access control, Time and hendance", "Kaba Benzing GmbH", "Kaba Benzing", "Kaba Benzing",
+    "0x48AE", "Attendance-time rading, access control", "PDTS Gesellschaft f\xc3\xbcr industrielle Datenverarbeitung Ges.mbH", "PDTS", "PDTS",
+    "0x48AF", "Access control, Time and attendance", "Vicking Electronics", "Vicking Electronics", "Vicking Electronics",
+    "0x48B0", "", "Gemplus Nv", "ING Bank", "",
+    "0x48B1", "Belgium", "Gemplus Nv", "ING Bank", "",
+    "0x48B2", "Belgium", "Gemplus Nv", "ING Bank", "",
+    "0x48B3", "Access Control", "IDESCO OY", "Idesco Oy", "Idesco Oy",
+    "0x48B4", "Access contr, time & attendance, multifunc card", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x48B5", "Access contr, time & attendance, multifunc card", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0x48CF", "Storage of identification data", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D0", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D1", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D2", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D3", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D4", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D5", "Storage of biometric data f. access contr. purposes", "SDS - Security Data Systems", "SDS", "SDS",
+    "0x48D6", "Access control & security", "Hi Sec International A/S", "HI SEC International", "HI SEC International",
+    "0x48D7", "Identification for access control", "Quality Equipment Benelux B.V.", "Quality Equipment", "Quality Equipment",
+    "0x48D8", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48D9", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DA", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DB", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DC", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DD", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DE", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48DF", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E0", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E1", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E2", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E3", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E4", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E5", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E6", "Physical access conrtol, biometrics, point of sale", "Procter and Gamble Company", "Procter and Gamble Company", "Procter and Gamble Company",
+    "0x48E7", "Finger Print Application", "Rexroth the identity company GmbH", "Rexroth", "Rexroth",
+    "0x48E8", "Finger Print Application", "Rexroth the identity company GmbH", "Rexroth", "Rexroth",
+    "0x48E9", "Access control and identification", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x48EA", "Access control and identification", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x48EB", "Access control and identification", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x48EC", "Access control and identification", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x48ED", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0x48EE", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0x48EF", "Access Control", "Salto Systems", "Salto Systems", "Salto Systems",
+    "0x48F0", "Electronic locks", "IR Security & Safety GmbH", "IR Security & Safety", "IR Security & Safety",
+    "0x48F1", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F2", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F3", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F4", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F5", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F6", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F7", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F8", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48F9", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48FA", "Access Control & Security", "CDV International", "CDV", "CDV",
+    "0x48FB", "Access control, card contains, biometric data", "Spica International", "Spica", "Spica",
+    "0x48FC", "Access control & scecurity", "Adasoft AG", "Adasoft AG", "Adasoft AG",
+    "0x48FD", "Access control & scecurity", "Adasoft AG", "Adasoft AG", "Adasoft AG",
+    "0x48FE", "Access control & scecurity", "Adasoft AG", "Adasoft AG", "Adasoft AG",
+    "0x48FF", "Access control & scecurity", "Adasoft AG", "Adasoft AG", "Adasoft AG",
+    "0x4902", "VIGIK", "Immotec Systemes", "Immotec", "Immotec",
+    "0x4903", "VIGIK", "Immotec Systemes", "Immotec", "Immotec",
+    "0x4904", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4905", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4906", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4907", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4908", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4909", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490A", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490B", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490C", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490D", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490E", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x490F", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4910", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4911", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4912", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4913", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4914", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4915", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4916", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4917", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4918", "(access control and security) VIGIK", "CDV International", "CDVI", "CDVI",
+    "0x4980", "(access control and security) VIGIK", "NORALSY", "NORALSY", "NORALSY",
+    "0x4A01", "Card Administration, cardholder administration, access control & security, company services, miscellaneous applications", "Ministry of Defense", "Ministry of Defence", "",
+    "0x4A02", "Card Administration, cardholder administration, access control & security, company services, miscellaneous applications", "Ministry of Defense", "Ministry of Defence", "",
+    "0x4C01", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C02", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C03", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C04", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C05", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C06", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C07", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C08", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C09", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0A", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0B", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0C", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0D", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0E", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C0F", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C10", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C11", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C12", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C13", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C14", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C15", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C16", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C17", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C18", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C19", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1A", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1B", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1C", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1D", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1E", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C1F", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C20", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C21", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C22", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C23", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C24", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C25", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C26", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C27", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x4C28", "Physical Access Control Systems (PACS) of the major European Union Institues", "European Commission", "Various", "Various",
+    "0x5001", "Ski ticketing", "ADI Ltd.", "BO RROC Sigulda", "ADI Ltd.",
+    "0x5002", "Ski ticketing, member card, ski association, discounts", "Cetrta Pot d.o.o.", "Slovenian Ski Association", "Cetrta Pot",
+    "0x5003", "Ski ticketing system based on electronic purse", "ADI Ltd.", "Ramkalni Ltd", "ADI Ltd",
+    "0x5004", "Ski ticketing", "ADI Ltd.", "K-Kalins Ltd.", "ADI Ltd",
+    "0x5005", "Entertainment and Sports, Stadiums, Parking, Ski Ticketing", "Axess AG", "Axess", "Axess",
+    "0x5006", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0x5007", "Ski ticketing", "ADI Ltd", "FROKS Ltd", "ADI",
+    "0x5008", "Ski ticketing", "ADI Ltd", "Kalnzaki", "ADI",
+    "0x5009", "Local Ski Ticketing Sysem based on electronic purse", "ADI Ltd", "Mezezers Ltd.", "ADI Ltd.",
+    "0x5101", "Access Control", "NEDAP NV", "Nedap Ideas", "Nedap Ideas",
+    "0x5102", "Access Control & Security", "NOVO GmbH", "1. FC K\xc3\xb6ln GmbH&Co KG", "",
+    "0x5103", "Access control and security", "GPS Tecnologia Ltda.", "GPS Tec", "GPS Tec",
+    "0x5104", "Access control and security", "GPS Tecnologia Ltda.", "GPS Tec", "GPS Tec",
+    "0x5105", "Access control", "Custom Micro Products Ltd.", "Custom Micro Products", "Custom Micro Products",
+    "0x5106", "Biometric Access Control", "CYNAPS", "Cynaps", "Cynaps",
+    "0x5107", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5108", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5109", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510A", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510B", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510C", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510D", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510E", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x510F", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5110", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5111", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5112", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5113", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5114", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5115", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5116", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5117", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5118", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5119", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511A", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511B", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511C", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511D", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511E", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x511F", "Access control and security", "Alfapass", "Alfapass", "Alfapass",
+    "0x5120", "Access control", "Tyco Software House", "Tyco Software House", "Tyco Software House",
+    "0x5121", "Access control", "Connex Solutions Limited", "Connex", "Connex",
+    "0x5122", "Acess Control, Time and Attendance", "Milenio 3 Systemas Electonicos", "Milenio3", "Milenio3",
+    "0x5123", "Access control & security", "CORESTREET", "Corestreet", "Corestreet",
+    "0x5124", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x5125", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x5126", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x5127", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x5128", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x5129", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x512A", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x512B", "Access control & security", "Honeywell", "Honeywell", "Honeywell",
+    "0x512C", "Biometrics strong authentication", "LabCal", "Labcal", "Labcal",
+    "0x512D", "Access control & security", "GOB Software&System GmbH Co. KG", "GOB", "GOB",
+    "0x512E", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x512F", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5130", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5131", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5132", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5133", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5134", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5135", "Access control & security", "Suprema Inc", "Suprema", "Suprema",
+    "0x5136", "Compelete system for lockers, access control & electr. payment", "Ojmar S. A.", "", "Enkoa System S.L.",
+    "0x5137", "Access control", "Honeywell Building Solutions", "Honeywell", "Honeywell",
+    "0x5138", "Electronic purse, access control for building automation", "CDE Communication Data Engineering GmbH", "CDE", "CDE",
+    "0x5139", "Electronic purse, access control for building automation", "CDE Communication Data Engineering GmbH", "CDE", "CDE",
+    "0x513A", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x513B", "Access control, card management", "ID-WARE", "ID-WARE b.v.", "",
+    "0x513C", "Access control, card management", "ID-WARE", "ID-WARE b.v.", "",
+    "0x513D", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0x513E", "Access control, computer application, company services", "Volvo Car Corporation", "Volvo Car", "Volvo Car",
+    "0x513F", "Access contr, time and attendance", "Nisus nv", "Nisus NV", "NIsus NV",
+    "0x5140", "Time & attendance", "Flora Holland", "Interflex Datasystems", "Interflex Datasystems",
+    "0x5141", "Elec ticketing, access control, electronic purse", "Empresa 1 Sistemas de Automacao e Comercio", "Empresa 1", "Empresa 1",
+    "0x5142", "Biometric Terminal", "Recognition Systems LLC", "Recognition Systems", "",
+    "0x5143", "Access control & security", "Evotech B.V.", "Evotech B.V., GTI NV", "Evotech B.V.",
+    "0x5144", "Time attendnace, fuel, access control", "Emcard a.s.", "Emtest", "Emtest",
+    "0x5145", "Access control and security", "Scotcomms Technology Group Ltd.", "Various", "Scotcomms Technology Group Ltd.",
+    "0x5146", "Debit Card, Door Acces Control, Computer Identification", "Netcard", "Netcard", "Netcard",
+    "0x5148", "MES Manufactoring Execution System", "gbo datacomp GmbH", "Gbo datacomp GmbH", "gbo datacomp GmbH",
+    "0x5149", "MES Manufactoring Execution System", "gbo datacomp GmbH", "Gbo datacomp GmbH", "gbo datacomp GmbH",
+    "0x514A", "Access control & security", "Farpointe Data Inc", "Farpointe", "",
+    "0x514B", "Fingerprint Recognition Application", "ESCO Biometric BVBA", "ESCO Biometric", "ESCO Biometric",
+    "0x514C", "Access Control", "Interflex Datensysteme GmbH", "", "Interflex Datensysteme GmbH & CoKG",
+    "0x514D", "Access Control", "Interflex Datensysteme GmbH", "", "Interflex Datensysteme GmbH & CoKG",
+    "0x514E", "Access Control", "Interflex Datensysteme GmbH", "", "Interflex Datensysteme GmbH & CoKG",
+    "0x514F", "Access Control", "Interflex Datensysteme GmbH", "", "Interflex Datensysteme GmbH & CoKG",
+    "0x5150", "Fidelity Card", "Sogedex", "Sogedex", "Sogedex",
+    "0x5151", "Fidelity Card", "Sogedex", "Sogedex", "Sogedex",
+    "0x5152", "Identification and authentication system", "Sogedex", "Sogedex", "Sogedex",
+    "0x5153", "Identification and authentication system", "Sogedex", "Sogedex", "Sogedex",
+    "0x5154", "Access Control, Time Attendance, Job Costing, Ticketing", "Hectrix Limited", "Hectrix Ltd.", "Hectrix. Ltd.",
+    "0x5155", "Access Control, Time Attendance, Job Costing, Ticketing", "Hectrix Limited", "Hectrix Ltd.", "Hectrix. Ltd.",
+    "0x5156", "Access control & security", "Roger Dariusz Wensker", "Roger", "Roger",
+    "0x5157", "Access control & security", "Roger Dariusz Wensker", "Roger", "Roger",
+    "0x5158", "Access control & security", "Roger Dariusz Wensker", "Roger", "Roger",
+    "0x5159", "Access control & security", "Roger Dariusz Wensker", "Roger", "Roger",
+    "0x515A", "Access & parking control, electronic purse", "General Meters Corp", "General Meters", "General Meters",
+    "0x515B", "Car parking, sport applic, hotel, access control systems", "DATASEC Electronic GmbH", "Datasec", "Datatsec",
+    "0x515C", "Car parking, sport applic, hotel, access control systems", "DATASEC Electronic GmbH", "Datasec", "Datatsec",
+    "0x515D", "Access & Inventory conrtol", "Shockfish SA", "Shockfish", "Shockfish",
+    "0x515E", "Access & Inventory conrtol", "Shockfish SA", "Shockfish", "Shockfish",
+    "0x515F", "Access & Inventory conrtol", "Shockfish SA", "Shockfish", "Shockfish",
+    "0x5160", "Access & Inventory conrtol", "Shockfish SA", "Shockfish", "Shockfish",
+    "0x5161", "Access control", "EAL Apeldoorn B.V.", "EAL", "EAL",
+    "0x5162", "Access Control, E-purse", "Gemalto", "Gemplus", "Gemplus",
+    "0x5163", "Access Control, E-purse", "Gemalto", "Gemplus", "Gemplus",
+    "0x5164", "Ausweiskarte", "Allgemeine Unfallversicherungsanstalt (AUVA)", "AUVA", "AUVA",
+    "0x5165", "Ausweiskarte", "Allgemeine Unfallversicherungsanstalt (AUVA)", "AUVA", "AUVA",
+    "0x5166", "Ausweiskarte", "Allgemeine Unfallversicherungsanstalt (AUVA)", "AUVA", "AUVA",
+    "0x5167", "Access Control & Security", "Nsecure B.V.", "Nsecure", "Nsecure",
+    "0x5168", "Fingerprint application, access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.",
+    "0x5169", "Fingerprint application, access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.",
+    "0x516A", "Fingerprint application, access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.",
+    "0x516B", "Fingerprint application, access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzhen Ideal Microelectronics Co. Ltd.",
+    "0x516C", "Access Control Reader", "Access Control Technology", "ACT", "ACT",
+    "0x516D", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x516E", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x516F", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5170", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5171", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5172", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5173", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5174", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5175", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5176", "Access control", "Cogelec", "Cogelec", "Cogelec",
+    "0x5177", "Uhlmann & Zacher Clex prime, online and offline electronic locking and access control systems", "Uhlmann & Zacher GmbH", "Uhlmann & Zacher GmbH", "",
+    "0x5178", "Hotel, acces control & security", "Talleres De Escoriaza S.A.", "Talleres", "Talleres",
+    "0x5179", "Energy Saving System For Hotels, Access Control", "ENKOA System", "Enkoa System S.L.", "Enkoa System S.L.",
+    "0x517A", "Access conrol function & security", "Tyco Fire & Security", "Tyco", "Tyco",
+    "0x517B", "Logical & Physical access control", "Pin Cash International B.V.", "PinCash", "PinCash",
+    "0x517C", "VIGIK", "Immotec Systemes", "Immotec", "Immotec",
+    "0x517D", "VIGIK", "Immotec Systemes", "Immotec", "Immotec",
+    "0x517E", "VIGIK", "Immotec Systemes", "Immotec", "Immotec",
+    "0x517F", "MIFARE Booster config", "NEDAP NV", "", "",
+    "0x5180", "MIFARE Booster config", "NEDAP NV", "", "",
+    "0x5181", "Access control for centrally managed waste treatment", "Alphatronics", "Alphatronics", "Alphatronics",
+    "0x5182", "Access control and identification", "CEM Systems", "CEM Systems Ltd", "CEM Systems Ltd",
+    "0x5183", "Access control and identification", "CEM Systems", "CEM Systems Ltd", "CEM Systems Ltd",
+    "0x5184", "Access control and identification", "CEM Systems", "CEM Systems Ltd", "CEM Systems Ltd",
+    "0x5185", "Hotel, access contr. & sec", "Vingcard a.s.", "Vingcard", "Vingcard",
+    "0x5186", "Hotel, access contr. & sec", "Vingcard a.s.", "Vingcard", "Vingcard",
+    "0x5187", "Zeiterfassung, Werks- bzw. Geb\xc3\xa4udezutritt", "Voestalpine Informationstechnologie GmbH", "Voestalpine Informationstechnologie GmbH", "Voestalpine Informationstechnologie GmbH",
+    "0x5188", "Admiral Ausweiskarte (ID-Card)", "PDTS Gesellschaft f\xc3\xbcr industrielle Datenverarbeitung Ges.mbH", "Admiral Sportwetten GmbH", "",
+    "0x5189", "Personal ID and Reporting of Attendance", "The Swedish Construction Federation", "Sveriges Byggindustrier", "",
+    "0x518A", "Personal ID and Reporting of Attendance", "The Swedish Construction Federation", "Sveriges Byggindustrier", "",
+    "0x518B", "Personal ID and Reporting of Attendance", "The Swedish Construction Federation", "Sveriges Byggindustrier", "",
+    "0x518C", "Personal ID and Reporting of Attendance", "The Swedish Construction Federation", "Sveriges Byggindustrier", "",
+    "0x518D", "Personal identification & reporting of attendance", "The Swedish Construction Federation", "Swedish Construction Fed", "",
+    "0x518E", "Personal identification & reporting of attendance", "The Swedish Construction Federation", "Swedish Construction Fed", "",
+    "0x518F", "Security", "Telenot Electronic GmbH", "Telenot Electronic GmbH", "",
+    "0x5190", "Access Control & Security", "Kaba-Ilco, Inc.", "Kaba Ilco", "Kaba Ilco",
+    "0x5191", "Access Control & Security", "Blue Systems International", "Blue Products.com", "Blue Systems International",
+    "0x5192", "Access Control & Security", "XceedID Corporation", "Xceed ID Corporation", "Xceed ID Corporation",
+    "0x5193", "Access Control & Security", "XceedID Corporation", "Xceed ID Corporation", "Xceed ID Corporation",
+    "0x5194", "Arcelor", "EM Group", "EMGROUP", "EMGROUP",
+    "0x5195", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x5196", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x5197", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x5198", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x5199", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519A", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519B", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519C", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519D", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519E", "Identification and authentication system", "Sogedex", "SOGEDEX", "SOGEDEX",
+    "0x519F", "Electronic ticketing system", "CDE Communication Data Engineering GmbH", "CDE-Competence Center for embedded solutions", "CDE - Competence Center for embedded solutions",
+    "0x51A0", "Electronic ticketing system", "CDE Communication Data Engineering GmbH", "CDE-Competence Center for embedded solutions", "CDE - Competence Center for embedded solutions",
+    "0x51A1", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A2", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A3", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A4", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A5", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A6", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A7", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A8", "Access control & security", "Shenzhen Ideal Microelectronics Co. Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.", "Shenzen IDEAL Microelectronics Co., Ltd.",
+    "0x51A9", "TIME AND ATTENDANCE, ACCESS CONTROL", "Pyrescom", "PYRESCOM", "PYRESCOM",
+    "0x51AA", "Attendance registration and access control", "Simac QUADCORE", "", "",
+    "0x51AB", "Access services (to all buildings of Belgian regional and federal political assembles) and Time and Attendances Services", "Vlaams Parlement", "", "",
+    "0x51AC", "Physical Access Control", "General Motors", "", "",
+    "0x51AD", "Access Control", "BEKA Elektronik", "BEKA Electronik", "BEKA Electronik",
+    "0x51AE", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51AF", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B0", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B1", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B2", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B3", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B4", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B5", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B6", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B7", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B8", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51B9", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51BA", "Access Control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", "Coor Service Management AB, PAS, Card and Know IT",
+    "0x51BB", "Access control, Time and Attendance", "Bodet S.A.", "Bodet SA", "Bodet SA",
+    "0x51BC", "Access control and security", "STid Electronic Identification", "STid", "STid",
+    "0x51BD", "Access Control- Time stamping", "MCF RF TECH SRL", "MCF RF TECH S.R.L.", "MCF RF TECH S.R.L.",
+    "0x51BE", "ID-cards for logistic company", "PNL - Pan Nordic Logistics", "Combiport AB", "DAS Card AB",
+    "0x51BF", "ID-cards for logistic company", "PNL - Pan Nordic Logistics", "Combiport AB", "DAS Card AB",
+    "0x51C0", "Access Control; biometric Identification", "SYTEL", "SYTEL", "SYTEL",
+    "0x51C1", "Access Control; biometric Identification", "SYTEL", "SYTEL", "SYTEL",
+    "0x51C2", "Access Control; biometric Identification", "SYTEL", "SYTEL", "SYTEL",
+    "0x51C3", "Access control and security application - physical security", "INID BV", "INID", "INID",
+    "0x51C4", "Access control Telectronic locks", "Deister electronic GmbH", "Deister electronic GmbH", "Deister electronic GmbH",
+    "0x51C5", "Access control Telectronic locks", "Deister electronic GmbH", "Deister electronic GmbH", "Deister electronic GmbH",
+    "0x51C6", "Access control", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH",
+    "0x51C7", "Access control", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH",
+    "0x51C8", "Access control", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH",
+    "0x51C9", "Access control", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH",
+    "0x51CA", "Access control", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH", "INSYS MICROELECTRONICS GmbH",
+    "0x51CB", "Access control, security and monitoring", "Atelei Engineering SLU", "Atelei Engineering", "Atelei Engineering",
+    "0x51CD", "Access control", "LEAF Identity", "", "",
+    "0x5202", "Access & biometrics application", "Manufacture Francaise des Pneumatiques MICHELIN", "MICHELIN", "",
+    "0x5203", "Access & biometrics application", "Manufacture Francaise des Pneumatiques MICHELIN", "MICHELIN", "",
+    "0x5204", "Access & biometrics application", "Manufacture Francaise des Pneumatiques MICHELIN", "MICHELIN", "",
+    "0x5205", "Access & biometrics application", "Manufacture Francaise des Pneumatiques MICHELIN", "MICHELIN", "",
+    "0x5206", "Access & biometrics application", "Manufacture Francaise des Pneumatiques MICHELIN", "MICHELIN", "",
+    "0x5207", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x5208", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x5209", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520A", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520B", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520C", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520D", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520E", "Access Control", "Triple Eye BV", "Triple Eye B.V.", "Triple Eye B.V.",
+    "0x520F", "A ticketing application for transport systems", "VERIFONE ITALIA SRL", "VeriFone Italia", "VeriFone Italia",
+    "0x5210", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5211", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5212", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5213", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5214", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5215", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5216", "Access control", "KABA", "Kaba AG", "Kaba AG",
+    "0x5217", "Access control & security", "Keyprocessor B.V.", "Keyprocessor", "",
+    "0x5218", "Access control & Security for Ericsson world wide", "Coor Service Management AB", "Telefonaktiebolaget LM Ericsson", " Coor Service Management AB, PAS CARD and Know IT",
+    "0x5229", "Access control", "MBB Gelma GmbH", "MBB Gelma GmbH", "MBB Gelma",
+    "0x522A", "Access control", "MBB Gelma GmbH", "MBB Gelma GmbH", "MBB Gelma",
+    "0x522B", "Access Control, Time & Attendance", "GRUPO SPEC", "GRUPO SPEC", "GRUPO SPEC",
+    "0x522D", "Access Control & Security", "AB Angpannef\xc3\xb6reningen", "AB Angpannef\xc3\xb6reningen", "AB Angpannef\xc3\xb6reningen",
+    "0x522E", "Access control & security", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH", "Scheidt & Bachmann GmbH",
+    "0x522F", "Access control", "AMS ENGINEERING Sticht GmbH", "AMS-Engineering", "AMS-Engineering",
+    "0x5230", "Access control", "AMS ENGINEERING Sticht GmbH", "AMS-Engineering", "AMS-Engineering",
+    "0x5231", "Security and Access Control", "Integrated Control Technology Limited (ICT)", "Integrated Control Technology Limited (ICT)", "Integrated Control Technology Limited (ICT)",
+    "0x5232", "Centralized access control system", "National Control Systems S.A.", "National Control Systems S.A.", "National Control Systems S.A.",
+    "0x5233", "Access control for Pas Card AB and our customers", "PAS Card AB", "Pas Card AB", "Pas Card AB",
+    "0x5234", "Access control for Pas Card AB and our customers", "PAS Card AB", "Pas Card AB", "Pas Card AB",
+    "0x5235", "Access control for Pas Card AB and our customers", "PAS Card AB", "Pas Card AB", "Pas Card AB",
+    "0x5236", "Access control for Pas Card AB and our customers", "PAS Card AB", "Pas Card AB", "Pas Card AB",
+    "0x5237", "Access control for Pas Card AB and our customers", "PAS Card AB", "Pas Card AB", "Pas Card AB",
+    "0x5238", "Access services (to all buildings of Belgian and federal political assemblees) and time and attendance services", "Vlaams Parlement", "", "None",
+    "0x5239", "Access Control & Security Fabricom (GDF SUEZ)", "Fabricom (GDF SUEZ)", "Fabricom (GDF SUEZ)/Belgian Operations/Communication & Security/Security", "Fabricom (GDF SUEZ)/Belgian Operations/Communication & Security/Security",
+    "0x523A", "Access Control & Security Fabricom (GDF SUEZ)", "Fabricom (GDF SUEZ)", "Fabricom (GDF SUEZ)/Belgian Operations/Communication & Security/Security", "Fabricom (GDF SUEZ)/Belgian Operations/Communication & Security/Security",
+    "0x523B", "Access control and security", "ESTIS", "ESTIS", "ESTIS",
+    "0x523C", "Key diversification container", "KABA", "Kaba AG", "Kaba AG",
+    "0x523D", "Key diversification container", "KABA", "Kaba AG", "Kaba AG",
+    "0x523D", "Access control, security and monitoring", "Atelei Engineering SLU", "Atelei Engineering", "Atelei Engineering",
+    "0x5306", "", "Bombardier Transportation", "", "",
+    "0x5307", "Access control & security", "BTICINO s.p.a.", "BTICINO", "BTICINO",
+    "0x5308", "Access control & security", "BTICINO s.p.a.", "BTICINO", "BTICINO",
+    "0x5309", "Access control & security", "BTICINO s.p.a.", "BTICINO", "BTICINO",
+    "0x530A", "Access control & security", "BTICINO s.p.a.", "BTICINO", "BTICINO",
+    "0x530B", "Access control & security", "BTICINO s.p.a.", "BTICINO", "BTICINO",
+    "0x530C", "Access Control & Security", "BSB Electronics Ltd.", "BSB Electronics Ltd.", "BSB Electronics Ltd.",
+    "0x530D", "Access control security for Uppsala University", "Uppsala University", "Uppsala University", "Uppsala University",
+    "0x530E", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x530F", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5310", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5311", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5312", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5313", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5314", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5315", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5316", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5317", "Corporate Access Control application", "NXP Semiconductors Eindhoven", "", "",
+    "0x5318", "Access Control", "EAL Apeldoorn B.V.", "EAL (Apeldoorn) BV", "EAL (Apeldoorn) BV",
+    "0x5319", "Access Control reader", "TIL Technologies", "TIL Technologies", "TIL Technologies",
+    "0x531A", "Access Control reader", "TIL Technologies", "TIL Technologies", "TIL Technologies",
+    "0x531B", "Access control", "BECKMANN GmbH", "BECKMANN GmbH", "BECKMANN GmbH",
+    "0x531C", "Access Control using DESFire EV1", "SIEMENS BT FSP SP PLAC", "", "",
+    "0x531D", "", "DE NEDERLANDSCHE BANK", "AET Europe", "EAL NL",
+    "0x531E", "", "DE NEDERLANDSCHE BANK", "AET Europe", "EAL NL",
+    "0x531F", "Standalone Access Control", "Kimaldi Electronics s.l.", "", "KIMALDI Electronics",
+    "0x5320", "Access control & security system", "Haguess s.r.o.", "Haguess", "Haguess",
+    "0x5321", "Centralized access control system", "National Control Systems S.A", "National Control Systems S.A", "National Control Systems S.A",
+    "0x5322", "Centralized access control system", "National Control Systems S.A", "National Control Systems S.A", "National Control Systems S.A",
+    "0x5323", "Access/security", "ANTWERP WORLD DIAMOND CENTRE", "ANTWERP WORLD DIAMOND CENTRE", "Deister + Card Solutions Group",
+    "0x5324", "Acccess Control & security, Resource Acceptability and personnel identity verification", "Salamander Technologies, Inc.", "N/a", "n/a",
+    "0x5325", "High performance physical Access Control (reacting and writing on ccard in real time)", "Qontinuum Plus", "the users themselves", "Qontinuum Plus",
+    "0x5327", "Physical access control system", "Kaba-Ilco, Inc.", "KABA ILCO INC", "KABA ILCO INC",
+    "0x5328", "Physical access control system", "Kaba-Ilco, Inc.", "KABA ILCO INC", "KABA ILCO INC",
+    "0x5329", "Physical access control system", "Kaba-Ilco, Inc.", "KABA ILCO INC", "KABA ILCO INC",
+    "0x532A", "Physical access control system", "Kaba-Ilco, Inc.", "KABA ILCO INC", "KABA ILCO INC",
+    "0x532B", "Access Control, Biometrics, Time & attendance, network on card", "XceedID Corporation", "Ingersoll Rand", "Ingersoll Rand, Geoffrey Industries, Schlage, Recognition Systems",
+    "0x532C", "Access Control, Biometrics, Time & attendance, network on card", "XceedID Corporation", "Ingersoll Rand", "Ingersoll Rand, Geoffrey Industries, Schlage, Recognition Systems",
+    "0x532D", "Access Control, Biometrics, Time & attendance, network on card", "XceedID Corporation", "Ingersoll Rand", "Ingersoll Rand, Geoffrey Industries, Schlage, Recognition Systems",
+    "0x532E", "Access control & security", "Gantner Electronic GmbH", "GANTNER Electronic", "GANTNER Electronic",
+    "0x532F", "Standard physical access", "NXP Semiconductors Columbia PA", "", "",
+    "0x5330", "Access Control & Electronic security", "Gunnebo Electronic Security", "Competence Center", "GUNNEBO GES",
+    "0x5331", "Access Control & Electronic security", "Gunnebo Electronic Security", "Competence Center", "GUNNEBO GES",
+    "0x5332", "Access Control & Electronic security", "Gunnebo Electronic Security", "Competence Center", "GUNNEBO GES",
+    "0x5333", "Access Control ID", "EM Group", "EM GROUP", "EM GROUP",
+    "0x5334", "Access Control", "DOM Sicherheitstechnik GmbH & Co. KG", "DOM Sicherheitstechnik GmbH & Co.KG", "DOM Sicherheitstechnik GmbH & Co.KG",
+    "0x5335", "Access Control", "DOM Sicherheitstechnik GmbH & Co. KG", "DOM Sicherheitstechnik GmbH & Co.KG", "DOM Sicherheitstechnik GmbH & Co.KG",
+    "0x5336", "Access Control", "DOM Sicherheitstechnik GmbH & Co. KG", "DOM Sicherheitstechnik GmbH & Co.KG", "DOM Sicherheitstechnik GmbH & Co.KG",
+    "0x5337", "Access Control", "DOM Sicherheitstechnik GmbH & Co. KG", "DOM Sicherheitstechnik GmbH & Co.KG", "DOM Sicherheitstechnik GmbH & Co.KG",
+    "0x5338", "Access Control", "DOM Sicherheitstechnik GmbH & Co. KG", "DOM Sicherheitstechnik GmbH & Co.KG", "DOM Sicherheitstechnik GmbH & Co.KG",
+    "0x5339", "Access Control", "WIGOTEK, Hardware Software Beratung", "WIGOTEK", "WIGOTEK",
+    "0x533A", "Access Control", "WIGOTEK, Hardware Software Beratung", "WIGOTEK", "WIGOTEK",
+    "0x533B", "ZKS, Personalnummer, IDs, Nutzerdaten", "Primion Technology AG", "HDW", "Primion",
+    "0x533C", "ZKS, Personalnummer, IDs, Nutzerdaten", "Primion Technology AG", "HDW", "Primion",
+    "0x533D", "ZKS, Personalnummer, IDs, Nutzerdaten", "Primion Technology AG", "HDW", "Primion",
+    "0x533E", "ZKS, Personalnummer, IDs, Nutzerdaten", "Primion Technology AG", "HDW", "Primion",
+    "0x533F", "", "EVVA-Werk Gesellschaft m.b.H. & Co. KG", "", "",
+    "0x5340", "Access control and time attendance systems", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x5341", "Access control and time attendance systems", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x5342", "Access control and time attendance systems", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x5343", "Access control", "TNO ICT", "TNO", "TNO",
+    "0x5344", "Access control", "TNO ICT", "TNO", "TNO",
+    "0x5345", "Access control", "REMSDAQ LIMITED", "", "REMSDAQ Limited",
+    "0x5346", "Access control benefits", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x5347", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x5348", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x5349", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x534A", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x534B", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x534C", "Access control & security", "Coor Service Management AB", "SKANDINAVISKA ENSKILDA BANKEN AB", "Coor Service Management AB",
+    "0x534D", "Access control, user identification, access counter", "Nordic Alarm AB", "Nordic Alarm AB", "Nordic Alarm AB",
+    "0x534E", "Access control, user identification, access counter", "Nordic Alarm AB", "Nordic Alarm AB", "Nordic Alarm AB",
+    "0x534F", "Access control security", "Mobotix AG Security Vision Systems", "Mobotix AG Security Vision Systems", "Mobotix AG Security Vision Systems",
+    "0x5350", "Access Control + Security", "PKE Electronics AG", "PKE Electronics AG", "PKE Electronics AG",
+    "0x5351", "Access Control + Security", "PKE Electronics AG", "PKE Electronics AG", "PKE Electronics AG",
+    "0x5352", "Access Control + Security", "PKE Electronics AG", "PKE Electronics AG", "PKE Electronics AG",
+    "0x5353", "Corporate ID Card BASF", "Cosmo.id GmbH", "Cosmo.ID", "Cosmo.ID",
+    "0x5354", "Corporate ID Crad Daimler", "Cosmo.id GmbH", "Cosmo.ID", "Cosmo.ID",
+    "0x5355", "Access control; Biometric template storage; Offline access control authorization storage; Cash-on card", "Siemens Building Technologies - Security Solutions - International Headquarters", "Siemens Building Technologies - Security Solutions -worldwide", "Siemens Building Technologies - Security Solutions -worldwide",
+    "0x5356", "Access control; Biometric template storage; Offline access control authorization storage; Cash-on card", "Siemens Building Technologies - Security Solutions - International Headquarters", "Siemens Building Technologies - Security Solutions -worldwide", "Siemens Building Technologies - Security Solutions -worldwide",
+    "0x5357", "Access control; Biometric template storage; Offline access control authorization storage; Cash-on card", "Siemens Building Technologies - Security Solutions - International Headquarters", "Siemens Building Technologies - Security Solutions -worldwide", "Siemens Building Technologies - Security Solutions -worldwide",
+    "0x5358", "Access control; Biometric template storage; Offline access control authorization storage; Cash-on card", "Siemens Building Technologies - Security Solutions - International Headquarters", "Siemens Building Technologies - Security Solutions -worldwide", "Siemens Building Technologies - Security Solutions -worldwide",
+    "0x5359", "Access control, security", "Westec AS", "Westec AS", "Westec",
+    "0x535A", "Access control, security", "Westec AS", "Westec AS", "Westec",
+    "0x535B", "Access control, security", "Westec AS", "Westec AS", "Westec",
+    "0x535C", "Access control, security", "Westec AS", "Westec AS", "Westec",
+    "0x535D", "Access control, security", "Avinor AS", "Avinor AS", "Westec AS",
+    "0x535E", "Access Control", "AMC - Academic Hospital", "EAL (Apeldoorn) B.V.", "EAL (Apeldoorn) B.V.",
+    "0x535F", "Access control & security", "Axel Springer AG", "Axel Springer AG", "Axel Springer AG",
+    "0x5360", "Access control & security", "Axel Springer AG", "Axel Springer AG", "Axel Springer AG",
+    "0x5361", "Access control & security", "Axel Springer AG", "Axel Springer AG", "Axel Springer AG",
+    "0x5362", "Access Control", "Universite de Luxembourg", "EAL (Apeldoorn) B.V.", "EAL (Apeldoorn) B.V.",
+    "0x5363", "Access control, intruder alarm, time & attendance", "Novar GmbH- Honeywell Security", "NOVAR, HONEYWELL", "",
+    "0x5364", "Access Control & Security", "Vattenfall Research & Development AB", "Vattenfall AB", "Coor Service Vattenfall AB",
+    "0x5365", "Access control system", "ISEO/ATG", "ISEO/ATG", "ISEO/ATG",
+    "0x5366", "Access control system", "ISEO/ATG", "ISEO/ATG", "ISEO/ATG",
+    "0x5367", "Access control system", "ISEO/ATG", "ISEO/ATG", "ISEO/ATG",
+    "0x5368", "Access Control, ID Badge, Payment", "Danfoss A/S", "Vitani A/S", "Vitani A/S",
+    "0x5369", "Access control, security and monitoring", "Atelei Engineering SLU", "Atelei Engineering", "Atelei Engineering",
+    "0x536A", "Access Control", "Teratron GmbH", "Teratron GmbH", "Teratron GmbH",
+    "0x536B", "Access Control", "Assa Abloy (Switzerland)", "Assa Abloy (Switzerland)", "Assa Abloy (Switzerland)",
+    "0x5401", "Servicios de Identificacion/Presenncia Corporation; control de Accesos y seguridad", "IZENPE", "IZENPE", "IZENPE",
+    "0x5402", "Servicios de Identificacion/Presenncia Corporation; control de Accesos y seguridad", "IZENPE", "IZENPE", "IZENPE",
+    "0x5403", "Servicios de Identificacion/Presenncia Corporation; control de Accesos y seguridad", "IZENPE", "IZENPE", "IZENPE",
+    "0x5404", "Servicios de Identificacion/Presenncia Corporation; control de Accesos y seguridad", "IZENPE", "IZENPE", "IZENPE",
+    "0x5405", "Corporate ID Card BASF", "Cosmo.id GmbH", "Cosmo.id", "Cosmo.id",
+    "0x5406", "Electrical vehicle charging", "EnBW Energie Baden-W\xc3\xbcrttemberg AG", "EnBW Systeme Infrastruktur Support GmbH", "EnBW Systeme Infrastruktur Support GmbH",
+    "0x5407", "Electronic Access Control Systems EZK", "Franz Schneider Brakel GmbH + Co KG", "", "Franz Schneider Brakel GmbH + Co KG",
+    "0x5408", "Access control & security", "SCM Microsystems Gmbh", "SCM Microsystems Gmbh", "",
+    "0x5409", "Access control and key management system", "ALCEA", "ALCEA", "ALCEA",
+    "0x540A", "Access control and key management system", "ALCEA", "ALCEA", "ALCEA",
+    "0x540B", "Smart City Card \\Schwabencard\"\"", "Cosmo.id GmbH", "Cosmo.id", "Cosmo.id",
+    "0x540C", "Physical access control; Photo; Biometrics data; hourly management; Canteen", "France Telecom SA", "", "",
+    "0x540D", "Physical access control; Photo; Biometrics data; hourly management; Canteen", "France Telecom SA", "", "",
+    "0x540E", "Physical access control; Photo; Biometrics data; hourly management; Canteen", "France Telecom SA", "", "",
+    "0x540F", "Physical access control; Photo; Biometrics data; hourly management; Canteen", "France Telecom SA", "", "",
+    "0x5410", "Physical access control; Photo; Biometrics data; hourly management; Canteen", "France Telecom SA", "", "",
+    "0x5411", "Access control", "Medisch Centrum Alkmaar", "EAL (Apeldoorn) B.V.", "EAL (Apeldoorn) B.V.",
+    "0x5412", "Access control, benefits", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x5413", "Access control", "Synchronic", "R&D Synchronic", "SYNCHRONIC",
+    "0x5414", "Access Control System", "Glutz AG, Swiss Access Systems", "Glutz AG", "Glutz AG",
+    "0x5415", "Access Control System", "Glutz AG, Swiss Access Systems", "Glutz AG", "Glutz AG",
+    "0x5416", "Access control, security, identification and business services", "Amtac Professional Services Ptv Ltd", "Amtac Professional Services Ptv Ltd", "Amtac Professional Services Ptv Ltd",
+    "0x5417", "Access control, security, identification and business services", "Amtac Professional Services Ptv Ltd", "Amtac Professional Services Ptv Ltd", "Amtac Professional Services Ptv Ltd",
+    "0x5418", "Identification services", "EasyCheck GmbH", "Stadt Duisburg", "Stadt Duisburg",
+    "0x5419", "Access Control, ID Badge, Payment & Hotel", "Danish Defence", "Vitani A/S", "Vitani A/S",
+    "0x541A", "Access control, security and monitoring", "Atelei Engineering SLU", "Atelei Engineering", "Atelei Engineering",
+    "0x541B", "Access to datacenter, cass, rows, disable alarm+security system, employee ID-card", "VegaSystems", "VegaSystems", "VegaSystems",
+    "0x5801", "Academic Services, Electronic Purse, Access control & security", "CNA Limited/Rax-Comm Systems Ltd.", "CNA Limited", "CNA Limited",
+    "0x5802", "Universitz Student & Staff Identification", "CNA Limited/Rax-Comm Systems Ltd.", "CNA Limited", "CNA Limited",
+    "0x5803", "Student/stuff ID Card Travel Pass, Library Card, Photocopy Control & Meal Payment", "University of Warwick", "University of Warwick", "University of Warwick",
+    "0x5804", "Student/stuff ID Card Travel Pass, Library Card, Photocopy Control & Meal Payment", "University of Warwick", "University of Warwick", "University of Warwick",
+    "0x5805", "Student/stuff ID Card Travel Pass, Library Card, Photocopy Control & Meal Payment", "University of Warwick", "University of Warwick", "University of Warwick",
+    "0x5806", "Student/stuff ID Card Travel Pass, Library Card, Photocopy Control & Meal Payment", "University of Warwick", "University of Warwick", "University of Warwick",
+    "0x5807", "Student/stuff ID Card Travel Pass, Library Card, Photocopy Control & Meal Payment", "University of Warwick", "University of Warwick", "University of Warwick",
+    "0x5809", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580A", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580B", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580C", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580D", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580E", "Accademic services", "Innolab Private Ltd", "National University of Singapore", "Innolab Private Ltd",
+    "0x580F", "Academic identity cards", "Maximus", "Maximus Inc", "Maximus Inc",
+    "0x5810", "Basic cardholder info", "Cambridge University - Institute for Manufacturing", "Cambridge University", "Cambridge University",
+    "0x5811", "Basic cardholder info", "Cambridge University - Institute for Manufacturing", "Cambridge University", "Cambridge University",
+    "0x5812", "Basic cardholder info", "Cambridge University - Institute for Manufacturing", "Cambridge University", "Cambridge University",
+    "0x5813", "Basic cardholder info", "Cambridge University - Institute for Manufacturing", "Cambridge University", "Cambridge University",
+    "0x5814", "Academic services", "Invest Solutions Limited", "Invest Solutions", "Invest Solutions",
+    "0x5815", "Academic services", "Invest Solutions Limited", "Invest Solutions", "Invest Solutions",
+    "0x5816", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0x5817", "Student, staff ID card", "University of Bolton", "University of Bolton", "University of Bolton",
+    "0x5818", "Student, staff ID card", "University of Bolton", "University of Bolton", "University of Bolton",
+    "0x5819", "Student, staff ID card", "University of Bolton", "University of Bolton", "University of Bolton",
+    "0x581A", "Student, staff ID card", "University of Bolton", "University of Bolton", "University of Bolton",
+    "0x581B", "Railway pass, univers pass, library", "Emcard a.s.", "Emcard", "Emtest",
+    "0x581C", "Railway pass, univers pass, library", "Emcard a.s.", "Emcard", "Emtest",
+    "0x581D", "University Card", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing, Ministry of Science, Technolgoy and Education", "Faculty of EE & Computing",
+    "0x581E", "University Card", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing, Ministry of Science, Technolgoy and Education", "Faculty of EE & Computing",
+    "0x581F", "University Card", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing, Ministry of Science, Technolgoy and Education", "Faculty of EE & Computing",
+    "0x5820", "University Campus Card", "Smartchip S.A.", "Universidad U.P.B.", "Smartchip S.A.",
+    "0x5821", "High school pass", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x5822", "Academic services", "University of Bath", "University Bath", "Royall Security Systems",
+    "0x5823", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5824", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5825", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5826", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5827", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5828", "Student/stuff ID, library ID, access control, purse 1, purse 2, electroral rights indicator", "Universit\xc3\xa4t Ulm", "University of Ulm", "University of Ulm",
+    "0x5829", "University Card (Academic Applications)", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing", "Faculty of EE & Computing",
+    "0x582A", "University Card (Academic Applications)", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing", "Faculty of EE & Computing",
+    "0x582B", "University Card (Academic Applications)", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing", "Faculty of EE & Computing",
+    "0x582C", "University Card (Academic Applications)", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing", "Faculty of EE & Computing",
+    "0x582D", "University Card (Academic Applications)", "Faculty of Electrical Engineering and Computing", "Faculty of EE & Computing", "Faculty of EE & Computing",
+    "0x582E", "Academic services, food", "FH Studienbetriebs GmbH", "FH 00E Studienbetriebs GmbH, HSSE", "FH 00E Studienbetriebs GmbH, HSSE",
+    "0x582F", "Library card", "Technical University Of Szczecin", "techn University Szczecin", "techn University Szczecin",
+    "0x5830", "Student/Staff IC Card", "University of Chester", "University of Chester", "University of Chester",
+    "0x5831", "Student/Staff IC Card", "University of Chester", "University of Chester", "University of Chester",
+    "0x5832", "Student/Staff IC Card", "University of Chester", "University of Chester", "University of Chester",
+    "0x5833", "Student/Staff IC Card", "University of Chester", "University of Chester", "University of Chester",
+    "0x5834", "Student/Staff IC Card", "University of Chester", "University of Chester", "University of Chester",
+    "0x5835", "University Campus Card", "Smartchip S.A.", "Universidad EAFIT", "Smartchip S.A.",
+    "0x5836", "Online Activity Registration and Ticketing (education)", "PinCash International", "Pincash international BV", "Pincash international BV",
+    "0x5837", "University Card, Library Card, Studen/Staff ID, Academic services", "Stockholm University", "Stockholm University", "Stockholm University",
+    "0x5838", "University Card, Library Card, Studen/Staff ID, Academic services", "Stockholm University", "Stockholm University", "Stockholm University",
+    "0x5839", "University Card, Library Card, Studen/Staff ID, Academic services", "Stockholm University", "Stockholm University", "Stockholm University",
+    "0x583A", "University Card, Library Card, Studen/Staff ID, Academic services", "Stockholm University", "Stockholm University", "Stockholm University",
+    "0x583B", "University Campus Card", "Smartchip S.A.", "Colegiatura Colombiana", "SMARTCHIP S.A.",
+    "0x583C", "Student/personnel authentication & identification card", "Hogeschool Gent", "Associatie Universiteit Gent", "Universiteit Gent, Hogeschool Gent, Arteveldeschool, Hogeschool West-Vlaanderen",
+    "0x583D", "Student/personnel authentication & identification card", "Hogeschool Gent", "Associatie Universiteit Gent", "Universiteit Gent, Hogeschool Gent, Arteveldeschool, Hogeschool West-Vlaanderen",
+    "0x583E", "Student/personnel authentication & identification card", "Hogeschool Gent", "Associatie Universiteit Gent", "Universiteit Gent, Hogeschool Gent, Arteveldeschool, Hogeschool West-Vlaanderen",
+    "0x583F", "Student/personnel authentication & identification card", "Hogeschool Gent", "Associatie Universiteit Gent", "Universiteit Gent, Hogeschool Gent, Arteveldeschool, Hogeschool West-Vlaanderen",
+    "0x5840", "Studen/personnel authentication & identification card", "Hogeschool Gent", "Associatie Universiteit Gent", "Associatie Universiteit Gent",
+    "0x5841", "Academic services", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x5842", "Academic services", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x5843", "Academic services", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x5844", "Academic services", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x5845", "Multifunctional IT", "InterCard AG Informationssysteme", "InterCard", "InterCard",
+    "0x5846", "Multifunctional IT", "InterCard AG Informationssysteme", "InterCard", "InterCard",
+    "0x5847", "Multifunctional IT", "InterCard AG Informationssysteme", "InterCard", "InterCard",
+    "0x5848", "Multifunctional IT", "InterCard AG Informationssysteme", "InterCard", "InterCard",
+    "0x5849", "Student and staff identification, access control, attendance monitoring, cashless vending", "Computer Centre, Lancaster University", "Lancaster University", "Lancaster University",
+    "0x584A", "Student and staff identification, access control, attendance monitoring, cashless vending", "Computer Centre, Lancaster University", "Lancaster University", "Lancaster University",
+    "0x584B", "Student and staff identification, access control, attendance monitoring, cashless vending", "Computer Centre, Lancaster University", "Lancaster University", "Lancaster University",
+    "0x584C", "Student and staff identification, access control, attendance monitoring, cashless vending", "Computer Centre, Lancaster University", "Lancaster University", "Lancaster University",
+    "0x584D", "Academic services", "Gantner Electronic GmbH", "GANTNER Electronic", "GANTNER Electronic",
+    "0x584E", "Library card", "Vienna University of Economics", "Vienna University of Economics", "Vienna University of Economics",
+    "0x584F", "University campus card", "Smartchip S.A.", "Universidad de Antioquia - UedA", "Smartchip SA",
+    "0x5850", "Sttuden/personnel access control", "Caja General de Ahorros de Canarias", "Universidad de La laguna-ULL", "CajaCanarias",
+    "0x5851", "Academic services", "Emtest a.s.", "Ministry of Education of Slovak republic", "EMtest-SK, s.r.o.",
+    "0x5852", "Internal identification", "HUB-EHSAL VZW", "HUB", "",
+    "0x5853", "University/Campus applications", "Burall InfoSmart Ltd", "Burall InfoSmart Ltd", "Burall InfoSmart Ltd",
+    "0x5854", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x5855", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x5856", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x5857", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x5858", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x5859", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x585A", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x585B", "University student identification", "Pro Active", "CNOUS", "Pro Active SAS",
+    "0x6001", "Wittenborg Caterchip 2002", "Ing. B\xc3\xbcro Schrick", "Wittenborg Automaten GmbH", "Ing. B\xc3\xbcro Schrick",
+    "0x6002", "Elecronic food voucher", "GRUPO VR", "Grupo VR", "",
+    "0x6003", "Elecronic supermarket voucher", "GRUPO VR", "Gruop VR", "",
+    "0x6004", "Access controll security payment", "Matsushita Communication Industrial", "Matsushita Communication", "Matsushita Communication",
+    "0x6005", "Electronic food voucher", "Smart Net Brasil LTDA", "Smart.net Brasil LTDA", "Smart.net Brasil LTDA",
+    "0x6006", "Electronic food voucher", "Smart Net Brasil LTDA", "Smart.net Brasil LTDA", "Smart.net Brasil LTDA",
+    "0x6007", "Electronic food voucher", "Smart Net Brasil LTDA", "Smart.net Brasil LTDA", "Smart.net Brasil LTDA",
+    "0x6008", "Electronic food voucher", "Smart Net Brasil LTDA", "Smart.net Brasil LTDA", "Smart.net Brasil LTDA",
+    "0x6009", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x600A", "Cshless Payment f. catering/vending", "VMC House", "VMC", "VMC",
+    "0x600B", "Food services", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x600C", "Academic services, food", "FH Studienbetriebs GmbH", "FH 00E Studienbetriebs GmbH, HSSE", "FH 00E Studienbetriebs GmbH, HSSE",
+    "0x600D", "Academic services, food", "FH Studienbetriebs GmbH", "FH 00E Studienbetriebs GmbH, HSSE", "FH 00E Studienbetriebs GmbH, HSSE",
+    "0x600F", "Menue@web", "Hofmann Men\xc3\xbc-Manufaktur GmbH", "Hofmann Men\xc3\xbc-Manufaktur GmbH", "Hofmann Men\xc3\xbc-Manufaktur GmbH",
+    "0x6010", "Food, Payment in restaurant for employees", "AB Angpannef\xc3\xb6reningen", "AB Angpannef\xc3\xb6reningen", "AB Angpannef\xc3\xb6reningen",
+    "0x6011", "Vending", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x6012", "Vending", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x6013", "Vending", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x6014", "Vending", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x6015", "Food Vending and control", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x6016", "Food Vending and control", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x6017", "Food Vending and control", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x6018", "Food Vending and control", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x6801", "Retail identification and customer loyalty", "Unisys New Zealand Ltd", "Unisys", "Unisys",
+    "0x7001", "Access control, time attendance, bus ticket, hotel room card, VIP card f. club", "Giga-TMS Inc", "Giga TMS", "Giga TMS",
+    "0x7002", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x7003", "Car parking, sport applic, hotel, access control systems", "DATASEC Electronic GmbH", "Datasec", "Datatsec",
+    "0x7004", "Hotel, acces control & security", "Talleres De Escoriaza S.A.", "Talleres", "Talleres",
+    "0x7005", "Energy Saving System For Hotels, Access Control", "ENKOA System", "Enkoa System S.L.", "Enkoa System S.L.",
+    "0x7006", "Hotel, access contr. & sec", "Vingcard a.s.", "Vingcard", "Vingcard",
+    "0x7007", "Hotel, access contr. & sec", "Vingcard a.s.", "Vingcard", "Vingcard",
+    "0x7008", "Multi Application Purse - Access-Parking", "MCF RF TECH SRL", "MCF RF TECH S.R.L.", "MCF RF TECH S.R.L.",
+    "0x7009", "Access control data for electronic locks", "Timelox AB", "Timelox AB", "Timelox AB",
+    "0x700A", "Energy Saving System", "ENKOA System", "ENKOA System S.L.", "ENKOA System S.L.",
+    "0x700B", "Energy Saving System", "ENKOA System", "ENKOA System S.L.", "ENKOA System S.L.",
+    "0x700C", "Energy Saving System", "ENKOA System", "ENKOA System S.L.", "ENKOA System S.L.",
+    "0x700D", "Hotel", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH",
+    "0x7502", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7503", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7504", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7505", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7506", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7507", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7508", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7509", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750A", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750B", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750C", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750D", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750E", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x750F", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7510", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7511", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7512", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7513", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7514", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7515", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7516", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7517", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7518", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7519", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751A", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751B", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751C", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751D", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751E", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x751F", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7520", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7521", "Multifunctional id card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7522", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7523", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7524", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7525", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7526", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7527", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7528", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7529", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752A", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752B", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752C", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752D", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752E", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x752F", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7530", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7531", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7532", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7533", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7534", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7535", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7536", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7537", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7538", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7539", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753A", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753B", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753C", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753D", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753E", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x753F", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7540", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7541", "Multifunctional ID Card", "Fraport AG - Frankfurt Airport Services Worldwide", "Fraport AG", "Fraport AG",
+    "0x7801", "Access and tiketting system for car sharing", "Mobility Car Sharing", "Bw-digitronik ag", "bw-digitronik ag",
+    "0x7901", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7902", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7903", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7904", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7905", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7906", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7907", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7908", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7909", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790A", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790B", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790C", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790D", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790E", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x790F", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x7910", "Rijkspas an accescard for Dutch governemental ministries and agencies", "ICTU", "ICTU", "ICTU",
+    "0x8001", "Tollway", "VFJ Technology Pty Ltd", "Austream", "Austream",
+    "0x8002", "Access control system, time & attendance system", "Custom Micro Products Ltd.", "Custom Micro Products Ltd", "Custom Micro Products Ltd",
+    "0x8003", "Busticketing System", "VFJ Technology Pty Ltd", "King Man County Public Traffic", "Barouh Electronic Co.",
+    "0x8004", "Building Management System", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "VFJ Hong Kong",
+    "0x8006", "Security and safety services", "Staat der Nederlanden, Ministerie van Financien Belastingdienst/Centrum voor facilitaire dienstverlening", "Siemens Nederland BV", "Siemens Nederland BV",
+    "0x8007", "Zeiterfassung, Werks- bzw. Geb\xc3\xa4udezutritt", "Voestalpine Informationstechnologie GmbH", "Voestalpine Informationstechnologie GmbH", "Voestalpine Informationstechnologie GmbH",
+    "0x8008", "Access control in sport stadiums and e-purse", "FortressGb", "FORTRESSGB", "FORTRESSGB",
+    "0x8009", "Personal social status information", "Civil Registry Agency of the Ministry of Justice of Georgia", "Civil Registry Agency of the Ministry of Justice of Georgia", "",
+    "0x8801", "Bargeldlose Abrechnungs-Systeme f\xc3\xbcr Casino- u. Gemeinschaftsverpflegung", "EKS GmbH", "", "EKS GmbH",
+    "0x8802", "Tollway system", "VFJ Technology Pty Ltd", "VFJ Technology Pty Ltd", "Chendu Shuguang Optical Fibre Network (Ltd. China)",
+    "0x8803", "Tollway system", "VFJ Technology Pty Ltd", "VFJ Technology Pty Ltd", "Chendu Shuguang Optical Fibre Network (Ltd. China)",
+    "0x8804", "Automatic Fare Collection city and intercity bus traffic electronic purse", "Trgovina in Informatika d.o.o.", "Fourth Way - Alpetour", "Fourth Way",
+    "0x8805", "Employer identification card", "VFJ Technology Pty Ltd", "VFJ Electronics Pty Ltd.", "VFJ Electronics PTy Ltd.",
+    "0x8806", "City Transport (Metro ticketing, bus ticket)", "VFJ Technology Pty Ltd", "VFJ Electronic Pty Ltd.", "Cubic - VFJ",
+    "0x8807", "Time attandence, access control + security, electronic purse, plant data collection", "LNI Ingenieurgesellschaft f\xc3\xbcr Kommunikationstechnik mbH", "LNI GmbH", "LNI GmbH",
+    "0x8808", "Intelligent Estate Management System", "Rax Comm Systems Limited", "Rax Comm Systems Limited", "Rax Comm Systems Limited",
+    "0x8809", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x880A", "Tollway", "VFJ Technology Pty Ltd", "Xiamto Lintong Tollway", "",
+    "0x880B", "Access Controll, Security Electronic Purse, Ski-Ticketing, Ticketing", "*Siemens ANL", "", "Siemens AG",
+    "0x880C", "DEM Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, Betribsdatenerfassung, Kantine, Automaten, Tankdatenerf.", "Phg Peter Hengstler GmbH", "", "",
+    "0x880D", "Electronic Purse for Casino and comon catering", "EKS GmbH", "", "EKS",
+    "0x880E", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x880F", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x8810", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x8811", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x8812", "OEM-Komponenten f\xc3\xbcr Zutrittskontrolle, Zeiterfassung, elektr. Geldb\xc3\xb6rse,...", "Peter Hengstler GmbH + Co KG", "", "",
+    "0x8813", "Tollway", "VFJ Technology Pty Ltd", "Austream", "Austream",
+    "0x8814", "Transport Ticketing, E-Purse, Citycard", "CJS Consultancy Ltd", "", "Transmo Citycard Ltd.",
+    "0x8815", "Academic Services, Electronic Purse, Access control & security", "CNA Limited/Rax-Comm Systems Ltd.", "CNA Limited", "CNA Limited",
+    "0x8816", "Busticketing System", "VFJ Technology Pty Ltd", "King Man County Public Traffic", "Barouh Electronic Co.",
+    "0x8817", "Electronic Purse", "Counter Solutions Ltd.", "Counter Solutions", "Counter Solutions",
+    "0x8818", "Building Management System", "VFJ Technology Pty Ltd", "VFJ Hong Kong", "VFJ Hong Kong",
+    "0x8819", "Weighbridge for trucks", "VFJ Technology Pty Ltd", "Hardware Systems Sales", "",
+    "0x881A", "Access Control, Time & Attendance, E-Purse", "BALTECH AG", "Baltech", "Baltech",
+    "0x881B", "Access control, payment system", "Maas Systems B.V.", "Maas Systems B.V.", "Maas Systems B.V.",
+    "0x881C", "Access controll security payment", "Matsushita Communication Industrial", "Matsushita Communication", "Matsushita Communication",
+    "0x881D", "Electronic Purse", "ITE Smartcard Solutions Limited", "ITE Smartcard", "ITE Smartcard",
+    "0x881E", "Electronic purse", "ADI Ltd.", "Kakitis Ltd", "ADI Ltd",
+    "0x881F", "Contactless e-purse", "Banrisul Processamento de Dados Ltda.", "Banco do Estado do Rio Grande do Sul S/A", "Banco do Estado do Rio Grande do Sul S/A",
+    "0x8820", "Contactless e-purse", "Banrisul Processamento de Dados Ltda.", "Banco do Estado do Rio Grande do Sul S/A", "Banco do Estado do Rio Grande do Sul S/A",
+    "0x8821", "Multi functional badge, private application", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0x8822", "Prepaid Electronic Purse", "Rosan Finance", "Retail Trade & services, Entertainments, Fastfoods, Gazolines etc", "Rosan Finance",
+    "0x8823", "Payment Catering", "Pecusoft Software-Entwicklungsgesellschaft mbH", "Pecusoft GmbH", "Pecusoft GmbH",
+    "0x8825", "Access control, time management, electronic wallet", "Universitaire Ziekenhuizen Leuven", "", "GET NV",
+    "0x8826", "Vending cashless prepaid", "MCF RF TECH SRL", "MCF", "MCF",
+    "0x8827", "Electronic purse", "IPC Systems BV", "IPC", "IPC",
+    "0x8828", "Vending System", "Quality Equipment Benelux B.V.", "Quality Equipment", "Quality Equipment",
+    "0x8829", "Electronic purse", "H\xc3\xb6r GmbH & Co.", "H\xc3\xb6r GmbH", "H\xc3\xb6r GmbH",
+    "0x882A", "Electronic purse", "Tietoenator Energy Components", "Tietoenator", "Tietoenator",
+    "0x882B", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x882C", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x882D", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x882E", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x882F", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8830", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8831", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8832", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8833", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8834", "Electronic purse", "PBV Kaufmann Systeme GmbH", "PBV Kaufmann", "PBV Kaufmann",
+    "0x8835", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0x8836", "Electronic purse, city traffic", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plzenske Mestske", "Plzenske Mestske",
+    "0x8837", "", "TechID Engineering bv", "Tech ID", "Tech ID",
+    "0x8838", "Access control, Time attendanc, job control", "EM Group", "EM Group", "EM Group",
+    "0x8839", "Mass Transportation Ticketing", "Omnifare", "MBS", "MBS",
+    "0x883A", "Electronic purse", "Copie Monnaie France", "Copie Monnaie France", "Copie Monnaie France",
+    "0x883B", "Electronic purse", "Monet+ a.s.", "Monet+", "Monet+",
+    "0x883C", "LUAS - light rail", "Scheidt & Bachmann", "Scheidt & Bachmann", "Scheidt & Bachmann",
+    "0x883D", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x883E", "Railway services, city traffic, electronic purse", "Czech Railways", "Czech Railways", "Czech Railways",
+    "0x883F", "Electronic purse, washing card", "PBV Kaufmann Systeme GmbH", "BICA AG", "BICA AG",
+    "0x8840", "Electronic purse, washing card", "PBV Kaufmann Systeme GmbH", "BICA AG", "BICA AG",
+    "0x8841", "Compelete system for lockers, access control & electr. payment", "Ojmar S. A.", "", "Enkoa System S.L.",
+    "0x8842", "City traffic, electronic purse, micellaneous applications", "Koordinator ODIS s.r.o.", "Koordinator", "PVT",
+    "0x8843", "Electronic purse, access control for building automation", "CDE Communication Data Engineering GmbH", "CDE", "CDE",
+    "0x8844", "Electronic purse, access control for building automation", "CDE Communication Data Engineering GmbH", "CDE", "CDE",
+    "0x8845", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0x8847", "Cashless payment", "Contidata Datensysteme GmbH", "Contidata", "Contidata",
+    "0x8848", "Electronic purse", "ADE S.r.l.", "ADE", "ADE",
+    "0x8849", "Electronic purse", "ADE S.r.l.", "ADE", "ADE",
+    "0x884A", "Electronic purse", "ADE S.r.l.", "ADE", "ADE",
+    "0x884B", "Electronic purse", "ADE S.r.l.", "ADE", "ADE",
+    "0x884C", "Electronic purse", "Vesiel SPA", "Vesiel", "Vesiel",
+    "0x884D", "Electronic purse", "Vesiel SPA", "Vesiel", "Vesiel",
+    "0x884E", "Electronic purse", "Vesiel SPA", "Vesiel", "Vesiel",
+    "0x884F", "Elec ticketing, access control, electronic purse", "Empresa 1 Sistemas de Automacao e Comercio", "Empresa 1", "Empresa 1",
+    "0x8850", "Electronic purse/loyalty", "Premier Retail Services LTD", "Premier Retail", "Premier Retail",
+    "0x8851", "Electronic purse/loyalty", "Premier Retail Services LTD", "Premier Retail", "Premier Retail",
+    "0x8852", "Electronic purse, carparking system, single use ticket, period pass", "Emcard a.s.", "Emcard", "Emtest",
+    "0x8853", "Access & parking control, electronic purse", "General Meters Corp", "General Meters", "General Meters",
+    "0x8854", "Electronic purse", "DOPRAVNI PODNIK mest Mostu a Litvinova, a.s.", "Dopravni Podnik mest Mostu a Litvinova, a.s.", "Mikroelektronika, spol. sr.o., Kpt. Poplera 55, 565 01 Vysok\xc3\xa9 Myto, CZ",
+    "0x8855", "Privateive Payment System", "Aztek", "Aztek", "Aztek",
+    "0x8856", "Car Parking, Electronic Purse", "Haguess s.r.o.", "Haguess, s.r.o.", "Haguess, s.r.o.",
+    "0x8857", "Electronic purse", "Emcard a.s.", "EMCARD, a.s.", "EMTEST, a.s.",
+    "0x8858", "MulitApplicaton Purse", "MCF RF TECH SRL", "MCF Vending", "MCF Vending",
+    "0x8859", "Electr purse f. health services", "QSI", "QSI", "QSI",
+    "0x885A", "Closed elc. purse", "Siemens AG \xc3\x96sterreich", "Siemens", "Siemens",
+    "0x885B", "Copy machine", "BCM Bureautique", "BCM Bureautique", "BCM Bureautique, Mr. Larbi Seridj",
+    "0x885C", "Transit SmartCard System, City E-purse System", "Intelligent Transaction Systems de Mexico S.A. de C.V.", "St. John's Transportation Commission", "Intelligent Transaction Systems de Mexico",
+    "0x885D", "Electronic purse, city traffic, customer profile, service applic, check-in/out applic", "Mikroelektronika spol.s r.o.", "Mikroelektronika", "Mikroelektronika",
+    "0x885E", "Payment, payment OEM, payment partner, entertainment, OEM data", "Payment Solution AG", "Payment Solution AG", "Payment Solution AG",
+    "0x885F", "Payment, payment OEM, payment partner, entertainment, OEM data", "Payment Solution AG", "Payment Solution AG", "Payment Solution AG",
+    "0x8860", "Payment, payment OEM, payment partner, entertainment, OEM data", "Payment Solution AG", "Payment Solution AG", "Payment Solution AG",
+    "0x8861", "E-Purse", "PT Visionet Internasional", "Visionet", "Multipolar",
+    "0x8862", "E-Purse", "PT Visionet Internasional", "Visionet", "Multipolar",
+    "0x8863", "E-Purse", "PT Visionet Internasional", "Visionet", "Multipolar",
+    "0x8864", "Electronic purse", "Mikroelektronika spol.s r.o.", "Siemens Itron Business Services S.A. - Cordoba, Republica Argentina", "Siemens Itron Business Services S.A. - Cordoba, Republica Argentina",
+    "0x8865", "Cashless Payment System", "Infineer", "Infineer", "",
+    "0x8866", "Cashless Payment System", "Infineer", "Infineer", "",
+    "0x8867", "Self service kiosk application (ordering and printing photos)", "CeWe Color AG & Co OHG", "CeWe Color AG & Co OHG", "CeWe Color AG & Co OHG",
+    "0x8868", "Self service kiosk application (ordering and printing photos)", "CeWe Color AG & Co OHG", "CeWe Color AG & Co OHG", "CeWe Color AG & Co OHG",
+    "0x8869", "Multiapplication Purse", "MCF RF TECH SRL", "MCF RF TECH S.R.L.", "MCF RF TECH S.R.L.",
+    "0x886A", "Vending-Cashless_prepaid", "MCF RF TECH SRL", "MCF RF TECH S.R.L.", "MCF RF TECH S.R.L.",
+    "0x886B", "Online Electronic Payment System", "PinCash International", "Pincash international BV", "Pincash international BV",
+    "0x886C", "E-Money Application", "SQuidcard Ltd", "Squidcard Limited", "Applied Card Technologies Ltd",
+    "0x886D", "E-purse", "Asdion Berhad", "Asdion Berhad", "Asdion Berhad",
+    "0x886E", "MIFARE based payment system", "supercard as", "Supercard as", "supercard as",
+    "0x886F", "Electronic purse", "Group Capmonetique", "CARTAX", "MONECARTE",
+    "0x8870", "Electronic purse", "Group Capmonetique", "SEDECO", "MONECARTE",
+    "0x8871", "Electronic purse", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x8872", "Eectronic purse for CROUS", "Group Capmonetique", "MONECARTE", "MONECARTE",
+    "0x8873", "Copier vending Follow-Me Printing", "Xafax Nederland BV", "Xafax Nederland", "Xafax Nederland",
+    "0x8874", "Copier vending Follow-Me Printing", "Xafax Nederland BV", "Xafax Nederland", "Xafax Nederland",
+    "0x8875", "Epurse", "KORID LK, spol. s r.o", "KORID LK, spol.s.r.o.", "KORID LK, spol.s.r.o.",
+    "0x8876", "Electronic purse", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic", "MIKROELEKTRONIKA spol.s.r.o., Draby 849, Vysoke Myto 56601, Czech Republic",
+    "0x8877", "Electronic payment", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x8878", "Electronic payment", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x8879", "Electronic payment", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x887A", "Electronic payment", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh", "Dallmayr Card Systeme Gmbh",
+    "0x887B", "Electronic purse", "Mikroelektronika spol.s r.o.", "ZAGREBACKI Holding d.o.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x887C", "Electronic purse", "Mikroelektronika GmbH", "MIKROELEKTRONIKA spol.s.r.o.", "MIKROELEKTRONIKA spol.s.r.o.",
+    "0x887D", "Electronic purse", "Mikroelektronika spol.s r.o.", "Mikroelektronika spol.s r.o", "Mikroelektronika spol.s r.o",
+    "0x887E", "Electronic Purse", "Electronic and Software Engineering Limited (EASEL)", "EASEL", "EASEL",
+    "0x887F", "Contactless payment", "Chess embedded Technology", "Chess", "Chess",
+    "0x8880", "Electronic purse", "WIGOTEK, Hardware Software Beratung", "WIGOTEK", "WIGOTEK",
+    "0x8881", "Electronic purse", "WIGOTEK, Hardware Software Beratung", "WIGOTEK", "WIGOTEK",
+    "0x8882", "Electronic purse", "ENKOA System", "ENKOA System S.L.", "ENKOA System S.L.",
+    "0x8883", "Electronic payment", "Alcatel-Lucent Bell NV", "", "",
+    "0x8884", "Electronic payment", "Alcatel-Lucent Bell NV", "", "",
+    "0x8885", "Electronic payment", "Alcatel-Lucent Bell NV", "", "",
+    "0x8886", "Vending control systems - point, cash purse", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x8887", "Vending control systems - point, cash purse", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x8888", "Vending control systems - point, cash purse", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0x8889", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888A", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888B", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888C", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888D", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888E", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x888F", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x8890", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x8891", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x8892", "Electronic purse", "Inepro BV", "Inepro BV", "",
+    "0x8893", "Electronic purse for use in proprietary closed system", "Absec Malaysia SDN BHD", "Absec Malaysia SDN BHD", "MLGN Solutions Ltd",
+    "0x8894", "Electronic purse for use in proprietary closed system", "Absec Malaysia SDN BHD", "Absec Malaysia SDN BHD", "MLGN Solutions Ltd",
+    "0x8895", "Electronic purse", "Koordinator ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.", "KOORDINATOR ODIS s.r.o.",
+    "0x8896", "Service application for municipal chip card - customer profile (registration) - validity of card (registration)", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.", "Plze\xc5\x88sk\xc3\xa9 M\xc4\x9bstsk\xc3\xa9 Dopravn\xc3\xad Podniky A.S.",
+    "0x8897", "Electronic purse", "Mikroelektronika spol.s r.o.", "Jamaica Urban Transit Company Ltd", "Mikroelektronika spol.s r.o",
+    "0x8898", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x8899", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x889A", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x889B", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x889C", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x889D", "Open cashfile electronic purse", "Ingenieurb\xc3\xbcro Ludwig - Ib Ludwig", "OCF open Cashfile", "OCF open Cashfile members",
+    "0x889E", "Payment system - electronic purse", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x889F", "Payment system - electronic purse", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x88A0", "Payment system - electronic purse", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x88A1", "Payment system - electronic purse", "N&W Innovative Solutions", "N&W", "N&W",
+    "0x88A2", "Contactless payment", "Rabobank International", "Rabobank", "Rabobank",
+    "0x88A3", "Contactless payment", "Amsterdam Arena", "Amsterdam Arena", "Amsterdam Arena",
+    "0x88A4", "Contactless payment", "Multicard", "MULTICARD", "MULTICARD",
+    "0x88A5", "Electronic purse", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x88A6", "Electronic purse", "ODP-software s.r.o.", "ODP-software", "ODP-software",
+    "0x88A7", "Electronic purse", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH",
+    "0x88AB", "Access control in sport stadiums and e-purse", "FortressGb", "FORTRESSGB", "FORTRESSGB",
+    "0x88AC", "Smart City Card \\Schwabencard\"\"", "Cosmo.id GmbH", "Cosmo.id", "Cosmo.id",
+    "0x88AD", "Electronic purse", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x88AE", "Electronic purse", "OREDO s.r.o", "OREDO s.r.o", "OREDO s.r.o",
+    "0x88AF", "Electronic purse", "\xc3\x9astecky kraj", "", "",
+    "0x88B0", "Electronic purse", "\xc3\x9astecky kraj", "", "",
+    "0x88B1", "Electronic purse", "TELMAX s.r.o.", "TELMAX s.r.o.", "TELMAX s.r.o.",
+    "0x88B2", "Contactless Card for payment operations in Kiosk Payment system", "Sistemas Tecnicos de Cobro S.L.", "Sistemas Tecnicos de Cobro S.L.", "Sistemas Tecnicos de Cobro S.L.",
+    "0x88B3", "Access control, canteen functionality", "Elektroniske Betalings Systemer AS", "Elektroniske Betalings Systemer AS", "Elektroniske Betalings Systemer AS",
+    "0x88B4", "Electronic purse", "HUG-Witschi AG", "HUG-Witschi AG", "HUG-Witschi AG",
+    "0x88B5", "Electronic purse", "HUG-Witschi AG", "HUG-Witschi AG", "HUG-Witschi AG",
+    "0x88B6", "Electronic purse", "HUG-Witschi AG", "HUG-Witschi AG", "HUG-Witschi AG",
+    "0x88B7", "Electronic purse", "HUG-Witschi AG", "HUG-Witschi AG", "HUG-Witschi AG",
+    "0x9051", "Access control - Hotel lodging system", "DORMA/KABA", "DORMA/KABA", "DORMA/KABA",
+    "0x9101", "FIDELIO CRUISE ship property management system, - materials management system, - meal counting system", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH",
+    "0x9102", "FIDELIO CRUISE ship property management system, - materials management system, - meal counting system", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH",
+    "0x9103", "FIDELIO CRUISE ship property management system, - materials management system, - meal counting system", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH", "FIDELIO CRUISE SOFTWARE GMBH",
+    "0x9502", "General / NXP Test / Graz", "Philips Semiconductors Gratkorn GmbH", "NXP", "NXP",
+    "0x9503", "General / NXP Test / Graz", "Philips Semiconductors Gratkorn GmbH", "NXP", "NXP",
+    "0x9504", "General / NXP Test / Graz", "Philips Semiconductors Gratkorn GmbH", "NXP", "NXP",
+    "0x9702", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9703", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9704", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9705", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9706", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9707", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0x9708", "Prepaid Meteringh, service functions of technical systems", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH", "Engelmann Sensor GmbH",
+    "0xA001", "Health services", "Rosan Finance", "Express Card", "Express Card",
+    "0xA002", "Card holders vital medical data", "Rosan Finance", "Medical Org.", "Rosan Finance",
+    "0xA003", "Identification of card holder", "Rosan Finance", "Hospitals Cllinics Drug Stores", "Rosan Finance",
+    "0xA004", "Medical information", "CYNAPS", "Cynaps", "Cynaps",
+    "0xA005", "Medical information", "CYNAPS", "Cynaps", "Cynaps",
+    "0xA006", "Medical information", "CYNAPS", "Cynaps", "Cynaps",
+    "0xA007", "Medical information", "CYNAPS", "Cynaps", "Cynaps",
+    "0xA008", "Medical information", "CYNAPS", "Cynaps", "Cynaps",
+    "0xA009", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0xA00A", "Self service, pharmacy, medicine issue", "EnzoSystems BV", "EnzoSystems", "EnzoSystems",
+    "0xA00B", "Health Services", "QSI", "QSI", "QSI",
+    "0xA00C", "Health services", "Carelink AB", "Carelink AB", "Carelink AB",
+    "0xB001", "Debit card, door access control, computer identification", "Netcard", "Netcard", "Netcard",
+    "0xB002", "Multiapplication car for industry & trafic, parking, swimming pool", "ASEC S.A.", "ASEC S.A", "ASEC S.A",
+    "0xB003", "Miscellaneous application, city traffic, access controll & securitym entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0xB004", "", "Reac BV", "", "REAC",
+    "0xB005", "Electronic purse", "BULL POLSKA Sp. z o.o.", "BULL POLSKA", "BULL POLSKA",
+    "0xB006", "Electronic trade", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH", "SIT Solution for IT Payment GmbH",
+    "0xB007", "Electronic voucher system, loyalty application, electronic wallet, transport", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O",
+    "0xB008", "Electronic voucher system, loyalty application, electronic wallet, transport", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O",
+    "0xB009", "Electronic voucher system, loyalty application, electronic wallet, transport", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O",
+    "0xB00A", "Electronic voucher system, loyalty application, electronic wallet, transport", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O", "Prosoft SPOL S.R.O",
+    "0xB801", "Point of sale", "VFJ Technology Pty Ltd", "VFJ Technology", "",
+    "0xB802", "An electronic purse application for Educational Institutions (Universities etc...)", "VERIFONE ITALIA SRL", "VeriFone Italy", "VeriFone Italy",
+    "0xB803", "Banking electronic purse", "ETC Electronic Technology Communication Company Limited", "Electronic Technology Communication Co Ltd.", "Electronic Technology Communication Co Ltd.",
+    "0xB804", "Banking prepaid payment", "ETC Electronic Technology Communication Company Limited", "Vietnam Joint Stock Commercial Bank for Industry and trade (VietinBank)", "Electronic Technology Communication Co Ltd (E.T.C)",
+    "0xB805", "Multichip and Multiapplication Credit Card for banking, electronic purse, access control, payment and identification", "PBV Kaufmann Systeme GmbH", "CCC Credit Card Center AG", "",
+    "0xC001", "Gaming industry, cashless operation for slotmachines, tables and other Facilities (ID, cashless, offline, purse)", "Grips Electronic GmbH", "Sun International", "Grips, Sun International",
+    "0xC002", "Gaming industry, cashless operation for slotmachines, tables and other Facilities (ID, cashless, offline, purse)", "Grips Electronic GmbH", "Sun International", "Grips, Sun International",
+    "0xC003", "Gaming industry, cashless operation for slotmachines, tables and other Facilities (ID, cashless, offline, purse)", "Grips Electronic GmbH", "Sun International", "Grips, Sun International",
+    "0xC004", "Gaming industry, cashless operation for slotmachines, tables and other Facilities (ID, cashless, offline, purse)", "Grips Electronic GmbH", "Sun International", "Grips, Sun International",
+    "0xC005", "Access Controll, Security Electronic Purse, Ski-Ticketing, Ticketing", "*Siemens ANL", "", "Siemens AG",
+    "0xC006", "Security and safety services", "Staat der Nederlanden, Ministerie van Financien Belastingdienst/Centrum voor facilitaire dienstverlening", "Siemens Nederland BV", "Siemens Nederland BV",
+    "0xC007", "Event ticketing", "Just Access", "Just Access Inc.", "",
+    "0xC008", "Entertainment & Sports", "A&A Company", "A&A Company", "A&A Company",
+    "0xC009", "Miscellaneous application, city traffic, access control & security, entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0xC01A", "Access control, time attendance, bus ticket, hotel room card, VIP card f. club", "Giga-TMS Inc", "Giga TMS", "Giga TMS",
+    "0xC01B", "Access control & security, entertainment and sports", "Giga-TMS Inc", "Giga", "Giga",
+    "0xC01C", "Entertainment and Sports, Stadiums, Parking, Ski Ticketing", "Axess AG", "Axess", "Axess",
+    "0xC01D", "Entertainment and Sports, Stadiums, Parking, Ski Ticketing", "Axess AG", "Axess", "Axess",
+    "0xC01E", "Entertainment and Sports, Stadiums, Parking, Ski Ticketing", "Axess AG", "Axess", "Axess",
+    "0xC01F", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC020", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC021", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC022", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC023", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC024", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC025", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC026", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC027", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC028", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC029", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC02A", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC02B", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC02C", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC02D", "Gaming industry, Retail Loyalty, Access Control, Point of Sale", "Worldsamrt Technology Pty Ltd", "", "Worldsmart Technology",
+    "0xC02E", "Compelete system for lockers, access control & electr. payment", "Ojmar S. A.", "", "Enkoa System S.L.",
+    "0xC02F", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0xC030", "Entertainment & sports", "n-tree Solutions Ticketsysteme", "n-tree", "n-tree",
+    "0xC031", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0xC032", "StadiumTicketing & Access Contr", "T-Systems GEI GmbH", "T-Systems GEI GmbH", "T-Systems GEI GmbH",
+    "0xC033", "Car parking, sport applic, hotel, access control systems", "DATASEC Electronic GmbH", "Datasec", "Datatsec",
+    "0xC040", "Gaming Industry", "Systems in Progress", "Systems in Progress", "Systems in Progress",
+    "0xC041", "Gaming Industry", "Systems in Progress", "Systems in Progress", "Systems in Progress",
+    "0xC042", "Gaming Industry", "Systems in Progress", "Systems in Progress", "Systems in Progress",
+    "0xC043", "Gaming Industry", "Systems in Progress", "Systems in Progress", "Systems in Progress",
+    "0xC044", "Payment, payment OEM, payment partner, entertainment, OEM data", "Payment Solution AG", "Payment Solution AG", "Payment Solution AG",
+    "0xC045", "Scorecard for golf, payment solution for golf", "Gobex", "Gobex", "Gobex",
+    "0xC046", "Scorecard for golf, payment solution for golf", "Gobex", "Gobex", "Gobex",
+    "0xC047", "Leisure Management Application. inc. bookings, access control, e-purse and Electronic Point of Sale", "Gladstone Health & Leisure", "Gladstone", "Gladstone",
+    "0xC048", "Leisure Management Application. inc. bookings, access control, e-purse and Electronic Point of Sale", "Gladstone Health & Leisure", "Gladstone", "Gladstone",
+    "0xC049", "Event ticketing", "IMA ltd.", "IMA LTD.", "IMA LTD.",
+    "0xC04A", "Soccer stadium ticketing and e-purse application", "Smartchip S.A.", "Corporacion Dim", "Smartchip S.A.",
+    "0xC04B", "Entertainment & spports", "Gantner Electronic GmbH", "GANTNER Electronic", "GANTNER Electronic",
+    "0xC04C", "Multi-purpose application for sport facilities - access control, purse etc for stadiums, sport centers etc", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0xC04D", "Multi-purpose application for sport facilities - access control, purse etc for stadiums, sport centers etc", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0xC04E", "Multi-purpose application for sport facilities - access control, purse etc for stadiums, sport centers etc", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0xC04F", "Multi-purpose application for sport facilities - access control, purse etc for stadiums, sport centers etc", "Unicard S.A.", "UNICARD S.A.", "UNICARD S.A.",
+    "0xC050", "", "Reac BV", "", "REAC",
+    "0xC051", "Access control and ticketing for entertainment and sports", "Mosrir Szczecin", "Mosrir Szczecin", "Sportdata Sp. 2 0.0.",
+    "0xC052", "Accesss control in sport stadiums and e-purse", "FortressGb", "FORTRESSGB", "FORTRESSGB",
+    "0xC801", "Car parking", "Scheidt & Bachmann", "Scheidt & Bachmann GmbH", "",
+    "0xC802", "Car parking", "Scheidt & Bachmann", "Scheidt & Bachmann GmbH", "",
+    "0xC803", "", "Reserved for MAD", "", "",
+    "0xC805", "Car parking systems", "Eden", "", "Eden",
+    "0xC806", "Car Parking", "MADA Marx Datentechnik GmbH", "MADA", "MADA",
+    "0xC810", "Car parking", "Scheidt & Bachmann", "Scheidt & Bachmann GmbH", "",
+    "0xC811", "Car parking", "CNA Limited/Rax-Comm Systems Ltd.", "CNA Limited", "CNA Limited",
+    "0xC812", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC813", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC814", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC815", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC816", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC817", "Park access application", "EFKON AG", "efkon", "efkon",
+    "0xC819", "Security and safety services", "Staat der Nederlanden, Ministerie van Financien Belastingdienst/Centrum voor facilitaire dienstverlening", "Siemens Nederland BV", "Siemens Nederland BV",
+    "0xC81A", "Car Parking System", "Edward Keller Ltd.", "Edward Keller Ltd", "Edward Keller Ltd",
+    "0xC81B", "Multiapplication car for industry & trafic, parking, swimming pool", "ASEC S.A.", "ASEC S.A", "ASEC S.A",
+    "0xC81C", "Miscellaneous application, city traffic, access control & security entertainment, car parking, electronic trade", "KFAP S.A.", "KFPA", "KFPA",
+    "0xC81D", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0xC81E", "", "TechID Engineering bv", "Tech ID", "Tech ID",
+    "0xC81F", "Entertainment and Sports, Stadiums, Parking, Ski Ticketing", "Axess AG", "Axess", "Axess",
+    "0xC820", "Road toll", "Diners Club Adriatic d.d.", "Diners Club", "Diners Club",
+    "0xC821", "Company services, access & sec control, electronic purse...", "Cominfo a.s.", "Cominfo", "Cominfo",
+    "0xC822", "Access control & security, city traffic, sports & entertainment", "IP Core", "IP Core", "IP Core",
+    "0xC823", "Electronic purse, carparking system, single use ticket, period pass", "Emcard a.s.", "Emcard", "Emtest",
+    "0xC824", "Car parking, sport applic, hotel, access control systems", "DATASEC Electronic GmbH", "Datasec", "Datatsec",
+    "0xC825", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC826", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC827", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC828", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC829", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC82A", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC82B", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC82C", "Car parking", "Parkeon", "Parkeon", "Parkeon",
+    "0xC82D", "Car parking system", "PENTA d.o.o.", "PENTA", "PENTA",
+    "0xC82E", "Car wash", "Group Capmonetique", "MONEPARC, Parc Technologique Les moulins 2, 2791 Chemin St. Bernard, 06220 Vallauris, France", "MONECARTE",
+    "0xC82F", "Car parking system: storage of entrance and payment information", "DEC S.R.L", "DEC S.R.L", "DEC S.R.L",
+    "0xC830", "Car parking system: storage of subscription data", "DEC S.R.L", "DEC S.R.L", "DEC S.R.L",
+    "0xC831", "Car parking", "Cards & Devices GmbH", "Cards & Devices GmbH", "Cards & Devices GmbH",
+    "0xC902", "RF Loyalty/Fleet Card System", "Panasonic Industrial Company", "Panasonic Loyalty", "Panasonic Industrial Company",
+    "0xC903", "RF Loyalty/Fleet Card System", "Panasonic Industrial Company", "Panasonic Loyalty", "Panasonic Industrial Company",
+    "0xD001", "Payment, loyalty and vehicle card", "Tokheim", "Retail Petroleum Systems", "Retail Petroleum Systems",
+    "0xD002", "Payment, loyalty and vehicle card", "Tokheim", "Retail Petroleum Systems", "Retail Petroleum Systems",
+    "0xD003", "Payment, loyalty and vehicle card", "Tokheim", "Retail Petroleum Systems", "Retail Petroleum Systems",
+    "0xD004", "Driver Vehicle Identification / fueling", "Nedap - CTP B.V.", "Nedap CTP B.V.", "D.V.I / Nedap - CTP B.V.",
+    "0xD005", "Fuel, Gasoline", "MADA Marx Datentechnik GmbH", "MADA", "MADA",
+    "0xD006", "Electronic fuel voucher", "GRUPO VR", "Grupo VR", "",
+    "0xD007", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD008", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD009", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00A", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00B", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00C", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00D", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00E", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD00F", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD010", "Attended and unattended operation", "Postec Data Systems Limited", "Unisys Marconi Commerce", "Postec Data Systems",
+    "0xD038", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD039", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03A", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03B", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03C", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03D", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03E", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD03F", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD040", "Fuel gasoline", "R&D Solutionz Ltd.", "", "R&D",
+    "0xD041", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD042", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD043", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD044", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD045", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD046", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD047", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD048", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD049", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04A", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04B", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04C", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04D", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04E", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD04F", "Fuel, Gasoline", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD050", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD051", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD052", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD053", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD054", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD055", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD056", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD057", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD058", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD059", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05A", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05B", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05C", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05D", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05E", "Fuel Gasoline India", "EFKON AG", "Efkon", "Efkon",
+    "0xD05F", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD060", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD061", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD062", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD063", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD064", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD065", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD066", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD067", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD068", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD069", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD06A", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD06B", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD06C", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD06D", "Fuel Gasoline India", "EFKON AG", "Efkon AG", "Efkon AG",
+    "0xD06E", "Applications for oil and gas", "Tietoenator Energy Components", "Tietoenator", "Tietoenator",
+    "0xD06F", "Applications for oil and gas", "Tietoenator Energy Components", "Tietoenator", "Tietoenator",
+    "0xD070", "Applications for oil and gas", "Tietoenator Energy Components", "Tietoenator", "Tietoenator",
+    "0xD071", "Applications for oil and gas", "Tietoenator Energy Components", "Tietoenator", "Tietoenator",
+    "0xD072", "Fuel, gasoline station", "Hectronic GmbH", "Hectronic GmbH", "Hectronic GmbH",
+    "0xD073", "Fuel, gasoline", "PBV Kaufmann Systeme GmbH", "BICA AG", "BICA AG",
+    "0xD074", "Fuel, gasoline", "PBV Kaufmann Systeme GmbH", "BICA AG", "BICA AG",
+    "0xD075", "", "Hectronic GmbH", "", "Hectronic GmbH",
+    "0xD076", "", "Hectronic GmbH", "", "Hectronic GmbH",
+    "0xD077", "", "Hectronic GmbH", "", "Hectronic GmbH",
+    "0xD078", "Time attendance, fuel, access control", "Emcard a.s.", "Emtest", "Emtest",
+    "0xD079", "Identification", "Honeywell Automation India Limited", "Honeywell Automation India Limited", "Honeywell Automation India Limited",
+    "0xD801", "Security and safety services", "Staat der Nederlanden, Ministerie van Financien Belastingdienst/Centrum voor facilitaire dienstverlening", "Siemens Nederland BV", "Siemens Nederland BV",
+    "0xE101", "", "X-Ident GmbH", "", "",
+    "0xE102", "NFC applications", "Philips Semiconductors Gratkorn GmbH", "Philips Semiconductors", "Philips Semiconductors",
+    "0xE103", "NFC applications", "NXP Semiconductors", "Philips SC", "Philips SC",
+    "0xE104", "Global purse", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0xE105", "Global purse", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0xE106", "Global purse", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0xE107", "Global purse", "Microtronic AG", "Microtronic AG", "Microtronic AG",
+    "0xE801", "MS-Windows Logon and security facilities", "Integrated Engineering", "IE Holding", "IE Holding",
+    "0xE802", "Security and safety services", "Staat der Nederlanden, Ministerie van Financien Belastingdienst/Centrum voor facilitaire dienstverlening", "Siemens Nederland BV", "Siemens Nederland BV",
+    "0xE803", "Safeguard Security Products Family", "Utimaco Safeware AG - \xc3\x96sterreich", "Utimaco Safeware AG", "Ultimaco Safeware AG",
+    "0xE804", "Safeguard Security Products Family", "Utimaco Safeware AG - \xc3\x96sterreich", "Utimaco Safeware AG", "Ultimaco Safeware AG",
+    "0xE805", "Safeguard Security Products Family", "Utimaco Safeware AG - \xc3\x96sterreich", "Utimaco Safeware AG", "Ultimaco Safeware AG",
+    "0xE806", "Computer, car parking, elec. purse, access control & security", "DECA Engineering", "Deca Engineering", "Deca Engineering",
+    "0xE807", "", "TechID Engineering bv", "Tech ID", "Tech ID",
+    "0xE808", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0xE809", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0xE80A", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0xE80B", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0xE80C", "", "Horoquartz Gestion des Temps", "Horoquartz", "Horoquartz",
+    "0xE80D", "PC log on via MIFARE & DESfire", "Tx Systems Inc", "TX Systems", "TX Systems",
+    "0xE80E", "Access control, computer application, company services", "Volvo Car Corporation", "Volvo Car", "Volvo Car",
+    "0xE80F", "Software Licensing Application", "OmniCard Group B.V.", "OmniCard Group B.V.", "OmniCard Group B.V.",
+    "0xE810", "Computer logon", "Igel Technology GmbH", "Igel Technology GmbH", "Igel Technology GmbH",
+    "0xE811", "MS-Windows PC Logon", "United Access GmbH", "United Access GmbH", "United Access GmbH",
+    "0xE812", "Computer Technical Event - Membercard access control", "Strawberry AG", "Strawberry AG", "",
+    "0xE814", "Payment, payment OEM, payment partner, entertainment, OEM data", "Payment Solution AG", "Payment Solution AG", "Payment Solution AG",
+    "0xE815", "MIFARE PC Logon & Security", "PinCash International", "Pincash international BV", "Pincash international BV",
+    "0xE816", "Logical Access control and software licensing", "INID BV", "INID", "INID",
+    "0xF001", "Miscellaneous applications", "TechID Engineering bv", "Tech ID", "Tech ID",
+    "0xFFFF", "Miscellaneous applications", "Reserved For future Use", "RFU", "RFU",
+};
+
+static const uint32_t restable_mad_order[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+    480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+    544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 590, 588, 589, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751,
+    752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799,
+    800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+    816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+    848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+    864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+    880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+    896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+    1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+    1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+    1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+    1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+    1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+    1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+    1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+    1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+    1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+    1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+    1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+    1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+    1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
+    1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+    1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+    1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+    1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+    1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+    1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+    1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+    1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+    1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+    1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+    1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+    1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+    1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823,
+    1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+    1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
+    1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+    1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+    1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+    1952, 1953, 1954, 1955,
+};
+
+static const char *const restable_oids_fields[] = {
+    "oid", "d", "c"
+};
+
+static const char *const restable_oids_cells[] = {
+    "1.3.6.1.4.1.41482", "Yubico", "FIDO Alliance",
+    "1.3.6.1.4.1.45724", "FIDO Alliance, Inc.", "FIDO Alliance",
+    "1.3.6.1.4.1.41482.2", "Device ID", "Yubico",
+    "1.3.6.1.4.1.45724.2.1.1", "FIDO U2F Transports", "FIDO Alliance",
+    "1.3.6.1.4.1.45724.1.1.4", "Authenticator Attestation GUID", "FIDO Alliance",
+    "0.2.262.1.10", "Telesec", "Deutsche Telekom",
+    "0.2.262.1.10.0", "extension", "Telesec",
+    "0.2.262.1.10.1", "mechanism", "Telesec",
+    "0.2.262.1.10.1.0", "authentication", "Telesec mechanism",
+    "0.2.262.1.10.1.0.1", "passwordAuthentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.2", "protectedPasswordAuthentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.3", "oneWayX509Authentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.4", "twoWayX509Authentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.5", "threeWayX509Authentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.6", "oneWayISO9798Authentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.7", "twoWayISO9798Authentication", "Telesec authentication",
+    "0.2.262.1.10.1.0.8", "telekomAuthentication", "Telesec authentication",
+    "0.2.262.1.10.1.1", "signature", "Telesec mechanism",
+    "0.2.262.1.10.1.1.1", "md4WithRSAAndISO9697", "Telesec mechanism",
+    "0.2.262.1.10.1.1.2", "md4WithRSAAndTelesecSignatureStandard", "Telesec mechanism",
+    "0.2.262.1.10.1.1.3", "md5WithRSAAndISO9697", "Telesec mechanism",
+    "0.2.262.1.10.1.1.4", "md5WithRSAAndTelesecSignatureStandard", "Telesec mechanism",
+    "0.2.262.1.10.1.1.5", "ripemd160WithRSAAndTelekomSignatureStandard", "Telesec mechanism",
+    "0.2.262.1.10.1.1.9", "hbciRsaSignature", "Telesec signature",
+    "0.2.262.1.10.1.2", "encryption", "Telesec mechanism",
+    "0.2.262.1.10.1.2.0", "none", "Telesec encryption",
+    "0.2.262.1.10.1.2.1", "rsaTelesec", "Telesec encryption",
+    "0.2.262.1.10.1.2.2", "des", "Telesec encryption",
+    "0.2.262.1.10.1.2.2.1", "desECB", "Telesec encryption",
+    "0.2.262.1.10.1.2.2.2", "desCBC", "Telesec encryption",
+    "0.2.262.1.10.1.2.2.3", "desOFB", "Telesec encryption",
+    "0.2.262.1.10.1.2.2.4", "desCFB8", "Telesec encryption",
+    "0.2.262.1.10.1.2.2.5", "desCFB64", "Telesec encryption",
+    "0.2.262.1.10.1.2.3", "des3", "Telesec encryption",
+    "0.2.262.1.10.1.2.3.1", "des3ECB", "Telesec encryption",
+    "0.2.262.1.10.1.2.3.2", "des3CBC", "Telesec encryption",
+    "0.2.262.1.10.1.2.3.3", "des3OFB", "Telesec encryption",
+    "0.2.262.1.10.1.2.3.4", "des3CFB8", "Telesec encryption",
+    "0.2.262.1.10.1.2.3.5", "des3CFB64", "Telesec encryption",
+    "0.2.262.1.10.1.2.4", "magenta", "Telesec encryption",
+    "0.2.262.1.10.1.2.5", "idea", "Telesec encryption",
+    "0.2.262.1.10.1.2.5.1", "ideaECB", "Telesec encryption",
+    "0.2.262.1.10.1.2.5.2", "ideaCBC", "Telesec encryption",
+    "0.2.262.1.10.1.2.5.3", "ideaOFB", "Telesec encryption",
+    "0.2.262.1.10.1.2.5.4", "ideaCFB8", "Telesec encryption",
+    "0.2.262.1.10.1.2.5.5", "ideaCFB64", "Telesec encryption",
+    "0.2.262.1.10.1.3", "oneWayFunction", "Telesec mechanism",
+    "0.2.262.1.10.1.3.1", "md4", "Telesec one-way function",
+    "0.2.262.1.10.1.3.2", "md5", "Telesec one-way function",
+    "0.2.262.1.10.1.3.3", "sqModNX509", "Telesec one-way function",
+    "0.2.262.1.10.1.3.4", "sqModNISO", "Telesec one-way function",
+    "0.2.262.1.10.1.3.5", "ripemd128", "Telesec one-way function",
+    "0.2.262.1.10.1.3.6", "hashUsingBlockCipher", "Telesec one-way function",
+    "0.2.262.1.10.1.3.7", "mac", "Telesec one-way function",
+    "0.2.262.1.10.1.3.8", "ripemd160", "Telesec one-way function",
+    "0.2.262.1.10.1.4", "fecFunction", "Telesec mechanism",
+    "0.2.262.1.10.1.4.1", "reedSolomon", "Telesec mechanism",
+    "0.2.262.1.10.2", "module", "Telesec",
+    "0.2.262.1.10.2.0", "algorithms", "Telesec module",
+    "0.2.262.1.10.2.1", "attributeTypes", "Telesec module",
+    "0.2.262.1.10.2.2", "certificateTypes", "Telesec module",
+    "0.2.262.1.10.2.3", "messageTypes", "Telesec module",
+    "0.2.262.1.10.2.4", "plProtocol", "Telesec module",
+    "0.2.262.1.10.2.5", "smeAndComponentsOfSme", "Telesec module",
+    "0.2.262.1.10.2.6", "fec", "Telesec module",
+    "0.2.262.1.10.2.7", "usefulDefinitions", "Telesec module",
+    "0.2.262.1.10.2.8", "stefiles", "Telesec module",
+    "0.2.262.1.10.2.9", "sadmib", "Telesec module",
+    "0.2.262.1.10.2.10", "electronicOrder", "Telesec module",
+    "0.2.262.1.10.2.11", "telesecTtpAsymmetricApplication", "Telesec module",
+    "0.2.262.1.10.2.12", "telesecTtpBasisApplication", "Telesec module",
+    "0.2.262.1.10.2.13", "telesecTtpMessages", "Telesec module",
+    "0.2.262.1.10.2.14", "telesecTtpTimeStampApplication", "Telesec module",
+    "0.2.262.1.10.3", "objectClass", "Telesec",
+    "0.2.262.1.10.3.0", "telesecOtherName", "Telesec object class",
+    "0.2.262.1.10.3.1", "directory", "Telesec object class",
+    "0.2.262.1.10.3.2", "directoryType", "Telesec object class",
+    "0.2.262.1.10.3.3", "directoryGroup", "Telesec object class",
+    "0.2.262.1.10.3.4", "directoryUser", "Telesec object class",
+    "0.2.262.1.10.3.5", "symmetricKeyEntry", "Telesec object class",
+    "0.2.262.1.10.4", "package", "Telesec",
+    "0.2.262.1.10.5", "parameter", "Telesec",
+    "0.2.262.1.10.6", "nameBinding", "Telesec",
+    "0.2.262.1.10.7", "attribute", "Telesec",
+    "0.2.262.1.10.7.0", "applicationGroupIdentifier", "Telesec attribute",
+    "0.2.262.1.10.7.1", "certificateType", "Telesec attribute",
+    "0.2.262.1.10.7.2", "telesecCertificate", "Telesec attribute",
+    "0.2.262.1.10.7.3", "certificateNumber", "Telesec attribute",
+    "0.2.262.1.10.7.4", "certificateRevocationList", "Telesec attribute",
+    "0.2.262.1.10.7.5", "creationDate", "Telesec attribute",
+    "0.2.262.1.10.7.6", "issuer", "Telesec attribute",
+    "0.2.262.1.10.7.7", "namingAuthority", "Telesec attribute",
+    "0.2.262.1.10.7.8", "publicKeyDirectory", "Telesec attribute",
+    "0.2.262.1.10.7.9", "securityDomain", "Telesec attribute",
+    "0.2.262.1.10.7.10", "subject", "Telesec attribute",
+    "0.2.262.1.10.7.11", "timeOfRevocation", "Telesec attribute",
+    "0.2.262.1.10.7.12", "userGroupReference", "Telesec attribute",
+    "0.2.262.1.10.7.13", "validity", "Telesec attribute",
+    "0.2.262.1.10.7.14", "zert93", "Telesec attribute",
+    "0.2.262.1.10.7.15", "securityMessEnv", "Telesec attribute",
+    "0.2.262.1.10.7.16", "anonymizedPublicKeyDirectory", "Telesec attribute",
+    "0.2.262.1.10.7.17", "telesecGivenName", "Telesec attribute",
+    "0.2.262.1.10.7.18", "nameAdditions", "Telesec attribute",
+    "0.2.262.1.10.7.19", "telesecPostalCode", "Telesec attribute",
+    "0.2.262.1.10.7.20", "nameDistinguisher", "Telesec attribute",
+    "0.2.262.1.10.7.21", "telesecCertificateList", "Telesec attribute",
+    "0.2.262.1.10.7.22", "teletrustCertificateList", "Telesec attribute",
+    "0.2.262.1.10.7.23", "x509CertificateList", "Telesec attribute",
+    "0.2.262.1.10.7.24", "timeOfIssue", "Telesec attribute",
+    "0.2.262.1.10.7.25", "physicalCardNumber", "Telesec attribute",
+    "0.2.262.1.10.7.26", "fileType", "Telesec attribute",
+    "0.2.262.1.10.7.27", "ctlFileIsArchive", "Telesec attribute",
+    "0.2.262.1.10.7.28", "emailAddress", "Telesec attribute",
+    "0.2.262.1.10.7.29", "certificateTemplateList", "Telesec attribute",
+    "0.2.262.1.10.7.30", "directoryName", "Telesec attribute",
+    "0.2.262.1.10.7.31", "directoryTypeName", "Telesec attribute",
+    "0.2.262.1.10.7.32", "directoryGroupName", "Telesec attribute",
+    "0.2.262.1.10.7.33", "directoryUserName", "Telesec attribute",
+    "0.2.262.1.10.7.34", "revocationFlag", "Telesec attribute",
+    "0.2.262.1.10.7.35", "symmetricKeyEntryName", "Telesec attribute",
+    "0.2.262.1.10.7.36", "glNumber", "Telesec attribute",
+    "0.2.262.1.10.7.37", "goNumber", "Telesec attribute",
+    "0.2.262.1.10.7.38", "gKeyData", "Telesec attribute",
+    "0.2.262.1.10.7.39", "zKeyData", "Telesec attribute",
+    "0.2.262.1.10.7.40", "ktKeyData", "Telesec attribute",
+    "0.2.262.1.10.7.41", "ktKeyNumber", "Telesec attribute",
+    "0.2.262.1.10.7.51", "timeOfRevocationGen", "Telesec attribute",
+    "0.2.262.1.10.7.52", "liabilityText", "Telesec attribute",
+    "0.2.262.1.10.8", "attributeGroup", "Telesec",
+    "0.2.262.1.10.9", "action", "Telesec",
+    "0.2.262.1.10.10", "notification", "Telesec",
+    "0.2.262.1.10.11", "snmp-mibs", "Telesec",
+    "0.2.262.1.10.11.1", "securityApplication", "Telesec SNMP MIBs",
+    "0.2.262.1.10.12", "certAndCrlExtensionDefinitions", "Telesec",
+    "0.2.262.1.10.12.0", "liabilityLimitationFlag", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.1", "telesecCertIdExt", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.2", "Telesec policyIdentifier", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.3", "telesecPolicyQualifierID", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.4", "telesecCRLFilteredExt", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.5", "telesecCRLFilterExt", "Telesec cert/CRL extension",
+    "0.2.262.1.10.12.6", "telesecNamingAuthorityExt", "Telesec cert/CRL extension",
+    "0.4.0.127.0.7", "bsi", "BSI TR-03110/TR-03111",
+    "0.4.0.127.0.7.1", "bsiEcc", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1", "bsifieldType", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.1", "bsiPrimeField", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2", "bsiCharacteristicTwoField", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.2", "bsiECTLVKeyFormat", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.2.1", "bsiECTLVPublicKey", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.3", "bsiCharacteristicTwoBasis", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.3.1", "bsiGnBasis", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.3.2", "bsiTpBasis", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.2.3.3", "bsiPpBasis", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1", "bsiEcdsaSignatures", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.1", "bsiEcdsaWithSHA1", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.2", "bsiEcdsaWithSHA224", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.3", "bsiEcdsaWithSHA256", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.4", "bsiEcdsaWithSHA384", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.5", "bsiEcdsaWithSHA512", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.4.1.6", "bsiEcdsaWithRIPEMD160", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1", "bsiEckaEgX963KDF", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.1", "bsiEckaEgX963KDFWithSHA1", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.2", "bsiEckaEgX963KDFWithSHA224", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.3", "bsiEckaEgX963KDFWithSHA256", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.4", "bsiEckaEgX963KDFWithSHA384", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.5", "bsiEckaEgX963KDFWithSHA512", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.1.6", "bsiEckaEgX963KDFWithRIPEMD160", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.2", "bsiEckaEgSessionKDF", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.2.1", "bsiEckaEgSessionKDFWith3DES", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.2.2", "bsiEckaEgSessionKDFWithAES128", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.2.3", "bsiEckaEgSessionKDFWithAES192", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.1.2.4", "bsiEckaEgSessionKDFWithAES256", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2", "bsiEckaDH", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1", "bsiEckaDHX963KDF", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.1", "bsiEckaDHX963KDFWithSHA1", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.2", "bsiEckaDHX963KDFWithSHA224", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.3", "bsiEckaDHX963KDFWithSHA256", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.4", "bsiEckaDHX963KDFWithSHA384", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.5", "bsiEckaDHX963KDFWithSHA512", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.1.6", "bsiEckaDHX963KDFWithRIPEMD160", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.2", "bsiEckaDHSessionKDF", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.2.1", "bsiEckaDHSessionKDFWith3DES", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.2.2", "bsiEckaDHSessionKDFWithAES128", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.2.3", "bsiEckaDHSessionKDFWithAES192", "BSI TR-03111",
+    "0.4.0.127.0.7.1.1.5.2.2.4", "bsiEckaDHSessionKDFWithAES256", "BSI TR-03111",
+    "0.4.0.127.0.7.1.2", "bsiEcKeyType", "BSI TR-03111",
+    "0.4.0.127.0.7.1.2.1", "bsiEcPublicKey", "BSI TR-03111",
+    "0.4.0.127.0.7.1.5.1", "bsiKaeg", "BSI TR-03111",
+    "0.4.0.127.0.7.1.5.1.1", "bsiKaegWithX963KDF", "BSI TR-03111",
+    "0.4.0.127.0.7.1.5.1.2", "bsiKaegWith3DESKDF", "BSI TR-03111",
+    "0.4.0.127.0.7.2.2.1", "bsiPK", "BSI TR-03110. Formerly known as bsiCA, now moved to ...2.2.3.x",
+    "0.4.0.127.0.7.2.2.1.1", "bsiPK_DH", "BSI TR-03110. Formerly known as bsiCA_DH, now moved to ...2.2.3.x",
+    "0.4.0.127.0.7.2.2.1.2", "bsiPK_ECDH", "BSI TR-03110. Formerly known as bsiCA_ECDH, now moved to ...2.2.3.x",
+    "0.4.0.127.0.7.2.2.2", "bsiTA", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1", "bsiTA_RSA", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.1", "bsiTA_RSAv1_5_SHA1", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.2", "bsiTA_RSAv1_5_SHA256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.3", "bsiTA_RSAPSS_SHA1", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.4", "bsiTA_RSAPSS_SHA256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.5", "bsiTA_RSAv1_5_SHA512", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.1.6", "bsiTA_RSAPSS_SHA512", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2", "bsiTA_ECDSA", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2.1", "bsiTA_ECDSA_SHA1", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2.2", "bsiTA_ECDSA_SHA224", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2.3", "bsiTA_ECDSA_SHA256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2.4", "bsiTA_ECDSA_SHA384", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.2.2.5", "bsiTA_ECDSA_SHA512", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3", "bsiCA", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.1", "bsiCA_DH", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.1.1", "bsiCA_DH_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.1.2", "bsiCA_DH_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.1.3", "bsiCA_DH_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.1.4", "bsiCA_DH_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.2", "bsiCA_ECDH", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.2.1", "bsiCA_ECDH_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.2.2", "bsiCA_ECDH_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.2.3", "bsiCA_ECDH_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.3.2.4", "bsiCA_ECDH_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4", "bsiPACE", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.1", "bsiPACE_DH_GM", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.1.1", "bsiPACE_DH_GM_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.1.2", "bsiPACE_DH_GM_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.1.3", "bsiPACE_DH_GM_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.1.4", "bsiPACE_DH_GM_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.2", "bsiPACE_ECDH_GM", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.2.1", "bsiPACE_ECDH_GM_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.2.2", "bsiPACE_ECDH_GM_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.2.3", "bsiPACE_ECDH_GM_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.2.4", "bsiPACE_ECDH_GM_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.3", "bsiPACE_DH_IM", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.3.1", "bsiPACE_DH_IM_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.3.2", "bsiPACE_DH_IM_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.3.3", "bsiPACE_DH_IM_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.3.4", "bsiPACE_DH_IM_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.4", "bsiPACE_ECDH_IM", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.4.1", "bsiPACE_ECDH_IM_3DES_CBC_CBC", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.4.2", "bsiPACE_ECDH_IM_AES_CBC_CMAC_128", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.4.3", "bsiPACE_ECDH_IM_AES_CBC_CMAC_192", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.4.4.4", "bsiPACE_ECDH_IM_AES_CBC_CMAC_256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5", "bsiRI", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1", "bsiRI_DH", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1.1", "bsiRI_DH_SHA1", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1.2", "bsiRI_DH_SHA224", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1.3", "bsiRI_DH_SHA256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1.4", "bsiRI_DH_SHA384", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.1.5", "bsiRI_DH_SHA512", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2", "bsiRI_ECDH", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2.1", "bsiRI_ECDH_SHA1", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2.2", "bsiRI_ECDH_SHA224", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2.3", "bsiRI_ECDH_SHA256", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2.4", "bsiRI_ECDH_SHA384", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.5.2.5", "bsiRI_ECDH_SHA512", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.6", "bsiCardInfo", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.7", "bsiEidSecurity", "BSI TR-03110",
+    "0.4.0.127.0.7.2.2.8", "bsiPT", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.2", "bsiEACRoles", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.2.1", "bsiEACRolesIS", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.2.2", "bsiEACRolesAT", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.2.3", "bsiEACRolesST", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3", "bsiTAv2ce", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3.1", "bsiTAv2ceDescription", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3.1.1", "bsiTAv2ceDescriptionPlainText", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3.1.2", "bsiTAv2ceDescriptionIA5String", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3.1.3", "bsiTAv2ceDescriptionOctetString", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.3.2", "bsiTAv2ceTerminalSector", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.4", "bsiAuxData", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.4.1", "bsiAuxDataBirthday", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.4.2", "bsiAuxDataExpireDate", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.4.3", "bsiAuxDataCommunityID", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5", "bsiDefectList", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.1", "bsiDefectAuthDefect", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.1.1", "bsiDefectCertRevoked", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.1.2", "bsiDefectCertReplaced", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.1.3", "bsiDefectChipAuthKeyRevoked", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.1.4", "bsiDefectActiveAuthKeyRevoked", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.2", "bsiDefectEPassportDefect", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.2.1", "bsiDefectEPassportDGMalformed", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.2.2", "bsiDefectSODInvalid", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.3", "bsiDefectEIDDefect", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.3.1", "bsiDefectEIDDGMalformed", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.3.2", "bsiDefectEIDIntegrity", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.4", "bsiDefectDocumentDefect", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.4.1", "bsiDefectCardSecurityMalformed", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.4.2", "bsiDefectChipSecurityMalformed", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.5.4.3", "bsiDefectPowerDownReq", "BSI TR-03110",
+    "0.4.0.127.0.7.3.1.6", "bsiListContentDescription", "BSI TR-03110",
+    "0.4.0.127.0.7.3.2.1", "bsiSecurityObject", "BSI TR-03110",
+    "0.4.0.127.0.7.3.2.2", "bsiBlackList", "BSI TR-03110",
+    "0.4.0.127.0.7.3.4.2.2", "bsiSignedUpdateDeviceAdmin", "BSI TR-03109",
+    "0.4.0.127.0.7.4.1.1.1", "bsiCertReqMsgs", "BSI TR-03109",
+    "0.4.0.127.0.7.4.1.1.2", "bsiCertReqMsgswithOuterSignature", "BSI TR-03109",
+    "0.4.0.127.0.7.4.1.1.3", "bsiAuthorizedCertReqMsgs", "BSI TR-03109",
+    "0.4.0.127.0.7.4.1.2.2", "bsiSignedRevReqs", "BSI TR-03109",
+    "0.4.0.1862", "etsiQcsProfile", "ETSI TS 101 862 qualified certificates",
+    "0.4.0.1862.1", "etsiQcs", "ETSI TS 101 862 qualified certificates",
+    "0.4.0.1862.1.1", "etsiQcsCompliance", "ETSI TS 101 862 qualified certificates",
+    "0.4.0.1862.1.2", "etsiQcsLimitValue", "ETSI TS 101 862 qualified certificates",
+    "0.4.0.1862.1.3", "etsiQcsRetentionPeriod", "ETSI TS 101 862 qualified certificates",
+    "0.4.0.1862.1.4", "etsiQcsQcSSCD", "ETSI TS 101 862 qualified certificates",
+    "0.9.2342.19200300.100.1.1", "userID", "Some oddball X.500 attribute collection",
+    "0.9.2342.19200300.100.1.3", "rfc822Mailbox", "Some oddball X.500 attribute collection",
+    "0.9.2342.19200300.100.1.25", "domainComponent", "Men are from Mars, this OID is from Pluto",
+    "1.0.10118.3.0.49", "ripemd160", "ISO 10118-3 hash function",
+    "1.0.10118.3.0.50", "ripemd128", "ISO 10118-3 hash function",
+    "1.0.10118.3.0.55", "whirlpool", "ISO 10118-3 hash function",
+    "1.2.36.1.3.1.1.1", "qgpki", "Queensland Government PKI",
+    "1.2.36.1.3.1.1.1.1", "qgpkiPolicies", "QGPKI policies",
+    "1.2.36.1.3.1.1.1.1.1", "qgpkiMedIntermedCA", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.1.1", "qgpkiMedIntermedIndividual", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.1.2", "qgpkiMedIntermedDeviceControl", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.1.3", "qgpkiMedIntermedDevice", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.1.4", "qgpkiMedIntermedAuthorisedParty", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.1.5", "qgpkiMedIntermedDeviceSystem", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2", "qgpkiMedIssuingCA", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.1", "qgpkiMedIssuingIndividual", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.2", "qgpkiMedIssuingDeviceControl", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.3", "qgpkiMedIssuingDevice", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.4", "qgpkiMedIssuingAuthorisedParty", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.5", "qgpkiMedIssuingClientAuth", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.6", "qgpkiMedIssuingServerAuth", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.7", "qgpkiMedIssuingDataProt", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.2.8", "qgpkiMedIssuingTokenAuth", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.3", "qgpkiBasicIntermedCA", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.3.1", "qgpkiBasicIntermedDeviceSystem", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.4", "qgpkiBasicIssuingCA", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.4.1", "qgpkiBasicIssuingClientAuth", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.4.2", "qgpkiBasicIssuingServerAuth", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.1.4.3", "qgpkiBasicIssuingDataSigning", "QGPKI policy",
+    "1.2.36.1.3.1.1.1.2", "qgpkiAssuranceLevel", "QGPKI assurance level",
+    "1.2.36.1.3.1.1.1.2.1", "qgpkiAssuranceRudimentary", "QGPKI assurance level",
+    "1.2.36.1.3.1.1.1.2.2", "qgpkiAssuranceBasic", "QGPKI assurance level",
+    "1.2.36.1.3.1.1.1.2.3", "qgpkiAssuranceMedium", "QGPKI assurance level",
+    "1.2.36.1.3.1.1.1.2.4", "qgpkiAssuranceHigh", "QGPKI assurance level",
+    "1.2.36.1.3.1.1.1.3", "qgpkiCertFunction", "QGPKI policies",
+    "1.2.36.1.3.1.1.1.3.1", "qgpkiFunctionIndividual", "QGPKI policies",
+    "1.2.36.1.3.1.1.1.3.2", "qgpkiFunctionDevice", "QGPKI policies",
+    "1.2.36.1.3.1.1.1.3.3", "qgpkiFunctionAuthorisedParty", "QGPKI policies",
+    "1.2.36.1.3.1.1.1.3.4", "qgpkiFunctionDeviceControl", "QGPKI policies",
+    "1.2.36.1.3.1.2", "qpspki", "Queensland Police PKI",
+    "1.2.36.1.3.1.2.1", "qpspkiPolicies", "Queensland Police PKI",
+    "1.2.36.1.3.1.2.1.2", "qpspkiPolicyBasic", "Queensland Police PKI",
+    "1.2.36.1.3.1.2.1.3", "qpspkiPolicyMedium", "Queensland Police PKI",
+    "1.2.36.1.3.1.2.1.4", "qpspkiPolicyHigh", "Queensland Police PKI",
+    "1.2.36.1.3.1.3.2", "qtmrpki", "Queensland Transport PKI",
+    "1.2.36.1.3.1.3.2.1", "qtmrpkiPolicies", "Queensland Transport PKI",
+    "1.2.36.1.3.1.3.2.2", "qtmrpkiPurpose", "Queensland Transport PKI",
+    "1.2.36.1.3.1.3.2.2.1", "qtmrpkiIndividual", "Queensland Transport PKI purpose",
+    "1.2.36.1.3.1.3.2.2.2", "qtmrpkiDeviceControl", "Queensland Transport PKI purpose",
+    "1.2.36.1.3.1.3.2.2.3", "qtmrpkiDevice", "Queensland Transport PKI purpose",
+    "1.2.36.1.3.1.3.2.2.4", "qtmrpkiAuthorisedParty", "Queensland Transport PKI purpose",
+    "1.2.36.1.3.1.3.2.2.5", "qtmrpkiDeviceSystem", "Queensland Transport PKI purpose",
+    "1.2.36.1.3.1.3.2.3", "qtmrpkiDevice", "Queensland Transport PKI",
+    "1.2.36.1.3.1.3.2.3.1", "qtmrpkiDriverLicense", "Queensland Transport PKI device",
+    "1.2.36.1.3.1.3.2.3.2", "qtmrpkiIndustryAuthority", "Queensland Transport PKI device",
+    "1.2.36.1.3.1.3.2.3.3", "qtmrpkiMarineLicense", "Queensland Transport PKI device",
+    "1.2.36.1.3.1.3.2.3.4", "qtmrpkiAdultProofOfAge", "Queensland Transport PKI device",
+    "1.2.36.1.3.1.3.2.3.5", "qtmrpkiSam", "Queensland Transport PKI device",
+    "1.2.36.1.3.1.3.2.4", "qtmrpkiAuthorisedParty", "Queensland Transport PKI",
+    "1.2.36.1.3.1.3.2.4.1", "qtmrpkiTransportInspector", "Queensland Transport PKI authorised party",
+    "1.2.36.1.3.1.3.2.4.2", "qtmrpkiPoliceOfficer", "Queensland Transport PKI authorised party",
+    "1.2.36.1.3.1.3.2.4.3", "qtmrpkiSystem", "Queensland Transport PKI authorised party",
+    "1.2.36.1.3.1.3.2.4.4", "qtmrpkiLiquorLicensingInspector", "Queensland Transport PKI authorised party",
+    "1.2.36.1.3.1.3.2.4.5", "qtmrpkiMarineEnforcementOfficer", "Queensland Transport PKI authorised party",
+    "1.2.36.1.333.1", "australianBusinessNumber", "Australian Government corporate taxpayer ID",
+    "1.2.36.68980861.1.1.2", "signetPersonal", "Signet CA",
+    "1.2.36.68980861.1.1.3", "signetBusiness", "Signet CA",
+    "1.2.36.68980861.1.1.4", "signetLegal", "Signet CA",
+    "1.2.36.68980861.1.1.10", "signetPilot", "Signet CA",
+    "1.2.36.68980861.1.1.11", "signetIntraNet", "Signet CA",
+    "1.2.36.68980861.1.1.20", "signetPolicy", "Signet CA",
+    "1.2.36.75878867.1.100.1.1", "certificatesAustraliaPolicy", "Certificates Australia CA",
+    "1.2.156.10197.1", "gmtCryptographicAlgorithm", "China GM Standards Committee",
+    "1.2.156.10197.1.100", "gmtBlockCipher", "China GM Standards Committee",
+    "1.2.156.10197.1.102", "sm1Cipher", "China GM Standards Committee",
+    "1.2.156.10197.1.103", "ssf33Cipher", "China GM Standards Committee",
+    "1.2.156.10197.1.104", "sm4Cipher", "China GM Standards Committee",
+    "1.2.156.10197.1.200", "gmtStreamCipher", "China GM Standards Committee",
+    "1.2.156.10197.1.201", "zucCipher", "China GM Standards Committee",
+    "1.2.156.10197.1.300", "gmtPublicKeyCryptography", "China GM Standards Committee",
+    "1.2.156.10197.1.301", "sm2ECC", "China GM Standards Committee",
+    "1.2.156.10197.1.301.1", "sm2-1DigitalSignature", "China GM Standards Committee",
+    "1.2.156.10197.1.301.2", "sm2-2KeyExchange", "China GM Standards Committee",
+    "1.2.156.10197.1.301.3", "sm2-3PublicKeyEncryption", "China GM Standards Committee",
+    "1.2.156.10197.1.302", "gmtSM9IBE", "China GM Standards Committee",
+    "1.2.156.10197.1.302.1", "sm9-1DigitalSignature", "China GM Standards Committee",
+    "1.2.156.10197.1.302.2", "sm9-2KeyExchange", "China GM Standards Committee",
+    "1.2.156.10197.1.302.3", "sm9-3PublicKeyEncryption", "China GM Standards Committee",
+    "1.2.156.10197.1.400", "gmtHashAlgorithm", "China GM Standards Committee",
+    "1.2.156.10197.1.401", "sm3Hash", "China GM Standards Committee",
+    "1.2.156.10197.1.401.1", "sm3HashWithoutKey", "China GM Standards Committee",
+    "1.2.156.10197.1.401.2", "sm3HashWithKey", "China GM Standards Committee",
+    "1.2.156.10197.1.500", "gmtDigestSigning", "China GM Standards Committee",
+    "1.2.156.10197.1.501", "sm2withSM3", "China GM Standards Committee",
+    "1.2.156.10197.1.504", "rsaWithSM3", "China GM Standards Committee",
+    "1.2.156.10197.4.3", "gmtCertificateAuthority", "China GM Standards Committee",
+    "1.2.156.10197.6", "gmtStandardClass", "China GM Standards Committee",
+    "1.2.156.10197.6.1", "gmtFoundationClass", "China GM Standards Committee",
+    "1.2.156.10197.6.1.1", "gmtAlgorithmClass", "China GM Standards Committee",
+    "1.2.156.10197.6.1.1.1", "zucStandard", "China GM Standards Committee",
+    "1.2.156.10197.6.1.1.2", "sm4Standard", "China GM Standards Committee",
+    "1.2.156.10197.6.1.1.3", "sm2Standard", "China GM Standards Committee",
+    "1.2.156.10197.6.1.1.4", "sm3Standard", "China GM Standards Committee",
+    "1.2.156.10197.6.1.2", "gmtIDClass", "China GM Standards Committee",
+    "1.2.156.10197.6.1.2.1", "gmtCryptoID", "China GM Standards Committee",
+    "1.2.156.10197.6.1.3", "gmtOperationModes", "China GM Standards Committee",
+    "1.2.156.10197.6.1.4", "gmtSecurityMechanism", "China GM Standards Committee",
+    "1.2.156.10197.6.1.4.1", "gmtSM2Specification", "China GM Standards Committee",
+    "1.2.156.10197.6.1.4.2", "gmtSM2CryptographicMessageSyntax", "China GM Standards Committee",
+    "1.2.156.10197.6.2", "gmtDeviceClass", "China GM Standards Committee",
+    "1.2.156.10197.6.3", "gmtServiceClass", "China GM Standards Committee",
+    "1.2.156.10197.6.4", "gmtInfrastructure", "China GM Standards Committee",
+    "1.2.156.10197.6.5", "gmtTestingClass", "China GM Standards Committee",
+    "1.2.156.10197.6.5.1", "gmtRandomTestingClass", "China GM Standards Committee",
+    "1.2.156.10197.6.6", "gmtManagementClass", "China GM Standards Committee",
+    "1.2.392.200011.61.1.1.1", "mitsubishiSecurityAlgorithm", "Mitsubishi security algorithm",
+    "1.2.392.200011.61.1.1.1.1", "misty1-cbc", "Mitsubishi security algorithm",
+    "1.2.410.200004.1", "kisaAlgorithm", "KISA algorithm",
+    "1.2.410.200004.1.1", "kcdsa", "Korean DSA",
+    "1.2.410.200004.1.2", "has160", "Korean hash algorithm",
+    "1.2.410.200004.1.3", "seedECB", "Korean SEED algorithm, ECB mode",
+    "1.2.410.200004.1.4", "seedCBC", "Korean SEED algorithm, CBC mode",
+    "1.2.410.200004.1.5", "seedOFB", "Korean SEED algorithm, OFB mode",
+    "1.2.410.200004.1.6", "seedCFB", "Korean SEED algorithm, CFB mode",
+    "1.2.410.200004.1.7", "seedMAC", "Korean SEED algorithm, MAC mode",
+    "1.2.410.200004.1.8", "kcdsaWithHAS160", "Korean signature algorithm",
+    "1.2.410.200004.1.9", "kcdsaWithSHA1", "Korean signature algorithm",
+    "1.2.410.200004.1.10", "pbeWithHAS160AndSEED-ECB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.11", "pbeWithHAS160AndSEED-CBC", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.12", "pbeWithHAS160AndSEED-CFB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.13", "pbeWithHAS160AndSEED-OFB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.14", "pbeWithSHA1AndSEED-ECB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.15", "pbeWithSHA1AndSEED-CBC", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.16", "pbeWithSHA1AndSEED-CFB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.17", "pbeWithSHA1AndSEED-OFB", "Korean SEED algorithm, PBE key derivation",
+    "1.2.410.200004.1.20", "rsaWithHAS160", "Korean signature algorithm",
+    "1.2.410.200004.1.21", "kcdsa1", "Korean DSA",
+    "1.2.410.200004.2", "npkiCP", "KISA NPKI certificate policies",
+    "1.2.410.200004.2.1", "npkiSignaturePolicy", "KISA NPKI certificate policies",
+    "1.2.410.200004.3", "npkiKP", "KISA NPKI key usage",
+    "1.2.410.200004.4", "npkiAT", "KISA NPKI attribute",
+    "1.2.410.200004.5", "npkiLCA", "KISA NPKI licensed CA",
+    "1.2.410.200004.5.1", "npkiSignKorea", "KISA NPKI licensed CA",
+    "1.2.410.200004.5.2", "npkiSignGate", "KISA NPKI licensed CA",
+    "1.2.410.200004.5.3", "npkiNcaSign", "KISA NPKI licensed CA",
+    "1.2.410.200004.6", "npkiON", "KISA NPKI otherName",
+    "1.2.410.200004.7", "npkiAPP", "KISA NPKI application",
+    "1.2.410.200004.7.1", "npkiSMIME", "KISA NPKI application",
+    "1.2.410.200004.7.1.1", "npkiSMIMEAlgo", "KISA NPKI application",
+    "1.2.410.200004.7.1.1.1", "npkiCmsSEEDWrap", "KISA NPKI application",
+    "1.2.410.200004.10", "npki", "KISA NPKI",
+    "1.2.410.200004.10.1", "npkiAttribute", "KISA NPKI attribute",
+    "1.2.410.200004.10.1.1", "npkiIdentifyData", "KISA NPKI attribute",
+    "1.2.410.200004.10.1.1.1", "npkiVID", "KISA NPKI attribute",
+    "1.2.410.200004.10.1.1.2", "npkiEncryptedVID", "KISA NPKI attribute",
+    "1.2.410.200004.10.1.1.3", "npkiRandomNum", "KISA NPKI attribute",
+    "1.2.410.200004.10.1.1.4", "npkiVID", "KISA NPKI attribute",
+    "1.2.410.200046.1.1", "aria1AlgorithmModes", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.1", "aria128-ecb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.2", "aria128-cbc", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.3", "aria128-cfb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.4", "aria128-ofb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.5", "aria128-ctr", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.6", "aria192-ecb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.7", "aria192-cbc", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.8", "aria192-cfb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.9", "aria192-ofb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.10", "aria192-ctr", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.11", "aria256-ecb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.12", "aria256-cbc", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.13", "aria256-cfb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.14", "aria256-ofb", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.15", "aria256-ctr", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.21", "aria128-cmac", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.22", "aria192-cmac", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.23", "aria256-cmac", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.31", "aria128-ocb2", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.32", "aria192-ocb2", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.33", "aria256-ocb2", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.34", "aria128-gcm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.35", "aria192-gcm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.36", "aria256-gcm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.37", "aria128-ccm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.38", "aria192-ccm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.39", "aria256-ccm", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.40", "aria128-keywrap", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.41", "aria192-keywrap", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.42", "aria256-keywrap", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.43", "aria128-keywrapWithPad", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.44", "aria192-keywrapWithPad", "ARIA algorithm modes",
+    "1.2.410.200046.1.1.45", "aria256-keywrapWithPad", "ARIA algorithm modes",
+    "1.2.643.2.2.3", "gostSignature", "GOST R 34.10-2001 + GOST R 34.11-94 signature",
+    "1.2.643.2.2.4", "gost94Signature", "GOST R 34.10-94 + GOST R 34.11-94 signature. Obsoleted by GOST R 34.10-2001",
+    "1.2.643.2.2.19", "gostPublicKey", "GOST R 34.10-2001 (ECC) public key",
+    "1.2.643.2.2.20", "gost94PublicKey", "GOST R 34.10-94 public key. Obsoleted by GOST R 34.10-2001",
+    "1.2.643.2.2.21", "gostCipher", "GOST 28147-89 (symmetric key block cipher)",
+    "1.2.643.2.2.31.0", "testCipherParams", "Test params for GOST 28147-89",
+    "1.2.643.2.2.31.1", "cryptoProCipherA", "CryptoPro params A (default, variant 'Verba-O') for GOST 28147-89",
+    "1.2.643.2.2.31.2", "cryptoProCipherB", "CryptoPro params B (variant 1) for GOST 28147-89",
+    "1.2.643.2.2.31.3", "cryptoProCipherC", "CryptoPro params C (variant 2) for GOST 28147-89",
+    "1.2.643.2.2.31.4", "cryptoProCipherD", "CryptoPro params D (variant 3) for GOST 28147-89",
+    "1.2.643.2.2.31.5", "oscar11Cipher", "Oscar-1.1 params for GOST 28147-89",
+    "1.2.643.2.2.31.6", "oscar10Cipher", "Oscar-1.0 params for GOST 28147-89",
+    "1.2.643.2.2.31.7", "ric1Cipher", "RIC-1 params for GOST 28147-89",
+    "1.2.643.2.2.31.12", "tc26CipherA", "TC26 params 2 for GOST 28147-89",
+    "1.2.643.2.2.31.13", "tc26CipherB", "TC26 params 1 for GOST 28147-89",
+    "1.2.643.2.2.31.14", "tc26CipherC", "TC26 params 3 for GOST 28147-89",
+    "1.2.643.2.2.31.15", "tc26CipherD", "TC26 params 4 for GOST 28147-89",
+    "1.2.643.2.2.31.16", "tc26CipherE", "TC26 params 5 for GOST 28147-89",
+    "1.2.643.2.2.31.17", "tc26CipherF", "TC26 params 6 for GOST 28147-89",
+    "1.2.643.7.1.2.5.1.1", "tc26CipherZ", "TC26 params Z for GOST 28147-89",
+    "1.2.643.2.2.9", "gostDigest", "GOST R 34.11-94 digest",
+    "1.2.643.2.2.30.0", "testDigestParams", "Test params for GOST R 34.11-94",
+    "1.2.643.2.2.30.1", "cryptoProDigestA", "CryptoPro digest params A (default, variant 'Verba-O') for GOST R 34.11-94",
+    "1.2.643.2.2.30.2", "cryptoProDigestB", "CryptoPro digest params B (variant 1) for GOST R 34.11-94",
+    "1.2.643.2.2.30.3", "cryptoProDigestC", "CryptoPro digest params C (variant 2) for GOST R 34.11-94",
+    "1.2.643.2.2.30.4", "cryptoProDigestD", "CryptoPro digest params D (variant 3) for GOST R 34.11-94",
+    "1.2.643.2.2.32.2", "cryptoPro94SignA", "CryptoPro sign params A (default, variant 'Verba-O') for GOST R 34.10-94",
+    "1.2.643.2.2.32.3", "cryptoPro94SignB", "CryptoPro sign params B (variant 1) for GOST R 34.10-94",
+    "1.2.643.2.2.32.4", "cryptoPro94SignC", "CryptoPro sign params C (variant 2) for GOST R 34.10-94",
+    "1.2.643.2.2.32.5", "cryptoPro94SignD", "CryptoPro sign params D (variant 3) for GOST R 34.10-94",
+    "1.2.643.2.2.33.1", "cryptoPro94SignXA", "CryptoPro sign params XA (variant 1) for GOST R 34.10-94",
+    "1.2.643.2.2.33.2", "cryptoPro94SignXB", "CryptoPro sign params XB (variant 2) for GOST R 34.10-94",
+    "1.2.643.2.2.33.3", "cryptoPro94SignXC", "CryptoPro sign params XC (variant 3) for GOST R 34.10-94",
+    "1.2.643.2.2.35.0", "testSignParams", "Test elliptic curve for GOST R 34.10-2001",
+    "1.2.643.2.2.35.1", "cryptoProSignA", "CryptoPro ell.curve A for GOST R 34.10-2001",
+    "1.2.643.2.2.35.2", "cryptoProSignB", "CryptoPro ell.curve B for GOST R 34.10-2001",
+    "1.2.643.2.2.35.3", "cryptoProSignC", "CryptoPro ell.curve C for GOST R 34.10-2001",
+    "1.2.643.2.2.36.0", "cryptoProSignXA", "CryptoPro ell.curve XA for GOST R 34.10-2001",
+    "1.2.643.2.2.36.1", "cryptoProSignXB", "CryptoPro ell.curve XB for GOST R 34.10-2001",
+    "1.2.643.7.1.2.1.1.1", "cryptoPro2012Sign256A", "CryptoPro ell.curve A for GOST R 34.10-2012 256 bit",
+    "1.2.643.7.1.2.1.2.1", "cryptoPro2012Sign512A", "CryptoPro ell.curve A (default) for GOST R 34.10-2012 512 bit",
+    "1.2.643.7.1.2.1.2.2", "cryptoPro2012Sign512B", "CryptoPro ell.curve B for GOST R 34.10-2012 512 bit",
+    "1.2.643.7.1.2.1.2.3", "cryptoPro2012Sign512C", "CryptoPro ell.curve C for GOST R 34.10-2012 512 bit",
+    "1.2.643.2.2.14.0", "nullMeshing", "Do not mesh state of GOST 28147-89 cipher",
+    "1.2.643.2.2.14.1", "cryptoProMeshing", "CryptoPro meshing of state of GOST 28147-89 cipher",
+    "1.2.643.2.2.10", "hmacGost", "HMAC with GOST R 34.11-94",
+    "1.2.643.2.2.13.0", "gostWrap", "Wrap key using GOST 28147-89 key",
+    "1.2.643.2.2.13.1", "cryptoProWrap", "Wrap key using diversified GOST 28147-89 key",
+    "1.2.643.2.2.96", "cryptoProECDHWrap", "Wrap key using ECC DH on GOST R 34.10-2001 keys (VKO)",
+    "1.2.643.7.1.1.1.1", "gost2012PublicKey256", "GOST R 34.10-2012 256 bit public key",
+    "1.2.643.7.1.1.1.2", "gost2012PublicKey512", "GOST R 34.10-2012 512 bit public key",
+    "1.2.643.7.1.1.2.2", "gost2012Digest256", "GOST R 34.11-2012 256 bit digest",
+    "1.2.643.7.1.1.2.3", "gost2012Digest512", "GOST R 34.11-2012 512 bit digest",
+    "1.2.643.7.1.1.3.2", "gost2012Signature256", "GOST R 34.10-2012 256 bit signature",
+    "1.2.643.7.1.1.3.3", "gost2012Signature512", "GOST R 34.10-2012 512 bit signature",
+    "1.2.643.7.1.1.6.1", "cryptoProECDH256", "CryptoPro ECC DH algorithm for GOST R 34.10-2012 256 bit key",
+    "1.2.643.7.1.1.6.2", "cryptoProECDH512", "CryptoPro ECC DH algorithm for GOST R 34.10-2012 512 bit key",
+    "1.2.752.34.1", "seis-cp", "SEIS Project",
+    "1.2.752.34.1.1", "SEIS high-assurance policyIdentifier", "SEIS Project certificate policies",
+    "1.2.752.34.1.2", "SEIS GAK policyIdentifier", "SEIS Project certificate policies",
+    "1.2.752.34.2", "SEIS pe", "SEIS Project",
+    "1.2.752.34.3", "SEIS at", "SEIS Project",
+    "1.2.752.34.3.1", "SEIS at-personalIdentifier", "SEIS Project attribute",
+    "1.2.840.10040.1", "module", "ANSI X9.57",
+    "1.2.840.10040.1.1", "x9f1-cert-mgmt", "ANSI X9.57 module",
+    "1.2.840.10040.2", "holdinstruction", "ANSI X9.57",
+    "1.2.840.10040.2.1", "holdinstruction-none", "ANSI X9.57 hold instruction",
+    "1.2.840.10040.2.2", "callissuer", "ANSI X9.57 hold instruction",
+    "1.2.840.10040.2.3", "reject", "ANSI X9.57 hold instruction",
+    "1.2.840.10040.2.4", "pickupToken", "ANSI X9.57 hold instruction",
+    "1.2.840.10040.3", "attribute", "ANSI X9.57",
+    "1.2.840.10040.3.1", "countersignature", "ANSI X9.57 attribute",
+    "1.2.840.10040.3.2", "attribute-cert", "ANSI X9.57 attribute",
+    "1.2.840.10040.4", "algorithm", "ANSI X9.57",
+    "1.2.840.10040.4.1", "dsa", "ANSI X9.57 algorithm",
+    "1.2.840.10040.4.2", "dsa-match", "ANSI X9.57 algorithm",
+    "1.2.840.10040.4.3", "dsaWithSha1", "ANSI X9.57 algorithm",
+    "1.2.840.10045.1", "fieldType", "ANSI X9.62. This OID is also assigned as ecdsa-with-SHA1",
+    "1.2.840.10045.1.1", "prime-field", "ANSI X9.62 field type",
+    "1.2.840.10045.1.2", "characteristic-two-field", "ANSI X9.62 field type",
+    "1.2.840.10045.1.2.3", "characteristic-two-basis", "ANSI X9.62 field type",
+    "1.2.840.10045.1.2.3.1", "onBasis", "ANSI X9.62 field basis",
+    "1.2.840.10045.1.2.3.2", "tpBasis", "ANSI X9.62 field basis",
+    "1.2.840.10045.1.2.3.3", "ppBasis", "ANSI X9.62 field basis",
+    "1.2.840.10045.2", "publicKeyType", "ANSI X9.62",
+    "1.2.840.10045.2.1", "ecPublicKey", "ANSI X9.62 public key type",
+    "1.2.840.10045.3.0.1", "c2pnb163v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.2", "c2pnb163v2", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.3", "c2pnb163v3", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.5", "c2tnb191v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.6", "c2tnb191v2", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.7", "c2tnb191v3", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.10", "c2pnb208w1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.11", "c2tnb239v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.12", "c2tnb239v2", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.13", "c2tnb239v3", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.16", "c2pnb272w1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.18", "c2tnb359v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.19", "c2pnb368w1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.0.20", "c2tnb431r1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.1", "prime192v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.2", "prime192v2", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.3", "prime192v3", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.4", "prime239v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.5", "prime239v2", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.6", "prime239v3", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.3.1.7", "prime256v1", "ANSI X9.62 named elliptic curve",
+    "1.2.840.10045.4.1", "ecdsaWithSHA1", "ANSI X9.62 ECDSA algorithm with SHA1",
+    "1.2.840.10045.4.2", "ecdsaWithRecommended", "ANSI X9.62 ECDSA algorithm with Recommended",
+    "1.2.840.10045.4.3", "ecdsaWithSpecified", "ANSI X9.62 ECDSA algorithm with Specified",
+    "1.2.840.10045.4.3.1", "ecdsaWithSHA224", "ANSI X9.62 ECDSA algorithm with SHA224",
+    "1.2.840.10045.4.3.2", "ecdsaWithSHA256", "ANSI X9.62 ECDSA algorithm with SHA256",
+    "1.2.840.10045.4.3.3", "ecdsaWithSHA384", "ANSI X9.62 ECDSA algorithm with SHA384",
+    "1.2.840.10045.4.3.4", "ecdsaWithSHA512", "ANSI X9.62 ECDSA algorithm with SHA512",
+    "1.2.840.10046.1", "fieldType", "ANSI X9.42",
+    "1.2.840.10046.1.1", "gf-prime", "ANSI X9.42 field type",
+    "1.2.840.10046.2", "numberType", "ANSI X9.42",
+    "1.2.840.10046.2.1", "dhPublicKey", "ANSI X9.42 number type",
+    "1.2.840.10046.3", "scheme", "ANSI X9.42",
+    "1.2.840.10046.3.1", "dhStatic", "ANSI X9.42 scheme",
+    "1.2.840.10046.3.2", "dhEphem", "ANSI X9.42 scheme",
+    "1.2.840.10046.3.3", "dhHybrid1", "ANSI X9.42 scheme",
+    "1.2.840.10046.3.4", "dhHybrid2", "ANSI X9.42 scheme",
+    "1.2.840.10046.3.5", "mqv2", "ANSI X9.42 scheme",
+    "1.2.840.10046.3.6", "mqv1", "ANSI X9.42 scheme",
+    "1.2.840.10065.2.2", "?", "ASTM 31.20",
+    "1.2.840.10065.2.3", "healthcareLicense", "ASTM 31.20",
+    "1.2.840.10065.2.3.1.1", "license?", "ASTM 31.20 healthcare license type",
+    "1.2.840.10070", "iec62351", "IEC 62351",
+    "1.2.840.10070.8", "iec62351_8", "IEC 62351-8",
+    "1.2.840.10070.8.1", "iecUserRoles", "IEC 62351-8",
+    "1.2.840.113533.7", "nsn", "",
+    "1.2.840.113533.7.65", "nsn-ce", "",
+    "1.2.840.113533.7.65.0", "entrustVersInfo", "Nortel Secure Networks ce",
+    "1.2.840.113533.7.66", "nsn-alg", "",
+    "1.2.840.113533.7.66.3", "cast3CBC", "Nortel Secure Networks alg",
+    "1.2.840.113533.7.66.10", "cast5CBC", "Nortel Secure Networks alg",
+    "1.2.840.113533.7.66.11", "cast5MAC", "Nortel Secure Networks alg",
+    "1.2.840.113533.7.66.12", "pbeWithMD5AndCAST5-CBC", "Nortel Secure Networks alg",
+    "1.2.840.113533.7.66.13", "passwordBasedMac", "Nortel Secure Networks alg",
+    "1.2.840.113533.7.67", "nsn-oc", "",
+    "1.2.840.113533.7.67.0", "entrustUser", "Nortel Secure Networks oc",
+    "1.2.840.113533.7.68", "nsn-at", "",
+    "1.2.840.113533.7.68.0", "entrustCAInfo", "Nortel Secure Networks at",
+    "1.2.840.113533.7.68.10", "attributeCertificate", "Nortel Secure Networks at",
+    "1.2.840.113549.1.1", "pkcs-1", "",
+    "1.2.840.113549.1.1.1", "rsaEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.2", "md2WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.3", "md4WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.4", "md5WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.5", "sha1WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.7", "rsaOAEP", "PKCS #1",
+    "1.2.840.113549.1.1.8", "pkcs1-MGF", "PKCS #1",
+    "1.2.840.113549.1.1.9", "rsaOAEP-pSpecified", "PKCS #1",
+    "1.2.840.113549.1.1.10", "rsaPSS", "PKCS #1",
+    "1.2.840.113549.1.1.11", "sha256WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.12", "sha384WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.13", "sha512WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.14", "sha224WithRSAEncryption", "PKCS #1",
+    "1.2.840.113549.1.1.6", "rsaOAEPEncryptionSET", "PKCS #1. This OID may also be assigned as ripemd160WithRSAEncryption",
+    "1.2.840.113549.1.2", "bsafeRsaEncr", "Obsolete BSAFE OID",
+    "1.2.840.113549.1.3", "pkcs-3", "",
+    "1.2.840.113549.1.3.1", "dhKeyAgreement", "PKCS #3",
+    "1.2.840.113549.1.5", "pkcs-5", "",
+    "1.2.840.113549.1.5.1", "pbeWithMD2AndDES-CBC", "PKCS #5",
+    "1.2.840.113549.1.5.3", "pbeWithMD5AndDES-CBC", "PKCS #5",
+    "1.2.840.113549.1.5.4", "pbeWithMD2AndRC2-CBC", "PKCS #5",
+    "1.2.840.113549.1.5.6", "pbeWithMD5AndRC2-CBC", "PKCS #5",
+    "1.2.840.113549.1.5.9", "pbeWithMD5AndXOR", "PKCS #5, used in BSAFE only",
+    "1.2.840.113549.1.5.10", "pbeWithSHAAndDES-CBC", "PKCS #5",
+    "1.2.840.113549.1.5.12", "pkcs5PBKDF2", "PKCS #5 v2.0",
+    "1.2.840.113549.1.5.13", "pkcs5PBES2", "PKCS #5 v2.0",
+    "1.2.840.113549.1.5.14", "pkcs5PBMAC1", "PKCS #5 v2.0",
+    "1.2.840.113549.1.7", "pkcs-7", "",
+    "1.2.840.113549.1.7.1", "data", "PKCS #7",
+    "1.2.840.113549.1.7.2", "signedData", "PKCS #7",
+    "1.2.840.113549.1.7.3", "envelopedData", "PKCS #7",
+    "1.2.840.113549.1.7.4", "signedAndEnvelopedData", "PKCS #7",
+    "1.2.840.113549.1.7.5", "digestedData", "PKCS #7",
+    "1.2.840.113549.1.7.6", "encryptedData", "PKCS #7",
+    "1.2.840.113549.1.7.7", "dataWithAttributes", "PKCS #7 experimental",
+    "1.2.840.113549.1.7.8", "encryptedPrivateKeyInfo", "PKCS #7 experimental",
+    "1.2.840.113549.1.9", "pkcs-9", "",
+    "1.2.840.113549.1.9.1", "emailAddress", "PKCS #9. Deprecated, use an altName extension instead",
+    "1.2.840.113549.1.9.2", "unstructuredName", "PKCS #9",
+    "1.2.840.113549.1.9.3", "contentType", "PKCS #9",
+    "1.2.840.113549.1.9.4", "messageDigest", "PKCS #9",
+    "1.2.840.113549.1.9.5", "signingTime", "PKCS #9",
+    "1.2.840.113549.1.9.6", "countersignature", "PKCS #9",
+    "1.2.840.113549.1.9.7", "challengePassword", "PKCS #9",
+    "1.2.840.113549.1.9.8", "unstructuredAddress", "PKCS #9",
+    "1.2.840.113549.1.9.9", "extendedCertificateAttributes", "PKCS #9",
+    "1.2.840.113549.1.9.10", "issuerAndSerialNumber", "PKCS #9 experimental",
+    "1.2.840.113549.1.9.11", "passwordCheck", "PKCS #9 experimental",
+    "1.2.840.113549.1.9.12", "publicKey", "PKCS #9 experimental",
+    "1.2.840.113549.1.9.13", "signingDescription", "PKCS #9",
+    "1.2.840.113549.1.9.14", "extensionRequest", "PKCS #9 via CRMF",
+    "1.2.840.113549.1.9.15", "sMIMECapabilities", "PKCS #9. This OID was formerly assigned as symmetricCapabilities, then reassigned as SMIMECapabilities, then renamed to the current name",
+    "1.2.840.113549.1.9.15.1", "preferSignedData", "sMIMECapabilities",
+    "1.2.840.113549.1.9.15.2", "canNotDecryptAny", "sMIMECapabilities",
+    "1.2.840.113549.1.9.15.3", "receiptRequest", "sMIMECapabilities. Deprecated, use (1 2 840 113549 1 9 16 2 1) instead",
+    "1.2.840.113549.1.9.15.4", "receipt", "sMIMECapabilities. Deprecated, use (1 2 840 113549 1 9 16 1 1) instead",
+    "1.2.840.113549.1.9.15.5", "contentHints", "sMIMECapabilities. Deprecated, use (1 2 840 113549 1 9 16 2 4) instead",
+    "1.2.840.113549.1.9.15.6", "mlExpansionHistory", "sMIMECapabilities. Deprecated, use (1 2 840 113549 1 9 16 2 3) instead",
+    "1.2.840.113549.1.9.16", "id-sMIME", "PKCS #9",
+    "1.2.840.113549.1.9.16.0", "id-mod", "id-sMIME",
+    "1.2.840.113549.1.9.16.0.1", "id-mod-cms", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.2", "id-mod-ess", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.3", "id-mod-oid", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.4", "id-mod-msg-v3", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.5", "id-mod-ets-eSignature-88", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.6", "id-mod-ets-eSignature-97", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.7", "id-mod-ets-eSigPolicy-88", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.0.8", "id-mod-ets-eSigPolicy-88", "S/MIME Modules",
+    "1.2.840.113549.1.9.16.1", "contentType", "S/MIME",
+    "1.2.840.113549.1.9.16.1.1", "receipt", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.2", "authData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.3", "publishCert", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.4", "tSTInfo", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.5", "tDTInfo", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.6", "contentInfo", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.7", "dVCSRequestData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.8", "dVCSResponseData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.9", "compressedData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.10", "scvpCertValRequest", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.11", "scvpCertValResponse", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.12", "scvpValPolRequest", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.13", "scvpValPolResponse", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.14", "attrCertEncAttrs", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.15", "tSReq", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.16", "firmwarePackage", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.17", "firmwareLoadReceipt", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.18", "firmwareLoadError", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.19", "contentCollection", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.20", "contentWithAttrs", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.21", "encKeyWithID", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.22", "encPEPSI", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.23", "authEnvelopedData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.24", "routeOriginAttest", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.25", "symmetricKeyPackage", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.26", "rpkiManifest", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.27", "asciiTextWithCRLF", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.28", "xml", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.29", "pdf", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.30", "postscript", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.31", "timestampedData", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.32", "asAdjacencyAttest", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.33", "rpkiTrustAnchor", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.1.34", "trustAnchorList", "S/MIME Content Types",
+    "1.2.840.113549.1.9.16.2", "authenticatedAttributes", "S/MIME",
+    "1.2.840.113549.1.9.16.2.1", "receiptRequest", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.2", "securityLabel", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.3", "mlExpandHistory", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.4", "contentHint", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.5", "msgSigDigest", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.6", "encapContentType", "S/MIME Authenticated Attributes.  Obsolete",
+    "1.2.840.113549.1.9.16.2.7", "contentIdentifier", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.8", "macValue", "S/MIME Authenticated Attributes.  Obsolete",
+    "1.2.840.113549.1.9.16.2.9", "equivalentLabels", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.10", "contentReference", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.11", "encrypKeyPref", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.12", "signingCertificate", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.13", "smimeEncryptCerts", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.14", "timeStampToken", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.15", "sigPolicyId", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.16", "commitmentType", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.17", "signerLocation", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.18", "signerAttr", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.19", "otherSigCert", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.20", "contentTimestamp", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.21", "certificateRefs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.22", "revocationRefs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.23", "certValues", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.24", "revocationValues", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.25", "escTimeStamp", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.26", "certCRLTimestamp", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.27", "archiveTimeStamp", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.28", "signatureType", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.29", "dvcsDvc", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.30", "cekReference", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.31", "maxCEKDecrypts", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.32", "kekDerivationAlg", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.33", "intendedRecipients", "S/MIME Authenticated Attributes.  Obsolete",
+    "1.2.840.113549.1.9.16.2.34", "cmcUnsignedData", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.35", "fwPackageID", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.36", "fwTargetHardwareIDs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.37", "fwDecryptKeyID", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.38", "fwImplCryptAlgs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.39", "fwWrappedFirmwareKey", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.40", "fwCommunityIdentifiers", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.41", "fwPkgMessageDigest", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.42", "fwPackageInfo", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.43", "fwImplCompressAlgs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.44", "etsAttrCertificateRefs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.45", "etsAttrRevocationRefs", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.46", "binarySigningTime", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.47", "signingCertificateV2", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.48", "etsArchiveTimeStampV2", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.49", "erInternal", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.50", "erExternal", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.2.51", "multipleSignatures", "S/MIME Authenticated Attributes",
+    "1.2.840.113549.1.9.16.3.1", "esDHwith3DES", "S/MIME Algorithms. Obsolete",
+    "1.2.840.113549.1.9.16.3.2", "esDHwithRC2", "S/MIME Algorithms. Obsolete",
+    "1.2.840.113549.1.9.16.3.3", "3desWrap", "S/MIME Algorithms. Obsolete",
+    "1.2.840.113549.1.9.16.3.4", "rc2Wrap", "S/MIME Algorithms. Obsolete",
+    "1.2.840.113549.1.9.16.3.5", "esDH", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.6", "cms3DESwrap", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.7", "cmsRC2wrap", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.8", "zlib", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.9", "pwriKEK", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.10", "ssDH", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.11", "hmacWith3DESwrap", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.12", "hmacWithAESwrap", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.13", "md5XorExperiment", "S/MIME Algorithms.  Experimental",
+    "1.2.840.113549.1.9.16.3.14", "rsaKEM", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.15", "authEnc128", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.16", "authEnc256", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.19", "ecdhHKDF-SHA256", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.20", "ecdhHKDF-SHA384", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.3.21", "ecdhHKDF-SHA512", "S/MIME Algorithms",
+    "1.2.840.113549.1.9.16.4.1", "certDist-ldap", "S/MIME Certificate Distribution",
+    "1.2.840.113549.1.9.16.5.1", "sigPolicyQualifier-spuri x", "S/MIME Signature Policy Qualifiers",
+    "1.2.840.113549.1.9.16.5.2", "sigPolicyQualifier-spUserNotice", "S/MIME Signature Policy Qualifiers",
+    "1.2.840.113549.1.9.16.6.1", "proofOfOrigin", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.6.2", "proofOfReceipt", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.6.3", "proofOfDelivery", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.6.4", "proofOfSender", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.6.5", "proofOfApproval", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.6.6", "proofOfCreation", "S/MIME Commitment Type Identifiers",
+    "1.2.840.113549.1.9.16.8.1", "glUseKEK", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.2", "glDelete", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.3", "glAddMember", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.4", "glDeleteMember", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.5", "glRekey", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.6", "glAddOwner", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.7", "glRemoveOwner", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.8", "glkCompromise", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.9", "glkRefresh", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.10", "glFailInfo", "S/MIME Symmetric Key Distribution Attributes.  Obsolete",
+    "1.2.840.113549.1.9.16.8.11", "glaQueryRequest", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.12", "glaQueryResponse", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.13", "glProvideCert", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.14", "glUpdateCert", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.8.15", "glKey", "S/MIME Symmetric Key Distribution Attributes",
+    "1.2.840.113549.1.9.16.9", "signatureTypeIdentifier", "S/MIME",
+    "1.2.840.113549.1.9.16.9.1", "originatorSig", "S/MIME Signature Type Identifier",
+    "1.2.840.113549.1.9.16.9.2", "domainSig", "S/MIME Signature Type Identifier",
+    "1.2.840.113549.1.9.16.9.3", "additionalAttributesSig", "S/MIME Signature Type Identifier",
+    "1.2.840.113549.1.9.16.9.4", "reviewSig", "S/MIME Signature Type Identifier",
+    "1.2.840.113549.1.9.16.11", "capabilities", "S/MIME",
+    "1.2.840.113549.1.9.16.11.1", "preferBinaryInside", "S/MIME Capability",
+    "1.2.840.113549.1.9.20", "friendlyName (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.21", "localKeyID (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.22", "certTypes (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.22.1", "x509Certificate (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.22.2", "sdsiCertificate (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.23", "crlTypes (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.23.1", "x509Crl (for PKCS #12)", "PKCS #9 via PKCS #12",
+    "1.2.840.113549.1.9.24", "pkcs9objectClass", "PKCS #9/RFC 2985",
+    "1.2.840.113549.1.9.25", "pkcs9attributes", "PKCS #9/RFC 2985",
+    "1.2.840.113549.1.9.25.1", "pkcs15Token", "PKCS #9/RFC 2985 attribute",
+    "1.2.840.113549.1.9.25.2", "encryptedPrivateKeyInfo", "PKCS #9/RFC 2985 attribute",
+    "1.2.840.113549.1.9.25.3", "randomNonce", "PKCS #9/RFC 2985 attribute",
+    "1.2.840.113549.1.9.25.4", "sequenceNumber", "PKCS #9/RFC 2985 attribute",
+    "1.2.840.113549.1.9.25.5", "pkcs7PDU", "PKCS #9/RFC 2985 attribute",
+    "1.2.840.113549.1.9.26", "pkcs9syntax", "PKCS #9/RFC 2985",
+    "1.2.840.113549.1.9.27", "pkcs9matchingRules", "PKCS #9/RFC 2985",
+    "1.2.840.113549.1.9.52", "cmsAlgorithmProtection", "RFC 6211",
+    "1.2.840.113549.1.12", "pkcs-12", "",
+    "1.2.840.113549.1.12.1", "pkcs-12-PbeIds", "This OID was formerly assigned as PKCS #12 modeID",
+    "1.2.840.113549.1.12.1.1", "pbeWithSHAAnd128BitRC4", "PKCS #12 PbeIds. This OID was formerly assigned as pkcs-12-OfflineTransportMode",
+    "1.2.840.113549.1.12.1.2", "pbeWithSHAAnd40BitRC4", "PKCS #12 PbeIds. This OID was formerly assigned as pkcs-12-OnlineTransportMode",
+    "1.2.840.113549.1.12.1.3", "pbeWithSHAAnd3-KeyTripleDES-CBC", "PKCS #12 PbeIds",
+    "1.2.840.113549.1.12.1.4", "pbeWithSHAAnd2-KeyTripleDES-CBC", "PKCS #12 PbeIds",
+    "1.2.840.113549.1.12.1.5", "pbeWithSHAAnd128BitRC2-CBC", "PKCS #12 PbeIds",
+    "1.2.840.113549.1.12.1.6", "pbeWithSHAAnd40BitRC2-CBC", "PKCS #12 PbeIds",
+    "1.2.840.113549.1.12.2", "pkcs-12-ESPVKID", "Deprecated",
+    "1.2.840.113549.1.12.2.1", "pkcs-12-PKCS8KeyShrouding", "PKCS #12 ESPVKID. Deprecated, use (1 2 840 113549 1 12 3 5) instead",
+    "1.2.840.113549.1.12.3", "pkcs-12-BagIds", "",
+    "1.2.840.113549.1.12.3.1", "pkcs-12-keyBagId", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.3.2", "pkcs-12-certAndCRLBagId", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.3.3", "pkcs-12-secretBagId", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.3.4", "pkcs-12-safeContentsId", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.3.5", "pkcs-12-pkcs-8ShroudedKeyBagId", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.4", "pkcs-12-CertBagID", "Deprecated",
+    "1.2.840.113549.1.12.4.1", "pkcs-12-X509CertCRLBagID", "PKCS #12 CertBagID. This OID was formerly assigned as pkcs-12-X509CertCRLBag",
+    "1.2.840.113549.1.12.4.2", "pkcs-12-SDSICertBagID", "PKCS #12 CertBagID. This OID was formerly assigned as pkcs-12-SDSICertBag",
+    "1.2.840.113549.1.12.5", "pkcs-12-OID", "",
+    "1.2.840.113549.1.12.5.1", "pkcs-12-PBEID", "PKCS #12 OID. Deprecated, use the partially compatible (1 2 840 113549 1 12 1) OIDs instead",
+    "1.2.840.113549.1.12.5.1.1", "pkcs-12-PBEWithSha1And128BitRC4", "PKCS #12 OID PBEID. Deprecated, use (1 2 840 113549 1 12 1 1) instead",
+    "1.2.840.113549.1.12.5.1.2", "pkcs-12-PBEWithSha1And40BitRC4", "PKCS #12 OID PBEID. Deprecated, use (1 2 840 113549 1 12 1 2) instead",
+    "1.2.840.113549.1.12.5.1.3", "pkcs-12-PBEWithSha1AndTripleDESCBC", "PKCS #12 OID PBEID. Deprecated, use the incompatible but similar (1 2 840 113549 1 12 1 3) or (1 2 840 113549 1 12 1 4) instead",
+    "1.2.840.113549.1.12.5.1.4", "pkcs-12-PBEWithSha1And128BitRC2CBC", "PKCS #12 OID PBEID. Deprecated, use (1 2 840 113549 1 12 1 5) instead",
+    "1.2.840.113549.1.12.5.1.5", "pkcs-12-PBEWithSha1And40BitRC2CBC", "PKCS #12 OID PBEID. Deprecated, use (1 2 840 113549 1 12 1 6) instead",
+    "1.2.840.113549.1.12.5.1.6", "pkcs-12-PBEWithSha1AndRC4", "PKCS #12 OID PBEID. Deprecated, use the incompatible but similar (1 2 840 113549 1 12 1 1) or (1 2 840 113549 1 12 1 2) instead",
+    "1.2.840.113549.1.12.5.1.7", "pkcs-12-PBEWithSha1AndRC2CBC", "PKCS #12 OID PBEID. Deprecated, use the incompatible but similar (1 2 840 113549 1 12 1 5) or (1 2 840 113549 1 12 1 6) instead",
+    "1.2.840.113549.1.12.5.2", "pkcs-12-EnvelopingID", "PKCS #12 OID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.5.2.1", "pkcs-12-RSAEncryptionWith128BitRC4", "PKCS #12 OID EnvelopingID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.5.2.2", "pkcs-12-RSAEncryptionWith40BitRC4", "PKCS #12 OID EnvelopingID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.5.2.3", "pkcs-12-RSAEncryptionWithTripleDES", "PKCS #12 OID EnvelopingID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.5.3", "pkcs-12-SignatureID", "PKCS #12 OID EnvelopingID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.5.3.1", "pkcs-12-RSASignatureWithSHA1Digest", "PKCS #12 OID SignatureID. Deprecated, use the conventional PKCS #1 OIDs instead",
+    "1.2.840.113549.1.12.10", "pkcs-12Version1", "",
+    "1.2.840.113549.1.12.10.1", "pkcs-12BadIds", "",
+    "1.2.840.113549.1.12.10.1.1", "pkcs-12-keyBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.10.1.2", "pkcs-12-pkcs-8ShroudedKeyBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.10.1.3", "pkcs-12-certBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.10.1.4", "pkcs-12-crlBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.10.1.5", "pkcs-12-secretBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.12.10.1.6", "pkcs-12-safeContentsBag", "PKCS #12 BagIds",
+    "1.2.840.113549.1.15.1", "pkcs15modules", "PKCS #15",
+    "1.2.840.113549.1.15.2", "pkcs15attributes", "PKCS #15",
+    "1.2.840.113549.1.15.3", "pkcs15contentType", "PKCS #15",
+    "1.2.840.113549.1.15.3.1", "pkcs15content", "PKCS #15 content type",
+    "1.2.840.113549.2", "digestAlgorithm", "",
+    "1.2.840.113549.2.2", "md2", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.4", "md4", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.5", "md5", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.7", "hmacWithSHA1", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.8", "hmacWithSHA224", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.9", "hmacWithSHA256", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.10", "hmacWithSHA384", "RSADSI digestAlgorithm",
+    "1.2.840.113549.2.11", "hmacWithSHA512", "RSADSI digestAlgorithm",
+    "1.2.840.113549.3", "encryptionAlgorithm", "",
+    "1.2.840.113549.3.2", "rc2CBC", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.3", "rc2ECB", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.4", "rc4", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.5", "rc4WithMAC", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.6", "desx-CBC", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.7", "des-EDE3-CBC", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.8", "rc5CBC", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.9", "rc5-CBCPad", "RSADSI encryptionAlgorithm",
+    "1.2.840.113549.3.10", "desCDMF", "RSADSI encryptionAlgorithm. Formerly called CDMFCBCPad",
+    "1.2.840.114021.1.6.1", "Identrus unknown policyIdentifier", "Identrus",
+    "1.2.840.114021.4.1", "identrusOCSP", "Identrus",
+    "1.2.840.113556.1.2.241", "deliveryMechanism", "Microsoft Exchange Server - attribute",
+    "1.2.840.113556.1.2.281", "ntSecurityDescriptor", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.3.0", "site-Addressing", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.13", "classSchema", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.14", "attributeSchema", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.17", "mailbox-Agent", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.22", "mailbox", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.23", "container", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.3.46", "mailRecipient", "Microsoft Exchange Server - object class",
+    "1.2.840.113556.1.4.145", "revision", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1327", "pKIDefaultKeySpec", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1328", "pKIKeyUsage", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1329", "pKIMaxIssuingDepth", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1330", "pKICriticalExtensions", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1331", "pKIExpirationPeriod", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1332", "pKIOverlapPeriod", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1333", "pKIExtendedKeyUsage", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1334", "pKIDefaultCSPs", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1335", "pKIEnrollmentAccess", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1429", "msPKI-RA-Signature", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1430", "msPKI-Enrollment-Flag", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1431", "msPKI-Private-Key-Flag", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1432", "msPKI-Certificate-Name-Flag", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1433", "msPKI-Minimal-Key-Size", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1434", "msPKI-Template-Schema-Version", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1435", "msPKI-Template-Minor-Revision", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1436", "msPKI-Cert-Template-OID", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1437", "msPKI-Supersede-Templates", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1438", "msPKI-RA-Policies", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1439", "msPKI-Certificate-Policy", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1674", "msPKI-Certificate-Application-Policy", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.1.4.1675", "msPKI-RA-Application-Policies", "Microsoft Cert Template - attribute",
+    "1.2.840.113556.4.3", "microsoftExcel", "Microsoft",
+    "1.2.840.113556.4.4", "titledWithOID", "Microsoft",
+    "1.2.840.113556.4.5", "microsoftPowerPoint", "Microsoft",
+    "1.2.840.113583.1", "adobeAcrobat", "Adobe Acrobat",
+    "1.2.840.113583.1.1", "acrobatSecurity", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.1", "pdfPassword", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.2", "pdfDefaultSigningCredential", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.3", "pdfDefaultEncryptionCredential", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.4", "pdfPasswordTimeout", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.5", "pdfAuthenticDocumentsTrust", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.6", "pdfDynamicContentTrust", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.7", "pdfUbiquityTrust", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.8", "pdfRevocationInfoArchival", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.9", "pdfX509Extension", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.9.1", "pdfTimeStamp", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.9.2", "pdfArchiveRevInfo", "Adobe Acrobat security",
+    "1.2.840.113583.1.1.10", "pdfPPLKLiteCredential", "Adobe Acrobat security",
+    "1.2.840.113583.1.2", "acrobatCPS", "Adobe Acrobat CPS",
+    "1.2.840.113583.1.2.1", "pdfAuthenticDocumentsCPS", "Adobe Acrobat CPS",
+    "1.2.840.113583.1.2.2", "pdfTestCPS", "Adobe Acrobat CPS",
+    "1.2.840.113583.1.2.3", "pdfUbiquityCPS", "Adobe Acrobat CPS",
+    "1.2.840.113583.1.2.4", "pdfAdhocCPS", "Adobe Acrobat CPS",
+    "1.2.840.113583.1.7", "acrobatUbiquity", "Adobe Acrobat ubiquity",
+    "1.2.840.113583.1.7.1", "pdfUbiquitySubRights", "Adobe Acrobat ubiquity",
+    "1.2.840.113583.1.9", "acrobatExtension", "Adobe Acrobat X.509 extension",
+    "1.2.840.113628.114.1.7", "adobePKCS7", "Adobe",
+    "1.2.840.113635.100", "appleDataSecurity", "Apple",
+    "1.2.840.113635.100.1", "appleTrustPolicy", "Apple",
+    "1.2.840.113635.100.1.1", "appleISignTP", "Apple trust policy",
+    "1.2.840.113635.100.1.2", "appleX509Basic", "Apple trust policy",
+    "1.2.840.113635.100.1.3", "appleSSLPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.4", "appleLocalCertGenPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.5", "appleCSRGenPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.6", "appleCRLPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.7", "appleOCSPPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.8", "appleSMIMEPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.9", "appleEAPPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.10", "appleSWUpdateSigningPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.11", "appleIPSecPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.12", "appleIChatPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.13", "appleResourceSignPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.14", "applePKINITClientPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.15", "applePKINITServerPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.16", "appleCodeSigningPolicy", "Apple trust policy",
+    "1.2.840.113635.100.1.17", "applePackageSigningPolicy", "Apple trust policy",
+    "1.2.840.113635.100.2", "appleSecurityAlgorithm", "Apple",
+    "1.2.840.113635.100.2.1", "appleFEE", "Apple security algorithm",
+    "1.2.840.113635.100.2.2", "appleASC", "Apple security algorithm",
+    "1.2.840.113635.100.2.3", "appleFEE_MD5", "Apple security algorithm",
+    "1.2.840.113635.100.2.4", "appleFEE_SHA1", "Apple security algorithm",
+    "1.2.840.113635.100.2.5", "appleFEED", "Apple security algorithm",
+    "1.2.840.113635.100.2.6", "appleFEEDEXP", "Apple security algorithm",
+    "1.2.840.113635.100.2.7", "appleECDSA", "Apple security algorithm",
+    "1.2.840.113635.100.3", "appleDotMacCertificate", "Apple",
+    "1.2.840.113635.100.3.1", "appleDotMacCertificateRequest", "Apple dotMac certificate",
+    "1.2.840.113635.100.3.2", "appleDotMacCertificateExtension", "Apple dotMac certificate",
+    "1.2.840.113635.100.3.3", "appleDotMacCertificateRequestValues", "Apple dotMac certificate",
+    "1.2.840.113635.100.4", "appleExtendedKeyUsage", "Apple",
+    "1.2.840.113635.100.4.1", "appleCodeSigning", "Apple extended key usage",
+    "1.2.840.113635.100.4.1.1", "appleCodeSigningDevelopment", "Apple extended key usage",
+    "1.2.840.113635.100.4.1.2", "appleSoftwareUpdateSigning", "Apple extended key usage",
+    "1.2.840.113635.100.4.1.3", "appleCodeSigningThirdParty", "Apple extended key usage",
+    "1.2.840.113635.100.4.1.4", "appleResourceSigning", "Apple extended key usage",
+    "1.2.840.113635.100.4.2", "appleIChatSigning", "Apple extended key usage",
+    "1.2.840.113635.100.4.3", "appleIChatEncryption", "Apple extended key usage",
+    "1.2.840.113635.100.4.4", "appleSystemIdentity", "Apple extended key usage",
+    "1.2.840.113635.100.4.5", "appleCryptoEnv", "Apple extended key usage",
+    "1.2.840.113635.100.4.5.1", "appleCryptoProductionEnv", "Apple extended key usage",
+    "1.2.840.113635.100.4.5.2", "appleCryptoMaintenanceEnv", "Apple extended key usage",
+    "1.2.840.113635.100.4.5.3", "appleCryptoTestEnv", "Apple extended key usage",
+    "1.2.840.113635.100.4.5.4", "appleCryptoDevelopmentEnv", "Apple extended key usage",
+    "1.2.840.113635.100.4.6", "appleCryptoQoS", "Apple extended key usage",
+    "1.2.840.113635.100.4.6.1", "appleCryptoTier0QoS", "Apple extended key usage",
+    "1.2.840.113635.100.4.6.2", "appleCryptoTier1QoS", "Apple extended key usage",
+    "1.2.840.113635.100.4.6.3", "appleCryptoTier2QoS", "Apple extended key usage",
+    "1.2.840.113635.100.4.6.4", "appleCryptoTier3QoS", "Apple extended key usage",
+    "1.2.840.113635.100.5", "appleCertificatePolicies", "Apple",
+    "1.2.840.113635.100.5.1", "appleCertificatePolicyID", "Apple",
+    "1.2.840.113635.100.5.2", "appleDotMacCertificatePolicyID", "Apple",
+    "1.2.840.113635.100.5.3", "appleADCCertificatePolicyID", "Apple",
+    "1.2.840.113635.100.6", "appleCertificateExtensions", "Apple",
+    "1.2.840.113635.100.6.1", "appleCertificateExtensionCodeSigning", "Apple certificate extension",
+    "1.2.840.113635.100.6.1.1", "appleCertificateExtensionAppleSigning", "Apple certificate extension",
+    "1.2.840.113635.100.6.1.2", "appleCertificateExtensionADCDeveloperSigning", "Apple certificate extension",
+    "1.2.840.113635.100.6.1.3", "appleCertificateExtensionADCAppleSigning", "Apple certificate extension",
+    "1.3.6.1.4.1.311.2.1.4", "spcIndirectDataContext", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.10", "spcAgencyInfo", "Microsoft code signing. Also known as policyLink",
+    "1.3.6.1.4.1.311.2.1.11", "spcStatementType", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.12", "spcSpOpusInfo", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.14", "certReqExtensions", "Microsoft",
+    "1.3.6.1.4.1.311.2.1.15", "spcPEImageData", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.18", "spcRawFileData", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.19", "spcStructuredStorageData", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.20", "spcJavaClassData (type 1)", "Microsoft code signing. Formerly \"link extension\" aka \"glue extension\"",
+    "1.3.6.1.4.1.311.2.1.21", "individualCodeSigning", "Microsoft",
+    "1.3.6.1.4.1.311.2.1.22", "commercialCodeSigning", "Microsoft",
+    "1.3.6.1.4.1.311.2.1.25", "spcLink (type 2)", "Microsoft code signing. Also known as \"glue extension\"",
+    "1.3.6.1.4.1.311.2.1.26", "spcMinimalCriteriaInfo", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.27", "spcFinancialCriteriaInfo", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.28", "spcLink (type 3)", "Microsoft code signing.  Also known as \"glue extension\"",
+    "1.3.6.1.4.1.311.2.1.29", "spcHashInfoObjID", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.1.30", "spcSipInfoObjID", "Microsoft code signing",
+    "1.3.6.1.4.1.311.2.2", "ctl", "Microsoft CTL",
+    "1.3.6.1.4.1.311.2.2.1", "ctlTrustedCodesigningCAList", "Microsoft CTL",
+    "1.3.6.1.4.1.311.2.2.2", "ctlTrustedClientAuthCAList", "Microsoft CTL",
+    "1.3.6.1.4.1.311.2.2.3", "ctlTrustedServerAuthCAList", "Microsoft CTL",
+    "1.3.6.1.4.1.311.3.2.1", "timestampRequest", "Microsoft code signing",
+    "1.3.6.1.4.1.311.10.1", "certTrustList", "Microsoft contentType",
+    "1.3.6.1.4.1.311.10.1.1", "sortedCtl", "Microsoft contentType",
+    "1.3.6.1.4.1.311.10.2", "nextUpdateLocation", "Microsoft",
+    "1.3.6.1.4.1.311.10.3.1", "certTrustListSigning", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.2", "timeStampSigning", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.3", "serverGatedCrypto", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.3.1", "serialized", "Microsoft",
+    "1.3.6.1.4.1.311.10.3.4", "encryptedFileSystem", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.5", "whqlCrypto", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.6", "nt5Crypto", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.7", "oemWHQLCrypto", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.8", "embeddedNTCrypto", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.9", "rootListSigner", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.10", "qualifiedSubordination", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.11", "keyRecovery", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.12", "documentSigning", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.13", "lifetimeSigning", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.14", "mobileDeviceSoftware", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.15", "smartDisplay", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.16", "cspSignature", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.3.4.1", "efsRecovery", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.4.1", "yesnoTrustAttr", "Microsoft attribute",
+    "1.3.6.1.4.1.311.10.5.1", "drm", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.5.2", "drmIndividualization", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.6.1", "licenses", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.6.2", "licenseServer", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.10.7.1", "keyidRdn", "Microsoft attribute",
+    "1.3.6.1.4.1.311.10.8.1", "removeCertificate", "Microsoft attribute",
+    "1.3.6.1.4.1.311.10.9.1", "crossCertDistPoints", "Microsoft attribute",
+    "1.3.6.1.4.1.311.10.10.1", "cmcAddAttributes", "Microsoft",
+    "1.3.6.1.4.1.311.10.11", "certPropIdPrefix", "Microsoft",
+    "1.3.6.1.4.1.311.10.11.4", "certMd5HashPropId", "Microsoft",
+    "1.3.6.1.4.1.311.10.11.20", "certKeyIdentifierPropId", "Microsoft",
+    "1.3.6.1.4.1.311.10.11.28", "certIssuerSerialNumberMd5HashPropId", "Microsoft",
+    "1.3.6.1.4.1.311.10.11.29", "certSubjectNameMd5HashPropId", "Microsoft",
+    "1.3.6.1.4.1.311.10.12.1", "anyApplicationPolicy", "Microsoft attribute",
+    "1.3.6.1.4.1.311.12", "catalog", "Microsoft attribute",
+    "1.3.6.1.4.1.311.12.1.1", "catalogList", "Microsoft attribute",
+    "1.3.6.1.4.1.311.12.1.2", "catalogListMember", "Microsoft attribute",
+    "1.3.6.1.4.1.311.12.2.1", "catalogNameValueObjID", "Microsoft attribute",
+    "1.3.6.1.4.1.311.12.2.2", "catalogMemberInfoObjID", "Microsoft attribute",
+    "1.3.6.1.4.1.311.13.1", "renewalCertificate", "Microsoft attribute",
+    "1.3.6.1.4.1.311.13.2.1", "enrolmentNameValuePair", "Microsoft attribute",
+    "1.3.6.1.4.1.311.13.2.2", "enrolmentCSP", "Microsoft attribute",
+    "1.3.6.1.4.1.311.13.2.3", "osVersion", "Microsoft attribute",
+    "1.3.6.1.4.1.311.16.4", "microsoftRecipientInfo", "Microsoft attribute",
+    "1.3.6.1.4.1.311.17.1", "pkcs12KeyProviderNameAttr", "Microsoft attribute",
+    "1.3.6.1.4.1.311.17.2", "localMachineKeyset", "Microsoft attribute",
+    "1.3.6.1.4.1.311.17.3", "pkcs12ExtendedAttributes", "Microsoft attribute",
+    "1.3.6.1.4.1.311.20.1", "autoEnrollCtlUsage", "Microsoft",
+    "1.3.6.1.4.1.311.20.2", "enrollCerttypeExtension", "Microsoft CAPICOM certificate template, V1",
+    "1.3.6.1.4.1.311.20.2.1", "enrollmentAgent", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.20.2.2", "smartcardLogon", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.20.2.3", "universalPrincipalName", "Microsoft UPN",
+    "1.3.6.1.4.1.311.20.3", "certManifold", "Microsoft",
+    "1.3.6.1.4.1.311.21.1", "cAKeyCertIndexPair", "Microsoft attribute.  Also known as certsrvCaVersion",
+    "1.3.6.1.4.1.311.21.2", "certSrvPreviousCertHash", "Microsoft",
+    "1.3.6.1.4.1.311.21.3", "crlVirtualBase", "Microsoft",
+    "1.3.6.1.4.1.311.21.4", "crlNextPublish", "Microsoft",
+    "1.3.6.1.4.1.311.21.5", "caExchange", "Microsoft extended key usage",
+    "1.3.6.1.4.1.311.21.6", "keyRecovery", "Microsoft extended key usage",
+    "1.3.6.1.4.1.311.21.7", "certificateTemplate", "Microsoft CAPICOM certificate template, V2",
+    "1.3.6.1.4.1.311.21.9", "rdnDummySigner", "Microsoft",
+    "1.3.6.1.4.1.311.21.10", "applicationCertPolicies", "Microsoft",
+    "1.3.6.1.4.1.311.21.11", "applicationPolicyMappings", "Microsoft",
+    "1.3.6.1.4.1.311.21.12", "applicationPolicyConstraints", "Microsoft",
+    "1.3.6.1.4.1.311.21.13", "archivedKey", "Microsoft attribute",
+    "1.3.6.1.4.1.311.21.14", "crlSelfCDP", "Microsoft",
+    "1.3.6.1.4.1.311.21.15", "requireCertChainPolicy", "Microsoft",
+    "1.3.6.1.4.1.311.21.16", "archivedKeyCertHash", "Microsoft",
+    "1.3.6.1.4.1.311.21.17", "issuedCertHash", "Microsoft",
+    "1.3.6.1.4.1.311.21.19", "dsEmailReplication", "Microsoft",
+    "1.3.6.1.4.1.311.21.20", "requestClientInfo", "Microsoft attribute",
+    "1.3.6.1.4.1.311.21.21", "encryptedKeyHash", "Microsoft attribute",
+    "1.3.6.1.4.1.311.21.22", "certsrvCrossCaVersion", "Microsoft",
+    "1.3.6.1.4.1.311.25.1", "ntdsReplication", "Microsoft",
+    "1.3.6.1.4.1.311.31.1", "productUpdate", "Microsoft attribute",
+    "1.3.6.1.4.1.311.47.1.1", "systemHealth", "Microsoft extended key usage",
+    "1.3.6.1.4.1.311.47.1.3", "systemHealthLoophole", "Microsoft extended key usage",
+    "1.3.6.1.4.1.311.60.1.1", "rootProgramFlags", "Microsoft policy attribute",
+    "1.3.6.1.4.1.311.61.1.1", "kernelModeCodeSigning", "Microsoft enhanced key usage",
+    "1.3.6.1.4.1.311.60.2.1.1", "jurisdictionOfIncorporationL", "Microsoft (?\?\?)",
+    "1.3.6.1.4.1.311.60.2.1.2", "jurisdictionOfIncorporationSP", "Microsoft (?\?\?)",
+    "1.3.6.1.4.1.311.60.2.1.3", "jurisdictionOfIncorporationC", "Microsoft (?\?\?)",
+    "1.3.6.1.4.1.311.88", "capiCom", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.1", "capiComVersion", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.2", "capiComAttribute", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.2.1", "capiComDocumentName", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.2.2", "capiComDocumentDescription", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.3", "capiComEncryptedData", "Microsoft attribute",
+    "1.3.6.1.4.1.311.88.3.1", "capiComEncryptedContent", "Microsoft attribute",
+    "1.3.6.1.4.1.188.7.1.1", "ascom", "Ascom Systech",
+    "1.3.6.1.4.1.188.7.1.1.1", "ideaECB", "Ascom Systech",
+    "1.3.6.1.4.1.188.7.1.1.2", "ideaCBC", "Ascom Systech",
+    "1.3.6.1.4.1.188.7.1.1.3", "ideaCFB", "Ascom Systech",
+    "1.3.6.1.4.1.188.7.1.1.4", "ideaOFB", "Ascom Systech",
+    "1.3.6.1.4.1.2428.10.1.1", "UNINETT policyIdentifier", "UNINETT PCA",
+    "1.3.6.1.4.1.2712.10", "ICE-TEL policyIdentifier", "ICE-TEL CA",
+    "1.3.6.1.4.1.2786.1.1.1", "ICE-TEL Italian policyIdentifier", "ICE-TEL CA policy",
+    "1.3.6.1.4.1.3029.1.1.1", "blowfishECB", "cryptlib encryption algorithm",
+    "1.3.6.1.4.1.3029.1.1.2", "blowfishCBC", "cryptlib encryption algorithm",
+    "1.3.6.1.4.1.3029.1.1.3", "blowfishCFB", "cryptlib encryption algorithm",
+    "1.3.6.1.4.1.3029.1.1.4", "blowfishOFB", "cryptlib encryption algorithm",
+    "1.3.6.1.4.1.3029.1.2.1", "elgamal", "cryptlib public-key algorithm",
+    "1.3.6.1.4.1.3029.1.2.1.1", "elgamalWithSHA-1", "cryptlib public-key algorithm",
+    "1.3.6.1.4.1.3029.1.2.1.2", "elgamalWithRIPEMD-160", "cryptlib public-key algorithm",
+    "1.3.6.1.4.1.3029.3.1.1", "cryptlibPresenceCheck", "cryptlib attribute type",
+    "1.3.6.1.4.1.3029.3.1.2", "pkiBoot", "cryptlib attribute type",
+    "1.3.6.1.4.1.3029.3.1.4", "crlExtReason", "cryptlib attribute type",
+    "1.3.6.1.4.1.3029.3.1.5", "keyFeatures", "cryptlib attribute type",
+    "1.3.6.1.4.1.3029.4.1", "cryptlibContent", "cryptlib",
+    "1.3.6.1.4.1.3029.4.1.1", "cryptlibConfigData", "cryptlib content type",
+    "1.3.6.1.4.1.3029.4.1.2", "cryptlibUserIndex", "cryptlib content type",
+    "1.3.6.1.4.1.3029.4.1.3", "cryptlibUserInfo", "cryptlib content type",
+    "1.3.6.1.4.1.3029.4.1.4", "rtcsRequest", "cryptlib content type",
+    "1.3.6.1.4.1.3029.4.1.5", "rtcsResponse", "cryptlib content type",
+    "1.3.6.1.4.1.3029.4.1.6", "rtcsResponseExt", "cryptlib content type",
+    "1.3.6.1.4.1.3029.42.11172.1", "mpeg-1", "cryptlib special MPEG-of-cat OID",
+    "1.3.6.1.4.1.3029.54.11940.54", "TSA policy \"Anything that arrives, we sign\"", "cryptlib TSA policy",
+    "1.3.6.1.4.1.3029.88.89.90.90.89", "xYZZY policyIdentifier", "cryptlib certificate policy",
+    "1.3.6.1.4.1.3401.8.1.1", "pgpExtension", "PGP key information",
+    "1.3.6.1.4.1.3576.7", "eciaAscX12Edi", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.7.1", "plainEDImessage", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.7.2", "signedEDImessage", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.7.5", "integrityEDImessage", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.7.65", "iaReceiptMessage", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.7.97", "iaStatusMessage", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.8", "eciaEdifact", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.3576.9", "eciaNonEdi", "TMN EDI for Interactive Agents",
+    "1.3.6.1.4.1.4146", "Globalsign", "Globalsign",
+    "1.3.6.1.4.1.4146.1", "globalsignPolicy", "Globalsign",
+    "1.3.6.1.4.1.4146.1.10", "globalsignDVPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.20", "globalsignOVPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.30", "globalsignTSAPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.40", "globalsignClientCertPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.50", "globalsignCodeSignPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.60", "globalsignRootSignPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.70", "globalsignTrustedRootPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.80", "globalsignEDIClientPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.81", "globalsignEDIServerPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.90", "globalsignTPMRootPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.4146.1.95", "globalsignOCSPPolicy", "Globalsign policy",
+    "1.3.6.1.4.1.5309.1", "edelWebPolicy", "EdelWeb policy",
+    "1.3.6.1.4.1.5309.1.2", "edelWebCustomerPolicy", "EdelWeb policy",
+    "1.3.6.1.4.1.5309.1.2.1", "edelWebClepsydrePolicy", "EdelWeb policy",
+    "1.3.6.1.4.1.5309.1.2.2", "edelWebExperimentalTSAPolicy", "EdelWeb policy",
+    "1.3.6.1.4.1.5309.1.2.3", "edelWebOpenEvidenceTSAPolicy", "EdelWeb policy",
+    "1.3.6.1.4.1.5472", "timeproof", "enterprise",
+    "1.3.6.1.4.1.5472.1", "tss", "timeproof",
+    "1.3.6.1.4.1.5472.1.1", "tss80", "timeproof TSS",
+    "1.3.6.1.4.1.5472.1.2", "tss380", "timeproof TSS",
+    "1.3.6.1.4.1.5472.1.3", "tss400", "timeproof TSS",
+    "1.3.6.1.4.1.5770.0.3", "secondaryPractices", "MEDePass",
+    "1.3.6.1.4.1.5770.0.4", "physicianIdentifiers", "MEDePass",
+    "1.3.6.1.4.1.6449.1.2.1.3.1", "comodoPolicy", "Comodo CA",
+    "1.3.6.1.4.1.6449.1.2.2.15", "wotrustPolicy", "WoTrust (Comodo) CA",
+    "1.3.6.1.4.1.6449.1.3.5.2", "comodoCertifiedDeliveryService", "Comodo CA",
+    "1.3.6.1.4.1.6449.2.1.1", "comodoTimestampingPolicy", "Comodo CA",
+    "1.3.6.1.4.1.8301.3.5.1", "validityModelChain", "TU Darmstadt ValidityModel",
+    "1.3.6.1.4.1.8301.3.5.2", "validityModelShell", "ValidityModel",
+    "1.3.6.1.4.1.8231.1", "rolUnicoNacional", "Chilean Government national unique roll number",
+    "1.3.6.1.4.1.11591", "gnu", "GNU Project (see http://www.gnupg.org/oids.html)",
+    "1.3.6.1.4.1.11591.1", "gnuRadius", "GNU Radius",
+    "1.3.6.1.4.1.11591.3", "gnuRadar", "GNU Radar",
+    "1.3.6.1.4.1.11591.12", "gnuDigestAlgorithm", "GNU digest algorithm",
+    "1.3.6.1.4.1.11591.12.2", "tiger", "GNU digest algorithm",
+    "1.3.6.1.4.1.11591.13", "gnuEncryptionAlgorithm", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2", "serpent", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.1", "serpent128_ECB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.2", "serpent128_CBC", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.3", "serpent128_OFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.4", "serpent128_CFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.21", "serpent192_ECB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.22", "serpent192_CBC", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.23", "serpent192_OFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.24", "serpent192_CFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.41", "serpent256_ECB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.42", "serpent256_CBC", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.43", "serpent256_OFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.13.2.44", "serpent256_CFB", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.15.1", "curve25519", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.15.2", "curve448", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.15.3", "curve25519ph", "GNU encryption algorithm",
+    "1.3.6.1.4.1.11591.15.4", "curve448ph", "GNU encryption algorithm",
+    "1.3.6.1.4.1.16334.509.1.1", "Northrop Grumman extKeyUsage?", "Northrop Grumman extended key usage",
+    "1.3.6.1.4.1.16334.509.2.1", "ngcClass1", "Northrop Grumman policy",
+    "1.3.6.1.4.1.16334.509.2.2", "ngcClass2", "Northrop Grumman policy",
+    "1.3.6.1.4.1.16334.509.2.3", "ngcClass3", "Northrop Grumman policy",
+    "1.3.6.1.4.1.23629.1.4.2.1.1", "safenetUsageLimit", "SafeNet",
+    "1.3.6.1.4.1.23629.1.4.2.1.2", "safenetEndDate", "SafeNet",
+    "1.3.6.1.4.1.23629.1.4.2.1.3", "safenetStartDate", "SafeNet",
+    "1.3.6.1.4.1.23629.1.4.2.1.4", "safenetAdminCert", "SafeNet",
+    "1.3.6.1.4.1.23629.1.4.2.2.1", "safenetKeyDigest", "SafeNet",
+    "1.3.6.1.5.5.7", "pkix", "",
+    "1.3.6.1.5.5.7.0.12", "attributeCert", "PKIX",
+    "1.3.6.1.5.5.7.1", "privateExtension", "PKIX",
+    "1.3.6.1.5.5.7.1.1", "authorityInfoAccess", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.2", "biometricInfo", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.3", "qcStatements", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.4", "acAuditIdentity", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.5", "acTargeting", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.6", "acAaControls", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.7", "ipAddrBlocks", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.8", "autonomousSysIds", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.9", "routerIdentifier", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.10", "acProxying", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.11", "subjectInfoAccess", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.12", "logoType", "PKIX private extension",
+    "1.3.6.1.5.5.7.1.13", "wlanSSID", "PKIX private extension",
+    "1.3.6.1.5.5.7.2", "policyQualifierIds", "PKIX",
+    "1.3.6.1.5.5.7.2.1", "cps", "PKIX policy qualifier",
+    "1.3.6.1.5.5.7.2.2", "unotice", "PKIX policy qualifier",
+    "1.3.6.1.5.5.7.2.3", "textNotice", "PKIX policy qualifier",
+    "1.3.6.1.5.5.7.3", "keyPurpose", "PKIX",
+    "1.3.6.1.5.5.7.3.1", "serverAuth", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.2", "clientAuth", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.3", "codeSigning", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.4", "emailProtection", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.5", "ipsecEndSystem", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.6", "ipsecTunnel", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.7", "ipsecUser", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.8", "timeStamping", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.9", "ocspSigning", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.10", "dvcs", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.11", "sbgpCertAAServerAuth", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.13", "eapOverPPP", "PKIX key purpose",
+    "1.3.6.1.5.5.7.3.14", "eapOverLAN", "PKIX key purpose",
+    "1.3.6.1.5.5.7.4", "cmpInformationTypes", "PKIX",
+    "1.3.6.1.5.5.7.4.1", "caProtEncCert", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.2", "signKeyPairTypes", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.3", "encKeyPairTypes", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.4", "preferredSymmAlg", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.5", "caKeyUpdateInfo", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.6", "currentCRL", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.7", "unsupportedOIDs", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.10", "keyPairParamReq", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.11", "keyPairParamRep", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.12", "revPassphrase", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.13", "implicitConfirm", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.14", "confirmWaitTime", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.15", "origPKIMessage", "PKIX CMP information",
+    "1.3.6.1.5.5.7.4.16", "suppLangTags", "PKIX CMP information",
+    "1.3.6.1.5.5.7.5", "crmfRegistration", "PKIX",
+    "1.3.6.1.5.5.7.5.1", "regCtrl", "PKIX CRMF registration",
+    "1.3.6.1.5.5.7.5.1.1", "regToken", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.2", "authenticator", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.3", "pkiPublicationInfo", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.4", "pkiArchiveOptions", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.5", "oldCertID", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.6", "protocolEncrKey", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.7", "altCertTemplate", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.1.8", "wtlsTemplate", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.2", "utf8Pairs", "PKIX CRMF registration",
+    "1.3.6.1.5.5.7.5.2.1", "utf8Pairs", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.5.2.2", "certReq", "PKIX CRMF registration control",
+    "1.3.6.1.5.5.7.6", "algorithms", "PKIX",
+    "1.3.6.1.5.5.7.6.1", "des40", "PKIX algorithm",
+    "1.3.6.1.5.5.7.6.2", "noSignature", "PKIX algorithm",
+    "1.3.6.1.5.5.7.6.3", "dh-sig-hmac-sha1", "PKIX algorithm",
+    "1.3.6.1.5.5.7.6.4", "dh-pop", "PKIX algorithm",
+    "1.3.6.1.5.5.7.7", "cmcControls", "PKIX",
+    "1.3.6.1.5.5.7.8", "otherNames", "PKIX",
+    "1.3.6.1.5.5.7.8.1", "personalData", "PKIX other name",
+    "1.3.6.1.5.5.7.8.2", "userGroup", "PKIX other name",
+    "1.3.6.1.5.5.7.8.5", "xmppAddr", "PKIX other name",
+    "1.3.6.1.5.5.7.9", "personalData", "PKIX qualified certificates",
+    "1.3.6.1.5.5.7.9.1", "dateOfBirth", "PKIX personal data",
+    "1.3.6.1.5.5.7.9.2", "placeOfBirth", "PKIX personal data",
+    "1.3.6.1.5.5.7.9.3", "gender", "PKIX personal data",
+    "1.3.6.1.5.5.7.9.4", "countryOfCitizenship", "PKIX personal data",
+    "1.3.6.1.5.5.7.9.5", "countryOfResidence", "PKIX personal data",
+    "1.3.6.1.5.5.7.10", "attributeCertificate", "PKIX",
+    "1.3.6.1.5.5.7.10.1", "authenticationInfo", "PKIX attribute certificate extension",
+    "1.3.6.1.5.5.7.10.2", "accessIdentity", "PKIX attribute certificate extension",
+    "1.3.6.1.5.5.7.10.3", "chargingIdentity", "PKIX attribute certificate extension",
+    "1.3.6.1.5.5.7.10.4", "group", "PKIX attribute certificate extension",
+    "1.3.6.1.5.5.7.10.5", "role", "PKIX attribute certificate extension",
+    "1.3.6.1.5.5.7.10.6", "wlanSSID", "PKIX attribute-certificate extension",
+    "1.3.6.1.5.5.7.11", "personalData", "PKIX qualified certificates",
+    "1.3.6.1.5.5.7.11.1", "pkixQCSyntax-v1", "PKIX qualified certificates",
+    "1.3.6.1.5.5.7.14.2", "resourceCertificatePolicy", "PKIX policies",
+    "1.3.6.1.5.5.7.20", "logo", "PKIX qualified certificates",
+    "1.3.6.1.5.5.7.20.1", "logoLoyalty", "PKIX",
+    "1.3.6.1.5.5.7.20.2", "logoBackground", "PKIX",
+    "1.3.6.1.5.5.7.48.1", "ocsp", "PKIX",
+    "1.3.6.1.5.5.7.48.1.1", "ocspBasic", "OCSP",
+    "1.3.6.1.5.5.7.48.1.2", "ocspNonce", "OCSP",
+    "1.3.6.1.5.5.7.48.1.3", "ocspCRL", "OCSP",
+    "1.3.6.1.5.5.7.48.1.4", "ocspResponse", "OCSP",
+    "1.3.6.1.5.5.7.48.1.5", "ocspNoCheck", "OCSP",
+    "1.3.6.1.5.5.7.48.1.6", "ocspArchiveCutoff", "OCSP",
+    "1.3.6.1.5.5.7.48.1.7", "ocspServiceLocator", "OCSP",
+    "1.3.6.1.5.5.7.48.2", "caIssuers", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.3", "timeStamping", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.4", "dvcs", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.5", "caRepository", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.7", "signedObjectRepository", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.10", "rpkiManifest", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.7.48.11", "signedObject", "PKIX subject/authority info access descriptor",
+    "1.3.6.1.5.5.8.1.1", "hmacMD5", "ISAKMP HMAC algorithm",
+    "1.3.6.1.5.5.8.1.2", "hmacSHA", "ISAKMP HMAC algorithm",
+    "1.3.6.1.5.5.8.1.3", "hmacTiger", "ISAKMP HMAC algorithm",
+    "1.3.6.1.5.5.8.2.2", "iKEIntermediate", "IKE ?\?\?",
+    "1.3.12.2.1011.7.1", "decEncryptionAlgorithm", "DASS algorithm",
+    "1.3.12.2.1011.7.1.2", "decDEA", "DASS encryption algorithm",
+    "1.3.12.2.1011.7.2", "decHashAlgorithm", "DASS algorithm",
+    "1.3.12.2.1011.7.2.1", "decMD2", "DASS hash algorithm",
+    "1.3.12.2.1011.7.2.2", "decMD4", "DASS hash algorithm",
+    "1.3.12.2.1011.7.3", "decSignatureAlgorithm", "DASS algorithm",
+    "1.3.12.2.1011.7.3.1", "decMD2withRSA", "DASS signature algorithm",
+    "1.3.12.2.1011.7.3.2", "decMD4withRSA", "DASS signature algorithm",
+    "1.3.12.2.1011.7.3.3", "decDEAMAC", "DASS signature algorithm",
+    "1.3.14.2.26.5", "sha", "Unsure about this OID",
+    "1.3.14.3.2.1.1", "rsa", "X.509. Unsure about this OID",
+    "1.3.14.3.2.2", "md4WitRSA", "Oddball OIW OID",
+    "1.3.14.3.2.3", "md5WithRSA", "Oddball OIW OID",
+    "1.3.14.3.2.4", "md4WithRSAEncryption", "Oddball OIW OID",
+    "1.3.14.3.2.2.1", "sqmod-N", "X.509. Deprecated",
+    "1.3.14.3.2.3.1", "sqmod-NwithRSA", "X.509. Deprecated",
+    "1.3.14.3.2.6", "desECB", "",
+    "1.3.14.3.2.7", "desCBC", "",
+    "1.3.14.3.2.8", "desOFB", "",
+    "1.3.14.3.2.9", "desCFB", "",
+    "1.3.14.3.2.10", "desMAC", "",
+    "1.3.14.3.2.11", "rsaSignature", "ISO 9796-2, also X9.31 Part 1",
+    "1.3.14.3.2.12", "dsa", "OIW?, supposedly from an incomplete version of SDN.701 (doesn't match final SDN.701)",
+    "1.3.14.3.2.13", "dsaWithSHA", "Oddball OIW OID.  Incorrectly used by JDK 1.1 in place of (1 3 14 3 2 27)",
+    "1.3.14.3.2.14", "mdc2WithRSASignature", "Oddball OIW OID using 9796-2 padding rules",
+    "1.3.14.3.2.15", "shaWithRSASignature", "Oddball OIW OID using 9796-2 padding rules",
+    "1.3.14.3.2.16", "dhWithCommonModulus", "Oddball OIW OID. Deprecated, use a plain DH OID instead",
+    "1.3.14.3.2.17", "desEDE", "Oddball OIW OID. Mode is ECB",
+    "1.3.14.3.2.18", "sha", "Oddball OIW OID",
+    "1.3.14.3.2.19", "mdc-2", "Oddball OIW OID, DES-based hash, planned for X9.31 Part 2",
+    "1.3.14.3.2.20", "dsaCommon", "Oddball OIW OID.  Deprecated, use a plain DSA OID instead",
+    "1.3.14.3.2.21", "dsaCommonWithSHA", "Oddball OIW OID.  Deprecated, use a plain dsaWithSHA OID instead",
+    "1.3.14.3.2.22", "rsaKeyTransport", "Oddball OIW OID",
+    "1.3.14.3.2.23", "keyed-hash-seal", "Oddball OIW OID",
+    "1.3.14.3.2.24", "md2WithRSASignature", "Oddball OIW OID using 9796-2 padding rules",
+    "1.3.14.3.2.25", "md5WithRSASignature", "Oddball OIW OID using 9796-2 padding rules",
+    "1.3.14.3.2.26", "sha1", "OIW",
+    "1.3.14.3.2.27", "dsaWithSHA1", "OIW. This OID may also be assigned as ripemd-160",
+    "1.3.14.3.2.28", "dsaWithCommonSHA1", "OIW",
+    "1.3.14.3.2.29", "sha-1WithRSAEncryption", "Oddball OIW OID",
+    "1.3.14.3.3.1", "simple-strong-auth-mechanism", "Oddball OIW OID",
+    "1.3.14.7.2.1.1", "ElGamal", "Unsure about this OID",
+    "1.3.14.7.2.3.1", "md2WithRSA", "Unsure about this OID",
+    "1.3.14.7.2.3.2", "md2WithElGamal", "Unsure about this OID",
+    "1.3.36.1", "document", "Teletrust document",
+    "1.3.36.1.1", "finalVersion", "Teletrust document",
+    "1.3.36.1.2", "draft", "Teletrust document",
+    "1.3.36.2", "sio", "Teletrust sio",
+    "1.3.36.2.1", "sedu", "Teletrust sio",
+    "1.3.36.3", "algorithm", "Teletrust algorithm",
+    "1.3.36.3.1", "encryptionAlgorithm", "Teletrust algorithm",
+    "1.3.36.3.1.1", "des", "Teletrust encryption algorithm",
+    "1.3.36.3.1.1.1", "desECB_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.1.1.1", "desECB_ISOpad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.1.2.1", "desCBC_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.1.2.1.1", "desCBC_ISOpad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.3", "des_3", "Teletrust encryption algorithm",
+    "1.3.36.3.1.3.1.1", "des_3ECB_pad", "Teletrust encryption algorithm. EDE triple DES",
+    "1.3.36.3.1.3.1.1.1", "des_3ECB_ISOpad", "Teletrust encryption algorithm. EDE triple DES",
+    "1.3.36.3.1.3.2.1", "des_3CBC_pad", "Teletrust encryption algorithm. EDE triple DES",
+    "1.3.36.3.1.3.2.1.1", "des_3CBC_ISOpad", "Teletrust encryption algorithm. EDE triple DES",
+    "1.3.36.3.1.2", "idea", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.1", "ideaECB", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.1.1", "ideaECB_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.1.1.1", "ideaECB_ISOpad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.2", "ideaCBC", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.2.1", "ideaCBC_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.2.1.1", "ideaCBC_ISOpad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.3", "ideaOFB", "Teletrust encryption algorithm",
+    "1.3.36.3.1.2.4", "ideaCFB", "Teletrust encryption algorithm",
+    "1.3.36.3.1.4", "rsaEncryption", "Teletrust encryption algorithm",
+    "1.3.36.3.1.4.512.17", "rsaEncryptionWithlmod512expe17", "Teletrust encryption algorithm",
+    "1.3.36.3.1.5", "bsi-1", "Teletrust encryption algorithm",
+    "1.3.36.3.1.5.1", "bsi_1ECB_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.5.2", "bsi_1CBC_pad", "Teletrust encryption algorithm",
+    "1.3.36.3.1.5.2.1", "bsi_1CBC_PEMpad", "Teletrust encryption algorithm",
+    "1.3.36.3.2", "hashAlgorithm", "Teletrust algorithm",
+    "1.3.36.3.2.1", "ripemd160", "Teletrust hash algorithm",
+    "1.3.36.3.2.2", "ripemd128", "Teletrust hash algorithm",
+    "1.3.36.3.2.3", "ripemd256", "Teletrust hash algorithm",
+    "1.3.36.3.2.4", "mdc2singleLength", "Teletrust hash algorithm",
+    "1.3.36.3.2.5", "mdc2doubleLength", "Teletrust hash algorithm",
+    "1.3.36.3.3", "signatureAlgorithm", "Teletrust algorithm",
+    "1.3.36.3.3.1", "rsaSignature", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.1", "rsaSignatureWithsha1", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.1.1024.11", "rsaSignatureWithsha1_l1024_l11", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.2", "rsaSignatureWithripemd160", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.2.1024.11", "rsaSignatureWithripemd160_l1024_l11", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.3", "rsaSignatureWithrimpemd128", "Teletrust signature algorithm",
+    "1.3.36.3.3.1.4", "rsaSignatureWithrimpemd256", "Teletrust signature algorithm",
+    "1.3.36.3.3.2", "ecsieSign", "Teletrust signature algorithm",
+    "1.3.36.3.3.2.1", "ecsieSignWithsha1", "Teletrust signature algorithm",
+    "1.3.36.3.3.2.2", "ecsieSignWithripemd160", "Teletrust signature algorithm",
+    "1.3.36.3.3.2.3", "ecsieSignWithmd2", "Teletrust signature algorithm",
+    "1.3.36.3.3.2.4", "ecsieSignWithmd5", "Teletrust signature algorithm",
+    "1.3.36.3.3.2.8.1.1.1", "brainpoolP160r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.2", "brainpoolP160t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.3", "brainpoolP192r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.4", "brainpoolP192t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.5", "brainpoolP224r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.6", "brainpoolP224t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.7", "brainpoolP256r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.8", "brainpoolP256t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.9", "brainpoolP320r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.10", "brainpoolP320t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.11", "brainpoolP384r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.12", "brainpoolP384t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.13", "brainpoolP512r1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.3.2.8.1.1.14", "brainpoolP512t1", "ECC Brainpool Standard Curves and Curve Generation",
+    "1.3.36.3.4", "signatureScheme", "Teletrust algorithm",
+    "1.3.36.3.4.1", "sigS_ISO9796-1", "Teletrust signature scheme",
+    "1.3.36.3.4.2", "sigS_ISO9796-2", "Teletrust signature scheme",
+    "1.3.36.3.4.2.1", "sigS_ISO9796-2Withred", "Teletrust signature scheme. Unsure what this is supposed to be",
+    "1.3.36.3.4.2.2", "sigS_ISO9796-2Withrsa", "Teletrust signature scheme. Unsure what this is supposed to be",
+    "1.3.36.3.4.2.3", "sigS_ISO9796-2Withrnd", "Teletrust signature scheme. 9796-2 with random number in padding field",
+    "1.3.36.4", "attribute", "Teletrust attribute",
+    "1.3.36.5", "policy", "Teletrust policy",
+    "1.3.36.6", "api", "Teletrust API",
+    "1.3.36.6.1", "manufacturer-specific_api", "Teletrust API",
+    "1.3.36.6.1.1", "utimaco-api", "Teletrust API",
+    "1.3.36.6.2", "functionality-specific_api", "Teletrust API",
+    "1.3.36.7", "keymgmnt", "Teletrust key management",
+    "1.3.36.7.1", "keyagree", "Teletrust key management",
+    "1.3.36.7.1.1", "bsiPKE", "Teletrust key management",
+    "1.3.36.7.2", "keytrans", "Teletrust key management",
+    "1.3.36.7.2.1", "encISO9796-2Withrsa", "Teletrust key management. 9796-2 with key stored in hash field",
+    "1.3.36.8.1.1", "Teletrust SigGConform policyIdentifier", "Teletrust policy",
+    "1.3.36.8.2.1", "directoryService", "Teletrust extended key usage",
+    "1.3.36.8.3.1", "dateOfCertGen", "Teletrust attribute",
+    "1.3.36.8.3.2", "procuration", "Teletrust attribute",
+    "1.3.36.8.3.3", "admission", "Teletrust attribute",
+    "1.3.36.8.3.4", "monetaryLimit", "Teletrust attribute",
+    "1.3.36.8.3.5", "declarationOfMajority", "Teletrust attribute",
+    "1.3.36.8.3.6", "integratedCircuitCardSerialNumber", "Teletrust attribute",
+    "1.3.36.8.3.7", "pKReference", "Teletrust attribute",
+    "1.3.36.8.3.8", "restriction", "Teletrust attribute",
+    "1.3.36.8.3.9", "retrieveIfAllowed", "Teletrust attribute",
+    "1.3.36.8.3.10", "requestedCertificate", "Teletrust attribute",
+    "1.3.36.8.3.11", "namingAuthorities", "Teletrust attribute",
+    "1.3.36.8.3.11.1", "rechtWirtschaftSteuern", "Teletrust naming authorities",
+    "1.3.36.8.3.11.1.1", "rechtsanwaeltin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.2", "rechtsanwalt", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.3", "rechtsBeistand", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.4", "steuerBeraterin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.5", "steuerBerater", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.6", "steuerBevollmaechtigte", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.7", "steuerBevollmaechtigter", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.8", "notarin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.9", "notar", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.10", "notarVertreterin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.11", "notarVertreter", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.12", "notariatsVerwalterin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.13", "notariatsVerwalter", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.14", "wirtschaftsPrueferin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.15", "wirtschaftsPruefer", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.16", "vereidigteBuchprueferin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.17", "vereidigterBuchpruefer", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.18", "patentAnwaeltin", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.11.1.19", "patentAnwalt", "Teletrust ProfessionInfo",
+    "1.3.36.8.3.12", "certInDirSince", "Teletrust OCSP attribute (obsolete)",
+    "1.3.36.8.3.13", "certHash", "Teletrust OCSP attribute",
+    "1.3.36.8.3.14", "nameAtBirth", "Teletrust attribute",
+    "1.3.36.8.3.15", "additionalInformation", "Teletrust attribute",
+    "1.3.36.8.4.1", "personalData", "Teletrust OtherName attribute",
+    "1.3.36.8.4.8", "restriction", "Teletrust attribute certificate attribute",
+    "1.3.36.8.5.1.1.1", "rsaIndicateSHA1", "Teletrust signature algorithm",
+    "1.3.36.8.5.1.1.2", "rsaIndicateRIPEMD160", "Teletrust signature algorithm",
+    "1.3.36.8.5.1.1.3", "rsaWithSHA1", "Teletrust signature algorithm",
+    "1.3.36.8.5.1.1.4", "rsaWithRIPEMD160", "Teletrust signature algorithm",
+    "1.3.36.8.5.1.2.1", "dsaExtended", "Teletrust signature algorithm",
+    "1.3.36.8.5.1.2.2", "dsaWithRIPEMD160", "Teletrust signature algorithm",
+    "1.3.36.8.6.1", "cert", "Teletrust signature attributes",
+    "1.3.36.8.6.2", "certRef", "Teletrust signature attributes",
+    "1.3.36.8.6.3", "attrCert", "Teletrust signature attributes",
+    "1.3.36.8.6.4", "attrRef", "Teletrust signature attributes",
+    "1.3.36.8.6.5", "fileName", "Teletrust signature attributes",
+    "1.3.36.8.6.6", "storageTime", "Teletrust signature attributes",
+    "1.3.36.8.6.7", "fileSize", "Teletrust signature attributes",
+    "1.3.36.8.6.8", "location", "Teletrust signature attributes",
+    "1.3.36.8.6.9", "sigNumber", "Teletrust signature attributes",
+    "1.3.36.8.6.10", "autoGen", "Teletrust signature attributes",
+    "1.3.36.8.7.1.1", "ptAdobeILL", "Teletrust presentation types",
+    "1.3.36.8.7.1.2", "ptAmiPro", "Teletrust presentation types",
+    "1.3.36.8.7.1.3", "ptAutoCAD", "Teletrust presentation types",
+    "1.3.36.8.7.1.4", "ptBinary", "Teletrust presentation types",
+    "1.3.36.8.7.1.5", "ptBMP", "Teletrust presentation types",
+    "1.3.36.8.7.1.6", "ptCGM", "Teletrust presentation types",
+    "1.3.36.8.7.1.7", "ptCorelCRT", "Teletrust presentation types",
+    "1.3.36.8.7.1.8", "ptCorelDRW", "Teletrust presentation types",
+    "1.3.36.8.7.1.9", "ptCorelEXC", "Teletrust presentation types",
+    "1.3.36.8.7.1.10", "ptCorelPHT", "Teletrust presentation types",
+    "1.3.36.8.7.1.11", "ptDraw", "Teletrust presentation types",
+    "1.3.36.8.7.1.12", "ptDVI", "Teletrust presentation types",
+    "1.3.36.8.7.1.13", "ptEPS", "Teletrust presentation types",
+    "1.3.36.8.7.1.14", "ptExcel", "Teletrust presentation types",
+    "1.3.36.8.7.1.15", "ptGEM", "Teletrust presentation types",
+    "1.3.36.8.7.1.16", "ptGIF", "Teletrust presentation types",
+    "1.3.36.8.7.1.17", "ptHPGL", "Teletrust presentation types",
+    "1.3.36.8.7.1.18", "ptJPEG", "Teletrust presentation types",
+    "1.3.36.8.7.1.19", "ptKodak", "Teletrust presentation types",
+    "1.3.36.8.7.1.20", "ptLaTeX", "Teletrust presentation types",
+    "1.3.36.8.7.1.21", "ptLotus", "Teletrust presentation types",
+    "1.3.36.8.7.1.22", "ptLotusPIC", "Teletrust presentation types",
+    "1.3.36.8.7.1.23", "ptMacPICT", "Teletrust presentation types",
+    "1.3.36.8.7.1.24", "ptMacWord", "Teletrust presentation types",
+    "1.3.36.8.7.1.25", "ptMSWfD", "Teletrust presentation types",
+    "1.3.36.8.7.1.26", "ptMSWord", "Teletrust presentation types",
+    "1.3.36.8.7.1.27", "ptMSWord2", "Teletrust presentation types",
+    "1.3.36.8.7.1.28", "ptMSWord6", "Teletrust presentation types",
+    "1.3.36.8.7.1.29", "ptMSWord8", "Teletrust presentation types",
+    "1.3.36.8.7.1.30", "ptPDF", "Teletrust presentation types",
+    "1.3.36.8.7.1.31", "ptPIF", "Teletrust presentation types",
+    "1.3.36.8.7.1.32", "ptPostscript", "Teletrust presentation types",
+    "1.3.36.8.7.1.33", "ptRTF", "Teletrust presentation types",
+    "1.3.36.8.7.1.34", "ptSCITEX", "Teletrust presentation types",
+    "1.3.36.8.7.1.35", "ptTAR", "Teletrust presentation types",
+    "1.3.36.8.7.1.36", "ptTarga", "Teletrust presentation types",
+    "1.3.36.8.7.1.37", "ptTeX", "Teletrust presentation types",
+    "1.3.36.8.7.1.38", "ptText", "Teletrust presentation types",
+    "1.3.36.8.7.1.39", "ptTIFF", "Teletrust presentation types",
+    "1.3.36.8.7.1.40", "ptTIFF-FC", "Teletrust presentation types",
+    "1.3.36.8.7.1.41", "ptUID", "Teletrust presentation types",
+    "1.3.36.8.7.1.42", "ptUUEncode", "Teletrust presentation types",
+    "1.3.36.8.7.1.43", "ptWMF", "Teletrust presentation types",
+    "1.3.36.8.7.1.44", "ptWordPerfect", "Teletrust presentation types",
+    "1.3.36.8.7.1.45", "ptWPGrph", "Teletrust presentation types",
+    "1.3.101.1.4", "thawte-ce", "Thawte",
+    "1.3.101.1.4.1", "strongExtranet", "Thawte certificate extension",
+    "1.3.101.110", "curveX25519", "ECDH 25519 key agreement algorithm",
+    "1.3.101.111", "curveX448", "ECDH 448 key agreement algorithm",
+    "1.3.101.112", "curveEd25519", "EdDSA 25519 signature algorithm",
+    "1.3.101.113", "curveEd448", "EdDSA 448 signature algorithm",
+    "1.3.101.114", "curveEd25519ph", "EdDSA 25519 pre-hash signature algorithm",
+    "1.3.101.115", "curveEd448ph", "EdDSA 448 pre-hash signature algorithm",
+    "1.3.132.0.1", "sect163k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.2", "sect163r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.3", "sect239k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.4", "sect113r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.5", "sect113r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.6", "secp112r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.7", "secp112r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.8", "secp160r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.9", "secp160k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.10", "secp256k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.15", "sect163r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.16", "sect283k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.17", "sect283r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.22", "sect131r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.23", "sect131r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.24", "sect193r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.25", "sect193r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.26", "sect233k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.27", "sect233r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.28", "secp128r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.29", "secp128r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.30", "secp160r2", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.31", "secp192k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.32", "secp224k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.33", "secp224r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.34", "secp384r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.35", "secp521r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.36", "sect409k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.37", "sect409r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.38", "sect571k1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.0.39", "sect571r1", "SECG (Certicom) named elliptic curve",
+    "1.3.132.1.11.1", "ecdhX963KDF-SHA256", "SECG (Certicom) elliptic curve key agreement",
+    "1.3.132.1.11.2", "ecdhX963KDF-SHA384", "SECG (Certicom) elliptic curve key agreement",
+    "1.3.132.1.11.3", "ecdhX963KDF-SHA512", "SECG (Certicom) elliptic curve key agreement",
+    "1.3.133.16.840.9.84", "x984", "X9.84",
+    "1.3.133.16.840.9.84.0", "x984Module", "X9.84",
+    "1.3.133.16.840.9.84.0.1", "x984Biometrics", "X9.84 Module",
+    "1.3.133.16.840.9.84.0.2", "x984CMS", "X9.84 Module",
+    "1.3.133.16.840.9.84.0.3", "x984Identifiers", "X9.84 Module",
+    "1.3.133.16.840.9.84.1", "x984Biometric", "X9.84",
+    "1.3.133.16.840.9.84.1.0", "biometricUnknownType", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.1", "biometricBodyOdor", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.2", "biometricDNA", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.3", "biometricEarShape", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.4", "biometricFacialFeatures", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.5", "biometricFingerImage", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.6", "biometricFingerGeometry", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.7", "biometricHandGeometry", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.8", "biometricIrisFeatures", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.9", "biometricKeystrokeDynamics", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.10", "biometricPalm", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.11", "biometricRetina", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.12", "biometricSignature", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.13", "biometricSpeechPattern", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.14", "biometricThermalImage", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.15", "biometricVeinPattern", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.16", "biometricThermalFaceImage", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.17", "biometricThermalHandImage", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.18", "biometricLipMovement", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.1.19", "biometricGait", "X9.84 Biometric",
+    "1.3.133.16.840.9.84.3", "x984MatchingMethod", "X9.84",
+    "1.3.133.16.840.9.84.4", "x984FormatOwner", "X9.84",
+    "1.3.133.16.840.9.84.4.0", "x984CbeffOwner", "X9.84 Format Owner",
+    "1.3.133.16.840.9.84.4.1", "x984IbiaOwner", "X9.84 Format Owner",
+    "1.3.133.16.840.9.84.4.1.1", "ibiaOwnerSAFLINK", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.2", "ibiaOwnerBioscrypt", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.3", "ibiaOwnerVisionics", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.4", "ibiaOwnerInfineonTechnologiesAG", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.5", "ibiaOwnerIridianTechnologies", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.6", "ibiaOwnerVeridicom", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.7", "ibiaOwnerCyberSIGN", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.8", "ibiaOwnereCryp", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.9", "ibiaOwnerFingerprintCardsAB", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.10", "ibiaOwnerSecuGen", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.11", "ibiaOwnerPreciseBiometric", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.12", "ibiaOwnerIdentix", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.13", "ibiaOwnerDERMALOG", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.14", "ibiaOwnerLOGICO", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.15", "ibiaOwnerNIST", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.16", "ibiaOwnerA3Vision", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.17", "ibiaOwnerNEC", "X9.84 IBIA Format Owner",
+    "1.3.133.16.840.9.84.4.1.18", "ibiaOwnerSTMicroelectronics", "X9.84 IBIA Format Owner",
+    "2.5.4.0", "objectClass", "X.520 DN component",
+    "2.5.4.1", "aliasedEntryName", "X.520 DN component",
+    "2.5.4.2", "knowledgeInformation", "X.520 DN component",
+    "2.5.4.3", "commonName", "X.520 DN component",
+    "2.5.4.4", "surname", "X.520 DN component",
+    "2.5.4.5", "serialNumber", "X.520 DN component",
+    "2.5.4.6", "countryName", "X.520 DN component",
+    "2.5.4.7", "localityName", "X.520 DN component",
+    "2.5.4.7.1", "collectiveLocalityName", "X.520 DN component",
+    "2.5.4.8", "stateOrProvinceName", "X.520 DN component",
+    "2.5.4.8.1", "collectiveStateOrProvinceName", "X.520 DN component",
+    "2.5.4.9", "streetAddress", "X.520 DN component",
+    "2.5.4.9.1", "collectiveStreetAddress", "X.520 DN component",
+    "2.5.4.10", "organizationName", "X.520 DN component",
+    "2.5.4.10.1", "collectiveOrganizationName", "X.520 DN component",
+    "2.5.4.11", "organizationalUnitName", "X.520 DN component",
+    "2.5.4.11.1", "collectiveOrganizationalUnitName", "X.520 DN component",
+    "2.5.4.12", "title", "X.520 DN component",
+    "2.5.4.13", "description", "X.520 DN component",
+    "2.5.4.14", "searchGuide", "X.520 DN component",
+    "2.5.4.15", "businessCategory", "X.520 DN component",
+    "2.5.4.16", "postalAddress", "X.520 DN component",
+    "2.5.4.16.1", "collectivePostalAddress", "X.520 DN component",
+    "2.5.4.17", "postalCode", "X.520 DN component",
+    "2.5.4.17.1", "collectivePostalCode", "X.520 DN component",
+    "2.5.4.18", "postOfficeBox", "X.520 DN component",
+    "2.5.4.18.1", "collectivePostOfficeBox", "X.520 DN component",
+    "2.5.4.19", "physicalDeliveryOfficeName", "X.520 DN component",
+    "2.5.4.19.1", "collectivePhysicalDeliveryOfficeName", "X.520 DN component",
+    "2.5.4.20", "telephoneNumber", "X.520 DN component",
+    "2.5.4.20.1", "collectiveTelephoneNumber", "X.520 DN component",
+    "2.5.4.21", "telexNumber", "X.520 DN component",
+    "2.5.4.21.1", "collectiveTelexNumber", "X.520 DN component",
+    "2.5.4.22", "teletexTerminalIdentifier", "X.520 DN component",
+    "2.5.4.22.1", "collectiveTeletexTerminalIdentifier", "X.520 DN component",
+    "2.5.4.23", "facsimileTelephoneNumber", "X.520 DN component",
+    "2.5.4.23.1", "collectiveFacsimileTelephoneNumber", "X.520 DN component",
+    "2.5.4.24", "x121Address", "X.520 DN component",
+    "2.5.4.25", "internationalISDNNumber", "X.520 DN component",
+    "2.5.4.25.1", "collectiveInternationalISDNNumber", "X.520 DN component",
+    "2.5.4.26", "registeredAddress", "X.520 DN component",
+    "2.5.4.27", "destinationIndicator", "X.520 DN component",
+    "2.5.4.28", "preferredDeliveryMehtod", "X.520 DN component",
+    "2.5.4.29", "presentationAddress", "X.520 DN component",
+    "2.5.4.30", "supportedApplicationContext", "X.520 DN component",
+    "2.5.4.31", "member", "X.520 DN component",
+    "2.5.4.32", "owner", "X.520 DN component",
+    "2.5.4.33", "roleOccupant", "X.520 DN component",
+    "2.5.4.34", "seeAlso", "X.520 DN component",
+    "2.5.4.35", "userPassword", "X.520 DN component",
+    "2.5.4.36", "userCertificate", "X.520 DN component",
+    "2.5.4.37", "caCertificate", "X.520 DN component",
+    "2.5.4.38", "authorityRevocationList", "X.520 DN component",
+    "2.5.4.39", "certificateRevocationList", "X.520 DN component",
+    "2.5.4.40", "crossCertificatePair", "X.520 DN component",
+    "2.5.4.41", "name", "X.520 DN component",
+    "2.5.4.42", "givenName", "X.520 DN component",
+    "2.5.4.43", "initials", "X.520 DN component",
+    "2.5.4.44", "generationQualifier", "X.520 DN component",
+    "2.5.4.45", "uniqueIdentifier", "X.520 DN component",
+    "2.5.4.46", "dnQualifier", "X.520 DN component",
+    "2.5.4.47", "enhancedSearchGuide", "X.520 DN component",
+    "2.5.4.48", "protocolInformation", "X.520 DN component",
+    "2.5.4.49", "distinguishedName", "X.520 DN component",
+    "2.5.4.50", "uniqueMember", "X.520 DN component",
+    "2.5.4.51", "houseIdentifier", "X.520 DN component",
+    "2.5.4.52", "supportedAlgorithms", "X.520 DN component",
+    "2.5.4.53", "deltaRevocationList", "X.520 DN component",
+    "2.5.4.54", "dmdName", "X.520 DN component",
+    "2.5.4.55", "clearance", "X.520 DN component",
+    "2.5.4.56", "defaultDirQop", "X.520 DN component",
+    "2.5.4.57", "attributeIntegrityInfo", "X.520 DN component",
+    "2.5.4.58", "attributeCertificate", "X.520 DN component",
+    "2.5.4.59", "attributeCertificateRevocationList", "X.520 DN component",
+    "2.5.4.60", "confKeyInfo", "X.520 DN component",
+    "2.5.4.61", "aACertificate", "X.520 DN component",
+    "2.5.4.62", "attributeDescriptorCertificate", "X.520 DN component",
+    "2.5.4.63", "attributeAuthorityRevocationList", "X.520 DN component",
+    "2.5.4.64", "familyInformation", "X.520 DN component",
+    "2.5.4.65", "pseudonym", "X.520 DN component",
+    "2.5.4.66", "communicationsService", "X.520 DN component",
+    "2.5.4.67", "communicationsNetwork", "X.520 DN component",
+    "2.5.4.68", "certificationPracticeStmt", "X.520 DN component",
+    "2.5.4.69", "certificatePolicy", "X.520 DN component",
+    "2.5.4.70", "pkiPath", "X.520 DN component",
+    "2.5.4.71", "privPolicy", "X.520 DN component",
+    "2.5.4.72", "role", "X.520 DN component",
+    "2.5.4.73", "delegationPath", "X.520 DN component",
+    "2.5.4.74", "protPrivPolicy", "X.520 DN component",
+    "2.5.4.75", "xMLPrivilegeInfo", "X.520 DN component",
+    "2.5.4.76", "xmlPrivPolicy", "X.520 DN component",
+    "2.5.4.82", "permission", "X.520 DN component",
+    "2.5.6.0", "top", "X.520 objectClass",
+    "2.5.6.1", "alias", "X.520 objectClass",
+    "2.5.6.2", "country", "X.520 objectClass",
+    "2.5.6.3", "locality", "X.520 objectClass",
+    "2.5.6.4", "organization", "X.520 objectClass",
+    "2.5.6.5", "organizationalUnit", "X.520 objectClass",
+    "2.5.6.6", "person", "X.520 objectClass",
+    "2.5.6.7", "organizationalPerson", "X.520 objectClass",
+    "2.5.6.8", "organizationalRole", "X.520 objectClass",
+    "2.5.6.9", "groupOfNames", "X.520 objectClass",
+    "2.5.6.10", "residentialPerson", "X.520 objectClass",
+    "2.5.6.11", "applicationProcess", "X.520 objectClass",
+    "2.5.6.12", "applicationEntity", "X.520 objectClass",
+    "2.5.6.13", "dSA", "X.520 objectClass",
+    "2.5.6.14", "device", "X.520 objectClass",
+    "2.5.6.15", "strongAuthenticationUser", "X.520 objectClass",
+    "2.5.6.16", "certificateAuthority", "X.520 objectClass",
+    "2.5.6.17", "groupOfUniqueNames", "X.520 objectClass",
+    "2.5.6.21", "pkiUser", "X.520 objectClass",
+    "2.5.6.22", "pkiCA", "X.520 objectClass",
+    "2.5.8.1.1", "rsa", "X.500 algorithms.  Ambiguous, since no padding rules specified",
+    "2.5.29.1", "authorityKeyIdentifier", "X.509 extension.  Deprecated, use 2 5 29 35 instead",
+    "2.5.29.2", "keyAttributes", "X.509 extension.  Obsolete, use keyUsage/extKeyUsage instead",
+    "2.5.29.3", "certificatePolicies", "X.509 extension.  Deprecated, use 2 5 29 32 instead",
+    "2.5.29.4", "keyUsageRestriction", "X.509 extension.  Obsolete, use keyUsage/extKeyUsage instead",
+    "2.5.29.5", "policyMapping", "X.509 extension.  Deprecated, use 2 5 29 33 instead",
+    "2.5.29.6", "subtreesConstraint", "X.509 extension.  Obsolete, use nameConstraints instead",
+    "2.5.29.7", "subjectAltName", "X.509 extension.  Deprecated, use 2 5 29 17 instead",
+    "2.5.29.8", "issuerAltName", "X.509 extension.  Deprecated, use 2 5 29 18 instead",
+    "2.5.29.9", "subjectDirectoryAttributes", "X.509 extension",
+    "2.5.29.10", "basicConstraints", "X.509 extension.  Deprecated, use 2 5 29 19 instead",
+    "2.5.29.11", "nameConstraints", "X.509 extension.  Deprecated, use 2 5 29 30 instead",
+    "2.5.29.12", "policyConstraints", "X.509 extension.  Deprecated, use 2 5 29 36 instead",
+    "2.5.29.13", "basicConstraints", "X.509 extension.  Deprecated, use 2 5 29 19 instead",
+    "2.5.29.14", "subjectKeyIdentifier", "X.509 extension",
+    "2.5.29.15", "keyUsage", "X.509 extension",
+    "2.5.29.16", "privateKeyUsagePeriod", "X.509 extension",
+    "2.5.29.17", "subjectAltName", "X.509 extension",
+    "2.5.29.18", "issuerAltName", "X.509 extension",
+    "2.5.29.19", "basicConstraints", "X.509 extension",
+    "2.5.29.20", "cRLNumber", "X.509 extension",
+    "2.5.29.21", "cRLReason", "X.509 extension",
+    "2.5.29.22", "expirationDate", "X.509 extension.  Deprecated, alternative OID uncertain",
+    "2.5.29.23", "instructionCode", "X.509 extension",
+    "2.5.29.24", "invalidityDate", "X.509 extension",
+    "2.5.29.25", "cRLDistributionPoints", "X.509 extension.  Deprecated, use 2 5 29 31 instead",
+    "2.5.29.26", "issuingDistributionPoint", "X.509 extension.  Deprecated, use 2 5 29 28 instead",
+    "2.5.29.27", "deltaCRLIndicator", "X.509 extension",
+    "2.5.29.28", "issuingDistributionPoint", "X.509 extension",
+    "2.5.29.29", "certificateIssuer", "X.509 extension",
+    "2.5.29.30", "nameConstraints", "X.509 extension",
+    "2.5.29.31", "cRLDistributionPoints", "X.509 extension",
+    "2.5.29.32", "certificatePolicies", "X.509 extension",
+    "2.5.29.32.0", "anyPolicy", "X.509 certificate policy",
+    "2.5.29.33", "policyMappings", "X.509 extension",
+    "2.5.29.34", "policyConstraints", "X.509 extension.  Deprecated, use 2 5 29 36 instead",
+    "2.5.29.35", "authorityKeyIdentifier", "X.509 extension",
+    "2.5.29.36", "policyConstraints", "X.509 extension",
+    "2.5.29.37", "extKeyUsage", "X.509 extension",
+    "2.5.29.37.0", "anyExtendedKeyUsage", "X.509 extended key usage",
+    "2.5.29.38", "authorityAttributeIdentifier", "X.509 extension",
+    "2.5.29.39", "roleSpecCertIdentifier", "X.509 extension",
+    "2.5.29.40", "cRLStreamIdentifier", "X.509 extension",
+    "2.5.29.41", "basicAttConstraints", "X.509 extension",
+    "2.5.29.42", "delegatedNameConstraints", "X.509 extension",
+    "2.5.29.43", "timeSpecification", "X.509 extension",
+    "2.5.29.44", "cRLScope", "X.509 extension",
+    "2.5.29.45", "statusReferrals", "X.509 extension",
+    "2.5.29.46", "freshestCRL", "X.509 extension",
+    "2.5.29.47", "orderedList", "X.509 extension",
+    "2.5.29.48", "attributeDescriptor", "X.509 extension",
+    "2.5.29.49", "userNotice", "X.509 extension",
+    "2.5.29.50", "sOAIdentifier", "X.509 extension",
+    "2.5.29.51", "baseUpdateTime", "X.509 extension",
+    "2.5.29.52", "acceptableCertPolicies", "X.509 extension",
+    "2.5.29.53", "deltaInfo", "X.509 extension",
+    "2.5.29.54", "inhibitAnyPolicy", "X.509 extension",
+    "2.5.29.55", "targetInformation", "X.509 extension",
+    "2.5.29.56", "noRevAvail", "X.509 extension",
+    "2.5.29.57", "acceptablePrivilegePolicies", "X.509 extension",
+    "2.5.29.58", "toBeRevoked", "X.509 extension",
+    "2.5.29.59", "revokedGroups", "X.509 extension",
+    "2.5.29.60", "expiredCertsOnCRL", "X.509 extension",
+    "2.5.29.61", "indirectIssuer", "X.509 extension",
+    "2.5.29.62", "noAssertion", "X.509 extension",
+    "2.5.29.63", "aAissuingDistributionPoint", "X.509 extension",
+    "2.5.29.64", "issuedOnBehalfOf", "X.509 extension",
+    "2.5.29.65", "singleUse", "X.509 extension",
+    "2.5.29.66", "groupAC", "X.509 extension",
+    "2.5.29.67", "allowedAttAss", "X.509 extension",
+    "2.5.29.68", "attributeMappings", "X.509 extension",
+    "2.5.29.69", "holderNameConstraints", "X.509 extension",
+    "2.16.724.1.2.2.4.1", "personalDataInfo", "Spanish Government PKI?",
+    "2.16.840.1.101.2.1.1.1", "sdnsSignatureAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.2", "fortezzaSignatureAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicSignatureAlgorithm, this OID is better known as dsaWithSHA-1.",
+    "2.16.840.1.101.2.1.1.3", "sdnsConfidentialityAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.4", "fortezzaConfidentialityAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicConfidentialityAlgorithm",
+    "2.16.840.1.101.2.1.1.5", "sdnsIntegrityAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.6", "fortezzaIntegrityAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicIntegrityAlgorithm",
+    "2.16.840.1.101.2.1.1.7", "sdnsTokenProtectionAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.8", "fortezzaTokenProtectionAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly know as mosaicTokenProtectionAlgorithm",
+    "2.16.840.1.101.2.1.1.9", "sdnsKeyManagementAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.10", "fortezzaKeyManagementAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicKeyManagementAlgorithm",
+    "2.16.840.1.101.2.1.1.11", "sdnsKMandSigAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.12", "fortezzaKMandSigAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicKMandSigAlgorithm",
+    "2.16.840.1.101.2.1.1.13", "suiteASignatureAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.14", "suiteAConfidentialityAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.15", "suiteAIntegrityAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.16", "suiteATokenProtectionAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.17", "suiteAKeyManagementAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.18", "suiteAKMandSigAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.19", "fortezzaUpdatedSigAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicUpdatedSigAlgorithm",
+    "2.16.840.1.101.2.1.1.20", "fortezzaKMandUpdSigAlgorithms", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicKMandUpdSigAlgorithms",
+    "2.16.840.1.101.2.1.1.21", "fortezzaUpdatedIntegAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicUpdatedIntegAlgorithm",
+    "2.16.840.1.101.2.1.1.22", "keyExchangeAlgorithm", "SDN.700 INFOSEC algorithms.  Formerly known as mosaicKeyEncryptionAlgorithm",
+    "2.16.840.1.101.2.1.1.23", "fortezzaWrap80Algorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.1.24", "kEAKeyEncryptionAlgorithm", "SDN.700 INFOSEC algorithms",
+    "2.16.840.1.101.2.1.2.1", "rfc822MessageFormat", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.2", "emptyContent", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.3", "cspContentType", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.42", "mspRev3ContentType", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.48", "mspContentType", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.49", "mspRekeyAgentProtocol", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.50", "mspMMP", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.66", "mspRev3-1ContentType", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.72", "forwardedMSPMessageBodyPart", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.73", "mspForwardedMessageParameters", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.74", "forwardedCSPMsgBodyPart", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.75", "cspForwardedMessageParameters", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.2.76", "mspMMP2", "SDN.700 INFOSEC format",
+    "2.16.840.1.101.2.1.3.1", "sdnsSecurityPolicy", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.2", "sdnsPRBAC", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.3", "mosaicPRBAC", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.10", "siSecurityPolicy", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.10.0", "siNASP", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.1", "siELCO", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.2", "siTK", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.3", "siDSAP", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.4", "siSSSS", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.5", "siDNASP", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.6", "siBYEMAN", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.7", "siREL-US", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.8", "siREL-AUS", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.9", "siREL-CAN", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.10", "siREL_UK", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.11", "siREL-NZ", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.10.12", "siGeneric", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.11", "genser", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.11.0", "genserNations", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.11.1", "genserComsec", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.11.2", "genserAcquisition", "SDN.700 INFOSEC policy (obsolete)",
+    "2.16.840.1.101.2.1.3.11.3", "genserSecurityCategories", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.11.3.0", "genserTagSetName", "SDN.700 INFOSEC GENSER policy",
+    "2.16.840.1.101.2.1.3.12", "defaultSecurityPolicy", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.13", "capcoMarkings", "SDN.700 INFOSEC policy",
+    "2.16.840.1.101.2.1.3.13.0", "capcoSecurityCategories", "SDN.700 INFOSEC policy CAPCO markings",
+    "2.16.840.1.101.2.1.3.13.0.1", "capcoTagSetName1", "SDN.700 INFOSEC policy CAPCO markings",
+    "2.16.840.1.101.2.1.3.13.0.2", "capcoTagSetName2", "SDN.700 INFOSEC policy CAPCO markings",
+    "2.16.840.1.101.2.1.3.13.0.3", "capcoTagSetName3", "SDN.700 INFOSEC policy CAPCO markings",
+    "2.16.840.1.101.2.1.3.13.0.4", "capcoTagSetName4", "SDN.700 INFOSEC policy CAPCO markings",
+    "2.16.840.1.101.2.1.5.1", "sdnsKeyManagementCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.2", "sdnsUserSignatureCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.3", "sdnsKMandSigCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.4", "fortezzaKeyManagementCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.5", "fortezzaKMandSigCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.6", "fortezzaUserSignatureCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.7", "fortezzaCASignatureCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.8", "sdnsCASignatureCertificate", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.10", "auxiliaryVector", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.11", "mlReceiptPolicy", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.12", "mlMembership", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.13", "mlAdministrators", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.14", "alid", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.20", "janUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.21", "febUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.22", "marUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.23", "aprUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.24", "mayUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.25", "junUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.26", "julUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.27", "augUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.28", "sepUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.29", "octUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.30", "novUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.31", "decUKMs", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.40", "metaSDNSckl", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.41", "sdnsCKL", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.42", "metaSDNSsignatureCKL", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.43", "sdnsSignatureCKL", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.44", "sdnsCertificateRevocationList", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.45", "fortezzaCertificateRevocationList", "SDN.700 INFOSEC attributes (superseded)",
+    "2.16.840.1.101.2.1.5.46", "fortezzaCKL", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.47", "alExemptedAddressProcessor", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.48", "guard", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.49", "algorithmsSupported", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.50", "suiteAKeyManagementCertificate", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.51", "suiteAKMandSigCertificate", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.52", "suiteAUserSignatureCertificate", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.53", "prbacInfo", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.54", "prbacCAConstraints", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.55", "sigOrKMPrivileges", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.56", "commPrivileges", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.57", "labeledAttribute", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.58", "policyInformationFile", "SDN.700 INFOSEC attributes (obsolete)",
+    "2.16.840.1.101.2.1.5.59", "secPolicyInformationFile", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.5.60", "cAClearanceConstraint", "SDN.700 INFOSEC attributes",
+    "2.16.840.1.101.2.1.7.1", "cspExtns", "SDN.700 INFOSEC extensions",
+    "2.16.840.1.101.2.1.7.1.0", "cspCsExtn", "SDN.700 INFOSEC extensions",
+    "2.16.840.1.101.2.1.8.1", "mISSISecurityCategories", "SDN.700 INFOSEC security category",
+    "2.16.840.1.101.2.1.8.2", "standardSecurityLabelPrivileges", "SDN.700 INFOSEC security category",
+    "2.16.840.1.101.2.1.10.1", "sigPrivileges", "SDN.700 INFOSEC privileges",
+    "2.16.840.1.101.2.1.10.2", "kmPrivileges", "SDN.700 INFOSEC privileges",
+    "2.16.840.1.101.2.1.10.3", "namedTagSetPrivilege", "SDN.700 INFOSEC privileges",
+    "2.16.840.1.101.2.1.11.1", "ukDemo", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.11.2", "usDODClass2", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.11.3", "usMediumPilot", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.11.4", "usDODClass4", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.11.5", "usDODClass3", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.11.6", "usDODClass5", "SDN.700 INFOSEC certificate policy",
+    "2.16.840.1.101.2.1.12.0", "testSecurityPolicy", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.1", "tsp1", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.1.0", "tsp1SecurityCategories", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.1.0.0", "tsp1TagSetZero", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.1.0.1", "tsp1TagSetOne", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.1.0.2", "tsp1TagSetTwo", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.2", "tsp2", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.2.0", "tsp2SecurityCategories", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.2.0.0", "tsp2TagSetZero", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.2.0.1", "tsp2TagSetOne", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.2.0.2", "tsp2TagSetTwo", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.3", "kafka", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.3.0", "kafkaSecurityCategories", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.3.0.1", "kafkaTagSetName1", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.3.0.2", "kafkaTagSetName2", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.0.3.0.3", "kafkaTagSetName3", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.2.1.12.1.1", "tcp1", "SDN.700 INFOSEC test objects",
+    "2.16.840.1.101.3.1", "slabel", "CSOR GAK",
+    "2.16.840.1.101.3.2", "pki", "NIST",
+    "2.16.840.1.101.3.2.1", "NIST policyIdentifier", "NIST policies",
+    "2.16.840.1.101.3.2.1.3.1", "fbcaRudimentaryPolicy", "Federal Bridge CA Policy",
+    "2.16.840.1.101.3.2.1.3.2", "fbcaBasicPolicy", "Federal Bridge CA Policy",
+    "2.16.840.1.101.3.2.1.3.3", "fbcaMediumPolicy", "Federal Bridge CA Policy",
+    "2.16.840.1.101.3.2.1.3.4", "fbcaHighPolicy", "Federal Bridge CA Policy",
+    "2.16.840.1.101.3.2.1.48.1", "nistTestPolicy1", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.1.48.2", "nistTestPolicy2", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.1.48.3", "nistTestPolicy3", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.1.48.4", "nistTestPolicy4", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.1.48.5", "nistTestPolicy5", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.1.48.6", "nistTestPolicy6", "NIST PKITS policies",
+    "2.16.840.1.101.3.2.2", "gak", "CSOR GAK extended key usage",
+    "2.16.840.1.101.3.2.2.1", "kRAKey", "CSOR GAK extended key usage",
+    "2.16.840.1.101.3.2.3", "extensions", "CSOR GAK extensions",
+    "2.16.840.1.101.3.2.3.1", "kRTechnique", "CSOR GAK extensions",
+    "2.16.840.1.101.3.2.3.2", "kRecoveryCapable", "CSOR GAK extensions",
+    "2.16.840.1.101.3.2.3.3", "kR", "CSOR GAK extensions",
+    "2.16.840.1.101.3.2.4", "keyRecoverySchemes", "CSOR GAK",
+    "2.16.840.1.101.3.2.5", "krapola", "CSOR GAK",
+    "2.16.840.1.101.3.3", "arpa", "CSOR GAK",
+    "2.16.840.1.101.3.4", "nistAlgorithm", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1", "aes", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.1", "aes128-ECB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.2", "aes128-CBC", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.3", "aes128-OFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.4", "aes128-CFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.5", "aes128-wrap", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.6", "aes128-GCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.7", "aes128-CCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.8", "aes128-wrap-pad", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.21", "aes192-ECB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.22", "aes192-CBC", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.23", "aes192-OFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.24", "aes192-CFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.25", "aes192-wrap", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.26", "aes192-GCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.27", "aes192-CCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.28", "aes192-wrap-pad", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.41", "aes256-ECB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.42", "aes256-CBC", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.43", "aes256-OFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.44", "aes256-CFB", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.45", "aes256-wrap", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.46", "aes256-GCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.47", "aes256-CCM", "NIST Algorithm",
+    "2.16.840.1.101.3.4.1.48", "aes256-wrap-pad", "NIST Algorithm",
+    "2.16.840.1.101.3.4.2", "hashAlgos", "NIST Algorithm",
+    "2.16.840.1.101.3.4.2.1", "sha-256", "NIST Algorithm",
+    "2.16.840.1.101.3.4.2.2", "sha-384", "NIST Algorithm",
+    "2.16.840.1.101.3.4.2.3", "sha-512", "NIST Algorithm",
+    "2.16.840.1.101.3.4.2.4", "sha-224", "NIST Algorithm",
+    "2.16.840.1.101.3.4.3.1", "dsaWithSha224", "NIST Algorithm",
+    "2.16.840.1.101.3.4.3.2", "dsaWithSha256", "NIST Algorithm",
+    "2.16.840.1.113719.1.2.8", "novellAlgorithm", "Novell",
+    "2.16.840.1.113719.1.2.8.22", "desCbcIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.23", "desCbcPadIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.24", "desEDE2CbcIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.25", "desEDE2CbcPadIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.26", "desEDE3CbcIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.27", "desEDE3CbcPadIV8", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.28", "rc5CbcPad", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.29", "md2WithRSAEncryptionBSafe1", "Novell signature algorithm",
+    "2.16.840.1.113719.1.2.8.30", "md5WithRSAEncryptionBSafe1", "Novell signature algorithm",
+    "2.16.840.1.113719.1.2.8.31", "sha1WithRSAEncryptionBSafe1", "Novell signature algorithm",
+    "2.16.840.1.113719.1.2.8.32", "lmDigest", "Novell digest algorithm",
+    "2.16.840.1.113719.1.2.8.40", "md2", "Novell digest algorithm",
+    "2.16.840.1.113719.1.2.8.50", "md5", "Novell digest algorithm",
+    "2.16.840.1.113719.1.2.8.51", "ikeHmacWithSHA1-RSA", "Novell signature algorithm",
+    "2.16.840.1.113719.1.2.8.52", "ikeHmacWithMD5-RSA", "Novell signature algorithm",
+    "2.16.840.1.113719.1.2.8.69", "rc2CbcPad", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.82", "sha-1", "Novell digest algorithm",
+    "2.16.840.1.113719.1.2.8.92", "rc2BSafe1Cbc", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.95", "md4", "Novell digest algorithm",
+    "2.16.840.1.113719.1.2.8.130", "md4Packet", "Novell keyed hash",
+    "2.16.840.1.113719.1.2.8.131", "rsaEncryptionBsafe1", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.132", "nwPassword", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.2.8.133", "novellObfuscate-1", "Novell encryption algorithm",
+    "2.16.840.1.113719.1.9", "pki", "Novell",
+    "2.16.840.1.113719.1.9.4", "pkiAttributeType", "Novell PKI",
+    "2.16.840.1.113719.1.9.4.1", "securityAttributes", "Novell PKI attribute type",
+    "2.16.840.1.113719.1.9.4.2", "relianceLimit", "Novell PKI attribute type",
+    "2.16.840.1.113730.1", "cert-extension", "Netscape",
+    "2.16.840.1.113730.1.1", "netscape-cert-type", "Netscape certificate extension",
+    "2.16.840.1.113730.1.2", "netscape-base-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.3", "netscape-revocation-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.4", "netscape-ca-revocation-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.7", "netscape-cert-renewal-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.8", "netscape-ca-policy-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.9", "HomePage-url", "Netscape certificate extension",
+    "2.16.840.1.113730.1.10", "EntityLogo", "Netscape certificate extension",
+    "2.16.840.1.113730.1.11", "UserPicture", "Netscape certificate extension",
+    "2.16.840.1.113730.1.12", "netscape-ssl-server-name", "Netscape certificate extension",
+    "2.16.840.1.113730.1.13", "netscape-comment", "Netscape certificate extension",
+    "2.16.840.1.113730.2", "data-type", "Netscape",
+    "2.16.840.1.113730.2.1", "dataGIF", "Netscape data type",
+    "2.16.840.1.113730.2.2", "dataJPEG", "Netscape data type",
+    "2.16.840.1.113730.2.3", "dataURL", "Netscape data type",
+    "2.16.840.1.113730.2.4", "dataHTML", "Netscape data type",
+    "2.16.840.1.113730.2.5", "certSequence", "Netscape data type",
+    "2.16.840.1.113730.2.6", "certURL", "Netscape certificate extension",
+    "2.16.840.1.113730.3", "directory", "Netscape",
+    "2.16.840.1.113730.3.1", "ldapDefinitions", "Netscape directory",
+    "2.16.840.1.113730.3.1.1", "carLicense", "Netscape LDAP definitions",
+    "2.16.840.1.113730.3.1.2", "departmentNumber", "Netscape LDAP definitions",
+    "2.16.840.1.113730.3.1.3", "employeeNumber", "Netscape LDAP definitions",
+    "2.16.840.1.113730.3.1.4", "employeeType", "Netscape LDAP definitions",
+    "2.16.840.1.113730.3.2.2", "inetOrgPerson", "Netscape LDAP definitions",
+    "2.16.840.1.113730.4.1", "serverGatedCrypto", "Netscape",
+    "2.16.840.1.113733.1.6.3", "verisignCZAG", "Verisign extension",
+    "2.16.840.1.113733.1.6.6", "verisignInBox", "Verisign extension",
+    "2.16.840.1.113733.1.6.11", "verisignOnsiteJurisdictionHash", "Verisign extension",
+    "2.16.840.1.113733.1.6.13", "Unknown Verisign VPN extension", "Verisign extension",
+    "2.16.840.1.113733.1.6.15", "verisignServerID", "Verisign extension",
+    "2.16.840.1.113733.1.7.1.1", "verisignCertPolicies95Qualifier1", "Verisign policy",
+    "2.16.840.1.113733.1.7.1.1.1", "verisignCPSv1notice", "Verisign policy (obsolete)",
+    "2.16.840.1.113733.1.7.1.1.2", "verisignCPSv1nsi", "Verisign policy (obsolete)",
+    "2.16.840.1.113733.1.8.1", "verisignISSStrongCrypto", "Verisign",
+    "2.16.840.1.113733.1", "pki", "Verisign extension",
+    "2.16.840.1.113733.1.9", "pkcs7Attribute", "Verisign PKI extension",
+    "2.16.840.1.113733.1.9.2", "messageType", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.3", "pkiStatus", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.4", "failInfo", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.5", "senderNonce", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.6", "recipientNonce", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.7", "transID", "Verisign PKCS #7 attribute",
+    "2.16.840.1.113733.1.9.8", "extensionReq", "Verisign PKCS #7 attribute.  Use PKCS #9 extensionRequest instead",
+    "2.16.840.1.113741.2", "intelCDSA", "Intel CDSA",
+    "2.16.840.1.114412.1", "digiCertNonEVCerts", "Digicert CA policy",
+    "2.16.840.1.114412.1.1", "digiCertOVCert", "Digicert CA policy",
+    "2.16.840.1.114412.1.2", "digiCertDVCert", "Digicert CA policy",
+    "2.16.840.1.114412.1.11", "digiCertFederatedDeviceCert", "Digicert CA policy",
+    "2.16.840.1.114412.1.3.0.1", "digiCertGlobalCAPolicy", "Digicert CA policy",
+    "2.16.840.1.114412.1.3.0.2", "digiCertHighAssuranceEVCAPolicy", "Digicert CA policy",
+    "2.16.840.1.114412.1.3.0.3", "digiCertGlobalRootCAPolicy", "Digicert CA policy",
+    "2.16.840.1.114412.1.3.0.4", "digiCertAssuredIDRootCAPolicy", "Digicert CA policy",
+    "2.16.840.1.114412.2.2", "digiCertEVCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.3", "digiCertObjectSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.3.1", "digiCertCodeSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.3.2", "digiCertEVCodeSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.3.11", "digiCertKernelCodeSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.3.21", "digiCertDocumentSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4", "digiCertClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.1.1", "digiCertLevel1PersonalClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.1.2", "digiCertLevel1EnterpriseClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.2", "digiCertLevel2ClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.3.1", "digiCertLevel3USClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.3.2", "digiCertLevel3CBPClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.4.1", "digiCertLevel4USClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.4.2", "digiCertLevel4CBPClientCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.5.1", "digiCertPIVHardwareCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.5.2", "digiCertPIVCardAuthCert", "Digicert CA policy",
+    "2.16.840.1.114412.2.4.5.3", "digiCertPIVContentSigningCert", "Digicert CA policy",
+    "2.16.840.1.114412.4.31", "digiCertGridClassicCert", "Digicert CA policy",
+    "2.16.840.1.114412.4.31.5", "digiCertGridIntegratedCert", "Digicert CA policy",
+    "2.16.840.1.114412.31.4.31.1", "digiCertGridHostCert", "Digicert CA policy",
+    "2.23.42.0", "contentType", "SET",
+    "2.23.42.0.0", "panData", "SET contentType",
+    "2.23.42.0.1", "panToken", "SET contentType",
+    "2.23.42.0.2", "panOnly", "SET contentType",
+    "2.23.42.1", "msgExt", "SET",
+    "2.23.42.2", "field", "SET",
+    "2.23.42.2.0", "fullName", "SET field",
+    "2.23.42.2.1", "givenName", "SET field",
+    "2.23.42.2.2", "familyName", "SET field",
+    "2.23.42.2.3", "birthFamilyName", "SET field",
+    "2.23.42.2.4", "placeName", "SET field",
+    "2.23.42.2.5", "identificationNumber", "SET field",
+    "2.23.42.2.6", "month", "SET field",
+    "2.23.42.2.7", "date", "SET field",
+    "2.23.42.2.8", "address", "SET field",
+    "2.23.42.2.9", "telephone", "SET field",
+    "2.23.42.2.10", "amount", "SET field",
+    "2.23.42.2.11", "accountNumber", "SET field",
+    "2.23.42.2.12", "passPhrase", "SET field",
+    "2.23.42.3", "attribute", "SET",
+    "2.23.42.3.0", "cert", "SET attribute",
+    "2.23.42.3.0.0", "rootKeyThumb", "SET cert attribute",
+    "2.23.42.3.0.1", "additionalPolicy", "SET cert attribute",
+    "2.23.42.4", "algorithm", "SET",
+    "2.23.42.5", "policy", "SET",
+    "2.23.42.5.0", "root", "SET policy",
+    "2.23.42.6", "module", "SET",
+    "2.23.42.7", "certExt", "SET",
+    "2.23.42.7.0", "hashedRootKey", "SET cert extension",
+    "2.23.42.7.1", "certificateType", "SET cert extension",
+    "2.23.42.7.2", "merchantData", "SET cert extension",
+    "2.23.42.7.3", "cardCertRequired", "SET cert extension",
+    "2.23.42.7.4", "tunneling", "SET cert extension",
+    "2.23.42.7.5", "setExtensions", "SET cert extension",
+    "2.23.42.7.6", "setQualifier", "SET cert extension",
+    "2.23.42.8", "brand", "SET",
+    "2.23.42.8.1", "IATA-ATA", "SET brand",
+    "2.23.42.8.4", "VISA", "SET brand",
+    "2.23.42.8.5", "MasterCard", "SET brand",
+    "2.23.42.8.30", "Diners", "SET brand",
+    "2.23.42.8.34", "AmericanExpress", "SET brand",
+    "2.23.42.8.6011", "Novus", "SET brand",
+    "2.23.42.9", "vendor", "SET",
+    "2.23.42.9.0", "GlobeSet", "SET vendor",
+    "2.23.42.9.1", "IBM", "SET vendor",
+    "2.23.42.9.2", "CyberCash", "SET vendor",
+    "2.23.42.9.3", "Terisa", "SET vendor",
+    "2.23.42.9.4", "RSADSI", "SET vendor",
+    "2.23.42.9.5", "VeriFone", "SET vendor",
+    "2.23.42.9.6", "TrinTech", "SET vendor",
+    "2.23.42.9.7", "BankGate", "SET vendor",
+    "2.23.42.9.8", "GTE", "SET vendor",
+    "2.23.42.9.9", "CompuSource", "SET vendor",
+    "2.23.42.9.10", "Griffin", "SET vendor",
+    "2.23.42.9.11", "Certicom", "SET vendor",
+    "2.23.42.9.12", "OSS", "SET vendor",
+    "2.23.42.9.13", "TenthMountain", "SET vendor",
+    "2.23.42.9.14", "Antares", "SET vendor",
+    "2.23.42.9.15", "ECC", "SET vendor",
+    "2.23.42.9.16", "Maithean", "SET vendor",
+    "2.23.42.9.17", "Netscape", "SET vendor",
+    "2.23.42.9.18", "Verisign", "SET vendor",
+    "2.23.42.9.19", "BlueMoney", "SET vendor",
+    "2.23.42.9.20", "Lacerte", "SET vendor",
+    "2.23.42.9.21", "Fujitsu", "SET vendor",
+    "2.23.42.9.22", "eLab", "SET vendor",
+    "2.23.42.9.23", "Entrust", "SET vendor",
+    "2.23.42.9.24", "VIAnet", "SET vendor",
+    "2.23.42.9.25", "III", "SET vendor",
+    "2.23.42.9.26", "OpenMarket", "SET vendor",
+    "2.23.42.9.27", "Lexem", "SET vendor",
+    "2.23.42.9.28", "Intertrader", "SET vendor",
+    "2.23.42.9.29", "Persimmon", "SET vendor",
+    "2.23.42.9.30", "NABLE", "SET vendor",
+    "2.23.42.9.31", "espace-net", "SET vendor",
+    "2.23.42.9.32", "Hitachi", "SET vendor",
+    "2.23.42.9.33", "Microsoft", "SET vendor",
+    "2.23.42.9.34", "NEC", "SET vendor",
+    "2.23.42.9.35", "Mitsubishi", "SET vendor",
+    "2.23.42.9.36", "NCR", "SET vendor",
+    "2.23.42.9.37", "e-COMM", "SET vendor",
+    "2.23.42.9.38", "Gemplus", "SET vendor",
+    "2.23.42.10", "national", "SET",
+    "2.23.42.10.392", "Japan", "SET national",
+    "2.23.43.1.4", "wTLS-ECC", "WAP WTLS",
+    "2.23.43.1.4.1", "wTLS-ECC-curve1", "WAP WTLS",
+    "2.23.43.1.4.6", "wTLS-ECC-curve6", "WAP WTLS",
+    "2.23.43.1.4.8", "wTLS-ECC-curve8", "WAP WTLS",
+    "2.23.43.1.4.9", "wTLS-ECC-curve9", "WAP WTLS",
+    "2.23.133", "tCPA", "TCPA",
+    "2.23.133.1", "tcpaSpecVersion", "TCPA",
+    "2.23.133.2", "tcpaAttribute", "TCPA",
+    "2.23.133.2.1", "tcpaTpmManufacturer", "TCPA Attribute",
+    "2.23.133.2.2", "tcpaTpmModel", "TCPA Attribute",
+    "2.23.133.2.3", "tcpaTpmVersion", "TCPA Attribute",
+    "2.23.133.2.4", "tcpaPlatformManufacturer", "TCPA Attribute",
+    "2.23.133.2.5", "tcpaPlatformModel", "TCPA Attribute",
+    "2.23.133.2.6", "tcpaPlatformVersion", "TCPA Attribute",
+    "2.23.133.2.7", "tcpaComponentManufacturer", "TCPA Attribute",
+    "2.23.133.2.8", "tcpaComponentModel", "TCPA Attribute",
+    "2.23.133.2.9", "tcpaComponentVersion", "TCPA Attribute",
+    "2.23.133.2.10", "tcpaSecurityQualities", "TCPA Attribute",
+    "2.23.133.2.11", "tcpaTpmProtectionProfile", "TCPA Attribute",
+    "2.23.133.2.12", "tcpaTpmSecurityTarget", "TCPA Attribute",
+    "2.23.133.2.13", "tcpaFoundationProtectionProfile", "TCPA Attribute",
+    "2.23.133.2.14", "tcpaFoundationSecurityTarget", "TCPA Attribute",
+    "2.23.133.2.15", "tcpaTpmIdLabel", "TCPA Attribute",
+    "2.23.133.3", "tcpaProtocol", "TCPA",
+    "2.23.133.3.1", "tcpaPrttTpmIdProtocol", "TCPA Protocol",
+    "2.23.134.1.4.2.1", "postSignumRootQCA", "PostSignum CA",
+    "2.23.134.1.2.2.3", "postSignumPublicCA", "PostSignum CA",
+    "2.23.134.1.2.1.8.210", "postSignumCommercialServerPolicy", "PostSignum CA",
+    "2.23.136.1.1.1", "mRTDSignatureData", "ICAO MRTD",
+    "2.54.1775.2", "hashedRootKey", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.3", "certificateType", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.4", "merchantData", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.5", "cardCertRequired", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.6", "tunneling", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.7", "setQualifier", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "2.54.1775.99", "setData", "SET.  Deprecated, use (2 23 42 7 0) instead",
+    "1.2.40.0.17.1.22", "A-Trust EV policy", "A-Trust CA Root",
+    "1.3.6.1.4.1.34697.2.1", "AffirmTrust EV policy", "AffirmTrust Commercial",
+    "1.3.6.1.4.1.34697.2.2", "AffirmTrust EV policy", "AffirmTrust Networking",
+    "1.3.6.1.4.1.34697.2.3", "AffirmTrust EV policy", "AffirmTrust Premium",
+    "1.3.6.1.4.1.34697.2.4", "AffirmTrust EV policy", "AffirmTrust Premium ECC",
+    "2.16.578.1.26.1.3.3", "BuyPass EV policy", "BuyPass Class 3 EV",
+    "1.3.6.1.4.1.17326.10.14.2.1.2", "Camerfirma EV policy", "Camerfirma CA Root",
+    "1.3.6.1.4.1.17326.10.8.12.1.2", "Camerfirma EV policy", "Camerfirma CA Root",
+    "1.3.6.1.4.1.22234.2.5.2.3.1", "CertPlus EV policy", "CertPlus Class 2 Primary CA (formerly Keynectis)",
+    "1.3.6.1.4.1.6449.1.2.1.5.1", "Comodo EV policy", "COMODO Certification Authority",
+    "1.3.6.1.4.1.6334.1.100.1", "Cybertrust EV policy", "Cybertrust Global Root (now Verizon Business)",
+    "1.3.6.1.4.1.4788.2.202.1", "D-TRUST EV policy", "D-TRUST Root Class 3 CA 2 EV 2009",
+    "2.16.840.1.114412.2.1", "DigiCert EV policy", "DigiCert High Assurance EV Root CA",
+    "2.16.528.1.1001.1.1.1.12.6.1.1.1", "DigiNotar EV policy", "DigiNotar Root CA",
+    "2.16.840.1.114028.10.1.2", "Entrust EV policy", "Entrust Root Certification Authority",
+    "1.3.6.1.4.1.14370.1.6", "GeoTrust EV policy", "GeoTrust Primary Certification Authority (formerly Equifax)",
+    "1.3.6.1.4.1.4146.1.1", "GlobalSign EV policy", "GlobalSign",
+    "2.16.840.1.114413.1.7.23.3", "GoDaddy EV policy", "GoDaddy Class 2 Certification Authority (formerly ValiCert)",
+    "1.3.6.1.4.1.14777.6.1.1", "Izenpe EV policy", "Certificado de Servidor Seguro SSL EV",
+    "1.3.6.1.4.1.14777.6.1.2", "Izenpe EV policy", "Certificado de Sede Electronica EV",
+    "1.3.6.1.4.1.782.1.2.1.8.1", "Network Solutions EV policy", "Network Solutions Certificate Authority",
+    "1.3.6.1.4.1.8024.0.2.100.1.2", "QuoVadis EV policy", "QuoVadis Root CA 2",
+    "1.2.392.200091.100.721.1", "Security Communication (SECOM) EV policy", "Security Communication RootCA1",
+    "2.16.840.1.114414.1.7.23.3", "Starfield EV policy", "Starfield Class 2 Certification Authority",
+    "1.3.6.1.4.1.23223.1.1.1", "StartCom EV policy", "StartCom Certification Authority",
+    "2.16.756.1.89.1.2.1.1", "SwissSign EV policy", "SwissSign Gold CA - G2",
+    "1.3.6.1.4.1.7879.13.24.1", "T-TeleSec EV policy", "T-TeleSec GlobalRoot Class 3",
+    "2.16.840.1.113733.1.7.48.1", "Thawte EV policy", "Thawte Premium Server CA",
+    "2.16.840.1.114404.1.1.2.4.1", "TrustWave EV policy", "TrustWave CA, formerly SecureTrust, before that XRamp",
+    "1.3.6.1.4.1.40869.1.1.22.3", "TWCA EV policy", "TWCA Root Certification Authority",
+    "2.16.840.1.113733.1.7.23.6", "VeriSign EV policy", "VeriSign Class 3 Public Primary Certification Authority",
+    "2.16.840.1.114171.500.9", "Wells Fargo EV policy", "Wells Fargo WellsSecure Public Root Certificate Authority",
+};
+
+static const uint32_t restable_oids_order[] = {
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 54, 55, 56, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 57,
+    58, 59, 68, 69, 70, 71, 72, 60, 61, 62, 63, 64, 65, 66, 67, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 103, 86, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 87, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 88, 124, 125, 89,
+    126, 127, 90, 91, 92, 93, 128, 129, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 300, 299, 301, 302, 303, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+    407, 408, 409, 410, 411, 412, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313,
+    314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329,
+    330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345,
+    346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361,
+    362, 366, 367, 363, 368, 364, 365, 369, 413, 414, 2309, 2287, 415, 416, 425, 426,
+    427, 428, 429, 430, 431, 432, 417, 433, 434, 418, 419, 420, 421, 422, 423, 424,
+    448, 449, 450, 451, 452, 453, 454, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+    444, 445, 446, 447, 455, 456, 465, 466, 467, 468, 469, 470, 457, 471, 472, 473,
+    458, 474, 475, 476, 477, 478, 479, 480, 481, 482, 459, 483, 484, 485, 486, 487,
+    488, 460, 461, 462, 463, 464, 534, 535, 536, 532, 533, 491, 492, 493, 489, 510,
+    511, 512, 513, 514, 494, 495, 502, 503, 504, 505, 506, 507, 496, 497, 498, 499,
+    500, 501, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 490,
+    509, 537, 538, 539, 540, 541, 542, 543, 544, 545, 528, 529, 530, 531, 508, 546,
+    547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562,
+    563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 581, 582, 583,
+    584, 585, 586, 587, 576, 588, 577, 578, 579, 580, 589, 590, 591, 592, 593, 594,
+    595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610,
+    611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 625, 626, 627,
+    628, 624, 629, 630, 631, 632, 633, 634, 635, 643, 644, 645, 646, 647, 636, 637,
+    638, 639, 648, 640, 641, 642, 857, 858, 859, 860, 861, 862, 863, 864, 891, 892,
+    893, 894, 895, 896, 897, 898, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890,
+    899, 900, 901, 902, 649, 650, 651, 652, 653, 658, 659, 660, 661, 654, 655, 656,
+    657, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 681, 682, 683, 684,
+    685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700,
+    701, 702, 703, 704, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 705, 723,
+    724, 725, 726, 727, 728, 729, 730, 731, 732, 706, 733, 734, 735, 736, 737, 707,
+    708, 709, 710, 711, 712, 838, 839, 738, 739, 748, 749, 750, 751, 752, 753, 754,
+    755, 756, 757, 740, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 741, 768,
+    769, 770, 771, 772, 773, 774, 775, 776, 777, 742, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 743, 788, 789, 744, 745, 746, 747, 790, 799, 800, 801, 802,
+    803, 804, 805, 806, 791, 807, 808, 792, 793, 794, 795, 796, 797, 798, 809, 810,
+    811, 812, 813, 814, 815, 816, 817, 818, 827, 828, 829, 830, 831, 832, 819, 820,
+    821, 822, 823, 824, 825, 826, 833, 834, 835, 836, 837, 673, 840, 841, 842, 843,
+    844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 674, 675, 676, 856,
+    677, 678, 679, 680, 903, 910, 911, 904, 905, 906, 907, 908, 909, 912, 921, 913,
+    914, 915, 916, 917, 918, 919, 920, 924, 925, 926, 927, 928, 929, 930, 931, 932,
+    934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949,
+    950, 951, 952, 953, 933, 954, 955, 956, 957, 958, 959, 960, 961, 972, 962, 963,
+    964, 965, 966, 967, 968, 969, 970, 971, 973, 974, 975, 976, 977, 978, 979, 980,
+    981, 982, 983, 984, 993, 994, 995, 996, 997, 998, 999, 1000, 985, 986, 987, 988,
+    989, 990, 991, 992, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
+    1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 922, 923, 1592, 1593,
+    1594, 1595, 1596, 1597, 1598, 1599, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1600,
+    1609, 1610, 1611, 1612, 1601, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1602, 1621, 1622,
+    1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1603, 1604, 1605, 1606, 1607, 1608, 1631, 1632,
+    1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+    1657, 1658, 1659, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1660, 1661, 1662, 1663, 1664,
+    1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
+    1672, 1375, 1376, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1377, 1380, 1396,
+    1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1378, 1381, 1379, 1382, 1383, 1384, 1385,
+    1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+    1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1422, 1423, 1424, 1425, 1426, 1436, 1437,
+    1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+    1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1470, 1471, 1472, 1473, 1474, 1462, 1463, 1464,
+    1465, 1466, 1467, 1468, 1469, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1503, 1504, 1505, 1506, 1515, 1516, 1517,
+    1518, 1519, 1520, 1521, 1522, 1523, 1524, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1525,
+    1526, 1527, 1528, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1529, 1530, 1531, 1532, 1533,
+    1534, 1535, 1536, 1537, 1546, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1547, 1556, 1557,
+    1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1548, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+    1573, 1574, 1575, 1549, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1550, 1586,
+    1587, 1588, 1589, 1590, 1591, 1551, 1552, 1553, 1554, 1555, 1224, 1225, 1227, 1228, 1229, 1230,
+    1231, 1232, 1235, 1236, 1237, 1238, 1233, 1234, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+    1226, 2302, 2305, 2306, 1247, 1248, 1249, 1250, 2293, 2294, 1154, 1155, 1156, 1157, 1158, 2295,
+    2311, 1251, 1252, 1253, 1254, 1255, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168,
+    1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1063, 1064,
+    1092, 1093, 1095, 1096, 1097, 1094, 1098, 1065, 1066, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
+    1067, 1068, 1069, 1070, 1083, 1071, 1072, 1073, 1074, 1075, 1084, 1085, 1086, 1087, 1088, 1089,
+    1090, 1091, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1042,
+    1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1041,
+    1058, 1059, 1060, 1061, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1126, 1127, 1128, 1129, 1130,
+    1131, 1132, 1133, 1134, 1119, 1135, 1136, 1137, 1120, 1121, 1122, 1123, 1124, 1125, 1138, 1062,
+    1139, 1140, 1141, 1142, 1144, 1145, 1146, 1143, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1183,
+    2288, 2289, 2290, 2291, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 2316, 1192, 1193, 2303,
+    1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 0, 2, 1, 4, 3,
+    2298, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 2297, 1217, 2296,
+    1218, 1219, 1220, 2307, 2313, 2308, 1223, 1221, 1222, 1256, 1257, 1258, 1259, 1268, 1269, 1270,
+    1271, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+    1341, 1342, 1343, 1272, 1273, 1274, 1275, 1344, 1345, 1346, 1276, 1277, 1286, 1287, 1288, 1289,
+    1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1290, 1291, 1298, 1299, 1300, 1301, 1302, 1303,
+    1304, 1292, 1293, 1294, 1295, 1296, 1297, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1360,
+    1361, 1355, 1356, 1357, 1358, 1359, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314,
+    1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
+    1331, 1332, 1333, 1362, 1363, 1364, 1365, 2300, 2292, 1866, 2312, 1867, 1876, 1877, 1878, 1879,
+    1880, 1881, 1882, 1883, 1884, 1885, 1868, 1886, 1887, 1888, 1889, 1890, 1869, 1870, 1871, 1872,
+    1873, 1874, 1875, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996,
+    1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 1891, 1892, 1893,
+    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1907, 1908, 1909, 1918, 1919,
+    1920, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+    1928, 1929, 1930, 1931, 1932, 1933, 1905, 1906, 1934, 1942, 1943, 1944, 1945, 1946, 1935, 1947,
+    1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1936, 1957, 1958, 1937, 1959, 1960, 1961,
+    1962, 1963, 1964, 1965, 1966, 1967, 1968, 1938, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976,
+    1977, 1978, 1939, 1979, 1940, 1941, 1980, 1981, 1982, 1983, 2010, 2011, 2012, 2013, 2014, 2015,
+    2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+    2032, 2033, 2034, 2035, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2036, 2037, 2050, 2051,
+    2052, 2053, 2054, 2055, 2056, 2057, 2038, 2039, 2040, 2041, 2058, 2059, 2060, 2061, 2062, 2063,
+    2064, 2065, 2085, 2086, 2087, 2088, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075,
+    2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2089, 2090, 2091, 2092, 2093, 2094, 2101,
+    2102, 2103, 2104, 2095, 2096, 2097, 2098, 2099, 2100, 2105, 2106, 2107, 2108, 2109, 2110, 2111,
+    2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2129, 2122, 2123, 2124, 2120, 2121, 2125, 2126,
+    2127, 2317, 2314, 2128, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2301, 2318, 2315,
+    2139, 2140, 2142, 2141, 2143, 2144, 2145, 2146, 2299, 2147, 2148, 2149, 2151, 2150, 2152, 2153,
+    2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2166, 2164, 2165, 2304, 2310, 2256,
+    2257, 2258, 2259, 2268, 2269, 2270, 2271, 2272, 2273, 2260, 2261, 2262, 2263, 2264, 2265, 2266,
+    2267, 2274, 2275, 2278, 2277, 2276, 2279, 2167, 2168, 2169, 2170, 2171, 2249, 2250, 2172, 2173,
+    2174, 2183, 2184, 2185, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2186, 2187, 2188, 2189,
+    2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2206, 2207,
+    2204, 2205, 2208, 2209, 2210, 2211, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229,
+    2212, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2213, 2240, 2241, 2242, 2243,
+    2244, 2245, 2246, 2247, 2248, 2214, 2215, 2216, 2217, 2218, 2219, 2251, 2252, 2253, 2254, 2255,
+    1795, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1796, 1814, 1815, 1816, 1817,
+    1818, 1819, 1820, 1821, 1822, 1823, 1797, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+    1833, 1834, 1835, 1798, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1799, 1846,
+    1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1800, 1856, 1857, 1858, 1859, 1860, 1861,
+    1862, 1863, 1864, 1865, 1801, 1802, 1803, 1682, 1683, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+    1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1684, 1711, 1712, 1713, 1714, 1715, 1716,
+    1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1685, 1726, 1727, 1728, 1729, 1730, 1731,
+    1732, 1733, 1734, 1735, 1686, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1687,
+    1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1688, 1756, 1757, 1758, 1759, 1760,
+    1761, 1762, 1763, 1764, 1765, 1689, 1690, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1691, 1692,
+    1773, 1693, 1694, 1774, 1775, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1776, 1792, 1793,
+    1777, 1778, 1779, 1780, 1781, 1782, 1783, 1794, 2280, 2281, 2282, 2283, 2284, 2285, 2286,
+};
+static const restable_t restable_builtin[] = {
+    { "aid_desfire", restable_aid_desfire_fields, 6, restable_aid_desfire_cells, restable_aid_desfire_order, 204, 51303, 0x7d5d9ea2 },
+    { "aidlist", restable_aidlist_fields, 6, restable_aidlist_cells, restable_aidlist_order, 309, 70914, 0xdb1cbf83 },
+    { "mad", restable_mad_fields, 5, restable_mad_cells, restable_mad_order, 1956, 453133, 0x01570f65 },
+    { "oids", restable_oids_fields, 3, restable_oids_cells, restable_oids_order, 2319, 193938, 0xe50f2ed1 },
+};
+
+#endif
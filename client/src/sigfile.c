@@ -0,0 +1,403 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Binary signal trace files (.pm3b)
+//-----------------------------------------------------------------------------
+#include "sigfile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stddef.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "ui.h"
+#include "graph.h"
+#include "fileutils.h"
+#include "commonutil.h"     // Uint4byteToMemLe, MemLeToUint4byte
+#include "lz4block.h"
+
+// what the samples currently in the graph came from
+static sigfile_info_t capture_info;
+
+// remember how the graph samples were captured, sc NULL when unknown
+void sigfile_set_capture(const sample_config *sc, const char *source) {
+    memset(&capture_info, 0, sizeof(capture_info));
+    if (sc) {
+        // the LF ADC runs at the carrier frequency, 12 MHz / (divisor + 1)
+        capture_info.sample_rate = 12000000 / (sc->divisor + 1);
+        capture_info.bits_per_sample = sc->bits_per_sample;
+        capture_info.decimation = sc->decimation;
+    }
+    if (source) {
+        strncpy(capture_info.source, source, sizeof(capture_info.source) - 1);
+    }
+}
+
+const sigfile_info_t *sigfile_get_capture(void) {
+    return &capture_info;
+}
+
+#define HDR_AT(field)   (buf + offsetof(sigfile_header_t, field))
+
+// the header as it is in the file,  every field little endian whatever the host
+static void header_to_mem(const sigfile_header_t *hdr, uint8_t *buf) {
+    memcpy(HDR_AT(magic), hdr->magic, sizeof(hdr->magic));
+    Uint2byteToMemLe(HDR_AT(version), hdr->version);
+    Uint2byteToMemLe(HDR_AT(header_len), hdr->header_len);
+    Uint4byteToMemLe(HDR_AT(flags), hdr->flags);
+    Uint4byteToMemLe(HDR_AT(sample_rate), hdr->sample_rate);
+    *HDR_AT(bits_per_sample) = hdr->bits_per_sample;
+    *HDR_AT(width) = hdr->width;
+    Uint2byteToMemLe(HDR_AT(decimation), hdr->decimation);
+    Uint4byteToMemLe(HDR_AT(bias), (uint32_t)hdr->bias);
+    Uint8byteToMemLe(HDR_AT(samples), hdr->samples);
+    Uint4byteToMemLe(HDR_AT(block_samples), hdr->block_samples);
+    Uint4byteToMemLe(HDR_AT(block_count), hdr->block_count);
+    memcpy(HDR_AT(source), hdr->source, sizeof(hdr->source));
+}
+
+static void header_from_mem(sigfile_header_t *hdr, const uint8_t *buf) {
+    memcpy(hdr->magic, HDR_AT(magic), sizeof(hdr->magic));
+    hdr->version = MemLeToUint2byte(HDR_AT(version));
+    hdr->header_len = MemLeToUint2byte(HDR_AT(header_len));
+    hdr->flags = MemLeToUint4byte(HDR_AT(flags));
+    hdr->sample_rate = MemLeToUint4byte(HDR_AT(sample_rate));
+    hdr->bits_per_sample = *HDR_AT(bits_per_sample);
+    hdr->width = *HDR_AT(width);
+    hdr->decimation = MemLeToUint2byte(HDR_AT(decimation));
+    hdr->bias = (int32_t)MemLeToUint4byte(HDR_AT(bias));
+    hdr->samples = MemLeToUint8byte(HDR_AT(samples));
+    hdr->block_samples = MemLeToUint4byte(HDR_AT(block_samples));
+    hdr->block_count = MemLeToUint4byte(HDR_AT(block_count));
+    memcpy(hdr->source, HDR_AT(source), sizeof(hdr->source));
+}
+
+#undef HDR_AT
+
+static bool header_valid(const sigfile_header_t *hdr) {
+    if (memcmp(hdr->magic, SIGFILE_MAGIC, sizeof(hdr->magic)) != 0) {
+        return false;
+    }
+    if (hdr->version != SIGFILE_VERSION || hdr->header_len < sizeof(sigfile_header_t)) {
+        return false;
+    }
+    if (hdr->width != sizeof(uint8_t) && hdr->width != sizeof(int32_t)) {
+        return false;
+    }
+    if (hdr->flags & SIGFILE_FLAG_LZ4) {
+        if (hdr->block_samples == 0 || (size_t)hdr->block_samples * hdr->width > LZ4BLOCK_MAX_RAW) {
+            return false;
+        }
+        if (hdr->block_count != (hdr->samples + hdr->block_samples - 1) / hdr->block_samples) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sigfile_is_sigfile(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    uint8_t magic[4] = {0};
+    size_t n = fread(magic, 1, sizeof(magic), f);
+    fclose(f);
+    return (n == sizeof(magic) && memcmp(magic, SIGFILE_MAGIC, sizeof(magic)) == 0);
+}
+
+// Samples are stored one byte each whenever their range allows it.  With compress, the payload
+// is cut into blocks of block_samples,  each one a little endian length word followed by an
+// lz4block,  which holds the bytes LZ4 compressed or stored as they are.
+int sigfile_save(const char *preferredName, const int *data, size_t datalen, bool compress) {
+
+    if (data == NULL || datalen == 0) {
+        return PM3_EINVARG;
+    }
+
+    int lo = data[0], hi = data[0];
+    for (size_t i = 1; i < datalen; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+
+    sigfile_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, SIGFILE_MAGIC, sizeof(hdr.magic));
+    hdr.version = SIGFILE_VERSION;
+    hdr.header_len = sizeof(hdr);
+    hdr.sample_rate = capture_info.sample_rate;
+    hdr.bits_per_sample = capture_info.bits_per_sample;
+    hdr.decimation = capture_info.decimation;
+    hdr.samples = datalen;
+    memcpy(hdr.source, capture_info.source, sizeof(hdr.source));
+
+    if ((int64_t)hi - lo <= 0xFF) {
+        hdr.width = sizeof(uint8_t);
+        hdr.bias = -lo;
+    } else {
+        hdr.width = sizeof(int32_t);
+    }
+
+    size_t payload_len = datalen * hdr.width;
+    uint8_t *payload = calloc(payload_len, sizeof(uint8_t));
+    if (payload == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    if (hdr.width == sizeof(uint8_t)) {
+        for (size_t i = 0; i < datalen; i++) {
+            payload[i] = (uint8_t)(data[i] - lo);
+        }
+    } else {
+        for (size_t i = 0; i < datalen; i++) {
+            Uint4byteToMemLe(payload + (i * sizeof(int32_t)), (uint32_t)data[i]);
+        }
+    }
+
+    uint8_t *block = NULL;
+    size_t block_len = LZ4BLOCK_MAX_RAW;
+    if (compress) {
+        hdr.flags |= SIGFILE_FLAG_LZ4;
+        hdr.block_samples = LZ4BLOCK_MAX_RAW / hdr.width;
+        hdr.block_count = (datalen + hdr.block_samples - 1) / hdr.block_samples;
+
+        block = calloc(sizeof(lz4block_hdr_t) + block_len, sizeof(uint8_t));
+        if (block == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            free(payload);
+            return PM3_EMALLOC;
+        }
+    }
+
+    char *fileName = newfilenamemcopyEx(preferredName, SIGFILE_EXT, spTrace);
+    if (fileName == NULL) {
+        free(block);
+        free(payload);
+        return PM3_EMALLOC;
+    }
+
+    int retval = PM3_SUCCESS;
+
+    FILE *f = fopen(fileName, "wb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "file not found or locked `" _YELLOW_("%s") "`", fileName);
+        retval = PM3_EFILE;
+        goto out;
+    }
+
+    uint8_t hdrbuf[sizeof(sigfile_header_t)];
+    header_to_mem(&hdr, hdrbuf);
+    size_t written = fwrite(hdrbuf, 1, sizeof(hdrbuf), f);
+
+    if (compress) {
+        for (size_t off = 0; off < payload_len; off += block_len) {
+
+            // room for the whole slice stored,  so a block always takes all of it
+            size_t n = MIN(block_len, payload_len - off);
+            size_t consumed = 0;
+            size_t c = lz4block_pack(payload + off, n, off, block, sizeof(lz4block_hdr_t) + n, &consumed);
+
+            uint8_t lenword[4];
+            Uint4byteToMemLe(lenword, (uint32_t)c);
+            written += fwrite(lenword, 1, sizeof(lenword), f);
+            written += fwrite(block, 1, c, f);
+        }
+    } else {
+        written += fwrite(payload, 1, payload_len, f);
+    }
+
+    fflush(f);
+    if (ferror(f)) {
+        PrintAndLogEx(WARNING, "failed to write `" _YELLOW_("%s") "`", fileName);
+        retval = PM3_EFILE;
+    }
+    fclose(f);
+
+    if (retval == PM3_SUCCESS) {
+        PrintAndLogEx(SUCCESS, "Saved " _YELLOW_("%zu") " samples, " _YELLOW_("%zu") " bytes to binary trace file `" _YELLOW_("%s") "`", datalen, written, fileName);
+    }
+
+out:
+    free(fileName);
+    free(block);
+    free(payload);
+    return retval;
+}
+
+#ifndef _WIN32
+static void sigfile_unmap(void *owner, size_t owner_len) {
+    munmap(owner, owner_len);
+}
+
+// hand the samples of an uncompressed 8 bit trace to the graph as they are in the file
+static int sigfile_map_u8(FILE *f, const sigfile_header_t *hdr) {
+    struct stat st;
+    if (fstat(fileno(f), &st) != 0 || (uint64_t)st.st_size < hdr->header_len + hdr->samples) {
+        return PM3_EFILE;
+    }
+
+    size_t map_len = hdr->header_len + hdr->samples;
+    void *map = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if (map == MAP_FAILED) {
+        return PM3_EFILE;
+    }
+
+    return graph_adopt_u8((const uint8_t *)map + hdr->header_len, hdr->samples, hdr->bias, sigfile_unmap, map, map_len);
+}
+#endif
+
+// read n payload bytes into dst,  undoing the LZ4 blocks if any
+static int sigfile_read_payload(FILE *f, const sigfile_header_t *hdr, uint8_t *dst, size_t n) {
+
+    if ((hdr->flags & SIGFILE_FLAG_LZ4) == 0) {
+        return (fread(dst, 1, n, f) == n) ? PM3_SUCCESS : PM3_EFILE;
+    }
+
+    size_t block_len = (size_t)hdr->block_samples * hdr->width;
+    uint8_t *block = calloc(sizeof(lz4block_hdr_t) + block_len, sizeof(uint8_t));
+    if (block == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    int res = PM3_SUCCESS;
+    for (size_t off = 0; off < n; off += block_len) {
+
+        size_t want = MIN(block_len, n - off);
+
+        uint8_t lenword[4];
+        if (fread(lenword, 1, sizeof(lenword), f) != sizeof(lenword)) {
+            res = PM3_EFILE;
+            break;
+        }
+
+        uint32_t c = MemLeToUint4byte(lenword);
+        if (c > sizeof(lz4block_hdr_t) + block_len || fread(block, 1, c, f) != c) {
+            res = PM3_EFILE;
+            break;
+        }
+
+        uint32_t at = 0;
+        if (lz4block_unpack(block, c, dst, off + want, &at) != (int)want || at != off) {
+            res = PM3_EFILE;
+            break;
+        }
+    }
+
+    free(block);
+    return res;
+}
+
+// load a binary trace into the graph buffer
+int sigfile_load(const char *path) {
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "couldn't open `" _YELLOW_("%s") "`", path);
+        return PM3_EFILE;
+    }
+
+    // a short read leaves it zeroed,  which fails the magic
+    sigfile_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    uint8_t hdrbuf[sizeof(sigfile_header_t)];
+    if (fread(hdrbuf, sizeof(hdrbuf), 1, f) == 1) {
+        header_from_mem(&hdr, hdrbuf);
+    }
+    if (header_valid(&hdr) == false) {
+        PrintAndLogEx(WARNING, "not a valid binary trace file `" _YELLOW_("%s") "`", path);
+        fclose(f);
+        return PM3_EFILE;
+    }
+
+    if (hdr.samples > GRAPH_TRACE_LEN_LIMIT) {
+        PrintAndLogEx(WARNING, "trace too long, " _YELLOW_("%" PRIu64) " samples", hdr.samples);
+        fclose(f);
+        return PM3_EOVFLOW;
+    }
+
+    size_t n = hdr.samples;
+    int res = PM3_EFILE;
+
+    g_GraphTraceLen = 0;
+
+    if (hdr.width == sizeof(uint8_t)) {
+
+#ifndef _WIN32
+        if ((hdr.flags & SIGFILE_FLAG_LZ4) == 0) {
+            res = sigfile_map_u8(f, &hdr);
+        }
+#endif
+        if (res != PM3_SUCCESS && fseek(f, hdr.header_len, SEEK_SET) == 0) {
+            uint8_t *samples = graph_reset_u8(n, hdr.bias);
+            res = (samples) ? sigfile_read_payload(f, &hdr, samples, n) : PM3_EMALLOC;
+        }
+
+    } else if (fseek(f, hdr.header_len, SEEK_SET) == 0) {
+
+        uint8_t *raw = calloc(n, sizeof(int32_t));
+        int32_t *gb = (raw) ? graph_reserve(n) : NULL;
+        if (gb == NULL) {
+            res = PM3_EMALLOC;
+        } else {
+            res = sigfile_read_payload(f, &hdr, raw, n * sizeof(int32_t));
+            if (res == PM3_SUCCESS) {
+                for (size_t i = 0; i < n; i++) {
+                    gb[i] = (int32_t)MemLeToUint4byte(raw + (i * sizeof(int32_t)));
+                }
+                g_GraphTraceLen = n;
+                graph_compact();
+            }
+        }
+        free(raw);
+    }
+    fclose(f);
+
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(WARNING, "failed to read samples from `" _YELLOW_("%s") "`", path);
+        g_GraphTraceLen = 0;
+        return res;
+    }
+
+    memset(&capture_info, 0, sizeof(capture_info));
+    capture_info.sample_rate = hdr.sample_rate;
+    capture_info.bits_per_sample = hdr.bits_per_sample;
+    capture_info.decimation = hdr.decimation;
+    memcpy(capture_info.source, hdr.source, sizeof(capture_info.source));
+    capture_info.source[sizeof(capture_info.source) - 1] = '\0';
+
+    PrintAndLogEx(INFO, "binary trace, " _YELLOW_("%s") "%s"
+                  , (hdr.flags & SIGFILE_FLAG_LZ4) ? "lz4" : "raw"
+                  , (hdr.width == sizeof(uint8_t)) ? ", 8 bit" : ", 32 bit"
+                 );
+    if (capture_info.source[0]) {
+        PrintAndLogEx(INFO, "source " _YELLOW_("%s"), capture_info.source);
+    }
+    if (capture_info.sample_rate) {
+        PrintAndLogEx(INFO, "sampled @ " _YELLOW_("%u") " Hz, " _YELLOW_("%u") " bits/smpl, decimation 1:%u"
+                      , capture_info.sample_rate
+                      , capture_info.bits_per_sample
+                      , capture_info.decimation
+                     );
+    }
+    return PM3_SUCCESS;
+}
@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Binary signal trace files (.pm3b)
+//
+// A fixed size header followed by the samples,  either stored as they are or
+// as a sequence of common/lz4block blocks.  Uncompressed 8 bit
+// traces are mapped straight into the graph buffer without copying.
+//-----------------------------------------------------------------------------
+
+#ifndef SIGFILE_H__
+#define SIGFILE_H__
+
+#include "common.h"
+#include "pm3_cmd.h"    // sample_config
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIGFILE_MAGIC           "PM3S"
+#define SIGFILE_VERSION         1
+#define SIGFILE_EXT             ".pm3b"
+
+#define SIGFILE_FLAG_LZ4        0x00000001
+
+
+// all fields little endian
+typedef struct {
+    uint8_t magic[4];           // SIGFILE_MAGIC
+    uint16_t version;
+    uint16_t header_len;        // the samples start here
+    uint32_t flags;
+    uint32_t sample_rate;       // ADC rate in Hz before decimation,  0 if unknown
+    uint8_t bits_per_sample;    // as captured,  0 if unknown
+    uint8_t width;              // bytes per stored sample, 1 (sample = raw - bias) or 4 (int32)
+    uint16_t decimation;        // 0 if unknown
+    int32_t bias;
+    uint64_t samples;
+    uint32_t block_samples;     // LZ4 only
+    uint32_t block_count;       // LZ4 only
+    char source[40];            // what produced the samples,  nul terminated
+} PACKED sigfile_header_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    uint8_t bits_per_sample;
+    uint16_t decimation;
+    char source[40];
+} sigfile_info_t;
+
+void sigfile_set_capture(const sample_config *sc, const char *source);
+const sigfile_info_t *sigfile_get_capture(void);
+
+bool sigfile_is_sigfile(const char *path);
+int sigfile_save(const char *preferredName, const int *data, size_t datalen, bool compress);
+int sigfile_load(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
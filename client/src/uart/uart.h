@@ -62,6 +62,17 @@ void uart_close(const serial_port sp);
  */
 int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen);
 
+/* Like uart_receive(), but returns as soon as some data got read instead of
+ * waiting for more until pszMaxRxLen bytes are there or the port times out.
+ * Meant for reading big chunks into a buffer and taking them apart from there.
+ */
+int uart_receive_some(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen);
+
+/* Makes a uart_receive_some() waiting for data in another thread return early,
+ * e.g. because there is something to send.
+ */
+void uart_wake_receive(void);
+
 /* Sends a buffer to a given serial port.
  *   pbtTx: A pointer to a buffer containing the data to send.
  *   len: The amount of data to be sent.
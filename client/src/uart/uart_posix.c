@@ -72,6 +72,9 @@ static uint32_t newtimeout_value = 0;
 static bool newtimeout_pending = false;
 static uint8_t rx_empty_counter = 0;
 
+// written to by uart_wake_receive() to end the wait in uart_receive_some()
+static int wake_pipe[2] = { -1, -1 };
+
 int uart_reconfigure_timeouts(uint32_t value) {
     newtimeout_value = value;
     newtimeout_pending = true;
@@ -92,6 +95,12 @@ serial_port uart_open(const char *pcPortName, uint32_t speed, bool slient) {
 
     sp->udpBuffer = NULL;
     rx_empty_counter = 0;
+
+    // one for all ports, only one is read at a time
+    if (wake_pipe[0] < 0 && pipe(wake_pipe) == 0) {
+        fcntl(wake_pipe[0], F_SETFL, fcntl(wake_pipe[0], F_GETFL) | O_NONBLOCK);
+        fcntl(wake_pipe[1], F_SETFL, fcntl(wake_pipe[1], F_GETFL) | O_NONBLOCK);
+    }
     // init timeouts
     timeout.tv_usec = UART_FPC_CLIENT_RX_TIMEOUT_MS * 1000;
     g_conn.send_via_local_ip = false;
@@ -472,7 +481,7 @@ void uart_close(const serial_port sp) {
     free(sp);
 }
 
-int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+static int uart_receive_internal(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen, bool wait_all) {
     uint32_t byteCount;  // FIONREAD returns size on 32b
     fd_set rfds;
     struct timeval tv;
@@ -498,7 +507,7 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
             res = RingBuf_dequeueBatch(spu->udpBuffer, pbtRx + (*pszRxLen), byteCount);
             *pszRxLen += res;
 
-            if (*pszRxLen == pszMaxRxLen) {
+            if (*pszRxLen == pszMaxRxLen || (wait_all == false && *pszRxLen > 0)) {
                 // We have all the data we wanted.
                 return PM3_SUCCESS;
             }
@@ -507,14 +516,29 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
         // Reset file descriptor
         FD_ZERO(&rfds);
         FD_SET(spu->fd, &rfds);
+        int nfds = spu->fd + 1;
+        bool wakeable = (wait_all == false && wake_pipe[0] >= 0);
+        if (wakeable) {
+            FD_SET(wake_pipe[0], &rfds);
+            nfds = MAX(nfds, wake_pipe[0] + 1);
+        }
         tv = timeout;
-        res = select(spu->fd + 1, &rfds, NULL, NULL, &tv);
+        res = select(nfds, &rfds, NULL, NULL, &tv);
 
         // Read error
         if (res < 0) {
             return PM3_EIO;
         }
 
+        if (res > 0 && wakeable && FD_ISSET(wake_pipe[0], &rfds)) {
+            uint8_t dummy[16];
+            while (read(wake_pipe[0], dummy, sizeof(dummy)) > 0) {};
+            // woken up and nothing to read, same as a time-out
+            if (FD_ISSET(spu->fd, &rfds) == false) {
+                res = 0;
+            }
+        }
+
         // Read time-out
         if (res == 0) {
             if (*pszRxLen == 0) {
@@ -582,7 +606,7 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
 
         *pszRxLen += res;
 
-        if (*pszRxLen == pszMaxRxLen) {
+        if (*pszRxLen == pszMaxRxLen || wait_all == false) {
             // We have all the data we wanted.
             return PM3_SUCCESS;
         }
@@ -591,6 +615,22 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
     return PM3_SUCCESS;
 }
 
+int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+    return uart_receive_internal(sp, pbtRx, pszMaxRxLen, pszRxLen, true);
+}
+
+int uart_receive_some(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+    return uart_receive_internal(sp, pbtRx, pszMaxRxLen, pszRxLen, false);
+}
+
+void uart_wake_receive(void) {
+    if (wake_pipe[1] >= 0) {
+        uint8_t b = 0;
+        // a full pipe is a pending wake up already
+        if (write(wake_pipe[1], &b, sizeof(b)) < 0) {};
+    }
+}
+
 int uart_send(const serial_port sp, const uint8_t *pbtTx, const uint32_t len) {
     uint32_t pos = 0;
     fd_set rfds;
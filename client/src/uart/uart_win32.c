@@ -365,10 +365,10 @@ uint32_t uart_get_speed(const serial_port sp) {
     return 0;
 }
 
-int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+static int uart_receive_internal(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen, bool wait_all) {
     const serial_port_windows_t *spw = (serial_port_windows_t *)sp;
     if (spw->hSocket == INVALID_SOCKET) {
-        // serial port
+        // serial port, ReadFile() already returns once no more bytes came in for ReadIntervalTimeout
         uart_reconfigure_timeouts_polling(sp);
 
         int res = ReadFile(spw->hPort, pbtRx, pszMaxRxLen, (LPDWORD)pszRxLen, NULL);
@@ -408,7 +408,7 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
                 res = RingBuf_dequeueBatch(spw->udpBuffer, pbtRx + (*pszRxLen), byteCount);
                 *pszRxLen += res;
 
-                if (*pszRxLen == pszMaxRxLen) {
+                if (*pszRxLen == pszMaxRxLen || (wait_all == false && *pszRxLen > 0)) {
                     // We have all the data we wanted.
                     return PM3_SUCCESS;
                 }
@@ -493,7 +493,7 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
 
             *pszRxLen += res;
 
-            if (*pszRxLen == pszMaxRxLen) {
+            if (*pszRxLen == pszMaxRxLen || wait_all == false) {
                 // We have all the data we wanted.
                 return PM3_SUCCESS;
             }
@@ -503,6 +503,18 @@ int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uin
     }
 }
 
+int uart_receive(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+    return uart_receive_internal(sp, pbtRx, pszMaxRxLen, pszRxLen, true);
+}
+
+int uart_receive_some(const serial_port sp, uint8_t *pbtRx, uint32_t pszMaxRxLen, uint32_t *pszRxLen) {
+    return uart_receive_internal(sp, pbtRx, pszMaxRxLen, pszRxLen, false);
+}
+
+void uart_wake_receive(void) {
+    // no wake up here, uart_receive_some() returns after the port time-out
+}
+
 int uart_send(const serial_port sp, const uint8_t *p_tx, const uint32_t len) {
     const serial_port_windows_t *spw = (serial_port_windows_t *)sp;
     if (spw->hSocket == INVALID_SOCKET) { // serial port
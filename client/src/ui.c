@@ -43,6 +43,10 @@
 #endif
 
 #include <time.h>
+#include <sched.h>      // sched_yield
+#ifndef _WIN32
+#include <signal.h>     // pthread_sigmask
+#endif
 #include "emojis.h"
 #include "emojis_alt.h"
 session_arg_t g_session;
@@ -234,6 +238,452 @@ void PrintAndLogOptions(const char *str[][2], size_t size, size_t space) {
 
 static uint8_t PrintAndLogEx_spinidx = 0;
 
+// when set, messages from the calling thread are stored here instead of being printed
+static __thread log_capture_t *log_capture = NULL;
+
+static void capture_message(logLevel_t level, const char *msg) {
+    size_t n = strlen(msg) + 2;
+    if (log_capture->len + n > log_capture->size) {
+        size_t size = (log_capture->size) ? log_capture->size * 2 : 1024;
+        while (size < log_capture->len + n) {
+            size *= 2;
+        }
+        char *tmp = realloc(log_capture->data, size);
+        if (tmp == NULL) {
+            return;
+        }
+        log_capture->data = tmp;
+        log_capture->size = size;
+    }
+    log_capture->data[log_capture->len] = (char)level;
+    memcpy(log_capture->data + log_capture->len + 1, msg, n - 1);
+    log_capture->len += n;
+}
+
+// hold back the messages of the calling thread,  they can be printed later from any thread
+void PrintAndLogCaptureStart(log_capture_t *cap) {
+    log_capture = cap;
+}
+
+void PrintAndLogCaptureStop(void) {
+    log_capture = NULL;
+}
+
+void PrintAndLogCaptureReplay(const log_capture_t *cap) {
+    size_t i = 0;
+    while (i < cap->len) {
+        logLevel_t level = (logLevel_t)cap->data[i];
+        const char *msg = cap->data + i + 1;
+        PrintAndLogEx(level, "%s", msg);
+        i += strlen(msg) + 2;
+    }
+}
+
+void PrintAndLogCaptureFree(log_capture_t *cap) {
+    free(cap->data);
+    memset(cap, 0, sizeof(log_capture_t));
+}
+
+// Asynchronous output
+//
+// PrintAndLogEx formats in the calling thread and hands the finished text to a
+// logger thread over a lock free MPSC queue (Vyukov's intrusive queue). The
+// logger writes whatever has been queued in one go and flushes stdout and the
+// session log once per batch instead of once per line. PrintAndLogFlush() waits
+// until everything queued so far is written, call it before reading from the user.
+typedef struct log_record_s {
+    struct log_record_s *next;
+    uint8_t kind;
+    FILE *stream;
+    bool *done;             // flush barrier, set once the logger got there
+    size_t termlen;
+    size_t loglen;
+    char text[];            // terminal text followed by session log text
+} log_record_t;
+
+#define LOG_RECORD_TEXT     0
+#define LOG_RECORD_FLUSH    1
+#define LOG_RECORD_STOP     2
+
+// queued bytes before producers wait for the logger to catch up
+#define LOG_QUEUE_MAX       (4 * 1024 * 1024)
+
+// once woken up the logger lets a batch build up for this long, unless someone waits on a flush
+#define LOG_LINGER_NS       (1000 * 1000)
+
+static log_record_t log_stub;
+static log_record_t log_stop_record = { .kind = LOG_RECORD_STOP };
+static log_record_t *log_head = &log_stub;      // producers push here
+static log_record_t *log_tail = &log_stub;      // the logger pops here
+static size_t log_pending = 0;
+static bool log_running = false;
+static bool log_sleeping = false;
+static bool log_urgent = false;
+static pthread_t log_thread;
+static pthread_once_t log_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t log_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t log_flushed = PTHREAD_COND_INITIALIZER;
+
+// session log, only written by whoever writes the output
+static FILE *logfile = NULL;
+static int logging = 1;
+
+static void log_push(log_record_t *rec) {
+    rec->next = NULL;
+    log_record_t *prev = __atomic_exchange_n(&log_head, rec, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&prev->next, rec, __ATOMIC_RELEASE);
+}
+
+// NULL when empty, or when a producer is halfway through a push
+static log_record_t *log_pop(void) {
+    log_record_t *tail = log_tail;
+    log_record_t *next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+
+    if (tail == &log_stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        log_tail = next;
+        tail = next;
+        next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+    }
+
+    if (next != NULL) {
+        log_tail = next;
+        return tail;
+    }
+
+    if (tail != __atomic_load_n(&log_head, __ATOMIC_SEQ_CST)) {
+        return NULL;
+    }
+
+    log_push(&log_stub);
+    next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+    if (next != NULL) {
+        log_tail = next;
+        return tail;
+    }
+    return NULL;
+}
+
+static bool log_empty(void) {
+    return __atomic_load_n(&log_head, __ATOMIC_SEQ_CST) == log_tail;
+}
+
+static void log_wake(void) {
+    if (__atomic_load_n(&log_sleeping, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&log_lock);
+        pthread_cond_signal(&log_wakeup);
+        pthread_mutex_unlock(&log_lock);
+    }
+}
+
+static bool log_open(void) {
+
+    if (logfile != NULL) {
+        return true;
+    }
+
+    if (__atomic_load_n(&logging, __ATOMIC_RELAXED) == 0) {
+        return false;
+    }
+
+    char *my_logfile_path = NULL;
+    char filename[40];
+    struct tm *timenow;
+    time_t now = time(NULL);
+    timenow = gmtime(&now);
+    strftime(filename, sizeof(filename), PROXLOG, timenow);
+
+    if (searchHomeFilePath(&my_logfile_path, LOGS_SUBDIR, filename, true) != PM3_SUCCESS) {
+        printf(_YELLOW_("[-]") " Logging disabled!\n");
+        __atomic_store_n(&logging, 0, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    logfile = fopen(my_logfile_path, "a");
+    if (logfile == NULL) {
+        printf(_YELLOW_("[-]") " Can't open logfile %s, logging disabled!\n", my_logfile_path);
+        __atomic_store_n(&logging, 0, __ATOMIC_RELAXED);
+    } else {
+        if (g_session.supports_colors) {
+            printf("["_YELLOW_("=")"] Session log " _YELLOW_("%s") "\n", my_logfile_path);
+        } else {
+            printf("[=] Session log %s\n", my_logfile_path);
+        }
+    }
+    free(my_logfile_path);
+    return (logfile != NULL);
+}
+
+// One batch of writes. If there is an incoming message from the hardware (eg: lf hid read)
+// in the background (while the prompt is displayed and accepting user input),
+// stash the prompt for the batch and bring it back afterwards.
+typedef struct {
+    FILE *stream;
+    bool written;
+    bool prompt_saved;
+    char *saved_line;
+    int saved_point;
+} log_batch_t;
+
+static void log_batch_write(log_batch_t *b, const log_record_t *rec) {
+
+    if (rec->loglen) {
+        log_open();
+    }
+
+    if (rec->termlen) {
+#ifdef RL_STATE_READCMD
+        // We are using GNU readline. libedit (OSX) doesn't support this flag.
+        if (b->prompt_saved == false && (rl_readline_state & RL_STATE_READCMD)) {
+            b->saved_point = rl_point;
+            b->saved_line = rl_copy_text(0, rl_end);
+            rl_save_prompt();
+            rl_replace_line("", 0);
+            rl_redisplay();
+            b->prompt_saved = true;
+        }
+#endif
+        // keep stdout and stderr in order
+        if (b->stream != NULL && b->stream != rec->stream) {
+            fflush(b->stream);
+        }
+        b->stream = rec->stream;
+        fwrite(rec->text, 1, rec->termlen, rec->stream);
+    }
+
+    if (rec->loglen && logfile != NULL) {
+        fwrite(rec->text + rec->termlen, 1, rec->loglen, logfile);
+    }
+    b->written = true;
+}
+
+static void log_batch_end(log_batch_t *b) {
+
+    if (b->written == false) {
+        return;
+    }
+
+#ifdef RL_STATE_READCMD
+    if (b->prompt_saved) {
+        rl_restore_prompt();
+        rl_replace_line(b->saved_line, 0);
+        rl_point = b->saved_point;
+        rl_redisplay();
+        free(b->saved_line);
+    }
+#endif
+
+    fflush(stdout);
+    fflush(stderr);
+    if (logfile != NULL) {
+        fflush(logfile);
+    }
+    memset(b, 0, sizeof(log_batch_t));
+}
+
+// Returns true on the stop record
+static bool log_handle(log_batch_t *b, log_record_t *rec) {
+    switch (rec->kind) {
+        case LOG_RECORD_TEXT:
+            log_batch_write(b, rec);
+            __atomic_sub_fetch(&log_pending, rec->termlen + rec->loglen, __ATOMIC_RELAXED);
+            free(rec);
+            return false;
+        case LOG_RECORD_FLUSH:
+            log_batch_end(b);
+            pthread_mutex_lock(&log_lock);
+            *rec->done = true;
+            pthread_cond_broadcast(&log_flushed);
+            pthread_mutex_unlock(&log_lock);
+            free(rec);
+            return false;
+        default:
+            log_batch_end(b);
+            return true;
+    }
+}
+
+static void log_linger(void) {
+    struct timespec ts;
+    cond_deadline(&ts, LOG_LINGER_NS);
+
+    pthread_mutex_lock(&log_lock);
+    while (log_urgent == false) {
+        if (pthread_cond_timedwait(&log_wakeup, &log_lock, &ts) != 0) {
+            break;
+        }
+    }
+    log_urgent = false;
+    pthread_mutex_unlock(&log_lock);
+}
+
+static void *log_worker(void *arg) {
+    (void)arg;
+    log_batch_t batch = {0};
+
+    for (;;) {
+        // a batch is written under the print lock, so a producer holding it sees nothing in flight
+        bool stop = false;
+        pthread_mutex_lock(&g_print_lock);
+        log_record_t *rec;
+        while ((rec = log_pop()) != NULL) {
+            if (log_handle(&batch, rec)) {
+                stop = true;
+                break;
+            }
+        }
+        log_batch_end(&batch);
+        pthread_mutex_unlock(&g_print_lock);
+
+        if (stop) {
+            return NULL;
+        }
+
+        // a producer is halfway through a push
+        if (log_empty() == false) {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&log_lock);
+        __atomic_store_n(&log_sleeping, true, __ATOMIC_SEQ_CST);
+        while (log_empty()) {
+            pthread_cond_wait(&log_wakeup, &log_lock);
+        }
+        __atomic_store_n(&log_sleeping, false, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&log_lock);
+
+        log_linger();
+    }
+}
+
+static void log_stop(void) {
+
+    if (__atomic_exchange_n(&log_running, false, __ATOMIC_SEQ_CST) == false) {
+        return;
+    }
+
+    log_push(&log_stop_record);
+    log_wake();
+    pthread_join(log_thread, NULL);
+
+    // whatever came in while stopping
+    pthread_mutex_lock(&g_print_lock);
+    log_batch_t batch = {0};
+    log_record_t *rec;
+    while ((rec = log_pop()) != NULL) {
+        log_handle(&batch, rec);
+    }
+    log_batch_end(&batch);
+    pthread_mutex_unlock(&g_print_lock);
+}
+
+static void log_start(void) {
+    // only the logger waits on it, with a deadline from cond_deadline()
+    cond_init_monotonic(&log_wakeup);
+    __atomic_store_n(&log_running, true, __ATOMIC_SEQ_CST);
+#ifndef _WIN32
+    // signals go to the other threads, a handler flushing the log can't run on the logger itself
+    sigset_t all, prev;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &prev);
+#endif
+    int res = pthread_create(&log_thread, NULL, log_worker, NULL);
+#ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &prev, NULL);
+#endif
+    if (res != 0) {
+        __atomic_store_n(&log_running, false, __ATOMIC_SEQ_CST);
+        return;
+    }
+    atexit(log_stop);
+}
+
+// Queues terminal and session log text, either may be NULL. A linefeed is added to both
+static void log_post(FILE *stream, const char *term, const char *logtext, bool linefeed) {
+
+    size_t termlen = (term) ? strlen(term) + linefeed : 0;
+    size_t loglen = (logtext) ? strlen(logtext) + linefeed : 0;
+    if (termlen + loglen == 0) {
+        return;
+    }
+
+    pthread_once(&log_once, log_start);
+
+    log_record_t *rec = malloc(sizeof(log_record_t) + termlen + loglen);
+    if (rec == NULL) {
+        return;
+    }
+    rec->kind = LOG_RECORD_TEXT;
+    rec->stream = stream;
+    rec->done = NULL;
+    rec->termlen = termlen;
+    rec->loglen = loglen;
+    if (termlen) {
+        memcpy(rec->text, term, termlen - linefeed);
+        if (linefeed) {
+            rec->text[termlen - 1] = '\n';
+        }
+    }
+    if (loglen) {
+        memcpy(rec->text + termlen, logtext, loglen - linefeed);
+        if (linefeed) {
+            rec->text[termlen + loglen - 1] = '\n';
+        }
+    }
+
+    // no logger thread, or flushing after every write with nothing queued: write it out here
+    bool running = __atomic_load_n(&log_running, __ATOMIC_SEQ_CST);
+    if (running == false || flushAfterWrite) {
+        pthread_mutex_lock(&g_print_lock);
+        if (running == false || log_empty()) {
+            log_batch_t batch = {0};
+            log_batch_write(&batch, rec);
+            log_batch_end(&batch);
+            pthread_mutex_unlock(&g_print_lock);
+            free(rec);
+            return;
+        }
+        pthread_mutex_unlock(&g_print_lock);
+    }
+
+    size_t pending = __atomic_add_fetch(&log_pending, termlen + loglen, __ATOMIC_RELAXED);
+    log_push(rec);
+    log_wake();
+
+    if (flushAfterWrite || pending > LOG_QUEUE_MAX) {
+        PrintAndLogFlush();
+    }
+}
+
+void PrintAndLogFlush(void) {
+
+    if (__atomic_load_n(&log_running, __ATOMIC_SEQ_CST) == false) {
+        return;
+    }
+
+    log_record_t *rec = calloc(1, sizeof(log_record_t));
+    if (rec == NULL) {
+        return;
+    }
+
+    bool done = false;
+    rec->kind = LOG_RECORD_FLUSH;
+    rec->done = &done;
+    log_push(rec);
+
+    pthread_mutex_lock(&log_lock);
+    log_urgent = true;
+    pthread_cond_signal(&log_wakeup);
+    while (done == false) {
+        pthread_cond_wait(&log_flushed, &log_lock);
+    }
+    pthread_mutex_unlock(&log_lock);
+}
+
 void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
 
     // skip debug messages if client debugging is turned off i.e. 'DATA SETDEBUG -0'
@@ -246,6 +696,16 @@ void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
         return;
     }
 
+    if (log_capture != NULL) {
+        char msg[MAX_PRINT_BUFFER] = {0};
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(msg, sizeof(msg), fmt, args);
+        va_end(args);
+        capture_message(level, msg);
+        return;
+    }
+
     char prefix[40] = {0};
     char buffer[MAX_PRINT_BUFFER] = {0};
     char buffer2[MAX_PRINT_BUFFER + sizeof(prefix)] = {0};
@@ -358,9 +818,9 @@ void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
                 char buffer3[sizeof(buffer2)] = {0};
                 char buffer4[sizeof(buffer2)] = {0};
                 memcpy_filter_ansi(buffer3, buffer2, sizeof(buffer2), !g_session.supports_colors);
-                memcpy_filter_emoji(buffer4, buffer3, sizeof(buffer3), g_session.emoji_mode);
-                fprintf(stream, "\r%s", buffer4);
-                fflush(stream);
+                buffer4[0] = '\r';
+                memcpy_filter_emoji(buffer4 + 1, buffer3, sizeof(buffer3) - 1, g_session.emoji_mode);
+                log_post(stream, buffer4, NULL, false);
             }
         } else {
             fPrintAndLog(stream, "%s", buffer2);
@@ -370,71 +830,17 @@ void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
 
 static void fPrintAndLog(FILE *stream, const char *fmt, ...) {
     va_list argptr;
-    static FILE *logfile = NULL;
-    static int logging = 1;
     char buffer[MAX_PRINT_BUFFER] = {0};
     char buffer2[MAX_PRINT_BUFFER] = {0};
     char buffer3[MAX_PRINT_BUFFER] = {0};
+    char buffer4[MAX_PRINT_BUFFER] = {0};
 
     bool linefeed = true;
 
-    if (logging && g_session.incognito) {
-        logging = 0;
-    }
-
-    if ((g_printAndLog & PRINTANDLOG_LOG) && logging && !logfile) {
-        char *my_logfile_path = NULL;
-        char filename[40];
-        struct tm *timenow;
-        time_t now = time(NULL);
-        timenow = gmtime(&now);
-        strftime(filename, sizeof(filename), PROXLOG, timenow);
-
-        if (searchHomeFilePath(&my_logfile_path, LOGS_SUBDIR, filename, true) != PM3_SUCCESS) {
-
-            printf(_YELLOW_("[-]") " Logging disabled!\n");
-            my_logfile_path = NULL;
-            logging = 0;
-
-        } else {
-
-            logfile = fopen(my_logfile_path, "a");
-            if (logfile == NULL) {
-                printf(_YELLOW_("[-]") " Can't open logfile %s, logging disabled!\n", my_logfile_path);
-                logging = 0;
-            } else {
-
-                if (g_session.supports_colors) {
-                    printf("["_YELLOW_("=")"] Session log " _YELLOW_("%s") "\n", my_logfile_path);
-                } else {
-                    printf("[=] Session log %s\n", my_logfile_path);
-                }
-
-            }
-            free(my_logfile_path);
-        }
+    if (g_session.incognito) {
+        __atomic_store_n(&logging, 0, __ATOMIC_RELAXED);
     }
-
-    // lock this section to avoid interlacing prints from different threads
-    pthread_mutex_lock(&g_print_lock);
-
-// If there is an incoming message from the hardware (eg: lf hid read) in
-// the background (while the prompt is displayed and accepting user input),
-// stash the prompt and bring it back later.
-#ifdef RL_STATE_READCMD
-    // We are using GNU readline. libedit (OSX) doesn't support this flag.
-    int need_hack = (rl_readline_state & RL_STATE_READCMD) > 0;
-    char *saved_line;
-    int saved_point;
-
-    if (need_hack) {
-        saved_point = rl_point;
-        saved_line = rl_copy_text(0, rl_end);
-        rl_save_prompt();
-        rl_replace_line("", 0);
-        rl_redisplay();
-    }
-#endif
+    bool to_log = (g_printAndLog & PRINTANDLOG_LOG) && __atomic_load_n(&logging, __ATOMIC_RELAXED);
 
     va_start(argptr, fmt);
     vsnprintf(buffer, sizeof(buffer), fmt, argptr);
@@ -447,68 +853,34 @@ static void fPrintAndLog(FILE *stream, const char *fmt, ...) {
     bool filter_ansi = !g_session.supports_colors;
     memcpy_filter_ansi(buffer2, buffer, sizeof(buffer), filter_ansi);
 
+    const char *term = NULL;
     if ((g_printAndLog & PRINTANDLOG_PRINT) == PRINTANDLOG_PRINT) {
-        memcpy_filter_emoji(buffer3, buffer2, sizeof(buffer2), g_session.emoji_mode);
-        fprintf(stream, "%s", buffer3);
-        if (linefeed) {
-            fprintf(stream, "\n");
-        }
+        memcpy_filter_emoji(buffer4, buffer2, sizeof(buffer2), g_session.emoji_mode);
+        term = buffer4;
     }
 
-#ifdef RL_STATE_READCMD
-    // We are using GNU readline. libedit (OSX) doesn't support this flag.
-    if (need_hack) {
-        rl_restore_prompt();
-        rl_replace_line(saved_line, 0);
-        rl_point = saved_point;
-        rl_redisplay();
-        free(saved_line);
-    }
-#endif
-
-    if (((g_printAndLog & PRINTANDLOG_LOG) && logging && logfile) ||
-            (g_printAndLog & PRINTANDLOG_GRAB)) {
+    const char *logtext = NULL;
+    if (to_log || (g_printAndLog & PRINTANDLOG_GRAB)) {
 
         memcpy_filter_emoji(buffer3, buffer2, sizeof(buffer2), EMO_ALTTEXT);
 
         if (filter_ansi == false) {
             memcpy_filter_ansi(buffer, buffer3, sizeof(buffer3), true);
         }
-    }
-
-    if ((g_printAndLog & PRINTANDLOG_LOG) && logging && logfile) {
-
-        if (filter_ansi) {
-            fprintf(logfile, "%s", buffer3);
-        } else {
-            fprintf(logfile, "%s", buffer);
-        }
-
-        if (linefeed) {
-            fprintf(logfile, "\n");
-        }
-        fflush(logfile);
+        logtext = (filter_ansi) ? buffer3 : buffer;
     }
 
     if (g_printAndLog & PRINTANDLOG_GRAB) {
-
-        if (filter_ansi) {
-            fill_grabber(buffer3);
-        } else {
-            fill_grabber(buffer);
-        }
-
+        // lock this section to avoid interlacing grabbed output from different threads
+        pthread_mutex_lock(&g_print_lock);
+        fill_grabber(logtext);
         if (linefeed) {
             fill_grabber("\n");
         }
+        pthread_mutex_unlock(&g_print_lock);
     }
 
-    if (flushAfterWrite) {
-        fflush(stdout);
-    }
-
-    //release lock
-    pthread_mutex_unlock(&g_print_lock);
+    log_post(stream, term, (to_log) ? logtext : NULL, linefeed);
 }
 
 void SetFlushAfterWrite(bool value) {
@@ -763,21 +1135,22 @@ void print_progress(uint64_t count, uint64_t max, barMode_t style) {
         snprintf(cbar,  collen,  "%s", bar);
     }
 
+    char line[MAX_PRINT_BUFFER] = {0};
     switch (style) {
         case STYLE_BAR: {
-            printf("\b%c[2K\r[" _YELLOW_("=")"] %s", 27, cbar);
+            snprintf(line, sizeof(line), "\b%c[2K\r[" _YELLOW_("=")"] %s", 27, cbar);
             break;
         }
         case STYLE_MIXED: {
-            printf("\b%c[2K\r[" _YELLOW_("=")"] %s [ %"PRIu64" mV / %2u V / %2u Vmax ]", 27, cbar, count, (uint32_t)(count / 1000), (uint32_t)(max / 1000));
+            snprintf(line, sizeof(line), "\b%c[2K\r[" _YELLOW_("=")"] %s [ %"PRIu64" mV / %2u V / %2u Vmax ]", 27, cbar, count, (uint32_t)(count / 1000), (uint32_t)(max / 1000));
             break;
         }
         case STYLE_VALUE: {
-            printf("[" _YELLOW_("=")"] %"PRIu64" mV / %2u V / %2u Vmax   \r", count, (uint32_t)(count / 1000), (uint32_t)(max / 1000));
+            snprintf(line, sizeof(line), "[" _YELLOW_("=")"] %"PRIu64" mV / %2u V / %2u Vmax   \r", count, (uint32_t)(count / 1000), (uint32_t)(max / 1000));
             break;
         }
     }
-    fflush(stdout);
+    log_post(stdout, line, NULL, false);
     free(bar);
     free(cbar);
 }
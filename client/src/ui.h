@@ -33,6 +33,7 @@ extern "C" {
 typedef enum {STYLE_BAR, STYLE_MIXED, STYLE_VALUE} barMode_t;
 typedef enum logLevel {NORMAL, SUCCESS, INFO, FAILED, WARNING, ERR, DEBUG, INPLACE, HINT} logLevel_t;
 typedef enum emojiMode {EMO_ALIAS, EMO_EMOJI, EMO_ALTTEXT, EMO_NONE} emojiMode_t;
+typedef enum {COMPRESS_AUTO, COMPRESS_ON, COMPRESS_OFF} compressMode_t;
 typedef enum clientdebugLevel {cdbOFF, cdbSIMPLE, cdbFULL} clientdebugLevel_t;
 // typedef enum devicedebugLevel {ddbOFF, ddbERROR, ddbINFO, ddbDEBUG, ddbEXTENDED} devicedebugLevel_t;
 
@@ -63,6 +64,7 @@ typedef struct {
     char *history_path;
     pm3_device_t *current_device;
     uint32_t timeout;
+    compressMode_t download_compression;
 } session_arg_t;
 
 extern session_arg_t g_session;
@@ -72,9 +74,21 @@ extern session_arg_t g_session;
 #endif
 #define MAX_PRINT_BUFFER 2048
 
+// messages held back while a thread captures its output,  stored as level byte + NUL terminated text
+typedef struct {
+    char *data;
+    size_t len;
+    size_t size;
+} log_capture_t;
+
 #define PROMPT_CLEARLINE PrintAndLogEx(INPLACE, "                                          \r")
 void PrintAndLogOptions(const char *str[][2], size_t size, size_t space);
 void PrintAndLogEx(logLevel_t level, const char *fmt, ...);
+void PrintAndLogCaptureStart(log_capture_t *cap);
+void PrintAndLogCaptureStop(void);
+void PrintAndLogCaptureReplay(const log_capture_t *cap);
+void PrintAndLogCaptureFree(log_capture_t *cap);
+void PrintAndLogFlush(void);
 void SetFlushAfterWrite(bool value);
 bool GetFlushAfterWrite(void);
 void memcpy_filter_ansi(void *dest, const void *src, size_t n, bool filter);
@@ -1305,6 +1305,37 @@ int detect_num_CPUs(void) {
 #endif
 }
 
+// macOS and Windows condvars only time out on the wall clock
+#if defined(CLOCK_MONOTONIC) && !defined(_WIN32) && !defined(__APPLE__)
+#define COND_MONOTONIC
+#define COND_CLOCK CLOCK_MONOTONIC
+#else
+#define COND_CLOCK CLOCK_REALTIME
+#endif
+
+int cond_init_monotonic(pthread_cond_t *cond) {
+#ifdef COND_MONOTONIC
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    int res = pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+    return res;
+#else
+    return pthread_cond_init(cond, NULL);
+#endif
+}
+
+void cond_deadline(struct timespec *deadline, uint64_t ns) {
+    clock_gettime(COND_CLOCK, deadline);
+    deadline->tv_sec += ns / 1000000000;
+    deadline->tv_nsec += ns % 1000000000;
+    if (deadline->tv_nsec >= 1000000000L) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
 void str_lower(char *s) {
     for (size_t i = 0; i < strlen(s); i++) {
         s[i] = tolower(s[i]);
@@ -19,6 +19,8 @@
 #define __UTIL_H_
 
 #include "common.h"
+#include <pthread.h>
+#include <time.h>
 
 #ifdef ANDROID
 #include <endian.h>
@@ -156,6 +158,11 @@ uint64_t HornerScheme(uint64_t num, uint64_t divider, uint64_t factor);
 int num_CPUs(void);
 int detect_num_CPUs(void); // number of logical CPUs
 
+// condition variable for pthread_cond_timedwait() with a deadline from cond_deadline().
+// Both run on CLOCK_MONOTONIC where the platform lets the condvar use it
+int cond_init_monotonic(pthread_cond_t *cond);
+void cond_deadline(struct timespec *deadline, uint64_t ns);
+
 void str_lower(char *s); // converts string to lower case
 void str_upper(char *s); // converts string to UPPER case
 void strn_upper(char *s, size_t n);
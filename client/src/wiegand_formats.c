@@ -17,6 +17,7 @@
 //-----------------------------------------------------------------------------
 #include "wiegand_formats.h"
 #include <stdlib.h>
+#include <pthread.h>
 #include "commonutil.h"
 
 static bool step_parity_check(wiegand_message_t *packed, int start, int length, bool even_parity) {
@@ -1499,6 +1500,42 @@ static const cardformat_t FormatTable[] = {
     {NULL, NULL, NULL, NULL, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0}} // Must null terminate array
 };
 
+// Every Unpack function starts by rejecting messages of the wrong length,  so only
+// the formats of the message's bit length need to be tried.  Format indexes grouped
+// by length,  in table order,  built once on first use.
+static uint8_t format_by_len[ARRAYLEN(FormatTable)];
+static uint8_t format_by_len_start[WIEGAND_MAX_BITS + 2];
+static pthread_once_t format_by_len_once = PTHREAD_ONCE_INIT;
+
+static void format_by_len_init(void) {
+    uint8_t cnt[WIEGAND_MAX_BITS + 1] = {0};
+    for (int i = 0; FormatTable[i].Name; i++) {
+        cnt[FormatTable[i].Bits]++;
+    }
+
+    format_by_len_start[0] = 0;
+    for (int len = 0; len <= WIEGAND_MAX_BITS; len++) {
+        format_by_len_start[len + 1] = format_by_len_start[len] + cnt[len];
+    }
+
+    uint8_t pos[WIEGAND_MAX_BITS + 1];
+    memcpy(pos, format_by_len_start, sizeof(pos));
+    for (int i = 0; FormatTable[i].Name; i++) {
+        format_by_len[pos[FormatTable[i].Bits]++] = i;
+    }
+}
+
+int HIDFormatsByLength(uint8_t len, const uint8_t **idx) {
+    pthread_once(&format_by_len_once, format_by_len_init);
+
+    if (len > WIEGAND_MAX_BITS) {
+        *idx = NULL;
+        return 0;
+    }
+    *idx = &format_by_len[format_by_len_start[len]];
+    return format_by_len_start[len + 1] - format_by_len_start[len];
+}
+
 void HIDListFormats(void) {
     if (FormatTable[0].Name == NULL)
         return;
@@ -1591,27 +1628,40 @@ void HIDPackTryAll(wiegand_card_t *card, bool preamble) {
     PrintAndLogEx(NORMAL, "");
 }
 
+int HIDUnpackMatches(wiegand_message_t *packed, wiegand_match_t *matches, int max) {
+
+    const uint8_t *idx;
+    int n = HIDFormatsByLength(packed->Length, &idx);
+
+    int found = 0;
+    for (int i = 0; i < n && found < max; i++) {
+        memset(&matches[found].card, 0, sizeof(wiegand_card_t));
+        if (FormatTable[idx[i]].Unpack(packed, &matches[found].card)) {
+            matches[found].format_idx = idx[i];
+            found++;
+        }
+    }
+    return found;
+}
+
 bool HIDTryUnpack(wiegand_message_t *packed) {
     if (FormatTable[0].Name == NULL) {
         return false;
     }
 
-    wiegand_card_t card;
-    memset(&card, 0, sizeof(wiegand_card_t));
     uint8_t found_cnt = 0, found_invalid_par = 0;
 
-    int i = 0;
-    while (FormatTable[i].Name) {
-        if (FormatTable[i].Unpack(packed, &card)) {
-
-            found_cnt++;
-            hid_print_card(&card, FormatTable[i]);
-            // if fields has parity AND card parity is false
-            if (FormatTable[i].Fields.hasParity && (card.ParityValid == false)) {
-                found_invalid_par++;
-            }
+    wiegand_match_t matches[WIEGAND_MAX_MATCHES];
+    int n = HIDUnpackMatches(packed, matches, ARRAYLEN(matches));
+    for (int i = 0; i < n; i++) {
+        const cardformat_t *fmt = &FormatTable[matches[i].format_idx];
+
+        found_cnt++;
+        hid_print_card(&matches[i].card, *fmt);
+        // if fields has parity AND card parity is false
+        if (fmt->Fields.hasParity && (matches[i].card.ParityValid == false)) {
+            found_invalid_par++;
         }
-        ++i;
     }
 
     if (found_cnt) {
@@ -52,12 +52,24 @@ typedef struct {
     cardformatdescriptor_t Fields;
 } cardformat_t;
 
+// longest wiegand message
+#define WIEGAND_MAX_BITS        96
+// most formats sharing one bit length,  with room to grow
+#define WIEGAND_MAX_MATCHES     16
+
+typedef struct {
+    int format_idx;
+    wiegand_card_t card;
+} wiegand_match_t;
+
 bool validate_card_limit(int format_idx, wiegand_card_t *card);
 void HIDListFormats(void);
 int HIDFindCardFormat(const char *format);
 cardformat_t HIDGetCardFormat(int idx);
 bool HIDPack(int format_idx, wiegand_card_t *card, wiegand_message_t *packed, bool preamble);
 bool HIDTryUnpack(wiegand_message_t *packed);
+int HIDFormatsByLength(uint8_t len, const uint8_t **idx);
+int HIDUnpackMatches(wiegand_message_t *packed, wiegand_match_t *matches, int max);
 void HIDPackTryAll(wiegand_card_t *card, bool preamble);
 void HIDUnpack(int idx, wiegand_message_t *packed);
 bool decode_wiegand(uint32_t top, uint32_t mid, uint32_t bot, int n);
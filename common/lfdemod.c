@@ -45,7 +45,6 @@
 
 #include "lfdemod.h"
 #include <string.h>  // for memset, memcmp and size_t
-#include <stdlib.h>  // qsort
 #include "parity.h"  // for parity test
 #include "pm3_cmd.h" // error codes
 #include "commonutil.h"  // Arraylen
@@ -69,7 +68,12 @@ uint8_t g_debugMode = 0;
 # define prnt Dbprintf
 #endif
 
+#ifndef ON_DEVICE
+// the client demodulates on several threads at once (lf search), each keeps its own
+static __thread signal_t signalprop = { 255, -255, 0, 0, true };
+#else
 static signal_t signalprop = { 255, -255, 0, 0, true };
+#endif
 signal_t *getSignalProperties(void) {
     return &signalprop;
 }
@@ -92,54 +96,133 @@ static void printSignal(void) {
     prnt("  THRESHOLD noise amplitude......%d", NOISE_AMPLITUDE_THRESHOLD);
 }
 
-#ifndef ON_DEVICE
-static int cmp_uint8(const void *a, const void *b) {
-    if (*(const uint8_t *)a < * (const uint8_t *)b)
-        return -1;
-    else
-        return *(const uint8_t *)a > *(const uint8_t *)b;
+// 256 bin histogram of 8bit samples, one pass,  min / max / sum come along for free
+void signalHistogram(signal_hist_t *hist, const uint8_t *samples, uint32_t size) {
+    memset(hist, 0, sizeof(signal_hist_t));
+    hist->min = 255;
+    signalHistogramAdd(hist, samples, size);
 }
-#endif
 
-void computeSignalProperties(const uint8_t *samples, uint32_t size) {
-    resetSignal();
+// add more samples to a histogram,  so it can be built up chunk by chunk
+void signalHistogramAdd(signal_hist_t *hist, const uint8_t *samples, uint32_t size) {
+    if (samples == NULL || size == 0) {
+        return;
+    }
 
-    if (samples == NULL || size < SIGNAL_MIN_SAMPLES) return;
+    // four interleaved tables so runs of equal samples don't stall on the same counter
+    uint32_t part[4][256];
+    memset(part, 0, sizeof(part));
 
-    uint32_t sum = 0;
-    uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
+    uint32_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        part[0][samples[i]]++;
+        part[1][samples[i + 1]]++;
+        part[2][samples[i + 2]]++;
+        part[3][samples[i + 3]]++;
+    }
+    for (; i < size; i++) {
+        part[0][samples[i]]++;
+    }
 
-#ifndef ON_DEVICE
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
+    for (int v = 0; v < 256; v++) {
+        uint32_t n = part[0][v] + part[1][v] + part[2][v] + part[3][v];
+        if (n == 0) {
+            continue;
+        }
+        hist->bins[v] += n;
+        hist->sum += (uint64_t)n * v;
+        if (v < hist->min) hist->min = v;
+        if (v > hist->max) hist->max = v;
+    }
+    hist->count += size;
+}
 
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.1)] + tmp[(int)((offset_size - 1) * 0.1)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.9)] + tmp[(int)((offset_size - 1) * 0.9)]);
+// value at position n when the samples are sorted ascending
+uint8_t signalHistogramNth(const signal_hist_t *hist, uint32_t n) {
+    uint32_t acc = 0;
+    for (int v = 0; v < 256; v++) {
+        acc += hist->bins[v];
+        if (acc > n) {
+            return v;
+        }
+    }
+    return hist->max;
+}
+
+// percentile (0.0 - 1.0),  averaged over the two neighbouring ranks like a sorted copy would give
+uint8_t signalHistogramPercentile(const signal_hist_t *hist, double pct) {
+    if (hist->count == 0) {
+        return 0;
+    }
+    return 0.5 * (signalHistogramNth(hist, (uint32_t)(hist->count * pct)) + signalHistogramNth(hist, (uint32_t)((hist->count - 1) * pct)));
+}
+
+// sum and count of the samples within [low, high]
+uint32_t signalHistogramRange(const signal_hist_t *hist, uint8_t low, uint8_t high, uint64_t *sum) {
     uint32_t cnt = 0;
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
+    uint64_t s = 0;
+    for (int v = low; v <= high; v++) {
+        cnt += hist->bins[v];
+        s += (uint64_t)hist->bins[v] * v;
+    }
+    if (sum) {
+        *sum = s;
+    }
+    return cnt;
+}
 
-        if (samples[i] < signalprop.low) signalprop.low = samples[i];
-        if (samples[i] > signalprop.high) signalprop.high = samples[i];
+// fill in the signal properties from a histogram,  the mean skips the lowest and highest 10%
+void computeSignalPropertiesHist(const signal_hist_t *hist) {
+    resetSignal();
 
-        if (samples[i] < low10 || samples[i] > hi90)
-            continue;
+    if (hist->count == 0) return;
 
-        sum += samples[i];
-        cnt++;
-    }
+    signalprop.low = hist->min;
+    signalprop.high = hist->max;
+
+    uint8_t low10 = signalHistogramPercentile(hist, 0.1);
+    uint8_t hi90 = signalHistogramPercentile(hist, 0.9);
+
+    uint64_t sum = 0;
+    uint32_t cnt = signalHistogramRange(hist, low10, hi90, &sum);
     if (cnt > 0)
         signalprop.mean = sum / cnt;
     else
         signalprop.mean = 0;
+
+    // measure amplitude of signal
+    signalprop.amplitude = signalprop.high - signalprop.mean;
+    // By measuring mean and look at amplitude of signal from HIGH / LOW,
+    // we can detect noise
+    signalprop.isnoise =  signalprop.amplitude < NOISE_AMPLITUDE_THRESHOLD;
+
+    if (g_debugMode)
+        printSignal();
+}
+
+void computeSignalProperties(const uint8_t *samples, uint32_t size) {
+
+    if (samples == NULL || size < SIGNAL_MIN_SAMPLES) {
+        resetSignal();
+        return;
+    }
+
+#ifndef ON_DEVICE
+    signal_hist_t hist;
+    signalHistogram(&hist, samples + SIGNAL_IGNORE_FIRST_SAMPLES, size - SIGNAL_IGNORE_FIRST_SAMPLES);
+    computeSignalPropertiesHist(&hist);
 #else
+    resetSignal();
+
+    uint32_t sum = 0;
+    uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
+
     for (uint32_t i =  SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
         if (samples[i] < signalprop.low) signalprop.low = samples[i];
         if (samples[i] > signalprop.high) signalprop.high = samples[i];
         sum += samples[i];
     }
     signalprop.mean = sum / offset_size;
-#endif
 
     // measure amplitude of signal
     signalprop.amplitude = signalprop.high - signalprop.mean;
@@ -149,6 +232,20 @@ void computeSignalProperties(const uint8_t *samples, uint32_t size) {
 
     if (g_debugMode)
         printSignal();
+#endif
+}
+
+// DC offset removeSignalOffset takes out,  from the mean of the samples between the 5th and 95th percentile
+int signalOffsetHist(const signal_hist_t *hist) {
+    uint8_t low5 = signalHistogramPercentile(hist, 0.05);
+    uint8_t hi95 = signalHistogramPercentile(hist, 0.95);
+
+    uint64_t sum = 0;
+    uint32_t cnt = signalHistogramRange(hist, low5, hi95, &sum);
+    if (cnt == 0) {
+        return 0;
+    }
+    return ((int64_t)sum - 128 * (int64_t)cnt) / (int64_t)cnt;
 }
 
 void removeSignalOffset(uint8_t *samples, uint32_t size) {
@@ -157,30 +254,13 @@ void removeSignalOffset(uint8_t *samples, uint32_t size) {
     }
 
     int acc_off = 0;
-    uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
 
 #ifndef ON_DEVICE
-
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
-
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.05)] + tmp[(int)((offset_size - 1) * 0.05)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.95)] + tmp[(int)((offset_size - 1) * 0.95)]);
-    int32_t cnt = 0;
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
-
-        if (samples[i] < low10 || samples[i] > hi90)
-            continue;
-
-        acc_off += samples[i] - 128;
-        cnt++;
-    }
-    if (cnt > 0)
-        acc_off /= cnt;
-    else
-        acc_off = 0;
+    signal_hist_t hist;
+    signalHistogram(&hist, samples + SIGNAL_IGNORE_FIRST_SAMPLES, size - SIGNAL_IGNORE_FIRST_SAMPLES);
+    acc_off = signalOffsetHist(&hist);
 #else
+    uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
     for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++)
         acc_off += samples[i] - 128;
 
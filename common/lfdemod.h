@@ -43,6 +43,23 @@ typedef struct {
 } signal_t;
 signal_t *getSignalProperties(void);
 
+// sample value histogram
+typedef struct {
+    uint32_t bins[256];
+    uint32_t count;
+    uint64_t sum;
+    uint8_t min;
+    uint8_t max;
+} signal_hist_t;
+
+void signalHistogram(signal_hist_t *hist, const uint8_t *samples, uint32_t size);
+void signalHistogramAdd(signal_hist_t *hist, const uint8_t *samples, uint32_t size);
+uint8_t signalHistogramNth(const signal_hist_t *hist, uint32_t n);
+uint8_t signalHistogramPercentile(const signal_hist_t *hist, double pct);
+uint32_t signalHistogramRange(const signal_hist_t *hist, uint8_t low, uint8_t high, uint64_t *sum);
+
+void computeSignalPropertiesHist(const signal_hist_t *hist);
+int signalOffsetHist(const signal_hist_t *hist);
 void computeSignalProperties(const uint8_t *samples, uint32_t size);
 void removeSignalOffset(uint8_t *samples, uint32_t size);
 void getNextLow(const uint8_t *samples, size_t size, int low, size_t *i);
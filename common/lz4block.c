@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// LZ4 block codec for bulk downloads
+//-----------------------------------------------------------------------------
+#include "lz4block.h"
+#include <string.h>
+#include "lz4.h"
+
+// Packs the start of src into one block of at most dstlen bytes, header included.
+// LZ4 takes in as much of src as fits compressed in the block, when that is not
+// more than the block holds stored the bytes are copied as they are.
+// Returns the length of the block, *consumed tells how many bytes of src it holds.
+size_t lz4block_pack(const uint8_t *src, size_t srclen, uint32_t offset, uint8_t *dst, size_t dstlen, size_t *consumed) {
+
+    *consumed = 0;
+    if (srclen == 0 || dstlen <= sizeof(lz4block_hdr_t)) {
+        return 0;
+    }
+
+    lz4block_hdr_t *hdr = (lz4block_hdr_t *)dst;
+    uint8_t *body = dst + sizeof(lz4block_hdr_t);
+    size_t room = dstlen - sizeof(lz4block_hdr_t);
+
+    hdr->offset = offset;
+    hdr->rfu = 0;
+
+    int want = MIN(srclen, LZ4BLOCK_MAX_RAW);
+    int in = want;
+    int out = LZ4_compress_destSize((const char *)src, (char *)body, &in, room);
+
+    // worth it when smaller than the bytes it holds, and holding more than a stored block would
+    if (out > 0 && out < in && (in == want || (size_t)in > room)) {
+        hdr->raw_len = in;
+        hdr->method = LZ4BLOCK_LZ4;
+        *consumed = in;
+        return sizeof(lz4block_hdr_t) + out;
+    }
+
+    size_t len = MIN(srclen, room);
+    memcpy(body, src, len);
+    hdr->raw_len = len;
+    hdr->method = LZ4BLOCK_STORED;
+    *consumed = len;
+    return sizeof(lz4block_hdr_t) + len;
+}
+
+// Unpacks one block into dst, at the offset from its header.
+// Returns the raw bytes written, or -1 when the block is damaged or doesn't fit in dstlen.
+int lz4block_unpack(const uint8_t *block, size_t blocklen, uint8_t *dst, size_t dstlen, uint32_t *offset) {
+
+    if (blocklen < sizeof(lz4block_hdr_t)) {
+        return -1;
+    }
+
+    lz4block_hdr_t hdr;
+    memcpy(&hdr, block, sizeof(hdr));
+    const uint8_t *body = block + sizeof(lz4block_hdr_t);
+    size_t bodylen = blocklen - sizeof(lz4block_hdr_t);
+
+    if (offset != NULL) {
+        *offset = hdr.offset;
+    }
+
+    if (hdr.offset > dstlen || hdr.raw_len > dstlen - hdr.offset) {
+        return -1;
+    }
+
+    switch (hdr.method) {
+        case LZ4BLOCK_STORED: {
+            if (bodylen != hdr.raw_len) {
+                return -1;
+            }
+            memcpy(dst + hdr.offset, body, bodylen);
+            return hdr.raw_len;
+        }
+        case LZ4BLOCK_LZ4: {
+            int res = LZ4_decompress_safe((const char *)body, (char *)dst + hdr.offset, bodylen, hdr.raw_len);
+            if (res != hdr.raw_len) {
+                return -1;
+            }
+            return res;
+        }
+        default:
+            return -1;
+    }
+}
@@ -0,0 +1,45 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// LZ4 block codec for bulk downloads
+//
+// A download is cut in independent blocks, each one fits in a single frame:
+// a small header telling where the bytes go, followed by one LZ4 block or by
+// the bytes as they are when they don't compress. Every block decompresses on
+// its own, so a block never depends on one that was lost or came in late.
+//-----------------------------------------------------------------------------
+
+#ifndef LZ4BLOCK_H__
+#define LZ4BLOCK_H__
+
+#include "common.h"
+
+#define LZ4BLOCK_STORED     0
+#define LZ4BLOCK_LZ4        1
+
+// most raw bytes in one block
+#define LZ4BLOCK_MAX_RAW    16384
+
+typedef struct {
+    uint32_t offset;    // of the raw bytes, from the start of the download
+    uint16_t raw_len;   // raw bytes in this block
+    uint8_t method;     // LZ4BLOCK_STORED / LZ4BLOCK_LZ4
+    uint8_t rfu;
+} PACKED lz4block_hdr_t;
+
+size_t lz4block_pack(const uint8_t *src, size_t srclen, uint32_t offset, uint8_t *dst, size_t dstlen, size_t *consumed);
+int lz4block_unpack(const uint8_t *block, size_t blocklen, uint8_t *dst, size_t dstlen, uint32_t *offset);
+
+#endif
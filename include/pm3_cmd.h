@@ -46,17 +46,25 @@ typedef struct {
 
 #define COMMANDNG_PREAMBLE_MAGIC  0x61334d50 // PM3a
 #define COMMANDNG_POSTAMBLE_MAGIC 0x3361     // a3
+// same frame, with a sequence number in front of the crc
+#define COMMANDNG_TAGGED_PREAMBLE_MAGIC  0x63334d50 // PM3c
 
 typedef struct {
     uint16_t crc;
 } PACKED PacketCommandNGPostamble;
 
+typedef struct {
+    uint16_t seq;
+    uint16_t crc;
+} PACKED PacketCommandNGTaggedPostamble;
+
 // For internal usage
 typedef struct {
     uint16_t cmd;
     uint16_t length;
     uint32_t magic;      //  NG
     uint16_t crc;        //  NG
+    uint16_t seq;        //  NG tagged, 0 if untagged
     uint64_t oldarg[3];  //  OLD
     union {
         uint8_t  asBytes[PM3_CMD_DATA_SIZE];
@@ -70,6 +78,7 @@ typedef struct {
     PacketCommandNGPreamble pre;
     uint8_t data[PM3_CMD_DATA_SIZE];
     PacketCommandNGPostamble foopost; // Probably not at that offset!
+    uint16_t foopad;                  // room for the longer postamble of tagged frames
 } PACKED PacketCommandNGRaw;
 
 typedef struct {
@@ -92,11 +101,18 @@ typedef struct {
 
 #define RESPONSENG_PREAMBLE_MAGIC  0x62334d50 // PM3b
 #define RESPONSENG_POSTAMBLE_MAGIC 0x3362     // b3
+// same frame, with the sequence number of the command being served in front of the crc
+#define RESPONSENG_TAGGED_PREAMBLE_MAGIC  0x64334d50 // PM3d
 
 typedef struct {
     uint16_t crc;
 } PACKED PacketResponseNGPostamble;
 
+typedef struct {
+    uint16_t seq;
+    uint16_t crc;
+} PACKED PacketResponseNGTaggedPostamble;
+
 // For internal usage
 typedef struct {
     uint16_t cmd;
@@ -105,6 +121,7 @@ typedef struct {
     int8_t   status;     //  NG
     int8_t   reason;     //  NG
     uint16_t crc;        //  NG
+    uint16_t seq;        //  NG tagged, 0 if untagged
     uint64_t oldarg[3];  //  OLD
     union {
         uint8_t  asBytes[PM3_CMD_DATA_SIZE];
@@ -118,6 +135,7 @@ typedef struct {
     PacketResponseNGPreamble pre;
     uint8_t data[PM3_CMD_DATA_SIZE];
     PacketResponseNGPostamble foopost; // Probably not at that offset!
+    uint16_t foopad;                   // room for the longer postamble of tagged frames
 } PACKED PacketResponseNGRaw;
 
 // A struct used to send sample-configs over USB
@@ -231,8 +249,13 @@ typedef struct {
     bool hw_available_flash            : 1;
     bool hw_available_smartcard        : 1;
     bool is_rdv4                       : 1;
+
+    // protocol
+    bool has_tagged_frames             : 1;
 } PACKED capabilities_t;
-#define CAPABILITIES_VERSION 6
+#define CAPABILITIES_VERSION 7
+// same struct, sent by firmwares from before has_tagged_frames. Its bit is garbage there
+#define CAPABILITIES_VERSION_UNTAGGED 6
 extern capabilities_t g_pm3_capabilities;
 
 // For CMD_LF_T55XX_WRITEBL
@@ -528,6 +551,7 @@ typedef struct {
 #define CMD_SET_ADC_MUX                                                   0x020F
 #define CMD_LF_HID_CLONE                                                  0x0210
 #define CMD_LF_EM410X_CLONE                                               0x0211
+#define CMD_DOWNLOADED_BIGBUF_LZ4                                         0x0212
 #define CMD_LF_T55XX_READBL                                               0x0214
 #define CMD_LF_T55XX_WRITEBL                                              0x0215
 #define CMD_LF_T55XX_RESET_READ                                           0x0216
@@ -1033,6 +1057,9 @@ typedef struct {
 /* CMD_READ_MEM_DOWNLOAD flags */
 #define READ_MEM_DOWNLOAD_FLAG_RAW                   (1<<0)
 
+/* CMD_DOWNLOAD_BIGBUF flags, arg2.  Older firmware ignores them and sends plain CMD_DOWNLOADED_BIGBUF chunks */
+#define DOWNLOAD_BIGBUF_FLAG_LZ4                     (1<<0)   // send CMD_DOWNLOADED_BIGBUF_LZ4 blocks, see common/lz4block.h
+
 /* CMD_START_FLASH may have three arguments: start of area to flash,
    end of area to flash, optional magic.
    The bootrom will not allow to overwrite itself unless this magic
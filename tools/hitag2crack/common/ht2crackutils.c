@@ -1,5 +1,9 @@
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
+#if defined(_WIN32)
+#include <sysinfoapi.h>
+#endif
 #include "ht2crackutils.h"
 
 // writes a value into a buffer as a series of bytes
@@ -186,3 +190,24 @@ unsigned long long hexreversetoulonglong(char *hex) {
     ret += hexreversetoulong(tmp);
     return ret;
 }
+
+// determine number of logical CPU cores, used as default thread count
+unsigned int num_cpus(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return sysinfo.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count < 1)
+        count = 1;
+    return (unsigned int)count;
+#endif
+}
+
+// monotonic wall clock in seconds, for progress rates
+double get_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
@@ -47,4 +47,7 @@ void buildlfsr(Hitag_State *hstate);
 unsigned long hexreversetoulong(char *hex);
 unsigned long long hexreversetoulonglong(char *hex);
 
+unsigned int num_cpus(void);
+double get_seconds(void);
+
 #endif /* HT2CRACKUTILS_H */
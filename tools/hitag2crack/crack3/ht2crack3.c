@@ -3,6 +3,7 @@
 #include <pthread.h>
 #include <inttypes.h>
 #include <string.h>
+#include <getopt.h>
 
 #include "hitagcrypto.h"
 #include "ht2crackutils.h"
@@ -10,7 +11,14 @@
 // max number of NrAr pairs to load - you only need 136 good pairs, but this
 // is the max
 #define NUM_NRAR 1024
-#define NUM_THREADS 8
+
+// print a progress line every PROGRESS_INTERVAL completed klower guesses
+#define PROGRESS_INTERVAL 64
+
+// the klower space is handed out interleaved across this many stripes, so
+// the search order matches the old fixed 8-thread partitioning and the start
+// of each 0x2000 block is tried early, whatever the number of threads
+#define KLOWER_STRIPES 8
 
 // table entry for Tkleft
 struct Tklower {
@@ -25,13 +33,23 @@ struct nRaR {
     uint64_t aR;
 };
 
+// shared work queue - threads pull the next klower guess from here, so a
+// thread that hits slow guesses doesn't leave the others idle at the end
+struct workqueue {
+    uint64_t klowerstart;
+    uint64_t jobnext;
+    unsigned int stripes;
+    uint64_t klowerdone;
+    uint64_t klowertotal;
+    double starttime;
+};
+
 // struct to hold data for thread
 struct threaddata {
     uint64_t uid;
     struct nRaR *TnRaR;
     unsigned int numnrar;
-    uint64_t klowerstart;
-    uint64_t klowerrange;
+    struct workqueue *wq;
 };
 
 // macros to pick out 4 bits in various patterns of 1s & 2s & make a new number
@@ -174,10 +192,11 @@ static void *crack(void *d) {
     uint64_t uid;
     struct nRaR *TnRaR;
     unsigned int numnrar;
+    struct workqueue *wq;
 
     int i, j;
 
-    uint64_t klower, kmiddle, klowery;
+    uint64_t job, klower, kmiddle, klowery;
     uint64_t y, b, z, bit;
     uint64_t ytmp;
     uint64_t foundkey, revkey;
@@ -194,6 +213,7 @@ static void *crack(void *d) {
     uid = data->uid;
     TnRaR = data->TnRaR;
     numnrar = data->numnrar;
+    wq = data->wq;
 
     // create space for tables
     Tk = (struct Tklower *)calloc(sizeof(struct Tklower) * 0x40000, sizeof(uint8_t));
@@ -203,7 +223,8 @@ static void *crack(void *d) {
     }
 
     // find keys
-    for (klower = data->klowerstart; klower < (data->klowerstart + data->klowerrange); klower++) {
+    while ((job = __atomic_fetch_add(&wq->jobnext, 1, __ATOMIC_SEQ_CST)) < wq->klowertotal) {
+        klower = wq->klowerstart + ((job % wq->stripes) * (wq->klowertotal / wq->stripes)) + (job / wq->stripes);
         printf("trying klower = 0x%05"PRIx64"\n", klower);
         // build table
         unsigned int count = 0;
@@ -279,16 +300,34 @@ static void *crack(void *d) {
             }
 
         }
+
+        // report progress
+        uint64_t done = __atomic_add_fetch(&wq->klowerdone, 1, __ATOMIC_SEQ_CST);
+        if (((done % PROGRESS_INTERVAL) == 0) || (done == wq->klowertotal)) {
+            double elapsed = get_seconds() - wq->starttime;
+            double rate = (elapsed > 0) ? (done / elapsed) : 0;
+            printf("progress: %"PRIu64"/%"PRIu64" klower (%.1f%%), %.2f klower/s, ETA %.0fs\n",
+                   done, wq->klowertotal, (100.0 * done) / wq->klowertotal, rate,
+                   (rate > 0) ? ((wq->klowertotal - done) / rate) : 0);
+        }
     }
 
     free(Tk);
     return NULL;
 }
+static void usage(const char *name) {
+    printf("%s [-j|--threads N] uid nRaRfile [klowerstart]\n", name);
+    printf(" -j, --threads N   number of worker threads (defaults to %u)\n", num_cpus());
+    exit(1);
+}
+
 int main(int argc, char *argv[]) {
     FILE *fp;
-    int i;
-    pthread_t threads[NUM_THREADS];
+    unsigned int i;
+    unsigned int num_threads = num_cpus();
+    pthread_t *threads = NULL;
     void *status;
+    int c;
 
     uint64_t uid;
     uint64_t klowerstart;
@@ -300,32 +339,57 @@ int main(int argc, char *argv[]) {
 
     struct nRaR *TnRaR = NULL;
     struct threaddata *tdata = NULL;
+    struct workqueue wq;
+
+    static const struct option long_options[] = {
+        {"threads", required_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    while ((c = getopt_long(argc, argv, "j:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'j':
+                if (atoi(optarg) <= 0) {
+                    printf("invalid thread count %s\n", optarg);
+                    exit(1);
+                }
+                num_threads = atoi(optarg);
+                break;
+            case 'h':
+            default:
+                usage(argv[0]);
+        }
+    }
 
-    if (argc < 3) {
-        printf("%s uid nRaRfile\n", argv[0]);
-        exit(1);
+    if ((argc - optind) < 2) {
+        usage(argv[0]);
     }
 
     // read the UID into internal format
-    if (!strncmp(argv[1], "0x", 2)) {
-        uid = rev32(hexreversetoulong(argv[1] + 2));
+    if (!strncmp(argv[optind], "0x", 2)) {
+        uid = rev32(hexreversetoulong(argv[optind] + 2));
     } else {
-        uid = rev32(hexreversetoulong(argv[1]));
+        uid = rev32(hexreversetoulong(argv[optind]));
     }
 
     // create table of nR aR pairs
     TnRaR = (struct nRaR *)calloc(sizeof(struct nRaR) * NUM_NRAR, sizeof(uint8_t));
 
     // open file
-    fp = fopen(argv[2], "r");
+    fp = fopen(argv[optind + 1], "r");
     if (!fp) {
         printf("cannot open nRaRfile\n");
         exit(1);
     }
 
     // set klowerstart (for debugging)
-    if (argc > 3) {
-        klowerstart = strtol(argv[3], NULL, 0);
+    if ((argc - optind) > 2) {
+        klowerstart = strtol(argv[optind + 2], NULL, 0);
+        if (klowerstart >= 0x10000) {
+            printf("klowerstart must be below 0x10000\n");
+            exit(1);
+        }
     } else {
         klowerstart = 0;
     }
@@ -367,43 +431,52 @@ int main(int argc, char *argv[]) {
 
     printf("Loaded %u NrAr pairs\n", numnrar);
 
+    // set up the work queue over all klower guesses
+    wq.klowerstart = klowerstart;
+    wq.jobnext = 0;
+    wq.stripes = (klowerstart) ? 1 : KLOWER_STRIPES;
+    wq.klowerdone = 0;
+    wq.klowertotal = 0x10000 - klowerstart;
+    wq.starttime = get_seconds();
+
     // create table of thread data
-    tdata = (struct threaddata *)calloc(1, sizeof(struct threaddata) * NUM_THREADS);
-    if (!tdata) {
+    tdata = (struct threaddata *)calloc(1, sizeof(struct threaddata) * num_threads);
+    threads = (pthread_t *)calloc(1, sizeof(pthread_t) * num_threads);
+    if (!tdata || !threads) {
         printf("cannot calloc threaddata\n");
         exit(1);
     }
 
-    for (i = 0; i < NUM_THREADS; i++) {
+    for (i = 0; i < num_threads; i++) {
         tdata[i].uid = uid;
         tdata[i].TnRaR = TnRaR;
         tdata[i].numnrar = numnrar;
-        tdata[i].klowerrange = 0x10000 / NUM_THREADS;
-        tdata[i].klowerstart = i * tdata[i].klowerrange;
+        tdata[i].wq = &wq;
     }
 
     if (klowerstart) {
         // debug mode only runs one thread from klowerstart
-        tdata[0].klowerstart = klowerstart;
         crack(tdata);
         return 0;
     }
 
+    printf("Using %u threads\n", num_threads);
+
     // run full threaded mode
-    for (i = 0; i < NUM_THREADS; i++) {
+    for (i = 0; i < num_threads; i++) {
         if (pthread_create(&(threads[i]), NULL, crack, (void *)(tdata + i))) {
-            printf("cannot start thread %d\n", i);
+            printf("cannot start thread %u\n", i);
             exit(1);
         }
     }
 
     // wait for threads to finish
-    for (i = 0; i < NUM_THREADS; i++) {
+    for (i = 0; i < num_threads; i++) {
         if (pthread_join(threads[i], &status)) {
-            printf("cannot join thread %d\n", i);
+            printf("cannot join thread %u\n", i);
             exit(1);
         }
-        printf("thread %i finished\n", i);
+        printf("thread %u finished\n", i);
         if (status) {
             printf("Key = %012"PRIx64"\n", (uint64_t)status);
             exit(0);
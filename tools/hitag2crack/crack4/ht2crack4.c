@@ -32,9 +32,12 @@
  * a table size of about 3000000 and expect it to take around 4 mins to run, but
  * with a high likelihood of success.
  *
- * Setting table size to a large number (~32000000) will likely blow up the stack
- * during the recursive qsort().  This could be fixed by making the stack space
- * larger but really, you need a smaller table and more encrypted nonces.
+ * Setting table size to a large number (~32000000) needs several GB of memory
+ * for the guess table.  Really, you need a smaller table and more encrypted nonces.
+ *
+ * Scoring is spread over all available cores (see --threads); each round only
+ * keeps the best half of the table, so the guesses are partitioned around the
+ * k-th best score rather than fully sorted.
  *
  * The scoring of the guesses is controversial, having been tweaked over and again
  * to find a measure that provides the best results.  Feel free to tweak it yourself
@@ -56,8 +59,8 @@
  * more than 16.  You can still win with 8 if you're lucky. */
 #define MAX_NONCES 32
 
-/* set this to the number of virtual cores you have */
-#define NUM_THREADS 8
+/* number of guesses a scoring thread claims from the table at a time */
+#define SCORE_CHUNK 1024
 
 /* encrypted nonce and keystream storage
  * ks is ~enc_aR */
@@ -78,10 +81,10 @@ struct guess {
     uint64_t b0to31[MAX_NONCES];
 };
 
-/* thread_data is the data sent to the scoring threads */
+/* thread_data is the data sent to the scoring threads
+ * next is the shared index of the next unclaimed chunk of guesses */
 struct thread_data {
-    unsigned int start;
-    unsigned int end;
+    unsigned int *next;
     unsigned int size;
 };
 
@@ -93,6 +96,8 @@ unsigned int num_nRaR;
 uint64_t uid;
 int maxtablesize = 800000;
 uint64_t supplied_testkey = 0;
+unsigned int num_threads = 0;
+double min_kept_score;
 
 static void usage(void) {
     printf("ht2crack4 - K Sheldrake, based on the work of Garcia et al\n\n");
@@ -103,6 +108,7 @@ static void usage(void) {
     printf(" -n NONCEFILE (required)\n");
     printf(" -N number of nRaR pairs to use (defaults to 32)\n");
     printf(" -t TABLESIZE (defaults to 800000\n");
+    printf(" -j, --threads N number of scoring threads (defaults to %u)\n", num_cpus());
     printf("Increasing the table size will slow it down but will be more\n");
     printf("successful.\n");
 
@@ -479,13 +485,21 @@ void score_all_traces(unsigned int size)
 }
 */
 
-/* score_some_traces runs score_traces for every key guess in a section of the table */
+/* score_some_traces runs score_traces for chunks of the table until
+ * none are left; chunks are claimed dynamically so that threads that
+ * get cheap guesses (early losers) pick up more of the work */
 static void *score_some_traces(void *data) {
-    unsigned int i;
+    unsigned int i, start, end;
     struct thread_data *tdata = (struct thread_data *)data;
 
-    for (i = tdata->start; i < tdata->end; i++) {
-        score_traces(&(guesses[i]), tdata->size);
+    while ((start = __atomic_fetch_add(tdata->next, SCORE_CHUNK, __ATOMIC_SEQ_CST)) < num_guesses) {
+        end = start + SCORE_CHUNK;
+        if (end > num_guesses) {
+            end = num_guesses;
+        }
+        for (i = start; i < end; i++) {
+            score_traces(&(guesses[i]), tdata->size);
+        }
     }
 
     return NULL;
@@ -494,34 +508,25 @@ static void *score_some_traces(void *data) {
 
 /* score_all_traces runs score_traces for every key guess in the table */
 static void score_all_traces(unsigned int size) {
-    pthread_t threads[NUM_THREADS];
+    pthread_t threads[num_threads];
     void *status;
-    struct thread_data tdata[NUM_THREADS];
+    struct thread_data tdata;
+    unsigned int next = 0;
     unsigned int i;
-    unsigned int chunk_size;
-
-    chunk_size = num_guesses / NUM_THREADS;
-
-    // create thread data
-    for (i = 0; i < NUM_THREADS; i++) {
-        tdata[i].start = i * chunk_size;
-        tdata[i].end = (i + 1) * chunk_size;
-        tdata[i].size = size;
-    }
 
-    // fix last chunk
-    tdata[NUM_THREADS - 1].end = num_guesses;
+    tdata.next = &next;
+    tdata.size = size;
 
     // start the threads
-    for (i = 0; i < NUM_THREADS; i++) {
-        if (pthread_create(&(threads[i]), NULL, score_some_traces, (void *)(tdata + i))) {
+    for (i = 0; i < num_threads; i++) {
+        if (pthread_create(&(threads[i]), NULL, score_some_traces, (void *)&tdata)) {
             printf("cannot start thread %u\n", i);
             exit(1);
         }
     }
 
     // wait for threads to end
-    for (i = 0; i < NUM_THREADS; i++) {
+    for (i = 0; i < num_threads; i++) {
         if (pthread_join(threads[i], &status)) {
             printf("cannot join thread %u\n", i);
             exit(1);
@@ -530,21 +535,110 @@ static void score_all_traces(unsigned int size) {
 }
 
 
+/* swap_guesses exchanges two entries of the guess table */
+static void swap_guesses(unsigned int a, unsigned int b) {
+    struct guess tmp;
 
+    if (a == b) {
+        return;
+    }
+    memcpy(&tmp, &(guesses[a]), sizeof(struct guess));
+    memcpy(&(guesses[a]), &(guesses[b]), sizeof(struct guess));
+    memcpy(&(guesses[b]), &tmp, sizeof(struct guess));
+}
 
 
-/* cmp_guess is the comparison function for qsorting the guess table */
-static int cmp_guess(const void *a, const void *b) {
-    struct guess *a1 = (struct guess *)a;
-    struct guess *b1 = (struct guess *)b;
+/* kth_best_score returns the k-th highest score (k counts from 0) of the
+ * n scores in sc, using an iterative quickselect; sc is reordered */
+static double kth_best_score(double *sc, unsigned int n, unsigned int k) {
+    unsigned int lo = 0;
+    unsigned int hi = n - 1;
 
-    if (a1->score < b1->score) {
-        return 1;
-    } else if (a1->score > b1->score) {
-        return -1;
+    while (lo < hi) {
+        double pivot = sc[lo + ((hi - lo) / 2)];
+        unsigned int i = lo;
+        unsigned int j = hi;
+
+        // partition so that higher scores come first
+        while (i <= j) {
+            while (sc[i] > pivot) {
+                i++;
+            }
+            while (sc[j] < pivot) {
+                j--;
+            }
+            if (i <= j) {
+                double tmp = sc[i];
+                sc[i] = sc[j];
+                sc[j] = tmp;
+                i++;
+                if (j == 0) {
+                    break;
+                }
+                j--;
+            }
+        }
+
+        if (k <= j) {
+            hi = j;
+        } else if (k >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+
+    return sc[k];
+}
+
+
+/* select_best_guesses moves the keep best-scoring guesses to the start of the
+ * table, with the single best at index 0.  This replaces a full sort of the
+ * table, as only membership of the kept half matters for the next round. */
+static void select_best_guesses(unsigned int keep) {
+    unsigned int i, best;
+    unsigned int front = 0;
+
+    if (keep < num_guesses) {
+        double *sc = (double *)calloc(num_guesses, sizeof(double));
+        if (sc == NULL) {
+            printf("Failed to allocate memory\n");
+            exit(1);
+        }
+        for (i = 0; i < num_guesses; i++) {
+            sc[i] = guesses[i].score;
+        }
+        double threshold = kth_best_score(sc, num_guesses, keep - 1);
+        free(sc);
+
+        // move everything strictly better than the threshold to the front,
+        // then fill up the remaining places with guesses equal to it
+        for (i = 0; i < num_guesses; i++) {
+            if (guesses[i].score > threshold) {
+                swap_guesses(front++, i);
+            }
+        }
+        for (i = front; (i < num_guesses) && (front < keep); i++) {
+            if (guesses[i].score == threshold) {
+                swap_guesses(front++, i);
+            }
+        }
     } else {
-        return 0;
+        keep = num_guesses;
     }
+
+    // put the best guess first and record the lowest kept score
+    best = 0;
+    min_kept_score = guesses[0].score;
+    for (i = 1; i < keep; i++) {
+        if (guesses[i].score > guesses[best].score) {
+            best = i;
+        }
+        if (guesses[i].score < min_kept_score) {
+            min_kept_score = guesses[i].score;
+        }
+    }
+    swap_guesses(0, best);
 }
 
 
@@ -565,16 +659,24 @@ static void expand_guesses(unsigned int halfsize, unsigned int size) {
 
 
 /* checks if the supplied test key is still in the table, which
- * is useful when testing different scoring methods */
+ * is useful when testing different scoring methods. The table is only
+ * partitioned around the cut, not sorted, so the rank is the number of
+ * guesses scoring higher than the test key */
 static void check_supplied_testkey(unsigned int size) {
     uint64_t partkey;
-    unsigned int i;
+    unsigned int i, j, rank;
 
     partkey = supplied_testkey & ((1l << size) - 1);
 
     for (i = 0; i < num_guesses; i++) {
         if (guesses[i].key == partkey) {
-            fprintf(stderr, " supplied test key score = %1.10f, position = %u\n", guesses[i].score, i);
+            rank = 0;
+            for (j = 0; j < num_guesses; j++) {
+                if (guesses[j].score > guesses[i].score) {
+                    rank++;
+                }
+            }
+            fprintf(stderr, " supplied test key score = %1.10f, rank = %u\n", guesses[i].score, rank);
             return;
         }
     }
@@ -584,20 +686,13 @@ static void check_supplied_testkey(unsigned int size) {
 }
 
 
-/* execute_round scores the guesses, sorts them and expands the good half */
+/* execute_round scores the guesses, selects the best and expands the good half */
 static void execute_round(unsigned int size) {
     unsigned int halfsize;
 
     // score all the current guesses
     score_all_traces(size);
 
-    // sort the guesses by score
-    qsort(guesses, num_guesses, sizeof(struct guess), cmp_guess);
-
-    if (supplied_testkey) {
-        check_supplied_testkey(size);
-    }
-
     // identify limit
     if (num_guesses < (maxtablesize / 2)) {
         halfsize = num_guesses;
@@ -605,6 +700,13 @@ static void execute_round(unsigned int size) {
         halfsize = (maxtablesize / 2);
     }
 
+    // move the best halfsize guesses to the front
+    select_best_guesses(halfsize);
+
+    if (supplied_testkey) {
+        check_supplied_testkey(size);
+    }
+
     // expand guesses
     expand_guesses(halfsize, size);
 
@@ -614,14 +716,21 @@ static void execute_round(unsigned int size) {
 
 /* crack is the main cracking algo; it executes the rounds */
 static void crack(void) {
+    double start = get_seconds();
+
     for (unsigned int i = 16; i <= 48; i++) {
         fprintf(stderr, "round %2u, size=%2u\n", i - 16, i);
+        unsigned int scored = num_guesses;
+        double round_start = get_seconds();
         execute_round(i);
+        double round_time = get_seconds() - round_start;
+        fprintf(stderr, " scored %u guesses in %.2fs (%.0f guesses/s), %.1fs elapsed\n", scored, round_time,
+                (round_time > 0) ? (scored / round_time) : 0, get_seconds() - start);
 
         // print some metrics
         uint64_t revkey = rev64(guesses[0].key);
         uint64_t foundkey = ((revkey >> 40) & 0xff) | ((revkey >> 24) & 0xff00) | ((revkey >> 8) & 0xff0000) | ((revkey << 8) & 0xff000000) | ((revkey << 24) & 0xff00000000) | ((revkey << 40) & 0xff0000000000);
-        fprintf(stderr, " guess=%012" PRIx64 ", num_guesses = %u, top score=%1.10f, min score=%1.10f\n", foundkey, num_guesses, guesses[0].score, guesses[num_guesses - 1].score);
+        fprintf(stderr, " guess=%012" PRIx64 ", num_guesses = %u, top score=%1.10f, min score=%1.10f\n", foundkey, num_guesses, guesses[0].score, min_kept_score);
     }
 }
 
@@ -779,10 +888,18 @@ int main(int argc, char *argv[]) {
     char *uidstr = NULL;
     char *noncefilestr = NULL;
 
+    static const struct option long_options[] = {
+        {"threads", required_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
 //    test();
 //    exit(0);
 
-    while ((c = getopt(argc, argv, "u:n:N:t:T:h")) != -1) {
+    num_threads = num_cpus();
+
+    while ((c = getopt_long(argc, argv, "u:n:N:t:T:j:h", long_options, NULL)) != -1) {
         switch (c) {
             case 'u':
                 uidstr = optarg;
@@ -799,6 +916,12 @@ int main(int argc, char *argv[]) {
             case 'T':
                 supplied_testkey = rev64(hexreversetoulonglong(optarg));
                 break;
+            case 'j':
+                if (atoi(optarg) <= 0) {
+                    usage();
+                }
+                num_threads = atoi(optarg);
+                break;
             case 'h':
                 usage();
                 break;
@@ -819,6 +942,7 @@ int main(int argc, char *argv[]) {
         num_nRaR = tot_nRaR;
     }
     fprintf(stderr, "Using %u nRaR pairs\n", num_nRaR);
+    fprintf(stderr, "Using %u threads\n", num_threads);
 
     crack();
 
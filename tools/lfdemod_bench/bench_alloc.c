@@ -0,0 +1,45 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Heap allocation counting for the benchmarked code
+//-----------------------------------------------------------------------------
+#include "bench_alloc.h"
+
+#include <stdlib.h>
+
+static uint64_t alloc_count = 0;
+
+void *bench_malloc(size_t size) {
+    alloc_count++;
+    return malloc(size);
+}
+
+void *bench_calloc(size_t nmemb, size_t size) {
+    alloc_count++;
+    return calloc(nmemb, size);
+}
+
+void *bench_realloc(void *ptr, size_t size) {
+    alloc_count++;
+    return realloc(ptr, size);
+}
+
+void bench_alloc_reset(void) {
+    alloc_count = 0;
+}
+
+uint64_t bench_alloc_count(void) {
+    return alloc_count;
+}
@@ -0,0 +1,35 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Heap allocation counting for the benchmarked code
+//
+// lfdemod.c is compiled with malloc / calloc / realloc redirected to these
+// (see Makefile), every call is counted and then passed on to the C library.
+//-----------------------------------------------------------------------------
+
+#ifndef BENCH_ALLOC_H__
+#define BENCH_ALLOC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+void *bench_malloc(size_t size);
+void *bench_calloc(size_t nmemb, size_t size);
+void *bench_realloc(void *ptr, size_t size);
+
+void bench_alloc_reset(void);
+uint64_t bench_alloc_count(void);
+
+#endif
@@ -0,0 +1,444 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Benchmark of the LF demodulators and clock detectors in common/lfdemod.c
+//
+// Every LF trace is loaded once, then each operation runs on a fresh copy of
+// the samples a number of times. Results are written as JSON, one entry per
+// trace and operation, plus a summary per operation over all traces.
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <dirent.h>
+#include <getopt.h>
+#include <time.h>
+#include "lfdemod.h"
+#include "bench_alloc.h"
+
+#define DEFAULT_TRACE_DIR   "traces"
+#define DEFAULT_ITERATIONS  20
+#define MAX_TRACE_SAMPLES   (40000 * 32)
+#define MAX_TRACES          256
+
+// the client build of lfdemod.c logs through these
+uint8_t g_debugMode = 0;
+
+void PrintAndLogEx(int level, const char *fmt, ...);
+void PrintAndLogEx(int level, const char *fmt, ...) {
+    (void)level;
+    if (g_debugMode == 0) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+typedef struct {
+    char name[128];
+    uint8_t *samples;
+    size_t len;
+    uint16_t fc;        // countFC result, used to feed detectFSKClk
+} trace_t;
+
+// one benchmarked call,  works in place on buf,  returns a value that is printed with the result
+typedef int (*bench_fn_t)(uint8_t *buf, size_t len, const trace_t *trace);
+
+typedef struct {
+    const char *name;
+    bench_fn_t fn;
+} bench_op_t;
+
+static int op_signal(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    computeSignalProperties(buf, len);
+    return getSignalProperties()->amplitude;
+}
+
+static int op_ask_clock(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0;
+    DetectASKClock(buf, len, &clock, 10);
+    return clock;
+}
+
+static int op_psk_clock(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    size_t first = 0;
+    uint8_t phase = 0, fc = 0;
+    return DetectPSKClock(buf, len, 0, &first, &phase, &fc);
+}
+
+static int op_nrz_clock(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    size_t start = 0;
+    return DetectNRZClock(buf, len, 0, &start);
+}
+
+static int op_count_fc(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    return countFC(buf, len, true);
+}
+
+static int op_fsk_clock(uint8_t *buf, size_t len, const trace_t *trace) {
+    int edge = 0;
+    uint8_t fc_high = (trace->fc >> 8) & 0xFF;
+    uint8_t fc_low = trace->fc & 0xFF;
+    if (fc_high == 0 || fc_low == 0) {
+        return 0;
+    }
+    return detectFSKClk(buf, len, fc_high, fc_low, &edge);
+}
+
+static int op_st(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0;
+    size_t start = 0, end = 0;
+    return DetectST(buf, &len, &clock, &start, &end);
+}
+
+static int op_askdemod(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0, invert = 0, start = 0;
+    int errors = askdemod_ext(buf, &len, &clock, &invert, 100, 0, 1, &start);
+    return (errors < 0) ? errors : (int)len;
+}
+
+static int op_em410x(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0, invert = 0, start = 0;
+    if (askdemod_ext(buf, &len, &clock, &invert, 100, 0, 1, &start) < 0) {
+        return -1;
+    }
+    size_t idx = 0;
+    uint32_t hi = 0;
+    uint64_t lo = 0;
+    return Em410xDecode(buf, &len, &idx, &hi, &lo);
+}
+
+static int op_fskdemod(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int start = 0;
+    return (int)fskdemod(buf, len, 50, 1, 10, 8, &start);
+}
+
+static int op_hid(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    uint32_t hi2 = 0, hi = 0, lo = 0;
+    int wave = 0;
+    return HIDdemodFSK(buf, &len, &hi2, &hi, &lo, &wave);
+}
+
+static int op_awid(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int wave = 0;
+    return detectAWID(buf, &len, &wave);
+}
+
+static int op_ioprox(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int wave = 0;
+    return detectIOProx(buf, &len, &wave);
+}
+
+static int op_pskdemod(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0, invert = 0, start = 0;
+    int errors = pskRawDemod_ext(buf, &len, &clock, &invert, &start);
+    return (errors < 0) ? errors : (int)len;
+}
+
+static int op_nrzdemod(uint8_t *buf, size_t len, const trace_t *trace) {
+    (void)trace;
+    int clock = 0, invert = 0, start = 0;
+    int errors = nrzRawDemod(buf, &len, &clock, &invert, &start);
+    return (errors < 0) ? errors : (int)len;
+}
+
+static const bench_op_t bench_ops[] = {
+    {"computeSignalProperties", op_signal},
+    {"DetectASKClock",          op_ask_clock},
+    {"DetectPSKClock",          op_psk_clock},
+    {"DetectNRZClock",          op_nrz_clock},
+    {"countFC",                 op_count_fc},
+    {"detectFSKClk",            op_fsk_clock},
+    {"DetectST",                op_st},
+    {"askdemod_ext",            op_askdemod},
+    {"askdemod_ext+Em410xDecode", op_em410x},
+    {"fskdemod",                op_fskdemod},
+    {"HIDdemodFSK",             op_hid},
+    {"detectAWID",              op_awid},
+    {"detectIOProx",            op_ioprox},
+    {"pskRawDemod_ext",         op_pskdemod},
+    {"nrzRawDemod",             op_nrzdemod},
+};
+
+#define OP_COUNT (sizeof(bench_ops) / sizeof(bench_ops[0]))
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// .pm3 traces are one signed sample per line
+static int load_trace(const char *path, trace_t *trace) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "can't open %s\n", path);
+        return -1;
+    }
+
+    trace->samples = calloc(MAX_TRACE_SAMPLES, sizeof(uint8_t));
+    if (trace->samples == NULL) {
+        fclose(f);
+        return -1;
+    }
+
+    char line[80];
+    trace->len = 0;
+    while (trace->len < MAX_TRACE_SAMPLES && fgets(line, sizeof(line), f)) {
+        int val = atoi(line);
+        if (val > 127) val = 127;
+        if (val < -127) val = -127;
+        trace->samples[trace->len++] = (uint8_t)(val + 128);
+    }
+    fclose(f);
+
+    uint8_t *tmp = realloc(trace->samples, trace->len + 1);
+    if (tmp) {
+        trace->samples = tmp;
+    }
+
+    const char *base = strrchr(path, '/');
+    snprintf(trace->name, sizeof(trace->name), "%s", (base) ? base + 1 : path);
+
+    // same preparation the client does before running the FSK detectors
+    computeSignalProperties(trace->samples, trace->len);
+    tmp = malloc(trace->len);
+    if (tmp) {
+        memcpy(tmp, trace->samples, trace->len);
+        trace->fc = countFC(tmp, trace->len, true);
+        free(tmp);
+    }
+    return 0;
+}
+
+static int cmp_name(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static size_t find_traces(const char *dir, char **paths, size_t max) {
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        fprintf(stderr, "can't open trace directory %s\n", dir);
+        return 0;
+    }
+
+    size_t n = 0;
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL && n < max) {
+        size_t l = strlen(e->d_name);
+        if (strncmp(e->d_name, "lf_", 3) != 0 || l < 4 || strcmp(e->d_name + l - 4, ".pm3") != 0) {
+            continue;
+        }
+        paths[n] = malloc(strlen(dir) + l + 2);
+        if (paths[n] == NULL) {
+            break;
+        }
+        sprintf(paths[n], "%s/%s", dir, e->d_name);
+        n++;
+    }
+    closedir(d);
+
+    qsort(paths, n, sizeof(char *), cmp_name);
+    return n;
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [-n <iterations>] [-d <trace dir>] [-o <json file>] [trace.pm3 ...]\n", prog);
+    printf("\n");
+    printf("Runs every lfdemod operation on every LF trace and reports ns/sample and heap allocations per call as JSON.\n");
+    printf("Without trace files, all lf_*.pm3 in the trace directory (default " DEFAULT_TRACE_DIR ") are used.\n");
+    printf("\n");
+    printf("  -n, --iterations <n>  calls per trace and operation (default %d)\n", DEFAULT_ITERATIONS);
+    printf("  -d, --dir <dir>       trace directory\n");
+    printf("  -o, --output <file>   write JSON to file instead of stdout\n");
+    printf("  -v, --verbose         show lfdemod debug output\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    int iterations = DEFAULT_ITERATIONS;
+    const char *dir = DEFAULT_TRACE_DIR;
+    const char *outfile = NULL;
+
+    static struct option long_options[] = {
+        {"iterations", required_argument, NULL, 'n'},
+        {"dir",        required_argument, NULL, 'd'},
+        {"output",     required_argument, NULL, 'o'},
+        {"verbose",    no_argument,       NULL, 'v'},
+        {"help",       no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:d:o:vh", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'n':
+                iterations = atoi(optarg);
+                break;
+            case 'd':
+                dir = optarg;
+                break;
+            case 'o':
+                outfile = optarg;
+                break;
+            case 'v':
+                g_debugMode = 1;
+                break;
+            case 'h':
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 1;
+        }
+    }
+
+    if (iterations < 1) {
+        fprintf(stderr, "iterations must be at least 1\n");
+        return 1;
+    }
+
+    char *paths[MAX_TRACES];
+    size_t path_count = 0;
+    if (optind < argc) {
+        for (int i = optind; i < argc && path_count < MAX_TRACES; i++) {
+            paths[path_count++] = strdup(argv[i]);
+        }
+    } else {
+        path_count = find_traces(dir, paths, MAX_TRACES);
+    }
+
+    if (path_count == 0) {
+        fprintf(stderr, "no traces found\n");
+        return 1;
+    }
+
+    trace_t *traces = calloc(path_count, sizeof(trace_t));
+    uint8_t *work = malloc(MAX_TRACE_SAMPLES);
+    if (traces == NULL || work == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    size_t trace_count = 0;
+    for (size_t i = 0; i < path_count; i++) {
+        if (load_trace(paths[i], &traces[trace_count]) == 0) {
+            trace_count++;
+        }
+        free(paths[i]);
+    }
+
+    FILE *out = stdout;
+    if (outfile) {
+        out = fopen(outfile, "w");
+        if (out == NULL) {
+            fprintf(stderr, "can't write %s\n", outfile);
+            return 1;
+        }
+    }
+
+    uint64_t op_ns[OP_COUNT] = {0};
+    uint64_t op_samples[OP_COUNT] = {0};
+    uint64_t op_allocs[OP_COUNT] = {0};
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"iterations\": %d,\n", iterations);
+    fprintf(out, "  \"traces\": %zu,\n", trace_count);
+    fprintf(out, "  \"results\": [\n");
+
+    bool first = true;
+    for (size_t t = 0; t < trace_count; t++) {
+
+        const trace_t *trace = &traces[t];
+        fprintf(stderr, "%s (%zu samples)\n", trace->name, trace->len);
+
+        for (size_t o = 0; o < OP_COUNT; o++) {
+
+            uint64_t ns = 0;
+            uint64_t allocs = 0;
+            int result = 0;
+
+            for (int i = 0; i < iterations; i++) {
+                memcpy(work, trace->samples, trace->len);
+                // each operation starts from the signal properties of the whole trace
+                computeSignalProperties(work, trace->len);
+
+                bench_alloc_reset();
+                uint64_t start = now_ns();
+                result = bench_ops[o].fn(work, trace->len, trace);
+                ns += now_ns() - start;
+                allocs += bench_alloc_count();
+            }
+
+            op_ns[o] += ns;
+            op_samples[o] += (uint64_t)trace->len * iterations;
+            op_allocs[o] += allocs;
+
+            fprintf(out, "%s    {\"trace\": \"%s\", \"samples\": %zu, \"op\": \"%s\", \"ns_per_call\": %.1f, \"ns_per_sample\": %.3f, \"allocs_per_call\": %.2f, \"result\": %d}",
+                    (first) ? "" : ",\n",
+                    trace->name,
+                    trace->len,
+                    bench_ops[o].name,
+                    (double)ns / iterations,
+                    (double)ns / ((double)trace->len * iterations),
+                    (double)allocs / iterations,
+                    result
+                   );
+            first = false;
+        }
+    }
+
+    fprintf(out, "\n  ],\n");
+    fprintf(out, "  \"summary\": [\n");
+    for (size_t o = 0; o < OP_COUNT; o++) {
+        uint64_t calls = (uint64_t)trace_count * iterations;
+        fprintf(out, "    {\"op\": \"%s\", \"ns_per_sample\": %.3f, \"allocs_per_call\": %.2f}%s\n",
+                bench_ops[o].name,
+                (op_samples[o]) ? (double)op_ns[o] / op_samples[o] : 0.0,
+                (calls) ? (double)op_allocs[o] / calls : 0.0,
+                (o + 1 < OP_COUNT) ? "," : ""
+               );
+    }
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    for (size_t t = 0; t < trace_count; t++) {
+        free(traces[t].samples);
+    }
+    free(traces);
+    free(work);
+    return 0;
+}
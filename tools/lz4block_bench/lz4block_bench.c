@@ -0,0 +1,402 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Tests and benchmark of the LZ4 block codec in common/lz4block.c
+//
+// Every input is cut in blocks the size of a frame payload like the firmware
+// does for a compressed BigBuf download, then unpacked in reverse order and
+// compared with the original. Inputs are the LF traces as 8 bit samples, the
+// HF traces as they are and a few synthetic buffers. Damaged blocks must be
+// refused. Reports the bytes on the wire compared with a plain download and
+// the pack / unpack rates.
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <dirent.h>
+#include <getopt.h>
+#include <time.h>
+#include "pm3_cmd.h"
+#include "lz4block.h"
+
+#define DEFAULT_TRACE_DIR   "traces"
+#define DEFAULT_ITERATIONS  20
+#define MAX_INPUT_LEN           (40000 * 32)
+#define MAX_INPUTS          256
+
+// frame overhead of a plain chunk (OLD frame, always full size) and of a block (NG frame)
+#define PLAIN_FRAME         sizeof(PacketResponseOLD)
+#define NG_OVERHEAD         (sizeof(PacketResponseNGPreamble) + sizeof(PacketResponseNGPostamble))
+
+typedef struct {
+    char name[128];
+    uint8_t *data;
+    size_t len;
+} input_t;
+
+static int failures;
+static int tests;
+
+static void check(bool ok, const char *name, const char *what) {
+    tests++;
+    if (ok == false) {
+        failures++;
+        printf("FAIL  %s: %s\n", name, what);
+    }
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// packs the whole input in frame sized blocks, returns the block count
+static size_t pack_all(const input_t *in, uint8_t *blocks, size_t *lens, size_t max_blocks) {
+    size_t n = 0;
+    size_t offset = 0;
+    while (offset < in->len && n < max_blocks) {
+        size_t consumed = 0;
+        lens[n] = lz4block_pack(in->data + offset, in->len - offset, offset, blocks + n * PM3_CMD_DATA_SIZE, PM3_CMD_DATA_SIZE, &consumed);
+        if (consumed == 0) {
+            break;
+        }
+        offset += consumed;
+        n++;
+    }
+    return (offset == in->len) ? n : 0;
+}
+
+// round trip, the blocks are unpacked last to first to show they don't depend on each other
+static bool roundtrip(const input_t *in, uint8_t *blocks, size_t *lens, size_t max_blocks, uint8_t *out, size_t *nblocks, size_t *wire) {
+    size_t n = pack_all(in, blocks, lens, max_blocks);
+    if (n == 0 && in->len) {
+        return false;
+    }
+
+    memset(out, 0xA5, in->len);
+    size_t total = 0;
+    *wire = 0;
+    for (size_t i = n; i-- > 0;) {
+        uint32_t offset = 0;
+        int res = lz4block_unpack(blocks + i * PM3_CMD_DATA_SIZE, lens[i], out, in->len, &offset);
+        if (res < 0) {
+            return false;
+        }
+        total += res;
+        *wire += lens[i] + NG_OVERHEAD;
+    }
+    *nblocks = n;
+    return total == in->len && memcmp(out, in->data, in->len) == 0;
+}
+
+static void test_damaged(void) {
+    uint8_t src[4096];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (i / 32) & 1 ? 200 : 56;
+    }
+    uint8_t block[PM3_CMD_DATA_SIZE];
+    uint8_t out[sizeof(src) + 16];
+    size_t consumed = 0;
+
+    size_t len = lz4block_pack(src, sizeof(src), 0, block, sizeof(block), &consumed);
+    check(len > sizeof(lz4block_hdr_t) && consumed == sizeof(src), "damaged", "square wave packs in one block");
+    check(((lz4block_hdr_t *)block)->method == LZ4BLOCK_LZ4, "damaged", "square wave is compressed");
+    check(lz4block_unpack(block, len, out, sizeof(src), NULL) == (int)sizeof(src), "damaged", "intact block unpacks");
+
+    check(lz4block_unpack(block, len - 1, out, sizeof(src), NULL) < 0, "damaged", "truncated block refused");
+    check(lz4block_unpack(block, sizeof(lz4block_hdr_t) - 1, out, sizeof(src), NULL) < 0, "damaged", "short header refused");
+    check(lz4block_unpack(block, len, out, sizeof(src) - 1, NULL) < 0, "damaged", "block past the end refused");
+
+    lz4block_hdr_t *hdr = (lz4block_hdr_t *)block;
+    hdr->offset = 1;
+    check(lz4block_unpack(block, len, out, sizeof(src), NULL) < 0, "damaged", "offset past the end refused");
+    hdr->offset = 0;
+    hdr->method = 7;
+    check(lz4block_unpack(block, len, out, sizeof(src), NULL) < 0, "damaged", "unknown method refused");
+    hdr->method = LZ4BLOCK_LZ4;
+    hdr->raw_len++;
+    check(lz4block_unpack(block, len, out, sizeof(src) + 1, NULL) < 0, "damaged", "wrong raw length refused");
+
+    // stored
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < sizeof(src); i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = seed >> 24;
+    }
+    len = lz4block_pack(src, sizeof(src), 100, block, sizeof(block), &consumed);
+    check(hdr->method == LZ4BLOCK_STORED && consumed == sizeof(block) - sizeof(lz4block_hdr_t), "damaged", "noise is stored");
+    check(lz4block_unpack(block, len - 1, out, sizeof(src), NULL) < 0, "damaged", "truncated stored block refused");
+    check(lz4block_unpack(block, len, out, 100 + consumed, NULL) == (int)consumed, "damaged", "stored block unpacks at its offset");
+    check(memcmp(out + 100, src, consumed) == 0, "damaged", "stored block content");
+
+    check(lz4block_pack(src, 0, 0, block, sizeof(block), &consumed) == 0 && consumed == 0, "damaged", "empty input");
+    check(lz4block_pack(src, 10, 0, block, sizeof(lz4block_hdr_t), &consumed) == 0 && consumed == 0, "damaged", "no room");
+}
+
+// .pm3 traces are one signed sample per line,  8 bit like in BigBuf
+static int load_pm3(const char *path, input_t *in) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return -1;
+    }
+    in->data = malloc(MAX_INPUT_LEN);
+    if (in->data == NULL) {
+        fclose(f);
+        return -1;
+    }
+    char line[80];
+    in->len = 0;
+    while (in->len < MAX_INPUT_LEN && fgets(line, sizeof(line), f)) {
+        int val = atoi(line);
+        if (val > 127) val = 127;
+        if (val < -127) val = -127;
+        in->data[in->len++] = (uint8_t)(val + 128);
+    }
+    fclose(f);
+    return 0;
+}
+
+// HF traces are sent from BigBuf as they are
+static int load_bin(const char *path, input_t *in) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return -1;
+    }
+    in->data = malloc(MAX_INPUT_LEN);
+    if (in->data == NULL) {
+        fclose(f);
+        return -1;
+    }
+    in->len = fread(in->data, 1, MAX_INPUT_LEN, f);
+    fclose(f);
+    return 0;
+}
+
+static bool has_suffix(const char *s, const char *suffix) {
+    size_t l = strlen(s), sl = strlen(suffix);
+    return l >= sl && strcmp(s + l - sl, suffix) == 0;
+}
+
+static int cmp_name(const void *a, const void *b) {
+    return strcmp(((const input_t *)a)->name, ((const input_t *)b)->name);
+}
+
+static size_t load_traces(const char *dir, input_t *inputs, size_t max) {
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        fprintf(stderr, "can't open trace directory %s\n", dir);
+        return 0;
+    }
+
+    size_t n = 0;
+    struct dirent *e;
+    char path[512];
+    while ((e = readdir(d)) != NULL && n < max) {
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        int res = -1;
+        if (strncmp(e->d_name, "lf_", 3) == 0 && has_suffix(e->d_name, ".pm3")) {
+            res = load_pm3(path, &inputs[n]);
+        } else if (strncmp(e->d_name, "hf_", 3) == 0 && has_suffix(e->d_name, ".trace")) {
+            res = load_bin(path, &inputs[n]);
+        }
+        if (res == 0) {
+            snprintf(inputs[n].name, sizeof(inputs[n].name), "%s", e->d_name);
+            n++;
+        }
+    }
+    closedir(d);
+
+    qsort(inputs, n, sizeof(input_t), cmp_name);
+    return n;
+}
+
+static size_t make_synthetic(input_t *inputs, size_t max) {
+    static const struct {
+        const char *name;
+        size_t len;
+    } synth[] = {
+        {"synthetic zeros", 40000},
+        {"synthetic square wave", 40000},
+        {"synthetic noise", 40000},
+        {"synthetic noisy square wave", 40000},
+        {"synthetic 1 byte", 1},
+        {"synthetic 17 bytes", 17},
+        {"synthetic 64 KiB + 1 zeros", 65537},
+    };
+
+    size_t n = 0;
+    uint32_t seed = 0x12345678;
+    for (size_t s = 0; s < sizeof(synth) / sizeof(synth[0]) && n < max; s++, n++) {
+        input_t *in = &inputs[n];
+        snprintf(in->name, sizeof(in->name), "%s", synth[s].name);
+        in->len = synth[s].len;
+        in->data = calloc(in->len, 1);
+        if (in->data == NULL) {
+            break;
+        }
+        for (size_t i = 0; i < in->len; i++) {
+            seed = seed * 1103515245 + 12345;
+            uint8_t noise = seed >> 24;
+            switch (s) {
+                case 1:
+                    in->data[i] = ((i / 16) & 1) ? 200 : 56;
+                    break;
+                case 2:
+                    in->data[i] = noise;
+                    break;
+                case 3:
+                    in->data[i] = (((i / 16) & 1) ? 200 : 56) + (noise & 7);
+                    break;
+                case 5:
+                    in->data[i] = 'a' + i;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return n;
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [-n <iterations>] [-d <trace dir>] [--check]\n", prog);
+    printf("\n");
+    printf("Packs the LF / HF traces and synthetic buffers in frame sized LZ4 blocks, checks the round trip\n");
+    printf("and reports the bytes on the wire compared with a plain BigBuf download and the pack / unpack rates.\n");
+    printf("\n");
+    printf("  -n, --iterations <n>  timed round trips per input (default %d)\n", DEFAULT_ITERATIONS);
+    printf("  -d, --dir <dir>       trace directory (default " DEFAULT_TRACE_DIR ")\n");
+    printf("  -c, --check           only run the tests\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    int iterations = DEFAULT_ITERATIONS;
+    const char *dir = DEFAULT_TRACE_DIR;
+    bool check_only = false;
+
+    static struct option long_options[] = {
+        {"iterations", required_argument, NULL, 'n'},
+        {"dir",        required_argument, NULL, 'd'},
+        {"check",      no_argument,       NULL, 'c'},
+        {"help",       no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:d:ch", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'n':
+                iterations = atoi(optarg);
+                break;
+            case 'd':
+                dir = optarg;
+                break;
+            case 'c':
+                check_only = true;
+                break;
+            case 'h':
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 1;
+        }
+    }
+
+    if (iterations < 1) {
+        fprintf(stderr, "iterations must be at least 1\n");
+        return 1;
+    }
+
+    input_t *inputs = calloc(MAX_INPUTS, sizeof(input_t));
+    size_t max_blocks = MAX_INPUT_LEN * 2 / (PM3_CMD_DATA_SIZE - sizeof(lz4block_hdr_t)) + 1;
+    uint8_t *blocks = malloc(max_blocks * PM3_CMD_DATA_SIZE);
+    size_t *lens = calloc(max_blocks, sizeof(size_t));
+    uint8_t *out = malloc(MAX_INPUT_LEN * 2);
+    if (inputs == NULL || blocks == NULL || lens == NULL || out == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    size_t count = make_synthetic(inputs, MAX_INPUTS);
+    count += load_traces(dir, inputs + count, MAX_INPUTS - count);
+
+    test_damaged();
+
+    if (check_only == false) {
+        printf("%-45s | %8s | %6s | %9s | %9s | %6s | %8s | %8s\n", "input", "bytes", "blocks", "plain", "lz4", "ratio", "pack", "unpack");
+        printf("%-45s-+-%8s-+-%6s-+-%9s-+-%9s-+-%6s-+-%8s-+-%8s\n", "---------------------------------------------", "--------", "------", "---------", "---------", "------", "--------", "--------");
+    }
+
+    uint64_t sum_plain = 0, sum_wire = 0, sum_bytes = 0, sum_pack_ns = 0, sum_unpack_ns = 0;
+    for (size_t i = 0; i < count; i++) {
+        const input_t *in = &inputs[i];
+        size_t nblocks = 0, wire = 0;
+
+        check(roundtrip(in, blocks, lens, max_blocks, out, &nblocks, &wire), in->name, "round trip");
+        if (check_only) {
+            continue;
+        }
+
+        uint64_t pack_ns = 0, unpack_ns = 0;
+        for (int it = 0; it < iterations; it++) {
+            uint64_t start = now_ns();
+            size_t n = pack_all(in, blocks, lens, max_blocks);
+            pack_ns += now_ns() - start;
+
+            start = now_ns();
+            for (size_t b = 0; b < n; b++) {
+                lz4block_unpack(blocks + b * PM3_CMD_DATA_SIZE, lens[b], out, in->len, NULL);
+            }
+            unpack_ns += now_ns() - start;
+        }
+
+        size_t plain = ((in->len + PM3_CMD_DATA_SIZE - 1) / PM3_CMD_DATA_SIZE) * PLAIN_FRAME;
+        printf("%-45s | %8zu | %6zu | %9zu | %9zu | %5.1fx | %4.0f MB/s | %4.0f MB/s\n"
+               , in->name, in->len, nblocks, plain, wire
+               , (wire) ? (double)plain / wire : 0
+               , (pack_ns) ? (double)in->len * iterations * 1000 / pack_ns : 0
+               , (unpack_ns) ? (double)in->len * iterations * 1000 / unpack_ns : 0
+              );
+
+        sum_plain += plain;
+        sum_wire += wire;
+        sum_bytes += (uint64_t)in->len * iterations;
+        sum_pack_ns += pack_ns;
+        sum_unpack_ns += unpack_ns;
+    }
+
+    if (check_only == false && sum_wire) {
+        printf("\nall inputs: %" PRIu64 " bytes plain, %" PRIu64 " bytes lz4, %.1fx, pack %.0f MB/s, unpack %.0f MB/s\n\n"
+               , sum_plain, sum_wire, (double)sum_plain / sum_wire
+               , (double)sum_bytes * 1000 / sum_pack_ns
+               , (double)sum_bytes * 1000 / sum_unpack_ns
+              );
+    }
+
+    printf("Tests: %d, %d failed, %s\n", tests, failures, (failures) ? "FAIL" : "ok");
+
+    for (size_t i = 0; i < count; i++) {
+        free(inputs[i].data);
+    }
+    free(inputs);
+    free(blocks);
+    free(lens);
+    free(out);
+    return (failures) ? 1 : 0;
+}
@@ -0,0 +1,930 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Software stand-in for a Proxmark3 device, for testing and benchmarking the
+// client comms layer without hardware.
+//
+// Listens on a TCP port (client port tcp:localhost:<port>) or an abstract unix
+// socket (client port socket:<name>) and speaks the OLD / MIX / NG framing,
+// tagged frames included. A few device commands are built in (ping,
+// capabilities, version, BigBuf downloads and uploads...), any other command
+// can get scripted replies. Latency and bandwidth of the link are configurable.
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <stddef.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "pm3_cmd.h"
+#include "crc16.h"
+#include "lz4block.h"
+
+#define DEFAULT_PORT            18888
+#define DEFAULT_BIGBUF_SIZE     40000
+#define MAX_SCRIPT_REPLIES      1024
+#define RX_BUF_LEN              (16 * 1024)
+
+typedef struct {
+    uint16_t cmd;           // command replied to
+    int8_t status;
+    uint32_t delay_ms;      // before the reply, on top of the link latency
+    uint16_t wtx_ms;        // send a CMD_WTX of that many ms first, 0 for none
+    bool mix;               // reply a MIX frame, data is prefixed with three zero oldargs
+    bool none;              // don't reply at all
+    uint16_t len;
+    uint8_t data[PM3_CMD_DATA_SIZE];
+} script_reply_t;
+
+typedef struct {
+    uint16_t port;
+    const char *socket_name;
+    uint32_t latency_ms;
+    uint32_t bandwidth;     // bytes/s towards the client, 0 for unlimited
+    uint32_t bigbuf_size;
+    bool seq_tags;
+    bool lz4;
+    bool once;
+    bool verbose;
+} devemu_opts_t;
+
+typedef struct {
+    int fd;
+    uint16_t seq;           // of the command being served, 0 if untagged
+    uint8_t dbglevel;
+    uint8_t *bigbuf;
+    uint32_t bigbuf_size;
+    uint32_t tracelen;
+    double tx_free_at;      // bandwidth throttle, seconds
+    // statistics
+    uint64_t cmds;
+    uint64_t tagged;
+    uint64_t frames_out;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint64_t crc_errors;
+} devemu_t;
+
+static devemu_opts_t g_opts = {
+    .port = DEFAULT_PORT,
+    .bigbuf_size = DEFAULT_BIGBUF_SIZE,
+    .seq_tags = true,
+    .lz4 = true,
+};
+
+static script_reply_t *g_script;
+static size_t g_script_count;
+// next scripted reply to use per command, they are served in turn
+static size_t *g_script_next;
+
+static volatile sig_atomic_t g_stop = 0;
+
+static void sigint_handler(int sig) {
+    (void)sig;
+    g_stop = 1;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void sleep_ms(uint32_t ms) {
+    if (ms == 0) {
+        return;
+    }
+    struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR && g_stop == 0) {};
+}
+
+static void vlog(const char *fmt, ...) {
+    if (g_opts.verbose == false) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+//-----------------------------------------------------------------------------
+// Link
+//-----------------------------------------------------------------------------
+static int link_send(devemu_t *dev, const uint8_t *data, size_t len) {
+
+    if (g_opts.bandwidth) {
+        // hold the frame back until the link is free again
+        double now = now_s();
+        double start = (dev->tx_free_at > now) ? dev->tx_free_at : now;
+        dev->tx_free_at = start + (double)len / g_opts.bandwidth;
+        if (start > now) {
+            sleep_ms((uint32_t)((start - now) * 1000));
+        }
+    }
+
+    size_t sent = 0;
+    while (sent < len) {
+        ssize_t res = send(dev->fd, data + sent, len - sent, MSG_NOSIGNAL);
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        sent += res;
+    }
+    dev->bytes_out += len;
+    dev->frames_out++;
+    return 0;
+}
+
+static int reply_ng_internal(devemu_t *dev, uint16_t cmd, int8_t status, const uint8_t *data, size_t len, bool ng) {
+    PacketResponseNGRaw frame;
+    memset(&frame.pre, 0, sizeof(frame.pre));
+
+    if (len > PM3_CMD_DATA_SIZE) {
+        len = PM3_CMD_DATA_SIZE;
+        status = PM3_EOVFLOW;
+    }
+
+    frame.pre.magic = (dev->seq) ? RESPONSENG_TAGGED_PREAMBLE_MAGIC : RESPONSENG_PREAMBLE_MAGIC;
+    frame.pre.length = len & 0x7FFF;
+    frame.pre.ng = ng;
+    frame.pre.status = status;
+    frame.pre.reason = PM3_REASON_UNKNOWN;
+    frame.pre.cmd = cmd;
+    if (len && data) {
+        memcpy(frame.data, data, len);
+    }
+
+    size_t seqlen = 0;
+    if (dev->seq) {
+        PacketResponseNGTaggedPostamble *tpost = (PacketResponseNGTaggedPostamble *)(frame.data + len);
+        tpost->seq = dev->seq;
+        seqlen = sizeof(tpost->seq);
+    }
+
+    // like over USB, no crc
+    PacketResponseNGPostamble *post = (PacketResponseNGPostamble *)(frame.data + len + seqlen);
+    post->crc = RESPONSENG_POSTAMBLE_MAGIC;
+
+    return link_send(dev, (uint8_t *)&frame, sizeof(PacketResponseNGPreamble) + len + seqlen + sizeof(PacketResponseNGPostamble));
+}
+
+static int reply_ng(devemu_t *dev, uint16_t cmd, int8_t status, const uint8_t *data, size_t len) {
+    return reply_ng_internal(dev, cmd, status, data, len, true);
+}
+
+static int reply_mix(devemu_t *dev, uint16_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const uint8_t *data, size_t len) {
+    uint8_t buf[PM3_CMD_DATA_SIZE];
+    uint64_t arg[3] = {arg0, arg1, arg2};
+    len = (len > PM3_CMD_DATA_SIZE_MIX) ? PM3_CMD_DATA_SIZE_MIX : len;
+    memcpy(buf, arg, sizeof(arg));
+    if (len && data) {
+        memcpy(buf + sizeof(arg), data, len);
+    }
+    return reply_ng_internal(dev, cmd, PM3_SUCCESS, buf, sizeof(arg) + len, false);
+}
+
+static int reply_old(devemu_t *dev, uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, const uint8_t *data, size_t len) {
+    PacketResponseOLD frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.cmd = cmd;
+    frame.arg[0] = arg0;
+    frame.arg[1] = arg1;
+    frame.arg[2] = arg2;
+    if (len && data) {
+        memcpy(frame.d.asBytes, data, (len > PM3_CMD_DATA_SIZE) ? PM3_CMD_DATA_SIZE : len);
+    }
+    return link_send(dev, (uint8_t *)&frame, sizeof(frame));
+}
+
+static void dbprint(devemu_t *dev, const char *fmt, ...) {
+    struct {
+        uint16_t flag;
+        char buf[PM3_CMD_DATA_SIZE - sizeof(uint16_t)];
+    } PACKED data;
+    data.flag = FLAG_LOG;
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(data.buf, sizeof(data.buf), fmt, args);
+    va_end(args);
+    len = (len < 0) ? 0 : ((len >= (int)sizeof(data.buf)) ? (int)sizeof(data.buf) - 1 : len);
+    reply_ng(dev, CMD_DEBUG_PRINT_STRING, PM3_SUCCESS, (uint8_t *)&data, sizeof(data.flag) + len);
+}
+
+//-----------------------------------------------------------------------------
+// Scripted replies
+//-----------------------------------------------------------------------------
+static int parse_hex(const char *s, uint8_t *out, size_t maxlen, uint16_t *outlen) {
+    size_t n = 0;
+    int nibble = -1;
+    for (; *s; s++) {
+        if (isspace((unsigned char)*s) || *s == ':') {
+            continue;
+        }
+        if (isxdigit((unsigned char)*s) == 0) {
+            return -1;
+        }
+        int v = isdigit((unsigned char)*s) ? *s - '0' : (tolower((unsigned char)*s) - 'a' + 10);
+        if (nibble < 0) {
+            nibble = v;
+        } else {
+            if (n == maxlen) {
+                return -1;
+            }
+            out[n++] = (nibble << 4) | v;
+            nibble = -1;
+        }
+    }
+    if (nibble >= 0) {
+        return -1;
+    }
+    *outlen = n;
+    return 0;
+}
+
+// one reply per line:  <cmd> [status=<n>] [delay=<ms>] [wtx=<ms>] [mix] [none] [data=<hex>]
+static int load_script(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "can't open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    g_script = calloc(MAX_SCRIPT_REPLIES, sizeof(script_reply_t));
+    g_script_next = calloc(MAX_SCRIPT_REPLIES, sizeof(size_t));
+    if (g_script == NULL || g_script_next == NULL) {
+        fclose(f);
+        return -1;
+    }
+
+    char line[4096];
+    int lineno = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+
+        char *tok = strtok(line, " \t\r\n");
+        if (tok == NULL) {
+            continue;
+        }
+
+        if (g_script_count == MAX_SCRIPT_REPLIES) {
+            fprintf(stderr, "%s:%d: too many replies, max %d\n", path, lineno, MAX_SCRIPT_REPLIES);
+            fclose(f);
+            return -1;
+        }
+
+        script_reply_t *r = &g_script[g_script_count];
+        char *end;
+        unsigned long cmd = strtoul(tok, &end, 0);
+        if (*end != '\0' || cmd > 0xFFFF) {
+            fprintf(stderr, "%s:%d: bad command `%s`\n", path, lineno, tok);
+            fclose(f);
+            return -1;
+        }
+        r->cmd = cmd;
+
+        while ((tok = strtok(NULL, " \t\r\n")) != NULL) {
+            if (strncmp(tok, "status=", 7) == 0) {
+                r->status = (int8_t)strtol(tok + 7, NULL, 0);
+            } else if (strncmp(tok, "delay=", 6) == 0) {
+                r->delay_ms = strtoul(tok + 6, NULL, 0);
+            } else if (strncmp(tok, "wtx=", 4) == 0) {
+                r->wtx_ms = strtoul(tok + 4, NULL, 0);
+            } else if (strcmp(tok, "mix") == 0) {
+                r->mix = true;
+            } else if (strcmp(tok, "none") == 0) {
+                r->none = true;
+            } else if (strncmp(tok, "data=", 5) == 0) {
+                if (parse_hex(tok + 5, r->data, PM3_CMD_DATA_SIZE, &r->len) != 0) {
+                    fprintf(stderr, "%s:%d: bad hex data\n", path, lineno);
+                    fclose(f);
+                    return -1;
+                }
+            } else {
+                fprintf(stderr, "%s:%d: unknown option `%s`\n", path, lineno, tok);
+                fclose(f);
+                return -1;
+            }
+        }
+        g_script_count++;
+    }
+    fclose(f);
+    return 0;
+}
+
+static const script_reply_t *script_find(uint16_t cmd) {
+    // the first line of a command keeps track of its turn
+    size_t first = g_script_count;
+    size_t count = 0;
+    for (size_t i = 0; i < g_script_count; i++) {
+        if (g_script[i].cmd == cmd) {
+            if (count == 0) {
+                first = i;
+            }
+            count++;
+        }
+    }
+    if (count == 0) {
+        return NULL;
+    }
+
+    size_t turn = g_script_next[first]++ % count;
+    for (size_t i = first; i < g_script_count; i++) {
+        if (g_script[i].cmd == cmd && turn-- == 0) {
+            return &g_script[i];
+        }
+    }
+    return NULL;
+}
+
+static int script_reply(devemu_t *dev, const script_reply_t *r) {
+    sleep_ms(r->delay_ms);
+    if (r->wtx_ms) {
+        uint16_t wtx = r->wtx_ms;
+        reply_ng(dev, CMD_WTX, PM3_SUCCESS, (uint8_t *)&wtx, sizeof(wtx));
+        sleep_ms(r->wtx_ms);
+    }
+    if (r->none) {
+        return 0;
+    }
+    if (r->mix) {
+        return reply_mix(dev, r->cmd, 0, 0, 0, r->data, r->len);
+    }
+    return reply_ng(dev, r->cmd, r->status, r->data, r->len);
+}
+
+//-----------------------------------------------------------------------------
+// Built in commands
+//-----------------------------------------------------------------------------
+static void send_capabilities(devemu_t *dev) {
+    capabilities_t caps;
+    memset(&caps, 0, sizeof(caps));
+    // without tags, act like a version 6 firmware. The bit is left set, it's garbage there
+    caps.version = (g_opts.seq_tags) ? CAPABILITIES_VERSION : CAPABILITIES_VERSION_UNTAGGED;
+    caps.baudrate = 0;
+    caps.bigbuf_size = dev->bigbuf_size;
+    caps.via_usb = true;
+    caps.compiled_with_lf = true;
+    caps.compiled_with_hitag = true;
+    caps.compiled_with_em4x50 = true;
+    caps.compiled_with_em4x70 = true;
+    caps.compiled_with_zx8211 = true;
+    caps.compiled_with_hfsniff = true;
+    caps.compiled_with_hfplot = true;
+    caps.compiled_with_iso14443a = true;
+    caps.compiled_with_iso14443b = true;
+    caps.compiled_with_iso15693 = true;
+    caps.compiled_with_felica = true;
+    caps.compiled_with_legicrf = true;
+    caps.compiled_with_iclass = true;
+    caps.compiled_with_nfcbarcode = true;
+    caps.has_tagged_frames = true;
+    reply_ng(dev, CMD_CAPABILITIES, PM3_SUCCESS, (uint8_t *)&caps, sizeof(caps));
+}
+
+static void send_version(devemu_t *dev) {
+    struct {
+        uint32_t id;
+        uint32_t section_size;
+        uint32_t versionstr_len;
+        char versionstr[PM3_CMD_DATA_SIZE - 12];
+    } PACKED payload;
+    memset(&payload, 0, sizeof(payload));
+    snprintf(payload.versionstr, sizeof(payload.versionstr), "  device emulator (pm3_devemu)\n");
+    payload.versionstr_len = strlen(payload.versionstr) + 1;
+    reply_ng(dev, CMD_VERSION, PM3_SUCCESS, (uint8_t *)&payload, 12 + payload.versionstr_len);
+}
+
+static void download_bigbuf(devemu_t *dev, const PacketCommandNG *packet) {
+    uint32_t startidx = packet->oldarg[0];
+    uint32_t numofbytes = packet->oldarg[1];
+
+    if (startidx > dev->bigbuf_size) {
+        startidx = dev->bigbuf_size;
+    }
+    if (numofbytes > dev->bigbuf_size - startidx) {
+        numofbytes = dev->bigbuf_size - startidx;
+    }
+
+    // same as the firmware, OLD frames or NG LZ4 blocks, then a MIX ACK
+    if (g_opts.lz4 && (packet->oldarg[2] & DOWNLOAD_BIGBUF_FLAG_LZ4)) {
+        uint8_t block[PM3_CMD_DATA_SIZE];
+        uint32_t offset = 0;
+        while (offset < numofbytes) {
+            size_t consumed = 0;
+            size_t len = lz4block_pack(dev->bigbuf + startidx + offset, numofbytes - offset, offset, block, sizeof(block), &consumed);
+            if (reply_ng(dev, CMD_DOWNLOADED_BIGBUF_LZ4, PM3_SUCCESS, block, len) != 0) {
+                return;
+            }
+            offset += consumed;
+        }
+    } else {
+        for (uint32_t offset = 0; offset < numofbytes; offset += PM3_CMD_DATA_SIZE) {
+            uint32_t len = numofbytes - offset;
+            len = (len > PM3_CMD_DATA_SIZE) ? PM3_CMD_DATA_SIZE : len;
+            if (reply_old(dev, CMD_DOWNLOADED_BIGBUF, offset, len, dev->tracelen, dev->bigbuf + startidx + offset, len) != 0) {
+                return;
+            }
+        }
+    }
+    reply_mix(dev, CMD_ACK, 1, 0, dev->tracelen, NULL, 0);
+}
+
+static void upload_sim_samples(devemu_t *dev, const PacketCommandNG *packet) {
+    struct p {
+        uint8_t flag;
+        uint16_t offset;
+        uint8_t data[PM3_CMD_DATA_SIZE - sizeof(uint8_t) - sizeof(uint16_t)];
+    } PACKED;
+    const struct p *payload = (const struct p *)packet->data.asBytes;
+
+    if (payload->flag & 0x1) {
+        memset(dev->bigbuf, 0, dev->bigbuf_size);
+    }
+    if (payload->offset >= dev->bigbuf_size) {
+        reply_ng(dev, CMD_LF_UPLOAD_SIM_SAMPLES, PM3_EOVFLOW, NULL, 0);
+        return;
+    }
+    size_t len = dev->bigbuf_size - payload->offset;
+    len = (len > sizeof(payload->data)) ? sizeof(payload->data) : len;
+    memcpy(dev->bigbuf + payload->offset, payload->data, len);
+    reply_ng(dev, CMD_LF_UPLOAD_SIM_SAMPLES, PM3_SUCCESS, NULL, 0);
+}
+
+static void packet_received(devemu_t *dev, const PacketCommandNG *packet) {
+
+    dev->cmds++;
+    vlog("<- %s cmd 0x%04x len %u seq %u\n", packet->ng ? "NG " : (packet->magic ? "MIX" : "OLD"), packet->cmd, packet->length, packet->seq);
+
+    // the link delay of the command and its reply
+    sleep_ms(g_opts.latency_ms);
+
+    const script_reply_t *r = script_find(packet->cmd);
+    if (r) {
+        script_reply(dev, r);
+        return;
+    }
+
+    switch (packet->cmd) {
+        case CMD_PING: {
+            reply_ng(dev, CMD_PING, PM3_SUCCESS, packet->data.asBytes, packet->length);
+            break;
+        }
+        case CMD_CAPABILITIES: {
+            send_capabilities(dev);
+            break;
+        }
+        case CMD_VERSION: {
+            send_version(dev);
+            break;
+        }
+        case CMD_STATUS: {
+            dbprint(dev, "device emulator, %" PRIu64 " commands served", dev->cmds);
+            reply_ng(dev, CMD_STATUS, PM3_SUCCESS, NULL, 0);
+            break;
+        }
+        case CMD_SET_DBGMODE: {
+            dev->dbglevel = packet->data.asBytes[0];
+            reply_ng(dev, CMD_SET_DBGMODE, PM3_SUCCESS, NULL, 0);
+            break;
+        }
+        case CMD_GET_DBGMODE: {
+            reply_ng(dev, CMD_GET_DBGMODE, PM3_SUCCESS, &dev->dbglevel, 1);
+            break;
+        }
+        case CMD_BUFF_CLEAR: {
+            memset(dev->bigbuf, 0, dev->bigbuf_size);
+            dev->tracelen = 0;
+            break;
+        }
+        case CMD_DOWNLOAD_BIGBUF: {
+            download_bigbuf(dev, packet);
+            break;
+        }
+        case CMD_LF_UPLOAD_SIM_SAMPLES: {
+            upload_sim_samples(dev, packet);
+            break;
+        }
+        case CMD_LF_SAMPLING_GET_CONFIG: {
+            sample_config sc;
+            memset(&sc, 0, sizeof(sc));
+            sc.decimation = 1;
+            sc.bits_per_sample = 8;
+            sc.averaging = 1;
+            sc.divisor = LF_DIVISOR_125;
+            reply_ng(dev, CMD_LF_SAMPLING_GET_CONFIG, PM3_SUCCESS, (uint8_t *)&sc, sizeof(sc));
+            break;
+        }
+        // nothing to reply
+        case CMD_BREAK_LOOP:
+        case CMD_HF_DROPFIELD:
+        case CMD_QUIT_SESSION: {
+            break;
+        }
+        default: {
+            dbprint(dev, "%s: 0x%04x", "unknown command:", packet->cmd);
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Framing
+//-----------------------------------------------------------------------------
+typedef struct {
+    uint8_t buf[RX_BUF_LEN];
+    size_t len;
+} rx_buf_t;
+
+// Parses one command frame at the start of the buffer.
+// Returns the bytes to skip, 0 if incomplete. valid tells if rx holds a command
+static size_t parse_frame(devemu_t *dev, const uint8_t *buf, size_t avail, PacketCommandNG *rx, bool *valid) {
+
+    *valid = false;
+
+    if (avail < sizeof(PacketCommandNGPreamble)) {
+        return 0;
+    }
+
+    PacketCommandNGPreamble pre;
+    memcpy(&pre, buf, sizeof(pre));
+    memset(rx, 0, sizeof(PacketCommandNG));
+
+    if (pre.magic == COMMANDNG_PREAMBLE_MAGIC || pre.magic == COMMANDNG_TAGGED_PREAMBLE_MAGIC) {
+        size_t length = pre.length;
+        size_t seqlen = (pre.magic == COMMANDNG_TAGGED_PREAMBLE_MAGIC) ? sizeof(uint16_t) : 0;
+        size_t flen = sizeof(pre) + length + seqlen + sizeof(PacketCommandNGPostamble);
+        if (length > PM3_CMD_DATA_SIZE) {
+            // garbage, resync on the next byte
+            return 1;
+        }
+        if (avail < flen) {
+            return 0;
+        }
+
+        const uint8_t *data = buf + sizeof(pre);
+        if (seqlen) {
+            memcpy(&rx->seq, data + length, sizeof(rx->seq));
+        }
+        memcpy(&rx->crc, data + length + seqlen, sizeof(rx->crc));
+        if (rx->crc != COMMANDNG_POSTAMBLE_MAGIC) {
+            uint8_t first, second;
+            compute_crc(CRC_14443_A, buf, sizeof(pre) + length + seqlen, &first, &second);
+            if ((first << 8) + second != rx->crc) {
+                dev->crc_errors++;
+                vlog("<- frame with bad crc, dropped\n");
+                return flen;
+            }
+        }
+
+        rx->magic = pre.magic;
+        rx->ng = pre.ng;
+        rx->cmd = pre.cmd;
+        if (rx->ng) {
+            memcpy(rx->data.asBytes, data, length);
+            rx->length = length;
+        } else {
+            uint64_t arg[3];
+            if (length < sizeof(arg)) {
+                return flen;
+            }
+            memcpy(arg, data, sizeof(arg));
+            rx->oldarg[0] = arg[0];
+            rx->oldarg[1] = arg[1];
+            rx->oldarg[2] = arg[2];
+            memcpy(rx->data.asBytes, data + sizeof(arg), length - sizeof(arg));
+            rx->length = length - sizeof(arg);
+        }
+        *valid = true;
+        return flen;
+    }
+
+    // OLD frame
+    if (avail < sizeof(PacketCommandOLD)) {
+        return 0;
+    }
+    PacketCommandOLD old;
+    memcpy(&old, buf, sizeof(old));
+    rx->cmd = old.cmd & 0xFFFF;
+    rx->oldarg[0] = old.arg[0];
+    rx->oldarg[1] = old.arg[1];
+    rx->oldarg[2] = old.arg[2];
+    rx->length = PM3_CMD_DATA_SIZE;
+    memcpy(rx->data.asBytes, old.d.asBytes, PM3_CMD_DATA_SIZE);
+    *valid = true;
+    return sizeof(PacketCommandOLD);
+}
+
+static void serve(devemu_t *dev) {
+    rx_buf_t *rxb = calloc(1, sizeof(rx_buf_t));
+    if (rxb == NULL) {
+        return;
+    }
+
+    while (g_stop == 0) {
+        ssize_t res = recv(dev->fd, rxb->buf + rxb->len, sizeof(rxb->buf) - rxb->len, 0);
+        if (res <= 0) {
+            if (res < 0 && errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        dev->bytes_in += res;
+        rxb->len += res;
+
+        // commands are served one by one, like the device does
+        size_t pos = 0;
+        PacketCommandNG rx;
+        while (pos < rxb->len) {
+            bool valid;
+            size_t flen = parse_frame(dev, rxb->buf + pos, rxb->len - pos, &rx, &valid);
+            if (flen == 0) {
+                break;
+            }
+            pos += flen;
+            if (valid == false) {
+                continue;
+            }
+            dev->seq = rx.seq;
+            dev->tagged += (rx.seq != 0);
+            packet_received(dev, &rx);
+            dev->seq = 0;
+        }
+        memmove(rxb->buf, rxb->buf + pos, rxb->len - pos);
+        rxb->len -= pos;
+    }
+    free(rxb);
+}
+
+static int open_listener(void) {
+    int fd;
+    if (g_opts.socket_name) {
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        size_t nlen = strlen(g_opts.socket_name);
+        if (nlen + 1 >= sizeof(addr.sun_path)) {
+            fprintf(stderr, "socket name too long\n");
+            return -1;
+        }
+        // abstract namespace, like the client expects
+        memcpy(addr.sun_path + 1, g_opts.socket_name, nlen);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || bind(fd, (struct sockaddr *)&addr, offsetof(struct sockaddr_un, sun_path) + 1 + nlen) < 0) {
+            fprintf(stderr, "can't bind socket:%s: %s\n", g_opts.socket_name, strerror(errno));
+            return -1;
+        }
+    } else {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(g_opts.port);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        int one = 1;
+        if (fd >= 0) {
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        }
+        if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            fprintf(stderr, "can't bind tcp:localhost:%u: %s\n", g_opts.port, strerror(errno));
+            return -1;
+        }
+    }
+    if (listen(fd, 1) < 0) {
+        fprintf(stderr, "listen: %s\n", strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int load_bigbuf(devemu_t *dev, const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "can't open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    size_t n = fread(dev->bigbuf, 1, dev->bigbuf_size, f);
+    fclose(f);
+    dev->tracelen = 0;
+    fprintf(stderr, "loaded %zu bytes into BigBuf\n", n);
+    return 0;
+}
+
+static void print_stats(const devemu_t *dev, double elapsed) {
+    fprintf(stderr, "session: %" PRIu64 " commands (%" PRIu64 " tagged), %" PRIu64 " replies, "
+            "%" PRIu64 " bytes in, %" PRIu64 " bytes out, %" PRIu64 " crc errors, %.3f s",
+            dev->cmds, dev->tagged, dev->frames_out, dev->bytes_in, dev->bytes_out, dev->crc_errors, elapsed);
+    if (elapsed > 0) {
+        fprintf(stderr, ", %.1f kB/s out", dev->bytes_out / elapsed / 1000);
+    }
+    fprintf(stderr, "\n");
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "Software Proxmark3 device for comms testing, connect with\n"
+            "  proxmark3 tcp:localhost:<port>   or   proxmark3 socket:<name>\n"
+            "\n"
+            "  -p, --port <n>          TCP port on localhost (default %d)\n"
+            "  -s, --socket <name>     abstract unix socket instead of TCP\n"
+            "  -l, --latency <ms>      delay before serving each command (default 0)\n"
+            "  -b, --bandwidth <B/s>   limit the reply rate (default unlimited)\n"
+            "  -m, --bigbuf <file>     BigBuf content (default a sample pattern)\n"
+            "      --bigbuf-size <n>   BigBuf size (default %d)\n"
+            "  -r, --replies <file>    scripted replies\n"
+            "      --no-tags           act like a firmware without tagged frames, version 6 capabilities\n"
+            "      --no-lz4            act like a firmware without compressed BigBuf downloads\n"
+            "  -1, --once              exit when the first client disconnects\n"
+            "  -v, --verbose           log every command\n"
+            "  -h, --help              this help\n"
+            "\n"
+            "Scripted replies, one per line, served in turn when a command has several:\n"
+            "  <cmd> [status=<n>] [delay=<ms>] [wtx=<ms>] [mix] [none] [data=<hex>]\n",
+            prog, DEFAULT_PORT, DEFAULT_BIGBUF_SIZE);
+}
+
+int main(int argc, char *argv[]) {
+
+    static const struct option long_options[] = {
+        {"port",        required_argument, NULL, 'p'},
+        {"socket",      required_argument, NULL, 's'},
+        {"latency",     required_argument, NULL, 'l'},
+        {"bandwidth",   required_argument, NULL, 'b'},
+        {"bigbuf",      required_argument, NULL, 'm'},
+        {"bigbuf-size", required_argument, NULL, 'S'},
+        {"replies",     required_argument, NULL, 'r'},
+        {"no-tags",     no_argument,       NULL, 'T'},
+        {"no-lz4",      no_argument,       NULL, 'Z'},
+        {"once",        no_argument,       NULL, '1'},
+        {"verbose",     no_argument,       NULL, 'v'},
+        {"help",        no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    const char *bigbuf_file = NULL;
+    const char *replies_file = NULL;
+
+    int c;
+    while ((c = getopt_long(argc, argv, "p:s:l:b:m:r:1vh", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'p':
+                g_opts.port = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                g_opts.socket_name = optarg;
+                break;
+            case 'l':
+                g_opts.latency_ms = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                g_opts.bandwidth = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                bigbuf_file = optarg;
+                break;
+            case 'S':
+                g_opts.bigbuf_size = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                replies_file = optarg;
+                break;
+            case 'T':
+                g_opts.seq_tags = false;
+                break;
+            case 'Z':
+                g_opts.lz4 = false;
+                break;
+            case '1':
+                g_opts.once = true;
+                break;
+            case 'v':
+                g_opts.verbose = true;
+                break;
+            case 'h':
+                usage(argv[0]);
+                return EXIT_SUCCESS;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (g_opts.bigbuf_size == 0) {
+        fprintf(stderr, "BigBuf size can't be 0\n");
+        return EXIT_FAILURE;
+    }
+
+    if (replies_file && load_script(replies_file) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    devemu_t dev;
+    memset(&dev, 0, sizeof(dev));
+    dev.bigbuf_size = g_opts.bigbuf_size;
+    dev.bigbuf = calloc(dev.bigbuf_size, 1);
+    if (dev.bigbuf == NULL) {
+        fprintf(stderr, "failed to allocate BigBuf\n");
+        return EXIT_FAILURE;
+    }
+
+    if (bigbuf_file) {
+        if (load_bigbuf(&dev, bigbuf_file) != 0) {
+            free(dev.bigbuf);
+            return EXIT_FAILURE;
+        }
+    } else {
+        // a 125 kHz like square wave, 32 samples per period
+        for (uint32_t i = 0; i < dev.bigbuf_size; i++) {
+            dev.bigbuf[i] = ((i / 16) & 1) ? 200 : 56;
+        }
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = sigint_handler;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    int lfd = open_listener();
+    if (lfd < 0) {
+        free(dev.bigbuf);
+        return EXIT_FAILURE;
+    }
+
+    if (g_opts.socket_name) {
+        fprintf(stderr, "listening on socket:%s\n", g_opts.socket_name);
+    } else {
+        fprintf(stderr, "listening on tcp:localhost:%u\n", g_opts.port);
+    }
+
+    while (g_stop == 0) {
+        int fd = accept(lfd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fprintf(stderr, "accept: %s\n", strerror(errno));
+            break;
+        }
+        if (g_opts.socket_name == NULL) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        dev.fd = fd;
+        dev.seq = 0;
+        dev.tx_free_at = 0;
+        dev.cmds = dev.tagged = dev.frames_out = dev.bytes_in = dev.bytes_out = dev.crc_errors = 0;
+        fprintf(stderr, "client connected\n");
+
+        double start = now_s();
+        serve(&dev);
+        close(fd);
+
+        fprintf(stderr, "client disconnected\n");
+        print_stats(&dev, now_s() - start);
+
+        if (g_opts.once) {
+            break;
+        }
+    }
+
+    close(lfd);
+    free(dev.bigbuf);
+    free(g_script);
+    free(g_script_next);
+    return EXIT_SUCCESS;
+}